@@ -0,0 +1,1030 @@
+//
+//  main.cpp - measures the throughput of a hadesvm-cereon processor on
+//      guest loops that stress particular paths of the emulation:
+//      *   fault - every iteration executes an invalid instruction, whose
+//          PROGRAM interrupt a minimal handler counts and returns from.
+//          All execution engines are measured. So is the host cost of
+//          signalling a fault by a C++ exception (as the instruction
+//          handlers did before they raised interrupts in place) and by a
+//          status code, through the same depth of calls.
+//      *   xchg - each of several processors, running on its own host
+//          thread, repeatedly takes a spinlock by XCHG, increments a
+//          shared counter and releases the lock. The run is checked by
+//          the final value of the counter.
+//      *   smc - each iteration stores a new instruction into a basic
+//          block in another page and then runs it, so that the block is
+//          invalidated and decoded again every time. All execution
+//          engines are measured.
+//      *   ip - not a measurement but a check that instructions naming $ip
+//          as an ordinary register (MOV.L to and from $ip, LI.L to $ip)
+//          behave the same under all execution engines.
+//      *   vm - not a measurement but a check of the page walk of a
+//          Cereon-1P1V processor under all execution engines: loads and
+//          instruction fetches through the page tables, stale TLB entries
+//          until $pth is written, the new mappings after it, and the
+//          PROGRAM interrupts raised for an absent page and for a
+//          malformed page table entry.
+//      *   mix - a loop of inline ALU instructions, loads and stores,
+//          an overflowing ADD.L, a MUL.L, a call and return and both
+//          kinds of conditional branch, i.e. the instructions that the
+//          translated engine emits host code for and those it hands back
+//          to the interpreter. All execution engines are measured, and
+//          the final registers and $cc must agree with the reference.
+//  Usage: cereon-bench fault [<thousands of faults>]
+//         cereon-bench xchg [<processors> [<thousands of lock acquisitions per processor>]]
+//         cereon-bench smc [<thousands of iterations>]
+//         cereon-bench ip
+//         cereon-bench vm
+//         cereon-bench mix [<thousands of iterations>]
+//
+//////////
+#include "main.hpp"
+
+//////////
+//  A minimal assembler, just enough for the benchmark programs
+namespace
+{
+    class Assembler final
+    {
+    public:
+        Assembler(uint8_t * storage, uint64_t origin) : _storage(storage), _here(origin) {}
+
+        uint64_t    here() const { return _here; }
+
+        void        word(uint32_t instruction)
+        {
+            hadesvm::util::storeUnalignedWithByteOrder<uint32_t>(_storage + _here, instruction, hadesvm::util::ByteOrder::BigEndian);
+            _here += 4;
+        }
+        void        liL(unsigned r1, int32_t imm21)
+        {
+            word((r1 << 21) | (static_cast<uint32_t>(imm21) & 0x001FFFFF));
+        }
+        void        addiL(unsigned r1, unsigned r2, int16_t imm) { _rri(0x08000000, r1, r2, imm); }
+        void        subiL(unsigned r1, unsigned r2, int16_t imm) { _rri(0x0C000000, r1, r2, imm); }
+        void        movL(unsigned r1, unsigned r2)
+        {
+            word(0x04000240 | (r1 << 21) | (r2 << 16));
+        }
+        void        addL(unsigned r1, unsigned r2, unsigned r3) { _rrr(0x040002B0, r1, r2, r3); }
+        void        subL(unsigned r1, unsigned r2, unsigned r3) { _rrr(0x040002B1, r1, r2, r3); }
+        void        mulL(unsigned r1, unsigned r2, unsigned r3) { _rrr(0x040002B2, r1, r2, r3); }
+        void        xorL(unsigned r1, unsigned r2, unsigned r3) { _rrr(0x0400025E, r1, r2, r3); }
+        void        sltL(unsigned r1, unsigned r2, unsigned r3) { _rrr(0x04000272, r1, r2, r3); }
+        void        sltUL(unsigned r1, unsigned r2, unsigned r3) { _rrr(0x0400027A, r1, r2, r3); }
+        void        andiL(unsigned r1, unsigned r2, int16_t imm) { _rri(0x60000000, r1, r2, imm); }
+        void        oriL(unsigned r1, unsigned r2, int16_t imm) { _rri(0x64000000, r1, r2, imm); }
+        void        seqiL(unsigned r1, unsigned r2, int16_t imm) { _rri(0x40000000, r1, r2, imm); }
+        void        shliL(unsigned r1, unsigned r2, unsigned count)
+        {
+            word(0x04003000 | (r1 << 21) | (r2 << 16) | (count & 0x3F));
+        }
+        void        ll(unsigned r1, unsigned r2, int16_t imm) { _rri(0x98000000, r1, r2, imm); }
+        void        xchg(unsigned r1, unsigned r2, int16_t imm) { _rri(0x9C000000, r1, r2, imm); }
+        void        sl(unsigned r1, unsigned r2, int16_t imm) { _rri(0xAC000000, r1, r2, imm); }
+        void        bneiL(unsigned r1, int imm5, uint64_t target)
+        {
+            word(0x04008840 | (r1 << 21) | ((static_cast<uint32_t>(imm5) & 0x1F) << 16) |
+                 (static_cast<uint32_t>((target - _here - 4) >> 2) & 0x3F));
+        }
+        void        bltL(unsigned r1, unsigned r2, uint64_t target)
+        {
+            word(0xC8000000 | (r1 << 21) | (r2 << 16) |
+                 (static_cast<uint32_t>((target - _here - 4) >> 2) & 0xFFFF));
+        }
+        void        j(uint64_t target)
+        {
+            word(0x1C000000 | (static_cast<uint32_t>((target - _here - 4) >> 2) & 0x03FFFFFF));
+        }
+        void        jal(uint64_t target)
+        {
+            word(0x3C000000 | (static_cast<uint32_t>((target - _here - 4) >> 2) & 0x03FFFFFF));
+        }
+        void        jr(unsigned r1)
+        {
+            word(0x04000278 | (r1 << 21));
+        }
+        void        movCR(unsigned r, unsigned c)
+        {
+            word(0x04000200 | (r << 21) | (c << 16));
+        }
+        void        movRC(unsigned c, unsigned r)
+        {
+            word(0x04000201 | (c << 21) | (r << 16));
+        }
+        void        iret(unsigned inum)
+        {
+            word(0x04000218 | (inum << 21));
+        }
+        void        halt() { word(0x04000219); }
+
+    private:
+        uint8_t *const  _storage;
+        uint64_t        _here;
+
+        void        _rri(uint32_t opcode, unsigned r1, unsigned r2, int16_t imm)
+        {
+            word(opcode | (r1 << 21) | (r2 << 16) | static_cast<uint32_t>(static_cast<uint16_t>(imm)));
+        }
+        void        _rrr(uint32_t opcode, unsigned r1, unsigned r2, unsigned r3)
+        {
+            word(opcode | (r1 << 21) | (r2 << 16) | (r3 << 11));
+        }
+    };
+
+    //  Instructions, registers and interrupts
+    const uint32_t InvalidInstruction = 0x04000202;     //  an unassigned BASE1 opcode
+    const unsigned StateRegister = 0, PthRegister = 1, CcRegister = 3;
+    const unsigned IhstatePrgRegister = 19, IhaPrgRegister = 20, IscPrgRegister = 21;
+    const unsigned IpRegister = 31;
+    const unsigned ProgramInterruptNumber = 3;
+
+    //  The $state the benchmark programs run with: kernel mode, working,
+    //  big-endian, with HARDWARE and PROGRAM interrupts enabled
+    const uint64_t RunningState = UINT64_C(0x00000000A0000031);
+
+    //  Storage layout
+    const uint64_t DataAddress = 0x0800;    //  ...in r6
+    const uint64_t CodeAddress = 0x1000;    //  ...the restart address of processor 0
+    const uint64_t EntryStride = 8;         //  ...and of the next processors
+    const uint64_t HandlerAddress = 0x1800;
+    const int16_t StateValue = 0x00, FaultCount = 0x08, Iterations = 0x10;
+    const int16_t IpValue = 0x20, Skipped = 0x28, Reached = 0x30;
+    const int16_t PatchPair = 0x50, PatchedValue = 0x58, PatchDone = 0x60;
+    const int16_t Lock = 0x40, Counter = 0x48;
+    const int16_t VmStateValue = 0x70, NewDataPte = 0x78, NewCodePte = 0x80;
+    const int16_t FirstLoad = 0x88, StaleLoad = 0x90, SecondLoad = 0x98;
+    const int16_t FirstCall = 0xA0, SecondCall = 0xA8;
+    const int16_t PageFaultCode = 0xB0, PageTableCode = 0xB8, VmDone = 0xC0;
+    const int16_t MixScratch = 0xC8, MixDone = 0xD0, MixResults = 0x600;
+    const int16_t DoneFlags = 0x100, DoneFlagStride = 0x40;    //  ...one host cache line each
+    const unsigned MaxProcessors = 16;
+
+    void store64(uint8_t * ram, uint64_t address, uint64_t value)
+    {
+        hadesvm::util::storeUnalignedWithByteOrder<uint64_t>(ram + address, value, hadesvm::util::ByteOrder::BigEndian);
+    }
+
+    uint64_t load64(const uint8_t * ram, uint64_t address)
+    {
+        return hadesvm::util::loadUnalignedWithByteOrder<uint64_t>(ram + address, hadesvm::util::ByteOrder::BigEndian);
+    }
+
+    const char * engineName(hadesvm::cereon::ExecutionEngine engine)
+    {
+        if (engine == hadesvm::cereon::ExecutionEngine::Translated)
+        {
+            return "translated";
+        }
+        return (engine == hadesvm::cereon::ExecutionEngine::Threaded) ? "threaded" : "reference";
+    }
+
+    const hadesvm::cereon::ExecutionEngine AllEngines[] =
+    {
+        hadesvm::cereon::ExecutionEngine::Reference,
+        hadesvm::cereon::ExecutionEngine::Threaded,
+        hadesvm::cereon::ExecutionEngine::Translated
+    };
+
+    //////////
+    //  A VM with a memory bus, 1MB of RAM at address 0, an I/O bus and
+    //  the specified number of Cereon-1P1B (or, with virtualMemory,
+    //  Cereon-1P1V) processors. Each processor is
+    //  a primary one, so that all start working on reset, and starts at
+    //  its own entry point EntryStride bytes after the previous one's.
+    //  The processors are initialized but not started, as the benchmark
+    //  runs them itself.
+    class BenchMachine final
+    {
+        HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(BenchMachine)
+
+    public:
+        BenchMachine(hadesvm::cereon::ExecutionEngine engine, unsigned numProcessors, bool virtualMemory = false)
+            :   _vm("cereon-bench", "cereon-bench.hadesvm", hadesvm::cereon::CereonWorkstationArchitecture::instance()),
+                _ram(new hadesvm::cereon::ResidentRamUnit()),
+                _processors()
+        {
+            _vm.addComponent(new hadesvm::cereon::MemoryBus());
+            _ram->setStartAddress(0);
+            _ram->setSize(hadesvm::core::MemorySize::megabytes(1));
+            _vm.addComponent(_ram);
+            _vm.addComponent(new hadesvm::cereon::IoBus());
+            for (unsigned i = 0; i < numProcessors; i++)
+            {
+                hadesvm::cereon::Processor * processor =
+                    virtualMemory ?
+                        static_cast<hadesvm::cereon::Processor*>(new hadesvm::cereon::Cereon1P1V(static_cast<uint8_t>(i))) :
+                        static_cast<hadesvm::cereon::Processor*>(new hadesvm::cereon::Cereon1P1B(static_cast<uint8_t>(i)));
+                processor->setRestartAddress(CodeAddress + i * EntryStride);
+                processor->setExecutionEngine(engine);
+                _vm.addComponent(processor);
+                _processors.append(processor);
+            }
+
+            hadesvm::core::ComponentList components = _vm.components();
+            for (hadesvm::core::Component * component : components)
+            {
+                component->connect();
+            }
+            for (hadesvm::core::Component * component : components)
+            {
+                component->initialize();
+            }
+            for (hadesvm::core::Component * component : components)
+            {
+                if (dynamic_cast<hadesvm::cereon::Processor*>(component) == nullptr)
+                {
+                    component->start();
+                }
+            }
+        }
+
+        ~BenchMachine()
+        {   //  Processors were added last, so they go first
+            hadesvm::core::ComponentList components = _vm.components();
+            for (qsizetype i = components.size() - 1; i >= 0; i--)
+            {
+                components[i]->stop();
+                components[i]->deinitialize();
+                components[i]->disconnect();
+            }
+        }
+
+        uint8_t *   ram() { return _ram->hostData(true); }
+        hadesvm::cereon::Processor *    processor(unsigned index) { return _processors[index]; }
+
+    private:
+        hadesvm::core::VirtualMachine       _vm;
+        hadesvm::cereon::ResidentRamUnit *  _ram;
+        QList<hadesvm::cereon::Processor*>  _processors;
+    };
+
+    //////////
+    //  The fault loop: each iteration executes an invalid instruction,
+    //  whose PROGRAM interrupt handler counts the fault in memory and
+    //  returns to the instruction after it
+    void assembleFaultLoop(uint8_t * ram)
+    {
+        store64(ram, DataAddress + static_cast<uint64_t>(StateValue), RunningState);
+
+        Assembler a(ram, CodeAddress);
+        a.liL(6, static_cast<int32_t>(DataAddress));
+        a.liL(2, 0);
+        a.liL(1, static_cast<int32_t>(HandlerAddress));
+        a.movRC(IhaPrgRegister, 1);
+        a.ll(1, 6, StateValue);
+        a.movRC(IhstatePrgRegister, 1);
+        a.movRC(StateRegister, 1);
+        uint64_t loop = a.here();
+        a.word(InvalidInstruction);
+        a.j(loop);
+
+        Assembler h(ram, HandlerAddress);
+        h.addiL(2, 2, 1);
+        h.sl(2, 6, FaultCount);
+        h.iret(ProgramInterruptNumber);
+    }
+
+    bool measureFaultLoop(hadesvm::cereon::ExecutionEngine engine, uint64_t faults)
+    {
+        BenchMachine machine(engine, 1);
+        uint8_t * ram = machine.ram();
+        assembleFaultLoop(ram);
+
+        QElapsedTimer timer;
+        timer.start();
+        uint64_t cycles = 0;
+        uint64_t lastFaultCount = 0;
+        while (load64(ram, DataAddress + static_cast<uint64_t>(FaultCount)) < faults)
+        {
+            cycles += machine.processor(0)->runCycles(1000000);
+            uint64_t faultCount = load64(ram, DataAddress + static_cast<uint64_t>(FaultCount));
+            if (faultCount == lastFaultCount)
+            {   //  OOPS! The core has halted
+                fprintf(stderr, "cereon-bench: the %s engine stopped taking faults after %llu\n",
+                        engineName(engine), static_cast<unsigned long long>(faultCount));
+                return false;
+            }
+            lastFaultCount = faultCount;
+        }
+        qint64 elapsedNs = qMax(timer.nsecsElapsed(), Q_INT64_C(1));
+        uint64_t faultCount = load64(ram, DataAddress + static_cast<uint64_t>(FaultCount));
+
+        printf("%-10s engine:    %llu faults, %llu clock cycles, %.3f s, %.2f M faults/s\n",
+               engineName(engine),
+               static_cast<unsigned long long>(faultCount),
+               static_cast<unsigned long long>(cycles),
+               static_cast<double>(elapsedNs) / 1e9,
+               static_cast<double>(faultCount) * 1000.0 / static_cast<double>(elapsedNs));
+        return true;
+    }
+
+    //////////
+    //  The two ways of getting a fault from a memory access through the
+    //  instruction handler to the execution loop. The calls go through
+    //  volatile pointers so that the compiler cannot fold them.
+    struct SimulatedFault
+    {
+        unsigned    code;
+    };
+
+    unsigned throwingAccess(uint64_t address)
+    {
+        if ((address & 0x07) != 0)
+        {
+            throw SimulatedFault{1};
+        }
+        return 1;
+    }
+    unsigned (*volatile throwingAccessPointer)(uint64_t) = &throwingAccess;
+
+    unsigned throwingHandler(uint64_t address)
+    {
+        return throwingAccessPointer(address) + 1;
+    }
+    unsigned (*volatile throwingHandlerPointer)(uint64_t) = &throwingHandler;
+
+    bool returningAccess(uint64_t address, unsigned & pendingFault)
+    {
+        if ((address & 0x07) != 0)
+        {
+            pendingFault = 1;
+            return false;
+        }
+        return true;
+    }
+    bool (*volatile returningAccessPointer)(uint64_t, unsigned &) = &returningAccess;
+
+    unsigned returningHandler(uint64_t address, unsigned & pendingFault)
+    {
+        if (!returningAccessPointer(address, pendingFault))
+        {
+            return 1;
+        }
+        return 2;
+    }
+    unsigned (*volatile returningHandlerPointer)(uint64_t, unsigned &) = &returningHandler;
+
+    void measureFaultSignalling(uint64_t faults)
+    {
+        QElapsedTimer timer;
+        uint64_t caught = 0;
+        timer.start();
+        for (uint64_t i = 0; i < faults; i++)
+        {
+            try
+            {
+                throwingHandlerPointer(i | 1);
+            }
+            catch (const SimulatedFault & fault)
+            {
+                caught += fault.code;
+            }
+        }
+        qint64 throwingNs = qMax(timer.nsecsElapsed(), Q_INT64_C(1));
+
+        uint64_t returned = 0;
+        timer.restart();
+        for (uint64_t i = 0; i < faults; i++)
+        {
+            unsigned pendingFault = 0;
+            returningHandlerPointer(i | 1, pendingFault);
+            returned += pendingFault;
+        }
+        qint64 returningNs = qMax(timer.nsecsElapsed(), Q_INT64_C(1));
+
+        printf("C++ exception:        %llu faults, %.1f ns per fault\n",
+               static_cast<unsigned long long>(caught),
+               static_cast<double>(throwingNs) / static_cast<double>(qMax(faults, UINT64_C(1))));
+        printf("Status code:          %llu faults, %.1f ns per fault\n",
+               static_cast<unsigned long long>(returned),
+               static_cast<double>(returningNs) / static_cast<double>(qMax(faults, UINT64_C(1))));
+    }
+
+    //////////
+    //  The contention loop: processor i enters at its own entry point,
+    //  which points r8 at its done flag. Then each iteration takes the
+    //  lock by XCHG, increments the shared counter and releases the lock.
+    void assembleContentionLoop(uint8_t * ram, unsigned numProcessors, uint64_t iterations)
+    {
+        store64(ram, DataAddress + static_cast<uint64_t>(Iterations), iterations);
+
+        uint64_t common = CodeAddress + MaxProcessors * EntryStride;
+        for (unsigned i = 0; i < numProcessors; i++)
+        {
+            Assembler a(ram, CodeAddress + i * EntryStride);
+            a.liL(8, static_cast<int32_t>(DataAddress + static_cast<uint64_t>(DoneFlags + i * DoneFlagStride)));
+            a.j(common);
+        }
+
+        Assembler a(ram, common);
+        a.liL(6, static_cast<int32_t>(DataAddress));
+        a.ll(3, 6, Iterations);
+        uint64_t spin = a.here();
+        a.liL(1, 1);
+        a.xchg(1, 6, Lock);
+        a.bneiL(1, 0, spin);
+        a.ll(2, 6, Counter);
+        a.addiL(2, 2, 1);
+        a.sl(2, 6, Counter);
+        a.sl(1, 6, Lock);       //  r1 is 0 here
+        a.subiL(3, 3, 1);
+        a.bneiL(3, 0, spin);
+        a.liL(1, 1);
+        a.sl(1, 8, 0);
+        a.halt();
+    }
+
+    //  Runs a processor until its done flag is set, or until the time
+    //  limit expires if the processor stops short of that
+    class ProcessorThread final : public QThread
+    {
+        HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ProcessorThread)
+
+    public:
+        ProcessorThread(hadesvm::cereon::Processor * processor, const uint8_t * doneFlag)
+            :   _processor(processor), _doneFlag(doneFlag), _timedOut(false) {}
+
+        bool        timedOut() const { return _timedOut; }
+
+    protected:
+        virtual void    run() override
+        {
+            static const qint64 TimeLimitMs = 60 * 1000;
+
+            QElapsedTimer timer;
+            timer.start();
+            while (load64(_doneFlag, 0) == 0)
+            {   //  The flag is stored by this thread's own processor
+                if (timer.hasExpired(TimeLimitMs))
+                {
+                    _timedOut = true;
+                    break;
+                }
+                _processor->runCycles(100000);
+            }
+        }
+
+    private:
+        hadesvm::cereon::Processor *const   _processor;
+        const uint8_t *const                _doneFlag;
+        bool                                _timedOut;
+    };
+
+    bool measureContentionLoop(unsigned numProcessors, uint64_t iterations)
+    {
+        BenchMachine machine(hadesvm::cereon::ExecutionEngine::Threaded, numProcessors);
+        uint8_t * ram = machine.ram();
+        assembleContentionLoop(ram, numProcessors, iterations);
+
+        QList<ProcessorThread*> threads;
+        for (unsigned i = 0; i < numProcessors; i++)
+        {
+            threads.append(new ProcessorThread(
+                machine.processor(i), ram + DataAddress + static_cast<uint64_t>(DoneFlags + i * DoneFlagStride)));
+        }
+        QElapsedTimer timer;
+        timer.start();
+        for (ProcessorThread * thread : threads)
+        {
+            thread->start();
+        }
+        bool timedOut = false;
+        for (ProcessorThread * thread : threads)
+        {
+            thread->wait();
+            timedOut |= thread->timedOut();
+            delete thread;
+        }
+        qint64 elapsedNs = qMax(timer.nsecsElapsed(), Q_INT64_C(1));
+
+        uint64_t counter = load64(ram, DataAddress + static_cast<uint64_t>(Counter));
+        if (timedOut || counter != numProcessors * iterations)
+        {   //  OOPS! A processor has halted, or the lock has let two in at once
+            fprintf(stderr, "cereon-bench: %u processors ended with the counter at %llu instead of %llu\n",
+                    numProcessors,
+                    static_cast<unsigned long long>(counter),
+                    static_cast<unsigned long long>(numProcessors * iterations));
+            return false;
+        }
+        printf("%2u processor(s):      %llu lock acquisitions, %.3f s, %.2f M acquisitions/s\n",
+               numProcessors,
+               static_cast<unsigned long long>(counter),
+               static_cast<double>(elapsedNs) / 1e9,
+               static_cast<double>(counter) * 1000.0 / static_cast<double>(elapsedNs));
+        return true;
+    }
+
+    //////////
+    //  The self-modifying loop: the block at PatchAddress loads r4 by a
+    //  LI.L whose immediate operand each iteration increments by storing
+    //  the instruction pair it is in (r5). The block then stores r4, so a
+    //  block that is not decoded again after the store repeats a stale value.
+    const uint64_t PatchAddress = 0x2000;   //  ...in a watch page of its own
+    const uint64_t MaxPatchIterations = 1000 * 1000;    //  ...the LI.L immediate is 21 bits wide
+
+    void assembleSelfModifyingLoop(uint8_t * ram, uint64_t iterations)
+    {
+        store64(ram, DataAddress + static_cast<uint64_t>(Iterations), iterations);
+
+        Assembler a(ram, CodeAddress);
+        a.liL(6, static_cast<int32_t>(DataAddress));
+        a.liL(7, static_cast<int32_t>(PatchAddress));
+        a.ll(5, 6, PatchPair);
+        a.ll(2, 6, Iterations);
+        uint64_t loop = a.here();
+        a.sl(5, 7, 0);
+        a.j(PatchAddress);
+
+        Assembler p(ram, PatchAddress);
+        p.liL(8, 0);
+        p.liL(4, 0);        //  ...the patched instruction
+        p.sl(4, 6, PatchedValue);
+        p.addiL(5, 5, 1);
+        p.subiL(2, 2, 1);
+        uint64_t branch = p.here();
+        p.bneiL(2, 0, branch + 16);
+        p.liL(1, 1);
+        p.sl(1, 6, PatchDone);
+        p.halt();
+        p.j(loop);
+
+        store64(ram, DataAddress + static_cast<uint64_t>(PatchPair), load64(ram, PatchAddress));
+    }
+
+    bool measureSelfModifyingLoop(hadesvm::cereon::ExecutionEngine engine, uint64_t iterations)
+    {
+        BenchMachine machine(engine, 1);
+        uint8_t * ram = machine.ram();
+        assembleSelfModifyingLoop(ram, iterations);
+
+        QElapsedTimer timer;
+        timer.start();
+        uint64_t cycles = 0;
+        uint64_t lastPatchedValue = UINT64_MAX;
+        while (load64(ram, DataAddress + static_cast<uint64_t>(PatchDone)) == 0)
+        {
+            cycles += machine.processor(0)->runCycles(1000000);
+            uint64_t patchedValue = load64(ram, DataAddress + static_cast<uint64_t>(PatchedValue));
+            if (patchedValue == lastPatchedValue &&
+                load64(ram, DataAddress + static_cast<uint64_t>(PatchDone)) == 0)
+            {   //  OOPS! The core has halted, or runs a stale block
+                fprintf(stderr, "cereon-bench: the %s engine stopped at patched value %llu\n",
+                        engineName(engine), static_cast<unsigned long long>(patchedValue));
+                return false;
+            }
+            lastPatchedValue = patchedValue;
+        }
+        qint64 elapsedNs = qMax(timer.nsecsElapsed(), Q_INT64_C(1));
+        uint64_t patchedValue = load64(ram, DataAddress + static_cast<uint64_t>(PatchedValue));
+        if (patchedValue != iterations - 1)
+        {   //  OOPS! The last iteration ran a stale block
+            fprintf(stderr, "cereon-bench: the %s engine ended at patched value %llu instead of %llu\n",
+                    engineName(engine),
+                    static_cast<unsigned long long>(patchedValue),
+                    static_cast<unsigned long long>(iterations - 1));
+            return false;
+        }
+
+        printf("%-10s engine:    %llu iterations, %llu clock cycles, %.3f s, %.2f M iterations/s\n",
+               engineName(engine),
+               static_cast<unsigned long long>(iterations),
+               static_cast<unsigned long long>(cycles),
+               static_cast<double>(elapsedNs) / 1e9,
+               static_cast<double>(iterations) * 1000.0 / static_cast<double>(elapsedNs));
+        return true;
+    }
+
+    //////////
+    //  The $ip check: MOV.L reads $ip in the middle of a basic block, then
+    //  LI.L and MOV.L each write $ip, which must jump. An instruction that
+    //  is skipped by a jump would store to Skipped.
+    const uint64_t IpTargetAddress = 0x1100, IpSecondTargetAddress = 0x1200;
+
+    uint64_t assembleIpCheck(uint8_t * ram)
+    {
+        Assembler a(ram, CodeAddress);
+        a.liL(6, static_cast<int32_t>(DataAddress));
+        a.liL(1, 0xBAD);
+        uint64_t movAddress = a.here();
+        a.movL(9, IpRegister);
+        a.sl(9, 6, IpValue);
+        a.liL(IpRegister, static_cast<int32_t>(IpTargetAddress));
+        a.sl(1, 6, Skipped);
+        a.halt();
+
+        Assembler t(ram, IpTargetAddress);
+        t.liL(10, static_cast<int32_t>(IpSecondTargetAddress));
+        t.movL(IpRegister, 10);
+        t.sl(1, 6, Skipped);
+        t.halt();
+
+        Assembler u(ram, IpSecondTargetAddress);
+        u.liL(1, 1);
+        u.sl(1, 6, Reached);
+        u.halt();
+
+        //  $ip has already been advanced past the MOV.L when it is read
+        return movAddress + 4;
+    }
+
+    bool checkIpOperands(hadesvm::cereon::ExecutionEngine engine)
+    {
+        BenchMachine machine(engine, 1);
+        uint8_t * ram = machine.ram();
+        uint64_t expectedIpValue = assembleIpCheck(ram);
+
+        machine.processor(0)->runCycles(1000);
+
+        uint64_t ipValue = load64(ram, DataAddress + static_cast<uint64_t>(IpValue));
+        uint64_t skipped = load64(ram, DataAddress + static_cast<uint64_t>(Skipped));
+        uint64_t reached = load64(ram, DataAddress + static_cast<uint64_t>(Reached));
+        bool passed = (ipValue == expectedIpValue && skipped == 0 && reached == 1);
+        printf("%-10s engine:    MOV.L from $ip gave 0x%llX (expected 0x%llX), %s, %s: %s\n",
+               engineName(engine),
+               static_cast<unsigned long long>(ipValue),
+               static_cast<unsigned long long>(expectedIpValue),
+               (skipped == 0) ? "no jump fell through" : "a jump to $ip fell through",
+               (reached == 1) ? "target reached" : "target not reached",
+               passed ? "passed" : "FAILED");
+        return passed;
+    }
+    //////////
+    //  The virtual memory check: the program builds no page tables of its
+    //  own; the host sets up a single 4-level tree that identity-maps the
+    //  data, code and last-level table pages, maps VmDataPage and
+    //  VmCodePage to a first physical page each, leaves the page after
+    //  VmDataPage absent and gives the one after that a malformed entry.
+    //  The program then switches to virtual mode, loads from VmDataPage
+    //  and calls VmCodePage, retargets both entries to a second physical
+    //  page, loads again (still through the cached translation), writes
+    //  $pth to invalidate the TLBs and loads and calls again. The PROGRAM
+    //  interrupt handler runs in real mode and leaves the interrupt status
+    //  code in r10.
+    const uint64_t RootTableAddress = 0x10000;     //  ...then one table per page
+    const uint64_t LastTableAddress = RootTableAddress + 3 * 0x1000;
+    const uint64_t VmDataPage = 0x40000, VmCodePage = 0x50000;
+    const uint64_t FirstDataPage = 0x20000, SecondDataPage = 0x21000;
+    const uint64_t FirstCodePage = 0x30000, SecondCodePage = 0x31000;
+    const uint64_t FirstDataValue = 0x1111, SecondDataValue = 0x2222;
+    const uint64_t PtePresent = 0x01, PteWritable = 0x02, PteExecutable = 0x04, PteReserved = 0x10;
+    const uint64_t DPageFault = 0x0D, PageTable = 0x0B;
+
+    void assembleVmCheck(uint8_t * ram)
+    {
+        store64(ram, DataAddress + static_cast<uint64_t>(StateValue), RunningState);
+        store64(ram, DataAddress + static_cast<uint64_t>(VmStateValue), RunningState | 0x02);
+        store64(ram, DataAddress + static_cast<uint64_t>(NewDataPte), SecondDataPage | PtePresent);
+        store64(ram, DataAddress + static_cast<uint64_t>(NewCodePte), SecondCodePage | PtePresent | PteExecutable);
+
+        //  Logical addresses below 2MB all go through entry 0 of the
+        //  first three levels
+        for (uint64_t table = RootTableAddress; table < LastTableAddress; table += 0x1000)
+        {
+            store64(ram, table, (table + 0x1000) | PtePresent | PteWritable | PteExecutable);
+        }
+        auto mapPage = [&](uint64_t logicalAddress, uint64_t entry)
+                   {
+                       store64(ram, LastTableAddress + (logicalAddress >> 12) * 8, entry);
+                   };
+        mapPage(DataAddress, (DataAddress & ~UINT64_C(0xFFF)) | PtePresent | PteWritable);
+        mapPage(CodeAddress, CodeAddress | PtePresent | PteExecutable);
+        mapPage(LastTableAddress, LastTableAddress | PtePresent | PteWritable);
+        mapPage(VmDataPage, FirstDataPage | PtePresent);
+        mapPage(VmCodePage, FirstCodePage | PtePresent | PteExecutable);
+        mapPage(VmDataPage + 0x2000, (FirstDataPage + 0x2000) | PtePresent | PteReserved);
+        store64(ram, FirstDataPage, FirstDataValue);
+        store64(ram, SecondDataPage, SecondDataValue);
+
+        //  The two versions of the called page return their number in r12
+        for (uint64_t page : { FirstCodePage, SecondCodePage })
+        {
+            Assembler c(ram, page);
+            c.liL(12, (page == FirstCodePage) ? 1 : 2);
+            c.movL(IpRegister, 13);
+        }
+
+        Assembler a(ram, CodeAddress);
+        a.liL(6, static_cast<int32_t>(DataAddress));
+        a.liL(1, static_cast<int32_t>(HandlerAddress));
+        a.movRC(IhaPrgRegister, 1);
+        a.ll(1, 6, StateValue);
+        a.movRC(IhstatePrgRegister, 1);
+        a.movRC(StateRegister, 1);
+        a.liL(2, static_cast<int32_t>(RootTableAddress));
+        a.movRC(PthRegister, 2);
+        a.ll(1, 6, VmStateValue);
+        a.movRC(StateRegister, 1);
+        //  Now in virtual mode
+        a.liL(7, static_cast<int32_t>(VmDataPage));
+        a.ll(3, 7, 0);
+        a.sl(3, 6, FirstLoad);
+        a.liL(13, static_cast<int32_t>(a.here() + 8));
+        a.j(VmCodePage);
+        a.sl(12, 6, FirstCall);
+        a.liL(8, static_cast<int32_t>(LastTableAddress));
+        a.ll(4, 6, NewDataPte);
+        a.sl(4, 8, static_cast<int16_t>((VmDataPage >> 12) * 8));
+        a.ll(4, 6, NewCodePte);
+        a.sl(4, 8, static_cast<int16_t>((VmCodePage >> 12) * 8));
+        a.ll(3, 7, 0);
+        a.sl(3, 6, StaleLoad);
+        a.movRC(PthRegister, 2);
+        a.ll(3, 7, 0);
+        a.sl(3, 6, SecondLoad);
+        a.liL(13, static_cast<int32_t>(a.here() + 8));
+        a.j(VmCodePage);
+        a.sl(12, 6, SecondCall);
+        a.liL(10, 0);
+        a.ll(3, 7, 0x1000);
+        a.sl(10, 6, PageFaultCode);
+        a.liL(10, 0);
+        a.ll(3, 7, 0x2000);
+        a.sl(10, 6, PageTableCode);
+        a.liL(1, 1);
+        a.sl(1, 6, VmDone);
+        a.halt();
+
+        Assembler h(ram, HandlerAddress);
+        h.movCR(10, IscPrgRegister);
+        h.iret(ProgramInterruptNumber);
+    }
+
+    bool checkVirtualMemory(hadesvm::cereon::ExecutionEngine engine)
+    {
+        BenchMachine machine(engine, 1, true);
+        uint8_t * ram = machine.ram();
+        assembleVmCheck(ram);
+
+        machine.processor(0)->runCycles(1000);
+
+        uint64_t firstLoad = load64(ram, DataAddress + static_cast<uint64_t>(FirstLoad));
+        uint64_t staleLoad = load64(ram, DataAddress + static_cast<uint64_t>(StaleLoad));
+        uint64_t secondLoad = load64(ram, DataAddress + static_cast<uint64_t>(SecondLoad));
+        uint64_t firstCall = load64(ram, DataAddress + static_cast<uint64_t>(FirstCall));
+        uint64_t secondCall = load64(ram, DataAddress + static_cast<uint64_t>(SecondCall));
+        uint64_t pageFaultCode = load64(ram, DataAddress + static_cast<uint64_t>(PageFaultCode));
+        uint64_t pageTableCode = load64(ram, DataAddress + static_cast<uint64_t>(PageTableCode));
+        bool done = (load64(ram, DataAddress + static_cast<uint64_t>(VmDone)) == 1);
+        bool passed = (firstLoad == FirstDataValue && staleLoad == FirstDataValue && secondLoad == SecondDataValue &&
+                       firstCall == 1 && secondCall == 2 &&
+                       pageFaultCode == DPageFault && pageTableCode == PageTable && done);
+        printf("%-10s engine:    loads 0x%llX/0x%llX/0x%llX, calls %llu/%llu, interrupts 0x%llX/0x%llX, %s: %s\n",
+               engineName(engine),
+               static_cast<unsigned long long>(firstLoad),
+               static_cast<unsigned long long>(staleLoad),
+               static_cast<unsigned long long>(secondLoad),
+               static_cast<unsigned long long>(firstCall),
+               static_cast<unsigned long long>(secondCall),
+               static_cast<unsigned long long>(pageFaultCode),
+               static_cast<unsigned long long>(pageTableCode),
+               done ? "completed" : "did not complete",
+               passed ? "passed" : "FAILED");
+        return passed;
+    }
+
+    //////////
+    //  The mixed loop: each iteration runs a chain of ALU instructions,
+    //  stores and reloads a register, multiplies, adds two values that
+    //  overflow on some iterations (which only sets $flags, as the
+    //  program runs with integer overflow exceptions disabled), calls and
+    //  returns from a subroutine and takes or skips a branch depending on
+    //  the data. At the end the program stores the registers it used and
+    //  $cc, which all engines must agree on.
+    const unsigned MixResultRegisters[] = { 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 1 };  //  ...r1 holds $cc
+    const uint64_t MaxCyclesPerMixIteration = 100;
+
+    void assembleMixedLoop(uint8_t * ram, uint64_t iterations)
+    {
+        store64(ram, DataAddress + static_cast<uint64_t>(Iterations), iterations);
+
+        Assembler a(ram, CodeAddress);
+        uint64_t subroutine = CodeAddress + 0x200;
+        a.liL(6, static_cast<int32_t>(DataAddress));
+        a.ll(2, 6, Iterations);
+        a.liL(4, 0);
+        a.liL(5, 1);
+        a.liL(7, 0x1234);
+        a.liL(15, 0);
+        uint64_t loop = a.here();
+        a.addL(4, 4, 5);
+        a.xorL(7, 7, 4);
+        a.shliL(8, 7, 3);
+        a.subL(8, 8, 4);
+        a.andiL(9, 8, 0xFF);
+        a.oriL(9, 9, 0x100);
+        a.sltL(10, 8, 4);
+        a.sltUL(11, 8, 4);
+        a.addL(4, 4, 10);
+        a.addL(4, 4, 11);
+        a.seqiL(12, 9, 0x1FF);
+        a.addL(4, 4, 12);
+        a.sl(4, 6, MixScratch);
+        a.ll(13, 6, MixScratch);
+        a.mulL(13, 13, 5);
+        a.shliL(14, 5, 62);
+        a.addL(15, 14, 14);     //  ...overflows when r5 % 4 is 1 or 2
+        a.jal(subroutine);
+        uint64_t branch = a.here();
+        a.bltL(8, 4, branch + 8);
+        a.addiL(4, 4, 7);
+        a.addiL(5, 5, 3);
+        a.subiL(2, 2, 1);
+        a.bneiL(2, 0, loop);
+        a.movCR(1, CcRegister);
+        int16_t offset = MixResults;
+        for (unsigned r : MixResultRegisters)
+        {
+            a.sl(r, 6, offset);
+            offset = static_cast<int16_t>(offset + 8);
+        }
+        a.liL(1, 1);
+        a.sl(1, 6, MixDone);
+        a.halt();
+        Q_ASSERT(a.here() <= subroutine);
+
+        Assembler s(ram, subroutine);
+        s.xorL(4, 4, 13);
+        s.jr(30);
+    }
+
+    bool measureMixedLoop(hadesvm::cereon::ExecutionEngine engine, uint64_t iterations, QList<uint64_t> & results)
+    {
+        BenchMachine machine(engine, 1);
+        uint8_t * ram = machine.ram();
+        assembleMixedLoop(ram, iterations);
+
+        QElapsedTimer timer;
+        timer.start();
+        uint64_t cycles = 0;
+        while (load64(ram, DataAddress + static_cast<uint64_t>(MixDone)) == 0)
+        {
+            if (cycles > iterations * MaxCyclesPerMixIteration)
+            {   //  OOPS! The core has halted, or loops where it should not
+                fprintf(stderr, "cereon-bench: the %s engine did not complete the mixed loop in %llu clock cycles\n",
+                        engineName(engine), static_cast<unsigned long long>(cycles));
+                return false;
+            }
+            cycles += machine.processor(0)->runCycles(1000000);
+        }
+        qint64 elapsedNs = qMax(timer.nsecsElapsed(), Q_INT64_C(1));
+
+        QList<uint64_t> engineResults;
+        for (size_t i = 0; i < sizeof(MixResultRegisters) / sizeof(MixResultRegisters[0]); i++)
+        {
+            engineResults.append(load64(ram, DataAddress + static_cast<uint64_t>(MixResults) + i * 8));
+        }
+        bool passed = true;
+        if (results.isEmpty())
+        {   //  This is the reference
+            results = engineResults;
+        }
+        else
+        {
+            for (qsizetype i = 0; i < results.size(); i++)
+            {
+                if (engineResults[i] != results[i])
+                {
+                    fprintf(stderr, "cereon-bench: the %s engine ended with r%u = 0x%llX instead of 0x%llX\n",
+                            engineName(engine),
+                            MixResultRegisters[i],
+                            static_cast<unsigned long long>(engineResults[i]),
+                            static_cast<unsigned long long>(results[i]));
+                    passed = false;
+                }
+            }
+        }
+
+        printf("%-10s engine:    %llu iterations, %llu clock cycles, %.3f s, %.2f M iterations/s, $cc = %llu: %s\n",
+               engineName(engine),
+               static_cast<unsigned long long>(iterations),
+               static_cast<unsigned long long>(cycles),
+               static_cast<double>(elapsedNs) / 1e9,
+               static_cast<double>(iterations) * 1000.0 / static_cast<double>(elapsedNs),
+               static_cast<unsigned long long>(engineResults.last()),
+               passed ? "passed" : "FAILED");
+        return passed;
+    }
+}
+
+//////////
+//  Entry point
+int main(int argc, char ** argv)
+{
+    //  Components may only be managed from the application's main thread
+    QCoreApplication application(argc, argv);
+
+    bool fault = (argc >= 2 && strcmp(argv[1], "fault") == 0);
+    bool xchg = (argc >= 2 && strcmp(argv[1], "xchg") == 0);
+    bool smc = (argc >= 2 && strcmp(argv[1], "smc") == 0);
+    bool ip = (argc == 2 && strcmp(argv[1], "ip") == 0);
+    bool vm = (argc == 2 && strcmp(argv[1], "vm") == 0);
+    bool mix = (argc >= 2 && strcmp(argv[1], "mix") == 0);
+    uint64_t faults = UINT64_C(1000) * 1000;
+    unsigned long numProcessors = 4;
+    uint64_t iterations = UINT64_C(100) * 1000;
+    if ((!fault && !xchg && !smc && !ip && !vm && !mix) ||
+        (fault && (argc > 3 ||
+                   (argc == 3 && (faults = strtoull(argv[2], nullptr, 10) * 1000) == 0))) ||
+        (xchg && (argc > 4 ||
+                  (argc >= 3 && ((numProcessors = strtoul(argv[2], nullptr, 10)) == 0 || numProcessors > MaxProcessors)) ||
+                  (argc == 4 && (iterations = strtoull(argv[3], nullptr, 10) * 1000) == 0))) ||
+        (smc && (argc > 3 ||
+                 (argc == 3 && ((iterations = strtoull(argv[2], nullptr, 10) * 1000) == 0 || iterations > MaxPatchIterations)))) ||
+        (mix && (argc > 3 ||
+                 (argc == 3 && (iterations = strtoull(argv[2], nullptr, 10) * 1000) == 0))))
+    {
+        fprintf(stderr, "Usage: cereon-bench fault [<thousands of faults>]\n"
+                        "       cereon-bench xchg [<processors> [<thousands of lock acquisitions per processor>]]\n"
+                        "       cereon-bench smc [<thousands of iterations, up to 1000>]\n"
+                        "       cereon-bench ip\n"
+                        "       cereon-bench vm\n"
+                        "       cereon-bench mix [<thousands of iterations>]\n");
+        return 1;
+    }
+
+    try
+    {
+        if (fault)
+        {
+            printf("Fault loop:           a PROGRAM interrupt every 5 instructions\n");
+            for (hadesvm::cereon::ExecutionEngine engine : AllEngines)
+            {
+                if (!measureFaultLoop(engine, faults))
+                {
+                    return 1;
+                }
+            }
+            measureFaultSignalling(faults);
+        }
+        else if (smc)
+        {
+            printf("Self-modifying loop:  a basic block patched before every run\n");
+            for (hadesvm::cereon::ExecutionEngine engine : AllEngines)
+            {
+                if (!measureSelfModifyingLoop(engine, iterations))
+                {
+                    return 1;
+                }
+            }
+        }
+        else if (ip)
+        {
+            printf("$ip check:            MOV.L and LI.L naming $ip\n");
+            bool passed = true;
+            for (hadesvm::cereon::ExecutionEngine engine : AllEngines)
+            {
+                passed &= checkIpOperands(engine);
+            }
+            if (!passed)
+            {
+                return 1;
+            }
+        }
+        else if (vm)
+        {
+            printf("Virtual memory check: page walk, TLB invalidation and page faults\n");
+            bool passed = true;
+            for (hadesvm::cereon::ExecutionEngine engine : AllEngines)
+            {
+                passed &= checkVirtualMemory(engine);
+            }
+            if (!passed)
+            {
+                return 1;
+            }
+        }
+        else if (mix)
+        {
+            printf("Mixed loop:           ALU, load/store, MUL.L, overflow, call/return and branches\n");
+            QList<uint64_t> referenceResults;
+            bool passed = true;
+            for (hadesvm::cereon::ExecutionEngine engine : AllEngines)
+            {
+                passed &= measureMixedLoop(engine, iterations, referenceResults);
+            }
+            if (!passed)
+            {
+                return 1;
+            }
+        }
+        else
+        {   //  A single processor first, for the uncontended rate
+            printf("Contention loop:      XCHG spinlock around a shared counter, %llu iterations per processor\n",
+                   static_cast<unsigned long long>(iterations));
+            if (!measureContentionLoop(1, iterations) ||
+                (numProcessors > 1 && !measureContentionLoop(static_cast<unsigned>(numProcessors), iterations)))
+            {
+                return 1;
+            }
+        }
+    }
+    catch (const hadesvm::core::VirtualApplianceException & ex)
+    {
+        fprintf(stderr, "cereon-bench: %s\n", ex.message().toUtf8().constData());
+        return 1;
+    }
+    return 0;
+}
+
+//  End of main.cpp
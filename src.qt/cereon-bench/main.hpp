@@ -0,0 +1,18 @@
+//
+//  main.hpp - The master header
+//
+//////////
+
+//////////
+//  HADES VM
+#include "hadesvm-util/API.hpp"
+#include "hadesvm-core/API.hpp"
+#include "hadesvm-ieee754/API.hpp"
+#include "hadesvm-cereon/API.hpp"
+
+//////////
+//  CRT
+#include <stdio.h>
+#include <string.h>
+
+//  End of main.hpp
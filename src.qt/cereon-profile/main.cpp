@@ -0,0 +1,159 @@
+//
+//  main.cpp - runs a virtual appliance headless for a while with its Cereon
+//  processors profiled (see hadesvm-cereon/Profiler.hpp) and exports the
+//  profile as "collapsed stacks", ready for flame graph tools.
+//  If the VA has several Cereon processors, the profile of each is written
+//  to "<profile file>.<processor id>".
+//  The VA configuration is left as it was.
+//
+//////////
+#include "main.hpp"
+
+//////////
+//  Defaults
+static const unsigned DefaultProfilingInterval = 100000;
+
+//////////
+//  Helpers
+static bool parseUnsigned(const char * s, unsigned & value)
+{
+    return hadesvm::util::fromString(QString(s), value);
+}
+
+//////////
+//  The program entry point
+int main(int argc, char ** argv)
+{
+    if (argc < 4 || argc > 6)
+    {
+        printf("Usage: cereon-profile <VA file> <seconds> <profile file> [<symbols file> [<profiling interval>]]\n");
+        return EXIT_FAILURE;
+    }
+
+    unsigned seconds = 0;
+    if (!parseUnsigned(argv[2], seconds) || seconds == 0)
+    {
+        printf("Invalid number of seconds %s\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+    unsigned profilingInterval = DefaultProfilingInterval;
+    if (argc == 6 &&
+        (!parseUnsigned(argv[5], profilingInterval) ||
+         profilingInterval < hadesvm::cereon::Processor::MinProfilingInterval ||
+         profilingInterval > hadesvm::cereon::Processor::MaxProfilingInterval))
+    {
+        printf("Invalid profiling interval %s\n", argv[5]);
+        return EXIT_FAILURE;
+    }
+
+    //  Components may need a QApplication, but not a display
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+    hadesvm::util::PluginManager::loadPlugins();
+
+    //  Load the VA and find its Cereon processors
+    hadesvm::core::VirtualAppliance * va = nullptr;
+    try
+    {
+        va = hadesvm::core::VirtualAppliance::load(QFileInfo(argv[1]).absoluteFilePath());
+    }
+    catch (const hadesvm::core::VirtualApplianceException & ex)
+    {
+        printf("Cannot load %s: %s\n", argv[1], ex.what());
+        return EXIT_FAILURE;
+    }
+    QList<hadesvm::cereon::Processor*> processors;
+    for (hadesvm::core::Component * component : va->components())
+    {
+        if (hadesvm::cereon::Processor * processor = dynamic_cast<hadesvm::cereon::Processor*>(component))
+        {
+            processors.append(processor);
+        }
+    }
+    if (processors.isEmpty())
+    {
+        printf("%s has no Cereon processors\n", argv[1]);
+        delete va;
+        return EXIT_FAILURE;
+    }
+
+    //  Profile them, remembering how they were configured
+    QString profileFilePath = QFileInfo(argv[3]).absoluteFilePath();
+    QString symbolsFilePath = (argc >= 5) ? QFileInfo(argv[4]).absoluteFilePath() : QString();
+    struct SavedSettings
+    {
+        unsigned    profilingInterval;
+        QString     profileFilePath;
+        QString     profileSymbolsFilePath;
+    };
+    QList<SavedSettings> savedSettings;
+    QStringList profileFilePaths;
+    for (hadesvm::cereon::Processor * processor : processors)
+    {
+        savedSettings.append(SavedSettings{processor->profilingInterval(),
+                                           processor->profileFilePath(),
+                                           processor->profileSymbolsFilePath()});
+        QString path = profileFilePath;
+        if (processors.size() > 1)
+        {
+            path += "." + hadesvm::util::toString(static_cast<unsigned>(processor->id()));
+        }
+        processor->setProfilingInterval(profilingInterval);
+        processor->setProfileFilePath(path);
+        processor->setProfileSymbolsFilePath(symbolsFilePath);
+        QFile::remove(path);    //  ...so that a profile left by an earlier run isn't taken for this one
+        profileFilePaths.append(path);
+    }
+
+    //  Run the VA for the requested time; the processors write their
+    //  profiles as they stop
+    bool ok = true;
+    try
+    {
+        va->start();
+        QTimer::singleShot(static_cast<int>(qMin(seconds, INT_MAX / 1000u) * 1000), &a, &QApplication::quit);
+        a.exec();
+        va->stop();
+    }
+    catch (const hadesvm::core::VirtualApplianceException & ex)
+    {
+        printf("Cannot start %s: %s\n", argv[1], ex.what());
+        ok = false;
+    }
+
+    //  Stopping has saved the VA with the profiling settings - undo that
+    for (qsizetype i = 0; i < processors.size(); i++)
+    {
+        processors[i]->setProfilingInterval(savedSettings[i].profilingInterval);
+        processors[i]->setProfileFilePath(savedSettings[i].profileFilePath);
+        processors[i]->setProfileSymbolsFilePath(savedSettings[i].profileSymbolsFilePath);
+    }
+    try
+    {
+        va->save();
+    }
+    catch (const hadesvm::core::VirtualApplianceException & ex)
+    {
+        printf("Cannot restore the configuration of %s: %s\n", argv[1], ex.what());
+        ok = false;
+    }
+    delete va;
+
+    if (ok)
+    {
+        for (const QString & path : profileFilePaths)
+        {
+            if (!QFileInfo::exists(path))
+            {
+                printf("Cannot create %s\n", path.toUtf8().constData());
+                ok = false;
+            }
+        }
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//  End of main.cpp
@@ -0,0 +1,19 @@
+//
+//  main.hpp - The master header
+//
+//////////
+
+//////////
+//  HADES VM
+#include "hadesvm-util/API.hpp"
+#include "hadesvm-core/API.hpp"
+#include "hadesvm-ieee754/API.hpp"
+#include "hadesvm-cereon/API.hpp"
+
+//////////
+//  CRT
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//  End of main.hpp
@@ -0,0 +1,13 @@
+include(../hadesvm.pri)
+QT -= core gui widgets xml network
+win32-msvc {
+    QMAKE_CXXFLAGS += /wd5045 /wd4996
+}
+
+CONFIG += cmdline
+
+SOURCES += \
+        main.cpp
+
+HEADERS += \
+    main.hpp
@@ -0,0 +1,186 @@
+//
+//  main.cpp - decodes a Cereon execution trace (see hadesvm-cereon/Tracer.hpp)
+//  into a text execution stream, one event per line:
+//      <core> <$cc at chunk start> I <address>     - an instruction was executed
+//      <core> <$cc at chunk start> B <address>     - ...and branched to the address
+//      <core> <$cc at chunk start> L <address>     - a load from the logical address
+//      <core> <$cc at chunk start> S <address>     - a store to the logical address
+//      <core> <$cc at chunk start> INT <kind> <interrupt status code>
+//      <core> <$cc at chunk start> LOST            - some of the core's trace was lost
+//
+//////////
+#include "main.hpp"
+
+//////////
+//  Trace format constants - must match hadesvm-cereon/Tracer.hpp
+static const uint32_t FormatVersion = 1;
+static const uint8_t LossFlag = 0x01;
+
+static const char * const RecordKindNames[] = { "I", "B", "L", "S", "INT" };
+static const char * const InterruptNames[] = { "TIMER", "IO", "SVC", "PROGRAM", "EXTERNAL", "HARDWARE" };
+
+//////////
+//  Helpers
+static uint64_t loadLittleEndian(const uint8_t * bytes, size_t count)
+{
+    uint64_t value = 0;
+    for (size_t i = count; i > 0; i--)
+    {
+        value = (value << 8) | bytes[i - 1];
+    }
+    return value;
+}
+
+//  Returns false if the varint does not end before "end"
+static bool getVarint(const uint8_t *& p, const uint8_t * end, uint64_t & value)
+{
+    value = 0;
+    for (unsigned shift = 0; p < end && shift < 64; shift += 7)
+    {
+        uint8_t b = *p++;
+        value |= static_cast<uint64_t>(b & 0x7F) << shift;
+        if ((b & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint64_t unzigzag(uint64_t zigzag)
+{
+    return (zigzag >> 1) ^ (0 - (zigzag & 1));
+}
+
+//  Decodes the records of a single chunk; returns false if they are malformed
+static bool decodeChunk(FILE * output, unsigned coreId, uint64_t cc, const uint8_t * p, const uint8_t * end)
+{
+    uint64_t lastIp = 0, lastDataAddress = 0;
+    while (p < end)
+    {
+        uint8_t tag = *p++;
+        unsigned kind = tag & 0x07;
+        if (kind == 4)
+        {   //  Interrupt
+            unsigned interrupt = static_cast<unsigned>(tag >> 3);
+            uint64_t interruptStatusCode;
+            if (interrupt >= sizeof(InterruptNames) / sizeof(InterruptNames[0]) ||
+                !getVarint(p, end, interruptStatusCode))
+            {
+                return false;
+            }
+            fprintf(output, "%u %llu INT %s 0x%016llX\n",
+                    coreId, static_cast<unsigned long long>(cc),
+                    InterruptNames[interrupt], static_cast<unsigned long long>(interruptStatusCode));
+            continue;
+        }
+        if (kind > 4)
+        {
+            return false;
+        }
+        uint64_t zigzag;
+        if ((tag & 0x80) == 0)
+        {
+            zigzag = static_cast<uint64_t>((tag >> 3) & 0x0F);
+        }
+        else if (!getVarint(p, end, zigzag))
+        {
+            return false;
+        }
+        uint64_t delta = unzigzag(zigzag), address = 0;
+        switch (kind)
+        {
+            case 0:     //  Instruction
+                address = lastIp + 4 + delta;
+                lastIp = address;
+                break;
+            case 1:     //  Branch
+                address = lastIp + delta;
+                lastIp = address - 4;
+                break;
+            case 2:     //  Load
+            case 3:     //  Store
+                address = lastDataAddress + delta;
+                lastDataAddress = address;
+                break;
+            default:
+                return false;
+        }
+        fprintf(output, "%u %llu %s 0x%016llX\n",
+                coreId, static_cast<unsigned long long>(cc),
+                RecordKindNames[kind], static_cast<unsigned long long>(address));
+    }
+    return true;
+}
+
+//////////
+//  The program entry point
+int main(int argc, char ** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        printf("Usage: cereon-trace <trace file> [<output file>]\n");
+        return EXIT_FAILURE;
+    }
+
+    FILE * input = fopen(argv[1], "rb");
+    if (input == NULL)
+    {
+        printf("Cannot open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    FILE * output = (argc == 3) ? fopen(argv[2], "w") : stdout;
+    if (output == NULL)
+    {
+        printf("Cannot create %s\n", argv[2]);
+        fclose(input);
+        return EXIT_FAILURE;
+    }
+
+    //  Check the file header
+    int exitCode = EXIT_SUCCESS;
+    uint8_t header[12];
+    if (fread(header, 1, sizeof(header), input) != sizeof(header) ||
+        memcmp(header, "HVMTRACE", 8) != 0 ||
+        loadLittleEndian(header + 8, 4) != FormatVersion)
+    {
+        printf("%s is not a Cereon trace file\n", argv[1]);
+        exitCode = EXIT_FAILURE;
+    }
+
+    //  Go chunk by chunk
+    static uint8_t records[65536];
+    while (exitCode == EXIT_SUCCESS &&
+           fread(header, 1, sizeof(header), input) == sizeof(header))
+    {
+        unsigned coreId = header[0];
+        uint8_t flags = header[1];
+        size_t size = static_cast<size_t>(loadLittleEndian(header + 2, 2));
+        uint64_t cc = loadLittleEndian(header + 4, 8);
+        if (fread(records, 1, size, input) != size)
+        {
+            printf("%s is truncated\n", argv[1]);
+            exitCode = EXIT_FAILURE;
+            break;
+        }
+        if ((flags & LossFlag) != 0)
+        {
+            fprintf(output, "%u %llu LOST\n", coreId, static_cast<unsigned long long>(cc));
+        }
+        if (!decodeChunk(output, coreId, cc, records, records + size))
+        {
+            printf("%s is corrupt\n", argv[1]);
+            exitCode = EXIT_FAILURE;
+        }
+    }
+
+    //  Cleanup
+    fclose(input);
+    if (output != stdout)
+    {
+        fclose(output);
+    }
+    return exitCode;
+}
+
+//  End of main.cpp
@@ -0,0 +1,13 @@
+//
+//  main.hpp - The master header
+//
+//////////
+
+//////////
+//  CRT
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//  End of main.hpp
@@ -23,6 +23,9 @@
 #include "hadesvm-cereon/Alu.hpp"
 #include "hadesvm-cereon/Memory.hpp"
 #include "hadesvm-cereon/Io.hpp"
+#include "hadesvm-cereon/Profiler.hpp"
+#include "hadesvm-cereon/Tracer.hpp"
+#include "hadesvm-cereon/X64Emitter.hpp"
 #include "hadesvm-cereon/ProcessorCore.hpp"
 #include "hadesvm-cereon/Processor.hpp"
 #include "hadesvm-cereon/Cmos1.hpp"
@@ -0,0 +1,66 @@
+//
+//  hadesvm-cereon/Cereon1P1V.cpp
+//
+//  hadesvm::cereon::Cereon1P1V class implementation
+//
+//////////
+#include "hadesvm-cereon/API.hpp"
+using namespace hadesvm::cereon;
+
+//////////
+//  Constants
+const ByteOrder      Cereon1P1V::DefaultByteOrder = ByteOrder::BigEndian;
+const uint64_t       Cereon1P1V::DefaultRestartAddress = UINT64_C(0xFFFFFFFFFFF00000);
+const hadesvm::core::ClockFrequency Cereon1P1V::DefaultClockFrequency = hadesvm::core::ClockFrequency::megahertz(20);
+
+//////////
+//  Construction/destruction
+Cereon1P1V::Cereon1P1V(uint8_t id)
+    :   Processor(DefaultClockFrequency, id, DefaultByteOrder, false, DefaultRestartAddress, true),
+        //  Processor blocks
+        _mmu(),
+        _core(this, 0, Feature::Base + Feature::VirtualMemory, DefaultByteOrder, false, &_mmu)
+{
+}
+
+Cereon1P1V::~Cereon1P1V() noexcept
+{
+}
+
+//////////
+//  Cereon1P1V::Type
+HADESVM_IMPLEMENT_SINGLETON(Cereon1P1V::Type)
+Cereon1P1V::Type::Type() {}
+Cereon1P1V::Type::~Type() {}
+
+QString Cereon1P1V::Type::mnemonic() const
+{
+    return "Cereon1P1V";
+}
+
+QString Cereon1P1V::Type::displayName() const
+{
+    return "Cereon-1P1V";
+}
+
+hadesvm::core::ComponentCategory * Cereon1P1V::Type::category() const
+{
+    return hadesvm::core::StandardComponentCategories::Processors;
+}
+
+bool Cereon1P1V::Type::isCompatibleWith(hadesvm::core::VirtualArchitecture * architecture) const
+{
+    return architecture == CereonWorkstationArchitecture::instance();
+}
+
+bool Cereon1P1V::Type::isCompatibleWith(hadesvm::core::VirtualApplianceType * type) const
+{
+    return type == hadesvm::core::VirtualMachineType::instance();
+}
+
+Cereon1P1V * Cereon1P1V::Type::createComponent()
+{
+    return new Cereon1P1V(0);
+}
+
+//  End of hadesvm-cereon/Cereon1P1V.cpp
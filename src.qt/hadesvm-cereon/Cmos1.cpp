@@ -173,6 +173,7 @@ void Cmos1::initialize() throws(hadesvm::core::VirtualApplianceException)
     _operationalState = _OperationalState::_Ready;
     _clockTicksBetweenTimeUpdates = static_cast<unsigned>(_clockFrequency.toHz() / 1000);
     _clockTicksUntilTimeUpdate = 0;
+    _calendarTimeBase = QDateTime::currentDateTimeUtc();
 
     _state = State::Initialized;
 }
@@ -186,6 +187,16 @@ void Cmos1::start() throws(hadesvm::core::VirtualApplianceException)
         return;
     }
 
+    //  Delays and calendar time updates go on in virtual time
+    QMutexLocker lock(&_runtimeStateGuard);
+    hadesvm::core::ClockScheduler * clockScheduler = virtualAppliance()->clockScheduler();
+    if (_operationalState != _OperationalState::_Ready)
+    {
+        clockScheduler->scheduleWakeUp(this, _clockTicksToDelay);
+    }
+    _nextTimeUpdate = clockScheduler->now() +
+                      hadesvm::core::ClockScheduler::clockTicksToNs(_clockFrequency, _clockTicksUntilTimeUpdate);
+
     _state = State::Running;
 }
 
@@ -198,6 +209,18 @@ void Cmos1::stop() noexcept
         return;
     }
 
+    //  Remember how far delays and calendar time updates are, in clock ticks
+    QMutexLocker lock(&_runtimeStateGuard);
+    hadesvm::core::ClockScheduler * clockScheduler = virtualAppliance()->clockScheduler();
+    _clockTicksToDelay = static_cast<unsigned>(
+        qMin(clockScheduler->cancelWakeUp(this), static_cast<uint64_t>(UINT_MAX)));
+    uint64_t now = clockScheduler->now();
+    _clockTicksUntilTimeUpdate = (_nextTimeUpdate > now) ?
+        static_cast<unsigned>(
+            qMin(hadesvm::core::ClockScheduler::nsToClockTicks(_clockFrequency, _nextTimeUpdate - now),
+                 static_cast<uint64_t>(UINT_MAX))) :
+        0;
+
     _state = State::Initialized;
 }
 
@@ -251,75 +274,14 @@ void Cmos1::reset() noexcept
 }
 
 //////////
-//  hadesvm::core::IClockedComponentAspect
-void Cmos1::onClockTick() noexcept
+//  hadesvm::core::IScheduledComponent
+void Cmos1::onWakeUp() noexcept
 {
     QMutexLocker lock(&_runtimeStateGuard);
 
-    if (_clockTicksBetweenTimeUpdates == 0 || _clockTicksUntilTimeUpdate == 0)
-    {   //  Update calendar time in bytes 0..15 of the content
-        _clockTicksUntilTimeUpdate = _clockTicksBetweenTimeUpdates;
-        QDateTime now = QDateTime::currentDateTimeUtc();
-        QString nowAsString = now.toString(Qt::DateFormat::ISODateWithMs);
-        //  qDebug() << nowAsString;
-        //  yyyy-MM-ddTHH:mm:ss.zzz
-        Q_ASSERT(nowAsString.length() >= 23);
-        Q_ASSERT(nowAsString[0].isDigit());
-        Q_ASSERT(nowAsString[1].isDigit());
-        Q_ASSERT(nowAsString[2].isDigit());
-        Q_ASSERT(nowAsString[3].isDigit());
-        Q_ASSERT(nowAsString[4] == '-');
-        Q_ASSERT(nowAsString[5].isDigit());
-        Q_ASSERT(nowAsString[6].isDigit());
-        Q_ASSERT(nowAsString[7] == '-');
-        Q_ASSERT(nowAsString[8].isDigit());
-        Q_ASSERT(nowAsString[9].isDigit());
-        Q_ASSERT(nowAsString[10] == 'T');
-        Q_ASSERT(nowAsString[11].isDigit());
-        Q_ASSERT(nowAsString[12].isDigit());
-        Q_ASSERT(nowAsString[13] == ':');
-        Q_ASSERT(nowAsString[14].isDigit());
-        Q_ASSERT(nowAsString[15].isDigit());
-        Q_ASSERT(nowAsString[16] == ':');
-        Q_ASSERT(nowAsString[17].isDigit());
-        Q_ASSERT(nowAsString[18].isDigit());
-        Q_ASSERT(nowAsString[19] == '.');
-        Q_ASSERT(nowAsString[20].isDigit());
-        Q_ASSERT(nowAsString[21].isDigit());
-        Q_ASSERT(nowAsString[22].isDigit());
-        //  Store
-        _content[0] = static_cast<uint8_t>(nowAsString[0].toLatin1());
-        _content[1] = static_cast<uint8_t>(nowAsString[1].toLatin1());
-        _content[2] = static_cast<uint8_t>(nowAsString[2].toLatin1());
-        _content[3] = static_cast<uint8_t>(nowAsString[3].toLatin1());
-        _content[4] = static_cast<uint8_t>(nowAsString[5].toLatin1());
-        _content[5] = static_cast<uint8_t>(nowAsString[6].toLatin1());
-        _content[6] = static_cast<uint8_t>(nowAsString[8].toLatin1());
-        _content[7] = static_cast<uint8_t>(nowAsString[9].toLatin1());
-        _content[8] = static_cast<uint8_t>(nowAsString[11].toLatin1());
-        _content[9] = static_cast<uint8_t>(nowAsString[12].toLatin1());
-        _content[10] = static_cast<uint8_t>(nowAsString[14].toLatin1());
-        _content[11] = static_cast<uint8_t>(nowAsString[15].toLatin1());
-        _content[12] = static_cast<uint8_t>(nowAsString[17].toLatin1());
-        _content[13] = static_cast<uint8_t>(nowAsString[18].toLatin1());
-        _content[14] = static_cast<uint8_t>(nowAsString[20].toLatin1());
-        _content[15] = static_cast<uint8_t>(nowAsString[21].toLatin1());
-        _contentNeedsSaving = true;
-    }
-    if (_clockTicksUntilTimeUpdate > 0)
-    {
-        _clockTicksUntilTimeUpdate--;
-    }
-
-    //  Busy ?
-    if (_clockTicksToDelay > 0)
-    {
-        Q_ASSERT(_operationalState != _OperationalState::_Ready);
-        if (--_clockTicksToDelay == 0)
-        {   //  End of delay
-            _operationalState = _OperationalState::_Ready;
-        }
-    }
+    //  End of delay
+    _clockTicksToDelay = 0;
+    _operationalState = _OperationalState::_Ready;
 }
 
 //////////
@@ -329,6 +291,47 @@ IoPortList Cmos1::ioPorts()
     return _ioPorts;
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void Cmos1::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_runtimeStateGuard);
+
+    writer.writeBytes(_content, sizeof(_content));
+    writer << static_cast<uint8_t>(_operationalState.load())
+           << _clockTicksToDelay.load()
+           << _currentAddress.load()
+           << _clockTicksUntilTimeUpdate.load();
+}
+
+void Cmos1::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_runtimeStateGuard);
+
+    uint8_t operationalState = 0, currentAddress = 0;
+    unsigned clockTicksToDelay = 0, clockTicksUntilTimeUpdate = 0;
+    reader.readBytes(_content, sizeof(_content));
+    reader >> operationalState
+           >> clockTicksToDelay
+           >> currentAddress
+           >> clockTicksUntilTimeUpdate;
+    if (operationalState > static_cast<uint8_t>(_OperationalState::_ReadingData))
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " state is invalid");
+    }
+    _operationalState = static_cast<_OperationalState>(operationalState);
+    _clockTicksToDelay = clockTicksToDelay;
+    _currentAddress = currentAddress;
+    _clockTicksUntilTimeUpdate = clockTicksUntilTimeUpdate;
+    _contentNeedsSaving = true;  //  ...the restored content is now current
+}
+
 //////////
 //  Operations (component configuration)
 void Cmos1::setReadDelay(const hadesvm::core::TimeInterval & readDelay)
@@ -395,6 +398,75 @@ void Cmos1::setContentFilePath(const QString & contentFilePath)
     _contentFilePath = contentFilePath;
 }
 
+//////////
+//  Implementation helpers
+void Cmos1::_delay(unsigned clockTicks)
+{
+    _clockTicksToDelay = clockTicks;
+    if (clockTicks > 0)
+    {
+        virtualAppliance()->clockScheduler()->scheduleWakeUp(this, clockTicks);
+    }
+}
+
+void Cmos1::_updateCalendarTime()
+{
+    uint64_t virtualTime = virtualAppliance()->clockScheduler()->now();
+    if (virtualTime < _nextTimeUpdate)
+    {   //  Still up to date
+        return;
+    }
+    _nextTimeUpdate = virtualTime + hadesvm::core::ClockScheduler::clockTicksToNs(_clockFrequency, _clockTicksBetweenTimeUpdates);
+
+    //  Update calendar time in bytes 0..15 of the content
+    QDateTime now = _calendarTimeBase.addMSecs(static_cast<qint64>(virtualTime / 1000000));
+    QString nowAsString = now.toString(Qt::DateFormat::ISODateWithMs);
+    //  qDebug() << nowAsString;
+    //  yyyy-MM-ddTHH:mm:ss.zzz
+    Q_ASSERT(nowAsString.length() >= 23);
+    Q_ASSERT(nowAsString[0].isDigit());
+    Q_ASSERT(nowAsString[1].isDigit());
+    Q_ASSERT(nowAsString[2].isDigit());
+    Q_ASSERT(nowAsString[3].isDigit());
+    Q_ASSERT(nowAsString[4] == '-');
+    Q_ASSERT(nowAsString[5].isDigit());
+    Q_ASSERT(nowAsString[6].isDigit());
+    Q_ASSERT(nowAsString[7] == '-');
+    Q_ASSERT(nowAsString[8].isDigit());
+    Q_ASSERT(nowAsString[9].isDigit());
+    Q_ASSERT(nowAsString[10] == 'T');
+    Q_ASSERT(nowAsString[11].isDigit());
+    Q_ASSERT(nowAsString[12].isDigit());
+    Q_ASSERT(nowAsString[13] == ':');
+    Q_ASSERT(nowAsString[14].isDigit());
+    Q_ASSERT(nowAsString[15].isDigit());
+    Q_ASSERT(nowAsString[16] == ':');
+    Q_ASSERT(nowAsString[17].isDigit());
+    Q_ASSERT(nowAsString[18].isDigit());
+    Q_ASSERT(nowAsString[19] == '.');
+    Q_ASSERT(nowAsString[20].isDigit());
+    Q_ASSERT(nowAsString[21].isDigit());
+    Q_ASSERT(nowAsString[22].isDigit());
+    //  Store
+    _content[0] = static_cast<uint8_t>(nowAsString[0].toLatin1());
+    _content[1] = static_cast<uint8_t>(nowAsString[1].toLatin1());
+    _content[2] = static_cast<uint8_t>(nowAsString[2].toLatin1());
+    _content[3] = static_cast<uint8_t>(nowAsString[3].toLatin1());
+    _content[4] = static_cast<uint8_t>(nowAsString[5].toLatin1());
+    _content[5] = static_cast<uint8_t>(nowAsString[6].toLatin1());
+    _content[6] = static_cast<uint8_t>(nowAsString[8].toLatin1());
+    _content[7] = static_cast<uint8_t>(nowAsString[9].toLatin1());
+    _content[8] = static_cast<uint8_t>(nowAsString[11].toLatin1());
+    _content[9] = static_cast<uint8_t>(nowAsString[12].toLatin1());
+    _content[10] = static_cast<uint8_t>(nowAsString[14].toLatin1());
+    _content[11] = static_cast<uint8_t>(nowAsString[15].toLatin1());
+    _content[12] = static_cast<uint8_t>(nowAsString[17].toLatin1());
+    _content[13] = static_cast<uint8_t>(nowAsString[18].toLatin1());
+    _content[14] = static_cast<uint8_t>(nowAsString[20].toLatin1());
+    _content[15] = static_cast<uint8_t>(nowAsString[21].toLatin1());
+    _contentNeedsSaving = true;
+}
+
 //////////
 //  Cmos1::_StatePort
 uint8_t Cmos1::_StatePort::readByte() throws(IoError)
@@ -424,13 +496,13 @@ uint8_t Cmos1::_AddressPort::readByte() throws(IoError)
         return 0;
     }
 
-    //  Simulate read delay
-    //  Note that we're reading from the controller's register, not from EPROM
-    _cmos1->_clockTicksToDelay = 1;
-
-    //  Perform read
+    //  Perform read...
     uint8_t result = _cmos1->_currentAddress;
     _cmos1->_operationalState = _OperationalState::_ReadingAddress;
+
+    //  ...and simulate read delay.
+    //  Note that we're reading from the controller's register, not from EPROM
+    _cmos1->_delay(1);
     return result;
 }
 
@@ -443,13 +515,13 @@ void Cmos1::_AddressPort::writeByte(uint8_t value) throws(IoError)
         return;
     }
 
-    //  Simulate write delay.
-    //  Note that we're writing to the controller's register, not to EPROM
-    _cmos1->_clockTicksToDelay = 1;
-
-    //  Perform write
+    //  Perform write...
     _cmos1->_currentAddress = value;
     _cmos1->_operationalState = _OperationalState::_WritingAddress;
+
+    //  ...and simulate write delay.
+    //  Note that we're writing to the controller's register, not to EPROM
+    _cmos1->_delay(1);
 }
 
 //////////
@@ -463,14 +535,19 @@ uint8_t Cmos1::_DataPort::readByte() throws(IoError)
         return 0;
     }
 
-    //  Simulate read delay
-    _cmos1->_clockTicksToDelay =
+    //  Perform read...
+    if (_cmos1->_currentAddress < 16)
+    {   //  Calendar time is kept up to date on demand
+        _cmos1->_updateCalendarTime();
+    }
+    uint8_t result = _cmos1->_content[_cmos1->_currentAddress];
+
+    //  ...and simulate read delay
+    unsigned clockTicksToDelay =
         static_cast<unsigned>(
             _cmos1->_readDelay.toNs() * _cmos1->_clockFrequency.toHz() / 1000000000);
-
-    //  Perform read
-    uint8_t result = _cmos1->_content[_cmos1->_currentAddress];
-    _cmos1->_operationalState = (_cmos1->_clockTicksToDelay > 0) ? _OperationalState::_ReadingData : _OperationalState::_Ready;
+    _cmos1->_operationalState = (clockTicksToDelay > 0) ? _OperationalState::_ReadingData : _OperationalState::_Ready;
+    _cmos1->_delay(clockTicksToDelay);
     return result;
 }
 
@@ -483,14 +560,15 @@ void Cmos1::_DataPort::writeByte(uint8_t value) throws(IoError)
         return;
     }
 
-    //  Simulate write delay.
-    _cmos1->_clockTicksToDelay =
+    //  Perform write...
+    _cmos1->_content[_cmos1->_currentAddress] = value;
+
+    //  ...and simulate write delay
+    unsigned clockTicksToDelay =
         static_cast<unsigned>(
             _cmos1->_writeDelay.toNs() * _cmos1->_clockFrequency.toHz() / 1000000000);
-
-    //  Perform write
-    _cmos1->_content[_cmos1->_currentAddress] = value;
-    _cmos1->_operationalState = (_cmos1->_clockTicksToDelay > 0) ? _OperationalState::_WritingData : _OperationalState::_Ready;
+    _cmos1->_operationalState = (clockTicksToDelay > 0) ? _OperationalState::_WritingData : _OperationalState::_Ready;
+    _cmos1->_delay(clockTicksToDelay);
 }
 
 //////////
@@ -12,8 +12,9 @@ namespace hadesvm
         //////////
         //  The Cereon CMOS1 nonvolatile memory controller
         class HADESVM_CEREON_PUBLIC Cmos1 : public hadesvm::core::Component,
-                                            public virtual hadesvm::core::IClockedComponent,
-                                            public virtual IIoController
+                                            public virtual hadesvm::core::IScheduledComponent,
+                                            public virtual IIoController,
+                                            public virtual hadesvm::core::ISnapshotComponent
 
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Cmos1)
@@ -87,13 +88,25 @@ namespace hadesvm
         public:
             virtual hadesvm::core::ClockFrequency
                                 clockFrequency() const noexcept override { return _clockFrequency; }
-            virtual void        onClockTick() noexcept override;
+            virtual void        onClockTick() noexcept override {}
+
+            //////////
+            //  hadesvm::core::IScheduledComponent
+        public:
+            virtual void        onWakeUp() noexcept override;
+            virtual void        onEvent() noexcept override {}
 
             //////////
             //  IIoController
         public:
             virtual IoPortList  ioPorts() override;
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+        public:
+            virtual void        saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void        restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
             //////////
             //  Operations (configuration)
         public:
@@ -137,7 +150,15 @@ namespace hadesvm
             IoPortList          _ioPorts;   //  fixed at runtime
             char                _content[256];
             std::atomic<bool>   _contentNeedsSaving;
+            //  The calendar time in bytes 0..15 of the content is brought up
+            //  to date when read, at most once per _clockTicksBetweenTimeUpdates.
+            //  While running, the next update is due at _nextTimeUpdate
+            //  virtual time; otherwise in _clockTicksUntilTimeUpdate
             std::atomic<unsigned>   _clockTicksUntilTimeUpdate;
+            uint64_t            _nextTimeUpdate = 0;
+            //  The calendar time follows the VA's virtual time, which
+            //  started at this calendar time
+            QDateTime           _calendarTimeBase;
 
             enum class _OperationalState
             {
@@ -148,10 +169,16 @@ namespace hadesvm
                 _ReadingData
             };
             std::atomic<_OperationalState>  _operationalState = _OperationalState::_Ready;
+            //  While running, the end of a delay is a wake-up scheduled
+            //  with the VA's ClockScheduler
             std::atomic<unsigned>   _clockTicksToDelay = 0;
 
             std::atomic<uint8_t>    _currentAddress = 0;
 
+            //  Helpers
+            void                _delay(unsigned clockTicks);
+            void                _updateCalendarTime();
+
             //////////
             //  I/O ports
         private:
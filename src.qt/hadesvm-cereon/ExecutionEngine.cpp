@@ -0,0 +1,55 @@
+//
+//  hadesvm-cereon/ExecutionEngine.cpp
+//
+//  The hadesvm::cereon::ExecutionEngine enum implementation
+//
+//////////
+#include "hadesvm-cereon/API.hpp"
+using namespace hadesvm::cereon;
+
+namespace
+{
+    struct ExecutionEngineInfo
+    {
+        ExecutionEngine executionEngine;
+        const char *    name;
+    };
+
+    const ExecutionEngineInfo executionEngineInfos[] =
+    {
+        { ExecutionEngine::Reference, "Reference" },
+        { ExecutionEngine::Threaded, "Threaded" },
+        { ExecutionEngine::Translated, "Translated" },
+    };
+}
+
+//////////
+//  Formatting and parsing
+HADESVM_CEREON_PUBLIC QString hadesvm::util::toString(ExecutionEngine value)
+{
+    for (size_t i = 0; i < sizeof(executionEngineInfos) / sizeof(executionEngineInfos[0]); i++)
+    {
+        if (executionEngineInfos[i].executionEngine == value)
+        {
+            return executionEngineInfos[i].name;
+        }
+    }
+    return "Reference";
+}
+
+template <>
+bool hadesvm::util::fromString<ExecutionEngine>(const QString & s, qsizetype & scan, ExecutionEngine & value)
+{
+    for (size_t i = 0; i < sizeof(executionEngineInfos) / sizeof(executionEngineInfos[0]); i++)
+    {
+        if (s.mid(scan).startsWith(executionEngineInfos[i].name))
+        {
+            value = executionEngineInfos[i].executionEngine;
+            scan += strlen(executionEngineInfos[i].name);
+            return true;
+        }
+    }
+    return false;
+}
+
+//  End of hadesvm-cereon/ExecutionEngine.cpp
@@ -11,7 +11,8 @@ namespace hadesvm
     {
         //////////
         //  The "FDC1 floppy drive" device
-        class HADESVM_CEREON_PUBLIC Fdc1FloppyDrive : public hadesvm::core::Component
+        class HADESVM_CEREON_PUBLIC Fdc1FloppyDrive : public hadesvm::core::Component,
+                                                      public virtual hadesvm::core::ISnapshotComponent
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Fdc1FloppyDrive)
 
@@ -226,6 +227,12 @@ namespace hadesvm
             virtual void        disconnect() noexcept override;
             virtual void        reset() noexcept override;
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+        public:
+            virtual void        saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void        restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
             //////////
             //  Operations (configuration)
         public:
@@ -313,6 +320,10 @@ namespace hadesvm
             std::atomic<unsigned>       _currentCylinder = 0;   //  0..79 or _CurrentCylinderParked
             static const unsigned       _CurrentCylinderParked = 0xFF;
 
+            //  Un-mounting the image on stop() stops the motor - this is
+            //  whether it was spinning before, for start() to spin it up again
+            bool                _motorSpinningWhenStopped = false;
+
             //  Currently "mounted" floppy image - these fields are assigned-to on
             //  UI thread (in response to user commands), but also queried on
             //  worker thread (which performs actual I/O).
@@ -614,8 +625,9 @@ namespace hadesvm
         //////////
         //  The FDC1 floppy drive controller
         class HADESVM_CEREON_PUBLIC Fdc1Controller : public hadesvm::core::Component,
-                                                     public virtual hadesvm::core::IClockedComponent,
-                                                     public virtual IIoController
+                                                     public virtual hadesvm::core::IScheduledComponent,
+                                                     public virtual IIoController,
+                                                     public virtual hadesvm::core::ISnapshotComponent
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Fdc1Controller)
 
@@ -704,13 +716,25 @@ namespace hadesvm
         public:
             virtual hadesvm::core::ClockFrequency
                                 clockFrequency() const noexcept override { return _clockFrequency; }
-            virtual void        onClockTick() noexcept override;
+            virtual void        onClockTick() noexcept override {}
+
+            //////////
+            //  hadesvm::core::IScheduledComponent
+        public:
+            virtual void        onWakeUp() noexcept override {}
+            virtual void        onEvent() noexcept override;
 
             //////////
             //  IIoController
         public:
             virtual IoPortList  ioPorts() override;
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+        public:
+            virtual void        saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void        restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
             //////////
             //  Operations (configuration)
         public:
@@ -967,7 +991,7 @@ namespace hadesvm
             //////////
             //  Async results - a completion handler called when a FDD finishes an async
             //  operation created an "async result", which is then enqueued for processing
-            //  on the next clock tick
+            //  by onEvent()
         private:
             class _AsyncResult
             {   //  A generic "async result"
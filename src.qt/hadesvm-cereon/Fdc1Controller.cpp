@@ -152,6 +152,14 @@ void Fdc1Controller::start() throws(hadesvm::core::VirtualApplianceException)
         return;
     }
 
+    //  Interrupt conditions and command results that are still to be
+    //  handled must not wait for the next event
+    QMutexLocker lock(&_runtimeStateGuard);
+    if (_pendingInterruptConditions != 0 || _asyncResult != nullptr)
+    {
+        virtualAppliance()->clockScheduler()->postEvent(this);
+    }
+
     _state = State::Running;
 }
 
@@ -206,8 +214,8 @@ void Fdc1Controller::reset() noexcept
 }
 
 //////////
-//  hadesvm::core::IClockedComponent
-void Fdc1Controller::onClockTick() noexcept
+//  hadesvm::core::IScheduledComponent
+void Fdc1Controller::onEvent() noexcept
 {
     QMutexLocker lock(&_runtimeStateGuard);
 
@@ -276,6 +284,60 @@ IoPortList Fdc1Controller::ioPorts()
     return _ioPorts;
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void Fdc1Controller::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_runtimeStateGuard);
+
+    if (_operationalState == _OperationalState::_ExecutingCommand)
+    {   //  The command is being executed by a floppy drive - can't save that
+        throw hadesvm::core::VirtualApplianceException(displayName() + " is busy");
+    }
+    writer << _interruptMask
+           << _currentDeviceIndex
+           << static_cast<uint8_t>(_operationalState.load())
+           << _numCommandBytes;
+    writer.writeBytes(_commandBytes, _numCommandBytes);
+    writer << _numResultBytes
+           << _nextResultByte;
+    writer.writeBytes(_resultBytes, _numResultBytes);
+    writer << _pendingInterruptConditions;
+}
+
+void Fdc1Controller::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_runtimeStateGuard);
+
+    uint8_t operationalState = 0;
+    reader >> _interruptMask
+           >> _currentDeviceIndex
+           >> operationalState
+           >> _numCommandBytes;
+    if (_currentDeviceIndex >= 4 ||
+        operationalState > static_cast<uint8_t>(_OperationalState::_Result) ||
+        _numCommandBytes > sizeof(_commandBytes))
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " state is invalid");
+    }
+    reader.readBytes(_commandBytes, _numCommandBytes);
+    reader >> _numResultBytes
+           >> _nextResultByte;
+    if (_numResultBytes > sizeof(_resultBytes) || _nextResultByte > _numResultBytes)
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " state is invalid");
+    }
+    reader.readBytes(_resultBytes, _numResultBytes);
+    reader >> _pendingInterruptConditions;
+    _operationalState = static_cast<_OperationalState>(operationalState);
+}
+
 //////////
 //  Operations (configuration)
 void Fdc1Controller::setStateAndControlPortAddress(uint16_t stateAndControlPortAddress)
@@ -399,6 +461,7 @@ void Fdc1Controller::_raiseBusyOffInterrupt()
     if ((_interruptMask & 0x01) != 0)
     {   //  The BUSY_OFF interrupt is enabled
         _pendingInterruptConditions |= 0x01;
+        virtualAppliance()->clockScheduler()->postEvent(this);
     }
 }
 
@@ -407,6 +470,7 @@ void Fdc1Controller::_raiseInputReadyOnInterrupt()
     if ((_interruptMask & 0x02) != 0)
     {   //  The INPUT_READY_ON interrupt is enabled
         _pendingInterruptConditions |= 0x02;
+        virtualAppliance()->clockScheduler()->postEvent(this);
     }
 }
 
@@ -415,6 +479,7 @@ void Fdc1Controller::_raiseOutputReadyOnInterrupt()
     if ((_interruptMask & 0x04) != 0)
     {   //  The OUTPUT_READY_ON interrupt is enabled
         _pendingInterruptConditions |= 0x04;
+        virtualAppliance()->clockScheduler()->postEvent(this);
     }
 }
 
@@ -775,6 +840,7 @@ void Fdc1Controller::_GetDriveStatusCompletionHandler::onOperationCompleted(
     uint8_t statusByte1)
 {
     _fdc1Controller->_asyncResult = new _GetDriveStatusAsyncResult(commandStatusByte, statusByte1);
+    _fdc1Controller->virtualAppliance()->clockScheduler()->postEvent(_fdc1Controller);
 }
 
 //////////
@@ -784,6 +850,7 @@ void Fdc1Controller::_ReadCompletionHandler::onOperationCompleted(
     const uint8_t * dataBytes, unsigned numDataBytes)
 {
     _fdc1Controller->_asyncResult = new _ReadAsyncResult(commandStatusByte, dataBytes, numDataBytes);
+    _fdc1Controller->virtualAppliance()->clockScheduler()->postEvent(_fdc1Controller);
 }
 
 //////////
@@ -792,6 +859,7 @@ void Fdc1Controller::_WriteCompletionHandler::onOperationCompleted(
     Fdc1FloppyDrive * /*floppyDrive*/, uint8_t commandStatusByte)
 {
     _fdc1Controller->_asyncResult = new _WriteAsyncResult(commandStatusByte);
+    _fdc1Controller->virtualAppliance()->clockScheduler()->postEvent(_fdc1Controller);
 }
 
 //////////
@@ -800,6 +868,7 @@ void Fdc1Controller::_SeekCompletionHandler::onOperationCompleted(
     Fdc1FloppyDrive * /*floppyDrive*/, uint8_t commandStatusByte)
 {
     _fdc1Controller->_asyncResult = new _SeekAsyncResult(commandStatusByte);
+    _fdc1Controller->virtualAppliance()->clockScheduler()->postEvent(_fdc1Controller);
 }
 
 //  End of hadesvm-cereon/Fdc1Controller.cpp
@@ -109,6 +109,8 @@ void Fdc1FloppyDrive::initialize() throws(hadesvm::core::VirtualApplianceExcepti
         return;
     }
 
+    _motorSpinningWhenStopped = false;
+
     _state = State::Initialized;
 }
 
@@ -128,8 +130,14 @@ void Fdc1FloppyDrive::start() throws(hadesvm::core::VirtualApplianceException)
         if (_mountImage(_diskImagePath))
         {
             _operationalState = _OperationalState::_IdleMounted;
+            if (_motorSpinningWhenStopped)
+            {   //  Pick up where stop() (or a snapshot) left off
+                _operationalState = _OperationalState::_IdleSpinning;
+                _motorStatus = MotorStatus::Spinning;
+            }
         }
     }
+    _motorSpinningWhenStopped = false;
 
     //  Start worker thread
     _workerThread = new _WorkerThread(this);
@@ -162,6 +170,7 @@ void Fdc1FloppyDrive::stop() noexcept
     }
 
     //  If an image is mounted, un-mount it (but keep the "_diskImagePath"!)
+    _motorSpinningWhenStopped = (_motorStatus == MotorStatus::Spinning);
     if (_mountedFloppyImage != nullptr)
     {
         _unmountImage();
@@ -206,6 +215,32 @@ void Fdc1FloppyDrive::reset() noexcept
     //  TODO what?
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void Fdc1FloppyDrive::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    writer << _currentCylinder.load()
+           << _motorSpinningWhenStopped;
+}
+
+void Fdc1FloppyDrive::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    unsigned currentCylinder = 0;
+    reader >> currentCylinder
+           >> _motorSpinningWhenStopped;
+    if (currentCylinder >= 80 && currentCylinder != _CurrentCylinderParked)
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " state is invalid");
+    }
+    _currentCylinder = currentCylinder;
+}
+
 //////////
 //  Operations (configuration)
 void Fdc1FloppyDrive::setChannel(unsigned channel)
@@ -186,7 +186,8 @@ namespace hadesvm
         //  I/O bus methods are only safe to call from the master clock thread
         class HADESVM_CEREON_PUBLIC IoBus : public hadesvm::core::Component,
                                             public virtual hadesvm::core::IClockedComponent,
-                                            public virtual hadesvm::core::IActiveComponent
+                                            public virtual hadesvm::core::IActiveComponent,
+                                            public virtual hadesvm::core::ISnapshotComponent
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(IoBus)
 
@@ -266,6 +267,13 @@ namespace hadesvm
             //  the MemoryBus on its own common worker thread, but do not create
             //  an actual bus-only worker thread
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+            //  The interrupt state of all attached I/O ports is saved here
+        public:
+            virtual void        saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void        restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
             //////////
             //  Operations (configuration)
         public:
@@ -205,6 +205,80 @@ void IoBus::reset() noexcept
     //  Nothing to do here
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void IoBus::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    //  Interrupt state of each attached I/O port...
+    uint32_t numIoPorts = 0;
+    for (unsigned address = 0; address < 65536; address++)
+    {
+        numIoPorts += (_ioPorts[address] != nullptr) ? 1 : 0;
+    }
+    writer << numIoPorts;
+    for (unsigned address = 0; address < 65536; address++)
+    {
+        if (IIoPort * ioPort = _ioPorts[address])
+        {
+            writer << static_cast<uint16_t>(address)
+                   << ioPort->_interruptsEnabled
+                   << (ioPort->_pendingIoInterrupt != nullptr)
+                   << ((ioPort->_pendingIoInterrupt != nullptr) ? ioPort->_pendingIoInterrupt->interruptStatusCode() : uint16_t(0));
+        }
+    }
+
+    //  ...and the order in which pending interrupts are to be handled
+    writer << static_cast<uint32_t>(_interruptsReadyToHandle.size());
+    for (IoInterrupt * ioInterrupt : _interruptsReadyToHandle)
+    {
+        writer << ioInterrupt->ioPortNumber();
+    }
+}
+
+void IoBus::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    uint32_t numIoPorts = 0;
+    reader >> numIoPorts;
+    for (uint32_t i = 0; i < numIoPorts && reader.isGood(); i++)
+    {
+        uint16_t address = 0, interruptStatusCode = 0;
+        bool interruptsEnabled = false, interruptPending = false;
+        reader >> address >> interruptsEnabled >> interruptPending >> interruptStatusCode;
+        IIoPort * ioPort = _ioPorts[address];
+        if (ioPort == nullptr)
+        {
+            throw hadesvm::core::VirtualApplianceException("I/O port " + hadesvm::util::toString(address, "%04X") + " is missing");
+        }
+        delete ioPort->releasePendingIoInterrupt();   //  "delete nullptr" is safe
+        ioPort->_interruptsEnabled = interruptsEnabled;
+        if (interruptPending)
+        {
+            ioPort->setPendingIoInterrupt(interruptStatusCode);
+        }
+    }
+
+    _interruptsReadyToHandle.clear();
+    uint32_t numInterruptsReadyToHandle = 0;
+    reader >> numInterruptsReadyToHandle;
+    for (uint32_t i = 0; i < numInterruptsReadyToHandle && reader.isGood(); i++)
+    {
+        uint16_t address = 0;
+        reader >> address;
+        IIoPort * ioPort = _ioPorts[address];
+        if (ioPort == nullptr || ioPort->_pendingIoInterrupt == nullptr || !ioPort->_interruptsEnabled)
+        {
+            throw hadesvm::core::VirtualApplianceException("Pending I/O interrupts are inconsistent");
+        }
+        _interruptsReadyToHandle.enqueue(ioPort->_pendingIoInterrupt);
+    }
+}
+
 //////////
 //  Operations (configuration)
 void IoBus::setClockFrequency(const hadesvm::core::ClockFrequency & clockFrequency)
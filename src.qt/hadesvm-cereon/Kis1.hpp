@@ -116,8 +116,9 @@ namespace hadesvm
         //////////
         //  The Cereon KIS1 keyboard controller
         class HADESVM_CEREON_PUBLIC Kis1Controller : public hadesvm::core::Component,
-                                                     public virtual hadesvm::core::IClockedComponent,
-                                                     public virtual IIoController
+                                                     public virtual hadesvm::core::IScheduledComponent,
+                                                     public virtual IIoController,
+                                                     public virtual hadesvm::core::ISnapshotComponent
 
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Kis1Controller)
@@ -192,13 +193,25 @@ namespace hadesvm
         public:
             virtual hadesvm::core::ClockFrequency
                                 clockFrequency() const noexcept override { return _clockFrequency; }
-            virtual void        onClockTick() noexcept override;
+            virtual void        onClockTick() noexcept override {}
+
+            //////////
+            //  hadesvm::core::IScheduledComponent
+        public:
+            virtual void        onWakeUp() noexcept override;
+            virtual void        onEvent() noexcept override;
 
             //////////
             //  IIoController
         public:
             virtual IoPortList  ioPorts() override;
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+        public:
+            virtual void        saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void        restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
             //////////
             //  Operations (configuration)
         public:
@@ -277,6 +290,8 @@ namespace hadesvm
             //  Helpers
             void                _raiseBusyOffInterrupt();
             void                _raiseInputReadyOnInterrupt();
+            void                _checkForInput();
+            void                _delay(unsigned clockTicks);
             void                _synchronizeInterruptState();
 
             //////////
@@ -482,7 +497,8 @@ namespace hadesvm
 
         //////////
         //  The Cereon KIS1 keyboard
-        class HADESVM_CEREON_PUBLIC Kis1Keyboard : public hadesvm::core::Component
+        class HADESVM_CEREON_PUBLIC Kis1Keyboard : public hadesvm::core::Component,
+                                                   public virtual hadesvm::core::ISnapshotComponent
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Kis1Keyboard)
 
@@ -544,6 +560,13 @@ namespace hadesvm
             virtual void        disconnect() noexcept override;
             virtual void        reset() noexcept override;
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+            //  Keyboard input not yet read by the guest is a part of a snapshot
+        public:
+            virtual void        saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void        restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
             //////////
             //  Operations (configuration)
         public:
@@ -576,6 +599,9 @@ namespace hadesvm
             uint8_t             _controllerCompartmentNumber;
             Kis1KeyboardLayout *_layout;    //  never nullptr
 
+            //  Connections
+            Kis1Controller *    _controller = nullptr;  //  set up by connect()
+
             //  Keyboard registers
             bool                _numLockOn = false;     //  bit 0x02 of DEVICE_STATE
             bool                _capsLockOn = false;    //  bit 0x04 of DEVICE_STATE
@@ -584,6 +610,9 @@ namespace hadesvm
             //  Incoming data
             QQueue<uint8_t>     _readyInputQueue;       //  written to on EDT read from on master clock thread
             mutable hadesvm::util::Spinlock _readyInputQueueGuard;  //  spinlock (for performance)
+
+            //  Helpers
+            void                _notifyController();
         };
     }
 }
@@ -210,6 +210,23 @@ void Kis1Controller::start() throws(hadesvm::core::VirtualApplianceException)
         return;
     }
 
+    //  A register write in progress ends in virtual time; otherwise
+    //  the keyboards may have input waiting
+    QMutexLocker lock(&_runtimeStateGuard);
+    switch (_operationalState)
+    {
+        case _OperationalState::_ChangingCurrentDevice:
+        case _OperationalState::_ChangingInterruptMask:
+        case _OperationalState::_ChangingDeviceState:
+            virtualAppliance()->clockScheduler()->scheduleWakeUp(this, _timeout);
+            break;
+        case _OperationalState::_Ready:
+        case _OperationalState::_InputReady:
+        default:
+            virtualAppliance()->clockScheduler()->postEvent(this);
+            break;
+    }
+
     _state = State::Running;
 }
 
@@ -222,6 +239,11 @@ void Kis1Controller::stop() noexcept
         return;
     }
 
+    //  Remember how long a register write in progress still has to go
+    QMutexLocker lock(&_runtimeStateGuard);
+    _timeout = static_cast<unsigned>(
+        qMin(virtualAppliance()->clockScheduler()->cancelWakeUp(this), static_cast<uint64_t>(UINT_MAX)));
+
     _state = State::Initialized;
 }
 
@@ -277,8 +299,8 @@ void Kis1Controller::reset() noexcept
 }
 
 //////////
-//  hadesvm::core::IClockedComponent
-void Kis1Controller::onClockTick() noexcept
+//  hadesvm::core::IScheduledComponent
+void Kis1Controller::onWakeUp() noexcept
 {
     QMutexLocker lock(&_runtimeStateGuard);
 
@@ -287,32 +309,37 @@ void Kis1Controller::onClockTick() noexcept
         case _OperationalState::_ChangingCurrentDevice:
         case _OperationalState::_ChangingInterruptMask:
         case _OperationalState::_ChangingDeviceState:
-            if (_timeout > 0)
-            {   //  Still busy
-                _timeout--;
-                return;
-            }
             //  Finished the "write to controller register" operation
+            _timeout = 0;
             _raiseBusyOffInterrupt();
             _operationalState = _OperationalState::_Ready;
-            [[fallthrough]];    //  may need  to become InputReady if input is available
+            _checkForInput();   //  may need  to become InputReady if input is available
+            return;
 
         case _OperationalState::_Ready:
-            //  Is there available input in any keyboard ?
-            for (Kis1Keyboard * keyboard : _keyboards)
-            {
-                if (keyboard->isInputReady())
-                {   //  Yes!
-                    _operationalState = _OperationalState::_InputReady;
-                    _inputSource = keyboard->controllerCompartmentNumber();
-                    _raiseInputReadyOnInterrupt();
-                    break;
-                }
-            }
+        case _OperationalState::_InputReady:
+            return; //  nothing to do
+
+        default:
+            failure();
+    }
+}
+
+void Kis1Controller::onEvent() noexcept
+{
+    QMutexLocker lock(&_runtimeStateGuard);
+
+    switch (_operationalState)
+    {
+        case _OperationalState::_Ready:
+            _checkForInput();
             return;
 
         case _OperationalState::_InputReady:
-            return; //  nothing to do
+        case _OperationalState::_ChangingCurrentDevice:
+        case _OperationalState::_ChangingInterruptMask:
+        case _OperationalState::_ChangingDeviceState:
+            return; //  input, if any, will be noticed when Ready
 
         default:
             failure();
@@ -326,6 +353,46 @@ IoPortList Kis1Controller::ioPorts()
     return _ioPorts;
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void Kis1Controller::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_runtimeStateGuard);
+
+    writer << static_cast<uint8_t>(_operationalState)
+           << _timeout
+           << _busyOffInterrputPending
+           << _inputReadyOnInterrputPending
+           << _currentDevice
+           << _interruptMask
+           << _inputSource;
+}
+
+void Kis1Controller::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_runtimeStateGuard);
+
+    uint8_t operationalState = 0;
+    reader >> operationalState
+           >> _timeout
+           >> _busyOffInterrputPending
+           >> _inputReadyOnInterrputPending
+           >> _currentDevice
+           >> _interruptMask
+           >> _inputSource;
+    if (operationalState > static_cast<uint8_t>(_OperationalState::_ChangingDeviceState))
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " state is invalid");
+    }
+    _operationalState = static_cast<_OperationalState>(operationalState);
+}
+
 //////////
 //  Operations (configuration)
 void Kis1Controller::setStatePortAddress(uint16_t statePortAddress)
@@ -467,6 +534,29 @@ void Kis1Controller::_raiseInputReadyOnInterrupt()
     }
 }
 
+void Kis1Controller::_checkForInput()
+{
+    Q_ASSERT(_operationalState == _OperationalState::_Ready);
+
+    //  Is there available input in any keyboard ?
+    for (Kis1Keyboard * keyboard : _keyboards)
+    {
+        if (keyboard->isInputReady())
+        {   //  Yes!
+            _operationalState = _OperationalState::_InputReady;
+            _inputSource = keyboard->controllerCompartmentNumber();
+            _raiseInputReadyOnInterrupt();
+            break;
+        }
+    }
+}
+
+void Kis1Controller::_delay(unsigned clockTicks)
+{
+    _timeout = clockTicks;
+    virtualAppliance()->clockScheduler()->scheduleWakeUp(this, clockTicks);
+}
+
 void Kis1Controller::_synchronizeInterruptState()
 {
     //  If an interrupt currently pending is being disabled, drop it
@@ -588,7 +678,7 @@ void Kis1Controller::_CurrentDevicePort::writeByte(uint8_t value) throws(IoError
                 _kis1Controller->_currentDevice = value;
                 //  ...and perform state change with simulated register write delay
                 _kis1Controller->_operationalState = _OperationalState::_ChangingCurrentDevice;
-                _kis1Controller->_timeout = _RegisterWriteDelay;
+                _kis1Controller->_delay(_RegisterWriteDelay);
             }   //  else device does not exist - suppress the write
             break;
         case _OperationalState::_ChangingCurrentDevice:
@@ -636,7 +726,7 @@ void Kis1Controller::_InterruptMaskPort::writeByte(uint8_t value) throws(IoError
             _kis1Controller->_synchronizeInterruptState();
             //  ...and perform state change with simulated register write delay
             _kis1Controller->_operationalState = _OperationalState::_ChangingInterruptMask;
-            _kis1Controller->_timeout = _RegisterWriteDelay;
+            _kis1Controller->_delay(_RegisterWriteDelay);
             break;
         case _OperationalState::_ChangingCurrentDevice:
         case _OperationalState::_ChangingInterruptMask:
@@ -713,7 +803,7 @@ void Kis1Controller::_DeviceStatePort::writeByte(uint8_t value) throws(IoError)
                 currentKeyboard->writeDeviceState(value);
                 //  ...and perform state change with simulated register write delay
                 _kis1Controller->_operationalState = _OperationalState::_ChangingDeviceState;
-                _kis1Controller->_timeout = _RegisterWriteDelay;
+                _kis1Controller->_delay(_RegisterWriteDelay);
             }   //  else device does not exist - suppress the write
             break;
         case _OperationalState::_ChangingCurrentDevice:
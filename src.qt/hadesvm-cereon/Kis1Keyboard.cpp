@@ -110,6 +110,7 @@ void Kis1Keyboard::connect() throws(hadesvm::core::VirtualApplianceException)
     {
         throw hadesvm::core::VirtualApplianceException("TODO proper error message");
     }
+    _controller = kis1Controllers[0];
 
     _state = State::Connected;
 }
@@ -171,6 +172,8 @@ void Kis1Keyboard::disconnect() noexcept
         return;
     }
 
+    _controller = nullptr;
+
     _state = State::Constructed;
 }
 
@@ -191,6 +194,45 @@ void Kis1Keyboard::reset() noexcept
     _readyInputQueue.clear();
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void Kis1Keyboard::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_readyInputQueueGuard);
+
+    QByteArray readyInput;
+    for (uint8_t b : _readyInputQueue)
+    {
+        readyInput.append(static_cast<char>(b));
+    }
+    writer << _numLockOn
+           << _capsLockOn
+           << _scrollLockOn
+           << readyInput;
+}
+
+void Kis1Keyboard::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_readyInputQueueGuard);
+
+    QByteArray readyInput;
+    reader >> _numLockOn
+           >> _capsLockOn
+           >> _scrollLockOn
+           >> readyInput;
+    _readyInputQueue.clear();
+    for (char b : readyInput)
+    {
+        _readyInputQueue.enqueue(static_cast<uint8_t>(b));
+    }
+}
+
 //////////
 //  Operations (configuration)
 void Kis1Keyboard::setControllerStatePortAddress(uint16_t controllerStatePortAddress)
@@ -276,8 +318,11 @@ void Kis1Keyboard::handleKeyPressed(QKeyEvent * keyEvent)
     Kis1ScanCode scanCode = _layout->translateKey(keyEvent->nativeScanCode(), keyEvent->nativeVirtualKey());
     if (scanCode != Kis1ScanCode::Invalid)
     {
-        QMutexLocker lock(&_readyInputQueueGuard);
-        _readyInputQueue.enqueue(static_cast<uint8_t>(scanCode));
+        {
+            QMutexLocker lock(&_readyInputQueueGuard);
+            _readyInputQueue.enqueue(static_cast<uint8_t>(scanCode));
+        }
+        _notifyController();
     }
 }
 
@@ -286,8 +331,21 @@ void Kis1Keyboard::handleKeyReleased(QKeyEvent * keyEvent)
     Kis1ScanCode scanCode = _layout->translateKey(keyEvent->nativeScanCode(), keyEvent->nativeVirtualKey());
     if (scanCode != Kis1ScanCode::Invalid)
     {
-        QMutexLocker lock(&_readyInputQueueGuard);
-        _readyInputQueue.enqueue(static_cast<uint8_t>(scanCode) | 0x80);
+        {
+            QMutexLocker lock(&_readyInputQueueGuard);
+            _readyInputQueue.enqueue(static_cast<uint8_t>(scanCode) | 0x80);
+        }
+        _notifyController();
+    }
+}
+
+//////////
+//  Implementation helpers
+void Kis1Keyboard::_notifyController()
+{
+    if (_controller != nullptr && _state == State::Running)
+    {   //  Let the controller notice the input without polling for it
+        virtualAppliance()->clockScheduler()->postEvent(_controller);
     }
 }
 
@@ -14,12 +14,15 @@ namespace hadesvm
     namespace cereon
     {
         //////////
-        //  Thrown if a memory access fails
+        //  The outcome of a memory access
         enum class MemoryAccessError
         {
+            None,               //  no error - the access has succeeded
             InvalidAddress,     //  accessing nonexistent memory
             InvalidAlignment,   //  access not naturally aligned
-            AccessDenied,       //  writing to ROM
+            AccessDenied,       //  writing to ROM, or accessing a page in a way its protection disallows
+            PageFault,          //  accessing a logical page that has no physical page mapped to it
+            InvalidPageTable,   //  page table walk failed or found a malformed page table entry
             HardwareFault       //  other error
         };
 
@@ -44,20 +47,30 @@ namespace hadesvm
                                     size() const = 0;
 
             //  Loads a naturally aligned data item from the specified offset
-            //  in this memory block.
-            //  Throws MemoryAccessError if an error occurs
-            virtual uint8_t         loadByte(size_t offset) throws(MemoryAccessError) = 0;
-            virtual uint16_t        loadHalfWord(size_t offset, ByteOrder byteOrder) throws(MemoryAccessError) = 0;
-            virtual uint32_t        loadWord(size_t offset, ByteOrder byteOrder) throws(MemoryAccessError) = 0;
-            virtual uint64_t        loadLongWord(size_t offset, ByteOrder byteOrder) throws(MemoryAccessError) = 0;
+            //  in this memory block into "value".
+            //  Returns MemoryAccessError::None on success, else the error
+            //  (in which case "value" is left unchanged)
+            virtual MemoryAccessError   loadByte(size_t offset, uint8_t & value) = 0;
+            virtual MemoryAccessError   loadHalfWord(size_t offset, ByteOrder byteOrder, uint16_t & value) = 0;
+            virtual MemoryAccessError   loadWord(size_t offset, ByteOrder byteOrder, uint32_t & value) = 0;
+            virtual MemoryAccessError   loadLongWord(size_t offset, ByteOrder byteOrder, uint64_t & value) = 0;
 
             //  Stores a naturally aligned data item into this memory block
             //  at the specified offset.
-            //  Throws MemoryAccessError if an error occurs
-            virtual void            storeByte(size_t offset, uint8_t value) throws(MemoryAccessError) = 0;
-            virtual void            storeHalfWord(size_t offset, uint16_t value, ByteOrder byteOrder) throws(MemoryAccessError) = 0;
-            virtual void            storeWord(size_t offset, uint32_t value, ByteOrder byteOrder) throws(MemoryAccessError) = 0;
-            virtual void            storeLongWord(size_t offset, uint64_t value, ByteOrder byteOrder) throws(MemoryAccessError) = 0;
+            //  Returns MemoryAccessError::None on success, else the error
+            virtual MemoryAccessError   storeByte(size_t offset, uint8_t value) = 0;
+            virtual MemoryAccessError   storeHalfWord(size_t offset, uint16_t value, ByteOrder byteOrder) = 0;
+            virtual MemoryAccessError   storeWord(size_t offset, uint32_t value, ByteOrder byteOrder) = 0;
+            virtual MemoryAccessError   storeLongWord(size_t offset, uint64_t value, ByteOrder byteOrder) = 0;
+
+            //  Returns the host memory that keeps the content of this memory
+            //  block (1st byte at offset 0) if loads (or, if "forStore" is
+            //  true, stores) can bypass loadXXX()/storeXXX() and access it
+            //  directly; else returns nullptr. While the memory block is
+            //  running, the result may go from nullptr to the host memory
+            //  (e.g. once its content is restored from a snapshot), but
+            //  never the other way round.
+            virtual uint8_t *           hostData(bool forStore) = 0;
         };
 
         //////////
@@ -72,6 +85,33 @@ namespace hadesvm
             virtual MemoryBlockList memoryBlocks() const = 0;
         };
 
+        //////////
+        //  An agent that keeps information derived from memory content (e.g.
+        //  a processor core caching predecoded instructions) and must, therefore,
+        //  be told when that content changes
+        class HADESVM_CEREON_PUBLIC IMemorySnooper
+        {
+            //////////
+            //  This is an interface
+        public:
+            virtual ~IMemorySnooper() noexcept = default;
+
+            //////////
+            //  Operations
+        public:
+            //  Called by the MemoryBus after a store into a page that hashes
+            //  to the specified watch slot (see MemoryBus::watchPage()).
+            //  Called on the thread that has performed the store, so the
+            //  implementation must be thread-safe and very fast.
+            virtual void            onWatchedPageModified(size_t watchSlot) = 0;
+
+            //  Called by the MemoryBus after it has mapped host memory that
+            //  has become available while it is running (see publishHostData()),
+            //  so that host memory pointers (or their absence) cached by the
+            //  snooper can be refreshed. May be called on any thread.
+            virtual void            onHostMemoryPublished() = 0;
+        };
+
         //////////
         //  The Cereon memory bus delegates loads/stores to one of the
         //  attached memory blocks
@@ -173,19 +213,32 @@ namespace hadesvm
             //  no effect if not attached
             void                    detachMemoryBlock(IMemoryBlock * memoryBlock);
 
-            //  Loads a naturally aligned data item at the specified address.
-            //  Throws MemoryAccessError
-            uint8_t                 loadByte(uint64_t address) throws(MemoryAccessError);
-            uint16_t                loadHalfWord(uint64_t address, ByteOrder byteOrder) throws(MemoryAccessError);
-            uint32_t                loadWord(uint64_t address, ByteOrder byteOrder) throws(MemoryAccessError);
-            uint64_t                loadLongWord(uint64_t address, ByteOrder byteOrder) throws(MemoryAccessError);
+            //  Loads a naturally aligned data item at the specified address into "value".
+            //  Returns MemoryAccessError::None on success, else the error
+            MemoryAccessError       loadByte(uint64_t address, uint8_t & value);
+            MemoryAccessError       loadHalfWord(uint64_t address, ByteOrder byteOrder, uint16_t & value);
+            MemoryAccessError       loadWord(uint64_t address, ByteOrder byteOrder, uint32_t & value);
+            MemoryAccessError       loadLongWord(uint64_t address, ByteOrder byteOrder, uint64_t & value);
 
             //  Stores a naturally aligned data item at the specified address.
-            //  Throws MemoryAccessError if an error occurs
-            void                    storeByte(uint64_t address, uint8_t value) throws(MemoryAccessError);
-            void                    storeHalfWord(uint64_t address, uint16_t value, ByteOrder byteOrder) throws(MemoryAccessError);
-            void                    storeWord(uint64_t address, uint32_t value, ByteOrder byteOrder) throws(MemoryAccessError);
-            void                    storeLongWord(uint64_t address, uint64_t value, ByteOrder byteOrder) throws(MemoryAccessError);
+            //  Returns MemoryAccessError::None on success, else the error
+            MemoryAccessError       storeByte(uint64_t address, uint8_t value);
+            MemoryAccessError       storeHalfWord(uint64_t address, uint16_t value, ByteOrder byteOrder);
+            MemoryAccessError       storeWord(uint64_t address, uint32_t value, ByteOrder byteOrder);
+            MemoryAccessError       storeLongWord(uint64_t address, uint64_t value, ByteOrder byteOrder);
+
+            //  Returns the host memory that keeps the content of the "size" bytes
+            //  at the specified address if they all belong to the same memory
+            //  block and that block can be loaded from (or, if "forStore" is
+            //  true, stored into) directly; else returns nullptr. Whoever stores
+            //  via the returned pointer must then call notifyStore().
+            uint8_t *               hostMemory(uint64_t address, uint64_t size, bool forStore);
+
+            //  Called by a memory block attached to this memory bus once its
+            //  hostData() no longer returns nullptr (e.g. once its content has
+            //  been restored from a snapshot); maps that host memory into the
+            //  page map if the memory bus is running. Can be called from any thread.
+            void                    publishHostData(IMemoryBlock * memoryBlock);
 
             //////////
             //  Bus locking
@@ -195,6 +248,38 @@ namespace hadesvm
             void                    lock() { _lock.lock(); }
             void                    unlock() { _lock.unlock(); }
 
+            //////////
+            //  Store snooping
+        public:
+            //  Memory is watched in pages of WatchPageSize bytes; pages whose
+            //  numbers differ by a multiple of WatchSlotCount share a "watch slot"
+            static const unsigned   WatchPageShift = 12;
+            static const uint64_t   WatchPageSize = UINT64_C(1) << WatchPageShift;
+            static const size_t     WatchSlotCount = 65536;
+
+            //  Returns the watch slot of the page containing the specified address
+            static size_t           watchSlot(uint64_t address)
+            {
+                return static_cast<size_t>(address >> WatchPageShift) & (WatchSlotCount - 1);
+            }
+
+            //  Registers/unregisters a memory snooper with this memory bus
+            void                    addSnooper(IMemorySnooper * snooper);
+            void                    removeSnooper(IMemorySnooper * snooper);
+
+            //  Arranges for all snoopers to be notified of the next store into the
+            //  page containing the specified address (or into any other page that
+            //  shares its watch slot). The watch is one-shot, a snooper that keeps
+            //  relying on the page content must re-watch it after being notified.
+            void                    watchPage(uint64_t address)
+            {
+                _watchedSlots[watchSlot(address)].store(true, std::memory_order_release);
+            }
+
+            //  Notifies snoopers (if any) of a store made into the host memory
+            //  returned by hostMemory(), bypassing storeXXX()
+            void                    notifyStore(uint64_t address) { _onStore(address); }
+
             //////////
             //  Implementation
         private:
@@ -220,9 +305,72 @@ namespace hadesvm
             _Mapping *              _mappings;      //  array of "_mappingsList.size()" elements
             _Mapping *              _endMappings;   //  _mappings + "_mappingsList.size()"
 
+            //  Pages of memory blocks whose content can be accessed directly
+            //  in host memory (RAM, ROM) are found via a 2-level page map.
+            //  The page directory is indexed by the (hashed) number of a region of
+            //  pages and points to a leaf that maps all pages of that region. Pages
+            //  with no page map entry (devices, unmapped addresses, partial pages or
+            //  regions colliding in the page directory) are accessed via IMemoryBlock.
+            //  The page map is built on start() and is published to processor
+            //  threads (which may already be running) when complete. When host
+            //  memory becomes available later (see publishHostData()), a new page
+            //  map is built and published in its place; as processor threads may
+            //  still be looking at the old one, it is only retired. All page maps
+            //  are dropped on deinitialize(), when memory units release host memory.
+            static const unsigned   _PageMapPageShift = 12;
+            static const uint64_t   _PageMapOffsetMask = (UINT64_C(1) << _PageMapPageShift) - 1;
+            static const unsigned   _PageMapLeafShift = 14;         //  a leaf maps 2^14 pages (64MB)
+            static const size_t     _PageMapLeafSize = static_cast<size_t>(1) << _PageMapLeafShift;
+            static const size_t     _PageMapDirectorySize = 1024;   //  must be a power of 2
+
+            struct _PageMapEntry
+            {
+                uint8_t *           _loadData;      //  host memory of the page if loads can access it directly, else nullptr
+                uint8_t *           _storeData;     //  host memory of the page if stores can access it directly, else nullptr
+            };
+
+            struct _PageMapLeaf
+            {
+                uint64_t            _region;        //  page number >> _PageMapLeafShift
+                _PageMapEntry       _pages[_PageMapLeafSize];
+            };
+
+            std::atomic<_PageMapLeaf**> _pageMapDirectory;  //  array of _PageMapDirectorySize elements, nullptr == no leaf; nullptr == no page map
+            QList<_PageMapLeaf**>   _retiredPageMapDirectories;
+            QMutex                  _pageMapGuard;  //  serializes building, replacing and dropping page maps
+
             QMutex                  _lock;
 
+            //  Store snooping
+            QList<IMemorySnooper*>  _snoopers;
+            std::atomic<bool> *     _watchedSlots;  //  array of WatchSlotCount elements
+
             //  Helpers
+            void                    _onStore(uint64_t address)
+            {
+                if (_watchedSlots[watchSlot(address)].load(std::memory_order_relaxed))
+                {
+                    _notifySnoopers(watchSlot(address));
+                }
+            }
+            void                    _notifySnoopers(size_t watchSlot);
+            _PageMapLeaf **         _buildPageMap();
+            void                    _clearPageMap();
+            static void             _deletePageMap(_PageMapLeaf ** pageMapDirectory);
+            const _PageMapEntry *   _findPage(uint64_t address) const
+            {
+                _PageMapLeaf *const * pageMapDirectory = _pageMapDirectory.load(std::memory_order_acquire);
+                if (pageMapDirectory == nullptr)
+                {
+                    return nullptr;
+                }
+                uint64_t pageNumber = address >> _PageMapPageShift;
+                uint64_t region = pageNumber >> _PageMapLeafShift;
+                const _PageMapLeaf * leaf = pageMapDirectory[static_cast<size_t>(region) & (_PageMapDirectorySize - 1)];
+                return (leaf != nullptr && leaf->_region == region) ?
+                            &leaf->_pages[static_cast<size_t>(pageNumber) & (_PageMapLeafSize - 1)] :
+                            nullptr;
+            }
             _Mapping *              _findMapping(uint64_t address)
             {
                 for (_Mapping * mapping = _mappings; mapping < _endMappings; mapping++)
@@ -242,7 +390,8 @@ namespace hadesvm
         //  also doubles at one and only IMemoryBlock it provides
         class HADESVM_CEREON_PUBLIC ResidentMemoryUnit : public hadesvm::core::Component,
                                                          public virtual IMemoryUnit,
-                                                         public virtual IMemoryBlock
+                                                         public virtual IMemoryBlock,
+                                                         public virtual hadesvm::core::ISnapshotComponent
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ResidentMemoryUnit)
 
@@ -271,6 +420,12 @@ namespace hadesvm
             virtual void            disconnect() noexcept override;
             virtual void            reset() noexcept override;
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+        public:
+            virtual void            saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
             //////////
             //  IMemoryUnit
         public:
@@ -282,14 +437,22 @@ namespace hadesvm
             virtual uint64_t        startAddress() const override { return _startAddress; }
             virtual hadesvm::core::MemorySize
                                     size() const override { return _size; }
-            virtual uint8_t         loadByte(size_t offset) throws(MemoryAccessError) override;
-            virtual uint16_t        loadHalfWord(size_t offset, ByteOrder byteOrder) throws(MemoryAccessError) override;
-            virtual uint32_t        loadWord(size_t offset, ByteOrder byteOrder) throws(MemoryAccessError) override;
-            virtual uint64_t        loadLongWord(size_t offset, ByteOrder byteOrder) throws(MemoryAccessError) override;
-            virtual void            storeByte(size_t offset, uint8_t value) throws(MemoryAccessError) override;
-            virtual void            storeHalfWord(size_t offset, uint16_t value, ByteOrder byteOrder) throws(MemoryAccessError) override;
-            virtual void            storeWord(size_t offset, uint32_t value, ByteOrder byteOrder) throws(MemoryAccessError) override;
-            virtual void            storeLongWord(size_t offset, uint64_t value, ByteOrder byteOrder) throws(MemoryAccessError) override;
+            virtual MemoryAccessError   loadByte(size_t offset, uint8_t & value) override;
+            virtual MemoryAccessError   loadHalfWord(size_t offset, ByteOrder byteOrder, uint16_t & value) override;
+            virtual MemoryAccessError   loadWord(size_t offset, ByteOrder byteOrder, uint32_t & value) override;
+            virtual MemoryAccessError   loadLongWord(size_t offset, ByteOrder byteOrder, uint64_t & value) override;
+            virtual MemoryAccessError   storeByte(size_t offset, uint8_t value) override;
+            virtual MemoryAccessError   storeHalfWord(size_t offset, uint16_t value, ByteOrder byteOrder) override;
+            virtual MemoryAccessError   storeWord(size_t offset, uint32_t value, ByteOrder byteOrder) override;
+            virtual MemoryAccessError   storeLongWord(size_t offset, uint64_t value, ByteOrder byteOrder) override;
+            //  While RAM is being restored lazily from a snapshot, all accesses
+            //  must go via IMemoryBlock, so there's no host memory to offer yet.
+            //  Once the restore is done, the memory buses are told to map the
+            //  host memory (see MemoryBus::publishHostData())
+            virtual uint8_t *           hostData(bool /*forStore*/) override
+            {
+                return (_restorer == nullptr || _restorer->isDone()) ? _data : nullptr;
+            }
 
             //////////
             //  Operations (configuration)
@@ -311,6 +474,21 @@ namespace hadesvm
 
             //  Runtime state
             uint8_t *               _data;  //  array of "_sizeInBytes" bytes
+
+            //  The lazy restore of "_data" from a snapshot, nullptr if none;
+            //  only ever changes while the processors are stopped
+            hadesvm::core::LazyMemoryRestorer * _restorer;
+            QList<MemoryBus*>       _restoreListeners;  //  told when the restore is done
+
+            //  Helpers
+            void                    _ensureRestored(size_t offset)
+            {
+                if (_restorer != nullptr)
+                {
+                    _restorer->ensureRestored(offset);
+                }
+            }
+            void                    _finishRestoring();
         };
 
         //////////
@@ -425,13 +603,21 @@ namespace hadesvm
         public:
             virtual void            initialize() throws(hadesvm::core::VirtualApplianceException) override;
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+            //  The ROM content is not saved, just checked to be the same on restore
+        public:
+            virtual void            saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
             //////////
             //  IMemoryBlock
         public:
-            Q_NORETURN virtual void storeByte(size_t offset, uint8_t value) throws(MemoryAccessError) override;
-            Q_NORETURN virtual void storeHalfWord(size_t offset, uint16_t value, ByteOrder byteOrder) throws(MemoryAccessError) override;
-            Q_NORETURN virtual void storeWord(size_t offset, uint32_t value, ByteOrder byteOrder) throws(MemoryAccessError) override;
-            Q_NORETURN virtual void storeLongWord(size_t offset, uint64_t value, ByteOrder byteOrder) throws(MemoryAccessError) override;
+            virtual MemoryAccessError   storeByte(size_t offset, uint8_t value) override;
+            virtual MemoryAccessError   storeHalfWord(size_t offset, uint16_t value, ByteOrder byteOrder) override;
+            virtual MemoryAccessError   storeWord(size_t offset, uint32_t value, ByteOrder byteOrder) override;
+            virtual MemoryAccessError   storeLongWord(size_t offset, uint64_t value, ByteOrder byteOrder) override;
+            virtual uint8_t *           hostData(bool forStore) override { return forStore ? nullptr : ResidentMemoryUnit::hostData(false); }
 
             //////////
             //  Operations (configuration)
@@ -446,6 +632,7 @@ namespace hadesvm
 
             //  Helpers
             QString                 _resolveContentFilePath(const QString & path) const;
+            QByteArray              _contentHash();
         };
     }
 }
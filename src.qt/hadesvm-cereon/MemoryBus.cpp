@@ -17,12 +17,23 @@ MemoryBus::MemoryBus()
     :   _clockFrequency(DefaultClockFrequency),
         _mappings(new _Mapping[1]),
         _endMappings(_mappings),
-        _lock()
-{
+        _pageMapDirectory(nullptr),
+        _retiredPageMapDirectories(),
+        _pageMapGuard(),
+        _lock(),
+        _snoopers(),
+        _watchedSlots(new std::atomic<bool>[WatchSlotCount])
+{
+    for (size_t i = 0; i < WatchSlotCount; i++)
+    {
+        _watchedSlots[i] = false;
+    }
 }
 
 MemoryBus::~MemoryBus() noexcept
 {
+    _clearPageMap();
+    delete [] _watchedSlots;
     delete [] _mappings;
 }
 
@@ -119,6 +130,14 @@ void MemoryBus::start() throws(hadesvm::core::VirtualApplianceException)
         return;
     }
 
+    //  All memory units are initialized by now, so their host memory is in
+    //  place (unless still being restored from a snapshot)
+    QMutexLocker lock(&_pageMapGuard);
+    if (_pageMapDirectory.load(std::memory_order_acquire) == nullptr)
+    {
+        _pageMapDirectory.store(_buildPageMap(), std::memory_order_release);
+    }
+
     _state = State::Running;
 }
 
@@ -143,6 +162,9 @@ void MemoryBus::deinitialize() noexcept
         return;
     }
 
+    //  Memory units release their host memory from now on
+    _clearPageMap();
+
     _state = State::Connected;
 }
 
@@ -261,6 +283,7 @@ void MemoryBus::detachMemoryBlock(IMemoryBlock * memoryBlock)
     {   //  Not mapped
         return;
     }
+    _clearPageMap();    //  ...as it may point into the detached block
 
     size_t numMappings = _endMappings - _mappings;
     for (size_t i = index; i + 1 < numMappings; i++)
@@ -270,80 +293,317 @@ void MemoryBus::detachMemoryBlock(IMemoryBlock * memoryBlock)
     _endMappings--;
 }
 
-uint8_t MemoryBus::loadByte(uint64_t address) throws(MemoryAccessError)
+MemoryAccessError MemoryBus::loadByte(uint64_t address, uint8_t & value)
 {
+    const _PageMapEntry * page = _findPage(address);
+    if (page != nullptr && page->_loadData != nullptr)
+    {   //  RAM/ROM - load directly
+        value = page->_loadData[address & _PageMapOffsetMask];
+        return MemoryAccessError::None;
+    }
     if (_Mapping * mapping = _findMapping(address))
     {
-        return mapping->_memoryBlock->loadByte(static_cast<size_t>(address - mapping->_startAddress));
+        return mapping->_memoryBlock->loadByte(static_cast<size_t>(address - mapping->_startAddress), value);
     }
-    throw MemoryAccessError::InvalidAddress;
+    return MemoryAccessError::InvalidAddress;
 }
 
-uint16_t MemoryBus::loadHalfWord(uint64_t address, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError MemoryBus::loadHalfWord(uint64_t address, ByteOrder byteOrder, uint16_t & value)
 {
+    Q_ASSERT((address & 0x01) == 0);
+
+    const _PageMapEntry * page = _findPage(address);
+    if (page != nullptr && page->_loadData != nullptr)
+    {   //  RAM/ROM - load directly
+        value = hadesvm::util::loadWithByteOrder<uint16_t>(page->_loadData + (address & _PageMapOffsetMask), byteOrder);
+        return MemoryAccessError::None;
+    }
     if (_Mapping * mapping = _findMapping(address))
     {
-        return mapping->_memoryBlock->loadHalfWord(static_cast<size_t>(address - mapping->_startAddress), byteOrder);
+        return mapping->_memoryBlock->loadHalfWord(static_cast<size_t>(address - mapping->_startAddress), byteOrder, value);
     }
-    throw MemoryAccessError::InvalidAddress;
+    return MemoryAccessError::InvalidAddress;
 }
 
-uint32_t MemoryBus::loadWord(uint64_t address, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError MemoryBus::loadWord(uint64_t address, ByteOrder byteOrder, uint32_t & value)
 {
+    Q_ASSERT((address & 0x03) == 0);
+
+    const _PageMapEntry * page = _findPage(address);
+    if (page != nullptr && page->_loadData != nullptr)
+    {   //  RAM/ROM - load directly
+        value = hadesvm::util::loadWithByteOrder<uint32_t>(page->_loadData + (address & _PageMapOffsetMask), byteOrder);
+        return MemoryAccessError::None;
+    }
     if (_Mapping * mapping = _findMapping(address))
     {
-        return mapping->_memoryBlock->loadWord(static_cast<size_t>(address - mapping->_startAddress), byteOrder);
+        return mapping->_memoryBlock->loadWord(static_cast<size_t>(address - mapping->_startAddress), byteOrder, value);
     }
-    throw MemoryAccessError::InvalidAddress;
+    return MemoryAccessError::InvalidAddress;
 }
 
-uint64_t MemoryBus::loadLongWord(uint64_t address, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError MemoryBus::loadLongWord(uint64_t address, ByteOrder byteOrder, uint64_t & value)
 {
+    Q_ASSERT((address & 0x07) == 0);
+
+    const _PageMapEntry * page = _findPage(address);
+    if (page != nullptr && page->_loadData != nullptr)
+    {   //  RAM/ROM - load directly
+        value = hadesvm::util::loadWithByteOrder<uint64_t>(page->_loadData + (address & _PageMapOffsetMask), byteOrder);
+        return MemoryAccessError::None;
+    }
     if (_Mapping * mapping = _findMapping(address))
     {
-        return mapping->_memoryBlock->loadLongWord(static_cast<size_t>(address - mapping->_startAddress), byteOrder);
+        return mapping->_memoryBlock->loadLongWord(static_cast<size_t>(address - mapping->_startAddress), byteOrder, value);
     }
-    throw MemoryAccessError::InvalidAddress;
+    return MemoryAccessError::InvalidAddress;
 }
 
-void MemoryBus::storeByte(uint64_t address, uint8_t value) throws(MemoryAccessError)
+MemoryAccessError MemoryBus::storeByte(uint64_t address, uint8_t value)
 {
+    const _PageMapEntry * page = _findPage(address);
+    if (page != nullptr && page->_storeData != nullptr)
+    {   //  RAM - store directly
+        page->_storeData[address & _PageMapOffsetMask] = value;
+        _onStore(address);
+        return MemoryAccessError::None;
+    }
     if (_Mapping * mapping = _findMapping(address))
     {
-        mapping->_memoryBlock->storeByte(static_cast<size_t>(address - mapping->_startAddress), value);
-        return;
+        MemoryAccessError error = mapping->_memoryBlock->storeByte(static_cast<size_t>(address - mapping->_startAddress), value);
+        if (error == MemoryAccessError::None)
+        {
+            _onStore(address);
+        }
+        return error;
     }
-    throw MemoryAccessError::InvalidAddress;
+    return MemoryAccessError::InvalidAddress;
 }
 
-void MemoryBus::storeHalfWord(uint64_t address, uint16_t value, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError MemoryBus::storeHalfWord(uint64_t address, uint16_t value, ByteOrder byteOrder)
 {
+    Q_ASSERT((address & 0x01) == 0);
+
+    const _PageMapEntry * page = _findPage(address);
+    if (page != nullptr && page->_storeData != nullptr)
+    {   //  RAM - store directly
+        hadesvm::util::storeWithByteOrder<uint16_t>(page->_storeData + (address & _PageMapOffsetMask), value, byteOrder);
+        _onStore(address);
+        return MemoryAccessError::None;
+    }
     if (_Mapping * mapping = _findMapping(address))
     {
-        mapping->_memoryBlock->storeHalfWord(static_cast<size_t>(address - mapping->_startAddress), value, byteOrder);
-        return;
+        MemoryAccessError error = mapping->_memoryBlock->storeHalfWord(static_cast<size_t>(address - mapping->_startAddress), value, byteOrder);
+        if (error == MemoryAccessError::None)
+        {
+            _onStore(address);
+        }
+        return error;
     }
-    throw MemoryAccessError::InvalidAddress;
+    return MemoryAccessError::InvalidAddress;
 }
 
-void MemoryBus::storeWord(uint64_t address, uint32_t value, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError MemoryBus::storeWord(uint64_t address, uint32_t value, ByteOrder byteOrder)
 {
+    Q_ASSERT((address & 0x03) == 0);
+
+    const _PageMapEntry * page = _findPage(address);
+    if (page != nullptr && page->_storeData != nullptr)
+    {   //  RAM - store directly
+        hadesvm::util::storeWithByteOrder<uint32_t>(page->_storeData + (address & _PageMapOffsetMask), value, byteOrder);
+        _onStore(address);
+        return MemoryAccessError::None;
+    }
     if (_Mapping * mapping = _findMapping(address))
     {
-        mapping->_memoryBlock->storeWord(static_cast<size_t>(address - mapping->_startAddress), value, byteOrder);
-        return;
+        MemoryAccessError error = mapping->_memoryBlock->storeWord(static_cast<size_t>(address - mapping->_startAddress), value, byteOrder);
+        if (error == MemoryAccessError::None)
+        {
+            _onStore(address);
+        }
+        return error;
     }
-    throw MemoryAccessError::InvalidAddress;
+    return MemoryAccessError::InvalidAddress;
 }
 
-void MemoryBus::storeLongWord(uint64_t address, uint64_t value, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError MemoryBus::storeLongWord(uint64_t address, uint64_t value, ByteOrder byteOrder)
 {
+    Q_ASSERT((address & 0x07) == 0);
+
+    const _PageMapEntry * page = _findPage(address);
+    if (page != nullptr && page->_storeData != nullptr)
+    {   //  RAM - store directly
+        hadesvm::util::storeWithByteOrder<uint64_t>(page->_storeData + (address & _PageMapOffsetMask), value, byteOrder);
+        _onStore(address);
+        return MemoryAccessError::None;
+    }
     if (_Mapping * mapping = _findMapping(address))
     {
-        mapping->_memoryBlock->storeLongWord(static_cast<size_t>(address - mapping->_startAddress), value, byteOrder);
-        return;
+        MemoryAccessError error = mapping->_memoryBlock->storeLongWord(static_cast<size_t>(address - mapping->_startAddress), value, byteOrder);
+        if (error == MemoryAccessError::None)
+        {
+            _onStore(address);
+        }
+        return error;
+    }
+    return MemoryAccessError::InvalidAddress;
+}
+
+uint8_t * MemoryBus::hostMemory(uint64_t address, uint64_t size, bool forStore)
+{
+    Q_ASSERT(size > 0);
+
+    if ((address & _PageMapOffsetMask) + (size - 1) <= _PageMapOffsetMask)
+    {   //  Within a single page - consult the page map first
+        if (const _PageMapEntry * page = _findPage(address))
+        {
+            uint8_t * data = forStore ? page->_storeData : page->_loadData;
+            if (data != nullptr)
+            {
+                return data + (address & _PageMapOffsetMask);
+            }
+        }
+    }
+    _Mapping * mapping = _findMapping(address);
+    if (mapping == nullptr || address + (size - 1) > mapping->_endAddress)
+    {   //  Unmapped or straddling memory blocks
+        return nullptr;
+    }
+    uint8_t * data = mapping->_memoryBlock->hostData(forStore);
+    return (data != nullptr) ? data + static_cast<size_t>(address - mapping->_startAddress) : nullptr;
+}
+
+void MemoryBus::publishHostData(IMemoryBlock * memoryBlock)
+{
+    Q_ASSERT(memoryBlock != nullptr);
+
+    {
+        QMutexLocker lock(&_pageMapGuard);
+        _PageMapLeaf ** oldPageMapDirectory = _pageMapDirectory.load(std::memory_order_acquire);
+        if (oldPageMapDirectory == nullptr)
+        {   //  Not running - start() will map the host memory
+            return;
+        }
+        _pageMapDirectory.store(_buildPageMap(), std::memory_order_release);
+        _retiredPageMapDirectories.append(oldPageMapDirectory);
+    }
+    //  Processor cores may have cached the absence of host memory in their TLBs
+    for (IMemorySnooper * snooper : _snoopers)
+    {
+        snooper->onHostMemoryPublished();
+    }
+}
+
+void MemoryBus::addSnooper(IMemorySnooper * snooper)
+{
+    Q_ASSERT(snooper != nullptr);
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (!_snoopers.contains(snooper))
+    {
+        _snoopers.append(snooper);
+    }
+}
+
+void MemoryBus::removeSnooper(IMemorySnooper * snooper)
+{
+    Q_ASSERT(snooper != nullptr);
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    _snoopers.removeOne(snooper);
+}
+
+//////////
+//  Implementation helpers
+void MemoryBus::_notifySnoopers(size_t watchSlot)
+{
+    //  The watch is one-shot - clear it BEFORE notifying the snoopers, so
+    //  that a snooper re-watching the page in response is never lost
+    _watchedSlots[watchSlot].store(false, std::memory_order_seq_cst);
+    for (IMemorySnooper * snooper : _snoopers)
+    {
+        snooper->onWatchedPageModified(watchSlot);
+    }
+}
+
+MemoryBus::_PageMapLeaf ** MemoryBus::_buildPageMap()
+{
+    _PageMapLeaf ** pageMapDirectory = new _PageMapLeaf*[_PageMapDirectorySize];
+    for (size_t i = 0; i < _PageMapDirectorySize; i++)
+    {
+        pageMapDirectory[i] = nullptr;
+    }
+    for (_Mapping * mapping = _mappings; mapping < _endMappings; mapping++)
+    {
+        uint8_t * loadData = mapping->_memoryBlock->hostData(false);
+        uint8_t * storeData = mapping->_memoryBlock->hostData(true);
+        if (loadData == nullptr && storeData == nullptr)
+        {   //  Must always go via IMemoryBlock
+            continue;
+        }
+        //  Only pages entirely within the memory block can be mapped
+        uint64_t firstPage = mapping->_startAddress >> _PageMapPageShift;
+        uint64_t lastPage = mapping->_endAddress >> _PageMapPageShift;
+        if ((mapping->_startAddress & _PageMapOffsetMask) != 0)
+        {   //  1st page is partial
+            firstPage++;
+        }
+        if ((mapping->_endAddress & _PageMapOffsetMask) != _PageMapOffsetMask)
+        {   //  Last page is partial
+            if (lastPage == 0)
+            {
+                continue;
+            }
+            lastPage--;
+        }
+        if (lastPage < firstPage)
+        {   //  No whole pages at all
+            continue;
+        }
+        //  Careful - the last page may be the last page of the address space
+        for (uint64_t pageNumber = firstPage; pageNumber - firstPage <= lastPage - firstPage; pageNumber++)
+        {
+            uint64_t region = pageNumber >> _PageMapLeafShift;
+            _PageMapLeaf *& leaf = pageMapDirectory[static_cast<size_t>(region) & (_PageMapDirectorySize - 1)];
+            if (leaf == nullptr)
+            {
+                leaf = new _PageMapLeaf();
+                leaf->_region = region;
+            }
+            else if (leaf->_region != region)
+            {   //  Page directory collision - this page will go via IMemoryBlock
+                continue;
+            }
+            size_t offset = static_cast<size_t>((pageNumber << _PageMapPageShift) - mapping->_startAddress);
+            _PageMapEntry & page = leaf->_pages[static_cast<size_t>(pageNumber) & (_PageMapLeafSize - 1)];
+            page._loadData = (loadData != nullptr) ? loadData + offset : nullptr;
+            page._storeData = (storeData != nullptr) ? storeData + offset : nullptr;
+        }
+    }
+    return pageMapDirectory;
+}
+
+void MemoryBus::_clearPageMap()
+{
+    QMutexLocker lock(&_pageMapGuard);
+    _deletePageMap(_pageMapDirectory.exchange(nullptr, std::memory_order_acq_rel));
+    for (_PageMapLeaf ** pageMapDirectory : _retiredPageMapDirectories)
+    {
+        _deletePageMap(pageMapDirectory);
+    }
+    _retiredPageMapDirectories.clear();
+}
+
+void MemoryBus::_deletePageMap(_PageMapLeaf ** pageMapDirectory)
+{
+    if (pageMapDirectory != nullptr)
+    {
+        for (size_t i = 0; i < _PageMapDirectorySize; i++)
+        {
+            delete pageMapDirectory[i];
+        }
+        delete [] pageMapDirectory;
     }
-    throw MemoryAccessError::InvalidAddress;
 }
 
 //////////
@@ -0,0 +1,58 @@
+//
+//  hadesvm-cereon/PagedMmu.cpp
+//
+//  hadesvm::cereon::PagedMmu class implementation
+//
+//////////
+#include "hadesvm-cereon/API.hpp"
+using namespace hadesvm::cereon;
+
+//////////
+//  Mmu
+MemoryAccessError PagedMmu::translatePage(const Context & context, uint64_t logicalAddress,
+                                          uint64_t & physicalPage, unsigned & accessRights)
+{
+    Q_ASSERT(context.memoryBus != nullptr);
+
+    //  Bits 63..48 must replicate bit 47
+    static const unsigned LogicalAddressBits = PageShift + Levels * EntriesPerTableShift;
+    int64_t signExtendedAddress = static_cast<int64_t>(logicalAddress << (64 - LogicalAddressBits)) >> (64 - LogicalAddressBits);
+    if (static_cast<uint64_t>(signExtendedAddress) != logicalAddress)
+    {   //  OOPS! Non-canonical address
+        return MemoryAccessError::InvalidAddress;
+    }
+
+    //  Walk the page tables, root first
+    uint64_t tableAddress = context.pageTableHead & AddressMask;
+    uint64_t rights = WritableMask | ExecutableMask | UserMask;
+    for (unsigned level = 0; level < Levels; level++)
+    {
+        unsigned shift = PageShift + (Levels - 1 - level) * EntriesPerTableShift;
+        uint64_t index = (logicalAddress >> shift) & ((UINT64_C(1) << EntriesPerTableShift) - 1);
+        uint64_t entry = 0;
+        if (context.memoryBus->loadLongWord(tableAddress + index * 8, context.byteOrder, entry) != MemoryAccessError::None)
+        {   //  OOPS! The page table is not in memory
+            return MemoryAccessError::InvalidPageTable;
+        }
+        if ((entry & ReservedMask) != 0)
+        {   //  OOPS! Malformed entry
+            return MemoryAccessError::InvalidPageTable;
+        }
+        if ((entry & PresentMask) == 0)
+        {   //  OOPS! Not mapped
+            return MemoryAccessError::PageFault;
+        }
+        rights &= entry;
+        tableAddress = entry & AddressMask;
+    }
+
+    //  Done
+    physicalPage = tableAddress;
+    accessRights = LoadAccess |
+                   (((rights & WritableMask) != 0) ? StoreAccess : 0) |
+                   (((rights & ExecutableMask) != 0) ? FetchAccess : 0) |
+                   (((rights & UserMask) != 0) ? UserAccess : 0);
+    return MemoryAccessError::None;
+}
+
+//  End of hadesvm-cereon/PagedMmu.cpp
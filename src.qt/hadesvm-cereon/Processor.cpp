@@ -19,11 +19,17 @@ Processor::Processor(const hadesvm::core::ClockFrequency & clockFrequency, uint8
         _canChangeByteOrder(canChangeByteOrder),
         _restartAddress(restartAddress),
         _isPrimaryProcessor(isPrimaryProcessor),
+        _profileFilePath(),
+        _profileSymbolsFilePath(),
+        _traceFilePath(),
         //  Cores - as QList (for configuration stage)...
         _cores(),
         //  ...and as a plain C list - for runtime stage
         _coresAsArray(),
-        _numCores(0)
+        _numCores(0),
+        //  Threads
+        _workerThreads(),
+        _stopRequested(false)
 {
 }
 
@@ -47,6 +53,13 @@ void Processor::serialiseConfiguration(QDomElement componentElement) const
     componentElement.setAttribute("CanChangeByteOrder", hadesvm::util::toString(_canChangeByteOrder));
     componentElement.setAttribute("RestartAddress", hadesvm::util::toString(_restartAddress, "%016X"));
     componentElement.setAttribute("IsPrimaryProcessor", hadesvm::util::toString(_isPrimaryProcessor));
+    componentElement.setAttribute("ExecutionEngine", hadesvm::util::toString(_executionEngine));
+    componentElement.setAttribute("ParallelCores", hadesvm::util::toString(_parallelCores));
+    componentElement.setAttribute("SyncQuantum", hadesvm::util::toString(_syncQuantum));
+    componentElement.setAttribute("ProfilingInterval", hadesvm::util::toString(_profilingInterval));
+    componentElement.setAttribute("ProfileFilePath", _profileFilePath);
+    componentElement.setAttribute("ProfileSymbolsFilePath", _profileSymbolsFilePath);
+    componentElement.setAttribute("TraceFilePath", _traceFilePath);
 }
 
 void Processor::deserialiseConfiguration(QDomElement componentElement)
@@ -86,6 +99,37 @@ void Processor::deserialiseConfiguration(QDomElement componentElement)
     {
         _isPrimaryProcessor = isPrimaryProcessor;
     }
+
+    ExecutionEngine executionEngine = _executionEngine;
+    if (hadesvm::util::fromString(componentElement.attribute("ExecutionEngine"), executionEngine))
+    {
+        _executionEngine = executionEngine;
+    }
+
+    bool parallelCores = _parallelCores;
+    if (hadesvm::util::fromString(componentElement.attribute("ParallelCores"), parallelCores))
+    {
+        _parallelCores = parallelCores;
+    }
+
+    unsigned syncQuantum = _syncQuantum;
+    if (hadesvm::util::fromString(componentElement.attribute("SyncQuantum"), syncQuantum) &&
+        syncQuantum >= MinSyncQuantum && syncQuantum <= MaxSyncQuantum)
+    {
+        _syncQuantum = syncQuantum;
+    }
+
+    unsigned profilingInterval = _profilingInterval;
+    if (hadesvm::util::fromString(componentElement.attribute("ProfilingInterval"), profilingInterval) &&
+        (profilingInterval == 0 ||
+         (profilingInterval >= MinProfilingInterval && profilingInterval <= MaxProfilingInterval)))
+    {
+        _profilingInterval = profilingInterval;
+    }
+
+    _profileFilePath = componentElement.attribute("ProfileFilePath");
+    _profileSymbolsFilePath = componentElement.attribute("ProfileSymbolsFilePath");
+    _traceFilePath = componentElement.attribute("TraceFilePath");
 }
 
 hadesvm::core::ComponentEditor * Processor::createEditor()
@@ -125,6 +169,12 @@ void Processor::connect() throws(hadesvm::core::VirtualApplianceException)
     }
     _ioBus = ioBuses[0];
 
+    //  Cores must learn of stores into memory they have predecoded
+    for (ProcessorCore * core : _cores)
+    {
+        _memoryBus->addSnooper(core);
+    }
+
     //  Done
     _state = State::Connected;
 }
@@ -166,8 +216,57 @@ void Processor::start() throws(hadesvm::core::VirtualApplianceException)
         return;
     }
 
-    _workerThread = new _WorkerThread(this);
-    _workerThread->start();
+    if (!_traceFilePath.isEmpty())
+    {
+        QString traceFileName = virtualAppliance()->toAbsolutePath(_traceFilePath);
+        _tracer = new Tracer(traceFileName);
+        for (size_t i = 0; i < _numCores; i++)
+        {
+            _coresAsArray[i]->_traceEncoder = _tracer->createEncoder(_coresAsArray[i]->_id, _coresAsArray[i]->_cc);
+        }
+        if (!_tracer->start())
+        {   //  OOPS! Clean up & report
+            for (size_t i = 0; i < _numCores; i++)
+            {
+                _coresAsArray[i]->_traceEncoder = nullptr;
+            }
+            delete _tracer;
+            _tracer = nullptr;
+            throw hadesvm::core::VirtualApplianceException("Cannot create trace file " + traceFileName);
+        }
+    }
+
+    _stopRequested = false;
+    if (_profilingInterval != 0 && !_profileFilePath.isEmpty())
+    {
+        _profiler = new Profiler();
+        if (!_profileSymbolsFilePath.isEmpty())
+        {   //  Unnamed code is profiled by address
+            _profiler->loadSymbols(virtualAppliance()->toAbsolutePath(_profileSymbolsFilePath));
+        }
+        for (size_t i = 0; i < _numCores; i++)
+        {
+            _coresAsArray[i]->_profilingInterval = _profilingInterval;
+            _coresAsArray[i]->_nextSampleCc = _coresAsArray[i]->_cc + _profilingInterval;
+            _coresAsArray[i]->_profileSamples = new hadesvm::util::RingBuffer<ProfileSample>(_ProfileSamplesPerCore);
+        }
+    }
+    if (_parallelCores && _numCores > 1)
+    {
+        _quantumBarrier = new hadesvm::util::Barrier(_numCores);
+        for (size_t i = 0; i < _numCores; i++)
+        {
+            _workerThreads.append(new _WorkerThread(this, i, 1));
+        }
+    }
+    else
+    {
+        _workerThreads.append(new _WorkerThread(this, 0, _numCores));
+    }
+    for (_WorkerThread * workerThread : _workerThreads)
+    {
+        workerThread->start();
+    }
 
     //  Done
     _state = State::Running;
@@ -182,15 +281,45 @@ void Processor::stop() noexcept
         return;
     }
 
-    _workerThread->requestStop();
-    _workerThread->wait(15 * 1000); //  wait 15 seconds...
-    if (_workerThread->isRunning())
-    {   //  ...then force-kill it as a last resort
-        _workerThread->terminate();
-        _workerThread->wait(ULONG_MAX);
+    _stopRequested = true;
+    wakeUp();
+    for (_WorkerThread * workerThread : _workerThreads)
+    {
+        workerThread->wait(15 * 1000);  //  wait 15 seconds...
+        if (workerThread->isRunning())
+        {   //  ...then force-kill it as a last resort
+            workerThread->terminate();
+            workerThread->wait(ULONG_MAX);
+        }
+        delete workerThread;
+    }
+    _workerThreads.clear();
+    delete _quantumBarrier;
+    _quantumBarrier = nullptr;
+
+    if (_profiler != nullptr)
+    {   //  The worker threads are gone - collect what they left behind
+        _drainProfileSamples(0, _numCores);
+        _profiler->writeCollapsedStacks(virtualAppliance()->toAbsolutePath(_profileFilePath));
+        for (size_t i = 0; i < _numCores; i++)
+        {
+            delete _coresAsArray[i]->_profileSamples;
+            _coresAsArray[i]->_profileSamples = nullptr;
+        }
+        delete _profiler;
+        _profiler = nullptr;
+    }
+
+    if (_tracer != nullptr)
+    {   //  The worker threads are gone - the tracer can have the encoders
+        _tracer->stop();
+        for (size_t i = 0; i < _numCores; i++)
+        {
+            _coresAsArray[i]->_traceEncoder = nullptr;
+        }
+        delete _tracer;
+        _tracer = nullptr;
     }
-    delete _workerThread;
-    _workerThread = nullptr;
 
     //  Done
     _state = State::Initialized;
@@ -221,6 +350,10 @@ void Processor::disconnect() noexcept
     }
 
     //  Disconnect from memory and I/O buses
+    for (ProcessorCore * core : _cores)
+    {
+        _memoryBus->removeSnooper(core);
+    }
     _memoryBus = nullptr;
     _ioBus = nullptr;
 
@@ -248,6 +381,57 @@ void Processor::onClockTick() noexcept
     }
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void Processor::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    writer << static_cast<uint32_t>(_numCores);
+    for (size_t i = 0; i < _numCores; i++)
+    {
+        _coresAsArray[i]->saveSnapshot(writer);
+    }
+}
+
+void Processor::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    uint32_t numCores = 0;
+    reader >> numCores;
+    if (numCores != _numCores)
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " has a different number of cores");
+    }
+    for (size_t i = 0; i < _numCores; i++)
+    {
+        _coresAsArray[i]->restoreSnapshot(reader);  //  may throw
+    }
+}
+
+//////////
+//  Operations
+unsigned Processor::runCycles(unsigned numCycles)
+{
+    unsigned result = _runCycles(0, _numCores, numCycles);
+    if (_profiler != nullptr)
+    {   //  There is no worker thread to do it
+        _drainProfileSamples(0, _numCores);
+    }
+    return result;
+}
+
+void Processor::wakeUp()
+{
+    for (_WorkerThread * workerThread : _workerThreads)
+    {
+        workerThread->wakeUp();
+    }
+}
+
 //////////
 //  Operations (configuration)
 void Processor::setClockFrequency(const hadesvm::core::ClockFrequency & clockFrequency)
@@ -290,6 +474,66 @@ void Processor::setPrimaryProcessor(bool primaryProcessor)
     _isPrimaryProcessor = primaryProcessor;
 }
 
+void Processor::setExecutionEngine(ExecutionEngine executionEngine)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    _executionEngine = executionEngine;
+}
+
+void Processor::setParallelCores(bool parallelCores)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    _parallelCores = parallelCores;
+}
+
+void Processor::setSyncQuantum(unsigned syncQuantum)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    if (syncQuantum < MinSyncQuantum || syncQuantum > MaxSyncQuantum)
+    {   //  OOPS! Out of range!
+        throw hadesvm::core::VirtualApplianceException("Invalid sync quantum " +
+                                                       hadesvm::util::toString(syncQuantum));
+    }
+    _syncQuantum = syncQuantum;
+}
+
+void Processor::setProfilingInterval(unsigned profilingInterval)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    if (profilingInterval != 0 &&
+        (profilingInterval < MinProfilingInterval || profilingInterval > MaxProfilingInterval))
+    {   //  OOPS! Out of range!
+        throw hadesvm::core::VirtualApplianceException("Invalid profiling interval " +
+                                                       hadesvm::util::toString(profilingInterval));
+    }
+    _profilingInterval = profilingInterval;
+}
+
+void Processor::setProfileFilePath(const QString & profileFilePath)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    _profileFilePath = profileFilePath;
+}
+
+void Processor::setProfileSymbolsFilePath(const QString & profileSymbolsFilePath)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    _profileSymbolsFilePath = profileSymbolsFilePath;
+}
+
+void Processor::setTraceFilePath(const QString & traceFilePath)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    _traceFilePath = traceFilePath;
+}
+
 Features Processor::features() const
 {
     Features result;
@@ -301,60 +545,126 @@ Features Processor::features() const
 }
 
 //////////
-//  Processor::_WorkerThread
-void Processor::_WorkerThread::run()
+//  Implementation helpers
+unsigned Processor::_runCycles(size_t firstCore, size_t numCores, unsigned numCycles)
 {
-    uint64_t requiredClockFrequencyHz = _processor->clockFrequency().toHz();
-    uint64_t requiredNsPerTick = 1000000000 / requiredClockFrequencyHz;
-    unsigned ticksBetweenDelayAdjustment = static_cast<unsigned>(qMin(qMax(1u, requiredClockFrequencyHz / 10), UINT_MAX));
-    unsigned delayPerTickNs = 0;
-    uint64_t accumulatedDelayNs = 0;
-
-    QElapsedTimer elapsedTimer;
-    while (!_stopRequested)
+    unsigned cyclesRun = 0;
+    while (cyclesRun < numCycles)
     {
-        //  Execute a bunch of instructions...
-        elapsedTimer.restart();
-        for (unsigned n = 0; n < ticksBetweenDelayAdjustment; n++)
+        if (_stopRequested)
+        {   //  Don't keep the stop() waiting
+            break;
+        }
+        unsigned sliceCycles = numCycles - cyclesRun;
+        if (sliceCycles > _CyclesPerSlice)
         {
-            _processor->onClockTick();
-            accumulatedDelayNs += delayPerTickNs;
+            sliceCycles = _CyclesPerSlice;
         }
-        uint64_t accumulatedDelayMs = accumulatedDelayNs / 1000000;
-        accumulatedDelayNs -= 1000000 * accumulatedDelayMs;
-        if (accumulatedDelayMs > 0)
+        for (size_t i = firstCore; i < firstCore + numCores; i++)
         {
-            msleep(static_cast<unsigned long>(accumulatedDelayMs));
+            ProcessorCore * core = _coresAsArray[i];
+            for (unsigned coreCycles = 0; coreCycles < sliceCycles; )
+            {
+                coreCycles += core->runCycles(sliceCycles - coreCycles);
+            }
         }
+        cyclesRun += sliceCycles;
+    }
+    return cyclesRun;
+}
 
-        qint64 idealNsElapsed = requiredNsPerTick * ticksBetweenDelayAdjustment;
-        qint64 actualNsElapsed = elapsedTimer.nsecsElapsed();
+uint64_t Processor::_idleCycles(size_t firstCore, size_t numCores) const
+{
+    uint64_t result = UINT64_MAX;
+    for (size_t i = firstCore; i < firstCore + numCores; i++)
+    {
+        result = qMin(result, _coresAsArray[i]->idleCycles());
+    }
+    return result;
+}
 
-        static int n = 0;
-        if (n++ >= 100)
+void Processor::_drainProfileSamples(size_t firstCore, size_t numCores)
+{
+    Q_ASSERT(_profiler != nullptr);
+    Q_ASSERT(firstCore + numCores <= _numCores);
+
+    ProfileSample sample;
+    for (size_t i = firstCore; i < firstCore + numCores; i++)
+    {
+        while (_coresAsArray[i]->_profileSamples->tryDequeue(sample))
         {
-            n = 0;
-            //TODO kill off qDebug() << idealNsElapsed << " / " << actualNsElapsed << " / " << delayPerTickNs;
+            _profiler->addSample(sample);
+        }
+    }
+}
+
+//////////
+//  Processor::_WorkerThread
+void Processor::_WorkerThread::run()
+{
+    pace(_processor->_stopRequested);
 
-            qint64 actualNsPerTick = actualNsElapsed / ticksBetweenDelayAdjustment;;
-            qint64 actualClockFrequencyHz = 1000000000 / actualNsPerTick;
-            //TODO kill off qDebug() << "Processor Running at " << actualClockFrequencyHz << " Hz";
+    //  Don't keep the other worker threads waiting for this one
+    if (_processor->_quantumBarrier != nullptr)
+    {
+        _processor->_quantumBarrier->arriveAndDrop();
+    }
+}
 
-            _processor->virtualAppliance()->recordAchievedClockFrequency(
-                _processor,
-                hadesvm::core::ClockFrequency::hertz(actualClockFrequencyHz));
-        }
+unsigned Processor::_WorkerThread::runCycles(unsigned numCycles)
+{
+    if (_processor->_quantumBarrier == nullptr)
+    {   //  Single worker thread - nobody to synchronise with
+        return _processor->_runCycles(_firstCore, _numCores, numCycles);
+    }
 
-        //qDebug() << actualNsElapsed;
-        if (actualNsElapsed < idealNsElapsed)
-        {   //  Going too fast!
-            delayPerTickNs++;
+    //  Run in pieces that end at sync quantum boundaries, waiting
+    //  for the other worker threads at each boundary. The last one
+    //  to get there advances virtual time past the quantum for all
+    //  (which only has effect if the VA is unthrottled)
+    hadesvm::core::ClockScheduler * clockScheduler = _processor->virtualAppliance()->clockScheduler();
+    unsigned cyclesRun = 0;
+    while (cyclesRun < numCycles)
+    {
+        unsigned pieceCycles = qMin(numCycles - cyclesRun, _processor->_syncQuantum - _cyclesIntoQuantum);
+        unsigned pieceCyclesRun = _processor->_runCycles(_firstCore, _numCores, pieceCycles);
+        cyclesRun += pieceCyclesRun;
+        _cyclesIntoQuantum += pieceCyclesRun;
+        if (pieceCyclesRun < pieceCycles)
+        {   //  Stop requested
+            break;
         }
-        else if (actualNsElapsed > idealNsElapsed && delayPerTickNs > 0)
-        {   //  Going too slow!
-            delayPerTickNs--;
+        if (_cyclesIntoQuantum == _processor->_syncQuantum)
+        {
+            _cyclesIntoQuantum = 0;
+            _processor->_quantumBarrier->arriveAndWait(
+                [&]
+                {
+                    clockScheduler->advanceTo(
+                        clockScheduler->now() +
+                        hadesvm::core::ClockScheduler::clockTicksToNs(_processor->clockFrequency(), _processor->_syncQuantum));
+                });
         }
     }
+    return cyclesRun;
+}
+
+uint64_t Processor::_WorkerThread::idleCycles()
+{   //  Don't skip past the end of the current sync quantum
+    uint64_t result = _processor->_idleCycles(_firstCore, _numCores);
+    if (_processor->_quantumBarrier != nullptr)
+    {
+        result = qMin(result, static_cast<uint64_t>(_processor->_syncQuantum - _cyclesIntoQuantum));
+    }
+    return result;
+}
+
+void Processor::_WorkerThread::beforeRunningCycles()
+{   //  Collect the profile samples taken meanwhile by our own cores
+    if (_processor->_profiler != nullptr)
+    {
+        _processor->_drainProfileSamples(_firstCore, _numCores);
+    }
 }
 
 //  End of hadesvm-cereon/Processor.cpp
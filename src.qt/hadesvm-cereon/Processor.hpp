@@ -13,12 +13,27 @@ namespace hadesvm
         //  The Cereon processor
         class HADESVM_CEREON_PUBLIC Processor : public hadesvm::core::Component,
                                                 public virtual hadesvm::core::IClockedComponent,
-                                                public virtual hadesvm::core::IActiveComponent
+                                                public virtual hadesvm::core::IActiveComponent,
+                                                public virtual hadesvm::core::ISnapshotComponent
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Processor)
 
             friend class ProcessorCore;
 
+            //////////
+            //  Constants
+        public:
+            //  The number of clock cycles the cores of a processor run on
+            //  separate host threads before waiting for each other
+            static const unsigned   DefaultSyncQuantum = 10000;
+            static const unsigned   MinSyncQuantum = 100;
+            static const unsigned   MaxSyncQuantum = 1000000;
+
+            //  The number of clock cycles between profile samples of a
+            //  core; 0 == no profiling
+            static const unsigned   MinProfilingInterval = 10000;
+            static const unsigned   MaxProfilingInterval = 100000000;
+
             //////////
             //  Construction/destruction
         public:
@@ -56,6 +71,27 @@ namespace hadesvm
                                 clockFrequency() const noexcept override { return _clockFrequency; }
             virtual void        onClockTick() noexcept override;
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+        public:
+            virtual void        saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void        restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
+            //////////
+            //  Operations
+        public:
+            //  Runs all cores for the specified number of clock cycles, with
+            //  the same effect as calling onClockTick() that many times. Cores
+            //  are interleaved in slices of up to _CyclesPerSlice cycles.
+            //  Returns the number of clock cycles actually run, which is less
+            //  than requested only if the worker threads are asked to stop.
+            unsigned            runCycles(unsigned numCycles);
+
+            //  Wakes the worker threads up if they sleep because their cores
+            //  are Idle. Must be called (from any thread) by whoever makes an
+            //  interrupt pending for the cores of this processor.
+            void                wakeUp();
+
             //////////
             //  hadesvm::core::IActiveComponent
         public:
@@ -73,6 +109,25 @@ namespace hadesvm
             void                setRestartAddress(uint64_t restartAddress);
             bool                isPrimaryProcessor() const { return _isPrimaryProcessor; }
             void                setPrimaryProcessor(bool primaryProcessor);
+            ExecutionEngine     executionEngine() const { return _executionEngine; }
+            void                setExecutionEngine(ExecutionEngine executionEngine);
+            bool                parallelCores() const { return _parallelCores; }
+            void                setParallelCores(bool parallelCores);
+            unsigned            syncQuantum() const { return _syncQuantum; }
+            void                setSyncQuantum(unsigned syncQuantum);
+            unsigned            profilingInterval() const { return _profilingInterval; }
+            void                setProfilingInterval(unsigned profilingInterval);
+            //  When profiling, the collapsed stacks are written to the profile
+            //  file when the processor stops, naming code by the symbols from
+            //  the symbols file (if any); relative paths are relative to the VA
+            QString             profileFilePath() const { return _profileFilePath; }
+            void                setProfileFilePath(const QString & profileFilePath);
+            QString             profileSymbolsFilePath() const { return _profileSymbolsFilePath; }
+            void                setProfileSymbolsFilePath(const QString & profileSymbolsFilePath);
+            //  If not empty, the execution of all cores is traced to this file
+            //  while the processor runs (see Tracer); relative to the VA
+            QString             traceFilePath() const { return _traceFilePath; }
+            void                setTraceFilePath(const QString & traceFilePath);
 
             //  The union of Feature sets of all cores
             Features            features() const;
@@ -89,6 +144,16 @@ namespace hadesvm
             bool                _canChangeByteOrder;
             uint64_t            _restartAddress;
             bool                _isPrimaryProcessor;
+            ExecutionEngine     _executionEngine = ExecutionEngine::Reference;
+            bool                _parallelCores = false; //  one host thread per core
+            unsigned            _syncQuantum = DefaultSyncQuantum;
+            unsigned            _profilingInterval = 0;
+            QString             _profileFilePath;
+            QString             _profileSymbolsFilePath;
+            QString             _traceFilePath;
+
+            //  The max number of clock cycles a core runs before others catch up
+            static const unsigned   _CyclesPerSlice = 1024;
 
             //  Cores - as QList (for configuration stage)...
             QList<ProcessorCore*>   _cores;
@@ -96,20 +161,32 @@ namespace hadesvm
             ProcessorCore *     _coresAsArray[256];
             size_t              _numCores;
 
+            //  Runs/queries cores [firstCore .. firstCore + numCores) only
+            unsigned            _runCycles(size_t firstCore, size_t numCores, unsigned numCycles);
+            uint64_t            _idleCycles(size_t firstCore, size_t numCores) const;
+
             //  Links to other VM components
             MemoryBus *         _memoryBus = nullptr;   //  nullptr == not attached
             IoBus *             _ioBus = nullptr;   //  nullptr == not attached
 
-            //  Threads
-            class _WorkerThread final : public QThread
+            //  Threads. Normally a single worker thread runs all cores; with
+            //  _parallelCores each core gets a worker thread of its own, and
+            //  these wait for each other every _syncQuantum clock cycles so
+            //  that no core's $cc/$itc runs ahead of the others by more.
+            //  Unthrottled, these worker threads advance virtual time only
+            //  once all of them have reached the end of a sync quantum.
+            class _WorkerThread final : public QThread,
+                                        public hadesvm::core::ProcessorPacer
             {
                 HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_WorkerThread)
 
                 //////////
                 //  Construction/destruction
             public:
-                explicit _WorkerThread(Processor * processor)
-                    :   _processor(processor), _stopRequested(false) {}
+                _WorkerThread(Processor * processor, size_t firstCore, size_t numCores)
+                    :   ProcessorPacer(processor, firstCore == 0, processor->_quantumBarrier == nullptr),
+                        _processor(processor), _firstCore(firstCore), _numCores(numCores),
+                        _cyclesIntoQuantum(0) {}
                 virtual ~_WorkerThread() = default;
 
                 //////////
@@ -118,17 +195,34 @@ namespace hadesvm
                 virtual void    run() override;
 
                 //////////
-                //  Operations
-            public:
-                void            requestStop() { _stopRequested = true; }
+                //  hadesvm::core::ProcessorPacer
+            protected:
+                virtual unsigned    runCycles(unsigned numCycles) override;
+                virtual uint64_t    idleCycles() override;
+                virtual void        beforeRunningCycles() override;
 
                 //////////
                 //  Implementation
             private:
                 Processor *const    _processor;
-                std::atomic<bool>   _stopRequested;
+                const size_t        _firstCore;
+                const size_t        _numCores;
+                unsigned            _cyclesIntoQuantum;
             };
-            _WorkerThread *     _workerThread = nullptr;
+            QList<_WorkerThread*>   _workerThreads;
+            std::atomic<bool>   _stopRequested;
+            hadesvm::util::Barrier *    _quantumBarrier = nullptr;  //  nullptr == single worker thread
+
+            //  Profiling. Each core has a buffer of samples, which the worker
+            //  thread running that core drains into the profiler periodically
+            static const size_t _ProfileSamplesPerCore = 16384;
+            Profiler *          _profiler = nullptr;    //  nullptr == not profiling
+
+            //  Drains cores [firstCore .. firstCore + numCores) only
+            void                _drainProfileSamples(size_t firstCore, size_t numCores);
+
+            //  Tracing
+            Tracer *            _tracer = nullptr;  //  nullptr == not tracing
         };
 
         //////////
@@ -186,6 +280,63 @@ namespace hadesvm
             DummyMmu            _mmu;
             ProcessorCore       _core;
         };
+
+        //////////
+        //  The Cereon-1P1V processor - a Cereon-1P1B with the VirtualMemory
+        //  feature, translating addresses by the page tables in memory
+        class HADESVM_CEREON_PUBLIC Cereon1P1V final : public Processor
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Cereon1P1V)
+
+            //////////
+            //  Constants
+        public:
+            static const ByteOrder      DefaultByteOrder;
+            static const uint64_t       DefaultRestartAddress;
+            static const hadesvm::core::ClockFrequency  DefaultClockFrequency;
+
+            //////////
+            //  Types
+        public:
+            //  The type of a Cereon-1P1V processor
+            class HADESVM_CEREON_PUBLIC Type final : public hadesvm::core::ComponentType
+            {
+                HADESVM_DECLARE_SINGLETON(Type);
+
+                //////////
+                //  hadesvm::util::StockObject
+            public:
+                virtual QString mnemonic() const override;
+                virtual QString displayName() const override;
+
+                //////////
+                //  hadesvm::core::ComponentType
+            public:
+                virtual hadesvm::core::ComponentCategory *  category() const override;
+                virtual bool                isCompatibleWith(hadesvm::core::VirtualArchitecture * architecture) const override;
+                virtual bool                isCompatibleWith(hadesvm::core::VirtualApplianceType * type) const override;
+                virtual Cereon1P1V *        createComponent() override;
+            };
+
+            //////////
+            //  Construction/destruction
+        public:
+            explicit Cereon1P1V(uint8_t id);
+            virtual ~Cereon1P1V() noexcept;
+
+            //////////
+            //  hadesvm::core::Component
+        public:
+            virtual Type *      componentType() const override { return Type::instance(); }
+
+            //////////
+            //  Implementation
+        private:
+
+            //  Processor blocks
+            PagedMmu            _mmu;
+            ProcessorCore       _core;
+        };
     }
 }
 
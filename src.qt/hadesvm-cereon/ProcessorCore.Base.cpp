@@ -9,7 +9,7 @@ using namespace hadesvm::cereon;
 
 //////////
 //  BASE (data movement)
-unsigned ProcessorCore::_handleMovL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMovL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000240);
 
@@ -19,6 +19,7 @@ unsigned ProcessorCore::_handleMovL(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = _r[r2];
@@ -26,7 +27,7 @@ unsigned ProcessorCore::_handleMovL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleMovCR(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMovCR(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000200);
 
@@ -36,6 +37,7 @@ unsigned ProcessorCore::_handleMovCR(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = *_cPtr[r2];
@@ -43,7 +45,7 @@ unsigned ProcessorCore::_handleMovCR(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleMovRC(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMovRC(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000201);
 
@@ -53,11 +55,13 @@ unsigned ProcessorCore::_handleMovRC(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     switch (r1)
     {
@@ -68,21 +72,26 @@ unsigned ProcessorCore::_handleMovRC(uint32_t instruction) throws(ProgramInterru
                 if (_state.getByteOrder() != newState.getByteOrder() &&
                     !_processor->_canChangeByteOrder)
                 {   //  OOPS! Can't!
-                    throw ProgramInterrupt::OPERAND;
+                    _raiseProgramInterrupt(ProgramInterrupt::OPERAND);
+                    return 1;
                 }
                 //  Are we switching to Virtual mode ?
                 if (_state.isInRealMode() && newState.isInVirtualMode() &&
                     !_features.has(Feature::ProtectedMemory) && !_features.has(Feature::VirtualMemory))
                 {   //  OOPS! Can't!
-                    throw ProgramInterrupt::OPERAND;
+                    _raiseProgramInterrupt(ProgramInterrupt::OPERAND);
+                    return 1;
                 }
             }
             //  Switch state and update replicated fields
             _state = _r[r2];
             break;
         case 1: //  $pth
+            //  Drop cached translations of the current context (even
+            //  if $pth doesn't change, as its page tables may have)
             _pth = _r[r2];
-            throw hadesvm::core::VirtualApplianceException("Not yet implemented");
+            _invalidateTlbs(_state.getContextId());
+            break;
         default:
             //  All other control registers require no special actions when assigned-to
             *_cPtr[r1] = _r[r2];
@@ -92,7 +101,57 @@ unsigned ProcessorCore::_handleMovRC(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleLiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMovMR(uint32_t instruction)
+{
+    Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000204);
+
+    //  Decode
+    unsigned r1 = (instruction >> 21) & 0x1F;
+    unsigned r2 = (instruction >> 16) & 0x1F;
+    if ((instruction & 0x0000F800) != 0 || !_features.has(Feature::PerformanceMonitoring))
+    {   //  Bits 11..15 are unused and must all be 0
+        _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
+    }
+    //  Execute
+    if (!_state.isInKernelMode() && (_m[_PmControlRegister] & _PmUserReadMask) == 0)
+    {
+        _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
+    }
+    _r[r1] = _m[r2];
+    //  Done
+    return 1;
+}
+
+unsigned ProcessorCore::_handleMovRM(uint32_t instruction)
+{
+    Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000205);
+
+    //  Decode
+    unsigned r1 = (instruction >> 21) & 0x1F;
+    unsigned r2 = (instruction >> 16) & 0x1F;
+    if ((instruction & 0x0000F800) != 0 || !_features.has(Feature::PerformanceMonitoring))
+    {   //  Bits 11..15 are unused and must all be 0
+        _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
+    }
+    //  Execute
+    if (!_state.isInKernelMode())
+    {
+        _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
+    }
+    _m[r1] = _r[r2];
+    if (r1 == _PmControlRegister)
+    {   //  Counting may have been switched on or off
+        _updatePerformanceMonitoring();
+    }
+    //  Done
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x00000000);
 
@@ -105,7 +164,7 @@ unsigned ProcessorCore::_handleLiL(uint32_t instruction) throws(ProgramInterrupt
     return 1;
 }
 
-unsigned ProcessorCore::_handleSwapH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSwapH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400024F);
 
@@ -115,6 +174,7 @@ unsigned ProcessorCore::_handleSwapH(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = Alu::signExtendInt16(Alu::reverseBytes16(_r[r2]));
@@ -122,7 +182,7 @@ unsigned ProcessorCore::_handleSwapH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSwapUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSwapUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000257);
 
@@ -132,6 +192,7 @@ unsigned ProcessorCore::_handleSwapUH(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = Alu::zeroExtendInt16(Alu::reverseBytes16(_r[r2]));
@@ -139,7 +200,7 @@ unsigned ProcessorCore::_handleSwapUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleSwapW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSwapW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400025F);
 
@@ -149,6 +210,7 @@ unsigned ProcessorCore::_handleSwapW(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = Alu::signExtendInt32(Alu::reverseBytes32(_r[r2]));
@@ -156,7 +218,7 @@ unsigned ProcessorCore::_handleSwapW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSwapUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSwapUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000267);
 
@@ -166,6 +228,7 @@ unsigned ProcessorCore::_handleSwapUW(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = Alu::zeroExtendInt32(Alu::reverseBytes32(_r[r2]));
@@ -173,7 +236,7 @@ unsigned ProcessorCore::_handleSwapUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleSwapL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSwapL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400026F);
 
@@ -183,6 +246,7 @@ unsigned ProcessorCore::_handleSwapL(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = Alu::reverseBytes64(_r[r2]);
@@ -192,7 +256,7 @@ unsigned ProcessorCore::_handleSwapL(uint32_t instruction) throws(ProgramInterru
 
 //////////
 //  BASE (arithmetic)
-unsigned ProcessorCore::_handleAddB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000280);
 
@@ -206,7 +270,7 @@ unsigned ProcessorCore::_handleAddB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000288);
 
@@ -220,7 +284,7 @@ unsigned ProcessorCore::_handleAddUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000290);
 
@@ -234,7 +298,7 @@ unsigned ProcessorCore::_handleAddH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000298);
 
@@ -248,7 +312,7 @@ unsigned ProcessorCore::_handleAddUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002A0);
 
@@ -262,7 +326,7 @@ unsigned ProcessorCore::_handleAddW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002A8);
 
@@ -276,7 +340,7 @@ unsigned ProcessorCore::_handleAddUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002B0);
 
@@ -290,7 +354,7 @@ unsigned ProcessorCore::_handleAddL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002B8);
 
@@ -304,7 +368,7 @@ unsigned ProcessorCore::_handleAddUL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000281);
 
@@ -318,7 +382,7 @@ unsigned ProcessorCore::_handleSubB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000289);
 
@@ -332,7 +396,7 @@ unsigned ProcessorCore::_handleSubUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000291);
 
@@ -346,7 +410,7 @@ unsigned ProcessorCore::_handleSubH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000299);
 
@@ -360,7 +424,7 @@ unsigned ProcessorCore::_handleSubUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002A1);
 
@@ -374,7 +438,7 @@ unsigned ProcessorCore::_handleSubW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002A9);
 
@@ -388,7 +452,7 @@ unsigned ProcessorCore::_handleSubUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002B1);
 
@@ -402,7 +466,7 @@ unsigned ProcessorCore::_handleSubL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002B9);
 
@@ -416,7 +480,7 @@ unsigned ProcessorCore::_handleSubUL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleMulB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000282);
 
@@ -430,7 +494,7 @@ unsigned ProcessorCore::_handleMulB(uint32_t instruction) throws(ProgramInterrup
     return 10;
 }
 
-unsigned ProcessorCore::_handleMulUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400028A);
 
@@ -444,7 +508,7 @@ unsigned ProcessorCore::_handleMulUB(uint32_t instruction) throws(ProgramInterru
     return 10;
 }
 
-unsigned ProcessorCore::_handleMulH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000292);
 
@@ -458,7 +522,7 @@ unsigned ProcessorCore::_handleMulH(uint32_t instruction) throws(ProgramInterrup
     return 10;
 }
 
-unsigned ProcessorCore::_handleMulUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400029A);
 
@@ -472,7 +536,7 @@ unsigned ProcessorCore::_handleMulUH(uint32_t instruction) throws(ProgramInterru
     return 10;
 }
 
-unsigned ProcessorCore::_handleMulW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002A2);
 
@@ -486,7 +550,7 @@ unsigned ProcessorCore::_handleMulW(uint32_t instruction) throws(ProgramInterrup
     return 10;
 }
 
-unsigned ProcessorCore::_handleMulUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002AA);
 
@@ -500,7 +564,7 @@ unsigned ProcessorCore::_handleMulUW(uint32_t instruction) throws(ProgramInterru
     return 10;
 }
 
-unsigned ProcessorCore::_handleMulL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002B2);
 
@@ -514,7 +578,7 @@ unsigned ProcessorCore::_handleMulL(uint32_t instruction) throws(ProgramInterrup
     return 10;
 }
 
-unsigned ProcessorCore::_handleMulUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002BA);
 
@@ -528,7 +592,7 @@ unsigned ProcessorCore::_handleMulUL(uint32_t instruction) throws(ProgramInterru
     return 10;
 }
 
-unsigned ProcessorCore::_handleDivB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000283);
 
@@ -542,7 +606,7 @@ unsigned ProcessorCore::_handleDivB(uint32_t instruction) throws(ProgramInterrup
     return 32;
 }
 
-unsigned ProcessorCore::_handleDivUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400028B);
 
@@ -556,7 +620,7 @@ unsigned ProcessorCore::_handleDivUB(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleDivH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000293);
 
@@ -570,7 +634,7 @@ unsigned ProcessorCore::_handleDivH(uint32_t instruction) throws(ProgramInterrup
     return 32;
 }
 
-unsigned ProcessorCore::_handleDivUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400029B);
 
@@ -584,7 +648,7 @@ unsigned ProcessorCore::_handleDivUH(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleDivW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002A3);
 
@@ -598,7 +662,7 @@ unsigned ProcessorCore::_handleDivW(uint32_t instruction) throws(ProgramInterrup
     return 32;
 }
 
-unsigned ProcessorCore::_handleDivUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002AB);
 
@@ -612,7 +676,7 @@ unsigned ProcessorCore::_handleDivUW(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleDivL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002B3);
 
@@ -626,7 +690,7 @@ unsigned ProcessorCore::_handleDivL(uint32_t instruction) throws(ProgramInterrup
     return 32;
 }
 
-unsigned ProcessorCore::_handleDivUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002BB);
 
@@ -640,7 +704,7 @@ unsigned ProcessorCore::_handleDivUL(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleModB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000284);
 
@@ -654,7 +718,7 @@ unsigned ProcessorCore::_handleModB(uint32_t instruction) throws(ProgramInterrup
     return 32;
 }
 
-unsigned ProcessorCore::_handleModUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400028C);
 
@@ -668,7 +732,7 @@ unsigned ProcessorCore::_handleModUB(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleModH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000294);
 
@@ -682,7 +746,7 @@ unsigned ProcessorCore::_handleModH(uint32_t instruction) throws(ProgramInterrup
     return 32;
 }
 
-unsigned ProcessorCore::_handleModUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400029C);
 
@@ -696,7 +760,7 @@ unsigned ProcessorCore::_handleModUH(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleModW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002A4);
 
@@ -710,7 +774,7 @@ unsigned ProcessorCore::_handleModW(uint32_t instruction) throws(ProgramInterrup
     return 32;
 }
 
-unsigned ProcessorCore::_handleModUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002AC);
 
@@ -724,7 +788,7 @@ unsigned ProcessorCore::_handleModUW(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleModL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002B4);
 
@@ -738,7 +802,7 @@ unsigned ProcessorCore::_handleModL(uint32_t instruction) throws(ProgramInterrup
     return 32;
 }
 
-unsigned ProcessorCore::_handleModUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002BC);
 
@@ -752,7 +816,7 @@ unsigned ProcessorCore::_handleModUL(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleAbsB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAbsB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000285);
 
@@ -762,6 +826,7 @@ unsigned ProcessorCore::_handleAbsB(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeAbsSigned<_Byte>(_r[r1], _r[r2]);
@@ -769,7 +834,7 @@ unsigned ProcessorCore::_handleAbsB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAbsH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAbsH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000295);
 
@@ -779,6 +844,7 @@ unsigned ProcessorCore::_handleAbsH(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeAbsSigned<_HalfWord>(_r[r1], _r[r2]);
@@ -786,7 +852,7 @@ unsigned ProcessorCore::_handleAbsH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAbsW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAbsW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x040002A5);
 
@@ -796,6 +862,7 @@ unsigned ProcessorCore::_handleAbsW(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeAbsSigned<_Word>(_r[r1], _r[r2]);
@@ -803,7 +870,7 @@ unsigned ProcessorCore::_handleAbsW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAbsL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAbsL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x040002B5);
 
@@ -813,6 +880,7 @@ unsigned ProcessorCore::_handleAbsL(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeAbsSigned<_LongWord>(_r[r1], _r[r2]);
@@ -820,7 +888,7 @@ unsigned ProcessorCore::_handleAbsL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleNegB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNegB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000286);
 
@@ -830,6 +898,7 @@ unsigned ProcessorCore::_handleNegB(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeSubtractSigned<_Byte>(_r[r1], 0, _r[r2]);
@@ -837,7 +906,7 @@ unsigned ProcessorCore::_handleNegB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleCpl2UB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCpl2UB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400028E);
 
@@ -847,6 +916,7 @@ unsigned ProcessorCore::_handleCpl2UB(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeCpl2Unsigned<_Byte>(_r[r1], _r[r2]);
@@ -854,7 +924,7 @@ unsigned ProcessorCore::_handleCpl2UB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleNegH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNegH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000296);
 
@@ -864,6 +934,7 @@ unsigned ProcessorCore::_handleNegH(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeSubtractSigned<_HalfWord>(_r[r1], 0, _r[r2]);
@@ -871,7 +942,7 @@ unsigned ProcessorCore::_handleNegH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleCpl2UH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCpl2UH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400029E);
 
@@ -881,6 +952,7 @@ unsigned ProcessorCore::_handleCpl2UH(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeCpl2Unsigned<_HalfWord>(_r[r1], _r[r2]);
@@ -888,7 +960,7 @@ unsigned ProcessorCore::_handleCpl2UH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleNegW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNegW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x040002A6);
 
@@ -898,6 +970,7 @@ unsigned ProcessorCore::_handleNegW(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeSubtractSigned<_Word>(_r[r1], 0, _r[r2]);
@@ -905,7 +978,7 @@ unsigned ProcessorCore::_handleNegW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleCpl2UW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCpl2UW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x040002AE);
 
@@ -915,6 +988,7 @@ unsigned ProcessorCore::_handleCpl2UW(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeCpl2Unsigned<_Word>(_r[r1], _r[r2]);
@@ -922,7 +996,7 @@ unsigned ProcessorCore::_handleCpl2UW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleNegL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNegL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x040002B6);
 
@@ -932,6 +1006,7 @@ unsigned ProcessorCore::_handleNegL(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeSubtractSigned<_LongWord>(_r[r1], 0, _r[r2]);
@@ -939,7 +1014,7 @@ unsigned ProcessorCore::_handleNegL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleCpl2UL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCpl2UL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x040002BE);
 
@@ -949,6 +1024,7 @@ unsigned ProcessorCore::_handleCpl2UL(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeCpl2Unsigned<_LongWord>(_r[r1], _r[r2]);
@@ -956,7 +1032,7 @@ unsigned ProcessorCore::_handleCpl2UL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddiB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddiB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040002C0);
 
@@ -970,7 +1046,7 @@ unsigned ProcessorCore::_handleAddiB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddiUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddiUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04000AC0);
 
@@ -984,7 +1060,7 @@ unsigned ProcessorCore::_handleAddiUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddiH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddiH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040012C0);
 
@@ -998,7 +1074,7 @@ unsigned ProcessorCore::_handleAddiH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddiUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddiUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04001AC0);
 
@@ -1012,7 +1088,7 @@ unsigned ProcessorCore::_handleAddiUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddiW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddiW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040022C0);
 
@@ -1026,7 +1102,7 @@ unsigned ProcessorCore::_handleAddiW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddiUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddiUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04002AC0);
 
@@ -1040,7 +1116,7 @@ unsigned ProcessorCore::_handleAddiUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x08000000);
 
@@ -1054,7 +1130,7 @@ unsigned ProcessorCore::_handleAddiL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x28000000);
 
@@ -1068,7 +1144,7 @@ unsigned ProcessorCore::_handleAddiUL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubiB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubiB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040042C0);
 
@@ -1082,7 +1158,7 @@ unsigned ProcessorCore::_handleSubiB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubiUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubiUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04004AC0);
 
@@ -1096,7 +1172,7 @@ unsigned ProcessorCore::_handleSubiUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubiH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubiH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040052C0);
 
@@ -1110,7 +1186,7 @@ unsigned ProcessorCore::_handleSubiH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubiUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubiUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04005AC0);
 
@@ -1124,7 +1200,7 @@ unsigned ProcessorCore::_handleSubiUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubiW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubiW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040062C0);
 
@@ -1138,7 +1214,7 @@ unsigned ProcessorCore::_handleSubiW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubiUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubiUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04006AC0);
 
@@ -1152,7 +1228,7 @@ unsigned ProcessorCore::_handleSubiUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x0C000000);
 
@@ -1166,7 +1242,7 @@ unsigned ProcessorCore::_handleSubiL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x2C000000);
 
@@ -1180,7 +1256,7 @@ unsigned ProcessorCore::_handleSubiUL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleMuliB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMuliB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040082C0);
 
@@ -1194,7 +1270,7 @@ unsigned ProcessorCore::_handleMuliB(uint32_t instruction) throws(ProgramInterru
     return 10;
 }
 
-unsigned ProcessorCore::_handleMuliUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMuliUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04008AC0);
 
@@ -1208,7 +1284,7 @@ unsigned ProcessorCore::_handleMuliUB(uint32_t instruction) throws(ProgramInterr
     return 10;
 }
 
-unsigned ProcessorCore::_handleMuliH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMuliH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040092C0);
 
@@ -1222,7 +1298,7 @@ unsigned ProcessorCore::_handleMuliH(uint32_t instruction) throws(ProgramInterru
     return 10;
 }
 
-unsigned ProcessorCore::_handleMuliUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMuliUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04009AC0);
 
@@ -1236,7 +1312,7 @@ unsigned ProcessorCore::_handleMuliUH(uint32_t instruction) throws(ProgramInterr
     return 10;
 }
 
-unsigned ProcessorCore::_handleMuliW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMuliW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400A2C0);
 
@@ -1250,7 +1326,7 @@ unsigned ProcessorCore::_handleMuliW(uint32_t instruction) throws(ProgramInterru
     return 10;
 }
 
-unsigned ProcessorCore::_handleMuliUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMuliUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400AAC0);
 
@@ -1264,7 +1340,7 @@ unsigned ProcessorCore::_handleMuliUW(uint32_t instruction) throws(ProgramInterr
     return 10;
 }
 
-unsigned ProcessorCore::_handleMuliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMuliL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x10000000);
 
@@ -1278,7 +1354,7 @@ unsigned ProcessorCore::_handleMuliL(uint32_t instruction) throws(ProgramInterru
     return 10;
 }
 
-unsigned ProcessorCore::_handleMuliUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMuliUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x30000000);
 
@@ -1292,7 +1368,7 @@ unsigned ProcessorCore::_handleMuliUL(uint32_t instruction) throws(ProgramInterr
     return 10;
 }
 
-unsigned ProcessorCore::_handleDiviB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDiviB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400C2C0);
 
@@ -1306,7 +1382,7 @@ unsigned ProcessorCore::_handleDiviB(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleDiviUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDiviUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400CAC0);
 
@@ -1320,7 +1396,7 @@ unsigned ProcessorCore::_handleDiviUB(uint32_t instruction) throws(ProgramInterr
     return 32;
 }
 
-unsigned ProcessorCore::_handleDiviH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDiviH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400D2C0);
 
@@ -1334,7 +1410,7 @@ unsigned ProcessorCore::_handleDiviH(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleDiviUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDiviUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400DAC0);
 
@@ -1348,7 +1424,7 @@ unsigned ProcessorCore::_handleDiviUH(uint32_t instruction) throws(ProgramInterr
     return 32;
 }
 
-unsigned ProcessorCore::_handleDiviW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDiviW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400E2C0);
 
@@ -1362,7 +1438,7 @@ unsigned ProcessorCore::_handleDiviW(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleDiviUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDiviUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400EAC0);
 
@@ -1376,7 +1452,7 @@ unsigned ProcessorCore::_handleDiviUW(uint32_t instruction) throws(ProgramInterr
     return 32;
 }
 
-unsigned ProcessorCore::_handleDiviL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDiviL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x14000000);
 
@@ -1390,7 +1466,7 @@ unsigned ProcessorCore::_handleDiviL(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleDiviUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDiviUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x34000000);
 
@@ -1404,7 +1480,7 @@ unsigned ProcessorCore::_handleDiviUL(uint32_t instruction) throws(ProgramInterr
     return 32;
 }
 
-unsigned ProcessorCore::_handleModiB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModiB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040032C0);
 
@@ -1418,7 +1494,7 @@ unsigned ProcessorCore::_handleModiB(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleModiUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModiUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04003AC0);
 
@@ -1432,7 +1508,7 @@ unsigned ProcessorCore::_handleModiUB(uint32_t instruction) throws(ProgramInterr
     return 32;
 }
 
-unsigned ProcessorCore::_handleModiH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModiH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x040072C0);
 
@@ -1446,7 +1522,7 @@ unsigned ProcessorCore::_handleModiH(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleModiUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModiUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04007AC0);
 
@@ -1460,7 +1536,7 @@ unsigned ProcessorCore::_handleModiUH(uint32_t instruction) throws(ProgramInterr
     return 32;
 }
 
-unsigned ProcessorCore::_handleModiW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModiW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400B2C0);
 
@@ -1474,7 +1550,7 @@ unsigned ProcessorCore::_handleModiW(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleModiUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModiUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400BAC0);
 
@@ -1488,7 +1564,7 @@ unsigned ProcessorCore::_handleModiUW(uint32_t instruction) throws(ProgramInterr
     return 32;
 }
 
-unsigned ProcessorCore::_handleModiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x18000000);
 
@@ -1502,7 +1578,7 @@ unsigned ProcessorCore::_handleModiL(uint32_t instruction) throws(ProgramInterru
     return 32;
 }
 
-unsigned ProcessorCore::_handleModiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleModiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x38000000);
 
@@ -1518,7 +1594,7 @@ unsigned ProcessorCore::_handleModiUL(uint32_t instruction) throws(ProgramInterr
 
 //////////
 //  Base (boolean)
-unsigned ProcessorCore::_handleAndB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAndB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000248);
 
@@ -1532,7 +1608,7 @@ unsigned ProcessorCore::_handleAndB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAndUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAndUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000249);
 
@@ -1546,7 +1622,7 @@ unsigned ProcessorCore::_handleAndUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAndH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAndH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400024A);
 
@@ -1560,7 +1636,7 @@ unsigned ProcessorCore::_handleAndH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAndUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAndUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400024B);
 
@@ -1574,7 +1650,7 @@ unsigned ProcessorCore::_handleAndUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAndW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAndW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400024C);
 
@@ -1588,7 +1664,7 @@ unsigned ProcessorCore::_handleAndW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAndUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAndUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400024D);
 
@@ -1602,7 +1678,7 @@ unsigned ProcessorCore::_handleAndUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAndL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAndL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400024E);
 
@@ -1616,7 +1692,7 @@ unsigned ProcessorCore::_handleAndL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleOrB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOrB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000250);
 
@@ -1630,7 +1706,7 @@ unsigned ProcessorCore::_handleOrB(uint32_t instruction) throws(ProgramInterrupt
     return 1;
 }
 
-unsigned ProcessorCore::_handleOrUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOrUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000251);
 
@@ -1644,7 +1720,7 @@ unsigned ProcessorCore::_handleOrUB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleOrH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOrH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000252);
 
@@ -1658,7 +1734,7 @@ unsigned ProcessorCore::_handleOrH(uint32_t instruction) throws(ProgramInterrupt
     return 1;
 }
 
-unsigned ProcessorCore::_handleOrUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOrUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000253);
 
@@ -1672,7 +1748,7 @@ unsigned ProcessorCore::_handleOrUH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleOrW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOrW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000254);
 
@@ -1686,7 +1762,7 @@ unsigned ProcessorCore::_handleOrW(uint32_t instruction) throws(ProgramInterrupt
     return 1;
 }
 
-unsigned ProcessorCore::_handleOrUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOrUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000255);
 
@@ -1700,7 +1776,7 @@ unsigned ProcessorCore::_handleOrUW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleOrL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOrL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000256);
 
@@ -1714,7 +1790,7 @@ unsigned ProcessorCore::_handleOrL(uint32_t instruction) throws(ProgramInterrupt
     return 1;
 }
 
-unsigned ProcessorCore::_handleXorB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleXorB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000258);
 
@@ -1728,7 +1804,7 @@ unsigned ProcessorCore::_handleXorB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleXorUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleXorUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000259);
 
@@ -1742,7 +1818,7 @@ unsigned ProcessorCore::_handleXorUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleXorH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleXorH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400025A);
 
@@ -1756,7 +1832,7 @@ unsigned ProcessorCore::_handleXorH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleXorUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleXorUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400025B);
 
@@ -1770,7 +1846,7 @@ unsigned ProcessorCore::_handleXorUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleXorW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleXorW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400025C);
 
@@ -1784,7 +1860,7 @@ unsigned ProcessorCore::_handleXorW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleXorUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleXorUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400025D);
 
@@ -1798,7 +1874,7 @@ unsigned ProcessorCore::_handleXorUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleXorL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleXorL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400025E);
 
@@ -1812,7 +1888,7 @@ unsigned ProcessorCore::_handleXorL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleImplB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleImplB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000287);
 
@@ -1826,7 +1902,7 @@ unsigned ProcessorCore::_handleImplB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleImplUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleImplUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400028F);
 
@@ -1840,7 +1916,7 @@ unsigned ProcessorCore::_handleImplUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleImplH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleImplH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000297);
 
@@ -1854,7 +1930,7 @@ unsigned ProcessorCore::_handleImplH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleImplUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleImplUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400029F);
 
@@ -1868,7 +1944,7 @@ unsigned ProcessorCore::_handleImplUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleImplW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleImplW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002A7);
 
@@ -1882,7 +1958,7 @@ unsigned ProcessorCore::_handleImplW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleImplUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleImplUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002AF);
 
@@ -1896,7 +1972,7 @@ unsigned ProcessorCore::_handleImplUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleImplL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleImplL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x040002B7);
 
@@ -1910,7 +1986,7 @@ unsigned ProcessorCore::_handleImplL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAndiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAndiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x60000000);
 
@@ -1924,7 +2000,7 @@ unsigned ProcessorCore::_handleAndiL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleOriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOriL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x64000000);
 
@@ -1938,7 +2014,7 @@ unsigned ProcessorCore::_handleOriL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleXoriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleXoriL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x68000000);
 
@@ -1952,7 +2028,7 @@ unsigned ProcessorCore::_handleXoriL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleImpliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleImpliL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x6C000000);
 
@@ -1966,7 +2042,7 @@ unsigned ProcessorCore::_handleImpliL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleNotB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNotB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000260);
 
@@ -1976,6 +2052,7 @@ unsigned ProcessorCore::_handleNotB(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeXorSigned<_Byte>(_r[r1], _r[r2], UINT64_C(0xFFFFFFFFFFFFFFFF));
@@ -1983,7 +2060,7 @@ unsigned ProcessorCore::_handleNotB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleNotUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNotUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000261);
 
@@ -1993,6 +2070,7 @@ unsigned ProcessorCore::_handleNotUB(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeXorUnsigned<_Byte>(_r[r1], _r[r2], UINT64_C(0xFFFFFFFFFFFFFFFF));
@@ -2000,7 +2078,7 @@ unsigned ProcessorCore::_handleNotUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleNotH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNotH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000262);
 
@@ -2010,6 +2088,7 @@ unsigned ProcessorCore::_handleNotH(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeXorSigned<_HalfWord>(_r[r1], _r[r2], UINT64_C(0xFFFFFFFFFFFFFFFF));
@@ -2017,7 +2096,7 @@ unsigned ProcessorCore::_handleNotH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleNotUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNotUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000263);
 
@@ -2027,6 +2106,7 @@ unsigned ProcessorCore::_handleNotUH(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeXorUnsigned<_HalfWord>(_r[r1], _r[r2], UINT64_C(0xFFFFFFFFFFFFFFFF));
@@ -2034,7 +2114,7 @@ unsigned ProcessorCore::_handleNotUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleNotW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNotW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000264);
 
@@ -2044,6 +2124,7 @@ unsigned ProcessorCore::_handleNotW(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeXorSigned<_Word>(_r[r1], _r[r2], UINT64_C(0xFFFFFFFFFFFFFFFF));
@@ -2051,7 +2132,7 @@ unsigned ProcessorCore::_handleNotW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleNotUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNotUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000265);
 
@@ -2061,6 +2142,7 @@ unsigned ProcessorCore::_handleNotUW(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeXorUnsigned<_Word>(_r[r1], _r[r2], UINT64_C(0xFFFFFFFFFFFFFFFF));
@@ -2068,7 +2150,7 @@ unsigned ProcessorCore::_handleNotUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleNotL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNotL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000266);
 
@@ -2078,6 +2160,7 @@ unsigned ProcessorCore::_handleNotL(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeXorUnsigned<_LongWord>(_r[r1], _r[r2], UINT64_C(0xFFFFFFFFFFFFFFFF));
@@ -2087,7 +2170,7 @@ unsigned ProcessorCore::_handleNotL(uint32_t instruction) throws(ProgramInterrup
 
 //////////
 //  BASE (shifts)
-unsigned ProcessorCore::_handleShlB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShlB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000300);
 
@@ -2101,7 +2184,7 @@ unsigned ProcessorCore::_handleShlB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleShlUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShlUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000318);
 
@@ -2115,7 +2198,7 @@ unsigned ProcessorCore::_handleShlUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShlH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShlH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000308);
 
@@ -2129,7 +2212,7 @@ unsigned ProcessorCore::_handleShlH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleShlUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShlUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000320);
 
@@ -2143,7 +2226,7 @@ unsigned ProcessorCore::_handleShlUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShlW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShlW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000310);
 
@@ -2157,7 +2240,7 @@ unsigned ProcessorCore::_handleShlW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleShlUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShlUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000328);
 
@@ -2171,7 +2254,7 @@ unsigned ProcessorCore::_handleShlUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShlL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShlL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000330);
 
@@ -2185,7 +2268,7 @@ unsigned ProcessorCore::_handleShlL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleShrB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShrB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000301);
 
@@ -2199,7 +2282,7 @@ unsigned ProcessorCore::_handleShrB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleShrUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShrUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000319);
 
@@ -2213,7 +2296,7 @@ unsigned ProcessorCore::_handleShrUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShrH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShrH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000309);
 
@@ -2227,7 +2310,7 @@ unsigned ProcessorCore::_handleShrH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleShrUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShrUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000321);
 
@@ -2241,7 +2324,7 @@ unsigned ProcessorCore::_handleShrUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShrW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShrW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000311);
 
@@ -2255,7 +2338,7 @@ unsigned ProcessorCore::_handleShrW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleShrUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShrUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000329);
 
@@ -2269,7 +2352,7 @@ unsigned ProcessorCore::_handleShrUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShrL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShrL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000331);
 
@@ -2283,7 +2366,7 @@ unsigned ProcessorCore::_handleShrL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAslB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAslB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000302);
 
@@ -2297,7 +2380,7 @@ unsigned ProcessorCore::_handleAslB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAslUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAslUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400031A);
 
@@ -2311,7 +2394,7 @@ unsigned ProcessorCore::_handleAslUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAslH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAslH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400030A);
 
@@ -2325,7 +2408,7 @@ unsigned ProcessorCore::_handleAslH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAslUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAslUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000322);
 
@@ -2339,7 +2422,7 @@ unsigned ProcessorCore::_handleAslUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAslW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAslW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000312);
 
@@ -2353,7 +2436,7 @@ unsigned ProcessorCore::_handleAslW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAslUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAslUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400032A);
 
@@ -2367,7 +2450,7 @@ unsigned ProcessorCore::_handleAslUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAslL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAslL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000332);
 
@@ -2381,7 +2464,7 @@ unsigned ProcessorCore::_handleAslL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsrB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsrB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000303);
 
@@ -2395,7 +2478,7 @@ unsigned ProcessorCore::_handleAsrB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsrUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsrUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400031B);
 
@@ -2409,7 +2492,7 @@ unsigned ProcessorCore::_handleAsrUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsrH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsrH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400030B);
 
@@ -2423,7 +2506,7 @@ unsigned ProcessorCore::_handleAsrH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsrUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsrUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000323);
 
@@ -2437,7 +2520,7 @@ unsigned ProcessorCore::_handleAsrUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsrW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsrW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000313);
 
@@ -2451,7 +2534,7 @@ unsigned ProcessorCore::_handleAsrW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsrUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsrUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400032B);
 
@@ -2465,7 +2548,7 @@ unsigned ProcessorCore::_handleAsrUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsrL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsrL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000333);
 
@@ -2479,7 +2562,7 @@ unsigned ProcessorCore::_handleAsrL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleRolB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRolB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000304);
 
@@ -2493,7 +2576,7 @@ unsigned ProcessorCore::_handleRolB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleRolUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRolUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400031C);
 
@@ -2507,7 +2590,7 @@ unsigned ProcessorCore::_handleRolUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRolH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRolH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400030C);
 
@@ -2521,7 +2604,7 @@ unsigned ProcessorCore::_handleRolH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleRolUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRolUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000324);
 
@@ -2535,7 +2618,7 @@ unsigned ProcessorCore::_handleRolUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRolW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRolW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000314);
 
@@ -2549,7 +2632,7 @@ unsigned ProcessorCore::_handleRolW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleRolUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRolUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400032C);
 
@@ -2563,7 +2646,7 @@ unsigned ProcessorCore::_handleRolUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRolL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRolL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000334);
 
@@ -2577,7 +2660,7 @@ unsigned ProcessorCore::_handleRolL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleRorB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRorB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000305);
 
@@ -2591,7 +2674,7 @@ unsigned ProcessorCore::_handleRorB(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleRorUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRorUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400031D);
 
@@ -2605,7 +2688,7 @@ unsigned ProcessorCore::_handleRorUB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRorH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRorH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400030D);
 
@@ -2619,7 +2702,7 @@ unsigned ProcessorCore::_handleRorH(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleRorUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRorUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000325);
 
@@ -2633,7 +2716,7 @@ unsigned ProcessorCore::_handleRorUH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRorW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRorW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000315);
 
@@ -2647,7 +2730,7 @@ unsigned ProcessorCore::_handleRorW(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleRorUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRorUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400032D);
 
@@ -2661,7 +2744,7 @@ unsigned ProcessorCore::_handleRorUW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRorL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRorL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000335);
 
@@ -2675,7 +2758,7 @@ unsigned ProcessorCore::_handleRorL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleShliB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShliB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04000000);
 
@@ -2689,7 +2772,7 @@ unsigned ProcessorCore::_handleShliB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShliUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShliUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04000800);
 
@@ -2703,7 +2786,7 @@ unsigned ProcessorCore::_handleShliUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleShliH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShliH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04001000);
 
@@ -2717,7 +2800,7 @@ unsigned ProcessorCore::_handleShliH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShliUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShliUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04001800);
 
@@ -2731,7 +2814,7 @@ unsigned ProcessorCore::_handleShliUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleShliW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShliW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04002000);
 
@@ -2745,7 +2828,7 @@ unsigned ProcessorCore::_handleShliW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShliUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShliUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04002800);
 
@@ -2759,7 +2842,7 @@ unsigned ProcessorCore::_handleShliUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleShliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShliL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04003000);
 
@@ -2773,7 +2856,7 @@ unsigned ProcessorCore::_handleShliL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShriB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShriB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04004000);
 
@@ -2787,7 +2870,7 @@ unsigned ProcessorCore::_handleShriB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShriUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShriUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04004800);
 
@@ -2801,7 +2884,7 @@ unsigned ProcessorCore::_handleShriUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleShriH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShriH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04005000);
 
@@ -2815,7 +2898,7 @@ unsigned ProcessorCore::_handleShriH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShriUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShriUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04005800);
 
@@ -2829,7 +2912,7 @@ unsigned ProcessorCore::_handleShriUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleShriW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShriW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04006000);
 
@@ -2843,7 +2926,7 @@ unsigned ProcessorCore::_handleShriW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleShriUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShriUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04006800);
 
@@ -2857,7 +2940,7 @@ unsigned ProcessorCore::_handleShriUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleShriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleShriL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04007000);
 
@@ -2871,7 +2954,7 @@ unsigned ProcessorCore::_handleShriL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsliB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsliB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04008000);
 
@@ -2885,7 +2968,7 @@ unsigned ProcessorCore::_handleAsliB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsliUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsliUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04008800);
 
@@ -2899,7 +2982,7 @@ unsigned ProcessorCore::_handleAsliUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsliH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsliH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04009000);
 
@@ -2913,7 +2996,7 @@ unsigned ProcessorCore::_handleAsliH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsliUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsliUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04009800);
 
@@ -2927,7 +3010,7 @@ unsigned ProcessorCore::_handleAsliUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsliW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsliW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400A000);
 
@@ -2941,7 +3024,7 @@ unsigned ProcessorCore::_handleAsliW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsliUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsliUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400A800);
 
@@ -2955,7 +3038,7 @@ unsigned ProcessorCore::_handleAsliUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsliL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400B000);
 
@@ -2969,7 +3052,7 @@ unsigned ProcessorCore::_handleAsliL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsriB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsriB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400C000);
 
@@ -2983,7 +3066,7 @@ unsigned ProcessorCore::_handleAsriB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsriUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsriUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400C800);
 
@@ -2997,7 +3080,7 @@ unsigned ProcessorCore::_handleAsriUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsriH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsriH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400D000);
 
@@ -3011,7 +3094,7 @@ unsigned ProcessorCore::_handleAsriH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsriUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsriUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400D800);
 
@@ -3025,7 +3108,7 @@ unsigned ProcessorCore::_handleAsriUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsriW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsriW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400E000);
 
@@ -3039,7 +3122,7 @@ unsigned ProcessorCore::_handleAsriW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsriUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsriUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400E800);
 
@@ -3053,7 +3136,7 @@ unsigned ProcessorCore::_handleAsriUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleAsriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAsriL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400F000);
 
@@ -3067,7 +3150,7 @@ unsigned ProcessorCore::_handleAsriL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoliB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoliB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04000040);
 
@@ -3081,7 +3164,7 @@ unsigned ProcessorCore::_handleRoliB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoliUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoliUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04000840);
 
@@ -3095,7 +3178,7 @@ unsigned ProcessorCore::_handleRoliUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoliH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoliH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04001040);
 
@@ -3109,7 +3192,7 @@ unsigned ProcessorCore::_handleRoliH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoliUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoliUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04001840);
 
@@ -3123,7 +3206,7 @@ unsigned ProcessorCore::_handleRoliUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoliW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoliW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04002040);
 
@@ -3137,7 +3220,7 @@ unsigned ProcessorCore::_handleRoliW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoliUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoliUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04002840);
 
@@ -3151,7 +3234,7 @@ unsigned ProcessorCore::_handleRoliUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoliL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04003040);
 
@@ -3165,7 +3248,7 @@ unsigned ProcessorCore::_handleRoliL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoriB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoriB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04004040);
 
@@ -3179,7 +3262,7 @@ unsigned ProcessorCore::_handleRoriB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoriUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoriUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04004840);
 
@@ -3193,7 +3276,7 @@ unsigned ProcessorCore::_handleRoriUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoriH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoriH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04005040);
 
@@ -3207,7 +3290,7 @@ unsigned ProcessorCore::_handleRoriH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoriUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoriUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04005840);
 
@@ -3221,7 +3304,7 @@ unsigned ProcessorCore::_handleRoriUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoriW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoriW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04006040);
 
@@ -3235,7 +3318,7 @@ unsigned ProcessorCore::_handleRoriW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoriUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoriUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04006840);
 
@@ -3249,7 +3332,7 @@ unsigned ProcessorCore::_handleRoriUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleRoriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRoriL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04007040);
 
@@ -3265,7 +3348,7 @@ unsigned ProcessorCore::_handleRoriL(uint32_t instruction) throws(ProgramInterru
 
 //////////
 //  BASE (bit manipulation)
-unsigned ProcessorCore::_handleClz(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleClz(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000276);
 
@@ -3275,6 +3358,7 @@ unsigned ProcessorCore::_handleClz(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = Alu::countLeadingZeroes(_r[r2]);
@@ -3282,7 +3366,7 @@ unsigned ProcessorCore::_handleClz(uint32_t instruction) throws(ProgramInterrupt
     return 1;
 }
 
-unsigned ProcessorCore::_handleCtz(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCtz(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000277);
 
@@ -3292,6 +3376,7 @@ unsigned ProcessorCore::_handleCtz(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = Alu::countTailingZeroes(_r[r2]);
@@ -3299,7 +3384,7 @@ unsigned ProcessorCore::_handleCtz(uint32_t instruction) throws(ProgramInterrupt
     return 1;
 }
 
-unsigned ProcessorCore::_handleClo(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleClo(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400027E);
 
@@ -3309,6 +3394,7 @@ unsigned ProcessorCore::_handleClo(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = Alu::countLeadingOnes(_r[r2]);
@@ -3316,7 +3402,7 @@ unsigned ProcessorCore::_handleClo(uint32_t instruction) throws(ProgramInterrupt
     return 1;
 }
 
-unsigned ProcessorCore::_handleCto(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCto(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400027F);
 
@@ -3326,6 +3412,7 @@ unsigned ProcessorCore::_handleCto(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = Alu::countTailingOnes(_r[r2]);
@@ -3333,7 +3420,7 @@ unsigned ProcessorCore::_handleCto(uint32_t instruction) throws(ProgramInterrupt
     return 1;
 }
 
-unsigned ProcessorCore::_handleBfeL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBfeL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007C0) == 0x04000100 ||
             (instruction & 0xFC0007C0) == 0x04000140);
@@ -3349,7 +3436,7 @@ unsigned ProcessorCore::_handleBfeL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleBfeUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBfeUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007C0) == 0x04000180 ||
             (instruction & 0xFC0007C0) == 0x040001C0);
@@ -3365,7 +3452,7 @@ unsigned ProcessorCore::_handleBfeUL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleBfiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBfiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007C0) == 0x04000080 ||
             (instruction & 0xFC0007C0) == 0x040000C0);
@@ -3381,7 +3468,7 @@ unsigned ProcessorCore::_handleBfiL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleBrevB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBrevB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000268);
 
@@ -3391,6 +3478,7 @@ unsigned ProcessorCore::_handleBrevB(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeBrevSigned<_Byte>(_r[r1], _r[r2]);
@@ -3398,7 +3486,7 @@ unsigned ProcessorCore::_handleBrevB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleBrevUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBrevUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000269);
 
@@ -3408,6 +3496,7 @@ unsigned ProcessorCore::_handleBrevUB(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeBrevUnsigned<_Byte>(_r[r1], _r[r2]);
@@ -3415,7 +3504,7 @@ unsigned ProcessorCore::_handleBrevUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleBrevH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBrevH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400026A);
 
@@ -3425,6 +3514,7 @@ unsigned ProcessorCore::_handleBrevH(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeBrevSigned<_HalfWord>(_r[r1], _r[r2]);
@@ -3432,7 +3522,7 @@ unsigned ProcessorCore::_handleBrevH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleBrevUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBrevUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400026B);
 
@@ -3442,6 +3532,7 @@ unsigned ProcessorCore::_handleBrevUH(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeBrevUnsigned<_HalfWord>(_r[r1], _r[r2]);
@@ -3449,7 +3540,7 @@ unsigned ProcessorCore::_handleBrevUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleBrevW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBrevW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400026C);
 
@@ -3459,6 +3550,7 @@ unsigned ProcessorCore::_handleBrevW(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeBrevSigned<_Word>(_r[r1], _r[r2]);
@@ -3466,7 +3558,7 @@ unsigned ProcessorCore::_handleBrevW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleBrevUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBrevUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400026D);
 
@@ -3476,6 +3568,7 @@ unsigned ProcessorCore::_handleBrevUW(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeBrevUnsigned<_Word>(_r[r1], _r[r2]);
@@ -3483,7 +3576,7 @@ unsigned ProcessorCore::_handleBrevUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleBrevL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBrevL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400026E);
 
@@ -3493,6 +3586,7 @@ unsigned ProcessorCore::_handleBrevL(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _executeBrevUnsigned<_LongWord>(_r[r1], _r[r2]);
@@ -3502,7 +3596,7 @@ unsigned ProcessorCore::_handleBrevL(uint32_t instruction) throws(ProgramInterru
 
 //////////
 //  BASE (conversions)
-unsigned ProcessorCore::_handleCvtBL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtBL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000241);
 
@@ -3512,6 +3606,7 @@ unsigned ProcessorCore::_handleCvtBL(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     bool overflow = false;
@@ -3521,7 +3616,7 @@ unsigned ProcessorCore::_handleCvtBL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtUBL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtUBL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000242);
 
@@ -3531,6 +3626,7 @@ unsigned ProcessorCore::_handleCvtUBL(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     bool overflow = false;
@@ -3540,7 +3636,7 @@ unsigned ProcessorCore::_handleCvtUBL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtHL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtHL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000243);
 
@@ -3550,6 +3646,7 @@ unsigned ProcessorCore::_handleCvtHL(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     bool overflow = false;
@@ -3559,7 +3656,7 @@ unsigned ProcessorCore::_handleCvtHL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtUHL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtUHL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000244);
 
@@ -3569,6 +3666,7 @@ unsigned ProcessorCore::_handleCvtUHL(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     bool overflow = false;
@@ -3578,7 +3676,7 @@ unsigned ProcessorCore::_handleCvtUHL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtWL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtWL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000245);
 
@@ -3588,6 +3686,7 @@ unsigned ProcessorCore::_handleCvtWL(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     bool overflow = false;
@@ -3597,7 +3696,7 @@ unsigned ProcessorCore::_handleCvtWL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtUWL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtUWL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000246);
 
@@ -3607,6 +3706,7 @@ unsigned ProcessorCore::_handleCvtUWL(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     bool overflow = false;
@@ -3618,7 +3718,7 @@ unsigned ProcessorCore::_handleCvtUWL(uint32_t instruction) throws(ProgramInterr
 
 //////////
 //  BASE (comparison)
-unsigned ProcessorCore::_handleSeqL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSeqL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000270);
 
@@ -3632,7 +3732,7 @@ unsigned ProcessorCore::_handleSeqL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSneL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSneL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000271);
 
@@ -3646,7 +3746,7 @@ unsigned ProcessorCore::_handleSneL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSltL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSltL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000272);
 
@@ -3660,7 +3760,7 @@ unsigned ProcessorCore::_handleSltL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSleL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSleL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000273);
 
@@ -3674,7 +3774,7 @@ unsigned ProcessorCore::_handleSleL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgtL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgtL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000274);
 
@@ -3688,7 +3788,7 @@ unsigned ProcessorCore::_handleSgtL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgeL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgeL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000275);
 
@@ -3702,7 +3802,7 @@ unsigned ProcessorCore::_handleSgeL(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSltUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSltUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400027A);
 
@@ -3716,7 +3816,7 @@ unsigned ProcessorCore::_handleSltUL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSleUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSleUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400027B);
 
@@ -3730,7 +3830,7 @@ unsigned ProcessorCore::_handleSleUL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgtUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgtUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400027C);
 
@@ -3744,7 +3844,7 @@ unsigned ProcessorCore::_handleSgtUL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgeUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgeUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400027D);
 
@@ -3758,7 +3858,7 @@ unsigned ProcessorCore::_handleSgeUL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSeqiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSeqiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x40000000);
 
@@ -3772,7 +3872,7 @@ unsigned ProcessorCore::_handleSeqiL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSneiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSneiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x44000000);
 
@@ -3786,7 +3886,7 @@ unsigned ProcessorCore::_handleSneiL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSltiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSltiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x48000000);
 
@@ -3800,7 +3900,7 @@ unsigned ProcessorCore::_handleSltiL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSleiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSleiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x4C000000);
 
@@ -3814,7 +3914,7 @@ unsigned ProcessorCore::_handleSleiL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgtiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgtiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x50000000);
 
@@ -3828,7 +3928,7 @@ unsigned ProcessorCore::_handleSgtiL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgeiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgeiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x54000000);
 
@@ -3842,7 +3942,7 @@ unsigned ProcessorCore::_handleSgeiL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSltiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSltiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x58000000);
 
@@ -3856,7 +3956,7 @@ unsigned ProcessorCore::_handleSltiUL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleSleiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSleiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x5C000000);
 
@@ -3870,7 +3970,7 @@ unsigned ProcessorCore::_handleSleiUL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgtiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgtiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x78000000);
 
@@ -3884,7 +3984,7 @@ unsigned ProcessorCore::_handleSgtiUL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgeiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgeiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x7C000000);
 
@@ -3900,7 +4000,7 @@ unsigned ProcessorCore::_handleSgeiUL(uint32_t instruction) throws(ProgramInterr
 
 //////////
 //  BASE (load/store)
-unsigned ProcessorCore::_handleLB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleLB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x80000000);
 
@@ -3909,12 +4009,17 @@ unsigned ProcessorCore::_handleLB(uint32_t instruction) throws(ProgramInterrupt,
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _r[r1] = Alu::signExtendInt8(_loadByte(_r[r2] + imm));
+    uint8_t value = 0;
+    if (!_loadByte(_r[r2] + imm, value))
+    {
+        return 1;
+    }
+    _r[r1] = Alu::signExtendInt8(value);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleLUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleLUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x84000000);
 
@@ -3923,12 +4028,18 @@ unsigned ProcessorCore::_handleLUB(uint32_t instruction) throws(ProgramInterrupt
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _r[r1] = Alu::zeroExtendInt8(_loadByte(_r[r2] + imm));
+    uint8_t value = 0;
+    if (!_loadByte(_r[r2] + imm, value))
+    {
+        return 1;
+    }
+    _r[r1] = Alu::zeroExtendInt8(value);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleLH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleLH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x88000000);
 
@@ -3937,12 +4048,18 @@ unsigned ProcessorCore::_handleLH(uint32_t instruction) throws(ProgramInterrupt,
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _r[r1] = Alu::signExtendInt16(_loadHalfWord(_r[r2] + imm));
+    uint16_t value = 0;
+    if (!_loadHalfWord<GuestByteOrder>(_r[r2] + imm, value))
+    {
+        return 1;
+    }
+    _r[r1] = Alu::signExtendInt16(value);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleLUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleLUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x8C000000);
 
@@ -3951,12 +4068,18 @@ unsigned ProcessorCore::_handleLUH(uint32_t instruction) throws(ProgramInterrupt
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _r[r1] = Alu::zeroExtendInt16(_loadHalfWord(_r[r2] + imm));
+    uint16_t value = 0;
+    if (!_loadHalfWord<GuestByteOrder>(_r[r2] + imm, value))
+    {
+        return 1;
+    }
+    _r[r1] = Alu::zeroExtendInt16(value);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleLW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleLW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x90000000);
 
@@ -3965,12 +4088,18 @@ unsigned ProcessorCore::_handleLW(uint32_t instruction) throws(ProgramInterrupt,
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _r[r1] = Alu::signExtendInt32(_loadWord(_r[r2] + imm));
+    uint32_t value = 0;
+    if (!_loadWord<GuestByteOrder>(_r[r2] + imm, value))
+    {
+        return 1;
+    }
+    _r[r1] = Alu::signExtendInt32(value);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleLUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleLUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x94000000);
 
@@ -3979,12 +4108,18 @@ unsigned ProcessorCore::_handleLUW(uint32_t instruction) throws(ProgramInterrupt
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _r[r1] = Alu::zeroExtendInt32(_loadWord(_r[r2] + imm));
+    uint32_t value = 0;
+    if (!_loadWord<GuestByteOrder>(_r[r2] + imm, value))
+    {
+        return 1;
+    }
+    _r[r1] = Alu::zeroExtendInt32(value);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleLL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleLL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x98000000);
 
@@ -3993,12 +4128,18 @@ unsigned ProcessorCore::_handleLL(uint32_t instruction) throws(ProgramInterrupt,
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _r[r1] = _loadLongWord(_r[r2] + imm);
+    uint64_t value = 0;
+    if (!_loadLongWord<GuestByteOrder>(_r[r2] + imm, value))
+    {
+        return 1;
+    }
+    _r[r1] = value;
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleXchg(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleXchg(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x9C000000);
 
@@ -4006,18 +4147,18 @@ unsigned ProcessorCore::_handleXchg(uint32_t instruction) throws(ProgramInterrup
     unsigned r1 = (instruction >> 21) & 0x1F;
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
-    //  Execute, locking the memory bus
+    //  Execute
+    uint64_t value = 0;
+    if (!_exchangeLongWord<GuestByteOrder>(_r[r2] + imm, _r[r1], value))
     {
-        QMutexLocker lock(_processor->_memoryBus);
-        uint64_t value = _loadLongWord(_r[r2] + imm);
-        _storeLongWord(_r[r2] + imm, _r[r1]);
-        _r[r1] = value;
+        return 1;
     }
+    _r[r1] = value;
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleSB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xA0000000);
 
@@ -4026,12 +4167,16 @@ unsigned ProcessorCore::_handleSB(uint32_t instruction) throws(ProgramInterrupt,
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _storeByte(_r[r2] + imm, static_cast<uint8_t>(_r[r1]));
+    if (!_storeByte(_r[r2] + imm, static_cast<uint8_t>(_r[r1])))
+    {
+        return 1;
+    }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleSH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleSH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xA4000000);
 
@@ -4040,12 +4185,16 @@ unsigned ProcessorCore::_handleSH(uint32_t instruction) throws(ProgramInterrupt,
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _storeHalfWord(_r[r2] + imm, static_cast<uint16_t>(_r[r1]));
+    if (!_storeHalfWord<GuestByteOrder>(_r[r2] + imm, static_cast<uint16_t>(_r[r1])))
+    {
+        return 1;
+    }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleSW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleSW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xA8000000);
 
@@ -4054,12 +4203,16 @@ unsigned ProcessorCore::_handleSW(uint32_t instruction) throws(ProgramInterrupt,
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _storeWord(_r[r2] + imm, static_cast<uint32_t>(_r[r1]));
+    if (!_storeWord<GuestByteOrder>(_r[r2] + imm, static_cast<uint32_t>(_r[r1])))
+    {
+        return 1;
+    }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleSL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleSL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xAC000000);
 
@@ -4068,12 +4221,16 @@ unsigned ProcessorCore::_handleSL(uint32_t instruction) throws(ProgramInterrupt,
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _storeLongWord(_r[r2] + imm, _r[r1]);
+    if (!_storeLongWord<GuestByteOrder>(_r[r2] + imm, _r[r1]))
+    {
+        return 1;
+    }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleLir(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleLir(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x24000000);
 
@@ -4081,37 +4238,35 @@ unsigned ProcessorCore::_handleLir(uint32_t instruction) throws(ProgramInterrupt
     unsigned r1 = (instruction >> 21) & 0x1F;
     uint64_t imm = Alu::signExtendInt21(instruction);
     //  Execute
-    _r[r1] = _fetchLongWord(_r[_IpRegister] + (imm << 2));
+    uint64_t value = 0;
+    if (!_fetchLongWord<GuestByteOrder>(_r[_IpRegister] + (imm << 2), value))
+    {
+        return 1;
+    }
+    _r[r1] = value;
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleLdm(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleLdm(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x70000000);
 
-    static const unsigned LoadMap[21] =
-    {
-        1, 2, 3, 4, //  $a0..$a3
-        13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, //  $s0..$s12
-        26,     //  $gp
-        28,     //  $fp
-        29,     //  $dp
-        30      //  $ra
-    };
-
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
 
     if (r1 == 31)
     {   //  OOPS! Can't use $ip as a base register
-        throw ProgramInterrupt::OPERAND;
+        _raiseProgramInterrupt(ProgramInterrupt::OPERAND);
+        return 1;
     }
     for (int i = 0; i < 21; i++)
     {   //  OOPS! Can't use loaded register as a base register
-        if ((instruction & (UINT32_C(0x01) << i)) != 0 && LoadMap[i] == r1)
+        if ((instruction & (UINT32_C(0x01) << i)) != 0 && _MultipleTransferRegisters[i] == r1)
         {
-            throw ProgramInterrupt::OPERAND;
+            _raiseProgramInterrupt(ProgramInterrupt::OPERAND);
+            return 1;
         }
     }
 
@@ -4123,7 +4278,12 @@ unsigned ProcessorCore::_handleLdm(uint32_t instruction) throws(ProgramInterrupt
         {   //  Load this one
             uint64_t address = _r[r1] + (numLoadedRegisters << 3);
             numLoadedRegisters++;
-            _r[LoadMap[i]] = _loadLongWord(address);
+            uint64_t value = 0;
+            if (!_loadLongWord<GuestByteOrder>(address, value))
+            {
+                return 1 + numLoadedRegisters;
+            }
+            _r[_MultipleTransferRegisters[i]] = value;
         }
     }
     _r[r1] += (numLoadedRegisters << 3);
@@ -4132,32 +4292,25 @@ unsigned ProcessorCore::_handleLdm(uint32_t instruction) throws(ProgramInterrupt
     return 1 + numLoadedRegisters;
 }
 
-unsigned ProcessorCore::_handleStm(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleStm(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x74000000);
 
-    static const unsigned StoreMap[21] =
-    {
-        1, 2, 3, 4, //  $a0..$a3
-        13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, //  $s0..$s12
-        26,     //  $gp
-        28,     //  $fp
-        29,     //  $dp
-        30      //  $ra
-    };
-
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
 
     if (r1 == 31)
     {   //  OOPS! Can't use $ip as a base register
-        throw ProgramInterrupt::OPERAND;
+        _raiseProgramInterrupt(ProgramInterrupt::OPERAND);
+        return 1;
     }
     for (int i = 0; i < 21; i++)
     {   //  OOPS! Can't use stored register as a base register
-        if ((instruction & (UINT32_C(0x01) << i)) != 0 && StoreMap[i] == r1)
+        if ((instruction & (UINT32_C(0x01) << i)) != 0 && _MultipleTransferRegisters[i] == r1)
         {
-            throw ProgramInterrupt::OPERAND;
+            _raiseProgramInterrupt(ProgramInterrupt::OPERAND);
+            return 1;
         }
     }
 
@@ -4169,7 +4322,10 @@ unsigned ProcessorCore::_handleStm(uint32_t instruction) throws(ProgramInterrupt
         {   //  Store this one
             numStoredRegisters++;
             uint64_t address = _r[r1] - (numStoredRegisters << 3);
-            _storeLongWord(address, _r[StoreMap[20 - i]]);
+            if (!_storeLongWord<GuestByteOrder>(address, _r[_MultipleTransferRegisters[20 - i]]))
+            {
+                return 1 + numStoredRegisters;
+            }
         }
     }
     _r[r1] -= (numStoredRegisters << 3);
@@ -4178,9 +4334,35 @@ unsigned ProcessorCore::_handleStm(uint32_t instruction) throws(ProgramInterrupt
     return 1 + numStoredRegisters;
 }
 
+//  Instantiations for both guest byte orders
+template unsigned ProcessorCore::_handleLH<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLH<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLUH<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLUH<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLW<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLW<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLUW<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLUW<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLL<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLL<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleXchg<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleXchg<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSH<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSH<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSW<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSW<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSL<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSL<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLir<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLir<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLdm<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLdm<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleStm<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleStm<ByteOrder::LittleEndian>(uint32_t instruction);
+
 //////////
 //  BASE (flow control)
-unsigned ProcessorCore::_handleJ(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleJ(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x1C000000);
 
@@ -4188,11 +4370,12 @@ unsigned ProcessorCore::_handleJ(uint32_t instruction) throws(ProgramInterrupt,
     uint64_t target = Alu::signExtendInt26(instruction);
     //  Execute
     _r[_IpRegister] += (target << 2);
+    _countPerformanceEvent(PerformanceEvent::TakenBranches);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleJal(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleJal(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x3C000000);
 
@@ -4201,11 +4384,12 @@ unsigned ProcessorCore::_handleJal(uint32_t instruction) throws(ProgramInterrupt
     //  Execute
     _r[_RaRegister] = _r[_IpRegister];
     _r[_IpRegister] += (target << 2);
+    _countPerformanceEvent(PerformanceEvent::TakenBranches);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleJr(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleJr(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC1FFFFF) == 0x04000278);
 
@@ -4213,11 +4397,12 @@ unsigned ProcessorCore::_handleJr(uint32_t instruction) throws(ProgramInterrupt,
     unsigned r1 = (instruction >> 21) & 0x1F;
     //  Execute
     _r[_IpRegister] = _r[r1];
+    _countPerformanceEvent(PerformanceEvent::TakenBranches);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleJalr(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleJalr(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC1FFFFF) == 0x04000279);
 
@@ -4226,11 +4411,12 @@ unsigned ProcessorCore::_handleJalr(uint32_t instruction) throws(ProgramInterrup
     //  Execute
     _r[_RaRegister] = _r[_IpRegister];
     _r[_IpRegister] = _r[r1];
+    _countPerformanceEvent(PerformanceEvent::TakenBranches);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBeqL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBeqL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xC0000000);
 
@@ -4242,12 +4428,13 @@ unsigned ProcessorCore::_handleBeqL(uint32_t instruction) throws(ProgramInterrup
     if (Alu::compareSigned(_r[r1], _r[r2]) == 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBneL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBneL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xC4000000);
 
@@ -4259,12 +4446,13 @@ unsigned ProcessorCore::_handleBneL(uint32_t instruction) throws(ProgramInterrup
     if (Alu::compareSigned(_r[r1], _r[r2]) != 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBltL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBltL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xC8000000);
 
@@ -4276,12 +4464,13 @@ unsigned ProcessorCore::_handleBltL(uint32_t instruction) throws(ProgramInterrup
     if (Alu::compareSigned(_r[r1], _r[r2]) < 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBleL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBleL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xCC000000);
 
@@ -4293,12 +4482,13 @@ unsigned ProcessorCore::_handleBleL(uint32_t instruction) throws(ProgramInterrup
     if (Alu::compareSigned(_r[r1], _r[r2]) <= 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgtL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgtL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xD0000000);
 
@@ -4310,12 +4500,13 @@ unsigned ProcessorCore::_handleBgtL(uint32_t instruction) throws(ProgramInterrup
     if (Alu::compareSigned(_r[r1], _r[r2]) > 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgeL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgeL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xD4000000);
 
@@ -4327,12 +4518,13 @@ unsigned ProcessorCore::_handleBgeL(uint32_t instruction) throws(ProgramInterrup
     if (Alu::compareSigned(_r[r1], _r[r2]) >= 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBltUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBltUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xD8000000);
 
@@ -4344,12 +4536,13 @@ unsigned ProcessorCore::_handleBltUL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareUnsigned(_r[r1], _r[r2]) < 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBleUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBleUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xDC000000);
 
@@ -4361,12 +4554,13 @@ unsigned ProcessorCore::_handleBleUL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareUnsigned(_r[r1], _r[r2]) <= 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgtUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgtUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xF8000000);
 
@@ -4378,12 +4572,13 @@ unsigned ProcessorCore::_handleBgtUL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareUnsigned(_r[r1], _r[r2]) > 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgeUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgeUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xFC000000);
 
@@ -4395,12 +4590,13 @@ unsigned ProcessorCore::_handleBgeUL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareUnsigned(_r[r1], _r[r2]) >= 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBeqiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBeqiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04008040);
 
@@ -4412,12 +4608,13 @@ unsigned ProcessorCore::_handleBeqiL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareSigned(_r[r1], imm) == 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBneiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBneiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04008840);
 
@@ -4429,12 +4626,13 @@ unsigned ProcessorCore::_handleBneiL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareSigned(_r[r1], imm) != 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBltiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBltiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04009040);
 
@@ -4446,12 +4644,13 @@ unsigned ProcessorCore::_handleBltiL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareSigned(_r[r1], imm) < 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBleiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBleiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x04009840);
 
@@ -4463,12 +4662,13 @@ unsigned ProcessorCore::_handleBleiL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareSigned(_r[r1], imm) <= 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgtiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgtiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400A040);
 
@@ -4480,12 +4680,13 @@ unsigned ProcessorCore::_handleBgtiL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareSigned(_r[r1], imm) > 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgeiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgeiL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400A840);
 
@@ -4497,12 +4698,13 @@ unsigned ProcessorCore::_handleBgeiL(uint32_t instruction) throws(ProgramInterru
     if (Alu::compareSigned(_r[r1], imm) >= 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBltiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBltiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400D040);
 
@@ -4514,12 +4716,13 @@ unsigned ProcessorCore::_handleBltiUL(uint32_t instruction) throws(ProgramInterr
     if (Alu::compareUnsigned(_r[r1], imm) < 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBleiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBleiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400D840);
 
@@ -4531,12 +4734,13 @@ unsigned ProcessorCore::_handleBleiUL(uint32_t instruction) throws(ProgramInterr
     if (Alu::compareUnsigned(_r[r1], imm) <= 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgtiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgtiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400E040);
 
@@ -4548,12 +4752,13 @@ unsigned ProcessorCore::_handleBgtiUL(uint32_t instruction) throws(ProgramInterr
     if (Alu::compareUnsigned(_r[r1], imm) > 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgeiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgeiUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFC0) == 0x0400E840);
 
@@ -4565,6 +4770,7 @@ unsigned ProcessorCore::_handleBgeiUL(uint32_t instruction) throws(ProgramInterr
     if (Alu::compareUnsigned(_r[r1], imm) >= 0)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
@@ -4572,7 +4778,7 @@ unsigned ProcessorCore::_handleBgeiUL(uint32_t instruction) throws(ProgramInterr
 
 //////////
 //  BASE (I/O)
-unsigned ProcessorCore::_handleInB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleInB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000228);
 
@@ -4582,11 +4788,13 @@ unsigned ProcessorCore::_handleInB(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4600,14 +4808,15 @@ unsigned ProcessorCore::_handleInB(uint32_t instruction) throws(ProgramInterrupt
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleInUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleInUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000230);
 
@@ -4617,11 +4826,13 @@ unsigned ProcessorCore::_handleInUB(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4635,14 +4846,15 @@ unsigned ProcessorCore::_handleInUB(uint32_t instruction) throws(ProgramInterrup
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleInH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleInH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000229);
 
@@ -4652,11 +4864,13 @@ unsigned ProcessorCore::_handleInH(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4670,14 +4884,15 @@ unsigned ProcessorCore::_handleInH(uint32_t instruction) throws(ProgramInterrupt
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleInUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleInUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000231);
 
@@ -4687,11 +4902,13 @@ unsigned ProcessorCore::_handleInUH(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4705,14 +4922,15 @@ unsigned ProcessorCore::_handleInUH(uint32_t instruction) throws(ProgramInterrup
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleInW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleInW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400022A);
 
@@ -4722,11 +4940,13 @@ unsigned ProcessorCore::_handleInW(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4740,14 +4960,15 @@ unsigned ProcessorCore::_handleInW(uint32_t instruction) throws(ProgramInterrupt
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleInUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleInUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000232);
 
@@ -4757,11 +4978,13 @@ unsigned ProcessorCore::_handleInUW(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4775,14 +4998,15 @@ unsigned ProcessorCore::_handleInUW(uint32_t instruction) throws(ProgramInterrup
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleInL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleInL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400022B);
 
@@ -4792,11 +5016,13 @@ unsigned ProcessorCore::_handleInL(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4809,14 +5035,15 @@ unsigned ProcessorCore::_handleInL(uint32_t instruction) throws(ProgramInterrupt
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleOutB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOutB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400022C);
 
@@ -4826,11 +5053,13 @@ unsigned ProcessorCore::_handleOutB(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4843,14 +5072,15 @@ unsigned ProcessorCore::_handleOutB(uint32_t instruction) throws(ProgramInterrup
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleOutH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOutH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400022D);
 
@@ -4860,11 +5090,13 @@ unsigned ProcessorCore::_handleOutH(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4877,14 +5109,15 @@ unsigned ProcessorCore::_handleOutH(uint32_t instruction) throws(ProgramInterrup
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleOutW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOutW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400022E);
 
@@ -4894,11 +5127,13 @@ unsigned ProcessorCore::_handleOutW(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4911,14 +5146,15 @@ unsigned ProcessorCore::_handleOutW(uint32_t instruction) throws(ProgramInterrup
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleOutL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleOutL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400022F);
 
@@ -4928,11 +5164,13 @@ unsigned ProcessorCore::_handleOutL(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4945,14 +5183,15 @@ unsigned ProcessorCore::_handleOutL(uint32_t instruction) throws(ProgramInterrup
             _r[_IpRegister] -= 4;
             return 1;
         }
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleTstp(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleTstp(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000220);
 
@@ -4962,11 +5201,13 @@ unsigned ProcessorCore::_handleTstp(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -4974,14 +5215,15 @@ unsigned ProcessorCore::_handleTstp(uint32_t instruction) throws(ProgramInterrup
     }
     catch (IoError ioError)
     {
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
     return _ioBusToProcessorClockRatio;
 }
 
-unsigned ProcessorCore::_handleSetp(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSetp(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000221);
 
@@ -4991,11 +5233,13 @@ unsigned ProcessorCore::_handleSetp(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     try
     {
@@ -5003,7 +5247,8 @@ unsigned ProcessorCore::_handleSetp(uint32_t instruction) throws(ProgramInterrup
     }
     catch (IoError ioError)
     {
-        _translateAndThrowIO(ioError);
+        _translateAndRaiseIO(ioError);
+        return 1;
     }
     //  Done
     Q_ASSERT(_ioBusToProcessorClockRatio > 0);
@@ -5012,7 +5257,7 @@ unsigned ProcessorCore::_handleSetp(uint32_t instruction) throws(ProgramInterrup
 
 //////////
 //  BASE (Misc)
-unsigned ProcessorCore::_handleHalt(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleHalt(uint32_t instruction)
 {
     Q_ASSERT(instruction == 0x04000219);
 
@@ -5020,18 +5265,20 @@ unsigned ProcessorCore::_handleHalt(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     _state.setIdleMode();
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleIret(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleIret(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC1FFFFF) == 0x04000218);
 
@@ -5040,15 +5287,18 @@ unsigned ProcessorCore::_handleIret(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x001FF800) != 0)
     {   //  Bits 11..20 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     if (inum > 5)
     {   //  Bits 11..20 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPERAND);
+        return 1;
     }
     //  Execute
     if (!_state.isInKernelMode())
     {
         _raiseProgramInterrupt(ProgramInterrupt::PRIVILEGED);
+        return 1;
     }
     //  TODO make sure state change is valid (e.g. byte order change, etc.)
     switch (inum)
@@ -5084,7 +5334,7 @@ unsigned ProcessorCore::_handleIret(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleGetfl(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleGetfl(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC1FFFFF) == 0x04000338);
 
@@ -5093,6 +5343,7 @@ unsigned ProcessorCore::_handleGetfl(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x001FF800) != 0)
     {   //  Bits 11..20 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = _flags;
@@ -5100,7 +5351,7 @@ unsigned ProcessorCore::_handleGetfl(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSetfl(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSetfl(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC1FFFFF) == 0x04000339);
 
@@ -5109,6 +5360,7 @@ unsigned ProcessorCore::_handleSetfl(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x001FF800) != 0)
     {   //  Bits 11..20 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _flags = _r[r1];
@@ -5116,7 +5368,7 @@ unsigned ProcessorCore::_handleSetfl(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleRstfl(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleRstfl(uint32_t instruction)
 {
     Q_ASSERT(instruction == 0x0400033A);
 
@@ -5124,6 +5376,7 @@ unsigned ProcessorCore::_handleRstfl(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x03FFF800) != 0)
     {   //  Bits 11..25 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _flags = 0;
@@ -5131,7 +5384,7 @@ unsigned ProcessorCore::_handleRstfl(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSvc(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSvc(uint32_t instruction)
 {
     Q_ASSERT(instruction == 0x0400033D);
 
@@ -5146,6 +5399,7 @@ unsigned ProcessorCore::_handleSvc(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x03FFF800) != 0)
     {   //  Bits 11..25 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     if (_state.isSvcInterruptsEnabled())
@@ -5155,19 +5409,20 @@ unsigned ProcessorCore::_handleSvc(uint32_t instruction) throws(ProgramInterrupt
     else
     {
         _raiseProgramInterrupt(ProgramInterrupt::MASKED);
+        return 1;
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBrk(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBrk(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC1FFFFF) == 0x0400033E);
 
     throw hadesvm::core::VirtualApplianceException("Not yet implemented");
 }
 
-unsigned ProcessorCore::_handleCpuid(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCpuid(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC1FFFFF) == 0x0400021A);
 
@@ -5176,6 +5431,7 @@ unsigned ProcessorCore::_handleCpuid(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x001FF800) != 0)
     {   //  Bits 11..20 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] =
@@ -5195,14 +5451,14 @@ unsigned ProcessorCore::_handleCpuid(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSigp(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSigp(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400021B);
 
     throw hadesvm::core::VirtualApplianceException("Not yet implemented");
 }
 
-unsigned ProcessorCore::_handleNop(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNop(uint32_t instruction)
 {
     Q_ASSERT(instruction == 0x04000247);
 
@@ -5210,6 +5466,7 @@ unsigned ProcessorCore::_handleNop(uint32_t instruction) throws(ProgramInterrupt
     if ((instruction & 0x03FFF800) != 0)
     {   //  Bits 11..25 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Done
     return 1;
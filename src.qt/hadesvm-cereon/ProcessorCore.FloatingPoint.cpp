@@ -9,7 +9,7 @@ using namespace hadesvm::cereon;
 
 //////////
 //  FLOATING POINT (data movement)
-unsigned ProcessorCore::_handleMovD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMovD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000400);
 
@@ -17,6 +17,7 @@ unsigned ProcessorCore::_handleMovD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -24,6 +25,7 @@ unsigned ProcessorCore::_handleMovD(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     _r[r1] = _r[r2];
@@ -31,7 +33,7 @@ unsigned ProcessorCore::_handleMovD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleLiD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleLiD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0x20000000);
 
@@ -39,6 +41,7 @@ unsigned ProcessorCore::_handleLiD(uint32_t instruction) throws(ProgramInterrupt
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -51,7 +54,7 @@ unsigned ProcessorCore::_handleLiD(uint32_t instruction) throws(ProgramInterrupt
 
 //////////
 //  FLOATING POINT (arithmetics)
-unsigned ProcessorCore::_handleAddF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000410);
 
@@ -59,6 +62,7 @@ unsigned ProcessorCore::_handleAddF(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -66,15 +70,15 @@ unsigned ProcessorCore::_handleAddF(uint32_t instruction) throws(ProgramInterrup
     unsigned r3 = (instruction >> 11) & 0x1F;
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
-    hadesvm::ieee754::Real32 x = hadesvm::ieee754::Real64::fromBitPattern(_r[r2]).toReal32(fpEnvironment);
-    hadesvm::ieee754::Real32 y = hadesvm::ieee754::Real64::fromBitPattern(_r[r3]).toReal32(fpEnvironment);
-    _r[r1] = x.add(y, fpEnvironment).toReal64().bitPattern;
+    hadesvm::ieee754::Real64 x = hadesvm::ieee754::Real64::fromBitPattern(_r[r2]);
+    hadesvm::ieee754::Real64 y = hadesvm::ieee754::Real64::fromBitPattern(_r[r3]);
+    _r[r1] = x.addAsReal32(y, fpEnvironment).bitPattern;
     _handleFloatingPointConditions(fpEnvironment);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleAddD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAddD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000408);
 
@@ -82,6 +86,7 @@ unsigned ProcessorCore::_handleAddD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -97,7 +102,7 @@ unsigned ProcessorCore::_handleAddD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000411);
 
@@ -105,6 +110,7 @@ unsigned ProcessorCore::_handleSubF(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -112,15 +118,15 @@ unsigned ProcessorCore::_handleSubF(uint32_t instruction) throws(ProgramInterrup
     unsigned r3 = (instruction >> 11) & 0x1F;
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
-    hadesvm::ieee754::Real32 x = hadesvm::ieee754::Real64::fromBitPattern(_r[r2]).toReal32(fpEnvironment);
-    hadesvm::ieee754::Real32 y = hadesvm::ieee754::Real64::fromBitPattern(_r[r3]).toReal32(fpEnvironment);
-    _r[r1] = x.subtract(y, fpEnvironment).toReal64().bitPattern;
+    hadesvm::ieee754::Real64 x = hadesvm::ieee754::Real64::fromBitPattern(_r[r2]);
+    hadesvm::ieee754::Real64 y = hadesvm::ieee754::Real64::fromBitPattern(_r[r3]);
+    _r[r1] = x.subtractAsReal32(y, fpEnvironment).bitPattern;
     _handleFloatingPointConditions(fpEnvironment);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleSubD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSubD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000409);
 
@@ -128,6 +134,7 @@ unsigned ProcessorCore::_handleSubD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -143,7 +150,7 @@ unsigned ProcessorCore::_handleSubD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleMulF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000412);
 
@@ -151,6 +158,7 @@ unsigned ProcessorCore::_handleMulF(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -158,15 +166,15 @@ unsigned ProcessorCore::_handleMulF(uint32_t instruction) throws(ProgramInterrup
     unsigned r3 = (instruction >> 11) & 0x1F;
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
-    hadesvm::ieee754::Real32 x = hadesvm::ieee754::Real64::fromBitPattern(_r[r2]).toReal32(fpEnvironment);
-    hadesvm::ieee754::Real32 y = hadesvm::ieee754::Real64::fromBitPattern(_r[r3]).toReal32(fpEnvironment);
-    _r[r1] = x.multiply(y, fpEnvironment).toReal64().bitPattern;
+    hadesvm::ieee754::Real64 x = hadesvm::ieee754::Real64::fromBitPattern(_r[r2]);
+    hadesvm::ieee754::Real64 y = hadesvm::ieee754::Real64::fromBitPattern(_r[r3]);
+    _r[r1] = x.multiplyAsReal32(y, fpEnvironment).bitPattern;
     _handleFloatingPointConditions(fpEnvironment);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleMulD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleMulD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400040A);
 
@@ -174,6 +182,7 @@ unsigned ProcessorCore::_handleMulD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -189,7 +198,7 @@ unsigned ProcessorCore::_handleMulD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleDivF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x04000413);
 
@@ -197,6 +206,7 @@ unsigned ProcessorCore::_handleDivF(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -204,15 +214,15 @@ unsigned ProcessorCore::_handleDivF(uint32_t instruction) throws(ProgramInterrup
     unsigned r3 = (instruction >> 11) & 0x1F;
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
-    hadesvm::ieee754::Real32 x = hadesvm::ieee754::Real64::fromBitPattern(_r[r2]).toReal32(fpEnvironment);
-    hadesvm::ieee754::Real32 y = hadesvm::ieee754::Real64::fromBitPattern(_r[r3]).toReal32(fpEnvironment);
-    _r[r1] = x.divide(y, fpEnvironment).toReal64().bitPattern;
+    hadesvm::ieee754::Real64 x = hadesvm::ieee754::Real64::fromBitPattern(_r[r2]);
+    hadesvm::ieee754::Real64 y = hadesvm::ieee754::Real64::fromBitPattern(_r[r3]);
+    _r[r1] = x.divideAsReal32(y, fpEnvironment).bitPattern;
     _handleFloatingPointConditions(fpEnvironment);
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleDivD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleDivD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC0007FF) == 0x0400040B);
 
@@ -220,6 +230,7 @@ unsigned ProcessorCore::_handleDivD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -235,7 +246,7 @@ unsigned ProcessorCore::_handleDivD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAbsF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAbsF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000414);
 
@@ -243,6 +254,7 @@ unsigned ProcessorCore::_handleAbsF(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -250,6 +262,7 @@ unsigned ProcessorCore::_handleAbsF(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -262,7 +275,7 @@ unsigned ProcessorCore::_handleAbsF(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleAbsD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleAbsD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400040C);
 
@@ -270,10 +283,12 @@ unsigned ProcessorCore::_handleAbsD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -289,7 +304,7 @@ unsigned ProcessorCore::_handleAbsD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleNegF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNegF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000415);
 
@@ -297,6 +312,7 @@ unsigned ProcessorCore::_handleNegF(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -304,6 +320,7 @@ unsigned ProcessorCore::_handleNegF(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -314,7 +331,7 @@ unsigned ProcessorCore::_handleNegF(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleNegD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleNegD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400040D);
 
@@ -322,6 +339,7 @@ unsigned ProcessorCore::_handleNegD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -329,6 +347,7 @@ unsigned ProcessorCore::_handleNegD(uint32_t instruction) throws(ProgramInterrup
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -339,7 +358,7 @@ unsigned ProcessorCore::_handleNegD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSqrtF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSqrtF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000416);
 
@@ -347,6 +366,7 @@ unsigned ProcessorCore::_handleSqrtF(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -354,6 +374,7 @@ unsigned ProcessorCore::_handleSqrtF(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -375,6 +396,7 @@ unsigned ProcessorCore::_handleSqrtF(uint32_t instruction) throws(ProgramInterru
                 _r[r1] = 0;
                 _flags.setRealOperandFlag();
                 _raiseProgramInterrupt(ProgramInterrupt::FOPERAND);
+                return 1;
             }
             result = x.sqrt(fpEnvironment);
             break;
@@ -390,6 +412,7 @@ unsigned ProcessorCore::_handleSqrtF(uint32_t instruction) throws(ProgramInterru
             {
                 _r[r1] = x.toReal64().bitPattern;
                 _raiseProgramInterrupt(ProgramInterrupt::FOPERAND);
+                return 1;
             }
             [[fallthrough]];
         case hadesvm::ieee754::ValueClass::QuietNan:
@@ -405,7 +428,7 @@ unsigned ProcessorCore::_handleSqrtF(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleSqrtD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSqrtD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400040E);
 
@@ -413,6 +436,7 @@ unsigned ProcessorCore::_handleSqrtD(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -420,6 +444,7 @@ unsigned ProcessorCore::_handleSqrtD(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -441,6 +466,7 @@ unsigned ProcessorCore::_handleSqrtD(uint32_t instruction) throws(ProgramInterru
                 _r[r1] = 0;
                 _flags.setRealOperandFlag();
                 _raiseProgramInterrupt(ProgramInterrupt::FOPERAND);
+                return 1;
             }
             result = x.sqrt(fpEnvironment);
             break;
@@ -456,6 +482,7 @@ unsigned ProcessorCore::_handleSqrtD(uint32_t instruction) throws(ProgramInterru
             {
                 _r[r1] = x.bitPattern;
                 _raiseProgramInterrupt(ProgramInterrupt::FOPERAND);
+                return 1;
             }
             [[fallthrough]];
         case hadesvm::ieee754::ValueClass::QuietNan:
@@ -473,7 +500,7 @@ unsigned ProcessorCore::_handleSqrtD(uint32_t instruction) throws(ProgramInterru
 
 //////////
 //  FLOATING POINT (conversions)
-unsigned ProcessorCore::_handleCvtFB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtFB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000420);
 
@@ -481,6 +508,7 @@ unsigned ProcessorCore::_handleCvtFB(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -488,6 +516,7 @@ unsigned ProcessorCore::_handleCvtFB(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -498,7 +527,7 @@ unsigned ProcessorCore::_handleCvtFB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtFUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtFUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000424);
 
@@ -506,6 +535,7 @@ unsigned ProcessorCore::_handleCvtFUB(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -513,6 +543,7 @@ unsigned ProcessorCore::_handleCvtFUB(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -523,7 +554,7 @@ unsigned ProcessorCore::_handleCvtFUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtFH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtFH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000421);
 
@@ -531,6 +562,7 @@ unsigned ProcessorCore::_handleCvtFH(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -538,6 +570,7 @@ unsigned ProcessorCore::_handleCvtFH(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -548,7 +581,7 @@ unsigned ProcessorCore::_handleCvtFH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtFUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtFUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000425);
 
@@ -556,6 +589,7 @@ unsigned ProcessorCore::_handleCvtFUH(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -563,6 +597,7 @@ unsigned ProcessorCore::_handleCvtFUH(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -573,7 +608,7 @@ unsigned ProcessorCore::_handleCvtFUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtFW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtFW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000422);
 
@@ -581,6 +616,7 @@ unsigned ProcessorCore::_handleCvtFW(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -588,6 +624,7 @@ unsigned ProcessorCore::_handleCvtFW(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -598,7 +635,7 @@ unsigned ProcessorCore::_handleCvtFW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtFUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtFUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000426);
 
@@ -606,6 +643,7 @@ unsigned ProcessorCore::_handleCvtFUW(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -613,6 +651,7 @@ unsigned ProcessorCore::_handleCvtFUW(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -623,7 +662,7 @@ unsigned ProcessorCore::_handleCvtFUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtFL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtFL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000423);
 
@@ -631,6 +670,7 @@ unsigned ProcessorCore::_handleCvtFL(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -638,6 +678,7 @@ unsigned ProcessorCore::_handleCvtFL(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -648,7 +689,7 @@ unsigned ProcessorCore::_handleCvtFL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtFUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtFUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000427);
 
@@ -656,6 +697,7 @@ unsigned ProcessorCore::_handleCvtFUL(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -663,6 +705,7 @@ unsigned ProcessorCore::_handleCvtFUL(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -673,7 +716,7 @@ unsigned ProcessorCore::_handleCvtFUL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtDB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtDB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000430);
 
@@ -681,6 +724,7 @@ unsigned ProcessorCore::_handleCvtDB(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -688,6 +732,7 @@ unsigned ProcessorCore::_handleCvtDB(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -698,7 +743,7 @@ unsigned ProcessorCore::_handleCvtDB(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtDUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtDUB(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000434);
 
@@ -706,6 +751,7 @@ unsigned ProcessorCore::_handleCvtDUB(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -713,6 +759,7 @@ unsigned ProcessorCore::_handleCvtDUB(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -723,7 +770,7 @@ unsigned ProcessorCore::_handleCvtDUB(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtDH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtDH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000431);
 
@@ -731,6 +778,7 @@ unsigned ProcessorCore::_handleCvtDH(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -738,6 +786,7 @@ unsigned ProcessorCore::_handleCvtDH(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -748,7 +797,7 @@ unsigned ProcessorCore::_handleCvtDH(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtDUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtDUH(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000435);
 
@@ -756,6 +805,7 @@ unsigned ProcessorCore::_handleCvtDUH(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -763,6 +813,7 @@ unsigned ProcessorCore::_handleCvtDUH(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -773,7 +824,7 @@ unsigned ProcessorCore::_handleCvtDUH(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtDW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtDW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000432);
 
@@ -781,6 +832,7 @@ unsigned ProcessorCore::_handleCvtDW(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -788,6 +840,7 @@ unsigned ProcessorCore::_handleCvtDW(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -798,7 +851,7 @@ unsigned ProcessorCore::_handleCvtDW(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtDUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtDUW(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000436);
 
@@ -806,6 +859,7 @@ unsigned ProcessorCore::_handleCvtDUW(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -813,6 +867,7 @@ unsigned ProcessorCore::_handleCvtDUW(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -823,7 +878,7 @@ unsigned ProcessorCore::_handleCvtDUW(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtDL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtDL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000433);
 
@@ -831,6 +886,7 @@ unsigned ProcessorCore::_handleCvtDL(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -838,6 +894,7 @@ unsigned ProcessorCore::_handleCvtDL(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -848,7 +905,7 @@ unsigned ProcessorCore::_handleCvtDL(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtDUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtDUL(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000437);
 
@@ -856,6 +913,7 @@ unsigned ProcessorCore::_handleCvtDUL(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -863,6 +921,7 @@ unsigned ProcessorCore::_handleCvtDUL(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -873,7 +932,7 @@ unsigned ProcessorCore::_handleCvtDUL(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtBF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtBF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000428);
 
@@ -881,6 +940,7 @@ unsigned ProcessorCore::_handleCvtBF(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -888,6 +948,7 @@ unsigned ProcessorCore::_handleCvtBF(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -897,7 +958,7 @@ unsigned ProcessorCore::_handleCvtBF(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtUBF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtUBF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400042C);
 
@@ -905,6 +966,7 @@ unsigned ProcessorCore::_handleCvtUBF(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -912,6 +974,7 @@ unsigned ProcessorCore::_handleCvtUBF(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -921,7 +984,7 @@ unsigned ProcessorCore::_handleCvtUBF(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtHF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtHF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000429);
 
@@ -929,6 +992,7 @@ unsigned ProcessorCore::_handleCvtHF(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -936,6 +1000,7 @@ unsigned ProcessorCore::_handleCvtHF(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -945,7 +1010,7 @@ unsigned ProcessorCore::_handleCvtHF(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtUHF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtUHF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400042D);
 
@@ -953,6 +1018,7 @@ unsigned ProcessorCore::_handleCvtUHF(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -960,6 +1026,7 @@ unsigned ProcessorCore::_handleCvtUHF(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -969,7 +1036,7 @@ unsigned ProcessorCore::_handleCvtUHF(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtWF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtWF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400042A);
 
@@ -977,6 +1044,7 @@ unsigned ProcessorCore::_handleCvtWF(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -984,6 +1052,7 @@ unsigned ProcessorCore::_handleCvtWF(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -993,7 +1062,7 @@ unsigned ProcessorCore::_handleCvtWF(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtUWF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtUWF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400042E);
 
@@ -1001,6 +1070,7 @@ unsigned ProcessorCore::_handleCvtUWF(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1008,6 +1078,7 @@ unsigned ProcessorCore::_handleCvtUWF(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1017,7 +1088,7 @@ unsigned ProcessorCore::_handleCvtUWF(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtLF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtLF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400042B);
 
@@ -1025,6 +1096,7 @@ unsigned ProcessorCore::_handleCvtLF(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1032,6 +1104,7 @@ unsigned ProcessorCore::_handleCvtLF(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1041,7 +1114,7 @@ unsigned ProcessorCore::_handleCvtLF(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtULF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtULF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400042F);
 
@@ -1049,6 +1122,7 @@ unsigned ProcessorCore::_handleCvtULF(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1056,6 +1130,7 @@ unsigned ProcessorCore::_handleCvtULF(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1065,7 +1140,7 @@ unsigned ProcessorCore::_handleCvtULF(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtBD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtBD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000438);
 
@@ -1073,6 +1148,7 @@ unsigned ProcessorCore::_handleCvtBD(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1080,6 +1156,7 @@ unsigned ProcessorCore::_handleCvtBD(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1089,7 +1166,7 @@ unsigned ProcessorCore::_handleCvtBD(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtUBD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtUBD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400043C);
 
@@ -1097,6 +1174,7 @@ unsigned ProcessorCore::_handleCvtUBD(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1104,6 +1182,7 @@ unsigned ProcessorCore::_handleCvtUBD(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1113,7 +1192,7 @@ unsigned ProcessorCore::_handleCvtUBD(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtHD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtHD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000439);
 
@@ -1121,6 +1200,7 @@ unsigned ProcessorCore::_handleCvtHD(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1128,6 +1208,7 @@ unsigned ProcessorCore::_handleCvtHD(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1137,7 +1218,7 @@ unsigned ProcessorCore::_handleCvtHD(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtUHD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtUHD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400043D);
 
@@ -1145,6 +1226,7 @@ unsigned ProcessorCore::_handleCvtUHD(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1152,6 +1234,7 @@ unsigned ProcessorCore::_handleCvtUHD(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1161,7 +1244,7 @@ unsigned ProcessorCore::_handleCvtUHD(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtWD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtWD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400043A);
 
@@ -1169,6 +1252,7 @@ unsigned ProcessorCore::_handleCvtWD(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1176,6 +1260,7 @@ unsigned ProcessorCore::_handleCvtWD(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1185,7 +1270,7 @@ unsigned ProcessorCore::_handleCvtWD(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtUWD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtUWD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400043E);
 
@@ -1193,6 +1278,7 @@ unsigned ProcessorCore::_handleCvtUWD(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1200,6 +1286,7 @@ unsigned ProcessorCore::_handleCvtUWD(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1209,7 +1296,7 @@ unsigned ProcessorCore::_handleCvtUWD(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtLD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtLD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400043B);
 
@@ -1217,6 +1304,7 @@ unsigned ProcessorCore::_handleCvtLD(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1224,6 +1312,7 @@ unsigned ProcessorCore::_handleCvtLD(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1233,7 +1322,7 @@ unsigned ProcessorCore::_handleCvtLD(uint32_t instruction) throws(ProgramInterru
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtULD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtULD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400043F);
 
@@ -1241,6 +1330,7 @@ unsigned ProcessorCore::_handleCvtULD(uint32_t instruction) throws(ProgramInterr
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1248,6 +1338,7 @@ unsigned ProcessorCore::_handleCvtULD(uint32_t instruction) throws(ProgramInterr
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1257,7 +1348,7 @@ unsigned ProcessorCore::_handleCvtULD(uint32_t instruction) throws(ProgramInterr
     return 1;
 }
 
-unsigned ProcessorCore::_handleCvtDF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleCvtDF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000401);
 
@@ -1265,6 +1356,7 @@ unsigned ProcessorCore::_handleCvtDF(uint32_t instruction) throws(ProgramInterru
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1272,6 +1364,7 @@ unsigned ProcessorCore::_handleCvtDF(uint32_t instruction) throws(ProgramInterru
     if ((instruction & 0x0000F800) != 0)
     {   //  Bits 11..15 are unused and must all be 0
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Execute
     hadesvm::ieee754::Environment fpEnvironment;
@@ -1283,7 +1376,7 @@ unsigned ProcessorCore::_handleCvtDF(uint32_t instruction) throws(ProgramInterru
 
 //////////
 //  FLOATING POINT (comparison)
-unsigned ProcessorCore::_handleSeqD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSeqD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000418);
 
@@ -1291,6 +1384,7 @@ unsigned ProcessorCore::_handleSeqD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1304,7 +1398,7 @@ unsigned ProcessorCore::_handleSeqD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSneD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSneD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x04000419);
 
@@ -1312,6 +1406,7 @@ unsigned ProcessorCore::_handleSneD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1325,7 +1420,7 @@ unsigned ProcessorCore::_handleSneD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSltD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSltD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400041A);
 
@@ -1333,6 +1428,7 @@ unsigned ProcessorCore::_handleSltD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1346,7 +1442,7 @@ unsigned ProcessorCore::_handleSltD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSleD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSleD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400041B);
 
@@ -1354,6 +1450,7 @@ unsigned ProcessorCore::_handleSleD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1367,7 +1464,7 @@ unsigned ProcessorCore::_handleSleD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgtD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgtD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400041C);
 
@@ -1375,6 +1472,7 @@ unsigned ProcessorCore::_handleSgtD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1388,7 +1486,7 @@ unsigned ProcessorCore::_handleSgtD(uint32_t instruction) throws(ProgramInterrup
     return 1;
 }
 
-unsigned ProcessorCore::_handleSgeD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleSgeD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC00FFFF) == 0x0400041D);
 
@@ -1396,6 +1494,7 @@ unsigned ProcessorCore::_handleSgeD(uint32_t instruction) throws(ProgramInterrup
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
@@ -1411,7 +1510,8 @@ unsigned ProcessorCore::_handleSgeD(uint32_t instruction) throws(ProgramInterrup
 
 //////////
 //  FLOATING POINT (load/store)
-unsigned ProcessorCore::_handleLF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleLF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xB0000000);
 
@@ -1419,18 +1519,25 @@ unsigned ProcessorCore::_handleLF(uint32_t instruction) throws(ProgramInterrupt,
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _r[r1] = hadesvm::ieee754::Real32::fromBitPattern(_loadWord(_r[r2] + imm)).toReal64().bitPattern;
+    uint32_t value = 0;
+    if (!_loadWord<GuestByteOrder>(_r[r2] + imm, value))
+    {
+        return 1;
+    }
+    _r[r1] = hadesvm::ieee754::Real32::fromBitPattern(value).toReal64().bitPattern;
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleLD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleLD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xB4000000);
 
@@ -1438,18 +1545,25 @@ unsigned ProcessorCore::_handleLD(uint32_t instruction) throws(ProgramInterrupt,
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _r[r1] = hadesvm::ieee754::Real64::fromBitPattern(_loadLongWord(_r[r2] + imm)).bitPattern;
+    uint64_t value = 0;
+    if (!_loadLongWord<GuestByteOrder>(_r[r2] + imm, value))
+    {
+        return 1;
+    }
+    _r[r1] = hadesvm::ieee754::Real64::fromBitPattern(value).bitPattern;
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleSF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleSF(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xB8000000);
 
@@ -1457,18 +1571,23 @@ unsigned ProcessorCore::_handleSF(uint32_t instruction) throws(ProgramInterrupt,
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _storeWord(_r[r2] + imm, hadesvm::ieee754::Real64::fromBitPattern(_r[r1]).toReal32().bitPattern);
+    if (!_storeWord<GuestByteOrder>(_r[r2] + imm, hadesvm::ieee754::Real64::fromBitPattern(_r[r1]).toReal32().bitPattern))
+    {
+        return 1;
+    }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleSD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+unsigned ProcessorCore::_handleSD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xBC000000);
 
@@ -1476,20 +1595,34 @@ unsigned ProcessorCore::_handleSD(uint32_t instruction) throws(ProgramInterrupt,
     if (!_features.has(Feature::FloatingPoint))
     {   //  OOPS! FLOATING POINT feature not available
         _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+        return 1;
     }
     //  Decode
     unsigned r1 = (instruction >> 21) & 0x1F;
     unsigned r2 = (instruction >> 16) & 0x1F;
     uint64_t imm = Alu::signExtendInt16(instruction);
     //  Execute
-    _storeLongWord(_r[r2] + imm, hadesvm::ieee754::Real64::fromBitPattern(_r[r1]).bitPattern);
+    if (!_storeLongWord<GuestByteOrder>(_r[r2] + imm, hadesvm::ieee754::Real64::fromBitPattern(_r[r1]).bitPattern))
+    {
+        return 1;
+    }
     //  Done
     return 1;
 }
 
+//  Instantiations for both guest byte orders
+template unsigned ProcessorCore::_handleLF<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLF<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLD<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleLD<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSF<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSF<ByteOrder::LittleEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSD<ByteOrder::BigEndian>(uint32_t instruction);
+template unsigned ProcessorCore::_handleSD<ByteOrder::LittleEndian>(uint32_t instruction);
+
 //////////
 //  FLOATING POINT (flow control)
-unsigned ProcessorCore::_handleBeqD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBeqD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xE0000000);
 
@@ -1503,12 +1636,13 @@ unsigned ProcessorCore::_handleBeqD(uint32_t instruction) throws(ProgramInterrup
     if (x == y)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBneD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBneD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xE4000000);
 
@@ -1522,12 +1656,13 @@ unsigned ProcessorCore::_handleBneD(uint32_t instruction) throws(ProgramInterrup
     if (x != y)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBltD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBltD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xE8000000);
 
@@ -1541,12 +1676,13 @@ unsigned ProcessorCore::_handleBltD(uint32_t instruction) throws(ProgramInterrup
     if (x < y)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBleD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBleD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xEC000000);
 
@@ -1560,12 +1696,13 @@ unsigned ProcessorCore::_handleBleD(uint32_t instruction) throws(ProgramInterrup
     if (x <= y)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgtD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgtD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xF0000000);
 
@@ -1579,12 +1716,13 @@ unsigned ProcessorCore::_handleBgtD(uint32_t instruction) throws(ProgramInterrup
     if (x > y)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
 }
 
-unsigned ProcessorCore::_handleBgeD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
+unsigned ProcessorCore::_handleBgeD(uint32_t instruction)
 {
     Q_ASSERT((instruction & 0xFC000000) == 0xF4000000);
 
@@ -1598,6 +1736,7 @@ unsigned ProcessorCore::_handleBgeD(uint32_t instruction) throws(ProgramInterrup
     if (x >= y)
     {
         _r[_IpRegister] += (target << 2);
+        _countPerformanceEvent(PerformanceEvent::TakenBranches);
     }
     //  Done
     return 1;
@@ -0,0 +1,1643 @@
+//
+//  hadesvm-cereon/ProcessorCore.Threaded.cpp
+//
+//  hadesvm::cereon::ProcessorCore class implementation (threaded execution engine)
+//
+//////////
+#include "hadesvm-cereon/API.hpp"
+using namespace hadesvm::cereon;
+
+//////////
+//  Implementation helpers (threaded execution engine)
+unsigned ProcessorCore::_runThreaded(unsigned maxCycles)
+{
+    Q_ASSERT(maxCycles > 0);
+
+    //  The quantum ends early when $state or $itc is changed by an instruction
+    //  (which includes raising an interrupt), so that caller can handle traps,
+    //  timer and idle mode as usual
+    const uint64_t entryState = _state;
+    const uint64_t entryItc = _itc;
+    unsigned cyclesTaken = 0;
+    const _DecodedInstruction * decodedInstruction = nullptr;
+
+#if defined(Q_CC_GNU)
+    //  The hot state of the core lives in locals while the quantum runs, so
+    //  that the compiler can keep it in host registers. Within a basic block
+    //  "ip" is the address of "nextDecodedInstruction". The state is written
+    //  back to the core before anything that may look at or change it (an
+    //  instruction handler, an executor that may raise an interrupt or jump)
+    //  and when the quantum ends. Stores into code by other cores are noticed
+    //  at the next such call or basic block switch
+    uint64_t ip = _r[_IpRegister];
+    uint64_t cc = _cc;
+    const _DecodedInstruction * nextDecodedInstruction = _nextDecodedInstruction;
+    const _DecodedInstruction * endDecodedInstructions = _endDecodedInstructions;
+
+    //  With the translating engine, hot basic blocks are run by their
+    //  translation rather than dispatched (see ProcessorCore.Translated.cpp)
+    const bool translating = (_processor->_executionEngine == ExecutionEngine::Translated);
+
+    //  Direct-threaded dispatch - each predecoded instruction records the
+    //  address of the code that executes it and every such piece of code
+    //  jumps directly to the next one, without returning to a common loop.
+    //  Instructions with an executor run it right here, from the operands
+    //  decoded into their _DecodedInstruction; all other instructions (and
+    //  those left to their handler because of bad reserved bits) call the
+    //  handler
+    struct ThreadedExecutor
+    {
+        _DecodedInstructionHandler  executor;
+        const void *        threadedCode;
+    };
+    static const ThreadedExecutor ThreadedExecutors[] =
+    {
+        { &ProcessorCore::_executeLiL, &&executeDecodedLiL },
+        { &ProcessorCore::_executeMovL, &&executeDecodedMovL },
+        { &ProcessorCore::_executeNop, &&executeDecodedNop },
+        { &ProcessorCore::_executeAddL, &&executeDecodedAddL },
+        { &ProcessorCore::_executeSubL, &&executeDecodedSubL },
+        { &ProcessorCore::_executeAddiL, &&executeDecodedAddiL },
+        { &ProcessorCore::_executeSubiL, &&executeDecodedSubiL },
+        { &ProcessorCore::_executeAndL, &&executeDecodedAndL },
+        { &ProcessorCore::_executeOrL, &&executeDecodedOrL },
+        { &ProcessorCore::_executeXorL, &&executeDecodedXorL },
+        { &ProcessorCore::_executeAndiL, &&executeDecodedAndiL },
+        { &ProcessorCore::_executeOriL, &&executeDecodedOriL },
+        { &ProcessorCore::_executeXoriL, &&executeDecodedXoriL },
+        { &ProcessorCore::_executeSeqL, &&executeDecodedSeqL },
+        { &ProcessorCore::_executeSltL, &&executeDecodedSltL },
+        { &ProcessorCore::_executeSltUL, &&executeDecodedSltUL },
+        { &ProcessorCore::_executeSeqiL, &&executeDecodedSeqiL },
+        { &ProcessorCore::_executeSltiL, &&executeDecodedSltiL },
+        { &ProcessorCore::_executeLL<ByteOrder::BigEndian>, &&executeDecodedLLBigEndian },
+        { &ProcessorCore::_executeLL<ByteOrder::LittleEndian>, &&executeDecodedLLLittleEndian },
+        { &ProcessorCore::_executeSL<ByteOrder::BigEndian>, &&executeDecodedSLBigEndian },
+        { &ProcessorCore::_executeSL<ByteOrder::LittleEndian>, &&executeDecodedSLLittleEndian },
+        { &ProcessorCore::_executeLdm<ByteOrder::BigEndian>, &&executeDecodedLdmBigEndian },
+        { &ProcessorCore::_executeLdm<ByteOrder::LittleEndian>, &&executeDecodedLdmLittleEndian },
+        { &ProcessorCore::_executeStm<ByteOrder::BigEndian>, &&executeDecodedStmBigEndian },
+        { &ProcessorCore::_executeStm<ByteOrder::LittleEndian>, &&executeDecodedStmLittleEndian },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isEqual>, &&executeDecodedBeqL },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>, &&executeDecodedBneL },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isLess>, &&executeDecodedBltL },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isLessOrEqual>, &&executeDecodedBleL },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isGreater>, &&executeDecodedBgtL },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isGreaterOrEqual>, &&executeDecodedBgeL },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isLessUnsigned>, &&executeDecodedBltUL },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isLessOrEqualUnsigned>, &&executeDecodedBleUL },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isGreaterUnsigned>, &&executeDecodedBgtUL },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isGreaterOrEqualUnsigned>, &&executeDecodedBgeUL },
+        { &ProcessorCore::_executeJ, &&executeDecodedJ },
+        { &ProcessorCore::_executeJal, &&executeDecodedJal },
+        { &ProcessorCore::_executeJr, &&executeDecodedJr },
+        { &ProcessorCore::_executeJalr, &&executeDecodedJalr }
+    };
+
+    struct ThreadedHandler
+    {
+        _InstructionHandler handler;
+        const void *        threadedCode;
+    };
+    static const ThreadedHandler ThreadedHandlers[] =
+    {
+        { &ProcessorCore::_handleLiL, &&executeLiL },
+        { &ProcessorCore::_handleShliB, &&executeShliB },
+        { &ProcessorCore::_handleShliUB, &&executeShliUB },
+        { &ProcessorCore::_handleShliH, &&executeShliH },
+        { &ProcessorCore::_handleShliUH, &&executeShliUH },
+        { &ProcessorCore::_handleShliW, &&executeShliW },
+        { &ProcessorCore::_handleShliUW, &&executeShliUW },
+        { &ProcessorCore::_handleShliL, &&executeShliL },
+        { &ProcessorCore::_handleShriB, &&executeShriB },
+        { &ProcessorCore::_handleShriUB, &&executeShriUB },
+        { &ProcessorCore::_handleShriH, &&executeShriH },
+        { &ProcessorCore::_handleShriUH, &&executeShriUH },
+        { &ProcessorCore::_handleShriW, &&executeShriW },
+        { &ProcessorCore::_handleShriUW, &&executeShriUW },
+        { &ProcessorCore::_handleShriL, &&executeShriL },
+        { &ProcessorCore::_handleAsliB, &&executeAsliB },
+        { &ProcessorCore::_handleAsliUB, &&executeAsliUB },
+        { &ProcessorCore::_handleAsliH, &&executeAsliH },
+        { &ProcessorCore::_handleAsliUH, &&executeAsliUH },
+        { &ProcessorCore::_handleAsliW, &&executeAsliW },
+        { &ProcessorCore::_handleAsliUW, &&executeAsliUW },
+        { &ProcessorCore::_handleAsliL, &&executeAsliL },
+        { &ProcessorCore::_handleAsriB, &&executeAsriB },
+        { &ProcessorCore::_handleAsriUB, &&executeAsriUB },
+        { &ProcessorCore::_handleAsriH, &&executeAsriH },
+        { &ProcessorCore::_handleAsriUH, &&executeAsriUH },
+        { &ProcessorCore::_handleAsriW, &&executeAsriW },
+        { &ProcessorCore::_handleAsriUW, &&executeAsriUW },
+        { &ProcessorCore::_handleAsriL, &&executeAsriL },
+        { &ProcessorCore::_handleRoliB, &&executeRoliB },
+        { &ProcessorCore::_handleRoliUB, &&executeRoliUB },
+        { &ProcessorCore::_handleRoliH, &&executeRoliH },
+        { &ProcessorCore::_handleRoliUH, &&executeRoliUH },
+        { &ProcessorCore::_handleRoliW, &&executeRoliW },
+        { &ProcessorCore::_handleRoliUW, &&executeRoliUW },
+        { &ProcessorCore::_handleRoliL, &&executeRoliL },
+        { &ProcessorCore::_handleRoriB, &&executeRoriB },
+        { &ProcessorCore::_handleRoriUB, &&executeRoriUB },
+        { &ProcessorCore::_handleRoriH, &&executeRoriH },
+        { &ProcessorCore::_handleRoriUH, &&executeRoriUH },
+        { &ProcessorCore::_handleRoriW, &&executeRoriW },
+        { &ProcessorCore::_handleRoriUW, &&executeRoriUW },
+        { &ProcessorCore::_handleRoriL, &&executeRoriL },
+        { &ProcessorCore::_handleBeqiL, &&executeBeqiL },
+        { &ProcessorCore::_handleBneiL, &&executeBneiL },
+        { &ProcessorCore::_handleBltiL, &&executeBltiL },
+        { &ProcessorCore::_handleBleiL, &&executeBleiL },
+        { &ProcessorCore::_handleBgtiL, &&executeBgtiL },
+        { &ProcessorCore::_handleBgeiL, &&executeBgeiL },
+        { &ProcessorCore::_handleBltiUL, &&executeBltiUL },
+        { &ProcessorCore::_handleBleiUL, &&executeBleiUL },
+        { &ProcessorCore::_handleBgtiUL, &&executeBgtiUL },
+        { &ProcessorCore::_handleBgeiUL, &&executeBgeiUL },
+        { &ProcessorCore::_handleBfiL, &&executeBfiL },
+        { &ProcessorCore::_handleBfeL, &&executeBfeL },
+        { &ProcessorCore::_handleBfeUL, &&executeBfeUL },
+        { &ProcessorCore::_handleMovCR, &&executeMovCR },
+        { &ProcessorCore::_handleMovRC, &&executeMovRC },
+        { &ProcessorCore::_handleMovMR, &&executeMovMR },
+        { &ProcessorCore::_handleMovRM, &&executeMovRM },
+        { &ProcessorCore::_handleIret, &&executeIret },
+        { &ProcessorCore::_handleHalt, &&executeHalt },
+        { &ProcessorCore::_handleCpuid, &&executeCpuid },
+        { &ProcessorCore::_handleSigp, &&executeSigp },
+        { &ProcessorCore::_handleTstp, &&executeTstp },
+        { &ProcessorCore::_handleSetp, &&executeSetp },
+        { &ProcessorCore::_handleInB, &&executeInB },
+        { &ProcessorCore::_handleInH, &&executeInH },
+        { &ProcessorCore::_handleInW, &&executeInW },
+        { &ProcessorCore::_handleInL, &&executeInL },
+        { &ProcessorCore::_handleOutB, &&executeOutB },
+        { &ProcessorCore::_handleOutH, &&executeOutH },
+        { &ProcessorCore::_handleOutL, &&executeOutL },
+        { &ProcessorCore::_handleInUB, &&executeInUB },
+        { &ProcessorCore::_handleInUH, &&executeInUH },
+        { &ProcessorCore::_handleInUW, &&executeInUW },
+        { &ProcessorCore::_handleMovL, &&executeMovL },
+        { &ProcessorCore::_handleCvtBL, &&executeCvtBL },
+        { &ProcessorCore::_handleCvtUBL, &&executeCvtUBL },
+        { &ProcessorCore::_handleCvtHL, &&executeCvtHL },
+        { &ProcessorCore::_handleCvtUHL, &&executeCvtUHL },
+        { &ProcessorCore::_handleCvtWL, &&executeCvtWL },
+        { &ProcessorCore::_handleCvtUWL, &&executeCvtUWL },
+        { &ProcessorCore::_handleNop, &&executeNop },
+        { &ProcessorCore::_handleAndB, &&executeAndB },
+        { &ProcessorCore::_handleAndUB, &&executeAndUB },
+        { &ProcessorCore::_handleAndH, &&executeAndH },
+        { &ProcessorCore::_handleAndUH, &&executeAndUH },
+        { &ProcessorCore::_handleAndW, &&executeAndW },
+        { &ProcessorCore::_handleAndUW, &&executeAndUW },
+        { &ProcessorCore::_handleAndL, &&executeAndL },
+        { &ProcessorCore::_handleSwapH, &&executeSwapH },
+        { &ProcessorCore::_handleOrB, &&executeOrB },
+        { &ProcessorCore::_handleOrUB, &&executeOrUB },
+        { &ProcessorCore::_handleOrH, &&executeOrH },
+        { &ProcessorCore::_handleOrUH, &&executeOrUH },
+        { &ProcessorCore::_handleOrW, &&executeOrW },
+        { &ProcessorCore::_handleOrUW, &&executeOrUW },
+        { &ProcessorCore::_handleOrL, &&executeOrL },
+        { &ProcessorCore::_handleSwapUH, &&executeSwapUH },
+        { &ProcessorCore::_handleXorB, &&executeXorB },
+        { &ProcessorCore::_handleXorUB, &&executeXorUB },
+        { &ProcessorCore::_handleXorH, &&executeXorH },
+        { &ProcessorCore::_handleXorUH, &&executeXorUH },
+        { &ProcessorCore::_handleXorW, &&executeXorW },
+        { &ProcessorCore::_handleXorUW, &&executeXorUW },
+        { &ProcessorCore::_handleXorL, &&executeXorL },
+        { &ProcessorCore::_handleSwapW, &&executeSwapW },
+        { &ProcessorCore::_handleNotB, &&executeNotB },
+        { &ProcessorCore::_handleNotUB, &&executeNotUB },
+        { &ProcessorCore::_handleNotH, &&executeNotH },
+        { &ProcessorCore::_handleNotUH, &&executeNotUH },
+        { &ProcessorCore::_handleNotW, &&executeNotW },
+        { &ProcessorCore::_handleNotUW, &&executeNotUW },
+        { &ProcessorCore::_handleNotL, &&executeNotL },
+        { &ProcessorCore::_handleSwapUW, &&executeSwapUW },
+        { &ProcessorCore::_handleBrevB, &&executeBrevB },
+        { &ProcessorCore::_handleBrevUB, &&executeBrevUB },
+        { &ProcessorCore::_handleBrevH, &&executeBrevH },
+        { &ProcessorCore::_handleBrevUH, &&executeBrevUH },
+        { &ProcessorCore::_handleBrevW, &&executeBrevW },
+        { &ProcessorCore::_handleBrevUW, &&executeBrevUW },
+        { &ProcessorCore::_handleBrevL, &&executeBrevL },
+        { &ProcessorCore::_handleSwapL, &&executeSwapL },
+        { &ProcessorCore::_handleSeqL, &&executeSeqL },
+        { &ProcessorCore::_handleSneL, &&executeSneL },
+        { &ProcessorCore::_handleSltL, &&executeSltL },
+        { &ProcessorCore::_handleSleL, &&executeSleL },
+        { &ProcessorCore::_handleSgtL, &&executeSgtL },
+        { &ProcessorCore::_handleSgeL, &&executeSgeL },
+        { &ProcessorCore::_handleClz, &&executeClz },
+        { &ProcessorCore::_handleCtz, &&executeCtz },
+        { &ProcessorCore::_handleJr, &&executeJr },
+        { &ProcessorCore::_handleJalr, &&executeJalr },
+        { &ProcessorCore::_handleSltUL, &&executeSltUL },
+        { &ProcessorCore::_handleSleUL, &&executeSleUL },
+        { &ProcessorCore::_handleSgtUL, &&executeSgtUL },
+        { &ProcessorCore::_handleSgeUL, &&executeSgeUL },
+        { &ProcessorCore::_handleClo, &&executeClo },
+        { &ProcessorCore::_handleCto, &&executeCto },
+        { &ProcessorCore::_handleAddB, &&executeAddB },
+        { &ProcessorCore::_handleSubB, &&executeSubB },
+        { &ProcessorCore::_handleMulB, &&executeMulB },
+        { &ProcessorCore::_handleDivB, &&executeDivB },
+        { &ProcessorCore::_handleModB, &&executeModB },
+        { &ProcessorCore::_handleAbsB, &&executeAbsB },
+        { &ProcessorCore::_handleNegB, &&executeNegB },
+        { &ProcessorCore::_handleImplB, &&executeImplB },
+        { &ProcessorCore::_handleAddUB, &&executeAddUB },
+        { &ProcessorCore::_handleSubUB, &&executeSubUB },
+        { &ProcessorCore::_handleMulUB, &&executeMulUB },
+        { &ProcessorCore::_handleDivUB, &&executeDivUB },
+        { &ProcessorCore::_handleModUB, &&executeModUB },
+        { &ProcessorCore::_handleCpl2UB, &&executeCpl2UB },
+        { &ProcessorCore::_handleImplUB, &&executeImplUB },
+        { &ProcessorCore::_handleAddH, &&executeAddH },
+        { &ProcessorCore::_handleSubH, &&executeSubH },
+        { &ProcessorCore::_handleMulH, &&executeMulH },
+        { &ProcessorCore::_handleDivH, &&executeDivH },
+        { &ProcessorCore::_handleModH, &&executeModH },
+        { &ProcessorCore::_handleAbsH, &&executeAbsH },
+        { &ProcessorCore::_handleNegH, &&executeNegH },
+        { &ProcessorCore::_handleImplH, &&executeImplH },
+        { &ProcessorCore::_handleAddUH, &&executeAddUH },
+        { &ProcessorCore::_handleSubUH, &&executeSubUH },
+        { &ProcessorCore::_handleMulUH, &&executeMulUH },
+        { &ProcessorCore::_handleDivUH, &&executeDivUH },
+        { &ProcessorCore::_handleModUH, &&executeModUH },
+        { &ProcessorCore::_handleCpl2UH, &&executeCpl2UH },
+        { &ProcessorCore::_handleImplUH, &&executeImplUH },
+        { &ProcessorCore::_handleAddW, &&executeAddW },
+        { &ProcessorCore::_handleSubW, &&executeSubW },
+        { &ProcessorCore::_handleMulW, &&executeMulW },
+        { &ProcessorCore::_handleDivW, &&executeDivW },
+        { &ProcessorCore::_handleModW, &&executeModW },
+        { &ProcessorCore::_handleAbsW, &&executeAbsW },
+        { &ProcessorCore::_handleNegW, &&executeNegW },
+        { &ProcessorCore::_handleImplW, &&executeImplW },
+        { &ProcessorCore::_handleAddUW, &&executeAddUW },
+        { &ProcessorCore::_handleSubUW, &&executeSubUW },
+        { &ProcessorCore::_handleMulUW, &&executeMulUW },
+        { &ProcessorCore::_handleDivUW, &&executeDivUW },
+        { &ProcessorCore::_handleModUW, &&executeModUW },
+        { &ProcessorCore::_handleCpl2UW, &&executeCpl2UW },
+        { &ProcessorCore::_handleImplUW, &&executeImplUW },
+        { &ProcessorCore::_handleAddL, &&executeAddL },
+        { &ProcessorCore::_handleSubL, &&executeSubL },
+        { &ProcessorCore::_handleMulL, &&executeMulL },
+        { &ProcessorCore::_handleDivL, &&executeDivL },
+        { &ProcessorCore::_handleModL, &&executeModL },
+        { &ProcessorCore::_handleAbsL, &&executeAbsL },
+        { &ProcessorCore::_handleNegL, &&executeNegL },
+        { &ProcessorCore::_handleImplL, &&executeImplL },
+        { &ProcessorCore::_handleAddUL, &&executeAddUL },
+        { &ProcessorCore::_handleSubUL, &&executeSubUL },
+        { &ProcessorCore::_handleMulUL, &&executeMulUL },
+        { &ProcessorCore::_handleDivUL, &&executeDivUL },
+        { &ProcessorCore::_handleModUL, &&executeModUL },
+        { &ProcessorCore::_handleCpl2UL, &&executeCpl2UL },
+        { &ProcessorCore::_handleAddiB, &&executeAddiB },
+        { &ProcessorCore::_handleAddiUB, &&executeAddiUB },
+        { &ProcessorCore::_handleAddiH, &&executeAddiH },
+        { &ProcessorCore::_handleAddiUH, &&executeAddiUH },
+        { &ProcessorCore::_handleAddiW, &&executeAddiW },
+        { &ProcessorCore::_handleAddiUW, &&executeAddiUW },
+        { &ProcessorCore::_handleModiB, &&executeModiB },
+        { &ProcessorCore::_handleModiUB, &&executeModiUB },
+        { &ProcessorCore::_handleSubiB, &&executeSubiB },
+        { &ProcessorCore::_handleSubiUB, &&executeSubiUB },
+        { &ProcessorCore::_handleSubiH, &&executeSubiH },
+        { &ProcessorCore::_handleSubiUH, &&executeSubiUH },
+        { &ProcessorCore::_handleSubiW, &&executeSubiW },
+        { &ProcessorCore::_handleSubiUW, &&executeSubiUW },
+        { &ProcessorCore::_handleModiH, &&executeModiH },
+        { &ProcessorCore::_handleModiUH, &&executeModiUH },
+        { &ProcessorCore::_handleMuliB, &&executeMuliB },
+        { &ProcessorCore::_handleMuliUB, &&executeMuliUB },
+        { &ProcessorCore::_handleMuliH, &&executeMuliH },
+        { &ProcessorCore::_handleMuliUH, &&executeMuliUH },
+        { &ProcessorCore::_handleMuliW, &&executeMuliW },
+        { &ProcessorCore::_handleMuliUW, &&executeMuliUW },
+        { &ProcessorCore::_handleModiW, &&executeModiW },
+        { &ProcessorCore::_handleModiUW, &&executeModiUW },
+        { &ProcessorCore::_handleDiviB, &&executeDiviB },
+        { &ProcessorCore::_handleDiviUB, &&executeDiviUB },
+        { &ProcessorCore::_handleDiviH, &&executeDiviH },
+        { &ProcessorCore::_handleDiviUH, &&executeDiviUH },
+        { &ProcessorCore::_handleDiviW, &&executeDiviW },
+        { &ProcessorCore::_handleDiviUW, &&executeDiviUW },
+        { &ProcessorCore::_handleShlB, &&executeShlB },
+        { &ProcessorCore::_handleShrB, &&executeShrB },
+        { &ProcessorCore::_handleAslB, &&executeAslB },
+        { &ProcessorCore::_handleAsrB, &&executeAsrB },
+        { &ProcessorCore::_handleRolB, &&executeRolB },
+        { &ProcessorCore::_handleRorB, &&executeRorB },
+        { &ProcessorCore::_handleShlH, &&executeShlH },
+        { &ProcessorCore::_handleShrH, &&executeShrH },
+        { &ProcessorCore::_handleAslH, &&executeAslH },
+        { &ProcessorCore::_handleAsrH, &&executeAsrH },
+        { &ProcessorCore::_handleRolH, &&executeRolH },
+        { &ProcessorCore::_handleRorH, &&executeRorH },
+        { &ProcessorCore::_handleShlW, &&executeShlW },
+        { &ProcessorCore::_handleShrW, &&executeShrW },
+        { &ProcessorCore::_handleAslW, &&executeAslW },
+        { &ProcessorCore::_handleAsrW, &&executeAsrW },
+        { &ProcessorCore::_handleRolW, &&executeRolW },
+        { &ProcessorCore::_handleRorW, &&executeRorW },
+        { &ProcessorCore::_handleShlUB, &&executeShlUB },
+        { &ProcessorCore::_handleShrUB, &&executeShrUB },
+        { &ProcessorCore::_handleAslUB, &&executeAslUB },
+        { &ProcessorCore::_handleAsrUB, &&executeAsrUB },
+        { &ProcessorCore::_handleRolUB, &&executeRolUB },
+        { &ProcessorCore::_handleRorUB, &&executeRorUB },
+        { &ProcessorCore::_handleShlUH, &&executeShlUH },
+        { &ProcessorCore::_handleShrUH, &&executeShrUH },
+        { &ProcessorCore::_handleAslUH, &&executeAslUH },
+        { &ProcessorCore::_handleAsrUH, &&executeAsrUH },
+        { &ProcessorCore::_handleRolUH, &&executeRolUH },
+        { &ProcessorCore::_handleRorUH, &&executeRorUH },
+        { &ProcessorCore::_handleShlUW, &&executeShlUW },
+        { &ProcessorCore::_handleShrUW, &&executeShrUW },
+        { &ProcessorCore::_handleAslUW, &&executeAslUW },
+        { &ProcessorCore::_handleAsrUW, &&executeAsrUW },
+        { &ProcessorCore::_handleRolUW, &&executeRolUW },
+        { &ProcessorCore::_handleRorUW, &&executeRorUW },
+        { &ProcessorCore::_handleShlL, &&executeShlL },
+        { &ProcessorCore::_handleShrL, &&executeShrL },
+        { &ProcessorCore::_handleAslL, &&executeAslL },
+        { &ProcessorCore::_handleAsrL, &&executeAsrL },
+        { &ProcessorCore::_handleRolL, &&executeRolL },
+        { &ProcessorCore::_handleRorL, &&executeRorL },
+        { &ProcessorCore::_handleGetfl, &&executeGetfl },
+        { &ProcessorCore::_handleSetfl, &&executeSetfl },
+        { &ProcessorCore::_handleRstfl, &&executeRstfl },
+        { &ProcessorCore::_handleSvc, &&executeSvc },
+        { &ProcessorCore::_handleBrk, &&executeBrk },
+        { &ProcessorCore::_handleMovD, &&executeMovD },
+        { &ProcessorCore::_handleCvtDF, &&executeCvtDF },
+        { &ProcessorCore::_handleAddD, &&executeAddD },
+        { &ProcessorCore::_handleSubD, &&executeSubD },
+        { &ProcessorCore::_handleMulD, &&executeMulD },
+        { &ProcessorCore::_handleDivD, &&executeDivD },
+        { &ProcessorCore::_handleAbsD, &&executeAbsD },
+        { &ProcessorCore::_handleNegD, &&executeNegD },
+        { &ProcessorCore::_handleSqrtD, &&executeSqrtD },
+        { &ProcessorCore::_handleAddF, &&executeAddF },
+        { &ProcessorCore::_handleSubF, &&executeSubF },
+        { &ProcessorCore::_handleMulF, &&executeMulF },
+        { &ProcessorCore::_handleDivF, &&executeDivF },
+        { &ProcessorCore::_handleAbsF, &&executeAbsF },
+        { &ProcessorCore::_handleNegF, &&executeNegF },
+        { &ProcessorCore::_handleSqrtF, &&executeSqrtF },
+        { &ProcessorCore::_handleSeqD, &&executeSeqD },
+        { &ProcessorCore::_handleSneD, &&executeSneD },
+        { &ProcessorCore::_handleSltD, &&executeSltD },
+        { &ProcessorCore::_handleSleD, &&executeSleD },
+        { &ProcessorCore::_handleSgtD, &&executeSgtD },
+        { &ProcessorCore::_handleSgeD, &&executeSgeD },
+        { &ProcessorCore::_handleCvtFB, &&executeCvtFB },
+        { &ProcessorCore::_handleCvtFH, &&executeCvtFH },
+        { &ProcessorCore::_handleCvtFW, &&executeCvtFW },
+        { &ProcessorCore::_handleCvtFL, &&executeCvtFL },
+        { &ProcessorCore::_handleCvtFUB, &&executeCvtFUB },
+        { &ProcessorCore::_handleCvtFUH, &&executeCvtFUH },
+        { &ProcessorCore::_handleCvtFUW, &&executeCvtFUW },
+        { &ProcessorCore::_handleCvtFUL, &&executeCvtFUL },
+        { &ProcessorCore::_handleCvtBF, &&executeCvtBF },
+        { &ProcessorCore::_handleCvtHF, &&executeCvtHF },
+        { &ProcessorCore::_handleCvtWF, &&executeCvtWF },
+        { &ProcessorCore::_handleCvtLF, &&executeCvtLF },
+        { &ProcessorCore::_handleCvtUBF, &&executeCvtUBF },
+        { &ProcessorCore::_handleCvtUHF, &&executeCvtUHF },
+        { &ProcessorCore::_handleCvtUWF, &&executeCvtUWF },
+        { &ProcessorCore::_handleCvtULF, &&executeCvtULF },
+        { &ProcessorCore::_handleCvtDB, &&executeCvtDB },
+        { &ProcessorCore::_handleCvtDH, &&executeCvtDH },
+        { &ProcessorCore::_handleCvtDW, &&executeCvtDW },
+        { &ProcessorCore::_handleCvtDL, &&executeCvtDL },
+        { &ProcessorCore::_handleCvtDUB, &&executeCvtDUB },
+        { &ProcessorCore::_handleCvtDUH, &&executeCvtDUH },
+        { &ProcessorCore::_handleCvtDUW, &&executeCvtDUW },
+        { &ProcessorCore::_handleCvtDUL, &&executeCvtDUL },
+        { &ProcessorCore::_handleCvtBD, &&executeCvtBD },
+        { &ProcessorCore::_handleCvtHD, &&executeCvtHD },
+        { &ProcessorCore::_handleCvtWD, &&executeCvtWD },
+        { &ProcessorCore::_handleCvtLD, &&executeCvtLD },
+        { &ProcessorCore::_handleCvtUBD, &&executeCvtUBD },
+        { &ProcessorCore::_handleCvtUHD, &&executeCvtUHD },
+        { &ProcessorCore::_handleCvtUWD, &&executeCvtUWD },
+        { &ProcessorCore::_handleCvtULD, &&executeCvtULD },
+        { &ProcessorCore::_handleAddiL, &&executeAddiL },
+        { &ProcessorCore::_handleSubiL, &&executeSubiL },
+        { &ProcessorCore::_handleMuliL, &&executeMuliL },
+        { &ProcessorCore::_handleDiviL, &&executeDiviL },
+        { &ProcessorCore::_handleModiL, &&executeModiL },
+        { &ProcessorCore::_handleJ, &&executeJ },
+        { &ProcessorCore::_handleLiD, &&executeLiD },
+        { &ProcessorCore::_handleLir<ByteOrder::BigEndian>, &&executeLirBigEndian },
+        { &ProcessorCore::_handleLir<ByteOrder::LittleEndian>, &&executeLirLittleEndian },
+        { &ProcessorCore::_handleAddiUL, &&executeAddiUL },
+        { &ProcessorCore::_handleSubiUL, &&executeSubiUL },
+        { &ProcessorCore::_handleMuliUL, &&executeMuliUL },
+        { &ProcessorCore::_handleDiviUL, &&executeDiviUL },
+        { &ProcessorCore::_handleModiUL, &&executeModiUL },
+        { &ProcessorCore::_handleJal, &&executeJal },
+        { &ProcessorCore::_handleSeqiL, &&executeSeqiL },
+        { &ProcessorCore::_handleSneiL, &&executeSneiL },
+        { &ProcessorCore::_handleSltiL, &&executeSltiL },
+        { &ProcessorCore::_handleSleiL, &&executeSleiL },
+        { &ProcessorCore::_handleSgtiL, &&executeSgtiL },
+        { &ProcessorCore::_handleSgeiL, &&executeSgeiL },
+        { &ProcessorCore::_handleSltiUL, &&executeSltiUL },
+        { &ProcessorCore::_handleSleiUL, &&executeSleiUL },
+        { &ProcessorCore::_handleAndiL, &&executeAndiL },
+        { &ProcessorCore::_handleOriL, &&executeOriL },
+        { &ProcessorCore::_handleXoriL, &&executeXoriL },
+        { &ProcessorCore::_handleImpliL, &&executeImpliL },
+        { &ProcessorCore::_handleLdm<ByteOrder::BigEndian>, &&executeLdmBigEndian },
+        { &ProcessorCore::_handleLdm<ByteOrder::LittleEndian>, &&executeLdmLittleEndian },
+        { &ProcessorCore::_handleStm<ByteOrder::BigEndian>, &&executeStmBigEndian },
+        { &ProcessorCore::_handleStm<ByteOrder::LittleEndian>, &&executeStmLittleEndian },
+        { &ProcessorCore::_handleSgtiUL, &&executeSgtiUL },
+        { &ProcessorCore::_handleSgeiUL, &&executeSgeiUL },
+        { &ProcessorCore::_handleLB, &&executeLB },
+        { &ProcessorCore::_handleLUB, &&executeLUB },
+        { &ProcessorCore::_handleLH<ByteOrder::BigEndian>, &&executeLHBigEndian },
+        { &ProcessorCore::_handleLH<ByteOrder::LittleEndian>, &&executeLHLittleEndian },
+        { &ProcessorCore::_handleLUH<ByteOrder::BigEndian>, &&executeLUHBigEndian },
+        { &ProcessorCore::_handleLUH<ByteOrder::LittleEndian>, &&executeLUHLittleEndian },
+        { &ProcessorCore::_handleLW<ByteOrder::BigEndian>, &&executeLWBigEndian },
+        { &ProcessorCore::_handleLW<ByteOrder::LittleEndian>, &&executeLWLittleEndian },
+        { &ProcessorCore::_handleLUW<ByteOrder::BigEndian>, &&executeLUWBigEndian },
+        { &ProcessorCore::_handleLUW<ByteOrder::LittleEndian>, &&executeLUWLittleEndian },
+        { &ProcessorCore::_handleLL<ByteOrder::BigEndian>, &&executeLLBigEndian },
+        { &ProcessorCore::_handleLL<ByteOrder::LittleEndian>, &&executeLLLittleEndian },
+        { &ProcessorCore::_handleXchg<ByteOrder::BigEndian>, &&executeXchgBigEndian },
+        { &ProcessorCore::_handleXchg<ByteOrder::LittleEndian>, &&executeXchgLittleEndian },
+        { &ProcessorCore::_handleSB, &&executeSB },
+        { &ProcessorCore::_handleSH<ByteOrder::BigEndian>, &&executeSHBigEndian },
+        { &ProcessorCore::_handleSH<ByteOrder::LittleEndian>, &&executeSHLittleEndian },
+        { &ProcessorCore::_handleSW<ByteOrder::BigEndian>, &&executeSWBigEndian },
+        { &ProcessorCore::_handleSW<ByteOrder::LittleEndian>, &&executeSWLittleEndian },
+        { &ProcessorCore::_handleSL<ByteOrder::BigEndian>, &&executeSLBigEndian },
+        { &ProcessorCore::_handleSL<ByteOrder::LittleEndian>, &&executeSLLittleEndian },
+        { &ProcessorCore::_handleLF<ByteOrder::BigEndian>, &&executeLFBigEndian },
+        { &ProcessorCore::_handleLF<ByteOrder::LittleEndian>, &&executeLFLittleEndian },
+        { &ProcessorCore::_handleLD<ByteOrder::BigEndian>, &&executeLDBigEndian },
+        { &ProcessorCore::_handleLD<ByteOrder::LittleEndian>, &&executeLDLittleEndian },
+        { &ProcessorCore::_handleSF<ByteOrder::BigEndian>, &&executeSFBigEndian },
+        { &ProcessorCore::_handleSF<ByteOrder::LittleEndian>, &&executeSFLittleEndian },
+        { &ProcessorCore::_handleSD<ByteOrder::BigEndian>, &&executeSDBigEndian },
+        { &ProcessorCore::_handleSD<ByteOrder::LittleEndian>, &&executeSDLittleEndian },
+        { &ProcessorCore::_handleBeqL, &&executeBeqL },
+        { &ProcessorCore::_handleBneL, &&executeBneL },
+        { &ProcessorCore::_handleBltL, &&executeBltL },
+        { &ProcessorCore::_handleBleL, &&executeBleL },
+        { &ProcessorCore::_handleBgtL, &&executeBgtL },
+        { &ProcessorCore::_handleBgeL, &&executeBgeL },
+        { &ProcessorCore::_handleBltUL, &&executeBltUL },
+        { &ProcessorCore::_handleBleUL, &&executeBleUL },
+        { &ProcessorCore::_handleBeqD, &&executeBeqD },
+        { &ProcessorCore::_handleBneD, &&executeBneD },
+        { &ProcessorCore::_handleBltD, &&executeBltD },
+        { &ProcessorCore::_handleBleD, &&executeBleD },
+        { &ProcessorCore::_handleBgtD, &&executeBgtD },
+        { &ProcessorCore::_handleBgeD, &&executeBgeD },
+        { &ProcessorCore::_handleBgtUL, &&executeBgtUL },
+        { &ProcessorCore::_handleBgeUL, &&executeBgeUL },
+        { &ProcessorCore::_handleInvalidInstruction, &&executeInvalidInstruction }
+    };
+
+    //  Runs the next instruction of the current basic block - unless the
+    //  quantum is over or the basic block is
+    #define HADESVM_DISPATCH_NEXT_INSTRUCTION()                                 \
+        if (cyclesTaken >= maxCycles)                                           \
+        {                                                                       \
+            goto leaveQuantumWithinBasicBlock;                                  \
+        }                                                                       \
+        if (nextDecodedInstruction == endDecodedInstructions)                   \
+        {                                                                       \
+            goto switchBasicBlock;                                              \
+        }                                                                       \
+        decodedInstruction = nextDecodedInstruction++;                          \
+        ip += 4;                                                                \
+        cc++;                                                                   \
+        goto *decodedInstruction->threadedCode;
+
+    //  Writes the hot state back to the core before a call...
+    #define HADESVM_SAVE_STATE()                                                \
+        _r[_IpRegister] = ip;                                                   \
+        _cc = cc;                                                               \
+        _nextDecodedInstruction = nextDecodedInstruction;                       \
+        _nextDecodedInstructionAddress = ip;
+
+    //  ...and picks it up after the call, which may have raised an interrupt,
+    //  jumped, changed $state or $cc or stored into code
+    #define HADESVM_RESUME_AFTER_CALL()                                         \
+        cc = _cc;                                                               \
+        if (_r[_IpRegister] != ip ||                                            \
+            _nextDecodedInstruction != nextDecodedInstruction ||                \
+            _state != entryState ||                                             \
+            _basicBlockInvalidationPending.load(std::memory_order_relaxed))     \
+        {                                                                       \
+            ip = _r[_IpRegister];                                               \
+            goto switchBasicBlock;                                              \
+        }                                                                       \
+        HADESVM_DISPATCH_NEXT_INSTRUCTION();
+
+    #define HADESVM_CALL_HANDLER(handler)                                       \
+        HADESVM_SAVE_STATE();                                                   \
+        cyclesTaken += handler(decodedInstruction->instruction);                \
+        HADESVM_RESUME_AFTER_CALL();
+
+    #define HADESVM_CALL_EXECUTOR(executor)                                     \
+        HADESVM_SAVE_STATE();                                                   \
+        cyclesTaken += executor(*decodedInstruction);                           \
+        HADESVM_RESUME_AFTER_CALL();
+
+    //  Executors that can neither raise an interrupt nor jump need no calls
+    #define HADESVM_RUN_EXECUTOR(executor)                                      \
+        cyclesTaken += executor(*decodedInstruction);                           \
+        HADESVM_DISPATCH_NEXT_INSTRUCTION();
+
+    //  Picks the hot state up after a fused run, which may have been cut
+    //  short; if it has only been cut short by "maxCycles", the dispatch
+    //  goes on from the instruction $ip is at
+    #define HADESVM_RESUME_AFTER_FUSED_RUN()                                    \
+        cc = _cc;                                                               \
+        if (_r[_IpRegister] - ip >= 4 * decodedInstruction->fusedLength ||      \
+            (_r[_IpRegister] - ip) % 4 != 0 ||                                  \
+            _state != entryState ||                                             \
+            _basicBlockInvalidationPending.load(std::memory_order_relaxed))     \
+        {                                                                       \
+            ip = _r[_IpRegister];                                               \
+            goto switchBasicBlock;                                              \
+        }                                                                       \
+        nextDecodedInstruction += (_r[_IpRegister] - ip) / 4;                   \
+        ip = _r[_IpRegister];                                                   \
+        HADESVM_DISPATCH_NEXT_INSTRUCTION();
+
+switchBasicBlock:
+    //  "ip" and "cc" are current here, the rest of the hot state is not
+    _r[_IpRegister] = ip;
+    _cc = cc;
+    if (cyclesTaken >= maxCycles || _state != entryState || _itc != entryItc)
+    {   //  Let the caller take over
+        goto leaveQuantum;
+    }
+    if (!_enterBasicBlock(ip))
+    {   //  OOPS! The fetch has failed and raised an interrupt
+        _cc++;
+        cyclesTaken++;
+        ip = _r[_IpRegister];
+        cc = _cc;
+        goto leaveQuantum;
+    }
+    nextDecodedInstruction = _nextDecodedInstruction;
+    endDecodedInstructions = _endDecodedInstructions;
+    if (nextDecodedInstruction->threadedCode == nullptr)
+    {   //  1st execution of this basic block by the threaded engine - thread it
+        for (_DecodedInstruction * instruction = const_cast<_DecodedInstruction*>(nextDecodedInstruction);
+             instruction != endDecodedInstructions; instruction++)
+        {
+            instruction->threadedCode = &&executeInvalidInstruction;
+            for (const ThreadedExecutor & threadedExecutor : ThreadedExecutors)
+            {
+                if (threadedExecutor.executor == instruction->executor)
+                {
+                    instruction->threadedCode = threadedExecutor.threadedCode;
+                    break;
+                }
+            }
+            if (instruction->executor == &ProcessorCore::_executeUndecoded)
+            {
+                for (const ThreadedHandler & threadedHandler : ThreadedHandlers)
+                {
+                    if (threadedHandler.handler == instruction->handler)
+                    {
+                        instruction->threadedCode = threadedHandler.threadedCode;
+                        break;
+                    }
+                }
+            }
+            //  The instruction may start a fused run (see _fuseInstructions)
+            if (instruction->fusedExecutor != nullptr)
+            {
+                instruction->threadedCode = &&executeFused;
+            }
+        }
+    }
+    if (translating && !_performanceMonitoringEnabled &&
+        (_currentBasicBlock->translatedCode != nullptr ||
+         (_currentBasicBlock->executionCount >= _HotBasicBlockThreshold && _translateBasicBlock(_currentBasicBlock))))
+    {   //  Run the translation of this basic block (and of the basic blocks
+        //  it is linked to), then go on where it has left
+        cyclesTaken = _runTranslatedCode(cyclesTaken, maxCycles);
+        ip = _r[_IpRegister];
+        cc = _cc;
+        if (_translatedCodeExit == nullptr)
+        {
+            goto switchBasicBlock;
+        }
+        nextDecodedInstruction = _translatedCodeExit;
+        endDecodedInstructions = _currentBasicBlock->instructions + _currentBasicBlock->numInstructions;
+        HADESVM_DISPATCH_NEXT_INSTRUCTION();
+    }
+    decodedInstruction = nextDecodedInstruction++;
+    ip += 4;
+    cc++;
+    goto *decodedInstruction->threadedCode;
+
+    //  Instructions run from their decoded operands
+executeDecodedLiL:
+    HADESVM_RUN_EXECUTOR(_executeLiL);
+executeDecodedMovL:
+    HADESVM_RUN_EXECUTOR(_executeMovL);
+executeDecodedNop:
+    HADESVM_RUN_EXECUTOR(_executeNop);
+executeDecodedAddL:
+    if (_isAddOverflow(_r[decodedInstruction->r2], _r[decodedInstruction->r3]))
+    {   //  May raise an interrupt
+        HADESVM_CALL_EXECUTOR(_executeAddL);
+    }
+    HADESVM_RUN_EXECUTOR(_executeAddL);
+executeDecodedSubL:
+    if (_isSubtractOverflow(_r[decodedInstruction->r2], _r[decodedInstruction->r3]))
+    {   //  May raise an interrupt
+        HADESVM_CALL_EXECUTOR(_executeSubL);
+    }
+    HADESVM_RUN_EXECUTOR(_executeSubL);
+executeDecodedAddiL:
+    if (_isAddOverflow(_r[decodedInstruction->r2], decodedInstruction->imm))
+    {   //  May raise an interrupt
+        HADESVM_CALL_EXECUTOR(_executeAddiL);
+    }
+    HADESVM_RUN_EXECUTOR(_executeAddiL);
+executeDecodedSubiL:
+    if (_isSubtractOverflow(_r[decodedInstruction->r2], decodedInstruction->imm))
+    {   //  May raise an interrupt
+        HADESVM_CALL_EXECUTOR(_executeSubiL);
+    }
+    HADESVM_RUN_EXECUTOR(_executeSubiL);
+executeDecodedAndL:
+    HADESVM_RUN_EXECUTOR(_executeAndL);
+executeDecodedOrL:
+    HADESVM_RUN_EXECUTOR(_executeOrL);
+executeDecodedXorL:
+    HADESVM_RUN_EXECUTOR(_executeXorL);
+executeDecodedAndiL:
+    HADESVM_RUN_EXECUTOR(_executeAndiL);
+executeDecodedOriL:
+    HADESVM_RUN_EXECUTOR(_executeOriL);
+executeDecodedXoriL:
+    HADESVM_RUN_EXECUTOR(_executeXoriL);
+executeDecodedSeqL:
+    HADESVM_RUN_EXECUTOR(_executeSeqL);
+executeDecodedSltL:
+    HADESVM_RUN_EXECUTOR(_executeSltL);
+executeDecodedSltUL:
+    HADESVM_RUN_EXECUTOR(_executeSltUL);
+executeDecodedSeqiL:
+    HADESVM_RUN_EXECUTOR(_executeSeqiL);
+executeDecodedSltiL:
+    HADESVM_RUN_EXECUTOR(_executeSltiL);
+executeDecodedLLBigEndian:
+    HADESVM_CALL_EXECUTOR(_executeLL<ByteOrder::BigEndian>);
+executeDecodedLLLittleEndian:
+    HADESVM_CALL_EXECUTOR(_executeLL<ByteOrder::LittleEndian>);
+executeDecodedSLBigEndian:
+    HADESVM_CALL_EXECUTOR(_executeSL<ByteOrder::BigEndian>);
+executeDecodedSLLittleEndian:
+    HADESVM_CALL_EXECUTOR(_executeSL<ByteOrder::LittleEndian>);
+executeDecodedLdmBigEndian:
+    HADESVM_CALL_EXECUTOR(_executeLdm<ByteOrder::BigEndian>);
+executeDecodedLdmLittleEndian:
+    HADESVM_CALL_EXECUTOR(_executeLdm<ByteOrder::LittleEndian>);
+executeDecodedStmBigEndian:
+    HADESVM_CALL_EXECUTOR(_executeStm<ByteOrder::BigEndian>);
+executeDecodedStmLittleEndian:
+    HADESVM_CALL_EXECUTOR(_executeStm<ByteOrder::LittleEndian>);
+executeDecodedBeqL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isEqual>);
+executeDecodedBneL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isNotEqual>);
+executeDecodedBltL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isLess>);
+executeDecodedBleL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isLessOrEqual>);
+executeDecodedBgtL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isGreater>);
+executeDecodedBgeL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isGreaterOrEqual>);
+executeDecodedBltUL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isLessUnsigned>);
+executeDecodedBleUL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isLessOrEqualUnsigned>);
+executeDecodedBgtUL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isGreaterUnsigned>);
+executeDecodedBgeUL:
+    HADESVM_CALL_EXECUTOR(_executeBranch<&ProcessorCore::_isGreaterOrEqualUnsigned>);
+executeDecodedJ:
+    HADESVM_CALL_EXECUTOR(_executeJ);
+executeDecodedJal:
+    HADESVM_CALL_EXECUTOR(_executeJal);
+executeDecodedJr:
+    HADESVM_CALL_EXECUTOR(_executeJr);
+executeDecodedJalr:
+    HADESVM_CALL_EXECUTOR(_executeJalr);
+
+    //  Instructions run by their handlers
+executeLiL:
+    HADESVM_CALL_HANDLER(_handleLiL);
+executeShliB:
+    HADESVM_CALL_HANDLER(_handleShliB);
+executeShliUB:
+    HADESVM_CALL_HANDLER(_handleShliUB);
+executeShliH:
+    HADESVM_CALL_HANDLER(_handleShliH);
+executeShliUH:
+    HADESVM_CALL_HANDLER(_handleShliUH);
+executeShliW:
+    HADESVM_CALL_HANDLER(_handleShliW);
+executeShliUW:
+    HADESVM_CALL_HANDLER(_handleShliUW);
+executeShliL:
+    HADESVM_CALL_HANDLER(_handleShliL);
+executeShriB:
+    HADESVM_CALL_HANDLER(_handleShriB);
+executeShriUB:
+    HADESVM_CALL_HANDLER(_handleShriUB);
+executeShriH:
+    HADESVM_CALL_HANDLER(_handleShriH);
+executeShriUH:
+    HADESVM_CALL_HANDLER(_handleShriUH);
+executeShriW:
+    HADESVM_CALL_HANDLER(_handleShriW);
+executeShriUW:
+    HADESVM_CALL_HANDLER(_handleShriUW);
+executeShriL:
+    HADESVM_CALL_HANDLER(_handleShriL);
+executeAsliB:
+    HADESVM_CALL_HANDLER(_handleAsliB);
+executeAsliUB:
+    HADESVM_CALL_HANDLER(_handleAsliUB);
+executeAsliH:
+    HADESVM_CALL_HANDLER(_handleAsliH);
+executeAsliUH:
+    HADESVM_CALL_HANDLER(_handleAsliUH);
+executeAsliW:
+    HADESVM_CALL_HANDLER(_handleAsliW);
+executeAsliUW:
+    HADESVM_CALL_HANDLER(_handleAsliUW);
+executeAsliL:
+    HADESVM_CALL_HANDLER(_handleAsliL);
+executeAsriB:
+    HADESVM_CALL_HANDLER(_handleAsriB);
+executeAsriUB:
+    HADESVM_CALL_HANDLER(_handleAsriUB);
+executeAsriH:
+    HADESVM_CALL_HANDLER(_handleAsriH);
+executeAsriUH:
+    HADESVM_CALL_HANDLER(_handleAsriUH);
+executeAsriW:
+    HADESVM_CALL_HANDLER(_handleAsriW);
+executeAsriUW:
+    HADESVM_CALL_HANDLER(_handleAsriUW);
+executeAsriL:
+    HADESVM_CALL_HANDLER(_handleAsriL);
+executeRoliB:
+    HADESVM_CALL_HANDLER(_handleRoliB);
+executeRoliUB:
+    HADESVM_CALL_HANDLER(_handleRoliUB);
+executeRoliH:
+    HADESVM_CALL_HANDLER(_handleRoliH);
+executeRoliUH:
+    HADESVM_CALL_HANDLER(_handleRoliUH);
+executeRoliW:
+    HADESVM_CALL_HANDLER(_handleRoliW);
+executeRoliUW:
+    HADESVM_CALL_HANDLER(_handleRoliUW);
+executeRoliL:
+    HADESVM_CALL_HANDLER(_handleRoliL);
+executeRoriB:
+    HADESVM_CALL_HANDLER(_handleRoriB);
+executeRoriUB:
+    HADESVM_CALL_HANDLER(_handleRoriUB);
+executeRoriH:
+    HADESVM_CALL_HANDLER(_handleRoriH);
+executeRoriUH:
+    HADESVM_CALL_HANDLER(_handleRoriUH);
+executeRoriW:
+    HADESVM_CALL_HANDLER(_handleRoriW);
+executeRoriUW:
+    HADESVM_CALL_HANDLER(_handleRoriUW);
+executeRoriL:
+    HADESVM_CALL_HANDLER(_handleRoriL);
+executeBeqiL:
+    HADESVM_CALL_HANDLER(_handleBeqiL);
+executeBneiL:
+    HADESVM_CALL_HANDLER(_handleBneiL);
+executeBltiL:
+    HADESVM_CALL_HANDLER(_handleBltiL);
+executeBleiL:
+    HADESVM_CALL_HANDLER(_handleBleiL);
+executeBgtiL:
+    HADESVM_CALL_HANDLER(_handleBgtiL);
+executeBgeiL:
+    HADESVM_CALL_HANDLER(_handleBgeiL);
+executeBltiUL:
+    HADESVM_CALL_HANDLER(_handleBltiUL);
+executeBleiUL:
+    HADESVM_CALL_HANDLER(_handleBleiUL);
+executeBgtiUL:
+    HADESVM_CALL_HANDLER(_handleBgtiUL);
+executeBgeiUL:
+    HADESVM_CALL_HANDLER(_handleBgeiUL);
+executeBfiL:
+    HADESVM_CALL_HANDLER(_handleBfiL);
+executeBfeL:
+    HADESVM_CALL_HANDLER(_handleBfeL);
+executeBfeUL:
+    HADESVM_CALL_HANDLER(_handleBfeUL);
+executeMovCR:
+    HADESVM_CALL_HANDLER(_handleMovCR);
+executeMovRC:
+    HADESVM_CALL_HANDLER(_handleMovRC);
+executeMovMR:
+    HADESVM_CALL_HANDLER(_handleMovMR);
+executeMovRM:
+    HADESVM_SAVE_STATE();
+    cyclesTaken += _handleMovRM(decodedInstruction->instruction);
+    if (_performanceMonitoringEnabled)
+    {   //  Counting may have just been switched on - end the quantum, so
+        //  that the caller counts from the next instruction on
+        maxCycles = cyclesTaken;
+    }
+    HADESVM_RESUME_AFTER_CALL();
+executeIret:
+    HADESVM_CALL_HANDLER(_handleIret);
+executeHalt:
+    HADESVM_CALL_HANDLER(_handleHalt);
+executeCpuid:
+    HADESVM_CALL_HANDLER(_handleCpuid);
+executeSigp:
+    HADESVM_CALL_HANDLER(_handleSigp);
+executeTstp:
+    HADESVM_CALL_HANDLER(_handleTstp);
+executeSetp:
+    HADESVM_CALL_HANDLER(_handleSetp);
+executeInB:
+    HADESVM_CALL_HANDLER(_handleInB);
+executeInH:
+    HADESVM_CALL_HANDLER(_handleInH);
+executeInW:
+    HADESVM_CALL_HANDLER(_handleInW);
+executeInL:
+    HADESVM_CALL_HANDLER(_handleInL);
+executeOutB:
+    HADESVM_CALL_HANDLER(_handleOutB);
+executeOutH:
+    HADESVM_CALL_HANDLER(_handleOutH);
+executeOutL:
+    HADESVM_CALL_HANDLER(_handleOutL);
+executeInUB:
+    HADESVM_CALL_HANDLER(_handleInUB);
+executeInUH:
+    HADESVM_CALL_HANDLER(_handleInUH);
+executeInUW:
+    HADESVM_CALL_HANDLER(_handleInUW);
+executeMovL:
+    HADESVM_CALL_HANDLER(_handleMovL);
+executeCvtBL:
+    HADESVM_CALL_HANDLER(_handleCvtBL);
+executeCvtUBL:
+    HADESVM_CALL_HANDLER(_handleCvtUBL);
+executeCvtHL:
+    HADESVM_CALL_HANDLER(_handleCvtHL);
+executeCvtUHL:
+    HADESVM_CALL_HANDLER(_handleCvtUHL);
+executeCvtWL:
+    HADESVM_CALL_HANDLER(_handleCvtWL);
+executeCvtUWL:
+    HADESVM_CALL_HANDLER(_handleCvtUWL);
+executeNop:
+    HADESVM_CALL_HANDLER(_handleNop);
+executeAndB:
+    HADESVM_CALL_HANDLER(_handleAndB);
+executeAndUB:
+    HADESVM_CALL_HANDLER(_handleAndUB);
+executeAndH:
+    HADESVM_CALL_HANDLER(_handleAndH);
+executeAndUH:
+    HADESVM_CALL_HANDLER(_handleAndUH);
+executeAndW:
+    HADESVM_CALL_HANDLER(_handleAndW);
+executeAndUW:
+    HADESVM_CALL_HANDLER(_handleAndUW);
+executeAndL:
+    HADESVM_CALL_HANDLER(_handleAndL);
+executeSwapH:
+    HADESVM_CALL_HANDLER(_handleSwapH);
+executeOrB:
+    HADESVM_CALL_HANDLER(_handleOrB);
+executeOrUB:
+    HADESVM_CALL_HANDLER(_handleOrUB);
+executeOrH:
+    HADESVM_CALL_HANDLER(_handleOrH);
+executeOrUH:
+    HADESVM_CALL_HANDLER(_handleOrUH);
+executeOrW:
+    HADESVM_CALL_HANDLER(_handleOrW);
+executeOrUW:
+    HADESVM_CALL_HANDLER(_handleOrUW);
+executeOrL:
+    HADESVM_CALL_HANDLER(_handleOrL);
+executeSwapUH:
+    HADESVM_CALL_HANDLER(_handleSwapUH);
+executeXorB:
+    HADESVM_CALL_HANDLER(_handleXorB);
+executeXorUB:
+    HADESVM_CALL_HANDLER(_handleXorUB);
+executeXorH:
+    HADESVM_CALL_HANDLER(_handleXorH);
+executeXorUH:
+    HADESVM_CALL_HANDLER(_handleXorUH);
+executeXorW:
+    HADESVM_CALL_HANDLER(_handleXorW);
+executeXorUW:
+    HADESVM_CALL_HANDLER(_handleXorUW);
+executeXorL:
+    HADESVM_CALL_HANDLER(_handleXorL);
+executeSwapW:
+    HADESVM_CALL_HANDLER(_handleSwapW);
+executeNotB:
+    HADESVM_CALL_HANDLER(_handleNotB);
+executeNotUB:
+    HADESVM_CALL_HANDLER(_handleNotUB);
+executeNotH:
+    HADESVM_CALL_HANDLER(_handleNotH);
+executeNotUH:
+    HADESVM_CALL_HANDLER(_handleNotUH);
+executeNotW:
+    HADESVM_CALL_HANDLER(_handleNotW);
+executeNotUW:
+    HADESVM_CALL_HANDLER(_handleNotUW);
+executeNotL:
+    HADESVM_CALL_HANDLER(_handleNotL);
+executeSwapUW:
+    HADESVM_CALL_HANDLER(_handleSwapUW);
+executeBrevB:
+    HADESVM_CALL_HANDLER(_handleBrevB);
+executeBrevUB:
+    HADESVM_CALL_HANDLER(_handleBrevUB);
+executeBrevH:
+    HADESVM_CALL_HANDLER(_handleBrevH);
+executeBrevUH:
+    HADESVM_CALL_HANDLER(_handleBrevUH);
+executeBrevW:
+    HADESVM_CALL_HANDLER(_handleBrevW);
+executeBrevUW:
+    HADESVM_CALL_HANDLER(_handleBrevUW);
+executeBrevL:
+    HADESVM_CALL_HANDLER(_handleBrevL);
+executeSwapL:
+    HADESVM_CALL_HANDLER(_handleSwapL);
+executeSeqL:
+    HADESVM_CALL_HANDLER(_handleSeqL);
+executeSneL:
+    HADESVM_CALL_HANDLER(_handleSneL);
+executeSltL:
+    HADESVM_CALL_HANDLER(_handleSltL);
+executeSleL:
+    HADESVM_CALL_HANDLER(_handleSleL);
+executeSgtL:
+    HADESVM_CALL_HANDLER(_handleSgtL);
+executeSgeL:
+    HADESVM_CALL_HANDLER(_handleSgeL);
+executeClz:
+    HADESVM_CALL_HANDLER(_handleClz);
+executeCtz:
+    HADESVM_CALL_HANDLER(_handleCtz);
+executeJr:
+    HADESVM_CALL_HANDLER(_handleJr);
+executeJalr:
+    HADESVM_CALL_HANDLER(_handleJalr);
+executeSltUL:
+    HADESVM_CALL_HANDLER(_handleSltUL);
+executeSleUL:
+    HADESVM_CALL_HANDLER(_handleSleUL);
+executeSgtUL:
+    HADESVM_CALL_HANDLER(_handleSgtUL);
+executeSgeUL:
+    HADESVM_CALL_HANDLER(_handleSgeUL);
+executeClo:
+    HADESVM_CALL_HANDLER(_handleClo);
+executeCto:
+    HADESVM_CALL_HANDLER(_handleCto);
+executeAddB:
+    HADESVM_CALL_HANDLER(_handleAddB);
+executeSubB:
+    HADESVM_CALL_HANDLER(_handleSubB);
+executeMulB:
+    HADESVM_CALL_HANDLER(_handleMulB);
+executeDivB:
+    HADESVM_CALL_HANDLER(_handleDivB);
+executeModB:
+    HADESVM_CALL_HANDLER(_handleModB);
+executeAbsB:
+    HADESVM_CALL_HANDLER(_handleAbsB);
+executeNegB:
+    HADESVM_CALL_HANDLER(_handleNegB);
+executeImplB:
+    HADESVM_CALL_HANDLER(_handleImplB);
+executeAddUB:
+    HADESVM_CALL_HANDLER(_handleAddUB);
+executeSubUB:
+    HADESVM_CALL_HANDLER(_handleSubUB);
+executeMulUB:
+    HADESVM_CALL_HANDLER(_handleMulUB);
+executeDivUB:
+    HADESVM_CALL_HANDLER(_handleDivUB);
+executeModUB:
+    HADESVM_CALL_HANDLER(_handleModUB);
+executeCpl2UB:
+    HADESVM_CALL_HANDLER(_handleCpl2UB);
+executeImplUB:
+    HADESVM_CALL_HANDLER(_handleImplUB);
+executeAddH:
+    HADESVM_CALL_HANDLER(_handleAddH);
+executeSubH:
+    HADESVM_CALL_HANDLER(_handleSubH);
+executeMulH:
+    HADESVM_CALL_HANDLER(_handleMulH);
+executeDivH:
+    HADESVM_CALL_HANDLER(_handleDivH);
+executeModH:
+    HADESVM_CALL_HANDLER(_handleModH);
+executeAbsH:
+    HADESVM_CALL_HANDLER(_handleAbsH);
+executeNegH:
+    HADESVM_CALL_HANDLER(_handleNegH);
+executeImplH:
+    HADESVM_CALL_HANDLER(_handleImplH);
+executeAddUH:
+    HADESVM_CALL_HANDLER(_handleAddUH);
+executeSubUH:
+    HADESVM_CALL_HANDLER(_handleSubUH);
+executeMulUH:
+    HADESVM_CALL_HANDLER(_handleMulUH);
+executeDivUH:
+    HADESVM_CALL_HANDLER(_handleDivUH);
+executeModUH:
+    HADESVM_CALL_HANDLER(_handleModUH);
+executeCpl2UH:
+    HADESVM_CALL_HANDLER(_handleCpl2UH);
+executeImplUH:
+    HADESVM_CALL_HANDLER(_handleImplUH);
+executeAddW:
+    HADESVM_CALL_HANDLER(_handleAddW);
+executeSubW:
+    HADESVM_CALL_HANDLER(_handleSubW);
+executeMulW:
+    HADESVM_CALL_HANDLER(_handleMulW);
+executeDivW:
+    HADESVM_CALL_HANDLER(_handleDivW);
+executeModW:
+    HADESVM_CALL_HANDLER(_handleModW);
+executeAbsW:
+    HADESVM_CALL_HANDLER(_handleAbsW);
+executeNegW:
+    HADESVM_CALL_HANDLER(_handleNegW);
+executeImplW:
+    HADESVM_CALL_HANDLER(_handleImplW);
+executeAddUW:
+    HADESVM_CALL_HANDLER(_handleAddUW);
+executeSubUW:
+    HADESVM_CALL_HANDLER(_handleSubUW);
+executeMulUW:
+    HADESVM_CALL_HANDLER(_handleMulUW);
+executeDivUW:
+    HADESVM_CALL_HANDLER(_handleDivUW);
+executeModUW:
+    HADESVM_CALL_HANDLER(_handleModUW);
+executeCpl2UW:
+    HADESVM_CALL_HANDLER(_handleCpl2UW);
+executeImplUW:
+    HADESVM_CALL_HANDLER(_handleImplUW);
+executeAddL:
+    HADESVM_CALL_HANDLER(_handleAddL);
+executeSubL:
+    HADESVM_CALL_HANDLER(_handleSubL);
+executeMulL:
+    HADESVM_CALL_HANDLER(_handleMulL);
+executeDivL:
+    HADESVM_CALL_HANDLER(_handleDivL);
+executeModL:
+    HADESVM_CALL_HANDLER(_handleModL);
+executeAbsL:
+    HADESVM_CALL_HANDLER(_handleAbsL);
+executeNegL:
+    HADESVM_CALL_HANDLER(_handleNegL);
+executeImplL:
+    HADESVM_CALL_HANDLER(_handleImplL);
+executeAddUL:
+    HADESVM_CALL_HANDLER(_handleAddUL);
+executeSubUL:
+    HADESVM_CALL_HANDLER(_handleSubUL);
+executeMulUL:
+    HADESVM_CALL_HANDLER(_handleMulUL);
+executeDivUL:
+    HADESVM_CALL_HANDLER(_handleDivUL);
+executeModUL:
+    HADESVM_CALL_HANDLER(_handleModUL);
+executeCpl2UL:
+    HADESVM_CALL_HANDLER(_handleCpl2UL);
+executeAddiB:
+    HADESVM_CALL_HANDLER(_handleAddiB);
+executeAddiUB:
+    HADESVM_CALL_HANDLER(_handleAddiUB);
+executeAddiH:
+    HADESVM_CALL_HANDLER(_handleAddiH);
+executeAddiUH:
+    HADESVM_CALL_HANDLER(_handleAddiUH);
+executeAddiW:
+    HADESVM_CALL_HANDLER(_handleAddiW);
+executeAddiUW:
+    HADESVM_CALL_HANDLER(_handleAddiUW);
+executeModiB:
+    HADESVM_CALL_HANDLER(_handleModiB);
+executeModiUB:
+    HADESVM_CALL_HANDLER(_handleModiUB);
+executeSubiB:
+    HADESVM_CALL_HANDLER(_handleSubiB);
+executeSubiUB:
+    HADESVM_CALL_HANDLER(_handleSubiUB);
+executeSubiH:
+    HADESVM_CALL_HANDLER(_handleSubiH);
+executeSubiUH:
+    HADESVM_CALL_HANDLER(_handleSubiUH);
+executeSubiW:
+    HADESVM_CALL_HANDLER(_handleSubiW);
+executeSubiUW:
+    HADESVM_CALL_HANDLER(_handleSubiUW);
+executeModiH:
+    HADESVM_CALL_HANDLER(_handleModiH);
+executeModiUH:
+    HADESVM_CALL_HANDLER(_handleModiUH);
+executeMuliB:
+    HADESVM_CALL_HANDLER(_handleMuliB);
+executeMuliUB:
+    HADESVM_CALL_HANDLER(_handleMuliUB);
+executeMuliH:
+    HADESVM_CALL_HANDLER(_handleMuliH);
+executeMuliUH:
+    HADESVM_CALL_HANDLER(_handleMuliUH);
+executeMuliW:
+    HADESVM_CALL_HANDLER(_handleMuliW);
+executeMuliUW:
+    HADESVM_CALL_HANDLER(_handleMuliUW);
+executeModiW:
+    HADESVM_CALL_HANDLER(_handleModiW);
+executeModiUW:
+    HADESVM_CALL_HANDLER(_handleModiUW);
+executeDiviB:
+    HADESVM_CALL_HANDLER(_handleDiviB);
+executeDiviUB:
+    HADESVM_CALL_HANDLER(_handleDiviUB);
+executeDiviH:
+    HADESVM_CALL_HANDLER(_handleDiviH);
+executeDiviUH:
+    HADESVM_CALL_HANDLER(_handleDiviUH);
+executeDiviW:
+    HADESVM_CALL_HANDLER(_handleDiviW);
+executeDiviUW:
+    HADESVM_CALL_HANDLER(_handleDiviUW);
+executeShlB:
+    HADESVM_CALL_HANDLER(_handleShlB);
+executeShrB:
+    HADESVM_CALL_HANDLER(_handleShrB);
+executeAslB:
+    HADESVM_CALL_HANDLER(_handleAslB);
+executeAsrB:
+    HADESVM_CALL_HANDLER(_handleAsrB);
+executeRolB:
+    HADESVM_CALL_HANDLER(_handleRolB);
+executeRorB:
+    HADESVM_CALL_HANDLER(_handleRorB);
+executeShlH:
+    HADESVM_CALL_HANDLER(_handleShlH);
+executeShrH:
+    HADESVM_CALL_HANDLER(_handleShrH);
+executeAslH:
+    HADESVM_CALL_HANDLER(_handleAslH);
+executeAsrH:
+    HADESVM_CALL_HANDLER(_handleAsrH);
+executeRolH:
+    HADESVM_CALL_HANDLER(_handleRolH);
+executeRorH:
+    HADESVM_CALL_HANDLER(_handleRorH);
+executeShlW:
+    HADESVM_CALL_HANDLER(_handleShlW);
+executeShrW:
+    HADESVM_CALL_HANDLER(_handleShrW);
+executeAslW:
+    HADESVM_CALL_HANDLER(_handleAslW);
+executeAsrW:
+    HADESVM_CALL_HANDLER(_handleAsrW);
+executeRolW:
+    HADESVM_CALL_HANDLER(_handleRolW);
+executeRorW:
+    HADESVM_CALL_HANDLER(_handleRorW);
+executeShlUB:
+    HADESVM_CALL_HANDLER(_handleShlUB);
+executeShrUB:
+    HADESVM_CALL_HANDLER(_handleShrUB);
+executeAslUB:
+    HADESVM_CALL_HANDLER(_handleAslUB);
+executeAsrUB:
+    HADESVM_CALL_HANDLER(_handleAsrUB);
+executeRolUB:
+    HADESVM_CALL_HANDLER(_handleRolUB);
+executeRorUB:
+    HADESVM_CALL_HANDLER(_handleRorUB);
+executeShlUH:
+    HADESVM_CALL_HANDLER(_handleShlUH);
+executeShrUH:
+    HADESVM_CALL_HANDLER(_handleShrUH);
+executeAslUH:
+    HADESVM_CALL_HANDLER(_handleAslUH);
+executeAsrUH:
+    HADESVM_CALL_HANDLER(_handleAsrUH);
+executeRolUH:
+    HADESVM_CALL_HANDLER(_handleRolUH);
+executeRorUH:
+    HADESVM_CALL_HANDLER(_handleRorUH);
+executeShlUW:
+    HADESVM_CALL_HANDLER(_handleShlUW);
+executeShrUW:
+    HADESVM_CALL_HANDLER(_handleShrUW);
+executeAslUW:
+    HADESVM_CALL_HANDLER(_handleAslUW);
+executeAsrUW:
+    HADESVM_CALL_HANDLER(_handleAsrUW);
+executeRolUW:
+    HADESVM_CALL_HANDLER(_handleRolUW);
+executeRorUW:
+    HADESVM_CALL_HANDLER(_handleRorUW);
+executeShlL:
+    HADESVM_CALL_HANDLER(_handleShlL);
+executeShrL:
+    HADESVM_CALL_HANDLER(_handleShrL);
+executeAslL:
+    HADESVM_CALL_HANDLER(_handleAslL);
+executeAsrL:
+    HADESVM_CALL_HANDLER(_handleAsrL);
+executeRolL:
+    HADESVM_CALL_HANDLER(_handleRolL);
+executeRorL:
+    HADESVM_CALL_HANDLER(_handleRorL);
+executeGetfl:
+    HADESVM_CALL_HANDLER(_handleGetfl);
+executeSetfl:
+    HADESVM_CALL_HANDLER(_handleSetfl);
+executeRstfl:
+    HADESVM_CALL_HANDLER(_handleRstfl);
+executeSvc:
+    HADESVM_CALL_HANDLER(_handleSvc);
+executeBrk:
+    HADESVM_CALL_HANDLER(_handleBrk);
+executeMovD:
+    HADESVM_CALL_HANDLER(_handleMovD);
+executeCvtDF:
+    HADESVM_CALL_HANDLER(_handleCvtDF);
+executeAddD:
+    HADESVM_CALL_HANDLER(_handleAddD);
+executeSubD:
+    HADESVM_CALL_HANDLER(_handleSubD);
+executeMulD:
+    HADESVM_CALL_HANDLER(_handleMulD);
+executeDivD:
+    HADESVM_CALL_HANDLER(_handleDivD);
+executeAbsD:
+    HADESVM_CALL_HANDLER(_handleAbsD);
+executeNegD:
+    HADESVM_CALL_HANDLER(_handleNegD);
+executeSqrtD:
+    HADESVM_CALL_HANDLER(_handleSqrtD);
+executeAddF:
+    HADESVM_CALL_HANDLER(_handleAddF);
+executeSubF:
+    HADESVM_CALL_HANDLER(_handleSubF);
+executeMulF:
+    HADESVM_CALL_HANDLER(_handleMulF);
+executeDivF:
+    HADESVM_CALL_HANDLER(_handleDivF);
+executeAbsF:
+    HADESVM_CALL_HANDLER(_handleAbsF);
+executeNegF:
+    HADESVM_CALL_HANDLER(_handleNegF);
+executeSqrtF:
+    HADESVM_CALL_HANDLER(_handleSqrtF);
+executeSeqD:
+    HADESVM_CALL_HANDLER(_handleSeqD);
+executeSneD:
+    HADESVM_CALL_HANDLER(_handleSneD);
+executeSltD:
+    HADESVM_CALL_HANDLER(_handleSltD);
+executeSleD:
+    HADESVM_CALL_HANDLER(_handleSleD);
+executeSgtD:
+    HADESVM_CALL_HANDLER(_handleSgtD);
+executeSgeD:
+    HADESVM_CALL_HANDLER(_handleSgeD);
+executeCvtFB:
+    HADESVM_CALL_HANDLER(_handleCvtFB);
+executeCvtFH:
+    HADESVM_CALL_HANDLER(_handleCvtFH);
+executeCvtFW:
+    HADESVM_CALL_HANDLER(_handleCvtFW);
+executeCvtFL:
+    HADESVM_CALL_HANDLER(_handleCvtFL);
+executeCvtFUB:
+    HADESVM_CALL_HANDLER(_handleCvtFUB);
+executeCvtFUH:
+    HADESVM_CALL_HANDLER(_handleCvtFUH);
+executeCvtFUW:
+    HADESVM_CALL_HANDLER(_handleCvtFUW);
+executeCvtFUL:
+    HADESVM_CALL_HANDLER(_handleCvtFUL);
+executeCvtBF:
+    HADESVM_CALL_HANDLER(_handleCvtBF);
+executeCvtHF:
+    HADESVM_CALL_HANDLER(_handleCvtHF);
+executeCvtWF:
+    HADESVM_CALL_HANDLER(_handleCvtWF);
+executeCvtLF:
+    HADESVM_CALL_HANDLER(_handleCvtLF);
+executeCvtUBF:
+    HADESVM_CALL_HANDLER(_handleCvtUBF);
+executeCvtUHF:
+    HADESVM_CALL_HANDLER(_handleCvtUHF);
+executeCvtUWF:
+    HADESVM_CALL_HANDLER(_handleCvtUWF);
+executeCvtULF:
+    HADESVM_CALL_HANDLER(_handleCvtULF);
+executeCvtDB:
+    HADESVM_CALL_HANDLER(_handleCvtDB);
+executeCvtDH:
+    HADESVM_CALL_HANDLER(_handleCvtDH);
+executeCvtDW:
+    HADESVM_CALL_HANDLER(_handleCvtDW);
+executeCvtDL:
+    HADESVM_CALL_HANDLER(_handleCvtDL);
+executeCvtDUB:
+    HADESVM_CALL_HANDLER(_handleCvtDUB);
+executeCvtDUH:
+    HADESVM_CALL_HANDLER(_handleCvtDUH);
+executeCvtDUW:
+    HADESVM_CALL_HANDLER(_handleCvtDUW);
+executeCvtDUL:
+    HADESVM_CALL_HANDLER(_handleCvtDUL);
+executeCvtBD:
+    HADESVM_CALL_HANDLER(_handleCvtBD);
+executeCvtHD:
+    HADESVM_CALL_HANDLER(_handleCvtHD);
+executeCvtWD:
+    HADESVM_CALL_HANDLER(_handleCvtWD);
+executeCvtLD:
+    HADESVM_CALL_HANDLER(_handleCvtLD);
+executeCvtUBD:
+    HADESVM_CALL_HANDLER(_handleCvtUBD);
+executeCvtUHD:
+    HADESVM_CALL_HANDLER(_handleCvtUHD);
+executeCvtUWD:
+    HADESVM_CALL_HANDLER(_handleCvtUWD);
+executeCvtULD:
+    HADESVM_CALL_HANDLER(_handleCvtULD);
+executeAddiL:
+    HADESVM_CALL_HANDLER(_handleAddiL);
+executeSubiL:
+    HADESVM_CALL_HANDLER(_handleSubiL);
+executeMuliL:
+    HADESVM_CALL_HANDLER(_handleMuliL);
+executeDiviL:
+    HADESVM_CALL_HANDLER(_handleDiviL);
+executeModiL:
+    HADESVM_CALL_HANDLER(_handleModiL);
+executeJ:
+    HADESVM_CALL_HANDLER(_handleJ);
+executeLiD:
+    HADESVM_CALL_HANDLER(_handleLiD);
+executeLirBigEndian:
+    HADESVM_CALL_HANDLER(_handleLir<ByteOrder::BigEndian>);
+executeLirLittleEndian:
+    HADESVM_CALL_HANDLER(_handleLir<ByteOrder::LittleEndian>);
+executeAddiUL:
+    HADESVM_CALL_HANDLER(_handleAddiUL);
+executeSubiUL:
+    HADESVM_CALL_HANDLER(_handleSubiUL);
+executeMuliUL:
+    HADESVM_CALL_HANDLER(_handleMuliUL);
+executeDiviUL:
+    HADESVM_CALL_HANDLER(_handleDiviUL);
+executeModiUL:
+    HADESVM_CALL_HANDLER(_handleModiUL);
+executeJal:
+    HADESVM_CALL_HANDLER(_handleJal);
+executeSeqiL:
+    HADESVM_CALL_HANDLER(_handleSeqiL);
+executeSneiL:
+    HADESVM_CALL_HANDLER(_handleSneiL);
+executeSltiL:
+    HADESVM_CALL_HANDLER(_handleSltiL);
+executeSleiL:
+    HADESVM_CALL_HANDLER(_handleSleiL);
+executeSgtiL:
+    HADESVM_CALL_HANDLER(_handleSgtiL);
+executeSgeiL:
+    HADESVM_CALL_HANDLER(_handleSgeiL);
+executeSltiUL:
+    HADESVM_CALL_HANDLER(_handleSltiUL);
+executeSleiUL:
+    HADESVM_CALL_HANDLER(_handleSleiUL);
+executeAndiL:
+    HADESVM_CALL_HANDLER(_handleAndiL);
+executeOriL:
+    HADESVM_CALL_HANDLER(_handleOriL);
+executeXoriL:
+    HADESVM_CALL_HANDLER(_handleXoriL);
+executeImpliL:
+    HADESVM_CALL_HANDLER(_handleImpliL);
+executeLdmBigEndian:
+    HADESVM_CALL_HANDLER(_handleLdm<ByteOrder::BigEndian>);
+executeLdmLittleEndian:
+    HADESVM_CALL_HANDLER(_handleLdm<ByteOrder::LittleEndian>);
+executeStmBigEndian:
+    HADESVM_CALL_HANDLER(_handleStm<ByteOrder::BigEndian>);
+executeStmLittleEndian:
+    HADESVM_CALL_HANDLER(_handleStm<ByteOrder::LittleEndian>);
+executeSgtiUL:
+    HADESVM_CALL_HANDLER(_handleSgtiUL);
+executeSgeiUL:
+    HADESVM_CALL_HANDLER(_handleSgeiUL);
+executeLB:
+    HADESVM_CALL_HANDLER(_handleLB);
+executeLUB:
+    HADESVM_CALL_HANDLER(_handleLUB);
+executeLHBigEndian:
+    HADESVM_CALL_HANDLER(_handleLH<ByteOrder::BigEndian>);
+executeLHLittleEndian:
+    HADESVM_CALL_HANDLER(_handleLH<ByteOrder::LittleEndian>);
+executeLUHBigEndian:
+    HADESVM_CALL_HANDLER(_handleLUH<ByteOrder::BigEndian>);
+executeLUHLittleEndian:
+    HADESVM_CALL_HANDLER(_handleLUH<ByteOrder::LittleEndian>);
+executeLWBigEndian:
+    HADESVM_CALL_HANDLER(_handleLW<ByteOrder::BigEndian>);
+executeLWLittleEndian:
+    HADESVM_CALL_HANDLER(_handleLW<ByteOrder::LittleEndian>);
+executeLUWBigEndian:
+    HADESVM_CALL_HANDLER(_handleLUW<ByteOrder::BigEndian>);
+executeLUWLittleEndian:
+    HADESVM_CALL_HANDLER(_handleLUW<ByteOrder::LittleEndian>);
+executeLLBigEndian:
+    HADESVM_CALL_HANDLER(_handleLL<ByteOrder::BigEndian>);
+executeLLLittleEndian:
+    HADESVM_CALL_HANDLER(_handleLL<ByteOrder::LittleEndian>);
+executeXchgBigEndian:
+    HADESVM_CALL_HANDLER(_handleXchg<ByteOrder::BigEndian>);
+executeXchgLittleEndian:
+    HADESVM_CALL_HANDLER(_handleXchg<ByteOrder::LittleEndian>);
+executeSB:
+    HADESVM_CALL_HANDLER(_handleSB);
+executeSHBigEndian:
+    HADESVM_CALL_HANDLER(_handleSH<ByteOrder::BigEndian>);
+executeSHLittleEndian:
+    HADESVM_CALL_HANDLER(_handleSH<ByteOrder::LittleEndian>);
+executeSWBigEndian:
+    HADESVM_CALL_HANDLER(_handleSW<ByteOrder::BigEndian>);
+executeSWLittleEndian:
+    HADESVM_CALL_HANDLER(_handleSW<ByteOrder::LittleEndian>);
+executeSLBigEndian:
+    HADESVM_CALL_HANDLER(_handleSL<ByteOrder::BigEndian>);
+executeSLLittleEndian:
+    HADESVM_CALL_HANDLER(_handleSL<ByteOrder::LittleEndian>);
+executeLFBigEndian:
+    HADESVM_CALL_HANDLER(_handleLF<ByteOrder::BigEndian>);
+executeLFLittleEndian:
+    HADESVM_CALL_HANDLER(_handleLF<ByteOrder::LittleEndian>);
+executeLDBigEndian:
+    HADESVM_CALL_HANDLER(_handleLD<ByteOrder::BigEndian>);
+executeLDLittleEndian:
+    HADESVM_CALL_HANDLER(_handleLD<ByteOrder::LittleEndian>);
+executeSFBigEndian:
+    HADESVM_CALL_HANDLER(_handleSF<ByteOrder::BigEndian>);
+executeSFLittleEndian:
+    HADESVM_CALL_HANDLER(_handleSF<ByteOrder::LittleEndian>);
+executeSDBigEndian:
+    HADESVM_CALL_HANDLER(_handleSD<ByteOrder::BigEndian>);
+executeSDLittleEndian:
+    HADESVM_CALL_HANDLER(_handleSD<ByteOrder::LittleEndian>);
+executeBeqL:
+    HADESVM_CALL_HANDLER(_handleBeqL);
+executeBneL:
+    HADESVM_CALL_HANDLER(_handleBneL);
+executeBltL:
+    HADESVM_CALL_HANDLER(_handleBltL);
+executeBleL:
+    HADESVM_CALL_HANDLER(_handleBleL);
+executeBgtL:
+    HADESVM_CALL_HANDLER(_handleBgtL);
+executeBgeL:
+    HADESVM_CALL_HANDLER(_handleBgeL);
+executeBltUL:
+    HADESVM_CALL_HANDLER(_handleBltUL);
+executeBleUL:
+    HADESVM_CALL_HANDLER(_handleBleUL);
+executeBeqD:
+    HADESVM_CALL_HANDLER(_handleBeqD);
+executeBneD:
+    HADESVM_CALL_HANDLER(_handleBneD);
+executeBltD:
+    HADESVM_CALL_HANDLER(_handleBltD);
+executeBleD:
+    HADESVM_CALL_HANDLER(_handleBleD);
+executeBgtD:
+    HADESVM_CALL_HANDLER(_handleBgtD);
+executeBgeD:
+    HADESVM_CALL_HANDLER(_handleBgeD);
+executeBgtUL:
+    HADESVM_CALL_HANDLER(_handleBgtUL);
+executeBgeUL:
+    HADESVM_CALL_HANDLER(_handleBgeUL);
+executeInvalidInstruction:
+    HADESVM_CALL_HANDLER(_handleInvalidInstruction);
+
+    //  Fused superinstructions - the whole run with a single dispatch, if
+    //  all of it fits in the quantum, else just its 1st instruction
+executeFused:
+    if (cyclesTaken + decodedInstruction->fusedLength > maxCycles)
+    {
+        HADESVM_CALL_EXECUTOR((this->*(decodedInstruction->executor)));
+    }
+    HADESVM_SAVE_STATE();
+    cyclesTaken += (this->*(decodedInstruction->fusedExecutor))(decodedInstruction, decodedInstruction->fusedLength, maxCycles - cyclesTaken);
+    HADESVM_RESUME_AFTER_FUSED_RUN();
+
+    #undef HADESVM_RESUME_AFTER_FUSED_RUN
+    #undef HADESVM_RUN_EXECUTOR
+    #undef HADESVM_CALL_EXECUTOR
+    #undef HADESVM_CALL_HANDLER
+    #undef HADESVM_RESUME_AFTER_CALL
+    #undef HADESVM_SAVE_STATE
+    #undef HADESVM_DISPATCH_NEXT_INSTRUCTION
+#else
+    //  No computed goto - run the predecoded instructions in a loop (and
+    //  run the translating engine as the threaded one)
+    for (;;)
+    {
+        if (_r[_IpRegister] != _nextDecodedInstructionAddress ||
+            _nextDecodedInstruction == _endDecodedInstructions ||
+            _state != entryState ||
+            _basicBlockInvalidationPending.load(std::memory_order_relaxed))
+        {
+            if (_state != entryState || _itc != entryItc)
+            {   //  Let the caller take over
+                break;
+            }
+            if (!_enterBasicBlock(_r[_IpRegister]))
+            {   //  OOPS! The fetch has failed and raised an interrupt
+                _cc++;
+                cyclesTaken++;
+                break;
+            }
+        }
+        decodedInstruction = _nextDecodedInstruction++;
+        _nextDecodedInstructionAddress += 4;
+        _r[_IpRegister] += 4;
+        _cc++;
+        cyclesTaken += (this->*(decodedInstruction->executor))(*decodedInstruction);
+        if (cyclesTaken >= maxCycles || _performanceMonitoringEnabled)
+        {   //  ...the latter in case counting has just been switched on
+            break;
+        }
+    }
+#endif
+
+#if defined(Q_CC_GNU)
+leaveQuantumWithinBasicBlock:
+    _nextDecodedInstruction = nextDecodedInstruction;
+    _nextDecodedInstructionAddress = ip;
+leaveQuantum:
+    _r[_IpRegister] = ip;
+    _cc = cc;
+#endif
+    //  Be defensive in release mode - the caller stalls for "cyclesTaken - 1"
+    return (cyclesTaken == 0) ? 1 : cyclesTaken;
+}
+
+//  End of hadesvm-cereon/ProcessorCore.Threaded.cpp
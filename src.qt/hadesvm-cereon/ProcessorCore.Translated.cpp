@@ -0,0 +1,644 @@
+//
+//  hadesvm-cereon/ProcessorCore.Translated.cpp
+//
+//  hadesvm::cereon::ProcessorCore class implementation (translating execution engine)
+//
+//////////
+#include "hadesvm-cereon/API.hpp"
+using namespace hadesvm::cereon;
+
+//  The translated code of a basic block is entered with its 1st instruction
+//  about to be dispatched and the quantum not over yet, and keeps the state
+//  of the threaded engine as follows:
+//  *   $cc and all registers but $ip are kept in the core, and $ip is only
+//      stored into the core before a call and when leaving the basic block;
+//  *   the clock cycles taken in the quantum so far and the quantum length
+//      are kept in host registers. The translated code runs a straight run
+//      of instructions (up to and including the next one done by a handler,
+//      which may take any number of cycles) only if the quantum would let
+//      the threaded engine dispatch all of them; if not, it leaves to the
+//      threaded engine at the 1st instruction of the run.
+//  Instructions are counted into $cc and the clock cycles they take into
+//  the quantum in batches, before every call and exit.
+//  When control leaves the basic block, the translated code follows the links
+//  of the basic block as _followBasicBlockLink() would, and jumps to the
+//  translation of the linked basic block if there is one; else, or if the
+//  quantum is over or basic blocks have been invalidated, it leaves with
+//  $ip at the successor, for the threaded engine to switch basic blocks.
+namespace
+{
+    using Register = X64Emitter::Register;
+    using Condition = X64Emitter::Condition;
+    using AluOperation = X64Emitter::AluOperation;
+    using Memory = X64Emitter::Memory;
+    using Label = X64Emitter::Label;
+
+    //  The host registers the translated code keeps its state in; all of them
+    //  are callee-saved, so they survive the calls to executors and handlers
+    const Register CoreRegister = Register::Rbx;            //  the ProcessorCore
+    const Register CyclesTakenRegister = Register::R12;     //  ...in the quantum so far
+    const Register BasicBlockAddressRegister = Register::R13;   //  logical address of the current basic block
+    const Register MaxCyclesRegister = Register::R14;       //  ...of the quantum
+}
+
+//////////
+//  Implementation helpers (translating execution engine)
+bool ProcessorCore::_translateBasicBlock(_BasicBlock * basicBlock)
+{
+    Q_ASSERT(basicBlock->numInstructions > 0 && basicBlock->translatedCode == nullptr);
+
+    if (_codeCache == nullptr && !_startTranslating())
+    {
+        return false;
+    }
+    if (_translatedCodeEntry == nullptr)
+    {   //  The host can't run translated code
+        return false;
+    }
+
+    //  If the code cache is full, flush it and try again
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        if (!_codeCache->beginWriting())
+        {   //  OOPS! Stop translating, the threaded engine will do
+            _translatedCodeEntry = nullptr;
+            return false;
+        }
+        X64Emitter emitter(_codeCache->allocationPoint(), _codeCache->bytesAvailable());
+        _emitBasicBlockTranslation(emitter, basicBlock);
+        bool fitted = !emitter.overflowed();
+        if (fitted)
+        {
+            basicBlock->translatedCode = _codeCache->allocationPoint();
+            _codeCache->commit(emitter.size());
+        }
+        if (!_codeCache->endWriting())
+        {   //  OOPS! Stop translating, the threaded engine will do
+            basicBlock->translatedCode = nullptr;
+            _translatedCodeEntry = nullptr;
+            return false;
+        }
+        if (fitted)
+        {
+            return true;
+        }
+        _flushCodeCache();
+    }
+    return false;
+}
+
+bool ProcessorCore::_startTranslating()
+{
+    Q_ASSERT(_codeCache == nullptr);
+
+    _codeCache = new X64CodeCache(_CodeCacheSize);
+    if (!_codeCache->isSupported() || !_codeCache->beginWriting())
+    {
+        return false;
+    }
+
+    //  The code cache starts with the _TranslatedCodeEntry, which switches
+    //  from the calling convention of the host to that of translated code
+    //  (and keeps the stack aligned to 16 bytes for calls), and the return
+    //  from it, which translated code jumps to when it leaves
+    X64Emitter emitter(_codeCache->allocationPoint(), _codeCache->bytesAvailable());
+    emitter.push(Register::Rbx);
+    emitter.push(Register::Rbp);
+    emitter.push(Register::R12);
+    emitter.push(Register::R13);
+    emitter.push(Register::R14);
+    emitter.push(Register::R15);
+    emitter.alu(AluOperation::Sub, Register::Rsp, 8);
+    emitter.mov(CoreRegister, Register::Rdi);
+    emitter.mov(CyclesTakenRegister, Register::Rdx);
+    emitter.mov(MaxCyclesRegister, Register::Rcx);
+    emitter.mov(BasicBlockAddressRegister,
+                Memory{CoreRegister, static_cast<int32_t>(reinterpret_cast<const uint8_t*>(&_r[_IpRegister]) - reinterpret_cast<const uint8_t*>(this))});
+    emitter.jmp(Register::Rsi);
+    size_t returnOffset = emitter.size();
+    emitter.mov(Register::Rax, CyclesTakenRegister);
+    emitter.alu(AluOperation::Add, Register::Rsp, 8);
+    emitter.pop(Register::R15);
+    emitter.pop(Register::R14);
+    emitter.pop(Register::R13);
+    emitter.pop(Register::R12);
+    emitter.pop(Register::Rbp);
+    emitter.pop(Register::Rbx);
+    emitter.ret();
+
+    bool fitted = !emitter.overflowed();
+    if (!_codeCache->endWriting() || !fitted)
+    {
+        return false;
+    }
+    _translatedCodeEntry = reinterpret_cast<_TranslatedCodeEntry>(_codeCache->allocationPoint());
+    _translatedCodeReturn = _codeCache->allocationPoint() + returnOffset;
+    _translatedCodeEntrySize = emitter.size();
+    _codeCache->commit(emitter.size());
+    return true;
+}
+
+void ProcessorCore::_flushCodeCache()
+{
+    for (size_t i = 0; i < _BasicBlockCacheSize; i++)
+    {
+        _basicBlockCache[i].translatedCode = nullptr;
+    }
+    _codeCache->release(_translatedCodeEntrySize);
+}
+
+unsigned ProcessorCore::_runTranslatedCode(unsigned cyclesTaken, unsigned maxCycles)
+{
+    Q_ASSERT(_currentBasicBlock != nullptr && _currentBasicBlock->translatedCode != nullptr);
+    Q_ASSERT(cyclesTaken < maxCycles);
+
+    _translatedCodeState = _state;
+    _translatedCodeItc = _itc;
+    _translatedCodeExit = nullptr;
+    return static_cast<unsigned>(_translatedCodeEntry(this, _currentBasicBlock->translatedCode, cyclesTaken, maxCycles));
+}
+
+template <ProcessorCore::_DecodedInstructionHandler Executor>
+uint64_t ProcessorCore::_callFromTranslatedCode(ProcessorCore * core, const _DecodedInstruction * decodedInstruction)
+{   //  As the threaded engine does around a call
+    uint64_t nextIp = core->_r[_IpRegister];
+    core->_nextDecodedInstruction = decodedInstruction + 1;
+    core->_nextDecodedInstructionAddress = nextIp;
+    unsigned cycles = (core->*Executor)(*decodedInstruction);
+    bool leave = core->_r[_IpRegister] != nextIp ||
+                 core->_nextDecodedInstruction != decodedInstruction + 1 ||
+                 core->_state != core->_translatedCodeState ||
+                 core->_basicBlockInvalidationPending.load(std::memory_order_relaxed) ||
+                 core->_performanceMonitoringEnabled;   //  ...so that taken branches are counted
+    return cycles | (leave ? (UINT64_C(1) << 32) : 0);
+}
+
+void ProcessorCore::_emitBasicBlockTranslation(X64Emitter & emitter, _BasicBlock * basicBlock)
+{
+    //  Instructions done inline
+    struct InlineOperation
+    {
+        _DecodedInstructionHandler  executor;
+        AluOperation        operation;
+        bool                immediate;  //  op2 is "imm" rather than $r3
+    };
+    static const InlineOperation InlineOperations[] =
+    {
+        { &ProcessorCore::_executeAddL, AluOperation::Add, false },
+        { &ProcessorCore::_executeSubL, AluOperation::Sub, false },
+        { &ProcessorCore::_executeAddiL, AluOperation::Add, true },
+        { &ProcessorCore::_executeSubiL, AluOperation::Sub, true },
+        { &ProcessorCore::_executeAndL, AluOperation::And, false },
+        { &ProcessorCore::_executeOrL, AluOperation::Or, false },
+        { &ProcessorCore::_executeXorL, AluOperation::Xor, false },
+        { &ProcessorCore::_executeAndiL, AluOperation::And, true },
+        { &ProcessorCore::_executeOriL, AluOperation::Or, true },
+        { &ProcessorCore::_executeXoriL, AluOperation::Xor, true }
+    };
+    struct InlineComparison
+    {
+        _DecodedInstructionHandler  executor;
+        Condition           condition;
+        bool                immediate;  //  op2 is "imm" rather than $r3
+    };
+    static const InlineComparison InlineComparisons[] =
+    {
+        { &ProcessorCore::_executeSeqL, Condition::Equal, false },
+        { &ProcessorCore::_executeSltL, Condition::Less, false },
+        { &ProcessorCore::_executeSltUL, Condition::Below, false },
+        { &ProcessorCore::_executeSeqiL, Condition::Equal, true },
+        { &ProcessorCore::_executeSltiL, Condition::Less, true }
+    };
+    struct InlineBranch
+    {
+        _DecodedInstructionHandler  executor;
+        Condition           condition;
+    };
+    static const InlineBranch InlineBranches[] =
+    {
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isEqual>, Condition::Equal },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>, Condition::NotEqual },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isLess>, Condition::Less },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isLessOrEqual>, Condition::LessOrEqual },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isGreater>, Condition::Greater },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isGreaterOrEqual>, Condition::GreaterOrEqual },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isLessUnsigned>, Condition::Below },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isLessOrEqualUnsigned>, Condition::BelowOrEqual },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isGreaterUnsigned>, Condition::Above },
+        { &ProcessorCore::_executeBranch<&ProcessorCore::_isGreaterOrEqualUnsigned>, Condition::AboveOrEqual }
+    };
+    //  Branches that compare with an immediate have no executor, but are
+    //  simple enough to be done inline from the instruction itself
+    struct InlineImmediateBranch
+    {
+        _InstructionHandler handler;
+        Condition           condition;
+        bool                isSigned;   //  ...immediate operand
+    };
+    static const InlineImmediateBranch InlineImmediateBranches[] =
+    {
+        { &ProcessorCore::_handleBeqiL, Condition::Equal, true },
+        { &ProcessorCore::_handleBneiL, Condition::NotEqual, true },
+        { &ProcessorCore::_handleBltiL, Condition::Less, true },
+        { &ProcessorCore::_handleBleiL, Condition::LessOrEqual, true },
+        { &ProcessorCore::_handleBgtiL, Condition::Greater, true },
+        { &ProcessorCore::_handleBgeiL, Condition::GreaterOrEqual, true },
+        { &ProcessorCore::_handleBltiUL, Condition::Below, false },
+        { &ProcessorCore::_handleBleiUL, Condition::BelowOrEqual, false },
+        { &ProcessorCore::_handleBgtiUL, Condition::Above, false },
+        { &ProcessorCore::_handleBgeiUL, Condition::AboveOrEqual, false }
+    };
+    //  Instructions done by calling their executor; all instructions
+    //  that are not done inline or by an executor call their handler
+    typedef uint64_t (*CalledExecutor)(ProcessorCore * core, const _DecodedInstruction * decodedInstruction);
+    struct ExecutorCall
+    {
+        _DecodedInstructionHandler  executor;
+        CalledExecutor      calledExecutor;
+    };
+    static const ExecutorCall ExecutorCalls[] =
+    {
+        { &ProcessorCore::_executeLL<ByteOrder::BigEndian>, &ProcessorCore::_callFromTranslatedCode<&ProcessorCore::_executeLL<ByteOrder::BigEndian>> },
+        { &ProcessorCore::_executeLL<ByteOrder::LittleEndian>, &ProcessorCore::_callFromTranslatedCode<&ProcessorCore::_executeLL<ByteOrder::LittleEndian>> },
+        { &ProcessorCore::_executeSL<ByteOrder::BigEndian>, &ProcessorCore::_callFromTranslatedCode<&ProcessorCore::_executeSL<ByteOrder::BigEndian>> },
+        { &ProcessorCore::_executeSL<ByteOrder::LittleEndian>, &ProcessorCore::_callFromTranslatedCode<&ProcessorCore::_executeSL<ByteOrder::LittleEndian>> },
+        { &ProcessorCore::_executeLdm<ByteOrder::BigEndian>, &ProcessorCore::_callFromTranslatedCode<&ProcessorCore::_executeLdm<ByteOrder::BigEndian>> },
+        { &ProcessorCore::_executeLdm<ByteOrder::LittleEndian>, &ProcessorCore::_callFromTranslatedCode<&ProcessorCore::_executeLdm<ByteOrder::LittleEndian>> },
+        { &ProcessorCore::_executeStm<ByteOrder::BigEndian>, &ProcessorCore::_callFromTranslatedCode<&ProcessorCore::_executeStm<ByteOrder::BigEndian>> },
+        { &ProcessorCore::_executeStm<ByteOrder::LittleEndian>, &ProcessorCore::_callFromTranslatedCode<&ProcessorCore::_executeStm<ByteOrder::LittleEndian>> }
+    };
+
+    //  Operands in the core are addressed relative to CoreRegister
+    auto coreField =
+        [&](const void * field)
+        {
+            return Memory{CoreRegister, static_cast<int32_t>(static_cast<const uint8_t*>(field) - reinterpret_cast<const uint8_t*>(this))};
+        };
+    auto registerField =
+        [&](unsigned r)
+        {
+            return coreField(&_r[r]);
+        };
+    auto addressOf =
+        [](const void * object)
+        {
+            return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(object));
+        };
+    //  $ip as the threaded engine has it during the k-th instruction, or at
+    //  the k-th instruction if "dispatched" is false
+    auto ipAt =
+        [](unsigned k, bool dispatched)
+        {
+            return Memory{BasicBlockAddressRegister, static_cast<int32_t>(4 * (dispatched ? k + 1 : k))};
+        };
+
+    //  Classify the instructions; 0 clock cycles stands for "as returned by handler"
+    enum class Kind { Operation, Comparison, LoadImmediate, Move, Nop, Branch, ImmediateBranch, Jump, ExecutorCall, HandlerCall };
+    Kind kinds[_MaxBasicBlockLength];
+    unsigned cycles[_MaxBasicBlockLength];
+    const void * details[_MaxBasicBlockLength];
+    unsigned numInstructions = basicBlock->numInstructions;
+    for (unsigned k = 0; k < numInstructions; k++)
+    {
+        const _DecodedInstruction & decodedInstruction = basicBlock->instructions[k];
+        kinds[k] = Kind::HandlerCall;
+        cycles[k] = decodedInstruction.cycles;
+        details[k] = nullptr;
+        if (decodedInstruction.executor == &ProcessorCore::_executeLiL)
+        {
+            kinds[k] = Kind::LoadImmediate;
+        }
+        else if (decodedInstruction.executor == &ProcessorCore::_executeMovL)
+        {
+            kinds[k] = Kind::Move;
+        }
+        else if (decodedInstruction.executor == &ProcessorCore::_executeNop)
+        {
+            kinds[k] = Kind::Nop;
+        }
+        else if (decodedInstruction.executor == &ProcessorCore::_executeJ ||
+                 decodedInstruction.executor == &ProcessorCore::_executeJal ||
+                 decodedInstruction.executor == &ProcessorCore::_executeJr ||
+                 decodedInstruction.executor == &ProcessorCore::_executeJalr)
+        {
+            kinds[k] = Kind::Jump;
+        }
+        for (const InlineOperation & inlineOperation : InlineOperations)
+        {
+            if (decodedInstruction.executor == inlineOperation.executor)
+            {
+                kinds[k] = Kind::Operation;
+                details[k] = &inlineOperation;
+            }
+        }
+        for (const InlineComparison & inlineComparison : InlineComparisons)
+        {
+            if (decodedInstruction.executor == inlineComparison.executor)
+            {
+                kinds[k] = Kind::Comparison;
+                details[k] = &inlineComparison;
+            }
+        }
+        for (const InlineBranch & inlineBranch : InlineBranches)
+        {
+            if (decodedInstruction.executor == inlineBranch.executor)
+            {
+                kinds[k] = Kind::Branch;
+                details[k] = &inlineBranch;
+            }
+        }
+        for (const ExecutorCall & executorCall : ExecutorCalls)
+        {
+            if (decodedInstruction.executor == executorCall.executor)
+            {
+                kinds[k] = Kind::ExecutorCall;
+                details[k] = &executorCall;
+            }
+        }
+        if (decodedInstruction.executor == &ProcessorCore::_executeUndecoded &&
+            decodedInstruction.r1 != _IpRegister)
+        {
+            for (const InlineImmediateBranch & inlineImmediateBranch : InlineImmediateBranches)
+            {
+                if (decodedInstruction.handler == inlineImmediateBranch.handler)
+                {   //  ...which always take 1 clock cycle
+                    kinds[k] = Kind::ImmediateBranch;
+                    cycles[k] = 1;
+                    details[k] = &inlineImmediateBranch;
+                }
+            }
+        }
+        if (kinds[k] == Kind::HandlerCall)
+        {   //  The executor is unknown here, or there's none
+            cycles[k] = 0;
+        }
+    }
+
+    //  Translate instruction by instruction. Exits to the threaded engine
+    //  are emitted after all instructions, at most one per instruction
+    Label exits[_MaxBasicBlockLength];
+    bool exitUsed[_MaxBasicBlockLength] = {};
+    unsigned pendingCcAt[_MaxBasicBlockLength];
+    unsigned pendingCyclesAt[_MaxBasicBlockLength];
+    unsigned pendingCc = 0, pendingCycles = 0;
+    auto flushPending =
+        [&]()
+        {
+            if (pendingCc != 0)
+            {
+                emitter.alu(AluOperation::Add, coreField(&_cc), static_cast<int32_t>(pendingCc));
+            }
+            if (pendingCycles != 0)
+            {
+                emitter.alu(AluOperation::Add, CyclesTakenRegister, static_cast<int32_t>(pendingCycles));
+            }
+            pendingCc = pendingCycles = 0;
+        };
+    auto aluImmediate =
+        [&](AluOperation operation, Register dst, uint64_t imm)
+        {
+            if (X64Emitter::fitsInt32(imm))
+            {
+                emitter.alu(operation, dst, static_cast<int32_t>(imm));
+            }
+            else
+            {
+                emitter.mov(Register::Rcx, imm);
+                emitter.alu(operation, dst, Register::Rcx);
+            }
+        };
+
+    Label switchBasicBlock, leave;
+    bool endsWithJump = false;
+    for (unsigned k = 0; k < numInstructions; k++)
+    {
+        const _DecodedInstruction & decodedInstruction = basicBlock->instructions[k];
+        pendingCcAt[k] = pendingCc;
+        pendingCyclesAt[k] = pendingCycles;
+
+        //  Does the quantum let the run that starts here go all the way?
+        if (k == 0 || cycles[k - 1] == 0)
+        {
+            uint64_t cyclesBeforeLast = pendingCycles;
+            for (unsigned i = k; i + 1 < numInstructions && cycles[i] != 0; i++)
+            {
+                cyclesBeforeLast += cycles[i];
+            }
+            if (k != 0 || cyclesBeforeLast != 0)
+            {   //  ...(the 1st instruction is known to be dispatched)
+                emitter.lea(Register::Rax, Memory{CyclesTakenRegister, static_cast<int32_t>(cyclesBeforeLast)});
+                emitter.alu(AluOperation::Cmp, Register::Rax, MaxCyclesRegister);
+                emitter.jcc(Condition::AboveOrEqual, exits[k]);
+                exitUsed[k] = true;
+            }
+        }
+
+        switch (kinds[k])
+        {
+            case Kind::Operation:
+            {
+                const InlineOperation * inlineOperation = static_cast<const InlineOperation*>(details[k]);
+                emitter.mov(Register::Rax, registerField(decodedInstruction.r2));
+                if (inlineOperation->immediate)
+                {
+                    aluImmediate(inlineOperation->operation, Register::Rax, decodedInstruction.imm);
+                }
+                else
+                {
+                    emitter.alu(inlineOperation->operation, Register::Rax, registerField(decodedInstruction.r3));
+                }
+                if (inlineOperation->operation == AluOperation::Add ||
+                    inlineOperation->operation == AluOperation::Sub)
+                {   //  The threaded engine handles the overflow
+                    emitter.jcc(Condition::Overflow, exits[k]);
+                    exitUsed[k] = true;
+                }
+                emitter.mov(registerField(decodedInstruction.r1), Register::Rax);
+                break;
+            }
+            case Kind::Comparison:
+            {
+                const InlineComparison * inlineComparison = static_cast<const InlineComparison*>(details[k]);
+                emitter.mov(Register::Rax, registerField(decodedInstruction.r2));
+                if (inlineComparison->immediate)
+                {
+                    aluImmediate(AluOperation::Cmp, Register::Rax, decodedInstruction.imm);
+                }
+                else
+                {
+                    emitter.alu(AluOperation::Cmp, Register::Rax, registerField(decodedInstruction.r3));
+                }
+                emitter.setcc(inlineComparison->condition, Register::Rax);
+                emitter.movzxByte(Register::Rax, Register::Rax);
+                emitter.mov(registerField(decodedInstruction.r1), Register::Rax);
+                break;
+            }
+            case Kind::LoadImmediate:
+            {
+                emitter.mov(Register::Rax, decodedInstruction.imm);
+                emitter.mov(registerField(decodedInstruction.r1), Register::Rax);
+                break;
+            }
+            case Kind::Move:
+            {
+                emitter.mov(Register::Rax, registerField(decodedInstruction.r2));
+                emitter.mov(registerField(decodedInstruction.r1), Register::Rax);
+                break;
+            }
+            case Kind::Nop:
+            {
+                break;
+            }
+            case Kind::Branch:
+            case Kind::ImmediateBranch:
+            {   //  Leaves the basic block with the successor in rax
+                pendingCc++;
+                pendingCycles += cycles[k];
+                flushPending();
+                Condition condition;
+                int64_t displacement;
+                emitter.mov(Register::Rax, registerField(decodedInstruction.r1));
+                if (kinds[k] == Kind::Branch)
+                {
+                    condition = static_cast<const InlineBranch*>(details[k])->condition;
+                    displacement = static_cast<int64_t>(decodedInstruction.imm);
+                    emitter.alu(AluOperation::Cmp, Register::Rax, registerField(decodedInstruction.r2));
+                }
+                else
+                {
+                    const InlineImmediateBranch * inlineImmediateBranch = static_cast<const InlineImmediateBranch*>(details[k]);
+                    condition = inlineImmediateBranch->condition;
+                    displacement = static_cast<int64_t>(Alu::signExtendInt6(decodedInstruction.instruction) << 2);
+                    uint64_t imm = inlineImmediateBranch->isSigned ?
+                                        Alu::signExtendInt5(decodedInstruction.instruction >> 16) :
+                                        Alu::zeroExtendInt5(decodedInstruction.instruction >> 16);
+                    emitter.alu(AluOperation::Cmp, Register::Rax, static_cast<int32_t>(imm));
+                }
+                Label taken;
+                emitter.jcc(condition, taken);
+                emitter.lea(Register::Rax, ipAt(k, true));
+                emitter.jmp(switchBasicBlock);
+                emitter.bind(taken);
+                emitter.lea(Register::Rax, Memory{BasicBlockAddressRegister, static_cast<int32_t>(4 * (k + 1) + displacement)});
+                endsWithJump = true;
+                break;
+            }
+            case Kind::Jump:
+            {   //  Leaves the basic block with the successor in rax
+                pendingCc++;
+                pendingCycles += cycles[k];
+                flushPending();
+                if (decodedInstruction.executor == &ProcessorCore::_executeJal ||
+                    decodedInstruction.executor == &ProcessorCore::_executeJalr)
+                {
+                    emitter.lea(Register::Rcx, ipAt(k, true));
+                    emitter.mov(registerField(_RaRegister), Register::Rcx);
+                }
+                if (decodedInstruction.executor == &ProcessorCore::_executeJ ||
+                    decodedInstruction.executor == &ProcessorCore::_executeJal)
+                {
+                    emitter.lea(Register::Rax, Memory{BasicBlockAddressRegister, static_cast<int32_t>(4 * (k + 1) + static_cast<int64_t>(decodedInstruction.imm))});
+                }
+                else
+                {   //  ...$r1 is read after $ra is written, as the executor does
+                    emitter.mov(Register::Rax, registerField(decodedInstruction.r1));
+                }
+                endsWithJump = true;
+                break;
+            }
+            case Kind::ExecutorCall:
+            case Kind::HandlerCall:
+            {   //  As the threaded engine does, with the hot state written
+                //  back and leaving if the call raises an interrupt, jumps,
+                //  or stores into code
+                pendingCc++;
+                flushPending();
+                emitter.lea(Register::Rax, ipAt(k, true));
+                emitter.mov(registerField(_IpRegister), Register::Rax);
+                emitter.mov(Register::Rdi, CoreRegister);
+                emitter.mov(Register::Rsi, addressOf(&decodedInstruction));
+                CalledExecutor calledExecutor = (kinds[k] == Kind::ExecutorCall) ?
+                                                    static_cast<const ExecutorCall*>(details[k])->calledExecutor :
+                                                    &ProcessorCore::_callFromTranslatedCode<&ProcessorCore::_executeUndecoded>;
+                emitter.mov(Register::Rax, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(calledExecutor)));
+                emitter.call(Register::Rax);
+                emitter.mov32(Register::Rcx, Register::Rax);
+                emitter.alu(AluOperation::Add, CyclesTakenRegister, Register::Rcx);
+                emitter.shr(Register::Rax, 32);
+                emitter.test32(Register::Rax, Register::Rax);
+                emitter.jcc(Condition::NotEqual, leave);
+                break;
+            }
+            default:
+                Q_ASSERT(false);
+                break;
+        }
+        if (kinds[k] != Kind::ExecutorCall && kinds[k] != Kind::HandlerCall && !endsWithJump)
+        {
+            pendingCc++;
+            pendingCycles += cycles[k];
+        }
+    }
+    if (!endsWithJump)
+    {   //  Fall through to the next basic block
+        flushPending();
+        emitter.lea(Register::Rax, ipAt(numInstructions, false));
+    }
+
+    //  Switch basic blocks with the successor in rax
+    emitter.bind(switchBasicBlock);
+    emitter.mov(registerField(_IpRegister), Register::Rax);
+    emitter.alu(AluOperation::Cmp, CyclesTakenRegister, MaxCyclesRegister);
+    emitter.jcc(Condition::AboveOrEqual, leave);
+    emitter.cmpByte(coreField(&_basicBlockInvalidationPending), 0);
+    emitter.jcc(Condition::NotEqual, leave);
+    emitter.mov(Register::Rcx, coreField(&_itc));
+    emitter.alu(AluOperation::Cmp, Register::Rcx, coreField(&_translatedCodeItc));
+    emitter.jcc(Condition::NotEqual, leave);
+    for (const _BasicBlockLink & link : basicBlock->links)
+    {   //  Follow the link to a translated basic block, as _followBasicBlockLink() would
+        Label nextLink;
+        emitter.mov(Register::Rdx, addressOf(&link));
+        emitter.alu(AluOperation::Cmp, Register::Rax, Memory{Register::Rdx, offsetof(_BasicBlockLink, address)});
+        emitter.jcc(Condition::NotEqual, nextLink);
+        emitter.mov(Register::Rcx, Memory{Register::Rdx, offsetof(_BasicBlockLink, epoch)});
+        emitter.alu(AluOperation::Cmp, Register::Rcx, coreField(&_basicBlockLinkEpoch));
+        emitter.jcc(Condition::NotEqual, nextLink);
+        emitter.mov(Register::Rcx, Memory{Register::Rdx, offsetof(_BasicBlockLink, state)});
+        emitter.alu(AluOperation::Cmp, Register::Rcx, coreField(&_translatedCodeState));
+        emitter.jcc(Condition::NotEqual, nextLink);
+        emitter.mov(Register::Rdx, Memory{Register::Rdx, offsetof(_BasicBlockLink, target)});
+        emitter.alu(AluOperation::Cmp, Register::Rdx, 0);
+        emitter.jcc(Condition::Equal, nextLink);
+        emitter.mov(Register::Rcx, Memory{Register::Rdx, offsetof(_BasicBlock, translatedCode)});
+        emitter.alu(AluOperation::Cmp, Register::Rcx, 0);
+        emitter.jcc(Condition::Equal, nextLink);
+        emitter.mov(coreField(&_currentBasicBlock), Register::Rdx);
+        emitter.inc(Memory{Register::Rdx, offsetof(_BasicBlock, executionCount)});
+        emitter.mov(BasicBlockAddressRegister, Register::Rax);
+        emitter.jmp(Register::Rcx);
+        emitter.bind(nextLink);
+    }
+    //  ...else leave to the threaded engine, with $ip already stored
+    emitter.bind(leave);
+    emitter.jmp(_translatedCodeReturn);
+
+    //  Exits to the threaded engine, which goes on at the k-th instruction
+    for (unsigned k = 0; k < numInstructions; k++)
+    {
+        if (exitUsed[k])
+        {
+            emitter.bind(exits[k]);
+            pendingCc = pendingCcAt[k];
+            pendingCycles = pendingCyclesAt[k];
+            flushPending();
+            emitter.lea(Register::Rax, ipAt(k, false));
+            emitter.mov(registerField(_IpRegister), Register::Rax);
+            emitter.mov(Register::Rax, addressOf(&basicBlock->instructions[k]));
+            emitter.mov(coreField(&_translatedCodeExit), Register::Rax);
+            emitter.jmp(_translatedCodeReturn);
+        }
+    }
+}
+
+//  End of hadesvm-cereon/ProcessorCore.Translated.cpp
@@ -52,16 +52,50 @@ ProcessorCore::ProcessorCore(Processor * processor, uint8_t id, const Features &
               &_ihstateHw,
               &_ihaHw,
               &_iscHw},
+        _performanceMonitoringEnabled(false),
+        _performanceInterruptPending(false),
         _flags(),
         //  Timing characteristics
         _memoryBusToProcessorClockRatio(1),
         _ioBusToProcessorClockRatio(1),
         //  Misc
-        _cyclesToStall(0)
+        _cyclesToStall(0),
+        //  Profiling
+        _profileSamples(nullptr),
+        _profilingInterval(0),
+        _nextSampleCc(0),
+        //  Tracing
+        _traceEncoder(nullptr),
+        //  Basic blocks
+        _basicBlockCache(new _BasicBlock[_BasicBlockCacheSize]),
+        _currentBasicBlock(nullptr),
+        _basicBlockLinkEpoch(0),
+        _nextDecodedInstruction(nullptr),
+        _endDecodedInstructions(nullptr),
+        _nextDecodedInstructionAddress(0),
+        _basicBlockInvalidationPending(false),
+        _invalidatedWatchSlots(new std::atomic<uint64_t>[MemoryBus::WatchSlotCount / 64]),
+        _invalidatedWatchSlotWords(),
+        _basicBlocksByWatchSlot(new _BasicBlock*[MemoryBus::WatchSlotCount]),
+        //  TLBs
+        _iTlb(),
+        _dTlb(),
+        _tlbInvalidationPending(false),
+        //  Translating execution engine
+        _codeCache(nullptr),
+        _translatedCodeEntry(nullptr),
+        _translatedCodeReturn(nullptr),
+        _translatedCodeEntrySize(0),
+        _translatedCodeState(0),
+        _translatedCodeItc(0),
+        _translatedCodeExit(nullptr)
 {
     Q_ASSERT(_processor != nullptr);
     Q_ASSERT(_mmu != nullptr);
 
+    _invalidateAllBasicBlocks();
+    _invalidateTlbs();
+
     //  Make sure no two cores have the same ID
     for (ProcessorCore * core : _processor->_cores)
     {
@@ -82,6 +116,11 @@ ProcessorCore::~ProcessorCore() noexcept
 {
     //  Destroy link from processor to this core
     _processor->_cores.removeOne(this);
+
+    delete _codeCache;
+    delete [] _basicBlocksByWatchSlot;
+    delete [] _invalidatedWatchSlots;
+    delete [] _basicBlockCache;
 }
 
 //////////
@@ -103,6 +142,8 @@ void ProcessorCore::reset()
         _r[i] = *_cPtr[i] = _d[i] = _m[i] = 0;
     }
     _flags = 0;
+    _updatePerformanceMonitoring();
+    _performanceInterruptPending = false;
 
     //  3.  In every Cereon system, there is exactly one processor set up as a
     //      primary processor. If the system has more than one processor, all
@@ -155,9 +196,146 @@ void ProcessorCore::reset()
 
     //  Finish resetting
     _cyclesToStall = 0;
+    _invalidateAllBasicBlocks();
+    _invalidateTlbs();  //  ...also drops host memory pointers, which may be stale by now
+}
+
+void ProcessorCore::saveSnapshot(hadesvm::core::SnapshotWriter & writer) const
+{
+    writer << _id;
+    for (int i = 0; i < 32; i++)
+    {
+        writer << _r[i] << *_cPtr[i] << _d[i] << _m[i];
+    }
+    writer << static_cast<uint64_t>(_flags)
+           << _cyclesToStall
+           << _performanceInterruptPending;
+}
+
+void ProcessorCore::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    uint8_t id = 0;
+    reader >> id;
+    if (id != _id)
+    {
+        throw hadesvm::core::VirtualApplianceException("Processor core ID mismatch");
+    }
+    for (int i = 0; i < 32; i++)
+    {
+        reader >> _r[i] >> *_cPtr[i] >> _d[i] >> _m[i];
+    }
+    uint64_t flags = 0;
+    reader >> flags
+           >> _cyclesToStall
+           >> _performanceInterruptPending;
+    _flags = flags;
+    _state = _state.value();    //  ...to replicate $state bit fields
+    _updatePerformanceMonitoring();
+
+    //  Nothing cached before the restore is any good
+    _invalidateAllBasicBlocks();
+    _invalidateTlbs();
 }
 
 void ProcessorCore::onClockTick()
+{
+    _runClockTick(_ThreadedQuantum);
+}
+
+unsigned ProcessorCore::runCycles(unsigned numCycles)
+{
+    const uint64_t entryState = _state;
+    unsigned cyclesRun = 0;
+
+    while (cyclesRun < numCycles)
+    {
+        unsigned cyclesLeft = numCycles - cyclesRun;
+        if (_cyclesToStall > 0)
+        {   //  Stalling - $itc counts down, but a TIMER
+            //  interrupt can't occur until stall ends
+            unsigned stallCycles = qMin(_cyclesToStall, cyclesLeft);
+            if (_itc > 1)
+            {
+                _itc -= qMin(static_cast<uint64_t>(stallCycles), _itc - 1);
+            }
+            _cyclesToStall -= stallCycles;
+            cyclesRun += stallCycles;
+        }
+        else if (_state.isInIdleMode())
+        {   //  Idle - nothing happens until $itc counts down to 1...
+            if (_itc > 1)
+            {
+                unsigned idleCycles = static_cast<unsigned>(qMin(static_cast<uint64_t>(cyclesLeft), _itc - 1));
+                _itc -= idleCycles;
+                cyclesRun += idleCycles;
+            }
+            else if (_itc == 1 && _state.isTimerInterruptsEnabled())
+            {   //  ...and a TIMER interrupt occurs on the next tick...
+                _runClockTick(1);
+                cyclesRun++;
+            }
+            else
+            {   //  ...which will not happen while we're here
+                cyclesRun = numCycles;
+            }
+        }
+        else
+        {   //  Working
+            _runClockTick(cyclesLeft);
+            cyclesRun++;
+        }
+        if (_state != entryState)
+        {   //  Let the caller resynchronise
+            break;
+        }
+    }
+    return cyclesRun;
+}
+
+uint64_t ProcessorCore::idleCycles() const
+{
+    if (!_state.isInIdleMode() || _cyclesToStall > 0)
+    {   //  Working or stalling
+        return 0;
+    }
+    if (_state.isTimerInterruptsEnabled() && _itc > 0)
+    {   //  $itc counts down to 1, and a TIMER interrupt occurs on the next tick
+        return _itc - 1;
+    }
+    return UINT64_MAX;
+}
+
+uint64_t ProcessorCore::performanceCounter(PerformanceEvent event) const
+{
+    Q_ASSERT(_PmFirstCounterRegister + static_cast<unsigned>(event) < 32);
+
+    return _m[_PmFirstCounterRegister + static_cast<unsigned>(event)];
+}
+
+//////////
+//  IMemorySnooper
+void ProcessorCore::onWatchedPageModified(size_t watchSlot)
+{
+    Q_ASSERT(watchSlot < MemoryBus::WatchSlotCount);
+
+    //  Just record the invalidation - it will be processed by the
+    //  thread running this core before the next instruction. The word
+    //  of the slot bitmap is marked AFTER its bit is set, so that no slot
+    //  is ever set in a word that is not marked
+    size_t word = watchSlot / 64;
+    _invalidatedWatchSlots[word].fetch_or(UINT64_C(1) << (watchSlot % 64), std::memory_order_acq_rel);
+    _invalidatedWatchSlotWords[word / 64].fetch_or(UINT64_C(1) << (word % 64), std::memory_order_acq_rel);
+    _basicBlockInvalidationPending.store(true, std::memory_order_release);
+}
+
+void ProcessorCore::onHostMemoryPublished()
+{
+    _tlbInvalidationPending.store(true, std::memory_order_release);
+}
+
+//////////
+//  Implementation helpers (clock ticks)
+void ProcessorCore::_runClockTick(unsigned maxCycles)
 {
     //  Update $itc
     if (_itc > 1)
@@ -185,14 +363,65 @@ void ProcessorCore::onClockTick()
         return;
     }
 
+    //  A slower path through the memory bus is still correct, so TLB
+    //  entries made before host memory was published can wait until now
+    if (_tlbInvalidationPending.load(std::memory_order_relaxed) &&
+        _tlbInvalidationPending.exchange(false, std::memory_order_acq_rel))
+    {
+        _invalidateTlbs();
+    }
+
+    //  A PERFORMANCE interrupt is taken before the instruction that follows
+    //  the one that caused it (while counting, the threaded engine runs a
+    //  single instruction per quantum)
+    if (_performanceInterruptPending && _state.isHardwareInterruptsEnabled())
+    {
+        _performanceInterruptPending = false;
+        _handleHardwareInterrupt(HardwareInterrupt::PERFORMANCE);
+    }
+
+    //  Profile samples are taken between quanta of execution too
+    if (_profileSamples != nullptr &&
+        (_cc >= _nextSampleCc || _nextSampleCc - _cc > _profilingInterval))  //  ...in case $cc has been set back
+    {
+        _takeProfileSample();
+    }
+
+    //  Threaded and translating engines run a quantum of instructions at
+    //  once, unless there's a trap to handle - then it's one instruction at a time
+    if (_processor->_executionEngine != ExecutionEngine::Reference &&
+        !_state.isInTrapMode() && !_state.isInPendingTrapMode() &&
+        _traceEncoder == nullptr)
+    {
+        if (maxCycles == 0 || maxCycles > _ThreadedQuantum)
+        {
+            maxCycles = _ThreadedQuantum;
+        }
+        if (_itc != 0 && _itc < maxCycles && _state.isTimerInterruptsEnabled())
+        {   //  Don't run past the TIMER interrupt
+            maxCycles = static_cast<unsigned>(_itc);
+        }
+        //  While counting, run 1 instruction at a time and count it as
+        //  below, so that the counters are exact after every instruction
+        bool counting = _performanceMonitoringEnabled;
+        if (counting)
+        {
+            maxCycles = 1;
+            _addToPerformanceCounter(PerformanceEvent::RetiredInstructions, 1);
+        }
+        unsigned cyclesTaken = _runThreaded(maxCycles);
+        //  1 cycle has just executed - stall the rest of the way
+        _cyclesToStall = cyclesTaken - 1;
+        if (counting)
+        {
+            _countPerformanceEvent(PerformanceEvent::StallCycles, _cyclesToStall);
+        }
+        return;
+    }
+
     //  We're Working - increment $cc and handle traps
     _cc++;
-    //if (_cc % 100'000'000 == 0)
-    //{   //  TODO kill off this "if" - it's a debug code
-    //    QDateTime now = QDateTime::currentDateTimeUtc();
-    //    QString nowAsString = now.toString(Qt::DateFormat::ISODateWithMs);
-    //    qDebug() << "cc = " << _cc << " @ " << nowAsString;
-    //}
+    _countPerformanceEvent(PerformanceEvent::RetiredInstructions);
 
     if (_state.isInTrapMode())
     {   //  TRAP, unless PROGRAM interrupts are disabled
@@ -208,446 +437,948 @@ void ProcessorCore::onClockTick()
         _state.clearPendingTrapMode();
     }
 
-    //  Go!
-    try
+    //  Go! Interrupts caused by the instruction are raised in place
+    if (_traceEncoder != nullptr)
     {
-        try
-        {
-            unsigned cyclesTaken = _fetchAndExecuteInstruction();
-            Q_ASSERT(cyclesTaken > 0 && cyclesTaken <= 1024);
-            //  1 cycle has just executed - stall the rest of the way...
-            _cyclesToStall = (cyclesTaken == 0) ? 1 : (cyclesTaken - 1);    //  ...but be defensive in release mode
-        }
-        catch (ProgramInterrupt ex)
-        {   //  Raise; halt if masked
-            _raiseProgramInterrupt(ex);
-            return;
+        _traceEncoder->recordInstruction(_r[_IpRegister]);
+    }
+    unsigned cyclesTaken = _fetchAndExecuteInstruction();
+    if (_traceEncoder != nullptr)
+    {
+        _traceEncoder->recordFlow(_r[_IpRegister]);
+    }
+    Q_ASSERT(cyclesTaken > 0 && cyclesTaken <= 1024);
+    //  1 cycle has just executed - stall the rest of the way...
+    _cyclesToStall = (cyclesTaken == 0) ? 1 : (cyclesTaken - 1);    //  ...but be defensive in release mode
+    _countPerformanceEvent(PerformanceEvent::StallCycles, _cyclesToStall);
+}
+
+//////////
+//  Implementation helpers (address translation)
+bool ProcessorCore::_translateFetchAddress(uint64_t address, uint64_t & physicalAddress)
+{
+    if (_state.isInRealMode())
+    {
+        physicalAddress = address;
+        return true;
+    }
+
+    MemoryAccessError error = MemoryAccessError::None;
+    const _TlbEntry * tlbEntry = _translatePage(_iTlb, _ITlbSize, address, Mmu::FetchAccess, error);
+    if (tlbEntry == nullptr)
+    {   //  OOPS! Translate & raise
+        _translateAndRaiseI(error);
+        return false;
+    }
+    physicalAddress = tlbEntry->physicalPage | (address & Mmu::PageOffsetMask);
+    return true;
+}
+
+bool ProcessorCore::_translateLoadAddress(uint64_t address, uint64_t & physicalAddress, uint8_t *& hostData, bool monitored)
+{
+    if (monitored)
+    {
+        _monitorLoad(address);
+    }
+    if (_state.isInRealMode())
+    {
+        physicalAddress = address;
+        hostData = nullptr;
+        return true;
+    }
+
+    MemoryAccessError error = MemoryAccessError::None;
+    const _TlbEntry * tlbEntry = _translatePage(_dTlb, _DTlbSize, address, Mmu::LoadAccess, error);
+    if (tlbEntry == nullptr)
+    {   //  OOPS! Translate & raise
+        _translateAndRaiseD(error);
+        return false;
+    }
+    uint64_t offset = address & Mmu::PageOffsetMask;
+    physicalAddress = tlbEntry->physicalPage | offset;
+    hostData = (tlbEntry->loadData != nullptr) ? (tlbEntry->loadData + offset) : nullptr;
+    return true;
+}
+
+bool ProcessorCore::_translateStoreAddress(uint64_t address, uint64_t & physicalAddress, uint8_t *& hostData, bool monitored)
+{
+    if (monitored)
+    {
+        _monitorStore(address);
+    }
+    if (_state.isInRealMode())
+    {
+        physicalAddress = address;
+        hostData = nullptr;
+        return true;
+    }
+
+    MemoryAccessError error = MemoryAccessError::None;
+    const _TlbEntry * tlbEntry = _translatePage(_dTlb, _DTlbSize, address, Mmu::StoreAccess, error);
+    if (tlbEntry == nullptr)
+    {   //  OOPS! Translate & raise
+        _translateAndRaiseD(error);
+        return false;
+    }
+    uint64_t offset = address & Mmu::PageOffsetMask;
+    physicalAddress = tlbEntry->physicalPage | offset;
+    hostData = (tlbEntry->storeData != nullptr) ? (tlbEntry->storeData + offset) : nullptr;
+    return true;
+}
+
+bool ProcessorCore::_translateUnalignedAddress(uint64_t address, unsigned size, bool forStore,
+                                               uint64_t & physicalAddress, uint8_t *& hostData)
+{
+    Q_ASSERT(size > 0 && (address & Mmu::PageOffsetMask) + (size - 1) <= Mmu::PageOffsetMask);
+
+    if (forStore ? !_translateStoreAddress(address, physicalAddress, hostData, false) :
+                   !_translateLoadAddress(address, physicalAddress, hostData, false))
+    {
+        return false;
+    }
+    if (hostData == nullptr)
+    {   //  Real mode (or not a RAM/ROM page) - ask the memory bus
+        hostData = _processor->_memoryBus->hostMemory(physicalAddress, size, forStore);
+    }
+    return true;
+}
+
+ProcessorCore::_TlbEntry * ProcessorCore::_translatePage(_TlbEntry * tlb, size_t tlbSize, uint64_t address,
+                                                         unsigned access, MemoryAccessError & error)
+{
+    uint64_t logicalPage = address >> Mmu::PageShift;
+    uint32_t contextId = _state.getContextId();
+    _TlbEntry * tlbEntry = &tlb[static_cast<size_t>(logicalPage ^ contextId) & (tlbSize - 1)];
+    if (tlbEntry->logicalPage != logicalPage ||
+        tlbEntry->contextId != contextId ||
+        tlbEntry->pageTableHead != _pth)
+    {   //  TLB miss - ask the MMU...
+        _countPerformanceEvent((tlb == _iTlb) ? PerformanceEvent::ITlbMisses : PerformanceEvent::DTlbMisses);
+        Mmu::Context context { _processor->_memoryBus, _pth, _state.getByteOrder() };
+        uint64_t physicalPage = 0;
+        unsigned accessRights = 0;
+        error = _mmu->translatePage(context, address, physicalPage, accessRights);
+        if (error != MemoryAccessError::None)
+        {   //  OOPS!
+            return nullptr;
         }
-        catch (HardwareInterrupt ex)
-        {   //  Raise; halt if masked
-            _raiseHardwareInterrupt(ex);
-            return;
+        //  ...and cache the translation, along with the host
+        //  memory of the page if it's RAM or ROM
+        Q_ASSERT((physicalPage & Mmu::PageOffsetMask) == 0);
+        tlbEntry->logicalPage = logicalPage;
+        tlbEntry->pageTableHead = _pth;
+        tlbEntry->contextId = contextId;
+        tlbEntry->accessRights = accessRights;
+        tlbEntry->physicalPage = physicalPage;
+        tlbEntry->loadData = ((accessRights & Mmu::LoadAccess) != 0) ?
+                                _processor->_memoryBus->hostMemory(physicalPage, Mmu::PageSize, false) :
+                                nullptr;
+        tlbEntry->storeData = ((accessRights & Mmu::StoreAccess) != 0) ?
+                                _processor->_memoryBus->hostMemory(physicalPage, Mmu::PageSize, true) :
+                                nullptr;
+    }
+
+    //  Check access rights
+    if ((tlbEntry->accessRights & access) == 0 ||
+        (_state.isInUserMode() && (tlbEntry->accessRights & Mmu::UserAccess) == 0))
+    {   //  OOPS!
+        error = MemoryAccessError::AccessDenied;
+        return nullptr;
+    }
+    return tlbEntry;
+}
+
+void ProcessorCore::_invalidateTlbs()
+{
+    _basicBlockLinkEpoch++;
+    for (size_t i = 0; i < _ITlbSize; i++)
+    {
+        _iTlb[i].logicalPage = _InvalidLogicalPage;
+    }
+    for (size_t i = 0; i < _DTlbSize; i++)
+    {
+        _dTlb[i].logicalPage = _InvalidLogicalPage;
+    }
+}
+
+void ProcessorCore::_invalidateTlbs(uint32_t contextId)
+{
+    _basicBlockLinkEpoch++;
+    for (size_t i = 0; i < _ITlbSize; i++)
+    {
+        if (_iTlb[i].contextId == contextId)
+        {
+            _iTlb[i].logicalPage = _InvalidLogicalPage;
         }
     }
-    catch (const ForceHalt &)
+    for (size_t i = 0; i < _DTlbSize; i++)
     {
-        _state.setIdleMode();
-        return;
+        if (_dTlb[i].contextId == contextId)
+        {
+            _dTlb[i].logicalPage = _InvalidLogicalPage;
+        }
     }
 }
 
 //////////
 //  Implementation helpers (memory access)
-uint32_t ProcessorCore::_fetchInstruction(uint64_t address) throws(ProgramInterrupt, HardwareInterrupt)
+bool ProcessorCore::_fetchInstruction(uint64_t address, uint32_t & instruction)
 {
     if ((address & 0x03) != 0)
     {   //  OOPS! (even if unaligned operands feature is present)
-        throw ProgramInterrupt::IALIGN;
+        _raiseProgramInterrupt(ProgramInterrupt::IALIGN);
+        return false;
     }
 
-    uint64_t physicalAddress =
-        _state.isInVirtualMode() ?
-            _mmu->translateFetchAddress(address) :
-            address;
-
-    try
+    uint64_t physicalAddress = 0;
+    if (!_translateFetchAddress(address, physicalAddress))
     {
-        return _processor->_memoryBus->loadWord(physicalAddress, _state.getByteOrder());
+        return false;
     }
-    catch (MemoryAccessError err)
-    {   //  OOPS! Translate & re-throw
-        _translateAndThrowI(err);
+    MemoryAccessError error = _processor->_memoryBus->loadWord(physicalAddress, _state.getByteOrder(), instruction);
+    if (error != MemoryAccessError::None)
+    {   //  OOPS! Translate & raise
+        _translateAndRaiseI(error);
+        return false;
     }
+    return true;
 }
 
-uint64_t ProcessorCore::_fetchLongWord(uint64_t address) throws(ProgramInterrupt, HardwareInterrupt)
+template <ByteOrder GuestByteOrder>
+bool ProcessorCore::_fetchLongWord(uint64_t address, uint64_t & value)
 {
     if ((address & 0x07) != 0)
     {   //  OOPS! Instructions must be naturally aligned (even if unaligned operands feature is present)
-        throw ProgramInterrupt::IALIGN;
+        _raiseProgramInterrupt(ProgramInterrupt::IALIGN);
+        return false;
     }
 
-    uint64_t physicalAddress =
-        _state.isInVirtualMode() ?
-            _mmu->translateFetchAddress(address) :
-            address;
-
-    try
+    uint64_t physicalAddress = 0;
+    if (!_translateFetchAddress(address, physicalAddress))
     {
-        return _processor->_memoryBus->loadLongWord(physicalAddress, _state.getByteOrder());
+        return false;
     }
-    catch (MemoryAccessError err)
-    {   //  OOPS! Translate & re-throw
-        _translateAndThrowD(err);
+    MemoryAccessError error = _processor->_memoryBus->loadLongWord(physicalAddress, GuestByteOrder, value);
+    if (error != MemoryAccessError::None)
+    {   //  OOPS! Translate & raise
+        _translateAndRaiseI(error);
+        return false;
     }
+    return true;
 }
 
-uint8_t ProcessorCore::_loadByte(uint64_t address)
+bool ProcessorCore::_loadByte(uint64_t address, uint8_t & value, bool monitored)
 {
-    uint64_t physicalAddress =
-        _state.isInVirtualMode() ?
-            _mmu->translateLoadAddress(address) :
-            address;
-
-    try
+    uint64_t physicalAddress = 0;
+    uint8_t * hostData = nullptr;
+    if (!_translateLoadAddress(address, physicalAddress, hostData, monitored))
     {
-        return _processor->_memoryBus->loadByte(physicalAddress);
+        return false;
+    }
+    if (hostData != nullptr)
+    {   //  RAM/ROM page - bypass the memory bus
+        value = *hostData;
+        return true;
     }
-    catch (MemoryAccessError err)
-    {   //  OOPS! Translate & re-throw
-        _translateAndThrowD(err);
+    MemoryAccessError error = _processor->_memoryBus->loadByte(physicalAddress, value);
+    if (error != MemoryAccessError::None)
+    {   //  OOPS! Translate & raise
+        _translateAndRaiseD(error);
+        return false;
     }
+    return true;
 }
 
-uint16_t ProcessorCore::_loadHalfWord(uint64_t address)
+template <ByteOrder GuestByteOrder>
+bool ProcessorCore::_loadHalfWord(uint64_t address, uint16_t & value)
 {
     if ((address & 0x01) == 0)
     {   //  Naturally aligned
-        uint64_t physicalAddress =
-            _state.isInVirtualMode() ?
-                _mmu->translateLoadAddress(address) :
-                address;
-        try
+        uint64_t physicalAddress = 0;
+        uint8_t * hostData = nullptr;
+        if (!_translateLoadAddress(address, physicalAddress, hostData))
         {
-            return _processor->_memoryBus->loadHalfWord(physicalAddress, _state.getByteOrder());
+            return false;
+        }
+        if (hostData != nullptr)
+        {   //  RAM/ROM page - bypass the memory bus
+            value = hadesvm::util::loadWithByteOrder<uint16_t>(hostData, GuestByteOrder);
+            return true;
         }
-        catch (MemoryAccessError err)
-        {   //  OOPS! Translate & re-throw
-            _translateAndThrowD(err);
+        MemoryAccessError error = _processor->_memoryBus->loadHalfWord(physicalAddress, GuestByteOrder, value);
+        if (error != MemoryAccessError::None)
+        {   //  OOPS! Translate & raise
+            _translateAndRaiseD(error);
+            return false;
         }
+        return true;
     }
     else if (_features.has(Feature::UnalignedOperand))
-    {   //  Not naturally aligned - simulate by series of byte loads
+    {   //  Not naturally aligned - a single access as far as monitoring is concerned...
+        _monitorLoad(address);
+        //  ...and a single host access if within a RAM/ROM page...
+        if ((address & Mmu::PageOffsetMask) <= Mmu::PageSize - 2)
+        {
+            uint64_t physicalAddress = 0;
+            uint8_t * hostData = nullptr;
+            if (!_translateUnalignedAddress(address, 2, false, physicalAddress, hostData))
+            {
+                return false;
+            }
+            if (hostData != nullptr)
+            {
+                value = hadesvm::util::loadUnalignedWithByteOrder<uint16_t>(hostData, GuestByteOrder);
+                return true;
+            }
+        }
+        //  ...else simulate by series of byte loads
         uint16_t result = 0;
-        switch (_state.getByteOrder())
+        uint8_t byte = 0;
+        if constexpr (GuestByteOrder == ByteOrder::BigEndian)
         {
-            case hadesvm::util::ByteOrder::BigEndian:
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                break;
-            case hadesvm::util::ByteOrder::LittleEndian:
-                address += 2;
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                break;
-            case hadesvm::util::ByteOrder::Unknown:
-            default:
-                Q_ASSERT(false);
+            for (unsigned i = 0; i < 2; i++)
+            {
+                if (!_loadByte(address++, byte, false))
+                {
+                    return false;
+                }
+                result = static_cast<uint16_t>((result << 8) | byte);
+            }
+        }
+        else
+        {
+            address += 2;
+            for (unsigned i = 0; i < 2; i++)
+            {
+                if (!_loadByte(--address, byte, false))
+                {
+                    return false;
+                }
+                result = static_cast<uint16_t>((result << 8) | byte);
+            }
         }
-        return result;
+        value = result;
+        return true;
     }
     else
     {   //  OOPS! Alignment constraint violated
-        throw ProgramInterrupt::DALIGN;
+        _raiseProgramInterrupt(ProgramInterrupt::DALIGN);
+        return false;
     }
 }
 
-uint32_t ProcessorCore::_loadWord(uint64_t address)
+template <ByteOrder GuestByteOrder>
+bool ProcessorCore::_loadWord(uint64_t address, uint32_t & value)
 {
     if ((address & 0x03) == 0)
     {   //  Naturally aligned
-        uint64_t physicalAddress =
-            _state.isInVirtualMode() ?
-                _mmu->translateLoadAddress(address) :
-                address;
-        try
+        uint64_t physicalAddress = 0;
+        uint8_t * hostData = nullptr;
+        if (!_translateLoadAddress(address, physicalAddress, hostData))
         {
-            return _processor->_memoryBus->loadWord(physicalAddress, _state.getByteOrder());
+            return false;
+        }
+        if (hostData != nullptr)
+        {   //  RAM/ROM page - bypass the memory bus
+            value = hadesvm::util::loadWithByteOrder<uint32_t>(hostData, GuestByteOrder);
+            return true;
         }
-        catch (MemoryAccessError err)
-        {   //  OOPS! Translate & re-throw
-            _translateAndThrowD(err);
+        MemoryAccessError error = _processor->_memoryBus->loadWord(physicalAddress, GuestByteOrder, value);
+        if (error != MemoryAccessError::None)
+        {   //  OOPS! Translate & raise
+            _translateAndRaiseD(error);
+            return false;
         }
+        return true;
     }
     else if (_features.has(Feature::UnalignedOperand))
-    {   //  Not naturally aligned - simulate by series of byte loads
+    {   //  Not naturally aligned - a single access as far as monitoring is concerned...
+        _monitorLoad(address);
+        //  ...and a single host access if within a RAM/ROM page...
+        if ((address & Mmu::PageOffsetMask) <= Mmu::PageSize - 4)
+        {
+            uint64_t physicalAddress = 0;
+            uint8_t * hostData = nullptr;
+            if (!_translateUnalignedAddress(address, 4, false, physicalAddress, hostData))
+            {
+                return false;
+            }
+            if (hostData != nullptr)
+            {
+                value = hadesvm::util::loadUnalignedWithByteOrder<uint32_t>(hostData, GuestByteOrder);
+                return true;
+            }
+        }
+        //  ...else simulate by series of byte loads
         uint32_t result = 0;
-        switch (_state.getByteOrder())
+        uint8_t byte = 0;
+        if constexpr (GuestByteOrder == ByteOrder::BigEndian)
         {
-            case hadesvm::util::ByteOrder::BigEndian:
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                break;
-            case hadesvm::util::ByteOrder::LittleEndian:
-                address += 4;
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                break;
-            case hadesvm::util::ByteOrder::Unknown:
-            default:
-                Q_ASSERT(false);
+            for (unsigned i = 0; i < 4; i++)
+            {
+                if (!_loadByte(address++, byte, false))
+                {
+                    return false;
+                }
+                result = static_cast<uint32_t>((result << 8) | byte);
+            }
+        }
+        else
+        {
+            address += 4;
+            for (unsigned i = 0; i < 4; i++)
+            {
+                if (!_loadByte(--address, byte, false))
+                {
+                    return false;
+                }
+                result = static_cast<uint32_t>((result << 8) | byte);
+            }
         }
-        return result;
+        value = result;
+        return true;
     }
     else
     {   //  OOPS! Alignment constraint violated
-        throw ProgramInterrupt::DALIGN;
+        _raiseProgramInterrupt(ProgramInterrupt::DALIGN);
+        return false;
     }
 }
 
-uint64_t ProcessorCore::_loadLongWord(uint64_t address)
+template <ByteOrder GuestByteOrder>
+bool ProcessorCore::_loadLongWord(uint64_t address, uint64_t & value)
 {
     if ((address & 0x07) == 0)
     {   //  Naturally aligned
-        uint64_t physicalAddress =
-            _state.isInVirtualMode() ?
-                _mmu->translateLoadAddress(address) :
-                address;
-        try
+        uint64_t physicalAddress = 0;
+        uint8_t * hostData = nullptr;
+        if (!_translateLoadAddress(address, physicalAddress, hostData))
         {
-            return _processor->_memoryBus->loadLongWord(physicalAddress, _state.getByteOrder());
+            return false;
+        }
+        if (hostData != nullptr)
+        {   //  RAM/ROM page - bypass the memory bus
+            value = hadesvm::util::loadWithByteOrder<uint64_t>(hostData, GuestByteOrder);
+            return true;
         }
-        catch (MemoryAccessError err)
-        {   //  OOPS! Translate & re-throw
-            _translateAndThrowD(err);
+        MemoryAccessError error = _processor->_memoryBus->loadLongWord(physicalAddress, GuestByteOrder, value);
+        if (error != MemoryAccessError::None)
+        {   //  OOPS! Translate & raise
+            _translateAndRaiseD(error);
+            return false;
         }
+        return true;
     }
     else if (_features.has(Feature::UnalignedOperand))
-    {   //  Not naturally aligned - simulate by series of byte loads
+    {   //  Not naturally aligned - a single access as far as monitoring is concerned...
+        _monitorLoad(address);
+        //  ...and a single host access if within a RAM/ROM page...
+        if ((address & Mmu::PageOffsetMask) <= Mmu::PageSize - 8)
+        {
+            uint64_t physicalAddress = 0;
+            uint8_t * hostData = nullptr;
+            if (!_translateUnalignedAddress(address, 8, false, physicalAddress, hostData))
+            {
+                return false;
+            }
+            if (hostData != nullptr)
+            {
+                value = hadesvm::util::loadUnalignedWithByteOrder<uint64_t>(hostData, GuestByteOrder);
+                return true;
+            }
+        }
+        //  ...else simulate by series of byte loads
         uint64_t result = 0;
-        switch (_state.getByteOrder())
+        uint8_t byte = 0;
+        if constexpr (GuestByteOrder == ByteOrder::BigEndian)
         {
-            case hadesvm::util::ByteOrder::BigEndian:
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                result |= _loadByte(address++);
-                break;
-            case hadesvm::util::ByteOrder::LittleEndian:
-                address += 8;
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                result |= _loadByte(--address);
-                break;
-            case hadesvm::util::ByteOrder::Unknown:
-            default:
-                Q_ASSERT(false);
+            for (unsigned i = 0; i < 8; i++)
+            {
+                if (!_loadByte(address++, byte, false))
+                {
+                    return false;
+                }
+                result = static_cast<uint64_t>((result << 8) | byte);
+            }
+        }
+        else
+        {
+            address += 8;
+            for (unsigned i = 0; i < 8; i++)
+            {
+                if (!_loadByte(--address, byte, false))
+                {
+                    return false;
+                }
+                result = static_cast<uint64_t>((result << 8) | byte);
+            }
         }
-        return result;
+        value = result;
+        return true;
     }
     else
     {   //  OOPS! Alignment constraint violated
-        throw ProgramInterrupt::DALIGN;
+        _raiseProgramInterrupt(ProgramInterrupt::DALIGN);
+        return false;
     }
 }
 
-void ProcessorCore::_storeByte(uint64_t address, uint8_t value)
+bool ProcessorCore::_storeByte(uint64_t address, uint8_t value, bool monitored)
 {
-    uint64_t physicalAddress =
-        _state.isInVirtualMode() ?
-            _mmu->translateStoreAddress(address) :
-            address;
-
-    try
+    uint64_t physicalAddress = 0;
+    uint8_t * hostData = nullptr;
+    if (!_translateStoreAddress(address, physicalAddress, hostData, monitored))
     {
-        _processor->_memoryBus->storeByte(physicalAddress, value);
+        return false;
     }
-    catch (MemoryAccessError err)
-    {   //  OOPS! Translate & re-throw
-        _translateAndThrowD(err);
+    if (hostData != nullptr)
+    {   //  RAM page - bypass the memory bus
+        *hostData = value;
+        _processor->_memoryBus->notifyStore(physicalAddress);
+        return true;
     }
+    MemoryAccessError error = _processor->_memoryBus->storeByte(physicalAddress, value);
+    if (error != MemoryAccessError::None)
+    {   //  OOPS! Translate & raise
+        _translateAndRaiseD(error);
+        return false;
+    }
+    return true;
 }
 
-void ProcessorCore::_storeHalfWord(uint64_t address, uint16_t value)
+template <ByteOrder GuestByteOrder>
+bool ProcessorCore::_storeHalfWord(uint64_t address, uint16_t value)
 {
     if ((address & 0x01) == 0)
     {   //  Naturally aligned
-        uint64_t physicalAddress =
-            _state.isInVirtualMode() ?
-                _mmu->translateStoreAddress(address) :
-                address;
-        try
+        uint64_t physicalAddress = 0;
+        uint8_t * hostData = nullptr;
+        if (!_translateStoreAddress(address, physicalAddress, hostData))
         {
-            _processor->_memoryBus->storeHalfWord(physicalAddress, value, _state.getByteOrder());
+            return false;
+        }
+        if (hostData != nullptr)
+        {   //  RAM page - bypass the memory bus
+            hadesvm::util::storeWithByteOrder<uint16_t>(hostData, value, GuestByteOrder);
+            _processor->_memoryBus->notifyStore(physicalAddress);
+            return true;
         }
-        catch (MemoryAccessError err)
-        {   //  OOPS! Translate & re-throw
-            _translateAndThrowD(err);
+        MemoryAccessError error = _processor->_memoryBus->storeHalfWord(physicalAddress, value, GuestByteOrder);
+        if (error != MemoryAccessError::None)
+        {   //  OOPS! Translate & raise
+            _translateAndRaiseD(error);
+            return false;
         }
+        return true;
     }
     else if (_features.has(Feature::UnalignedOperand))
-    {   //  Not naturally aligned - simulate by series of byte stores
-        switch (_state.getByteOrder())
+    {   //  Not naturally aligned - a single access as far as monitoring is concerned...
+        _monitorStore(address);
+        //  ...and a single host access if within a RAM page...
+        if ((address & Mmu::PageOffsetMask) <= Mmu::PageSize - 2)
         {
-            case hadesvm::util::ByteOrder::BigEndian:
-                _storeByte(address++, static_cast<uint8_t>(value >> 8));
-                _storeByte(address++, static_cast<uint8_t>(value >> 0));
-                break;
-            case hadesvm::util::ByteOrder::LittleEndian:
-                address += 2;
-                _storeByte(--address, static_cast<uint8_t>(value >> 8));
-                _storeByte(--address, static_cast<uint8_t>(value >> 0));
-                break;
-            case hadesvm::util::ByteOrder::Unknown:
-            default:
-                Q_ASSERT(false);
+            uint64_t physicalAddress = 0;
+            uint8_t * hostData = nullptr;
+            if (!_translateUnalignedAddress(address, 2, true, physicalAddress, hostData))
+            {
+                return false;
+            }
+            if (hostData != nullptr)
+            {
+                hadesvm::util::storeUnalignedWithByteOrder<uint16_t>(hostData, value, GuestByteOrder);
+                _processor->_memoryBus->notifyStore(physicalAddress);
+                return true;
+            }
+        }
+        //  ...else simulate by series of byte stores
+        if constexpr (GuestByteOrder == ByteOrder::BigEndian)
+        {
+            for (unsigned i = 0; i < 2; i++)
+            {
+                if (!_storeByte(address++, static_cast<uint8_t>(value >> (8 * (1 - i))), false))
+                {
+                    return false;
+                }
+            }
         }
+        else
+        {
+            address += 2;
+            for (unsigned i = 0; i < 2; i++)
+            {
+                if (!_storeByte(--address, static_cast<uint8_t>(value >> (8 * (1 - i))), false))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
     }
     else
     {   //  OOPS! Alignment constraint violated
-        throw ProgramInterrupt::DALIGN;
+        _raiseProgramInterrupt(ProgramInterrupt::DALIGN);
+        return false;
     }
 }
 
-void ProcessorCore::_storeWord(uint64_t address, uint32_t value)
+template <ByteOrder GuestByteOrder>
+bool ProcessorCore::_storeWord(uint64_t address, uint32_t value)
 {
     if ((address & 0x03) == 0)
     {   //  Naturally aligned
-        uint64_t physicalAddress =
-            _state.isInVirtualMode() ?
-                _mmu->translateStoreAddress(address) :
-                address;
-        try
+        uint64_t physicalAddress = 0;
+        uint8_t * hostData = nullptr;
+        if (!_translateStoreAddress(address, physicalAddress, hostData))
         {
-            _processor->_memoryBus->storeWord(physicalAddress, value, _state.getByteOrder());
+            return false;
+        }
+        if (hostData != nullptr)
+        {   //  RAM page - bypass the memory bus
+            hadesvm::util::storeWithByteOrder<uint32_t>(hostData, value, GuestByteOrder);
+            _processor->_memoryBus->notifyStore(physicalAddress);
+            return true;
         }
-        catch (MemoryAccessError err)
-        {   //  OOPS! Translate & re-throw
-            _translateAndThrowD(err);
+        MemoryAccessError error = _processor->_memoryBus->storeWord(physicalAddress, value, GuestByteOrder);
+        if (error != MemoryAccessError::None)
+        {   //  OOPS! Translate & raise
+            _translateAndRaiseD(error);
+            return false;
         }
+        return true;
     }
     else if (_features.has(Feature::UnalignedOperand))
-    {   //  Not naturally aligned - simulate by series of byte stores
-        switch (_state.getByteOrder())
+    {   //  Not naturally aligned - a single access as far as monitoring is concerned...
+        _monitorStore(address);
+        //  ...and a single host access if within a RAM page...
+        if ((address & Mmu::PageOffsetMask) <= Mmu::PageSize - 4)
         {
-            case hadesvm::util::ByteOrder::BigEndian:
-                _storeByte(address++, static_cast<uint8_t>(value >> 24));
-                _storeByte(address++, static_cast<uint8_t>(value >> 16));
-                _storeByte(address++, static_cast<uint8_t>(value >> 8));
-                _storeByte(address++, static_cast<uint8_t>(value >> 0));
-                break;
-            case hadesvm::util::ByteOrder::LittleEndian:
-                address += 4;
-                _storeByte(--address, static_cast<uint8_t>(value >> 24));
-                _storeByte(--address, static_cast<uint8_t>(value >> 16));
-                _storeByte(--address, static_cast<uint8_t>(value >> 8));
-                _storeByte(--address, static_cast<uint8_t>(value >> 0));
-                break;
-            case hadesvm::util::ByteOrder::Unknown:
-            default:
-                Q_ASSERT(false);
+            uint64_t physicalAddress = 0;
+            uint8_t * hostData = nullptr;
+            if (!_translateUnalignedAddress(address, 4, true, physicalAddress, hostData))
+            {
+                return false;
+            }
+            if (hostData != nullptr)
+            {
+                hadesvm::util::storeUnalignedWithByteOrder<uint32_t>(hostData, value, GuestByteOrder);
+                _processor->_memoryBus->notifyStore(physicalAddress);
+                return true;
+            }
+        }
+        //  ...else simulate by series of byte stores
+        if constexpr (GuestByteOrder == ByteOrder::BigEndian)
+        {
+            for (unsigned i = 0; i < 4; i++)
+            {
+                if (!_storeByte(address++, static_cast<uint8_t>(value >> (8 * (3 - i))), false))
+                {
+                    return false;
+                }
+            }
         }
+        else
+        {
+            address += 4;
+            for (unsigned i = 0; i < 4; i++)
+            {
+                if (!_storeByte(--address, static_cast<uint8_t>(value >> (8 * (3 - i))), false))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
     }
     else
     {   //  OOPS! Alignment constraint violated
-        throw ProgramInterrupt::DALIGN;
+        _raiseProgramInterrupt(ProgramInterrupt::DALIGN);
+        return false;
     }
 }
 
-void ProcessorCore::_storeLongWord(uint64_t address , uint64_t value)
+template <ByteOrder GuestByteOrder>
+bool ProcessorCore::_storeLongWord(uint64_t address, uint64_t value)
 {
     if ((address & 0x07) == 0)
     {   //  Naturally aligned
-        uint64_t physicalAddress =
-            _state.isInVirtualMode() ?
-                _mmu->translateStoreAddress(address) :
-                address;
-        try
+        uint64_t physicalAddress = 0;
+        uint8_t * hostData = nullptr;
+        if (!_translateStoreAddress(address, physicalAddress, hostData))
         {
-            _processor->_memoryBus->storeLongWord(physicalAddress, value, _state.getByteOrder());
+            return false;
+        }
+        if (hostData != nullptr)
+        {   //  RAM page - bypass the memory bus
+            hadesvm::util::storeWithByteOrder<uint64_t>(hostData, value, GuestByteOrder);
+            _processor->_memoryBus->notifyStore(physicalAddress);
+            return true;
         }
-        catch (MemoryAccessError err)
-        {   //  OOPS! Translate & re-throw
-            _translateAndThrowD(err);
+        MemoryAccessError error = _processor->_memoryBus->storeLongWord(physicalAddress, value, GuestByteOrder);
+        if (error != MemoryAccessError::None)
+        {   //  OOPS! Translate & raise
+            _translateAndRaiseD(error);
+            return false;
         }
+        return true;
     }
     else if (_features.has(Feature::UnalignedOperand))
-    {   //  Not naturally aligned - simulate by series of byte stores
-        switch (_state.getByteOrder())
+    {   //  Not naturally aligned - a single access as far as monitoring is concerned...
+        _monitorStore(address);
+        //  ...and a single host access if within a RAM page...
+        if ((address & Mmu::PageOffsetMask) <= Mmu::PageSize - 8)
         {
-            case hadesvm::util::ByteOrder::BigEndian:
-                _storeByte(address++, static_cast<uint8_t>(value >> 56));
-                _storeByte(address++, static_cast<uint8_t>(value >> 48));
-                _storeByte(address++, static_cast<uint8_t>(value >> 40));
-                _storeByte(address++, static_cast<uint8_t>(value >> 32));
-                _storeByte(address++, static_cast<uint8_t>(value >> 24));
-                _storeByte(address++, static_cast<uint8_t>(value >> 16));
-                _storeByte(address++, static_cast<uint8_t>(value >> 8));
-                _storeByte(address++, static_cast<uint8_t>(value >> 0));
-                break;
-            case hadesvm::util::ByteOrder::LittleEndian:
-                address += 8;
-                _storeByte(--address, static_cast<uint8_t>(value >> 56));
-                _storeByte(--address, static_cast<uint8_t>(value >> 48));
-                _storeByte(--address, static_cast<uint8_t>(value >> 40));
-                _storeByte(--address, static_cast<uint8_t>(value >> 32));
-                _storeByte(--address, static_cast<uint8_t>(value >> 24));
-                _storeByte(--address, static_cast<uint8_t>(value >> 16));
-                _storeByte(--address, static_cast<uint8_t>(value >> 8));
-                _storeByte(--address, static_cast<uint8_t>(value >> 0));
-                break;
-            case hadesvm::util::ByteOrder::Unknown:
-            default:
-                Q_ASSERT(false);
+            uint64_t physicalAddress = 0;
+            uint8_t * hostData = nullptr;
+            if (!_translateUnalignedAddress(address, 8, true, physicalAddress, hostData))
+            {
+                return false;
+            }
+            if (hostData != nullptr)
+            {
+                hadesvm::util::storeUnalignedWithByteOrder<uint64_t>(hostData, value, GuestByteOrder);
+                _processor->_memoryBus->notifyStore(physicalAddress);
+                return true;
+            }
+        }
+        //  ...else simulate by series of byte stores
+        if constexpr (GuestByteOrder == ByteOrder::BigEndian)
+        {
+            for (unsigned i = 0; i < 8; i++)
+            {
+                if (!_storeByte(address++, static_cast<uint8_t>(value >> (8 * (7 - i))), false))
+                {
+                    return false;
+                }
+            }
         }
+        else
+        {
+            address += 8;
+            for (unsigned i = 0; i < 8; i++)
+            {
+                if (!_storeByte(--address, static_cast<uint8_t>(value >> (8 * (7 - i))), false))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
     }
     else
     {   //  OOPS! Alignment constraint violated
-        throw ProgramInterrupt::DALIGN;
+        _raiseProgramInterrupt(ProgramInterrupt::DALIGN);
+        return false;
+    }
+}
+
+template <ByteOrder GuestByteOrder>
+bool ProcessorCore::_exchangeLongWord(uint64_t address, uint64_t value, uint64_t & oldValue)
+{
+    if ((address & 0x07) == 0)
+    {   //  Naturally aligned - a host atomic exchange if in RAM...
+        uint64_t physicalAddress = 0;
+        uint8_t * hostData = nullptr;
+        if (!_translateUnalignedAddress(address, 8, true, physicalAddress, hostData))
+        {
+            return false;
+        }
+        if (hostData != nullptr)
+        {   //  ...which is a load and a store as far as monitoring is concerned
+            _monitorLoad(address);
+            _monitorStore(address);
+            oldValue = hadesvm::util::exchangeWithByteOrder<uint64_t>(hostData, value, GuestByteOrder);
+            _processor->_memoryBus->notifyStore(physicalAddress);
+            return true;
+        }
+    }
+    //  ...else a load and a store with the memory bus locked
+    QMutexLocker lock(_processor->_memoryBus);
+    uint64_t loadedValue = 0;
+    if (!_loadLongWord<GuestByteOrder>(address, loadedValue) ||
+        !_storeLongWord<GuestByteOrder>(address, value))
+    {
+        return false;
+    }
+    oldValue = loadedValue;
+    return true;
+}
+
+//  Instantiations for both guest byte orders
+template bool ProcessorCore::_fetchLongWord<ByteOrder::BigEndian>(uint64_t address, uint64_t & value);
+template bool ProcessorCore::_fetchLongWord<ByteOrder::LittleEndian>(uint64_t address, uint64_t & value);
+template bool ProcessorCore::_loadHalfWord<ByteOrder::BigEndian>(uint64_t address, uint16_t & value);
+template bool ProcessorCore::_loadHalfWord<ByteOrder::LittleEndian>(uint64_t address, uint16_t & value);
+template bool ProcessorCore::_loadWord<ByteOrder::BigEndian>(uint64_t address, uint32_t & value);
+template bool ProcessorCore::_loadWord<ByteOrder::LittleEndian>(uint64_t address, uint32_t & value);
+template bool ProcessorCore::_loadLongWord<ByteOrder::BigEndian>(uint64_t address, uint64_t & value);
+template bool ProcessorCore::_loadLongWord<ByteOrder::LittleEndian>(uint64_t address, uint64_t & value);
+template bool ProcessorCore::_storeHalfWord<ByteOrder::BigEndian>(uint64_t address, uint16_t value);
+template bool ProcessorCore::_storeHalfWord<ByteOrder::LittleEndian>(uint64_t address, uint16_t value);
+template bool ProcessorCore::_storeWord<ByteOrder::BigEndian>(uint64_t address, uint32_t value);
+template bool ProcessorCore::_storeWord<ByteOrder::LittleEndian>(uint64_t address, uint32_t value);
+template bool ProcessorCore::_storeLongWord<ByteOrder::BigEndian>(uint64_t address, uint64_t value);
+template bool ProcessorCore::_storeLongWord<ByteOrder::LittleEndian>(uint64_t address, uint64_t value);
+template bool ProcessorCore::_exchangeLongWord<ByteOrder::BigEndian>(uint64_t address, uint64_t value, uint64_t & oldValue);
+template bool ProcessorCore::_exchangeLongWord<ByteOrder::LittleEndian>(uint64_t address, uint64_t value, uint64_t & oldValue);
+
+//////////
+//  Implementation helpers (performance monitoring)
+void ProcessorCore::_addToPerformanceCounter(PerformanceEvent event, uint64_t count)
+{
+    Q_ASSERT(_performanceMonitoringEnabled);
+
+    unsigned counter = _PmFirstCounterRegister + static_cast<unsigned>(event);
+    Q_ASSERT(counter < 32);
+
+    uint64_t oldValue = _m[counter];
+    _m[counter] += count;
+    if (_m[counter] < oldValue)
+    {   //  Overflow - record it and request an interrupt if enabled
+        uint64_t counterMask = UINT64_C(1) << counter;
+        _m[_PmOverflowRegister] |= counterMask;
+        if ((_m[_PmInterruptEnableRegister] & counterMask) != 0)
+        {
+            _performanceInterruptPending = true;
+        }
     }
 }
 
+void ProcessorCore::_updatePerformanceMonitoring()
+{
+    _performanceMonitoringEnabled =
+        _features.has(Feature::PerformanceMonitoring) &&
+        (_m[_PmControlRegister] & _PmEnableMask) != 0;
+}
+
+//////////
+//  Implementation helpers (profiling)
+void ProcessorCore::_takeProfileSample()
+{
+    Q_ASSERT(_profileSamples != nullptr);
+
+    ProfileSample sample;
+    sample.kernelMode = _state.isInKernelMode();
+    sample.ip = _r[_IpRegister];
+
+    //  Walk the frame chain outwards; stop at the first frame that
+    //  doesn't look sane, as the guest need not keep $fp at all
+    uint64_t fp = _r[_FpRegister];
+    while (sample.numReturnAddresses < ProfileSample::MaxReturnAddresses &&
+           fp != 0 && (fp % 8) == 0)
+    {
+        uint64_t callerFp = 0, returnAddress = 0;
+        if (!_peekLongWord(fp, callerFp) || !_peekLongWord(fp + 8, returnAddress) ||
+            returnAddress == 0)
+        {
+            break;
+        }
+        sample.returnAddresses[sample.numReturnAddresses++] = returnAddress;
+        if (callerFp <= fp)
+        {   //  Stacks grow down, so this can't be the caller's frame
+            break;
+        }
+        fp = callerFp;
+    }
+
+    _profileSamples->tryEnqueue(sample);    //  ...or drop it if the Processor lags behind
+    _nextSampleCc = _cc + _profilingInterval;
+}
+
+bool ProcessorCore::_peekLongWord(uint64_t address, uint64_t & value)
+{
+    uint64_t physicalAddress = address;
+    if (_state.isInVirtualMode())
+    {
+        Mmu::Context context { _processor->_memoryBus, _pth, _state.getByteOrder() };
+        uint64_t physicalPage = 0;
+        unsigned accessRights = 0;
+        if (_mmu->translatePage(context, address, physicalPage, accessRights) != MemoryAccessError::None ||
+            (accessRights & Mmu::LoadAccess) == 0 ||
+            (_state.isInUserMode() && (accessRights & Mmu::UserAccess) == 0))
+        {
+            return false;
+        }
+        physicalAddress = physicalPage + (address & Mmu::PageOffsetMask);
+    }
+    return _processor->_memoryBus->loadLongWord(physicalAddress, _state.getByteOrder(), value) == MemoryAccessError::None;
+}
+
 //////////
 //  Implementation helpers (interrupt handling)
-Q_NORETURN void ProcessorCore::_translateAndThrowI(MemoryAccessError memoryAccessError) throws(ProgramInterrupt, HardwareInterrupt)
+void ProcessorCore::_translateAndRaiseI(MemoryAccessError memoryAccessError)
 {
     switch (memoryAccessError)
     {
         case MemoryAccessError::InvalidAddress:
-            throw ProgramInterrupt::IADDRESS;
+            _raiseProgramInterrupt(ProgramInterrupt::IADDRESS);
+            break;
         case MemoryAccessError::InvalidAlignment:
-            throw ProgramInterrupt::IALIGN;
+            _raiseProgramInterrupt(ProgramInterrupt::IALIGN);
+            break;
         case MemoryAccessError::AccessDenied:
-            throw ProgramInterrupt::IACCESS;
+            _raiseProgramInterrupt(ProgramInterrupt::IACCESS);
+            break;
+        case MemoryAccessError::PageFault:
+            _raiseProgramInterrupt(ProgramInterrupt::IPAGEFAULT);
+            break;
+        case MemoryAccessError::InvalidPageTable:
+            _raiseProgramInterrupt(ProgramInterrupt::PAGETABLE);
+            break;
+        case MemoryAccessError::None:
         case MemoryAccessError::HardwareFault:
         default:
-            throw HardwareInterrupt::MEMORY;
+            _raiseHardwareInterrupt(HardwareInterrupt::MEMORY);
+            break;
     }
 }
 
-Q_NORETURN void ProcessorCore::_translateAndThrowD(MemoryAccessError memoryAccessError) throws(ProgramInterrupt, HardwareInterrupt)
+void ProcessorCore::_translateAndRaiseD(MemoryAccessError memoryAccessError)
 {
     switch (memoryAccessError)
     {
         case MemoryAccessError::InvalidAddress:
-            throw ProgramInterrupt::DADDRESS;
+            _raiseProgramInterrupt(ProgramInterrupt::DADDRESS);
+            break;
         case MemoryAccessError::InvalidAlignment:
-            throw ProgramInterrupt::DALIGN;
+            _raiseProgramInterrupt(ProgramInterrupt::DALIGN);
+            break;
         case MemoryAccessError::AccessDenied:
-            throw ProgramInterrupt::DACCESS;
+            _raiseProgramInterrupt(ProgramInterrupt::DACCESS);
+            break;
+        case MemoryAccessError::PageFault:
+            _raiseProgramInterrupt(ProgramInterrupt::DPAGEFAULT);
+            break;
+        case MemoryAccessError::InvalidPageTable:
+            _raiseProgramInterrupt(ProgramInterrupt::PAGETABLE);
+            break;
+        case MemoryAccessError::None:
         case MemoryAccessError::HardwareFault:
         default:
-            throw HardwareInterrupt::MEMORY;
+            _raiseHardwareInterrupt(HardwareInterrupt::MEMORY);
+            break;
     }
 }
 
-Q_NORETURN void ProcessorCore::_translateAndThrowIO(IoError ioError) throws(ProgramInterrupt, HardwareInterrupt)
+void ProcessorCore::_translateAndRaiseIO(IoError ioError)
 {
     switch (ioError)
     {
         case IoError::NotReady: //  tstp/setp should NEVER be "not ready"
         case IoError::HardwareFault:
         default:
-            throw HardwareInterrupt::IO;
+            _raiseHardwareInterrupt(HardwareInterrupt::IO);
+            break;
     }
 }
 
 void ProcessorCore::_handleTimerInterrupt()
 {
     Q_ASSERT(_state.isTimerInterruptsEnabled());
+    _countPerformanceEvent(PerformanceEvent::TimerInterrupts);
+    if (_traceEncoder != nullptr)
+    {
+        _traceEncoder->recordInterrupt(TraceInterrupt::Timer, 0);
+    }
 
     //  TODO make sure state change is valid (e.g. byte order change, etc.)
     _isaveipTm = _r[_IpRegister];
@@ -659,6 +1390,11 @@ void ProcessorCore::_handleTimerInterrupt()
 void ProcessorCore::_handleIoInterrupt(uint64_t interruptStatusCode)
 {
     Q_ASSERT(_state.isIoInterruptsEnabled());
+    _countPerformanceEvent(PerformanceEvent::IoInterrupts);
+    if (_traceEncoder != nullptr)
+    {
+        _traceEncoder->recordInterrupt(TraceInterrupt::Io, interruptStatusCode);
+    }
 
     //  TODO make sure state change is valid (e.g. byte order change, etc.)
     _isaveipIo = _r[_IpRegister];
@@ -671,6 +1407,11 @@ void ProcessorCore::_handleIoInterrupt(uint64_t interruptStatusCode)
 void ProcessorCore::_handleSvcInterrupt()
 {
     Q_ASSERT(_state.isSvcInterruptsEnabled());
+    _countPerformanceEvent(PerformanceEvent::SvcInterrupts);
+    if (_traceEncoder != nullptr)
+    {
+        _traceEncoder->recordInterrupt(TraceInterrupt::Svc, 0);
+    }
 
     //  TODO make sure state change is valid (e.g. byte order change, etc.)
     _isaveipSvc = _r[_IpRegister];
@@ -682,6 +1423,11 @@ void ProcessorCore::_handleSvcInterrupt()
 void ProcessorCore::_handleProgramInterrupt(ProgramInterrupt interruptStatusCode)
 {
     Q_ASSERT(_state.isProgramInterruptsEnabled());
+    _countPerformanceEvent(PerformanceEvent::ProgramInterrupts);
+    if (_traceEncoder != nullptr)
+    {
+        _traceEncoder->recordInterrupt(TraceInterrupt::Program, static_cast<uint64_t>(interruptStatusCode));
+    }
 
     //  TODO make sure state change is valid (e.g. byte order change, etc.)
     _isaveipPrg = _r[_IpRegister];
@@ -694,6 +1440,11 @@ void ProcessorCore::_handleProgramInterrupt(ProgramInterrupt interruptStatusCode
 void ProcessorCore::_handleExternalInterrupt(uint64_t interruptStatusCode)
 {
     Q_ASSERT(_state.isExternalInterruptsEnabled());
+    _countPerformanceEvent(PerformanceEvent::ExternalInterrupts);
+    if (_traceEncoder != nullptr)
+    {
+        _traceEncoder->recordInterrupt(TraceInterrupt::External, interruptStatusCode);
+    }
 
     //  TODO make sure state change is valid (e.g. byte order change, etc.)
     _isaveipExt = _r[_IpRegister];
@@ -706,6 +1457,11 @@ void ProcessorCore::_handleExternalInterrupt(uint64_t interruptStatusCode)
 void ProcessorCore::_handleHardwareInterrupt(HardwareInterrupt interruptStatusCode)
 {
     Q_ASSERT(_state.isHardwareInterruptsEnabled());
+    _countPerformanceEvent(PerformanceEvent::HardwareInterrupts);
+    if (_traceEncoder != nullptr)
+    {
+        _traceEncoder->recordInterrupt(TraceInterrupt::Hardware, static_cast<uint64_t>(interruptStatusCode));
+    }
 
     //  TODO make sure state change is valid (e.g. byte order change, etc.)
     _isaveipHw = _r[_IpRegister];
@@ -723,7 +1479,7 @@ void ProcessorCore::_raiseProgramInterrupt(ProgramInterrupt interruptStatusCode)
     }
     else
     {   //  Masked - HALT
-        throw ForceHalt();
+        _state.setIdleMode();
     }
 }
 
@@ -735,702 +1491,1311 @@ void ProcessorCore::_raiseHardwareInterrupt(HardwareInterrupt interruptStatusCod
     }
     else
     {   //  Masked - HALT
-        throw ForceHalt();
+        _state.setIdleMode();
     }
 }
 
 //////////
-//  Implementation helpers (instruction execution)
-unsigned ProcessorCore::_fetchAndExecuteInstruction() throws(ProgramInterrupt, HardwareInterrupt)
+//  Implementation helpers (basic blocks)
+bool ProcessorCore::_enterBasicBlock(uint64_t address)
 {
-    //  Translate instruction address and fetch the instruction
-    uint64_t instructionAddress = _r[_IpRegister];
-    _r[_IpRegister] += 4;
-    uint32_t instruction = _fetchInstruction(instructionAddress);
-
-    //  Dispatch to handler
-    static const _InstructionHandler DispatchTable[64] =
-    {
-        //  000...
-        &ProcessorCore::_handleLiL,                 //  ...000
-        &ProcessorCore::_handleCop1,                //  ...001
-        &ProcessorCore::_handleAddiL,               //  ...010
-        &ProcessorCore::_handleSubiL,               //  ...011
-        &ProcessorCore::_handleMuliL,               //  ...100
-        &ProcessorCore::_handleDiviL,               //  ...101
-        &ProcessorCore::_handleModiL,               //  ...110
-        &ProcessorCore::_handleJ,                   //  ...111
-        //  001...
-        &ProcessorCore::_handleLiD,                 //  ...000
-        &ProcessorCore::_handleLir,                 //  ...001
-        &ProcessorCore::_handleAddiUL,              //  ...010
-        &ProcessorCore::_handleSubiUL,              //  ...011
-        &ProcessorCore::_handleMuliUL,              //  ...100
-        &ProcessorCore::_handleDiviUL,              //  ...101
-        &ProcessorCore::_handleModiUL,              //  ...110
-        &ProcessorCore::_handleJal,                 //  ...111
-        //  010...
-        &ProcessorCore::_handleSeqiL,               //  ...000
-        &ProcessorCore::_handleSneiL,               //  ...001
-        &ProcessorCore::_handleSltiL,               //  ...010
-        &ProcessorCore::_handleSleiL,               //  ...011
-        &ProcessorCore::_handleSgtiL,               //  ...100
-        &ProcessorCore::_handleSgeiL,               //  ...101
-        &ProcessorCore::_handleSltiUL,              //  ...110
-        &ProcessorCore::_handleSleiUL,              //  ...111
-        //  011...
-        &ProcessorCore::_handleAndiL,               //  ...000
-        &ProcessorCore::_handleOriL,                //  ...001
-        &ProcessorCore::_handleXoriL,               //  ...010
-        &ProcessorCore::_handleImpliL,              //  ...011
-        &ProcessorCore::_handleLdm,                 //  ...100
-        &ProcessorCore::_handleStm,                 //  ...101
-        &ProcessorCore::_handleSgtiUL,              //  ...110
-        &ProcessorCore::_handleSgeiUL,              //  ...111
-        //  100...
-        &ProcessorCore::_handleLB,                  //  ...000
-        &ProcessorCore::_handleLUB,                 //  ...001
-        &ProcessorCore::_handleLH,                  //  ...010
-        &ProcessorCore::_handleLUH,                 //  ...011
-        &ProcessorCore::_handleLW,                  //  ...100
-        &ProcessorCore::_handleLUW,                 //  ...101
-        &ProcessorCore::_handleLL,                  //  ...110
-        &ProcessorCore::_handleXchg,                //  ...111
-        //  101...
-        &ProcessorCore::_handleSB,                  //  ...000
-        &ProcessorCore::_handleSH,                  //  ...001
-        &ProcessorCore::_handleSW,                  //  ...010
-        &ProcessorCore::_handleSL,                  //  ...011
-        &ProcessorCore::_handleLF,                  //  ...100
-        &ProcessorCore::_handleLD,                  //  ...101
-        &ProcessorCore::_handleSF,                  //  ...110
-        &ProcessorCore::_handleSD,                  //  ...111
-        //  110...
-        &ProcessorCore::_handleBeqL,                //  ...000
-        &ProcessorCore::_handleBneL,                //  ...001
-        &ProcessorCore::_handleBltL,                //  ...010
-        &ProcessorCore::_handleBleL,                //  ...011
-        &ProcessorCore::_handleBgtL,                //  ...100
-        &ProcessorCore::_handleBgeL,                //  ...101
-        &ProcessorCore::_handleBltUL,               //  ...110
-        &ProcessorCore::_handleBleUL,               //  ...111
-        //  111...
-        &ProcessorCore::_handleBeqD,                //  ...000
-        &ProcessorCore::_handleBneD,                //  ...001
-        &ProcessorCore::_handleBltD,                //  ...010
-        &ProcessorCore::_handleBleD,                //  ...011
-        &ProcessorCore::_handleBgtD,                //  ...100
-        &ProcessorCore::_handleBgeD,                //  ...101
-        &ProcessorCore::_handleBgtUL,               //  ...110
-        &ProcessorCore::_handleBgeUL                //  ...111
-    };
+    if ((address & 0x03) != 0)
+    {   //  OOPS! (even if unaligned operands feature is present)
+        _raiseProgramInterrupt(ProgramInterrupt::IALIGN);
+        return false;
+    }
 
-    _InstructionHandler handler = DispatchTable[instruction >> 26];
-    return (this->*handler)(instruction);
+    //  Drop stale basic blocks first
+    if (_basicBlockInvalidationPending.load(std::memory_order_acquire))
+    {
+        _processBasicBlockInvalidations();
+    }
+    else if (_followBasicBlockLink(address))
+    {   //  Linked from the current basic block
+        return true;
+    }
+
+    //  Locate the basic block...
+    uint64_t physicalAddress = 0;
+    if (!_translateFetchAddress(address, physicalAddress))
+    {
+        return false;
+    }
+    //  A core that can't change byte order stays pinned to the
+    //  handlers instantiated for its initial byte order
+    ByteOrder byteOrder = _canChangeByteOrder ? _state.getByteOrder() : _initialByteOrder;
+
+    _BasicBlock * basicBlock = &_basicBlockCache[(physicalAddress >> 2) & (_BasicBlockCacheSize - 1)];
+    if (basicBlock->numInstructions == 0 ||
+        basicBlock->physicalAddress != physicalAddress ||
+        basicBlock->byteOrder != byteOrder)
+    {   //  ...decoding it if not cached
+        if (!_decodeBasicBlock(basicBlock, physicalAddress, byteOrder))
+        {
+            return false;
+        }
+    }
+
+    //  ...and make it current
+    if (_currentBasicBlock != nullptr &&
+        _currentBasicBlock->executionCount >= _HotBasicBlockThreshold)
+    {
+        _linkBasicBlock(_currentBasicBlock, address, basicBlock);
+    }
+    _currentBasicBlock = basicBlock;
+    basicBlock->executionCount++;
+    _nextDecodedInstruction = basicBlock->instructions;
+    _endDecodedInstructions = basicBlock->instructions + basicBlock->numInstructions;
+    _nextDecodedInstructionAddress = address;
+    return true;
 }
 
-unsigned ProcessorCore::_handleInvalidInstruction(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    //  TODO kill off the printout
-    qDebug() << "Unsupported instruction "
-             << hadesvm::util::toString(instruction, "%08X")
-             << " at "
-             << hadesvm::util::toString(_r[_IpRegister] - 4, "%016X")
-             << "\n";
-    throw ProgramInterrupt::OPCODE;
-}
-
-unsigned ProcessorCore::_handleCop1(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    static const _InstructionHandler DispatchTable[32] =
-    {
-        //  00...
-        &ProcessorCore::_handleShift1,              //  ..000
-        &ProcessorCore::_handleShift2,              //  ..001
-        &ProcessorCore::_handleBfiL,                //  ..010
-        &ProcessorCore::_handleBfiL,                //  ..011
-        &ProcessorCore::_handleBfeL,                //  ..100
-        &ProcessorCore::_handleBfeL,                //  ..101
-        &ProcessorCore::_handleBfeUL,               //  ..110
-        &ProcessorCore::_handleBfeUL,               //  ..111
-        //  01...
-        &ProcessorCore::_handleBase1,               //  ..000
-        &ProcessorCore::_handleBase2,               //  ..001
-        &ProcessorCore::_handleBase3,               //  ..010
-        &ProcessorCore::_handleBase4,               //  ..011
-        &ProcessorCore::_handleBase5,               //  ..100
-        &ProcessorCore::_handleInvalidInstruction,  //  ..101
-        &ProcessorCore::_handleInvalidInstruction,  //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-        //  10...
-        &ProcessorCore::_handleFp1,                 //  ..000
-        &ProcessorCore::_handleInvalidInstruction,  //  ..001
-        &ProcessorCore::_handleInvalidInstruction,  //  ..010
-        &ProcessorCore::_handleInvalidInstruction,  //  ..011
-        &ProcessorCore::_handleInvalidInstruction,  //  ..100
-        &ProcessorCore::_handleInvalidInstruction,  //  ..101
-        &ProcessorCore::_handleInvalidInstruction,  //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-        //  11...
-        &ProcessorCore::_handleInvalidInstruction,  //  ..000
-        &ProcessorCore::_handleInvalidInstruction,  //  ..001
-        &ProcessorCore::_handleInvalidInstruction,  //  ..010
-        &ProcessorCore::_handleInvalidInstruction,  //  ..011
-        &ProcessorCore::_handleInvalidInstruction,  //  ..100
-        &ProcessorCore::_handleInvalidInstruction,  //  ..101
-        &ProcessorCore::_handleInvalidInstruction,  //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-    };
+bool ProcessorCore::_followBasicBlockLink(uint64_t address)
+{
+    if (_currentBasicBlock == nullptr)
+    {
+        return false;
+    }
+    for (const _BasicBlockLink & link : _currentBasicBlock->links)
+    {
+        if (link.target != nullptr &&
+            link.address == address &&
+            link.state == _state &&
+            link.epoch == _basicBlockLinkEpoch)
+        {
+            _BasicBlock * basicBlock = link.target;
+            _currentBasicBlock = basicBlock;
+            basicBlock->executionCount++;
+            _nextDecodedInstruction = basicBlock->instructions;
+            _endDecodedInstructions = basicBlock->instructions + basicBlock->numInstructions;
+            _nextDecodedInstructionAddress = address;
+            return true;
+        }
+    }
+    return false;
+}
 
-    _InstructionHandler handler = DispatchTable[(instruction >> 6) & 0x1F];
-    return (this->*handler)(instruction);
+void ProcessorCore::_linkBasicBlock(_BasicBlock * from, uint64_t address, _BasicBlock * to)
+{
+    _BasicBlockLink & link = from->links[from->nextLinkToReplace];
+    from->nextLinkToReplace = (from->nextLinkToReplace + 1) % _MaxBasicBlockLinks;
+    link.address = address;
+    link.state = _state;
+    link.epoch = _basicBlockLinkEpoch;
+    link.target = to;
 }
 
-unsigned ProcessorCore::_handleShift1(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    static const _InstructionHandler DispatchTable[32] =
-    {
-        //  00...
-        &ProcessorCore::_handleShliB,               //  ..000
-        &ProcessorCore::_handleShliUB,              //  ..001
-        &ProcessorCore::_handleShliH,               //  ..010
-        &ProcessorCore::_handleShliUH,              //  ..011
-        &ProcessorCore::_handleShliW,               //  ..100
-        &ProcessorCore::_handleShliUW,              //  ..101
-        &ProcessorCore::_handleShliL,               //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-        //  01...
-        &ProcessorCore::_handleShriB,               //  ..000
-        &ProcessorCore::_handleShriUB,              //  ..001
-        &ProcessorCore::_handleShriH,               //  ..010
-        &ProcessorCore::_handleShriUH,              //  ..011
-        &ProcessorCore::_handleShriW,               //  ..100
-        &ProcessorCore::_handleShriUW,              //  ..101
-        &ProcessorCore::_handleShriL,               //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-        //  10...
-        &ProcessorCore::_handleAsliB,               //  ..000
-        &ProcessorCore::_handleAsliUB,              //  ..001
-        &ProcessorCore::_handleAsliH,               //  ..010
-        &ProcessorCore::_handleAsliUH,              //  ..011
-        &ProcessorCore::_handleAsliW,               //  ..100
-        &ProcessorCore::_handleAsliUW,              //  ..101
-        &ProcessorCore::_handleAsliL,               //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-        //  11...
-        &ProcessorCore::_handleAsriB,               //  ..000
-        &ProcessorCore::_handleAsriUB,              //  ..001
-        &ProcessorCore::_handleAsriH,               //  ..010
-        &ProcessorCore::_handleAsriUH,              //  ..011
-        &ProcessorCore::_handleAsriW,               //  ..100
-        &ProcessorCore::_handleAsriUW,              //  ..101
-        &ProcessorCore::_handleAsriL,               //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-    };
+bool ProcessorCore::_decodeBasicBlock(_BasicBlock * basicBlock, uint64_t physicalAddress, ByteOrder byteOrder)
+{
+    Q_ASSERT((physicalAddress & 0x03) == 0);
 
-    _InstructionHandler handler = DispatchTable[(instruction >> 11) & 0x1F];
-    return (this->*handler)(instruction);
+    if (basicBlock->numInstructions != 0)
+    {   //  Evict the block previously cached here
+        _removeFromWatchSlot(basicBlock);
+    }
+    basicBlock->physicalAddress = physicalAddress;
+    basicBlock->byteOrder = byteOrder;
+    basicBlock->numInstructions = 0;
+    basicBlock->executionCount = 0;
+    basicBlock->nextLinkToReplace = 0;
+    for (_BasicBlockLink & link : basicBlock->links)
+    {
+        link.target = nullptr;
+    }
+    basicBlock->translatedCode = nullptr;
+    //  Links to the block previously cached here are stale now
+    _basicBlockLinkEpoch++;
+
+    //  Watch the page BEFORE reading its content, so that a store racing
+    //  with decoding still causes the block to be dropped
+    _processor->_memoryBus->watchPage(physicalAddress);
+
+    //  A basic block never spans more than one watched page
+    uint64_t bytesLeftInPage = MemoryBus::WatchPageSize - (physicalAddress & (MemoryBus::WatchPageSize - 1));
+    unsigned maxInstructions = static_cast<unsigned>(qMin(static_cast<uint64_t>(_MaxBasicBlockLength), bytesLeftInPage / 4));
+
+    //  If the page is RAM or ROM, fetch all candidate instructions at once
+    uint32_t instructions[_MaxBasicBlockLength];
+    const uint8_t * hostData = _processor->_memoryBus->hostMemory(physicalAddress, maxInstructions * 4, false);
+    if (hostData != nullptr)
+    {
+        hadesvm::util::loadWithByteOrder<uint32_t>(instructions, hostData, maxInstructions, byteOrder);
+    }
+
+    for (unsigned i = 0; i < maxInstructions; i++)
+    {
+        uint32_t instruction = 0;
+        MemoryAccessError error = MemoryAccessError::None;
+        if (hostData != nullptr)
+        {
+            instruction = instructions[i];
+        }
+        else
+        {
+            error = _processor->_memoryBus->loadWord(physicalAddress + i * 4, byteOrder, instruction);
+        }
+        if (error != MemoryAccessError::None)
+        {
+            if (i == 0)
+            {   //  OOPS! Can't even fetch the 1st instruction - translate & raise
+                _translateAndRaiseI(error);
+                return false;
+            }
+            //  The unfetchable instruction will start a basic block of its
+            //  own and the error will be reported if it is ever executed
+            break;
+        }
+        _InstructionHandler handler = _decodeInstruction(instruction, byteOrder);
+        basicBlock->instructions[i].handler = handler;
+        basicBlock->instructions[i].instruction = instruction;
+        basicBlock->instructions[i].threadedCode = nullptr;
+        _decodeOperands(basicBlock->instructions[i]);
+        basicBlock->numInstructions++;
+        if (_endsBasicBlock(handler))
+        {
+            break;
+        }
+    }
+    _fuseInstructions(basicBlock);
+    _addToWatchSlot(basicBlock);
+    return true;
 }
 
-unsigned ProcessorCore::_handleShift2(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    static const _InstructionHandler DispatchTable[32] =
-    {
-        //  00...
-        &ProcessorCore::_handleRoliB,               //  ..000
-        &ProcessorCore::_handleRoliUB,              //  ..001
-        &ProcessorCore::_handleRoliH,               //  ..010
-        &ProcessorCore::_handleRoliUH,              //  ..011
-        &ProcessorCore::_handleRoliW,               //  ..100
-        &ProcessorCore::_handleRoliUW,              //  ..101
-        &ProcessorCore::_handleRoliL,               //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-        //  01...
-        &ProcessorCore::_handleRoriB,               //  ..000
-        &ProcessorCore::_handleRoriUB,              //  ..001
-        &ProcessorCore::_handleRoriH,               //  ..010
-        &ProcessorCore::_handleRoriUH,              //  ..011
-        &ProcessorCore::_handleRoriW,               //  ..100
-        &ProcessorCore::_handleRoriUW,              //  ..101
-        &ProcessorCore::_handleRoriL,               //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-        //  10...
-        &ProcessorCore::_handleBeqiL,               //  ..000
-        &ProcessorCore::_handleBneiL,               //  ..001
-        &ProcessorCore::_handleBltiL,               //  ..010
-        &ProcessorCore::_handleBleiL,               //  ..011
-        &ProcessorCore::_handleBgtiL,               //  ..100
-        &ProcessorCore::_handleBgeiL,               //  ..101
-        &ProcessorCore::_handleInvalidInstruction,  //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-        //  11...
-        &ProcessorCore::_handleInvalidInstruction,  //  ..000
-        &ProcessorCore::_handleInvalidInstruction,  //  ..001
-        &ProcessorCore::_handleBltiUL,              //  ..010
-        &ProcessorCore::_handleBleiUL,              //  ..011
-        &ProcessorCore::_handleBgtiUL,              //  ..100
-        &ProcessorCore::_handleBgeiUL,              //  ..101
-        &ProcessorCore::_handleInvalidInstruction,  //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-    };
+void ProcessorCore::_processBasicBlockInvalidations()
+{
+    //  Clear the "pending" flag BEFORE collecting the invalidated slots, so
+    //  that an invalidation arriving meanwhile is never lost
+    _basicBlockInvalidationPending.store(false, std::memory_order_seq_cst);
 
-    _InstructionHandler handler = DispatchTable[(instruction >> 11) & 0x1F];
-    return (this->*handler)(instruction);
+    for (size_t i = 0; i < MemoryBus::WatchSlotCount / 64 / 64; i++)
+    {
+        uint64_t invalidatedWords = _invalidatedWatchSlotWords[i].exchange(0, std::memory_order_acq_rel);
+        for (; invalidatedWords != 0; invalidatedWords &= invalidatedWords - 1)
+        {
+            size_t word = i * 64 + static_cast<size_t>(std::countr_zero(invalidatedWords));
+            uint64_t invalidatedSlots = _invalidatedWatchSlots[word].exchange(0, std::memory_order_acq_rel);
+            for (; invalidatedSlots != 0; invalidatedSlots &= invalidatedSlots - 1)
+            {   //  Drop all cached blocks of the watch slot
+                size_t watchSlot = word * 64 + static_cast<size_t>(std::countr_zero(invalidatedSlots));
+                for (_BasicBlock * basicBlock = _basicBlocksByWatchSlot[watchSlot]; basicBlock != nullptr; basicBlock = basicBlock->nextInWatchSlot)
+                {
+                    basicBlock->numInstructions = 0;
+                }
+                _basicBlocksByWatchSlot[watchSlot] = nullptr;
+            }
+        }
+    }
+
+    //  The current basic block may have been dropped
+    _nextDecodedInstruction = _endDecodedInstructions = nullptr;
+    _currentBasicBlock = nullptr;
+    _basicBlockLinkEpoch++;
+}
+
+void ProcessorCore::_invalidateAllBasicBlocks()
+{
+    _basicBlockInvalidationPending = false;
+    for (size_t i = 0; i < MemoryBus::WatchSlotCount / 64; i++)
+    {
+        _invalidatedWatchSlots[i] = 0;
+    }
+    for (size_t i = 0; i < MemoryBus::WatchSlotCount / 64 / 64; i++)
+    {
+        _invalidatedWatchSlotWords[i] = 0;
+    }
+    for (size_t i = 0; i < MemoryBus::WatchSlotCount; i++)
+    {
+        _basicBlocksByWatchSlot[i] = nullptr;
+    }
+    for (size_t j = 0; j < _BasicBlockCacheSize; j++)
+    {
+        _basicBlockCache[j].numInstructions = 0;
+    }
+    _nextDecodedInstruction = _endDecodedInstructions = nullptr;
+    _currentBasicBlock = nullptr;
+    _basicBlockLinkEpoch++;
+}
+
+void ProcessorCore::_addToWatchSlot(_BasicBlock * basicBlock)
+{
+    _BasicBlock *& head = _basicBlocksByWatchSlot[MemoryBus::watchSlot(basicBlock->physicalAddress)];
+    basicBlock->previousInWatchSlot = nullptr;
+    basicBlock->nextInWatchSlot = head;
+    if (head != nullptr)
+    {
+        head->previousInWatchSlot = basicBlock;
+    }
+    head = basicBlock;
+}
+
+void ProcessorCore::_removeFromWatchSlot(_BasicBlock * basicBlock)
+{
+    if (basicBlock->previousInWatchSlot != nullptr)
+    {
+        basicBlock->previousInWatchSlot->nextInWatchSlot = basicBlock->nextInWatchSlot;
+    }
+    else
+    {
+        _basicBlocksByWatchSlot[MemoryBus::watchSlot(basicBlock->physicalAddress)] = basicBlock->nextInWatchSlot;
+    }
+    if (basicBlock->nextInWatchSlot != nullptr)
+    {
+        basicBlock->nextInWatchSlot->previousInWatchSlot = basicBlock->previousInWatchSlot;
+    }
+}
+
+ProcessorCore::_InstructionHandler ProcessorCore::_decodeInstruction(uint32_t instruction, ByteOrder byteOrder)
+{
+    //  Resolve the sub-opcode dispatch (and the byte order
+    //  of memory accesses) once, at decoding time
+    _InstructionHandler handler = (byteOrder == ByteOrder::BigEndian) ?
+                                        _PrimaryDispatchTable<ByteOrder::BigEndian>[instruction >> 26] :
+                                        _PrimaryDispatchTable<ByteOrder::LittleEndian>[instruction >> 26];
+    if (handler == &ProcessorCore::_handleCop1)
+    {
+        handler = _Cop1DispatchTable[(instruction >> 6) & 0x1F];
+    }
+    if (handler == &ProcessorCore::_handleShift1)
+    {
+        handler = _Shift1DispatchTable[(instruction >> 11) & 0x1F];
+    }
+    else if (handler == &ProcessorCore::_handleShift2)
+    {
+        handler = _Shift2DispatchTable[(instruction >> 11) & 0x1F];
+    }
+    else if (handler == &ProcessorCore::_handleBase1)
+    {
+        handler = _Base1DispatchTable[instruction & 0x3F];
+    }
+    else if (handler == &ProcessorCore::_handleBase2)
+    {
+        handler = _Base2DispatchTable[instruction & 0x3F];
+    }
+    else if (handler == &ProcessorCore::_handleBase3)
+    {
+        handler = _Base3DispatchTable[instruction & 0x3F];
+    }
+    else if (handler == &ProcessorCore::_handleBase4)
+    {
+        handler = _Base4DispatchTable[(instruction >> 11) & 0x1F];
+    }
+    else if (handler == &ProcessorCore::_handleBase5)
+    {
+        handler = _Base5DispatchTable[instruction & 0x3F];
+    }
+    else if (handler == &ProcessorCore::_handleFp1)
+    {
+        handler = _Fp1DispatchTable[instruction & 0x3F];
+    }
+    return handler;
 }
 
-unsigned ProcessorCore::_handleBase1(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    static const _InstructionHandler DispatchTable[64] =
-    {
-        //  000...
-        &ProcessorCore::_handleMovCR,               //  ...000
-        &ProcessorCore::_handleMovRC,               //  ...001
-        &ProcessorCore::_handleInvalidInstruction,  //  ...010
-        &ProcessorCore::_handleInvalidInstruction,  //  ...011
-        &ProcessorCore::_handleInvalidInstruction,  //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  001...
-        &ProcessorCore::_handleInvalidInstruction,  //  ...000
-        &ProcessorCore::_handleInvalidInstruction,  //  ...001
-        &ProcessorCore::_handleInvalidInstruction,  //  ...010
-        &ProcessorCore::_handleInvalidInstruction,  //  ...011
-        &ProcessorCore::_handleInvalidInstruction,  //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  010...
-        &ProcessorCore::_handleInvalidInstruction,  //  ...000
-        &ProcessorCore::_handleInvalidInstruction,  //  ...001
-        &ProcessorCore::_handleInvalidInstruction,  //  ...010
-        &ProcessorCore::_handleInvalidInstruction,  //  ...011
-        &ProcessorCore::_handleInvalidInstruction,  //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  011...
-        &ProcessorCore::_handleIret,                //  ...000
-        &ProcessorCore::_handleHalt,                //  ...001
-        &ProcessorCore::_handleCpuid,               //  ...010
-        &ProcessorCore::_handleSigp,                //  ...011
-        &ProcessorCore::_handleInvalidInstruction,  //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  100...
-        &ProcessorCore::_handleTstp,                //  ...000
-        &ProcessorCore::_handleSetp,                //  ...001
-        &ProcessorCore::_handleInvalidInstruction,  //  ...010
-        &ProcessorCore::_handleInvalidInstruction,  //  ...011
-        &ProcessorCore::_handleInvalidInstruction,  //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  101...
-        &ProcessorCore::_handleInB,                 //  ...000
-        &ProcessorCore::_handleInH,                 //  ...001
-        &ProcessorCore::_handleInW,                 //  ...010
-        &ProcessorCore::_handleInL,                 //  ...011
-        &ProcessorCore::_handleOutB,                //  ...100
-        &ProcessorCore::_handleOutH,                //  ...101
-        &ProcessorCore::_handleOutB,                //  ...110
-        &ProcessorCore::_handleOutL,                //  ...111
-        //  110...
-        &ProcessorCore::_handleInUB,                //  ...000
-        &ProcessorCore::_handleInUH,                //  ...001
-        &ProcessorCore::_handleInUW,                //  ...010
-        &ProcessorCore::_handleInvalidInstruction,  //  ...011
-        &ProcessorCore::_handleInvalidInstruction,  //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  111...
-        &ProcessorCore::_handleInvalidInstruction,  //  ...000
-        &ProcessorCore::_handleInvalidInstruction,  //  ...001
-        &ProcessorCore::_handleInvalidInstruction,  //  ...010
-        &ProcessorCore::_handleInvalidInstruction,  //  ...011
-        &ProcessorCore::_handleInvalidInstruction,  //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction   //  ...111
+bool ProcessorCore::_endsBasicBlock(_InstructionHandler handler)
+{
+    //  Instructions that (may) transfer control or change $state, and
+    //  instructions that never complete normally
+    static const _InstructionHandler BasicBlockTerminators[] =
+    {
+        &ProcessorCore::_handleJ,
+        &ProcessorCore::_handleJal,
+        &ProcessorCore::_handleJr,
+        &ProcessorCore::_handleJalr,
+        &ProcessorCore::_handleBeqL,
+        &ProcessorCore::_handleBneL,
+        &ProcessorCore::_handleBltL,
+        &ProcessorCore::_handleBleL,
+        &ProcessorCore::_handleBgtL,
+        &ProcessorCore::_handleBgeL,
+        &ProcessorCore::_handleBltUL,
+        &ProcessorCore::_handleBleUL,
+        &ProcessorCore::_handleBgtUL,
+        &ProcessorCore::_handleBgeUL,
+        &ProcessorCore::_handleBeqiL,
+        &ProcessorCore::_handleBneiL,
+        &ProcessorCore::_handleBltiL,
+        &ProcessorCore::_handleBleiL,
+        &ProcessorCore::_handleBgtiL,
+        &ProcessorCore::_handleBgeiL,
+        &ProcessorCore::_handleBltiUL,
+        &ProcessorCore::_handleBleiUL,
+        &ProcessorCore::_handleBgtiUL,
+        &ProcessorCore::_handleBgeiUL,
+        &ProcessorCore::_handleBeqD,
+        &ProcessorCore::_handleBneD,
+        &ProcessorCore::_handleBltD,
+        &ProcessorCore::_handleBleD,
+        &ProcessorCore::_handleBgtD,
+        &ProcessorCore::_handleBgeD,
+        &ProcessorCore::_handleMovRC,
+        &ProcessorCore::_handleIret,
+        &ProcessorCore::_handleHalt,
+        &ProcessorCore::_handleSigp,
+        &ProcessorCore::_handleSvc,
+        &ProcessorCore::_handleBrk,
+        &ProcessorCore::_handleInvalidInstruction
     };
 
-    _InstructionHandler handler = DispatchTable[instruction & 0x3F];
+    for (_InstructionHandler terminator : BasicBlockTerminators)
+    {
+        if (handler == terminator)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+const ProcessorCore::_InstructionExecutor ProcessorCore::_InstructionExecutors[] =
+{
+    { &ProcessorCore::_handleLiL, &ProcessorCore::_executeLiL, _ImmediateFormat::SignedInt21, 0 },
+    { &ProcessorCore::_handleMovL, &ProcessorCore::_executeMovL, _ImmediateFormat::None, 0x0000F800 },
+    { &ProcessorCore::_handleNop, &ProcessorCore::_executeNop, _ImmediateFormat::None, 0x03FFF800 },
+    { &ProcessorCore::_handleAddL, &ProcessorCore::_executeAddL, _ImmediateFormat::None, 0 },
+    { &ProcessorCore::_handleSubL, &ProcessorCore::_executeSubL, _ImmediateFormat::None, 0 },
+    { &ProcessorCore::_handleAddiL, &ProcessorCore::_executeAddiL, _ImmediateFormat::SignedInt16, 0 },
+    { &ProcessorCore::_handleSubiL, &ProcessorCore::_executeSubiL, _ImmediateFormat::SignedInt16, 0 },
+    { &ProcessorCore::_handleAndL, &ProcessorCore::_executeAndL, _ImmediateFormat::None, 0 },
+    { &ProcessorCore::_handleOrL, &ProcessorCore::_executeOrL, _ImmediateFormat::None, 0 },
+    { &ProcessorCore::_handleXorL, &ProcessorCore::_executeXorL, _ImmediateFormat::None, 0 },
+    { &ProcessorCore::_handleAndiL, &ProcessorCore::_executeAndiL, _ImmediateFormat::UnsignedInt16, 0 },
+    { &ProcessorCore::_handleOriL, &ProcessorCore::_executeOriL, _ImmediateFormat::UnsignedInt16, 0 },
+    { &ProcessorCore::_handleXoriL, &ProcessorCore::_executeXoriL, _ImmediateFormat::UnsignedInt16, 0 },
+    { &ProcessorCore::_handleSeqL, &ProcessorCore::_executeSeqL, _ImmediateFormat::None, 0 },
+    { &ProcessorCore::_handleSltL, &ProcessorCore::_executeSltL, _ImmediateFormat::None, 0 },
+    { &ProcessorCore::_handleSltUL, &ProcessorCore::_executeSltUL, _ImmediateFormat::None, 0 },
+    { &ProcessorCore::_handleSeqiL, &ProcessorCore::_executeSeqiL, _ImmediateFormat::SignedInt16, 0 },
+    { &ProcessorCore::_handleSltiL, &ProcessorCore::_executeSltiL, _ImmediateFormat::SignedInt16, 0 },
+    { &ProcessorCore::_handleLL<ByteOrder::BigEndian>, &ProcessorCore::_executeLL<ByteOrder::BigEndian>, _ImmediateFormat::SignedInt16, 0 },
+    { &ProcessorCore::_handleLL<ByteOrder::LittleEndian>, &ProcessorCore::_executeLL<ByteOrder::LittleEndian>, _ImmediateFormat::SignedInt16, 0 },
+    { &ProcessorCore::_handleSL<ByteOrder::BigEndian>, &ProcessorCore::_executeSL<ByteOrder::BigEndian>, _ImmediateFormat::SignedInt16, 0 },
+    { &ProcessorCore::_handleSL<ByteOrder::LittleEndian>, &ProcessorCore::_executeSL<ByteOrder::LittleEndian>, _ImmediateFormat::SignedInt16, 0 },
+    { &ProcessorCore::_handleLdm<ByteOrder::BigEndian>, &ProcessorCore::_executeLdm<ByteOrder::BigEndian>, _ImmediateFormat::RegisterMask, 0 },
+    { &ProcessorCore::_handleLdm<ByteOrder::LittleEndian>, &ProcessorCore::_executeLdm<ByteOrder::LittleEndian>, _ImmediateFormat::RegisterMask, 0 },
+    { &ProcessorCore::_handleStm<ByteOrder::BigEndian>, &ProcessorCore::_executeStm<ByteOrder::BigEndian>, _ImmediateFormat::RegisterMask, 0 },
+    { &ProcessorCore::_handleStm<ByteOrder::LittleEndian>, &ProcessorCore::_executeStm<ByteOrder::LittleEndian>, _ImmediateFormat::RegisterMask, 0 },
+    { &ProcessorCore::_handleBeqL, &ProcessorCore::_executeBranch<&ProcessorCore::_isEqual>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleBneL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleBltL, &ProcessorCore::_executeBranch<&ProcessorCore::_isLess>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleBleL, &ProcessorCore::_executeBranch<&ProcessorCore::_isLessOrEqual>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleBgtL, &ProcessorCore::_executeBranch<&ProcessorCore::_isGreater>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleBgeL, &ProcessorCore::_executeBranch<&ProcessorCore::_isGreaterOrEqual>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleBltUL, &ProcessorCore::_executeBranch<&ProcessorCore::_isLessUnsigned>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleBleUL, &ProcessorCore::_executeBranch<&ProcessorCore::_isLessOrEqualUnsigned>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleBgtUL, &ProcessorCore::_executeBranch<&ProcessorCore::_isGreaterUnsigned>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleBgeUL, &ProcessorCore::_executeBranch<&ProcessorCore::_isGreaterOrEqualUnsigned>, _ImmediateFormat::BranchInt16, 0 },
+    { &ProcessorCore::_handleJ, &ProcessorCore::_executeJ, _ImmediateFormat::BranchInt26, 0 },
+    { &ProcessorCore::_handleJal, &ProcessorCore::_executeJal, _ImmediateFormat::BranchInt26, 0 },
+    { &ProcessorCore::_handleJr, &ProcessorCore::_executeJr, _ImmediateFormat::None, 0 },
+    { &ProcessorCore::_handleJalr, &ProcessorCore::_executeJalr, _ImmediateFormat::None, 0 }
+};
+
+void ProcessorCore::_decodeOperands(_DecodedInstruction & decodedInstruction)
+{
+    uint32_t instruction = decodedInstruction.instruction;
+
+    //  Register fields are at the same place in all instruction formats
+    decodedInstruction.r1 = static_cast<uint8_t>((instruction >> 21) & 0x1F);
+    decodedInstruction.r2 = static_cast<uint8_t>((instruction >> 16) & 0x1F);
+    decodedInstruction.r3 = static_cast<uint8_t>((instruction >> 11) & 0x1F);
+    decodedInstruction.imm = 0;
+
+    //  Instructions without an executor are left to their handlers
+    decodedInstruction.executor = &ProcessorCore::_executeUndecoded;
+    decodedInstruction.cycles = 0;
+    for (const _InstructionExecutor & instructionExecutor : _InstructionExecutors)
+    {
+        if (instructionExecutor.handler == decodedInstruction.handler &&
+            (instruction & instructionExecutor.reservedBits) == 0)
+        {
+            decodedInstruction.executor = instructionExecutor.executor;
+            decodedInstruction.cycles = 1;
+            switch (instructionExecutor.immediateFormat)
+            {
+                case _ImmediateFormat::None:
+                    break;
+                case _ImmediateFormat::SignedInt16:
+                    decodedInstruction.imm = Alu::signExtendInt16(instruction);
+                    break;
+                case _ImmediateFormat::UnsignedInt16:
+                    decodedInstruction.imm = Alu::zeroExtendInt16(instruction);
+                    break;
+                case _ImmediateFormat::SignedInt21:
+                    decodedInstruction.imm = Alu::signExtendInt21(instruction);
+                    break;
+                case _ImmediateFormat::BranchInt16:
+                    decodedInstruction.imm = Alu::signExtendInt16(instruction) << 2;
+                    break;
+                case _ImmediateFormat::BranchInt26:
+                    decodedInstruction.imm = Alu::signExtendInt26(instruction) << 2;
+                    break;
+                case _ImmediateFormat::RegisterMask:
+                    if (!_isValidMultipleTransferBase(decodedInstruction.r1, instruction))
+                    {   //  Left to the handler, which raises an OPERAND interrupt
+                        decodedInstruction.executor = &ProcessorCore::_executeUndecoded;
+                        decodedInstruction.cycles = 0;
+                        break;
+                    }
+                    decodedInstruction.imm = instruction & 0x001FFFFF;
+                    for (uint64_t mask = decodedInstruction.imm; mask != 0; mask &= mask - 1)
+                    {   //  1 cycle plus 1 per register transferred
+                        decodedInstruction.cycles++;
+                    }
+                    break;
+                default:
+                    Q_ASSERT(false);
+            }
+            if (_usesIpRegister(decodedInstruction, instructionExecutor.immediateFormat))
+            {   //  The threaded engine keeps $ip in a local, which executors
+                //  can neither see nor update - leave these to the handlers
+                decodedInstruction.executor = &ProcessorCore::_executeUndecoded;
+                decodedInstruction.cycles = 0;
+                decodedInstruction.imm = 0;
+            }
+            break;
+        }
+    }
+}
+
+bool ProcessorCore::_usesIpRegister(const _DecodedInstruction & decodedInstruction, _ImmediateFormat immediateFormat)
+{
+    switch (immediateFormat)
+    {
+        case _ImmediateFormat::None:
+            return decodedInstruction.r1 == _IpRegister ||
+                   decodedInstruction.r2 == _IpRegister ||
+                   decodedInstruction.r3 == _IpRegister;
+        case _ImmediateFormat::SignedInt16:
+        case _ImmediateFormat::UnsignedInt16:
+        case _ImmediateFormat::BranchInt16:
+            //  The r3 field is a part of the immediate operand
+            return decodedInstruction.r1 == _IpRegister ||
+                   decodedInstruction.r2 == _IpRegister;
+        case _ImmediateFormat::SignedInt21:
+        case _ImmediateFormat::RegisterMask:
+            return decodedInstruction.r1 == _IpRegister;
+        case _ImmediateFormat::BranchInt26:
+            return false;
+        default:
+            Q_ASSERT(false);
+            return false;
+    }
+}
+
+const unsigned ProcessorCore::_MultipleTransferRegisters[21] =
+{
+    1, 2, 3, 4, //  $a0..$a3
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, //  $s0..$s12
+    26,     //  $gp
+    28,     //  $fp
+    29,     //  $dp
+    30      //  $ra
+};
+
+bool ProcessorCore::_isValidMultipleTransferBase(unsigned r1, uint32_t registerMask)
+{
+    if (r1 == _IpRegister)
+    {   //  OOPS! Can't use $ip as a base register
+        return false;
+    }
+    for (unsigned i = 0; i < 21; i++)
+    {   //  OOPS! Can't use a transferred register as a base register
+        if ((registerMask & (UINT32_C(0x01) << i)) != 0 && _MultipleTransferRegisters[i] == r1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+const ProcessorCore::_FusedIdiom ProcessorCore::_FusedIdioms[] =
+{
+    //  Load a constant, compare with it and branch on the outcome
+    _fusedSequence<&ProcessorCore::_executeLiL, &ProcessorCore::_executeSltL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeLiL, &ProcessorCore::_executeSltUL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeLiL, &ProcessorCore::_executeSeqL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    //  Load a constant and use it
+    _fusedSequence<&ProcessorCore::_executeLiL, &ProcessorCore::_executeAddL>(),
+    _fusedSequence<&ProcessorCore::_executeLiL, &ProcessorCore::_executeSubL>(),
+    _fusedSequence<&ProcessorCore::_executeLiL, &ProcessorCore::_executeAndL>(),
+    _fusedSequence<&ProcessorCore::_executeLiL, &ProcessorCore::_executeOrL>(),
+    _fusedSequence<&ProcessorCore::_executeLiL, &ProcessorCore::_executeXorL>(),
+    //  Compare and branch on the outcome
+    _fusedSequence<&ProcessorCore::_executeSltL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSltL, &ProcessorCore::_executeBranch<&ProcessorCore::_isEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSltUL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSltUL, &ProcessorCore::_executeBranch<&ProcessorCore::_isEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSltiL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSltiL, &ProcessorCore::_executeBranch<&ProcessorCore::_isEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSeqL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSeqL, &ProcessorCore::_executeBranch<&ProcessorCore::_isEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSeqiL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSeqiL, &ProcessorCore::_executeBranch<&ProcessorCore::_isEqual>>(),
+    //  Step a counter and loop
+    _fusedSequence<&ProcessorCore::_executeAddiL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeSubiL, &ProcessorCore::_executeBranch<&ProcessorCore::_isNotEqual>>(),
+    _fusedSequence<&ProcessorCore::_executeAddiL, &ProcessorCore::_executeBranch<&ProcessorCore::_isLess>>(),
+    //  Restore registers (and return); save registers (and call)
+    _fusedRepetition<&ProcessorCore::_executeLL<ByteOrder::BigEndian>, &ProcessorCore::_executeLdm<ByteOrder::BigEndian>, &ProcessorCore::_executeJr>(),
+    _fusedRepetition<&ProcessorCore::_executeLL<ByteOrder::LittleEndian>, &ProcessorCore::_executeLdm<ByteOrder::LittleEndian>, &ProcessorCore::_executeJr>(),
+    _fusedRepetition<&ProcessorCore::_executeSL<ByteOrder::BigEndian>, &ProcessorCore::_executeStm<ByteOrder::BigEndian>, &ProcessorCore::_executeJal>(),
+    _fusedRepetition<&ProcessorCore::_executeSL<ByteOrder::LittleEndian>, &ProcessorCore::_executeStm<ByteOrder::LittleEndian>, &ProcessorCore::_executeJal>()
+};
+
+unsigned ProcessorCore::_matchFusedIdiom(const _FusedIdiom & idiom, const _DecodedInstruction * run, const _DecodedInstruction * end)
+{
+    //  Instructions that name $ip are never decoded (see _decodeOperands),
+    //  so none of the executors matched here can jump behind our back
+    unsigned length = 0;
+    if (idiom.repeated)
+    {
+        while (run + length != end &&
+               (run[length].executor == idiom.executors[0] || run[length].executor == idiom.executors[1]))
+        {
+            length++;
+        }
+        if (length > 0 && run + length != end &&
+            idiom.executors[2] != nullptr && run[length].executor == idiom.executors[2])
+        {
+            length++;
+        }
+    }
+    else
+    {
+        for (; length < _MaxFusedIdiomLength && idiom.executors[length] != nullptr; length++)
+        {
+            if (run + length == end ||
+                run[length].executor != idiom.executors[length])
+            {
+                return 0;
+            }
+        }
+    }
+    return (length >= 2) ? length : 0;
+}
+
+void ProcessorCore::_fuseInstructions(_BasicBlock * basicBlock)
+{
+    _DecodedInstruction * end = basicBlock->instructions + basicBlock->numInstructions;
+    for (_DecodedInstruction * instruction = basicBlock->instructions; instruction != end; instruction++)
+    {
+        instruction->fusedExecutor = nullptr;
+        instruction->fusedLength = 1;
+    }
+    //  The instructions a run fuses keep their own executors, for when the
+    //  run is not started (or cut short) at the end of a quantum
+    for (_DecodedInstruction * run = basicBlock->instructions; run != end; )
+    {
+        unsigned length = 0;
+        for (const _FusedIdiom & idiom : _FusedIdioms)
+        {
+            length = _matchFusedIdiom(idiom, run, end);
+            if (length != 0)
+            {
+                run->fusedExecutor = idiom.fusedExecutor;
+                run->fusedLength = length;
+                break;
+            }
+        }
+        run += (length != 0) ? length : 1;
+    }
+}
+
+//////////
+//  Implementation helpers (instruction execution)
+template <ByteOrder GuestByteOrder>
+const ProcessorCore::_InstructionHandler ProcessorCore::_PrimaryDispatchTable[64] =
+{
+    //  000...
+    &ProcessorCore::_handleLiL,                     //  ...000
+    &ProcessorCore::_handleCop1,                    //  ...001
+    &ProcessorCore::_handleAddiL,                   //  ...010
+    &ProcessorCore::_handleSubiL,                   //  ...011
+    &ProcessorCore::_handleMuliL,                   //  ...100
+    &ProcessorCore::_handleDiviL,                   //  ...101
+    &ProcessorCore::_handleModiL,                   //  ...110
+    &ProcessorCore::_handleJ,                       //  ...111
+    //  001...
+    &ProcessorCore::_handleLiD,                     //  ...000
+    &ProcessorCore::_handleLir<GuestByteOrder>,     //  ...001
+    &ProcessorCore::_handleAddiUL,                  //  ...010
+    &ProcessorCore::_handleSubiUL,                  //  ...011
+    &ProcessorCore::_handleMuliUL,                  //  ...100
+    &ProcessorCore::_handleDiviUL,                  //  ...101
+    &ProcessorCore::_handleModiUL,                  //  ...110
+    &ProcessorCore::_handleJal,                     //  ...111
+    //  010...
+    &ProcessorCore::_handleSeqiL,                   //  ...000
+    &ProcessorCore::_handleSneiL,                   //  ...001
+    &ProcessorCore::_handleSltiL,                   //  ...010
+    &ProcessorCore::_handleSleiL,                   //  ...011
+    &ProcessorCore::_handleSgtiL,                   //  ...100
+    &ProcessorCore::_handleSgeiL,                   //  ...101
+    &ProcessorCore::_handleSltiUL,                  //  ...110
+    &ProcessorCore::_handleSleiUL,                  //  ...111
+    //  011...
+    &ProcessorCore::_handleAndiL,                   //  ...000
+    &ProcessorCore::_handleOriL,                    //  ...001
+    &ProcessorCore::_handleXoriL,                   //  ...010
+    &ProcessorCore::_handleImpliL,                  //  ...011
+    &ProcessorCore::_handleLdm<GuestByteOrder>,     //  ...100
+    &ProcessorCore::_handleStm<GuestByteOrder>,     //  ...101
+    &ProcessorCore::_handleSgtiUL,                  //  ...110
+    &ProcessorCore::_handleSgeiUL,                  //  ...111
+    //  100...
+    &ProcessorCore::_handleLB,                      //  ...000
+    &ProcessorCore::_handleLUB,                     //  ...001
+    &ProcessorCore::_handleLH<GuestByteOrder>,      //  ...010
+    &ProcessorCore::_handleLUH<GuestByteOrder>,     //  ...011
+    &ProcessorCore::_handleLW<GuestByteOrder>,      //  ...100
+    &ProcessorCore::_handleLUW<GuestByteOrder>,     //  ...101
+    &ProcessorCore::_handleLL<GuestByteOrder>,      //  ...110
+    &ProcessorCore::_handleXchg<GuestByteOrder>,    //  ...111
+    //  101...
+    &ProcessorCore::_handleSB,                      //  ...000
+    &ProcessorCore::_handleSH<GuestByteOrder>,      //  ...001
+    &ProcessorCore::_handleSW<GuestByteOrder>,      //  ...010
+    &ProcessorCore::_handleSL<GuestByteOrder>,      //  ...011
+    &ProcessorCore::_handleLF<GuestByteOrder>,      //  ...100
+    &ProcessorCore::_handleLD<GuestByteOrder>,      //  ...101
+    &ProcessorCore::_handleSF<GuestByteOrder>,      //  ...110
+    &ProcessorCore::_handleSD<GuestByteOrder>,      //  ...111
+    //  110...
+    &ProcessorCore::_handleBeqL,                    //  ...000
+    &ProcessorCore::_handleBneL,                    //  ...001
+    &ProcessorCore::_handleBltL,                    //  ...010
+    &ProcessorCore::_handleBleL,                    //  ...011
+    &ProcessorCore::_handleBgtL,                    //  ...100
+    &ProcessorCore::_handleBgeL,                    //  ...101
+    &ProcessorCore::_handleBltUL,                   //  ...110
+    &ProcessorCore::_handleBleUL,                   //  ...111
+    //  111...
+    &ProcessorCore::_handleBeqD,                    //  ...000
+    &ProcessorCore::_handleBneD,                    //  ...001
+    &ProcessorCore::_handleBltD,                    //  ...010
+    &ProcessorCore::_handleBleD,                    //  ...011
+    &ProcessorCore::_handleBgtD,                    //  ...100
+    &ProcessorCore::_handleBgeD,                    //  ...101
+    &ProcessorCore::_handleBgtUL,                   //  ...110
+    &ProcessorCore::_handleBgeUL                    //  ...111
+};
+
+unsigned ProcessorCore::_fetchAndExecuteInstruction()
+{
+    //  Translate instruction address and fetch the instruction
+    uint64_t instructionAddress = _r[_IpRegister];
+    uint32_t instruction = 0;
+    if (!_fetchInstruction(instructionAddress, instruction))
+    {   //  OOPS! The fetch has failed and raised an interrupt
+        return 1;
+    }
+    _r[_IpRegister] += 4;
+
+    //  Dispatch to handler (a core that can't change byte order stays
+    //  pinned to the handlers instantiated for its initial byte order)
+    ByteOrder byteOrder = _canChangeByteOrder ? _state.getByteOrder() : _initialByteOrder;
+    _InstructionHandler handler = (byteOrder == ByteOrder::BigEndian) ?
+                                        _PrimaryDispatchTable<ByteOrder::BigEndian>[instruction >> 26] :
+                                        _PrimaryDispatchTable<ByteOrder::LittleEndian>[instruction >> 26];
     return (this->*handler)(instruction);
 }
 
-unsigned ProcessorCore::_handleBase2(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    static const _InstructionHandler DispatchTable[64] =
-    {
-        //  000...
-        &ProcessorCore::_handleMovL,                //  ...000
-        &ProcessorCore::_handleCvtBL,               //  ...001
-        &ProcessorCore::_handleCvtUBL,              //  ...010
-        &ProcessorCore::_handleCvtHL,               //  ...011
-        &ProcessorCore::_handleCvtUHL,              //  ...100
-        &ProcessorCore::_handleCvtWL,               //  ...101
-        &ProcessorCore::_handleCvtUWL,              //  ...110
-        &ProcessorCore::_handleNop,                 //  ...111
-        //  001...
-        &ProcessorCore::_handleAndB,                //  ...000
-        &ProcessorCore::_handleAndUB,               //  ...001
-        &ProcessorCore::_handleAndH,                //  ...010
-        &ProcessorCore::_handleAndUH,               //  ...011
-        &ProcessorCore::_handleAndW,                //  ...100
-        &ProcessorCore::_handleAndUW,               //  ...101
-        &ProcessorCore::_handleAndL,                //  ...110
-        &ProcessorCore::_handleSwapH,               //  ...111
-        //  010...
-        &ProcessorCore::_handleOrB,                 //  ...000
-        &ProcessorCore::_handleOrUB,                //  ...001
-        &ProcessorCore::_handleOrH,                 //  ...010
-        &ProcessorCore::_handleOrUH,                //  ...011
-        &ProcessorCore::_handleOrW,                 //  ...100
-        &ProcessorCore::_handleOrUW,                //  ...101
-        &ProcessorCore::_handleOrL,                 //  ...110
-        &ProcessorCore::_handleSwapUH,              //  ...111
-        //  011...
-        &ProcessorCore::_handleXorB,                //  ...000
-        &ProcessorCore::_handleXorUB,               //  ...001
-        &ProcessorCore::_handleXorH,                //  ...010
-        &ProcessorCore::_handleXorUH,               //  ...011
-        &ProcessorCore::_handleXorW,                //  ...100
-        &ProcessorCore::_handleXorUW,               //  ...101
-        &ProcessorCore::_handleXorL,                //  ...110
-        &ProcessorCore::_handleSwapW,               //  ...111
-        //  100...
-        &ProcessorCore::_handleNotB,                //  ...000
-        &ProcessorCore::_handleNotUB,               //  ...001
-        &ProcessorCore::_handleNotH,                //  ...010
-        &ProcessorCore::_handleNotUH,               //  ...011
-        &ProcessorCore::_handleNotW,                //  ...100
-        &ProcessorCore::_handleNotUW,               //  ...101
-        &ProcessorCore::_handleNotL,                //  ...110
-        &ProcessorCore::_handleSwapUW,              //  ...111
-        //  101...
-        &ProcessorCore::_handleBrevB,               //  ...000
-        &ProcessorCore::_handleBrevUB,              //  ...001
-        &ProcessorCore::_handleBrevH,               //  ...010
-        &ProcessorCore::_handleBrevUH,              //  ...011
-        &ProcessorCore::_handleBrevW,               //  ...100
-        &ProcessorCore::_handleBrevUW,              //  ...101
-        &ProcessorCore::_handleBrevL,               //  ...110
-        &ProcessorCore::_handleSwapL,               //  ...111
-        //  110...
-        &ProcessorCore::_handleSeqL,                //  ...000
-        &ProcessorCore::_handleSneL,                //  ...001
-        &ProcessorCore::_handleSltL,                //  ...010
-        &ProcessorCore::_handleSleL,                //  ...011
-        &ProcessorCore::_handleSgtL,                //  ...100
-        &ProcessorCore::_handleSgeL,                //  ...101
-        &ProcessorCore::_handleClz,                 //  ...110
-        &ProcessorCore::_handleCtz,                 //  ...111
-        //  111...
-        &ProcessorCore::_handleJr,                  //  ...000
-        &ProcessorCore::_handleJalr,                //  ...001
-        &ProcessorCore::_handleSltUL,               //  ...010
-        &ProcessorCore::_handleSleUL,               //  ...011
-        &ProcessorCore::_handleSgtUL,               //  ...100
-        &ProcessorCore::_handleSgeUL,               //  ...101
-        &ProcessorCore::_handleClo,                 //  ...110
-        &ProcessorCore::_handleCto                  //  ...111
-    };
+unsigned ProcessorCore::_handleInvalidInstruction(uint32_t /*instruction*/)
+{
+    _raiseProgramInterrupt(ProgramInterrupt::OPCODE);
+    return 1;
+}
 
-    _InstructionHandler handler = DispatchTable[instruction & 0x3F];
+const ProcessorCore::_InstructionHandler ProcessorCore::_Cop1DispatchTable[32] =
+{
+    //  00...
+    &ProcessorCore::_handleShift1,              //  ..000
+    &ProcessorCore::_handleShift2,              //  ..001
+    &ProcessorCore::_handleBfiL,                //  ..010
+    &ProcessorCore::_handleBfiL,                //  ..011
+    &ProcessorCore::_handleBfeL,                //  ..100
+    &ProcessorCore::_handleBfeL,                //  ..101
+    &ProcessorCore::_handleBfeUL,               //  ..110
+    &ProcessorCore::_handleBfeUL,               //  ..111
+    //  01...
+    &ProcessorCore::_handleBase1,               //  ..000
+    &ProcessorCore::_handleBase2,               //  ..001
+    &ProcessorCore::_handleBase3,               //  ..010
+    &ProcessorCore::_handleBase4,               //  ..011
+    &ProcessorCore::_handleBase5,               //  ..100
+    &ProcessorCore::_handleInvalidInstruction,  //  ..101
+    &ProcessorCore::_handleInvalidInstruction,  //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+    //  10...
+    &ProcessorCore::_handleFp1,                 //  ..000
+    &ProcessorCore::_handleInvalidInstruction,  //  ..001
+    &ProcessorCore::_handleInvalidInstruction,  //  ..010
+    &ProcessorCore::_handleInvalidInstruction,  //  ..011
+    &ProcessorCore::_handleInvalidInstruction,  //  ..100
+    &ProcessorCore::_handleInvalidInstruction,  //  ..101
+    &ProcessorCore::_handleInvalidInstruction,  //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+    //  11...
+    &ProcessorCore::_handleInvalidInstruction,  //  ..000
+    &ProcessorCore::_handleInvalidInstruction,  //  ..001
+    &ProcessorCore::_handleInvalidInstruction,  //  ..010
+    &ProcessorCore::_handleInvalidInstruction,  //  ..011
+    &ProcessorCore::_handleInvalidInstruction,  //  ..100
+    &ProcessorCore::_handleInvalidInstruction,  //  ..101
+    &ProcessorCore::_handleInvalidInstruction,  //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+};
+
+unsigned ProcessorCore::_handleCop1(uint32_t instruction)
+{
+    _InstructionHandler handler = _Cop1DispatchTable[(instruction >> 6) & 0x1F];
     return (this->*handler)(instruction);
 }
 
-unsigned ProcessorCore::_handleBase3(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    static const _InstructionHandler DispatchTable[64] =
-    {
-        //  000...
-        &ProcessorCore::_handleAddB,                //  ...000
-        &ProcessorCore::_handleSubB,                //  ...001
-        &ProcessorCore::_handleMulB,                //  ...010
-        &ProcessorCore::_handleDivB,                //  ...011
-        &ProcessorCore::_handleModB,                //  ...100
-        &ProcessorCore::_handleAbsB,                //  ...101
-        &ProcessorCore::_handleNegB,                //  ...110
-        &ProcessorCore::_handleImplB,               //  ...111
-        //  001...
-        &ProcessorCore::_handleAddUB,               //  ...000
-        &ProcessorCore::_handleSubUB,               //  ...001
-        &ProcessorCore::_handleMulUB,               //  ...010
-        &ProcessorCore::_handleDivUB,               //  ...011
-        &ProcessorCore::_handleModUB,               //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleCpl2UB,              //  ...110
-        &ProcessorCore::_handleImplUB,              //  ...111
-        //  010...
-        &ProcessorCore::_handleAddH,                //  ...000
-        &ProcessorCore::_handleSubH,                //  ...001
-        &ProcessorCore::_handleMulH,                //  ...010
-        &ProcessorCore::_handleDivH,                //  ...011
-        &ProcessorCore::_handleModH,                //  ...100
-        &ProcessorCore::_handleAbsH,                //  ...101
-        &ProcessorCore::_handleNegH,                //  ...110
-        &ProcessorCore::_handleImplH,               //  ...111
-        //  011...
-        &ProcessorCore::_handleAddUH,               //  ...000
-        &ProcessorCore::_handleSubUH,               //  ...001
-        &ProcessorCore::_handleMulUH,               //  ...010
-        &ProcessorCore::_handleDivUH,               //  ...011
-        &ProcessorCore::_handleModUH,               //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleCpl2UH,              //  ...110
-        &ProcessorCore::_handleImplUH,              //  ...111
-        //  100...
-        &ProcessorCore::_handleAddW,                //  ...000
-        &ProcessorCore::_handleSubW,                //  ...001
-        &ProcessorCore::_handleMulW,                //  ...010
-        &ProcessorCore::_handleDivW,                //  ...011
-        &ProcessorCore::_handleModW,                //  ...100
-        &ProcessorCore::_handleAbsW,                //  ...101
-        &ProcessorCore::_handleNegW,                //  ...110
-        &ProcessorCore::_handleImplW,               //  ...111
-        //  101...
-        &ProcessorCore::_handleAddUW,               //  ...000
-        &ProcessorCore::_handleSubUW,               //  ...001
-        &ProcessorCore::_handleMulUW,               //  ...010
-        &ProcessorCore::_handleDivUW,               //  ...011
-        &ProcessorCore::_handleModUW,               //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleCpl2UW,              //  ...110
-        &ProcessorCore::_handleImplUW,              //  ...111
-        //  110...
-        &ProcessorCore::_handleAddL,                //  ...000
-        &ProcessorCore::_handleSubL,                //  ...001
-        &ProcessorCore::_handleMulL,                //  ...010
-        &ProcessorCore::_handleDivL,                //  ...011
-        &ProcessorCore::_handleModL,                //  ...100
-        &ProcessorCore::_handleAbsL,                //  ...101
-        &ProcessorCore::_handleNegL,                //  ...110
-        &ProcessorCore::_handleImplL,               //  ...111
-        //  111...
-        &ProcessorCore::_handleAddUL,               //  ...000
-        &ProcessorCore::_handleSubUL,               //  ...001
-        &ProcessorCore::_handleMulUL,               //  ...010
-        &ProcessorCore::_handleDivUL,               //  ...011
-        &ProcessorCore::_handleModUL,               //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleCpl2UL,              //  ...110
-        &ProcessorCore::_handleInvalidInstruction   //  ...111
-    };
+const ProcessorCore::_InstructionHandler ProcessorCore::_Shift1DispatchTable[32] =
+{
+    //  00...
+    &ProcessorCore::_handleShliB,               //  ..000
+    &ProcessorCore::_handleShliUB,              //  ..001
+    &ProcessorCore::_handleShliH,               //  ..010
+    &ProcessorCore::_handleShliUH,              //  ..011
+    &ProcessorCore::_handleShliW,               //  ..100
+    &ProcessorCore::_handleShliUW,              //  ..101
+    &ProcessorCore::_handleShliL,               //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+    //  01...
+    &ProcessorCore::_handleShriB,               //  ..000
+    &ProcessorCore::_handleShriUB,              //  ..001
+    &ProcessorCore::_handleShriH,               //  ..010
+    &ProcessorCore::_handleShriUH,              //  ..011
+    &ProcessorCore::_handleShriW,               //  ..100
+    &ProcessorCore::_handleShriUW,              //  ..101
+    &ProcessorCore::_handleShriL,               //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+    //  10...
+    &ProcessorCore::_handleAsliB,               //  ..000
+    &ProcessorCore::_handleAsliUB,              //  ..001
+    &ProcessorCore::_handleAsliH,               //  ..010
+    &ProcessorCore::_handleAsliUH,              //  ..011
+    &ProcessorCore::_handleAsliW,               //  ..100
+    &ProcessorCore::_handleAsliUW,              //  ..101
+    &ProcessorCore::_handleAsliL,               //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+    //  11...
+    &ProcessorCore::_handleAsriB,               //  ..000
+    &ProcessorCore::_handleAsriUB,              //  ..001
+    &ProcessorCore::_handleAsriH,               //  ..010
+    &ProcessorCore::_handleAsriUH,              //  ..011
+    &ProcessorCore::_handleAsriW,               //  ..100
+    &ProcessorCore::_handleAsriUW,              //  ..101
+    &ProcessorCore::_handleAsriL,               //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+};
+
+unsigned ProcessorCore::_handleShift1(uint32_t instruction)
+{
+    _InstructionHandler handler = _Shift1DispatchTable[(instruction >> 11) & 0x1F];
+    return (this->*handler)(instruction);
+}
 
-    _InstructionHandler handler = DispatchTable[instruction & 0x3F];
+const ProcessorCore::_InstructionHandler ProcessorCore::_Shift2DispatchTable[32] =
+{
+    //  00...
+    &ProcessorCore::_handleRoliB,               //  ..000
+    &ProcessorCore::_handleRoliUB,              //  ..001
+    &ProcessorCore::_handleRoliH,               //  ..010
+    &ProcessorCore::_handleRoliUH,              //  ..011
+    &ProcessorCore::_handleRoliW,               //  ..100
+    &ProcessorCore::_handleRoliUW,              //  ..101
+    &ProcessorCore::_handleRoliL,               //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+    //  01...
+    &ProcessorCore::_handleRoriB,               //  ..000
+    &ProcessorCore::_handleRoriUB,              //  ..001
+    &ProcessorCore::_handleRoriH,               //  ..010
+    &ProcessorCore::_handleRoriUH,              //  ..011
+    &ProcessorCore::_handleRoriW,               //  ..100
+    &ProcessorCore::_handleRoriUW,              //  ..101
+    &ProcessorCore::_handleRoriL,               //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+    //  10...
+    &ProcessorCore::_handleBeqiL,               //  ..000
+    &ProcessorCore::_handleBneiL,               //  ..001
+    &ProcessorCore::_handleBltiL,               //  ..010
+    &ProcessorCore::_handleBleiL,               //  ..011
+    &ProcessorCore::_handleBgtiL,               //  ..100
+    &ProcessorCore::_handleBgeiL,               //  ..101
+    &ProcessorCore::_handleInvalidInstruction,  //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+    //  11...
+    &ProcessorCore::_handleInvalidInstruction,  //  ..000
+    &ProcessorCore::_handleInvalidInstruction,  //  ..001
+    &ProcessorCore::_handleBltiUL,              //  ..010
+    &ProcessorCore::_handleBleiUL,              //  ..011
+    &ProcessorCore::_handleBgtiUL,              //  ..100
+    &ProcessorCore::_handleBgeiUL,              //  ..101
+    &ProcessorCore::_handleInvalidInstruction,  //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+};
+
+unsigned ProcessorCore::_handleShift2(uint32_t instruction)
+{
+    _InstructionHandler handler = _Shift2DispatchTable[(instruction >> 11) & 0x1F];
     return (this->*handler)(instruction);
 }
 
-unsigned ProcessorCore::_handleBase4(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    static const _InstructionHandler DispatchTable[32] =
-    {
-        //  00...
-        &ProcessorCore::_handleAddiB,               //  ..000
-        &ProcessorCore::_handleAddiUB,              //  ..001
-        &ProcessorCore::_handleAddiH,               //  ..010
-        &ProcessorCore::_handleAddiUH,              //  ..011
-        &ProcessorCore::_handleAddiW,               //  ..100
-        &ProcessorCore::_handleAddiUW,              //  ..101
-        &ProcessorCore::_handleModiB,               //  ..110
-        &ProcessorCore::_handleModiUB,              //  ..111
-        //  01...
-        &ProcessorCore::_handleSubiB,               //  ..000
-        &ProcessorCore::_handleSubiUB,              //  ..001
-        &ProcessorCore::_handleSubiH,               //  ..010
-        &ProcessorCore::_handleSubiUH,              //  ..011
-        &ProcessorCore::_handleSubiW,               //  ..100
-        &ProcessorCore::_handleSubiUW,              //  ..101
-        &ProcessorCore::_handleModiH,               //  ..110
-        &ProcessorCore::_handleModiUH,              //  ..111
-        //  10...
-        &ProcessorCore::_handleMuliB,               //  ..000
-        &ProcessorCore::_handleMuliUB,              //  ..001
-        &ProcessorCore::_handleMuliH,               //  ..010
-        &ProcessorCore::_handleMuliUH,              //  ..011
-        &ProcessorCore::_handleMuliW,               //  ..100
-        &ProcessorCore::_handleMuliUW,              //  ..101
-        &ProcessorCore::_handleModiW,               //  ..110
-        &ProcessorCore::_handleModiUW,              //  ..111
-        //  11...
-        &ProcessorCore::_handleDiviB,               //  ..000
-        &ProcessorCore::_handleDiviUB,              //  ..001
-        &ProcessorCore::_handleDiviH,               //  ..010
-        &ProcessorCore::_handleDiviUH,              //  ..011
-        &ProcessorCore::_handleDiviW,               //  ..100
-        &ProcessorCore::_handleDiviUW,              //  ..101
-        &ProcessorCore::_handleInvalidInstruction,  //  ..110
-        &ProcessorCore::_handleInvalidInstruction,  //  ..111
-    };
+const ProcessorCore::_InstructionHandler ProcessorCore::_Base1DispatchTable[64] =
+{
+    //  000...
+    &ProcessorCore::_handleMovCR,               //  ...000
+    &ProcessorCore::_handleMovRC,               //  ...001
+    &ProcessorCore::_handleInvalidInstruction,  //  ...010
+    &ProcessorCore::_handleInvalidInstruction,  //  ...011
+    &ProcessorCore::_handleMovMR,               //  ...100
+    &ProcessorCore::_handleMovRM,               //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  001...
+    &ProcessorCore::_handleInvalidInstruction,  //  ...000
+    &ProcessorCore::_handleInvalidInstruction,  //  ...001
+    &ProcessorCore::_handleInvalidInstruction,  //  ...010
+    &ProcessorCore::_handleInvalidInstruction,  //  ...011
+    &ProcessorCore::_handleInvalidInstruction,  //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  010...
+    &ProcessorCore::_handleInvalidInstruction,  //  ...000
+    &ProcessorCore::_handleInvalidInstruction,  //  ...001
+    &ProcessorCore::_handleInvalidInstruction,  //  ...010
+    &ProcessorCore::_handleInvalidInstruction,  //  ...011
+    &ProcessorCore::_handleInvalidInstruction,  //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  011...
+    &ProcessorCore::_handleIret,                //  ...000
+    &ProcessorCore::_handleHalt,                //  ...001
+    &ProcessorCore::_handleCpuid,               //  ...010
+    &ProcessorCore::_handleSigp,                //  ...011
+    &ProcessorCore::_handleInvalidInstruction,  //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  100...
+    &ProcessorCore::_handleTstp,                //  ...000
+    &ProcessorCore::_handleSetp,                //  ...001
+    &ProcessorCore::_handleInvalidInstruction,  //  ...010
+    &ProcessorCore::_handleInvalidInstruction,  //  ...011
+    &ProcessorCore::_handleInvalidInstruction,  //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  101...
+    &ProcessorCore::_handleInB,                 //  ...000
+    &ProcessorCore::_handleInH,                 //  ...001
+    &ProcessorCore::_handleInW,                 //  ...010
+    &ProcessorCore::_handleInL,                 //  ...011
+    &ProcessorCore::_handleOutB,                //  ...100
+    &ProcessorCore::_handleOutH,                //  ...101
+    &ProcessorCore::_handleOutB,                //  ...110
+    &ProcessorCore::_handleOutL,                //  ...111
+    //  110...
+    &ProcessorCore::_handleInUB,                //  ...000
+    &ProcessorCore::_handleInUH,                //  ...001
+    &ProcessorCore::_handleInUW,                //  ...010
+    &ProcessorCore::_handleInvalidInstruction,  //  ...011
+    &ProcessorCore::_handleInvalidInstruction,  //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  111...
+    &ProcessorCore::_handleInvalidInstruction,  //  ...000
+    &ProcessorCore::_handleInvalidInstruction,  //  ...001
+    &ProcessorCore::_handleInvalidInstruction,  //  ...010
+    &ProcessorCore::_handleInvalidInstruction,  //  ...011
+    &ProcessorCore::_handleInvalidInstruction,  //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction   //  ...111
+};
+
+unsigned ProcessorCore::_handleBase1(uint32_t instruction)
+{
+    _InstructionHandler handler = _Base1DispatchTable[instruction & 0x3F];
+    return (this->*handler)(instruction);
+}
 
-    _InstructionHandler handler = DispatchTable[(instruction >> 11) & 0x1F];
+const ProcessorCore::_InstructionHandler ProcessorCore::_Base2DispatchTable[64] =
+{
+    //  000...
+    &ProcessorCore::_handleMovL,                //  ...000
+    &ProcessorCore::_handleCvtBL,               //  ...001
+    &ProcessorCore::_handleCvtUBL,              //  ...010
+    &ProcessorCore::_handleCvtHL,               //  ...011
+    &ProcessorCore::_handleCvtUHL,              //  ...100
+    &ProcessorCore::_handleCvtWL,               //  ...101
+    &ProcessorCore::_handleCvtUWL,              //  ...110
+    &ProcessorCore::_handleNop,                 //  ...111
+    //  001...
+    &ProcessorCore::_handleAndB,                //  ...000
+    &ProcessorCore::_handleAndUB,               //  ...001
+    &ProcessorCore::_handleAndH,                //  ...010
+    &ProcessorCore::_handleAndUH,               //  ...011
+    &ProcessorCore::_handleAndW,                //  ...100
+    &ProcessorCore::_handleAndUW,               //  ...101
+    &ProcessorCore::_handleAndL,                //  ...110
+    &ProcessorCore::_handleSwapH,               //  ...111
+    //  010...
+    &ProcessorCore::_handleOrB,                 //  ...000
+    &ProcessorCore::_handleOrUB,                //  ...001
+    &ProcessorCore::_handleOrH,                 //  ...010
+    &ProcessorCore::_handleOrUH,                //  ...011
+    &ProcessorCore::_handleOrW,                 //  ...100
+    &ProcessorCore::_handleOrUW,                //  ...101
+    &ProcessorCore::_handleOrL,                 //  ...110
+    &ProcessorCore::_handleSwapUH,              //  ...111
+    //  011...
+    &ProcessorCore::_handleXorB,                //  ...000
+    &ProcessorCore::_handleXorUB,               //  ...001
+    &ProcessorCore::_handleXorH,                //  ...010
+    &ProcessorCore::_handleXorUH,               //  ...011
+    &ProcessorCore::_handleXorW,                //  ...100
+    &ProcessorCore::_handleXorUW,               //  ...101
+    &ProcessorCore::_handleXorL,                //  ...110
+    &ProcessorCore::_handleSwapW,               //  ...111
+    //  100...
+    &ProcessorCore::_handleNotB,                //  ...000
+    &ProcessorCore::_handleNotUB,               //  ...001
+    &ProcessorCore::_handleNotH,                //  ...010
+    &ProcessorCore::_handleNotUH,               //  ...011
+    &ProcessorCore::_handleNotW,                //  ...100
+    &ProcessorCore::_handleNotUW,               //  ...101
+    &ProcessorCore::_handleNotL,                //  ...110
+    &ProcessorCore::_handleSwapUW,              //  ...111
+    //  101...
+    &ProcessorCore::_handleBrevB,               //  ...000
+    &ProcessorCore::_handleBrevUB,              //  ...001
+    &ProcessorCore::_handleBrevH,               //  ...010
+    &ProcessorCore::_handleBrevUH,              //  ...011
+    &ProcessorCore::_handleBrevW,               //  ...100
+    &ProcessorCore::_handleBrevUW,              //  ...101
+    &ProcessorCore::_handleBrevL,               //  ...110
+    &ProcessorCore::_handleSwapL,               //  ...111
+    //  110...
+    &ProcessorCore::_handleSeqL,                //  ...000
+    &ProcessorCore::_handleSneL,                //  ...001
+    &ProcessorCore::_handleSltL,                //  ...010
+    &ProcessorCore::_handleSleL,                //  ...011
+    &ProcessorCore::_handleSgtL,                //  ...100
+    &ProcessorCore::_handleSgeL,                //  ...101
+    &ProcessorCore::_handleClz,                 //  ...110
+    &ProcessorCore::_handleCtz,                 //  ...111
+    //  111...
+    &ProcessorCore::_handleJr,                  //  ...000
+    &ProcessorCore::_handleJalr,                //  ...001
+    &ProcessorCore::_handleSltUL,               //  ...010
+    &ProcessorCore::_handleSleUL,               //  ...011
+    &ProcessorCore::_handleSgtUL,               //  ...100
+    &ProcessorCore::_handleSgeUL,               //  ...101
+    &ProcessorCore::_handleClo,                 //  ...110
+    &ProcessorCore::_handleCto                  //  ...111
+};
+
+unsigned ProcessorCore::_handleBase2(uint32_t instruction)
+{
+    _InstructionHandler handler = _Base2DispatchTable[instruction & 0x3F];
     return (this->*handler)(instruction);
 }
 
-unsigned ProcessorCore::_handleBase5(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    static const _InstructionHandler DispatchTable[64] =
-    {
-        //  000...
-        &ProcessorCore::_handleShlB,                //  ...000
-        &ProcessorCore::_handleShrB,                //  ...001
-        &ProcessorCore::_handleAslB,                //  ...010
-        &ProcessorCore::_handleAsrB,                //  ...011
-        &ProcessorCore::_handleRolB,                //  ...100
-        &ProcessorCore::_handleRorB,                //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  001...
-        &ProcessorCore::_handleShlH,                //  ...000
-        &ProcessorCore::_handleShrH,                //  ...001
-        &ProcessorCore::_handleAslH,                //  ...010
-        &ProcessorCore::_handleAsrH,                //  ...011
-        &ProcessorCore::_handleRolH,                //  ...100
-        &ProcessorCore::_handleRorH,                //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  010...
-        &ProcessorCore::_handleShlW,                //  ...000
-        &ProcessorCore::_handleShrW,                //  ...001
-        &ProcessorCore::_handleAslW,                //  ...010
-        &ProcessorCore::_handleAsrW,                //  ...011
-        &ProcessorCore::_handleRolW,                //  ...100
-        &ProcessorCore::_handleRorW,                //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  011...
-        &ProcessorCore::_handleShlUB,               //  ...000
-        &ProcessorCore::_handleShrUB,               //  ...001
-        &ProcessorCore::_handleAslUB,               //  ...010
-        &ProcessorCore::_handleAsrUB,               //  ...011
-        &ProcessorCore::_handleRolUB,               //  ...100
-        &ProcessorCore::_handleRorUB,               //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  100...
-        &ProcessorCore::_handleShlUH,               //  ...000
-        &ProcessorCore::_handleShrUH,               //  ...001
-        &ProcessorCore::_handleAslUH,               //  ...010
-        &ProcessorCore::_handleAsrUH,               //  ...011
-        &ProcessorCore::_handleRolUH,               //  ...100
-        &ProcessorCore::_handleRorUH,               //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  101...
-        &ProcessorCore::_handleShlUW,               //  ...000
-        &ProcessorCore::_handleShrUW,               //  ...001
-        &ProcessorCore::_handleAslUW,               //  ...010
-        &ProcessorCore::_handleAsrUW,               //  ...011
-        &ProcessorCore::_handleRolUW,               //  ...100
-        &ProcessorCore::_handleRorUW,               //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  110...
-        &ProcessorCore::_handleShlL,                //  ...000
-        &ProcessorCore::_handleShrL,                //  ...001
-        &ProcessorCore::_handleAslL,                //  ...010
-        &ProcessorCore::_handleAsrL,                //  ...011
-        &ProcessorCore::_handleRolL,                //  ...100
-        &ProcessorCore::_handleRorL,                //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  111...
-        &ProcessorCore::_handleGetfl,               //  ...000
-        &ProcessorCore::_handleSetfl,               //  ...001
-        &ProcessorCore::_handleRstfl,               //  ...010
-        &ProcessorCore::_handleInvalidInstruction,  //  ...011
-        &ProcessorCore::_handleInvalidInstruction,  //  ...100
-        &ProcessorCore::_handleSvc,                 //  ...101
-        &ProcessorCore::_handleBrk,                 //  ...110
-        &ProcessorCore::_handleInvalidInstruction   //  ...111
-    };
+const ProcessorCore::_InstructionHandler ProcessorCore::_Base3DispatchTable[64] =
+{
+    //  000...
+    &ProcessorCore::_handleAddB,                //  ...000
+    &ProcessorCore::_handleSubB,                //  ...001
+    &ProcessorCore::_handleMulB,                //  ...010
+    &ProcessorCore::_handleDivB,                //  ...011
+    &ProcessorCore::_handleModB,                //  ...100
+    &ProcessorCore::_handleAbsB,                //  ...101
+    &ProcessorCore::_handleNegB,                //  ...110
+    &ProcessorCore::_handleImplB,               //  ...111
+    //  001...
+    &ProcessorCore::_handleAddUB,               //  ...000
+    &ProcessorCore::_handleSubUB,               //  ...001
+    &ProcessorCore::_handleMulUB,               //  ...010
+    &ProcessorCore::_handleDivUB,               //  ...011
+    &ProcessorCore::_handleModUB,               //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleCpl2UB,              //  ...110
+    &ProcessorCore::_handleImplUB,              //  ...111
+    //  010...
+    &ProcessorCore::_handleAddH,                //  ...000
+    &ProcessorCore::_handleSubH,                //  ...001
+    &ProcessorCore::_handleMulH,                //  ...010
+    &ProcessorCore::_handleDivH,                //  ...011
+    &ProcessorCore::_handleModH,                //  ...100
+    &ProcessorCore::_handleAbsH,                //  ...101
+    &ProcessorCore::_handleNegH,                //  ...110
+    &ProcessorCore::_handleImplH,               //  ...111
+    //  011...
+    &ProcessorCore::_handleAddUH,               //  ...000
+    &ProcessorCore::_handleSubUH,               //  ...001
+    &ProcessorCore::_handleMulUH,               //  ...010
+    &ProcessorCore::_handleDivUH,               //  ...011
+    &ProcessorCore::_handleModUH,               //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleCpl2UH,              //  ...110
+    &ProcessorCore::_handleImplUH,              //  ...111
+    //  100...
+    &ProcessorCore::_handleAddW,                //  ...000
+    &ProcessorCore::_handleSubW,                //  ...001
+    &ProcessorCore::_handleMulW,                //  ...010
+    &ProcessorCore::_handleDivW,                //  ...011
+    &ProcessorCore::_handleModW,                //  ...100
+    &ProcessorCore::_handleAbsW,                //  ...101
+    &ProcessorCore::_handleNegW,                //  ...110
+    &ProcessorCore::_handleImplW,               //  ...111
+    //  101...
+    &ProcessorCore::_handleAddUW,               //  ...000
+    &ProcessorCore::_handleSubUW,               //  ...001
+    &ProcessorCore::_handleMulUW,               //  ...010
+    &ProcessorCore::_handleDivUW,               //  ...011
+    &ProcessorCore::_handleModUW,               //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleCpl2UW,              //  ...110
+    &ProcessorCore::_handleImplUW,              //  ...111
+    //  110...
+    &ProcessorCore::_handleAddL,                //  ...000
+    &ProcessorCore::_handleSubL,                //  ...001
+    &ProcessorCore::_handleMulL,                //  ...010
+    &ProcessorCore::_handleDivL,                //  ...011
+    &ProcessorCore::_handleModL,                //  ...100
+    &ProcessorCore::_handleAbsL,                //  ...101
+    &ProcessorCore::_handleNegL,                //  ...110
+    &ProcessorCore::_handleImplL,               //  ...111
+    //  111...
+    &ProcessorCore::_handleAddUL,               //  ...000
+    &ProcessorCore::_handleSubUL,               //  ...001
+    &ProcessorCore::_handleMulUL,               //  ...010
+    &ProcessorCore::_handleDivUL,               //  ...011
+    &ProcessorCore::_handleModUL,               //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleCpl2UL,              //  ...110
+    &ProcessorCore::_handleInvalidInstruction   //  ...111
+};
+
+unsigned ProcessorCore::_handleBase3(uint32_t instruction)
+{
+    _InstructionHandler handler = _Base3DispatchTable[instruction & 0x3F];
+    return (this->*handler)(instruction);
+}
 
-    _InstructionHandler handler = DispatchTable[instruction & 0x3F];
+const ProcessorCore::_InstructionHandler ProcessorCore::_Base4DispatchTable[32] =
+{
+    //  00...
+    &ProcessorCore::_handleAddiB,               //  ..000
+    &ProcessorCore::_handleAddiUB,              //  ..001
+    &ProcessorCore::_handleAddiH,               //  ..010
+    &ProcessorCore::_handleAddiUH,              //  ..011
+    &ProcessorCore::_handleAddiW,               //  ..100
+    &ProcessorCore::_handleAddiUW,              //  ..101
+    &ProcessorCore::_handleModiB,               //  ..110
+    &ProcessorCore::_handleModiUB,              //  ..111
+    //  01...
+    &ProcessorCore::_handleSubiB,               //  ..000
+    &ProcessorCore::_handleSubiUB,              //  ..001
+    &ProcessorCore::_handleSubiH,               //  ..010
+    &ProcessorCore::_handleSubiUH,              //  ..011
+    &ProcessorCore::_handleSubiW,               //  ..100
+    &ProcessorCore::_handleSubiUW,              //  ..101
+    &ProcessorCore::_handleModiH,               //  ..110
+    &ProcessorCore::_handleModiUH,              //  ..111
+    //  10...
+    &ProcessorCore::_handleMuliB,               //  ..000
+    &ProcessorCore::_handleMuliUB,              //  ..001
+    &ProcessorCore::_handleMuliH,               //  ..010
+    &ProcessorCore::_handleMuliUH,              //  ..011
+    &ProcessorCore::_handleMuliW,               //  ..100
+    &ProcessorCore::_handleMuliUW,              //  ..101
+    &ProcessorCore::_handleModiW,               //  ..110
+    &ProcessorCore::_handleModiUW,              //  ..111
+    //  11...
+    &ProcessorCore::_handleDiviB,               //  ..000
+    &ProcessorCore::_handleDiviUB,              //  ..001
+    &ProcessorCore::_handleDiviH,               //  ..010
+    &ProcessorCore::_handleDiviUH,              //  ..011
+    &ProcessorCore::_handleDiviW,               //  ..100
+    &ProcessorCore::_handleDiviUW,              //  ..101
+    &ProcessorCore::_handleInvalidInstruction,  //  ..110
+    &ProcessorCore::_handleInvalidInstruction,  //  ..111
+};
+
+unsigned ProcessorCore::_handleBase4(uint32_t instruction)
+{
+    _InstructionHandler handler = _Base4DispatchTable[(instruction >> 11) & 0x1F];
     return (this->*handler)(instruction);
 }
 
-unsigned ProcessorCore::_handleFp1(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt)
-{
-    static const _InstructionHandler DispatchTable[64] =
-    {
-        //  000...
-        &ProcessorCore::_handleMovD,                //  ...000
-        &ProcessorCore::_handleCvtDF,               //  ...001
-        &ProcessorCore::_handleInvalidInstruction,  //  ...010
-        &ProcessorCore::_handleInvalidInstruction,  //  ...011
-        &ProcessorCore::_handleInvalidInstruction,  //  ...100
-        &ProcessorCore::_handleInvalidInstruction,  //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  001...
-        &ProcessorCore::_handleAddD,                //  ...000
-        &ProcessorCore::_handleSubD,                //  ...001
-        &ProcessorCore::_handleMulD,                //  ...010
-        &ProcessorCore::_handleDivD,                //  ...011
-        &ProcessorCore::_handleAbsD,                //  ...100
-        &ProcessorCore::_handleNegD,                //  ...101
-        &ProcessorCore::_handleSqrtD,               //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  010...
-        & ProcessorCore::_handleAddF,               //  ...000
-        & ProcessorCore::_handleSubF,               //  ...001
-        & ProcessorCore::_handleMulF,               //  ...010
-        & ProcessorCore::_handleDivF,               //  ...011
-        & ProcessorCore::_handleAbsF,               //  ...100
-        & ProcessorCore::_handleNegF,               //  ...101
-        & ProcessorCore::_handleSqrtF,              //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  011...
-        &ProcessorCore::_handleSeqD,                //  ...000
-        &ProcessorCore::_handleSneD,                //  ...001
-        &ProcessorCore::_handleSltD,                //  ...010
-        &ProcessorCore::_handleSleD,                //  ...011
-        &ProcessorCore::_handleSgtD,                //  ...100
-        &ProcessorCore::_handleSgeD,                //  ...101
-        &ProcessorCore::_handleInvalidInstruction,  //  ...110
-        &ProcessorCore::_handleInvalidInstruction,  //  ...111
-        //  100...
-        &ProcessorCore::_handleCvtFB,               //  ...000
-        &ProcessorCore::_handleCvtFH,               //  ...001
-        &ProcessorCore::_handleCvtFW,               //  ...010
-        &ProcessorCore::_handleCvtFL,               //  ...011
-        &ProcessorCore::_handleCvtFUB,              //  ...100
-        &ProcessorCore::_handleCvtFUH,              //  ...101
-        &ProcessorCore::_handleCvtFUW,              //  ...110
-        &ProcessorCore::_handleCvtFUL,              //  ...111
-        //  101...
-        &ProcessorCore::_handleCvtBF,               //  ...000
-        &ProcessorCore::_handleCvtHF,               //  ...001
-        &ProcessorCore::_handleCvtWF,               //  ...010
-        &ProcessorCore::_handleCvtLF,               //  ...011
-        &ProcessorCore::_handleCvtUBF,              //  ...100
-        &ProcessorCore::_handleCvtUHF,              //  ...101
-        &ProcessorCore::_handleCvtUWF,              //  ...110
-        &ProcessorCore::_handleCvtULF,              //  ...111
-        //  110...
-        & ProcessorCore::_handleCvtDB,               //  ...000
-        & ProcessorCore::_handleCvtDH,               //  ...001
-        & ProcessorCore::_handleCvtDW,               //  ...010
-        & ProcessorCore::_handleCvtDL,               //  ...011
-        & ProcessorCore::_handleCvtDUB,              //  ...100
-        & ProcessorCore::_handleCvtDUH,              //  ...101
-        & ProcessorCore::_handleCvtDUW,              //  ...110
-        & ProcessorCore::_handleCvtDUL,              //  ...111
-        //  111...
-        & ProcessorCore::_handleCvtBD,               //  ...000
-        & ProcessorCore::_handleCvtHD,               //  ...001
-        & ProcessorCore::_handleCvtWD,               //  ...010
-        & ProcessorCore::_handleCvtLD,               //  ...011
-        & ProcessorCore::_handleCvtUBD,              //  ...100
-        & ProcessorCore::_handleCvtUHD,              //  ...101
-        & ProcessorCore::_handleCvtUWD,              //  ...110
-        & ProcessorCore::_handleCvtULD               //  ...111
-    };
+const ProcessorCore::_InstructionHandler ProcessorCore::_Base5DispatchTable[64] =
+{
+    //  000...
+    &ProcessorCore::_handleShlB,                //  ...000
+    &ProcessorCore::_handleShrB,                //  ...001
+    &ProcessorCore::_handleAslB,                //  ...010
+    &ProcessorCore::_handleAsrB,                //  ...011
+    &ProcessorCore::_handleRolB,                //  ...100
+    &ProcessorCore::_handleRorB,                //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  001...
+    &ProcessorCore::_handleShlH,                //  ...000
+    &ProcessorCore::_handleShrH,                //  ...001
+    &ProcessorCore::_handleAslH,                //  ...010
+    &ProcessorCore::_handleAsrH,                //  ...011
+    &ProcessorCore::_handleRolH,                //  ...100
+    &ProcessorCore::_handleRorH,                //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  010...
+    &ProcessorCore::_handleShlW,                //  ...000
+    &ProcessorCore::_handleShrW,                //  ...001
+    &ProcessorCore::_handleAslW,                //  ...010
+    &ProcessorCore::_handleAsrW,                //  ...011
+    &ProcessorCore::_handleRolW,                //  ...100
+    &ProcessorCore::_handleRorW,                //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  011...
+    &ProcessorCore::_handleShlUB,               //  ...000
+    &ProcessorCore::_handleShrUB,               //  ...001
+    &ProcessorCore::_handleAslUB,               //  ...010
+    &ProcessorCore::_handleAsrUB,               //  ...011
+    &ProcessorCore::_handleRolUB,               //  ...100
+    &ProcessorCore::_handleRorUB,               //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  100...
+    &ProcessorCore::_handleShlUH,               //  ...000
+    &ProcessorCore::_handleShrUH,               //  ...001
+    &ProcessorCore::_handleAslUH,               //  ...010
+    &ProcessorCore::_handleAsrUH,               //  ...011
+    &ProcessorCore::_handleRolUH,               //  ...100
+    &ProcessorCore::_handleRorUH,               //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  101...
+    &ProcessorCore::_handleShlUW,               //  ...000
+    &ProcessorCore::_handleShrUW,               //  ...001
+    &ProcessorCore::_handleAslUW,               //  ...010
+    &ProcessorCore::_handleAsrUW,               //  ...011
+    &ProcessorCore::_handleRolUW,               //  ...100
+    &ProcessorCore::_handleRorUW,               //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  110...
+    &ProcessorCore::_handleShlL,                //  ...000
+    &ProcessorCore::_handleShrL,                //  ...001
+    &ProcessorCore::_handleAslL,                //  ...010
+    &ProcessorCore::_handleAsrL,                //  ...011
+    &ProcessorCore::_handleRolL,                //  ...100
+    &ProcessorCore::_handleRorL,                //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  111...
+    &ProcessorCore::_handleGetfl,               //  ...000
+    &ProcessorCore::_handleSetfl,               //  ...001
+    &ProcessorCore::_handleRstfl,               //  ...010
+    &ProcessorCore::_handleInvalidInstruction,  //  ...011
+    &ProcessorCore::_handleInvalidInstruction,  //  ...100
+    &ProcessorCore::_handleSvc,                 //  ...101
+    &ProcessorCore::_handleBrk,                 //  ...110
+    &ProcessorCore::_handleInvalidInstruction   //  ...111
+};
+
+unsigned ProcessorCore::_handleBase5(uint32_t instruction)
+{
+    _InstructionHandler handler = _Base5DispatchTable[instruction & 0x3F];
+    return (this->*handler)(instruction);
+}
 
-    _InstructionHandler handler = DispatchTable[instruction & 0x3F];
+const ProcessorCore::_InstructionHandler ProcessorCore::_Fp1DispatchTable[64] =
+{
+    //  000...
+    &ProcessorCore::_handleMovD,                //  ...000
+    &ProcessorCore::_handleCvtDF,               //  ...001
+    &ProcessorCore::_handleInvalidInstruction,  //  ...010
+    &ProcessorCore::_handleInvalidInstruction,  //  ...011
+    &ProcessorCore::_handleInvalidInstruction,  //  ...100
+    &ProcessorCore::_handleInvalidInstruction,  //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  001...
+    &ProcessorCore::_handleAddD,                //  ...000
+    &ProcessorCore::_handleSubD,                //  ...001
+    &ProcessorCore::_handleMulD,                //  ...010
+    &ProcessorCore::_handleDivD,                //  ...011
+    &ProcessorCore::_handleAbsD,                //  ...100
+    &ProcessorCore::_handleNegD,                //  ...101
+    &ProcessorCore::_handleSqrtD,               //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  010...
+    & ProcessorCore::_handleAddF,               //  ...000
+    & ProcessorCore::_handleSubF,               //  ...001
+    & ProcessorCore::_handleMulF,               //  ...010
+    & ProcessorCore::_handleDivF,               //  ...011
+    & ProcessorCore::_handleAbsF,               //  ...100
+    & ProcessorCore::_handleNegF,               //  ...101
+    & ProcessorCore::_handleSqrtF,              //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  011...
+    &ProcessorCore::_handleSeqD,                //  ...000
+    &ProcessorCore::_handleSneD,                //  ...001
+    &ProcessorCore::_handleSltD,                //  ...010
+    &ProcessorCore::_handleSleD,                //  ...011
+    &ProcessorCore::_handleSgtD,                //  ...100
+    &ProcessorCore::_handleSgeD,                //  ...101
+    &ProcessorCore::_handleInvalidInstruction,  //  ...110
+    &ProcessorCore::_handleInvalidInstruction,  //  ...111
+    //  100...
+    &ProcessorCore::_handleCvtFB,               //  ...000
+    &ProcessorCore::_handleCvtFH,               //  ...001
+    &ProcessorCore::_handleCvtFW,               //  ...010
+    &ProcessorCore::_handleCvtFL,               //  ...011
+    &ProcessorCore::_handleCvtFUB,              //  ...100
+    &ProcessorCore::_handleCvtFUH,              //  ...101
+    &ProcessorCore::_handleCvtFUW,              //  ...110
+    &ProcessorCore::_handleCvtFUL,              //  ...111
+    //  101...
+    &ProcessorCore::_handleCvtBF,               //  ...000
+    &ProcessorCore::_handleCvtHF,               //  ...001
+    &ProcessorCore::_handleCvtWF,               //  ...010
+    &ProcessorCore::_handleCvtLF,               //  ...011
+    &ProcessorCore::_handleCvtUBF,              //  ...100
+    &ProcessorCore::_handleCvtUHF,              //  ...101
+    &ProcessorCore::_handleCvtUWF,              //  ...110
+    &ProcessorCore::_handleCvtULF,              //  ...111
+    //  110...
+    & ProcessorCore::_handleCvtDB,               //  ...000
+    & ProcessorCore::_handleCvtDH,               //  ...001
+    & ProcessorCore::_handleCvtDW,               //  ...010
+    & ProcessorCore::_handleCvtDL,               //  ...011
+    & ProcessorCore::_handleCvtDUB,              //  ...100
+    & ProcessorCore::_handleCvtDUH,              //  ...101
+    & ProcessorCore::_handleCvtDUW,              //  ...110
+    & ProcessorCore::_handleCvtDUL,              //  ...111
+    //  111...
+    & ProcessorCore::_handleCvtBD,               //  ...000
+    & ProcessorCore::_handleCvtHD,               //  ...001
+    & ProcessorCore::_handleCvtWD,               //  ...010
+    & ProcessorCore::_handleCvtLD,               //  ...011
+    & ProcessorCore::_handleCvtUBD,              //  ...100
+    & ProcessorCore::_handleCvtUHD,              //  ...101
+    & ProcessorCore::_handleCvtUWD,              //  ...110
+    & ProcessorCore::_handleCvtULD               //  ...111
+};
+
+unsigned ProcessorCore::_handleFp1(uint32_t instruction)
+{
+    _InstructionHandler handler = _Fp1DispatchTable[instruction & 0x3F];
     return (this->*handler)(instruction);
 }
 
@@ -22,6 +22,15 @@ namespace hadesvm
             PerformanceMonitoring = 0x40
         };
 
+        //////////
+        //  The way processor cores execute instructions
+        enum class ExecutionEngine
+        {
+            Reference,  //  fetch, decode and dispatch one instruction per clock tick
+            Threaded,   //  direct-threaded dispatch over predecoded basic blocks
+            Translated  //  as Threaded, but hot basic blocks are translated to host code
+        };
+
         class HADESVM_CEREON_PUBLIC Features final
         {
             //////////
@@ -67,7 +76,7 @@ namespace hadesvm
         }
 
         //////////
-        //  Thrown by instruction handling routines when a PROGRAM interrupt (exception) occurs
+        //  Raised by instruction handling routines when a PROGRAM interrupt (exception) occurs
         enum class ProgramInterrupt : uint64_t
         {
             ZDIV        = UINT64_C(0x0000000000000001),
@@ -97,7 +106,7 @@ namespace hadesvm
         };
 
         //////////
-        //  Thrown by instruction handling routines when a HARDWARE interrupt (exception) occurs
+        //  Raised by instruction handling routines when a HARDWARE interrupt (exception) occurs
         enum class HardwareInterrupt : uint64_t
         {
             PROCESSOR   = UINT64_C(0x0000000000000001),
@@ -105,14 +114,28 @@ namespace hadesvm
             BUS         = UINT64_C(0x0000000000000003),
             IO          = UINT64_C(0x0000000000000004),
             TIMER       = UINT64_C(0x0000000000000005),
+            PERFORMANCE = UINT64_C(0x0000000000000006),
             UNKNOWN     = UINT64_C(0xFFFFFFFFFFFFFFFF)
         };
 
         //////////
-        //  Thrown by instruction handling routines when CPU core must be HALTed
-        //  TODO do we need a full class ?
-        class HADESVM_CEREON_PUBLIC ForceHalt final
+        //  Events counted by processor cores that have Feature::PerformanceMonitoring;
+        //  the counter of each event is the $m register 8 + event
+        enum class PerformanceEvent : unsigned
         {
+            RetiredInstructions,    //  ...including those that raise an interrupt
+            Loads,                  //  ...one per instruction, even if crossing a page boundary
+            Stores,                 //  ...one per instruction, even if crossing a page boundary
+            TakenBranches,          //  ...including jumps
+            TimerInterrupts,
+            IoInterrupts,
+            SvcInterrupts,
+            ProgramInterrupts,
+            ExternalInterrupts,
+            HardwareInterrupts,
+            ITlbMisses,
+            DTlbMisses,
+            StallCycles
         };
 
         //////////
@@ -121,6 +144,33 @@ namespace hadesvm
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Mmu)
 
+            //////////
+            //  Constants
+        public:
+            //  Logical addresses are translated in pages of PageSize bytes;
+            //  all addresses within a page are translated the same way
+            static const unsigned   PageShift = 12;
+            static const uint64_t   PageSize = UINT64_C(1) << PageShift;
+            static const uint64_t   PageOffsetMask = PageSize - 1;
+
+            //  Access rights to a page
+            static const unsigned   LoadAccess = 0x01;
+            static const unsigned   StoreAccess = 0x02;
+            static const unsigned   FetchAccess = 0x04;
+            static const unsigned   UserAccess = 0x08;  //  ...is allowed in user mode
+            static const unsigned   AllAccess = LoadAccess | StoreAccess | FetchAccess | UserAccess;
+
+            //////////
+            //  Types
+        public:
+            //  The processor core state that affects address translation
+            struct Context
+            {
+                MemoryBus *     memoryBus;      //  ...to read page tables from
+                uint64_t        pageTableHead;  //  ...as held in $pth
+                ByteOrder       byteOrder;      //  ...of page table entries
+            };
+
             //////////
             //  Construction/destruction
         protected:
@@ -130,12 +180,13 @@ namespace hadesvm
             //////////
             //  Operations
         public:
-            //  Translates logical address (of an instruction fetch, data
-            //  load or data store) to physical address.
-            //  Throws MemoryAccessError if the translation fails.
-            virtual uint64_t    translateFetchAddress(uint64_t logicalAddress) throws(MemoryAccessError) = 0;
-            virtual uint64_t    translateLoadAddress(uint64_t logicalAddress) throws(MemoryAccessError)= 0;
-            virtual uint64_t    translateStoreAddress(uint64_t logicalAddress) throws(MemoryAccessError)= 0;
+            //  Translates the logical page containing the specified address
+            //  to a physical page, returning the physical address of the page
+            //  start in "physicalPage" and the allowed kinds of access to the
+            //  page in "accessRights". Access rights are NOT checked here.
+            //  Returns MemoryAccessError::None on success, else the error.
+            virtual MemoryAccessError   translatePage(const Context & context, uint64_t logicalAddress,
+                                                      uint64_t & physicalPage, unsigned & accessRights) = 0;
         };
 
         //////////
@@ -152,14 +203,64 @@ namespace hadesvm
             //////////
             //  Mmu
         public:
-            virtual uint64_t    translateFetchAddress(uint64_t logicalAddress) throws(MemoryAccessError) override { return logicalAddress; }
-            virtual uint64_t    translateLoadAddress(uint64_t logicalAddress) throws(MemoryAccessError) override { return logicalAddress; }
-            virtual uint64_t    translateStoreAddress(uint64_t logicalAddress) throws(MemoryAccessError) override { return logicalAddress; }
+            virtual MemoryAccessError   translatePage(const Context & /*context*/, uint64_t logicalAddress,
+                                                      uint64_t & physicalPage, unsigned & accessRights) override
+            {
+                physicalPage = logicalAddress & ~PageOffsetMask;
+                accessRights = AllAccess;
+                return MemoryAccessError::None;
+            }
+        };
+
+        //////////
+        //  A MMU that translates addresses by walking the page tables in
+        //  physical memory (for the VirtualMemory feature).
+        //  Page tables are 4-level radix trees; each table occupies one
+        //  page and holds 512 64-bit entries in the current byte order.
+        //  Bits 47..12 of a logical address select an entry at each level
+        //  (9 bits per level, root table first); bits 63..48 must all be
+        //  equal to bit 47. Each entry has the following format:
+        //  *   bits 63..12 - the physical address of the next-level table
+        //      or, at the last level, of the mapped page;
+        //  *   bits 11..4  - reserved, must be 0;
+        //  *   bit 3 (U)   - the page(s) can be accessed in user mode;
+        //  *   bit 2 (X)   - instructions can be fetched from the page(s);
+        //  *   bit 1 (W)   - the page(s) can be stored into;
+        //  *   bit 0 (P)   - the entry is present.
+        //  The U, X and W bits along the walk are ANDed; loads are always
+        //  allowed from a present page.
+        class HADESVM_CEREON_PUBLIC PagedMmu : public Mmu
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(PagedMmu)
+
+            //////////
+            //  Constants
+        public:
+            static const unsigned   Levels = 4;
+            static const unsigned   EntriesPerTableShift = 9;
+
+            static const uint64_t   PresentMask = UINT64_C(0x0000000000000001);
+            static const uint64_t   WritableMask = UINT64_C(0x0000000000000002);
+            static const uint64_t   ExecutableMask = UINT64_C(0x0000000000000004);
+            static const uint64_t   UserMask = UINT64_C(0x0000000000000008);
+            static const uint64_t   ReservedMask = UINT64_C(0x0000000000000FF0);
+            static const uint64_t   AddressMask = UINT64_C(0xFFFFFFFFFFFFF000);
+
+            //////////
+            //  Construction/destruction
+        public:
+            PagedMmu() = default;
+
+            //////////
+            //  Mmu
+        public:
+            virtual MemoryAccessError   translatePage(const Context & context, uint64_t logicalAddress,
+                                                      uint64_t & physicalPage, unsigned & accessRights) override;
         };
 
         //////////
         //  A single processor core
-        class HADESVM_CEREON_PUBLIC ProcessorCore
+        class HADESVM_CEREON_PUBLIC ProcessorCore : public IMemorySnooper
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ProcessorCore)
 
@@ -182,9 +283,39 @@ namespace hadesvm
             //  Resets this processor core to post-bootstrapping state
             void                reset();
 
+            //  Saves/restores the registers of this core to/from a VA snapshot;
+            //  only to be used while the core is not running
+            void                saveSnapshot(hadesvm::core::SnapshotWriter & writer) const;
+            void                restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException);
+
             //  Called on every clock tick
             void                onClockTick();
 
+            //  Runs this core for up to the specified number of clock cycles,
+            //  with the same effect as calling onClockTick() that many times,
+            //  except that stalls and Idle mode are accounted for in bulk.
+            //  Returns the number of clock cycles actually run, which is less
+            //  than requested if $state has changed (an interrupt has occurred,
+            //  the core has halted, etc.) - the caller can then resume.
+            unsigned            runCycles(unsigned numCycles);
+
+            //  If this core is Idle, returns the number of clock cycles it will
+            //  stay Idle for unless woken up by an I/O or EXTERNAL interrupt
+            //  (UINT64_MAX if no TIMER interrupt can end the Idle mode); if
+            //  the core is working or stalling, returns 0.
+            uint64_t            idleCycles() const;
+
+            //  Returns the current value of the counter of the specified event.
+            //  Can be called from any thread while the core runs, in which case
+            //  the value may be slightly stale.
+            uint64_t            performanceCounter(PerformanceEvent event) const;
+
+            //////////
+            //  IMemorySnooper
+        public:
+            virtual void        onWatchedPageModified(size_t watchSlot) override;
+            virtual void        onHostMemoryPublished() override;
+
             //////////
             //  Implementation
         private:
@@ -354,6 +485,23 @@ namespace hadesvm
             uint64_t            _d[32];
             uint64_t            _m[32];
 
+            //  Performance monitoring. $m0 controls counting, $m1 records
+            //  counter overflows (bit N for $mN) and $m2 selects the overflows
+            //  that cause a PERFORMANCE HARDWARE interrupt, which is taken
+            //  right after the instruction that caused the overflow.
+            //  $m8 and up count PerformanceEvents.
+            static const unsigned   _PmControlRegister = 0;
+            static const unsigned   _PmOverflowRegister = 1;
+            static const unsigned   _PmInterruptEnableRegister = 2;
+            static const unsigned   _PmFirstCounterRegister = 8;
+            static const uint64_t   _PmEnableMask = 0x0000000000000001;     //  E: count events
+            static const uint64_t   _PmUserReadMask = 0x0000000000000002;   //  U: User mode may read $m
+
+            //  True if the core has Feature::PerformanceMonitoring and $m0.E
+            //  is set - so that counting costs a single test when disabled
+            bool                _performanceMonitoringEnabled;
+            bool                _performanceInterruptPending;
+
             class HADESVM_CEREON_PUBLIC _FlagsRegister final
             {
                 HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_FlagsRegister)
@@ -409,6 +557,183 @@ namespace hadesvm
             //  The number of clock cycles to stall for (emulating multi-cycle instructions)
             unsigned            _cyclesToStall;
 
+            //  Sampling profiler. The samples are taken by the thread running
+            //  this core and drained by the Processor
+            static const uint64_t   _FpRegister = 28;
+            hadesvm::util::RingBuffer<ProfileSample> *  _profileSamples;    //  nullptr == not profiling
+            uint64_t            _profilingInterval; //  ...in clock cycles
+            uint64_t            _nextSampleCc;
+
+            //  Execution tracing; while tracing, the core executes one
+            //  instruction at a time even with the threaded engine
+            TraceEncoder *      _traceEncoder;  //  nullptr == not tracing
+
+            //  Helpers (instruction execution). Each handler returns the
+            //  number of clock cycles taken by instruction execution.
+            //  An interrupt caused by the instruction is raised by the
+            //  handler itself, which then returns without completing it.
+            typedef unsigned (ProcessorCore::*_InstructionHandler)(uint32_t instruction);
+
+            //  Predecoded instructions are kept in basic blocks, each of which is
+            //  a straight run of instructions ending with the first flow control
+            //  instruction, at the end of a watched memory page or when the block
+            //  is full. Basic blocks are cached by physical address of their 1st
+            //  instruction, and dropped when memory bus reports a store into their page.
+            //  Each predecoded instruction carries its operands, extracted and
+            //  extended once at decoding time, and its cost in clock cycles; the
+            //  frequent instructions are then executed from these operands by an
+            //  "executor", all others by their handler (via _executeUndecoded).
+            struct _DecodedInstruction;
+            typedef unsigned (ProcessorCore::*_DecodedInstructionHandler)(const _DecodedInstruction & decodedInstruction);
+            typedef unsigned (ProcessorCore::*_FusedExecutor)(const _DecodedInstruction * run, unsigned length, unsigned maxCycles);
+
+            struct _DecodedInstruction
+            {
+                _DecodedInstructionHandler  executor;
+                _InstructionHandler handler;    //  ...with all sub-opcode dispatch resolved
+                uint32_t        instruction;
+                uint8_t         r1;             //  ...bits 21..25, whether used or not
+                uint8_t         r2;             //  ...bits 16..20, whether used or not
+                uint8_t         r3;             //  ...bits 11..15, whether used or not
+                uint8_t         cycles;         //  ...if completed; 0 == as returned by handler
+                uint64_t        imm;            //  ...immediate operand (extended) or branch displacement (in bytes)
+                const void *    threadedCode;   //  ...used by threaded engine; nullptr == not threaded yet
+                _FusedExecutor  fusedExecutor;  //  ...of the fused run this instruction starts; nullptr == none
+                unsigned        fusedLength;    //  ...of that run, in instructions
+            };
+
+            //  The executors, with the way each one wants its immediate operand
+            //  decoded. An instruction with any of the "reservedBits" set is left
+            //  to its handler, which raises an OPCODE interrupt for it
+            enum class _ImmediateFormat
+            {
+                None,
+                SignedInt16,
+                UnsignedInt16,
+                SignedInt21,
+                BranchInt16,    //  sign-extended and scaled by 4
+                BranchInt26,    //  sign-extended and scaled by 4
+                RegisterMask    //  ldm/stm register mask; a bad base register leaves the instruction to its handler
+            };
+            struct _InstructionExecutor
+            {
+                _InstructionHandler handler;
+                _DecodedInstructionHandler  executor;
+                _ImmediateFormat    immediateFormat;
+                uint32_t            reservedBits;
+            };
+            static const _InstructionExecutor   _InstructionExecutors[];
+
+            //  Fused superinstructions. A run of predecoded instructions that
+            //  matches one of the idioms below is executed by the threaded
+            //  engine with a single dispatch, by a "fused executor" that does
+            //  what the executors of the run do, in turn, with no dispatch or
+            //  state write-back in between; it stops early if an instruction
+            //  raises an interrupt, jumps or stores into code. An idiom is
+            //  either a fixed sequence of executors, or (if "repeated") any run
+            //  of instructions with the 1st or 2nd executor optionally ended by
+            //  one with the 3rd (nullptr == none). The fused executor of each
+            //  idiom is generated from its executors (see _fusedSequence and
+            //  _fusedRepetition), so adding or reordering idioms, e.g. after
+            //  profiling a guest, is a change to _FusedIdioms only. Idioms are
+            //  matched in order, so more specific ones should come first.
+            static const unsigned   _MaxFusedIdiomLength = 3;
+            struct _FusedIdiom
+            {
+                _DecodedInstructionHandler  executors[_MaxFusedIdiomLength];    //  unused trailing entries are nullptr
+                bool                repeated;
+                _FusedExecutor      fusedExecutor;
+            };
+            static const _FusedIdiom    _FusedIdioms[];
+
+            static const unsigned   _MaxBasicBlockLength = 32;
+            static const size_t     _BasicBlockCacheSize = 1024;    //  must be a power of 2
+
+            //  Once a basic block has been entered _HotBasicBlockThreshold times,
+            //  it records the basic blocks control flows to from it; entering
+            //  one of them again then needs neither address translation nor
+            //  cache lookup. A link is only good for the exact $state it was
+            //  made with, and all links are dropped (by bumping the link epoch)
+            //  whenever a TLB is invalidated or a cached basic block is dropped
+            //  or replaced.
+            //  The translating engine also translates a basic block to host
+            //  code once it is hot, and the translations of linked blocks
+            //  jump to each other through the same links.
+            static const uint64_t   _HotBasicBlockThreshold = 16;
+            static const unsigned   _MaxBasicBlockLinks = 2;
+
+            struct _BasicBlock;
+
+            struct _BasicBlockLink
+            {
+                uint64_t        address;    //  ...logical, of the successor
+                uint64_t        state;      //  ...when the link was made
+                uint64_t        epoch;      //  ...when the link was made
+                _BasicBlock *   target;     //  nullptr == unused link
+            };
+
+            struct _BasicBlock
+            {
+                uint64_t        physicalAddress;    //  ...of the 1st instruction
+                ByteOrder       byteOrder;          //  ...in effect when the block was decoded
+                unsigned        numInstructions;    //  0 == this cache entry is free
+                uint64_t        executionCount;     //  ...since the block was decoded
+                unsigned        nextLinkToReplace;
+                _BasicBlockLink links[_MaxBasicBlockLinks];
+                _BasicBlock *   previousInWatchSlot;    //  nullptr == first cached block in its watch slot
+                _BasicBlock *   nextInWatchSlot;        //  nullptr == last cached block in its watch slot
+                const uint8_t * translatedCode;     //  ...in _codeCache; nullptr == not translated
+                _DecodedInstruction instructions[_MaxBasicBlockLength];
+            };
+
+            _BasicBlock *       _basicBlockCache;   //  array of _BasicBlockCacheSize elements
+            _BasicBlock *       _currentBasicBlock; //  nullptr == none
+            uint64_t            _basicBlockLinkEpoch;
+
+            //  The execution point within the current basic block
+            const _DecodedInstruction * _nextDecodedInstruction;
+            const _DecodedInstruction * _endDecodedInstructions;
+            uint64_t            _nextDecodedInstructionAddress; //  $ip that corresponds to _nextDecodedInstruction
+
+            //  Basic block invalidations requested by memory bus (possibly
+            //  by other threads), but not yet processed
+            std::atomic<bool>   _basicBlockInvalidationPending;
+            std::atomic<uint64_t> * _invalidatedWatchSlots; //  bitmap of MemoryBus::WatchSlotCount bits
+            std::atomic<uint64_t>   _invalidatedWatchSlotWords[MemoryBus::WatchSlotCount / 64 / 64];  //  bitmap of non-0 words of the above
+
+            //  The cached basic blocks of each watch slot, so that processing an
+            //  invalidation only visits the blocks it drops. A basic block is on
+            //  the list of its watch slot if and only if it has instructions.
+            _BasicBlock **      _basicBlocksByWatchSlot;    //  array of MemoryBus::WatchSlotCount list heads
+
+            //  Translations of logical pages (used in Virtual mode) are cached in
+            //  direct-mapped TLBs, one for instruction fetches and one for data
+            //  accesses. Entries are tagged by the context ID and $pth they were
+            //  made with, so a context switch needs no flush; writing to $pth
+            //  (even the same value) drops all entries of the current context.
+            struct _TlbEntry
+            {
+                uint64_t        logicalPage;    //  logical address >> Mmu::PageShift; _InvalidLogicalPage == entry is free
+                uint64_t        pageTableHead;  //  $pth the translation was made with
+                uint32_t        contextId;      //  context ID the translation was made in
+                unsigned        accessRights;   //  Mmu::XXXAccess bits
+                uint64_t        physicalPage;   //  physical address of the page start
+                uint8_t *       loadData;       //  host memory of the page if loads can bypass memory bus, else nullptr
+                uint8_t *       storeData;      //  host memory of the page if stores can bypass memory bus, else nullptr
+            };
+
+            static const size_t     _ITlbSize = 64;     //  must be a power of 2
+            static const size_t     _DTlbSize = 256;    //  must be a power of 2
+            static const uint64_t   _InvalidLogicalPage = UINT64_C(0xFFFFFFFFFFFFFFFF);
+
+            _TlbEntry           _iTlb[_ITlbSize];
+            _TlbEntry           _dTlb[_DTlbSize];
+
+            //  Set (possibly by another thread) when the memory bus has mapped
+            //  new host memory, which TLB entries may have been made without;
+            //  the TLBs are then invalidated before the next quantum
+            std::atomic<bool>   _tlbInvalidationPending;
+
             //  "Data type" definitions provide operand/result conversions
             //  for various flavours of arithmetic/logical/shift instructions
             struct _Byte
@@ -534,23 +859,95 @@ namespace hadesvm
                 static uint64_t reverseBits(uint64_t operand) { return Alu::reverseBits64(operand); }
             };
 
+            //  Helpers (address translation). Translate the logical address of
+            //  an instruction fetch, data load or data store to physical address.
+            //  "hostData" receives the host memory that keeps the addressed byte
+            //  if the access can bypass the memory bus, else nullptr; a store made
+            //  via "hostData" must be reported by MemoryBus::notifyStore().
+            //  Return true on success; on failure raise the proper
+            //  interrupt (or halt if it is masked) and return false. A load or
+            //  store is counted and traced here unless "monitored" is false,
+            //  i.e. the caller has done that for the whole of a split access
+            bool                _translateFetchAddress(uint64_t address, uint64_t & physicalAddress);
+            bool                _translateLoadAddress(uint64_t address, uint64_t & physicalAddress, uint8_t *& hostData, bool monitored = true);
+            bool                _translateStoreAddress(uint64_t address, uint64_t & physicalAddress, uint8_t *& hostData, bool monitored = true);
+            //  The "size" bytes of an unaligned access must all be in the same
+            //  page; their host memory is looked up in Real mode as well. The
+            //  access is neither counted nor traced here
+            bool                _translateUnalignedAddress(uint64_t address, unsigned size, bool forStore,
+                                                           uint64_t & physicalAddress, uint8_t *& hostData);
+            _TlbEntry *         _translatePage(_TlbEntry * tlb, size_t tlbSize, uint64_t address,
+                                               unsigned access, MemoryAccessError & error);
+            void                _invalidateTlbs();
+            void                _invalidateTlbs(uint32_t contextId);
+
             //  Helpers (memory access)
-            //  Can throw ProgramInterrupt, HardwareInterrupt, ForceHalt
-            uint32_t            _fetchInstruction(uint64_t address) throws(ProgramInterrupt, HardwareInterrupt);
-            uint64_t            _fetchLongWord(uint64_t address) throws(ProgramInterrupt, HardwareInterrupt);
-            uint8_t             _loadByte(uint64_t address);
-            uint16_t            _loadHalfWord(uint64_t address);
-            uint32_t            _loadWord(uint64_t address);
-            uint64_t            _loadLongWord(uint64_t address);
-            void                _storeByte(uint64_t address, uint8_t value);
-            void                _storeHalfWord(uint64_t address, uint16_t value);
-            void                _storeWord(uint64_t address, uint32_t value);
-            void                _storeLongWord(uint64_t address, uint64_t value);
+            //  Return true on success; on failure raise the proper
+            //  interrupt (or halt if it is masked) and return false.
+            //  Multi-byte accesses are instantiated for each guest byte order;
+            //  so are the instruction handlers that use them, and the basic
+            //  block decoder binds the instantiation for the byte order in effect.
+            bool                _fetchInstruction(uint64_t address, uint32_t & instruction);
+            template <ByteOrder GuestByteOrder>
+            bool                _fetchLongWord(uint64_t address, uint64_t & value);
+            bool                _loadByte(uint64_t address, uint8_t & value, bool monitored = true);
+            template <ByteOrder GuestByteOrder>
+            bool                _loadHalfWord(uint64_t address, uint16_t & value);
+            template <ByteOrder GuestByteOrder>
+            bool                _loadWord(uint64_t address, uint32_t & value);
+            template <ByteOrder GuestByteOrder>
+            bool                _loadLongWord(uint64_t address, uint64_t & value);
+            bool                _storeByte(uint64_t address, uint8_t value, bool monitored = true);
+            template <ByteOrder GuestByteOrder>
+            bool                _storeHalfWord(uint64_t address, uint16_t value);
+            template <ByteOrder GuestByteOrder>
+            bool                _storeWord(uint64_t address, uint32_t value);
+            template <ByteOrder GuestByteOrder>
+            bool                _storeLongWord(uint64_t address, uint64_t value);
+            //  Atomically stores "value" and loads the previous content into
+            //  "oldValue"; the memory bus is only locked if the long word is
+            //  not naturally aligned or is not in RAM
+            template <ByteOrder GuestByteOrder>
+            bool                _exchangeLongWord(uint64_t address, uint64_t value, uint64_t & oldValue);
+
+            //  Helpers (performance monitoring)
+            void                _countPerformanceEvent(PerformanceEvent event, uint64_t count = 1)
+            {
+                if (_performanceMonitoringEnabled)
+                {
+                    _addToPerformanceCounter(event, count);
+                }
+            }
+            void                _addToPerformanceCounter(PerformanceEvent event, uint64_t count);
+            //  Count and trace a data access, once however many pieces it is made of
+            void                _monitorLoad(uint64_t address)
+            {
+                _countPerformanceEvent(PerformanceEvent::Loads);
+                if (_traceEncoder != nullptr)
+                {
+                    _traceEncoder->recordLoad(address);
+                }
+            }
+            void                _monitorStore(uint64_t address)
+            {
+                _countPerformanceEvent(PerformanceEvent::Stores);
+                if (_traceEncoder != nullptr)
+                {
+                    _traceEncoder->recordStore(address);
+                }
+            }
+            void                _updatePerformanceMonitoring();
+
+            //  Helpers (profiling)
+            void                _takeProfileSample();
+            //  Loads a long word without raising interrupts or counting events;
+            //  returns false if the address is not readable
+            bool                _peekLongWord(uint64_t address, uint64_t & value);
 
             //  Helpers (interrupt handling)
-            Q_NORETURN void     _translateAndThrowI(MemoryAccessError memoryAccessError) throws(ProgramInterrupt, HardwareInterrupt);
-            Q_NORETURN void     _translateAndThrowD(MemoryAccessError memoryAccessError) throws(ProgramInterrupt, HardwareInterrupt);
-            Q_NORETURN void     _translateAndThrowIO(IoError ioError) throws(ProgramInterrupt, HardwareInterrupt);
+            void                _translateAndRaiseI(MemoryAccessError memoryAccessError);
+            void                _translateAndRaiseD(MemoryAccessError memoryAccessError);
+            void                _translateAndRaiseIO(IoError ioError);
             void                _handleTimerInterrupt();
             void                _handleIoInterrupt(uint64_t interruptStatusCode);
             void                _handleSvcInterrupt();
@@ -558,37 +955,436 @@ namespace hadesvm
             void                _handleExternalInterrupt(uint64_t interruptStatusCode);
             void                _handleHardwareInterrupt(HardwareInterrupt interruptStatusCode);
 
-            void                _raiseProgramInterrupt(ProgramInterrupt interruptStatusCode);   //  TODO throws(ForceHalt) if masked
-            void                _raiseHardwareInterrupt(HardwareInterrupt interruptStatusCode);  //  TODO throws(ForceHalt) if masked
+            //  Handle the interrupt right away; HALT if it is masked
+            void                _raiseProgramInterrupt(ProgramInterrupt interruptStatusCode);
+            void                _raiseHardwareInterrupt(HardwareInterrupt interruptStatusCode);
+
+            //  Helpers (basic blocks)
+            bool                _enterBasicBlock(uint64_t address);
+            bool                _decodeBasicBlock(_BasicBlock * basicBlock, uint64_t physicalAddress, ByteOrder byteOrder);
+            void                _processBasicBlockInvalidations();
+            void                _invalidateAllBasicBlocks();
+            void                _addToWatchSlot(_BasicBlock * basicBlock);
+            void                _removeFromWatchSlot(_BasicBlock * basicBlock);
+            static _InstructionHandler  _decodeInstruction(uint32_t instruction, ByteOrder byteOrder);
+            static bool         _endsBasicBlock(_InstructionHandler handler);
+            static void         _decodeOperands(_DecodedInstruction & decodedInstruction);
+            static bool         _usesIpRegister(const _DecodedInstruction & decodedInstruction, _ImmediateFormat immediateFormat);
+            static bool         _isValidMultipleTransferBase(unsigned r1, uint32_t registerMask);
+            static void         _fuseInstructions(_BasicBlock * basicBlock);
+            static unsigned     _matchFusedIdiom(const _FusedIdiom & idiom, const _DecodedInstruction * run, const _DecodedInstruction * end);
+            bool                _followBasicBlockLink(uint64_t address);
+            void                _linkBasicBlock(_BasicBlock * from, uint64_t address, _BasicBlock * to);
+
+            //  Helpers (predecoded instruction execution). An executor does what
+            //  the handler of the instruction does, but starts from the operands
+            //  decoded into the _DecodedInstruction
+            unsigned            _executeUndecoded(const _DecodedInstruction & decodedInstruction)
+            {
+                return (this->*(decodedInstruction.handler))(decodedInstruction.instruction);
+            }
+            unsigned            _executeLiL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = decodedInstruction.imm;
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeMovL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = _r[decodedInstruction.r2];
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeNop(const _DecodedInstruction & decodedInstruction)
+            {
+                return decodedInstruction.cycles;
+            }
+            //  Signed long word additions and subtractions raise an interrupt
+            //  on overflow (if enabled), so the threaded engine checks first
+            static bool         _isAddOverflow(uint64_t op1, uint64_t op2)
+            {
+                return ((~(op1 ^ op2) & (op1 ^ (op1 + op2))) >> 63) != 0;
+            }
+            static bool         _isSubtractOverflow(uint64_t op1, uint64_t op2)
+            {
+                return (((op1 ^ op2) & (op1 ^ (op1 - op2))) >> 63) != 0;
+            }
+            unsigned            _executeAddL(const _DecodedInstruction & decodedInstruction)
+            {
+                uint64_t op1 = _r[decodedInstruction.r2], op2 = _r[decodedInstruction.r3];
+                _r[decodedInstruction.r1] = op1 + op2;
+                _handleIntegerOverflow(_isAddOverflow(op1, op2));
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeSubL(const _DecodedInstruction & decodedInstruction)
+            {
+                uint64_t op1 = _r[decodedInstruction.r2], op2 = _r[decodedInstruction.r3];
+                _r[decodedInstruction.r1] = op1 - op2;
+                _handleIntegerOverflow(_isSubtractOverflow(op1, op2));
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeAddiL(const _DecodedInstruction & decodedInstruction)
+            {
+                uint64_t op1 = _r[decodedInstruction.r2], op2 = decodedInstruction.imm;
+                _r[decodedInstruction.r1] = op1 + op2;
+                _handleIntegerOverflow(_isAddOverflow(op1, op2));
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeSubiL(const _DecodedInstruction & decodedInstruction)
+            {
+                uint64_t op1 = _r[decodedInstruction.r2], op2 = decodedInstruction.imm;
+                _r[decodedInstruction.r1] = op1 - op2;
+                _handleIntegerOverflow(_isSubtractOverflow(op1, op2));
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeAndL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = _r[decodedInstruction.r2] & _r[decodedInstruction.r3];
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeOrL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = _r[decodedInstruction.r2] | _r[decodedInstruction.r3];
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeXorL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = _r[decodedInstruction.r2] ^ _r[decodedInstruction.r3];
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeAndiL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = _r[decodedInstruction.r2] & decodedInstruction.imm;
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeOriL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = _r[decodedInstruction.r2] | decodedInstruction.imm;
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeXoriL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = _r[decodedInstruction.r2] ^ decodedInstruction.imm;
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeSeqL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = (_r[decodedInstruction.r2] == _r[decodedInstruction.r3]) ? 1u : 0u;
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeSltL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = (static_cast<int64_t>(_r[decodedInstruction.r2]) < static_cast<int64_t>(_r[decodedInstruction.r3])) ? 1u : 0u;
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeSltUL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = (_r[decodedInstruction.r2] < _r[decodedInstruction.r3]) ? 1u : 0u;
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeSeqiL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = (_r[decodedInstruction.r2] == decodedInstruction.imm) ? 1u : 0u;
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeSltiL(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[decodedInstruction.r1] = (static_cast<int64_t>(_r[decodedInstruction.r2]) < static_cast<int64_t>(decodedInstruction.imm)) ? 1u : 0u;
+                return decodedInstruction.cycles;
+            }
+            template <ByteOrder GuestByteOrder>
+            unsigned            _executeLL(const _DecodedInstruction & decodedInstruction)
+            {
+                uint64_t value = 0;
+                if (_loadLongWord<GuestByteOrder>(_r[decodedInstruction.r2] + decodedInstruction.imm, value))
+                {
+                    _r[decodedInstruction.r1] = value;
+                    return decodedInstruction.cycles;
+                }
+                return 1;
+            }
+            template <ByteOrder GuestByteOrder>
+            unsigned            _executeSL(const _DecodedInstruction & decodedInstruction)
+            {
+                if (_storeLongWord<GuestByteOrder>(_r[decodedInstruction.r2] + decodedInstruction.imm, _r[decodedInstruction.r1]))
+                {
+                    return decodedInstruction.cycles;
+                }
+                return 1;
+            }
+            //  Multiple register loads and stores; bit i of the register
+            //  mask stands for register _MultipleTransferRegisters[i]. The
+            //  base register is known to be valid, else the instruction would
+            //  have been left to its handler
+            static const unsigned   _MultipleTransferRegisters[21];
+            template <ByteOrder GuestByteOrder>
+            unsigned            _executeLdm(const _DecodedInstruction & decodedInstruction)
+            {
+                uint64_t address = _r[decodedInstruction.r1];
+                unsigned numLoadedRegisters = 0;
+                for (unsigned i = 0; i < 21; i++)
+                {   //  Load registers with lower numbers at lower addresses
+                    if ((decodedInstruction.imm & (UINT64_C(0x01) << i)) != 0)
+                    {
+                        uint64_t value = 0;
+                        if (!_loadLongWord<GuestByteOrder>(address + (numLoadedRegisters++ << 3), value))
+                        {
+                            return 1 + numLoadedRegisters;
+                        }
+                        _r[_MultipleTransferRegisters[i]] = value;
+                    }
+                }
+                _r[decodedInstruction.r1] = address + (numLoadedRegisters << 3);
+                return decodedInstruction.cycles;
+            }
+            template <ByteOrder GuestByteOrder>
+            unsigned            _executeStm(const _DecodedInstruction & decodedInstruction)
+            {
+                uint64_t address = _r[decodedInstruction.r1];
+                unsigned numStoredRegisters = 0;
+                for (unsigned i = 21; i-- > 0; )
+                {   //  Store registers with higher numbers at higher addresses
+                    if ((decodedInstruction.imm & (UINT64_C(0x01) << i)) != 0)
+                    {
+                        numStoredRegisters++;
+                        if (!_storeLongWord<GuestByteOrder>(address - (numStoredRegisters << 3), _r[_MultipleTransferRegisters[i]]))
+                        {
+                            return 1 + numStoredRegisters;
+                        }
+                    }
+                }
+                _r[decodedInstruction.r1] = address - (numStoredRegisters << 3);
+                return decodedInstruction.cycles;
+            }
+            //  Conditional branches; "Condition" tells whether the branch
+            //  is taken for the given $r1 and $r2 (or immediate) operands
+            template <bool (*Condition)(uint64_t op1, uint64_t op2)>
+            unsigned            _executeBranch(const _DecodedInstruction & decodedInstruction)
+            {
+                if (Condition(_r[decodedInstruction.r1], _r[decodedInstruction.r2]))
+                {
+                    _r[_IpRegister] += decodedInstruction.imm;
+                    _countPerformanceEvent(PerformanceEvent::TakenBranches);
+                }
+                return decodedInstruction.cycles;
+            }
+            static bool         _isEqual(uint64_t op1, uint64_t op2) { return op1 == op2; }
+            static bool         _isNotEqual(uint64_t op1, uint64_t op2) { return op1 != op2; }
+            static bool         _isLess(uint64_t op1, uint64_t op2) { return static_cast<int64_t>(op1) < static_cast<int64_t>(op2); }
+            static bool         _isLessOrEqual(uint64_t op1, uint64_t op2) { return static_cast<int64_t>(op1) <= static_cast<int64_t>(op2); }
+            static bool         _isGreater(uint64_t op1, uint64_t op2) { return static_cast<int64_t>(op1) > static_cast<int64_t>(op2); }
+            static bool         _isGreaterOrEqual(uint64_t op1, uint64_t op2) { return static_cast<int64_t>(op1) >= static_cast<int64_t>(op2); }
+            static bool         _isLessUnsigned(uint64_t op1, uint64_t op2) { return op1 < op2; }
+            static bool         _isLessOrEqualUnsigned(uint64_t op1, uint64_t op2) { return op1 <= op2; }
+            static bool         _isGreaterUnsigned(uint64_t op1, uint64_t op2) { return op1 > op2; }
+            static bool         _isGreaterOrEqualUnsigned(uint64_t op1, uint64_t op2) { return op1 >= op2; }
+            unsigned            _executeJ(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[_IpRegister] += decodedInstruction.imm;
+                _countPerformanceEvent(PerformanceEvent::TakenBranches);
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeJal(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[_RaRegister] = _r[_IpRegister];
+                _r[_IpRegister] += decodedInstruction.imm;
+                _countPerformanceEvent(PerformanceEvent::TakenBranches);
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeJr(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[_IpRegister] = _r[decodedInstruction.r1];
+                _countPerformanceEvent(PerformanceEvent::TakenBranches);
+                return decodedInstruction.cycles;
+            }
+            unsigned            _executeJalr(const _DecodedInstruction & decodedInstruction)
+            {
+                _r[_RaRegister] = _r[_IpRegister];
+                _r[_IpRegister] = _r[decodedInstruction.r1];
+                _countPerformanceEvent(PerformanceEvent::TakenBranches);
+                return decodedInstruction.cycles;
+            }
+
+            //  Helpers (fused superinstructions). A fused executor is called
+            //  with $ip and $cc set up for the 1st instruction of the run, and
+            //  advances them before each next one, as the dispatch would. An
+            //  executor that can neither raise an interrupt nor jump needs no
+            //  check after it; the idiom matcher never fuses an instruction
+            //  that writes $ip other than as the last one of the run
+            template <_DecodedInstructionHandler Executor>
+            static constexpr bool   _mayInterruptOrJump()
+            {
+                return !(Executor == &ProcessorCore::_executeLiL ||
+                         Executor == &ProcessorCore::_executeMovL ||
+                         Executor == &ProcessorCore::_executeNop ||
+                         Executor == &ProcessorCore::_executeAndL ||
+                         Executor == &ProcessorCore::_executeOrL ||
+                         Executor == &ProcessorCore::_executeXorL ||
+                         Executor == &ProcessorCore::_executeAndiL ||
+                         Executor == &ProcessorCore::_executeOriL ||
+                         Executor == &ProcessorCore::_executeXoriL ||
+                         Executor == &ProcessorCore::_executeSeqL ||
+                         Executor == &ProcessorCore::_executeSltL ||
+                         Executor == &ProcessorCore::_executeSltUL ||
+                         Executor == &ProcessorCore::_executeSeqiL ||
+                         Executor == &ProcessorCore::_executeSltiL);
+            }
+            bool                _continuesFusedRun(uint64_t nextIp, uint64_t state) const
+            {
+                return _r[_IpRegister] == nextIp &&
+                       _state == state &&
+                       !_basicBlockInvalidationPending.load(std::memory_order_relaxed);
+            }
+            template <_DecodedInstructionHandler Executor, _DecodedInstructionHandler... MoreExecutors>
+            unsigned            _executeFusedSteps(const _DecodedInstruction * run, uint64_t state)
+            {
+                if constexpr (sizeof...(MoreExecutors) == 0)
+                {
+                    return (this->*Executor)(*run);
+                }
+                else
+                {
+                    uint64_t nextIp = _r[_IpRegister];
+                    unsigned cycles = (this->*Executor)(*run);
+                    if constexpr (_mayInterruptOrJump<Executor>())
+                    {
+                        if (!_continuesFusedRun(nextIp, state))
+                        {
+                            return cycles;
+                        }
+                    }
+                    _r[_IpRegister] = nextIp + 4;
+                    _cc++;
+                    return cycles + _executeFusedSteps<MoreExecutors...>(run + 1, state);
+                }
+            }
+            //  A fixed sequence consists of single-cycle instructions, so the
+            //  caller only runs it if all of it fits in "maxCycles"
+            template <_DecodedInstructionHandler... Executors>
+            unsigned            _executeFusedSequence(const _DecodedInstruction * run, unsigned /*length*/, unsigned /*maxCycles*/)
+            {
+                return _executeFusedSteps<Executors...>(run, _state);
+            }
+            //  A repetition (of loads or stores, mostly) stops as soon as it
+            //  has taken "maxCycles"
+            template <_DecodedInstructionHandler Executor1, _DecodedInstructionHandler Executor2, _DecodedInstructionHandler Terminator>
+            unsigned            _executeFusedRepetition(const _DecodedInstruction * run, unsigned length, unsigned maxCycles)
+            {
+                uint64_t state = _state;
+                unsigned cycles = 0;
+                for (const _DecodedInstruction * end = run + length; ; )
+                {
+                    uint64_t nextIp = _r[_IpRegister];
+                    if (run->executor == Executor1)
+                    {
+                        cycles += (this->*Executor1)(*run);
+                    }
+                    else if (run->executor == Executor2)
+                    {
+                        cycles += (this->*Executor2)(*run);
+                    }
+                    else if constexpr (Terminator != nullptr)
+                    {
+                        cycles += (this->*Terminator)(*run);
+                    }
+                    if (++run == end || cycles >= maxCycles || !_continuesFusedRun(nextIp, state))
+                    {
+                        return cycles;
+                    }
+                    _r[_IpRegister] = nextIp + 4;
+                    _cc++;
+                }
+            }
+            template <_DecodedInstructionHandler... Executors>
+            static constexpr _FusedIdiom    _fusedSequence()
+            {
+                static_assert(sizeof...(Executors) >= 2 && sizeof...(Executors) <= _MaxFusedIdiomLength);
+                return { { Executors... }, false, &ProcessorCore::_executeFusedSequence<Executors...> };
+            }
+            template <_DecodedInstructionHandler Executor1, _DecodedInstructionHandler Executor2, _DecodedInstructionHandler Terminator>
+            static constexpr _FusedIdiom    _fusedRepetition()
+            {
+                return { { Executor1, Executor2, Terminator }, true, &ProcessorCore::_executeFusedRepetition<Executor1, Executor2, Terminator> };
+            }
+
+            //  Dispatch tables
+            template <ByteOrder GuestByteOrder>
+            static const _InstructionHandler    _PrimaryDispatchTable[64];
+            static const _InstructionHandler    _Cop1DispatchTable[32];
+            static const _InstructionHandler    _Shift1DispatchTable[32];
+            static const _InstructionHandler    _Shift2DispatchTable[32];
+            static const _InstructionHandler    _Base1DispatchTable[64];
+            static const _InstructionHandler    _Base2DispatchTable[64];
+            static const _InstructionHandler    _Base3DispatchTable[64];
+            static const _InstructionHandler    _Base4DispatchTable[32];
+            static const _InstructionHandler    _Base5DispatchTable[64];
+            static const _InstructionHandler    _Fp1DispatchTable[64];
+
+            //  Helpers (clock ticks)
+            void                _runClockTick(unsigned maxCycles);
+
+            //  Helpers (threaded execution engine)
+            static const unsigned   _ThreadedQuantum = 256; //  max clock cycles per _runThreaded() call
+            unsigned            _runThreaded(unsigned maxCycles);
+
+            //  Translating execution engine. Hot basic blocks are translated
+            //  to x86-64 code, which the threaded engine runs in place of the
+            //  predecoded instructions. The translation does the simple integer
+            //  instructions and the flow control inline and calls the executor
+            //  or handler of every other instruction, much as the threaded
+            //  engine does; it leaves back to the threaded engine when the
+            //  quantum is over, when an instruction raises an interrupt or
+            //  stores into code, and when control flows to a basic block that
+            //  is not linked and translated. See ProcessorCore.Translated.cpp.
+            //  The translations live in a per-core code cache, which is flushed
+            //  as a whole when full; a translation dropped with its basic block
+            //  is never entered again, as the links to it are stale by then
+            typedef uint64_t (*_TranslatedCodeEntry)(ProcessorCore * core, const uint8_t * code, uint64_t cyclesTaken, uint64_t maxCycles);
+            static const size_t     _CodeCacheSize = 4 * 1024 * 1024;
+
+            X64CodeCache *      _codeCache;         //  nullptr == not translating yet
+            _TranslatedCodeEntry    _translatedCodeEntry;   //  ...at the start of _codeCache; nullptr == host can't run translations
+            const uint8_t *     _translatedCodeReturn;  //  ...from _translatedCodeEntry
+            size_t              _translatedCodeEntrySize;   //  ...in bytes, with the return
+            uint64_t            _translatedCodeState;   //  $state the translated code runs with
+            uint64_t            _translatedCodeItc;     //  $itc the translated code started with
+            const _DecodedInstruction * _translatedCodeExit;    //  ...of the interpreter to go on from; nullptr == switch basic block
+
+            bool                _translateBasicBlock(_BasicBlock * basicBlock);
+            void                _emitBasicBlockTranslation(X64Emitter & emitter, _BasicBlock * basicBlock);
+            bool                _startTranslating();
+            void                _flushCodeCache();
+            unsigned            _runTranslatedCode(unsigned cyclesTaken, unsigned maxCycles);
+
+            //  Called by the translated code for the instructions it does not
+            //  do inline; these return the clock cycles taken in bits 0..31 and
+            //  a non-0 bit 32 if the translated code must leave
+            template <_DecodedInstructionHandler Executor>
+            static uint64_t     _callFromTranslatedCode(ProcessorCore * core, const _DecodedInstruction * decodedInstruction);
+
+            //  Helpers (instruction execution)
+            unsigned            _fetchAndExecuteInstruction();
+            unsigned            _handleInvalidInstruction(uint32_t instruction);
+            unsigned            _handleCop1(uint32_t instruction);
+            unsigned            _handleShift1(uint32_t instruction);
+            unsigned            _handleShift2(uint32_t instruction);
+            unsigned            _handleBase1(uint32_t instruction);
+            unsigned            _handleBase2(uint32_t instruction);
+            unsigned            _handleBase3(uint32_t instruction);
+            unsigned            _handleBase4(uint32_t instruction);
+            unsigned            _handleBase5(uint32_t instruction);
+            unsigned            _handleFp1(uint32_t instruction);
 
-            //  Helpers (instruction execution). Each handler returns the
-            //  number of clock cycles taken by instruction execution.
-            //  Can throw ProgramInterrupt, HardwareInterrupt, ForceHalt
-            typedef unsigned (ProcessorCore::*_InstructionHandler)(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-
-            unsigned            _fetchAndExecuteInstruction() throws(ProgramInterrupt, HardwareInterrupt);
-            Q_NORETURN unsigned _handleInvalidInstruction(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCop1(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShift1(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShift2(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBase1(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBase2(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBase3(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBase4(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBase5(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleFp1(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-
-            //  TODO Add throws(ProgramInterrupt, HardwareInterrupt) to all instruction handlers
             //  BASE (data movement)
-            unsigned            _handleMovL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMovCR(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMovRC(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSwapH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSwapUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSwapW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSwapUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSwapL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleMovL(uint32_t instruction);
+            unsigned            _handleMovCR(uint32_t instruction);
+            unsigned            _handleMovRC(uint32_t instruction);
+            unsigned            _handleMovMR(uint32_t instruction);
+            unsigned            _handleMovRM(uint32_t instruction);
+            unsigned            _handleLiL(uint32_t instruction);
+            unsigned            _handleSwapH(uint32_t instruction);
+            unsigned            _handleSwapUH(uint32_t instruction);
+            unsigned            _handleSwapW(uint32_t instruction);
+            unsigned            _handleSwapUW(uint32_t instruction);
+            unsigned            _handleSwapL(uint32_t instruction);
 
             //  BASE (arithmetic)
             void                _handleIntegerOverflow(bool overflow)
@@ -752,98 +1548,98 @@ namespace hadesvm
                         overflow);
             }
 
-            unsigned            _handleAddB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAbsB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAbsH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAbsW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAbsL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNegB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCpl2UB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNegH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCpl2UH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNegW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCpl2UW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNegL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCpl2UL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddiB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddiUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddiH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddiUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddiW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddiUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubiB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubiUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubiH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubiUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubiW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubiUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMuliB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMuliUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMuliH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMuliUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMuliW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMuliUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMuliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMuliUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDiviB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDiviUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDiviH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDiviUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDiviW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDiviUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDiviL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDiviUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModiB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModiUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModiH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModiUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModiW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModiUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleModiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleAddB(uint32_t instruction);
+            unsigned            _handleAddUB(uint32_t instruction);
+            unsigned            _handleAddH(uint32_t instruction);
+            unsigned            _handleAddUH(uint32_t instruction);
+            unsigned            _handleAddW(uint32_t instruction);
+            unsigned            _handleAddUW(uint32_t instruction);
+            unsigned            _handleAddL(uint32_t instruction);
+            unsigned            _handleAddUL(uint32_t instruction);
+            unsigned            _handleSubB(uint32_t instruction);
+            unsigned            _handleSubUB(uint32_t instruction);
+            unsigned            _handleSubH(uint32_t instruction);
+            unsigned            _handleSubUH(uint32_t instruction);
+            unsigned            _handleSubW(uint32_t instruction);
+            unsigned            _handleSubUW(uint32_t instruction);
+            unsigned            _handleSubL(uint32_t instruction);
+            unsigned            _handleSubUL(uint32_t instruction);
+            unsigned            _handleMulB(uint32_t instruction);
+            unsigned            _handleMulUB(uint32_t instruction);
+            unsigned            _handleMulH(uint32_t instruction);
+            unsigned            _handleMulUH(uint32_t instruction);
+            unsigned            _handleMulW(uint32_t instruction);
+            unsigned            _handleMulUW(uint32_t instruction);
+            unsigned            _handleMulL(uint32_t instruction);
+            unsigned            _handleMulUL(uint32_t instruction);
+            unsigned            _handleDivB(uint32_t instruction);
+            unsigned            _handleDivUB(uint32_t instruction);
+            unsigned            _handleDivH(uint32_t instruction);
+            unsigned            _handleDivUH(uint32_t instruction);
+            unsigned            _handleDivW(uint32_t instruction);
+            unsigned            _handleDivUW(uint32_t instruction);
+            unsigned            _handleDivL(uint32_t instruction);
+            unsigned            _handleDivUL(uint32_t instruction);
+            unsigned            _handleModB(uint32_t instruction);
+            unsigned            _handleModUB(uint32_t instruction);
+            unsigned            _handleModH(uint32_t instruction);
+            unsigned            _handleModUH(uint32_t instruction);
+            unsigned            _handleModW(uint32_t instruction);
+            unsigned            _handleModUW(uint32_t instruction);
+            unsigned            _handleModL(uint32_t instruction);
+            unsigned            _handleModUL(uint32_t instruction);
+            unsigned            _handleAbsB(uint32_t instruction);
+            unsigned            _handleAbsH(uint32_t instruction);
+            unsigned            _handleAbsW(uint32_t instruction);
+            unsigned            _handleAbsL(uint32_t instruction);
+            unsigned            _handleNegB(uint32_t instruction);
+            unsigned            _handleCpl2UB(uint32_t instruction);
+            unsigned            _handleNegH(uint32_t instruction);
+            unsigned            _handleCpl2UH(uint32_t instruction);
+            unsigned            _handleNegW(uint32_t instruction);
+            unsigned            _handleCpl2UW(uint32_t instruction);
+            unsigned            _handleNegL(uint32_t instruction);
+            unsigned            _handleCpl2UL(uint32_t instruction);
+            unsigned            _handleAddiB(uint32_t instruction);
+            unsigned            _handleAddiUB(uint32_t instruction);
+            unsigned            _handleAddiH(uint32_t instruction);
+            unsigned            _handleAddiUH(uint32_t instruction);
+            unsigned            _handleAddiW(uint32_t instruction);
+            unsigned            _handleAddiUW(uint32_t instruction);
+            unsigned            _handleAddiL(uint32_t instruction);
+            unsigned            _handleAddiUL(uint32_t instruction);
+            unsigned            _handleSubiB(uint32_t instruction);
+            unsigned            _handleSubiUB(uint32_t instruction);
+            unsigned            _handleSubiH(uint32_t instruction);
+            unsigned            _handleSubiUH(uint32_t instruction);
+            unsigned            _handleSubiW(uint32_t instruction);
+            unsigned            _handleSubiUW(uint32_t instruction);
+            unsigned            _handleSubiL(uint32_t instruction);
+            unsigned            _handleSubiUL(uint32_t instruction);
+            unsigned            _handleMuliB(uint32_t instruction);
+            unsigned            _handleMuliUB(uint32_t instruction);
+            unsigned            _handleMuliH(uint32_t instruction);
+            unsigned            _handleMuliUH(uint32_t instruction);
+            unsigned            _handleMuliW(uint32_t instruction);
+            unsigned            _handleMuliUW(uint32_t instruction);
+            unsigned            _handleMuliL(uint32_t instruction);
+            unsigned            _handleMuliUL(uint32_t instruction);
+            unsigned            _handleDiviB(uint32_t instruction);
+            unsigned            _handleDiviUB(uint32_t instruction);
+            unsigned            _handleDiviH(uint32_t instruction);
+            unsigned            _handleDiviUH(uint32_t instruction);
+            unsigned            _handleDiviW(uint32_t instruction);
+            unsigned            _handleDiviUW(uint32_t instruction);
+            unsigned            _handleDiviL(uint32_t instruction);
+            unsigned            _handleDiviUL(uint32_t instruction);
+            unsigned            _handleModiB(uint32_t instruction);
+            unsigned            _handleModiUB(uint32_t instruction);
+            unsigned            _handleModiH(uint32_t instruction);
+            unsigned            _handleModiUH(uint32_t instruction);
+            unsigned            _handleModiW(uint32_t instruction);
+            unsigned            _handleModiUW(uint32_t instruction);
+            unsigned            _handleModiL(uint32_t instruction);
+            unsigned            _handleModiUL(uint32_t instruction);
 
             //  BASE (boolean)
             template <class DataType>
@@ -894,131 +1690,131 @@ namespace hadesvm
                 result = DataType::normalizeUnsigned(~op1 | op2);
             }
 
-            unsigned            _handleAndB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAndUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAndH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAndUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAndW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAndUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAndL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOrB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOrUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOrH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOrUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOrW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOrUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOrL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleXorB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleXorUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleXorH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleXorUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleXorW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleXorUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleXorL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleImplB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleImplUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleImplH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleImplUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleImplW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleImplUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleImplL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAndiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleXoriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleImpliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNotB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNotUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNotH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNotUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNotW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNotUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNotL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleAndB(uint32_t instruction);
+            unsigned            _handleAndUB(uint32_t instruction);
+            unsigned            _handleAndH(uint32_t instruction);
+            unsigned            _handleAndUH(uint32_t instruction);
+            unsigned            _handleAndW(uint32_t instruction);
+            unsigned            _handleAndUW(uint32_t instruction);
+            unsigned            _handleAndL(uint32_t instruction);
+            unsigned            _handleOrB(uint32_t instruction);
+            unsigned            _handleOrUB(uint32_t instruction);
+            unsigned            _handleOrH(uint32_t instruction);
+            unsigned            _handleOrUH(uint32_t instruction);
+            unsigned            _handleOrW(uint32_t instruction);
+            unsigned            _handleOrUW(uint32_t instruction);
+            unsigned            _handleOrL(uint32_t instruction);
+            unsigned            _handleXorB(uint32_t instruction);
+            unsigned            _handleXorUB(uint32_t instruction);
+            unsigned            _handleXorH(uint32_t instruction);
+            unsigned            _handleXorUH(uint32_t instruction);
+            unsigned            _handleXorW(uint32_t instruction);
+            unsigned            _handleXorUW(uint32_t instruction);
+            unsigned            _handleXorL(uint32_t instruction);
+            unsigned            _handleImplB(uint32_t instruction);
+            unsigned            _handleImplUB(uint32_t instruction);
+            unsigned            _handleImplH(uint32_t instruction);
+            unsigned            _handleImplUH(uint32_t instruction);
+            unsigned            _handleImplW(uint32_t instruction);
+            unsigned            _handleImplUW(uint32_t instruction);
+            unsigned            _handleImplL(uint32_t instruction);
+            unsigned            _handleAndiL(uint32_t instruction);
+            unsigned            _handleOriL(uint32_t instruction);
+            unsigned            _handleXoriL(uint32_t instruction);
+            unsigned            _handleImpliL(uint32_t instruction);
+            unsigned            _handleNotB(uint32_t instruction);
+            unsigned            _handleNotUB(uint32_t instruction);
+            unsigned            _handleNotH(uint32_t instruction);
+            unsigned            _handleNotUH(uint32_t instruction);
+            unsigned            _handleNotW(uint32_t instruction);
+            unsigned            _handleNotUW(uint32_t instruction);
+            unsigned            _handleNotL(uint32_t instruction);
 
             //  BASE (shifts)
-            unsigned            _handleShlB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShlUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShlH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShlUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShlW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShlUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShlL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShrB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShrUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShrH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShrUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShrW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShrUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShrL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAslB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAslUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAslH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAslUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAslW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAslUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAslL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsrB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsrUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsrH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsrUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsrW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsrUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsrL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRolB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRolUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRolH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRolUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRolW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRolUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRolL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRorB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRorUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRorH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRorUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRorW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRorUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRorL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShliB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShliUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShliH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShliUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShliW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShliUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShriB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShriUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShriH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShriUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShriW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShriUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleShriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsliB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsliUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsliH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsliUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsliW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsliUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsriB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsriUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsriH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsriUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsriW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsriUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAsriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoliB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoliUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoliH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoliUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoliW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoliUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoliL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoriB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoriUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoriH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoriUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoriW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoriUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRoriL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleShlB(uint32_t instruction);
+            unsigned            _handleShlUB(uint32_t instruction);
+            unsigned            _handleShlH(uint32_t instruction);
+            unsigned            _handleShlUH(uint32_t instruction);
+            unsigned            _handleShlW(uint32_t instruction);
+            unsigned            _handleShlUW(uint32_t instruction);
+            unsigned            _handleShlL(uint32_t instruction);
+            unsigned            _handleShrB(uint32_t instruction);
+            unsigned            _handleShrUB(uint32_t instruction);
+            unsigned            _handleShrH(uint32_t instruction);
+            unsigned            _handleShrUH(uint32_t instruction);
+            unsigned            _handleShrW(uint32_t instruction);
+            unsigned            _handleShrUW(uint32_t instruction);
+            unsigned            _handleShrL(uint32_t instruction);
+            unsigned            _handleAslB(uint32_t instruction);
+            unsigned            _handleAslUB(uint32_t instruction);
+            unsigned            _handleAslH(uint32_t instruction);
+            unsigned            _handleAslUH(uint32_t instruction);
+            unsigned            _handleAslW(uint32_t instruction);
+            unsigned            _handleAslUW(uint32_t instruction);
+            unsigned            _handleAslL(uint32_t instruction);
+            unsigned            _handleAsrB(uint32_t instruction);
+            unsigned            _handleAsrUB(uint32_t instruction);
+            unsigned            _handleAsrH(uint32_t instruction);
+            unsigned            _handleAsrUH(uint32_t instruction);
+            unsigned            _handleAsrW(uint32_t instruction);
+            unsigned            _handleAsrUW(uint32_t instruction);
+            unsigned            _handleAsrL(uint32_t instruction);
+            unsigned            _handleRolB(uint32_t instruction);
+            unsigned            _handleRolUB(uint32_t instruction);
+            unsigned            _handleRolH(uint32_t instruction);
+            unsigned            _handleRolUH(uint32_t instruction);
+            unsigned            _handleRolW(uint32_t instruction);
+            unsigned            _handleRolUW(uint32_t instruction);
+            unsigned            _handleRolL(uint32_t instruction);
+            unsigned            _handleRorB(uint32_t instruction);
+            unsigned            _handleRorUB(uint32_t instruction);
+            unsigned            _handleRorH(uint32_t instruction);
+            unsigned            _handleRorUH(uint32_t instruction);
+            unsigned            _handleRorW(uint32_t instruction);
+            unsigned            _handleRorUW(uint32_t instruction);
+            unsigned            _handleRorL(uint32_t instruction);
+            unsigned            _handleShliB(uint32_t instruction);
+            unsigned            _handleShliUB(uint32_t instruction);
+            unsigned            _handleShliH(uint32_t instruction);
+            unsigned            _handleShliUH(uint32_t instruction);
+            unsigned            _handleShliW(uint32_t instruction);
+            unsigned            _handleShliUW(uint32_t instruction);
+            unsigned            _handleShliL(uint32_t instruction);
+            unsigned            _handleShriB(uint32_t instruction);
+            unsigned            _handleShriUB(uint32_t instruction);
+            unsigned            _handleShriH(uint32_t instruction);
+            unsigned            _handleShriUH(uint32_t instruction);
+            unsigned            _handleShriW(uint32_t instruction);
+            unsigned            _handleShriUW(uint32_t instruction);
+            unsigned            _handleShriL(uint32_t instruction);
+            unsigned            _handleAsliB(uint32_t instruction);
+            unsigned            _handleAsliUB(uint32_t instruction);
+            unsigned            _handleAsliH(uint32_t instruction);
+            unsigned            _handleAsliUH(uint32_t instruction);
+            unsigned            _handleAsliW(uint32_t instruction);
+            unsigned            _handleAsliUW(uint32_t instruction);
+            unsigned            _handleAsliL(uint32_t instruction);
+            unsigned            _handleAsriB(uint32_t instruction);
+            unsigned            _handleAsriUB(uint32_t instruction);
+            unsigned            _handleAsriH(uint32_t instruction);
+            unsigned            _handleAsriUH(uint32_t instruction);
+            unsigned            _handleAsriW(uint32_t instruction);
+            unsigned            _handleAsriUW(uint32_t instruction);
+            unsigned            _handleAsriL(uint32_t instruction);
+            unsigned            _handleRoliB(uint32_t instruction);
+            unsigned            _handleRoliUB(uint32_t instruction);
+            unsigned            _handleRoliH(uint32_t instruction);
+            unsigned            _handleRoliUH(uint32_t instruction);
+            unsigned            _handleRoliW(uint32_t instruction);
+            unsigned            _handleRoliUW(uint32_t instruction);
+            unsigned            _handleRoliL(uint32_t instruction);
+            unsigned            _handleRoriB(uint32_t instruction);
+            unsigned            _handleRoriUB(uint32_t instruction);
+            unsigned            _handleRoriH(uint32_t instruction);
+            unsigned            _handleRoriUH(uint32_t instruction);
+            unsigned            _handleRoriW(uint32_t instruction);
+            unsigned            _handleRoriUW(uint32_t instruction);
+            unsigned            _handleRoriL(uint32_t instruction);
 
             //  BASE (bit manipulation)
             template <class DataType>
@@ -1033,140 +1829,152 @@ namespace hadesvm
                 result = DataType::normalizeUnsigned(DataType::reverseBits(op));
             }
 
-            unsigned            _handleClz(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCtz(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleClo(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCto(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBfeL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBfeUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBfiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBrevB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBrevUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBrevH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBrevUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBrevW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBrevUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBrevL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleClz(uint32_t instruction);
+            unsigned            _handleCtz(uint32_t instruction);
+            unsigned            _handleClo(uint32_t instruction);
+            unsigned            _handleCto(uint32_t instruction);
+            unsigned            _handleBfeL(uint32_t instruction);
+            unsigned            _handleBfeUL(uint32_t instruction);
+            unsigned            _handleBfiL(uint32_t instruction);
+            unsigned            _handleBrevB(uint32_t instruction);
+            unsigned            _handleBrevUB(uint32_t instruction);
+            unsigned            _handleBrevH(uint32_t instruction);
+            unsigned            _handleBrevUH(uint32_t instruction);
+            unsigned            _handleBrevW(uint32_t instruction);
+            unsigned            _handleBrevUW(uint32_t instruction);
+            unsigned            _handleBrevL(uint32_t instruction);
 
             //  BASE (conversions)
-            unsigned            _handleCvtBL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtUBL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtHL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtUHL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtWL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtUWL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleCvtBL(uint32_t instruction);
+            unsigned            _handleCvtUBL(uint32_t instruction);
+            unsigned            _handleCvtHL(uint32_t instruction);
+            unsigned            _handleCvtUHL(uint32_t instruction);
+            unsigned            _handleCvtWL(uint32_t instruction);
+            unsigned            _handleCvtUWL(uint32_t instruction);
 
             //  BASE (comparison)
-            unsigned            _handleSeqL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSneL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSltL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSleL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgtL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgeL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSltUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSleUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgtUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgeUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSeqiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSneiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSltiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSleiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgtiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgeiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSltiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSleiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgtiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgeiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleSeqL(uint32_t instruction);
+            unsigned            _handleSneL(uint32_t instruction);
+            unsigned            _handleSltL(uint32_t instruction);
+            unsigned            _handleSleL(uint32_t instruction);
+            unsigned            _handleSgtL(uint32_t instruction);
+            unsigned            _handleSgeL(uint32_t instruction);
+            unsigned            _handleSltUL(uint32_t instruction);
+            unsigned            _handleSleUL(uint32_t instruction);
+            unsigned            _handleSgtUL(uint32_t instruction);
+            unsigned            _handleSgeUL(uint32_t instruction);
+            unsigned            _handleSeqiL(uint32_t instruction);
+            unsigned            _handleSneiL(uint32_t instruction);
+            unsigned            _handleSltiL(uint32_t instruction);
+            unsigned            _handleSleiL(uint32_t instruction);
+            unsigned            _handleSgtiL(uint32_t instruction);
+            unsigned            _handleSgeiL(uint32_t instruction);
+            unsigned            _handleSltiUL(uint32_t instruction);
+            unsigned            _handleSleiUL(uint32_t instruction);
+            unsigned            _handleSgtiUL(uint32_t instruction);
+            unsigned            _handleSgeiUL(uint32_t instruction);
 
             //  BASE (load/store)
-            unsigned            _handleLB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleXchg(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLir(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLdm(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleStm(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleLB(uint32_t instruction);
+            unsigned            _handleLUB(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleLH(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleLUH(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleLW(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleLUW(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleLL(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleXchg(uint32_t instruction);
+            unsigned            _handleSB(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleSH(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleSW(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleSL(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleLir(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleLdm(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleStm(uint32_t instruction);
 
             //  BASE (flow control)
-            unsigned            _handleJ(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleJal(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleJr(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleJalr(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBeqL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBneL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBltL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBleL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgtL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgeL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBltUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBleUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgtUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgeUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBeqiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBneiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBltiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBleiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgtiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgeiL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBltiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBleiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgtiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgeiUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleJ(uint32_t instruction);
+            unsigned            _handleJal(uint32_t instruction);
+            unsigned            _handleJr(uint32_t instruction);
+            unsigned            _handleJalr(uint32_t instruction);
+            unsigned            _handleBeqL(uint32_t instruction);
+            unsigned            _handleBneL(uint32_t instruction);
+            unsigned            _handleBltL(uint32_t instruction);
+            unsigned            _handleBleL(uint32_t instruction);
+            unsigned            _handleBgtL(uint32_t instruction);
+            unsigned            _handleBgeL(uint32_t instruction);
+            unsigned            _handleBltUL(uint32_t instruction);
+            unsigned            _handleBleUL(uint32_t instruction);
+            unsigned            _handleBgtUL(uint32_t instruction);
+            unsigned            _handleBgeUL(uint32_t instruction);
+            unsigned            _handleBeqiL(uint32_t instruction);
+            unsigned            _handleBneiL(uint32_t instruction);
+            unsigned            _handleBltiL(uint32_t instruction);
+            unsigned            _handleBleiL(uint32_t instruction);
+            unsigned            _handleBgtiL(uint32_t instruction);
+            unsigned            _handleBgeiL(uint32_t instruction);
+            unsigned            _handleBltiUL(uint32_t instruction);
+            unsigned            _handleBleiUL(uint32_t instruction);
+            unsigned            _handleBgtiUL(uint32_t instruction);
+            unsigned            _handleBgeiUL(uint32_t instruction);
 
             //  BASE (TLB control)
-            unsigned            _handleIitlb(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleIdtlb(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleIitlbe(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleIdtlbe(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleIitlbc(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleIdtlbc(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleIitlbec(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleIdtlbec(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleIitlb(uint32_t instruction);
+            unsigned            _handleIdtlb(uint32_t instruction);
+            unsigned            _handleIitlbe(uint32_t instruction);
+            unsigned            _handleIdtlbe(uint32_t instruction);
+            unsigned            _handleIitlbc(uint32_t instruction);
+            unsigned            _handleIdtlbc(uint32_t instruction);
+            unsigned            _handleIitlbec(uint32_t instruction);
+            unsigned            _handleIdtlbec(uint32_t instruction);
 
             //  BASE (cache control)
-            unsigned            _handleImb(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDmb(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleImbc(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDmbc(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleImb(uint32_t instruction);
+            unsigned            _handleDmb(uint32_t instruction);
+            unsigned            _handleImbc(uint32_t instruction);
+            unsigned            _handleDmbc(uint32_t instruction);
 
             //  BASE (I/O)
-            unsigned            _handleInB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleInUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleInH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleInUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleInW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleInUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleInL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOutB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOutH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOutW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleOutL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleTstp(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSetp(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleInB(uint32_t instruction);
+            unsigned            _handleInUB(uint32_t instruction);
+            unsigned            _handleInH(uint32_t instruction);
+            unsigned            _handleInUH(uint32_t instruction);
+            unsigned            _handleInW(uint32_t instruction);
+            unsigned            _handleInUW(uint32_t instruction);
+            unsigned            _handleInL(uint32_t instruction);
+            unsigned            _handleOutB(uint32_t instruction);
+            unsigned            _handleOutH(uint32_t instruction);
+            unsigned            _handleOutW(uint32_t instruction);
+            unsigned            _handleOutL(uint32_t instruction);
+            unsigned            _handleTstp(uint32_t instruction);
+            unsigned            _handleSetp(uint32_t instruction);
 
             //  BASE (Misc)
-            unsigned            _handleHalt(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleIret(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleGetfl(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSetfl(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleRstfl(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSvc(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBrk(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCpuid(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSigp(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNop(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleHalt(uint32_t instruction);
+            unsigned            _handleIret(uint32_t instruction);
+            unsigned            _handleGetfl(uint32_t instruction);
+            unsigned            _handleSetfl(uint32_t instruction);
+            unsigned            _handleRstfl(uint32_t instruction);
+            unsigned            _handleSvc(uint32_t instruction);
+            unsigned            _handleBrk(uint32_t instruction);
+            unsigned            _handleCpuid(uint32_t instruction);
+            unsigned            _handleSigp(uint32_t instruction);
+            unsigned            _handleNop(uint32_t instruction);
 
             //  FLOATING POINT (data movement)
-            unsigned            _handleMovD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLiD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleMovD(uint32_t instruction);
+            unsigned            _handleLiD(uint32_t instruction);
 
             //  FLOATING POINT (arithmetics)
             void                _handleFloatingPointConditions(const hadesvm::ieee754::Environment & fpEnvironment)
@@ -1192,107 +2000,129 @@ namespace hadesvm
                 {
                     _flags.setRealInexactFlag();
                 }
-                //  ...and raise exceptions
+                //  ...and raise the 1st enabled exception
                 if ((fpEnvironment.exception | hadesvm::ieee754::Exception::Operand) != hadesvm::ieee754::Exception::None &&
                     _state.isRealOperandExceptionAllowed())
                 {
                     _raiseProgramInterrupt(ProgramInterrupt::FOPERAND);
+                    return;
                 }
                 if ((fpEnvironment.exception | hadesvm::ieee754::Exception::DivisionByZero) != hadesvm::ieee754::Exception::None &&
                     _state.isRealDivisionByZeroExceptionAllowed())
                 {
                     _raiseProgramInterrupt(ProgramInterrupt::FZDIV);
+                    return;
                 }
                 if ((fpEnvironment.exception | hadesvm::ieee754::Exception::Overflow) != hadesvm::ieee754::Exception::None &&
                     _state.isRealOverflowExceptionAllowed())
                 {
                     _raiseProgramInterrupt(ProgramInterrupt::FOVERFLOW);
+                    return;
                 }
                 if ((fpEnvironment.exception | hadesvm::ieee754::Exception::Underflow) != hadesvm::ieee754::Exception::None &&
                     _state.isRealUnderflowExceptionAllowed())
                 {
                     _raiseProgramInterrupt(ProgramInterrupt::FUNDERFLOW);
+                    return;
                 }
                 if ((fpEnvironment.exception | hadesvm::ieee754::Exception::Inexact) != hadesvm::ieee754::Exception::None &&
                     _state.isRealInexactExceptionAllowed())
                 {
                     _raiseProgramInterrupt(ProgramInterrupt::FINEXACT);
+                    return;
                 }
             }
 
-            unsigned            _handleAddF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAddD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSubD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleMulD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleDivD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAbsF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleAbsD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNegF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleNegD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSqrtF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSqrtD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleAddF(uint32_t instruction);
+            unsigned            _handleAddD(uint32_t instruction);
+            unsigned            _handleSubF(uint32_t instruction);
+            unsigned            _handleSubD(uint32_t instruction);
+            unsigned            _handleMulF(uint32_t instruction);
+            unsigned            _handleMulD(uint32_t instruction);
+            unsigned            _handleDivF(uint32_t instruction);
+            unsigned            _handleDivD(uint32_t instruction);
+            unsigned            _handleAbsF(uint32_t instruction);
+            unsigned            _handleAbsD(uint32_t instruction);
+            unsigned            _handleNegF(uint32_t instruction);
+            unsigned            _handleNegD(uint32_t instruction);
+            unsigned            _handleSqrtF(uint32_t instruction);
+            unsigned            _handleSqrtD(uint32_t instruction);
 
             //  FLOATING POINT (conversions)
-            unsigned            _handleCvtFB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtFUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtFH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtFUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtFW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtFUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtFL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtFUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtDB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtDUB(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtDH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtDUH(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtDW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtDUW(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtDL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtDUL(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtBF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtUBF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtHF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtUHF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtWF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtUWF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtLF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtULF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtBD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtUBD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtHD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtUHD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtWD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtUWD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtLD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtULD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleCvtDF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleCvtFB(uint32_t instruction);
+            unsigned            _handleCvtFUB(uint32_t instruction);
+            unsigned            _handleCvtFH(uint32_t instruction);
+            unsigned            _handleCvtFUH(uint32_t instruction);
+            unsigned            _handleCvtFW(uint32_t instruction);
+            unsigned            _handleCvtFUW(uint32_t instruction);
+            unsigned            _handleCvtFL(uint32_t instruction);
+            unsigned            _handleCvtFUL(uint32_t instruction);
+            unsigned            _handleCvtDB(uint32_t instruction);
+            unsigned            _handleCvtDUB(uint32_t instruction);
+            unsigned            _handleCvtDH(uint32_t instruction);
+            unsigned            _handleCvtDUH(uint32_t instruction);
+            unsigned            _handleCvtDW(uint32_t instruction);
+            unsigned            _handleCvtDUW(uint32_t instruction);
+            unsigned            _handleCvtDL(uint32_t instruction);
+            unsigned            _handleCvtDUL(uint32_t instruction);
+            unsigned            _handleCvtBF(uint32_t instruction);
+            unsigned            _handleCvtUBF(uint32_t instruction);
+            unsigned            _handleCvtHF(uint32_t instruction);
+            unsigned            _handleCvtUHF(uint32_t instruction);
+            unsigned            _handleCvtWF(uint32_t instruction);
+            unsigned            _handleCvtUWF(uint32_t instruction);
+            unsigned            _handleCvtLF(uint32_t instruction);
+            unsigned            _handleCvtULF(uint32_t instruction);
+            unsigned            _handleCvtBD(uint32_t instruction);
+            unsigned            _handleCvtUBD(uint32_t instruction);
+            unsigned            _handleCvtHD(uint32_t instruction);
+            unsigned            _handleCvtUHD(uint32_t instruction);
+            unsigned            _handleCvtWD(uint32_t instruction);
+            unsigned            _handleCvtUWD(uint32_t instruction);
+            unsigned            _handleCvtLD(uint32_t instruction);
+            unsigned            _handleCvtULD(uint32_t instruction);
+            unsigned            _handleCvtDF(uint32_t instruction);
 
             //  FLOATING POINT (comparison)
-            unsigned            _handleSeqD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSneD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSltD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSleD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgtD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSgeD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleSeqD(uint32_t instruction);
+            unsigned            _handleSneD(uint32_t instruction);
+            unsigned            _handleSltD(uint32_t instruction);
+            unsigned            _handleSleD(uint32_t instruction);
+            unsigned            _handleSgtD(uint32_t instruction);
+            unsigned            _handleSgeD(uint32_t instruction);
 
             //  FLOATING POINT (load/store)
-            unsigned            _handleLF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleLD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSF(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleSD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleLF(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleLD(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleSF(uint32_t instruction);
+            template <ByteOrder GuestByteOrder>
+            unsigned            _handleSD(uint32_t instruction);
 
             //  FLOATING POINT (flow control)
-            unsigned            _handleBeqD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBneD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBltD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBleD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgtD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
-            unsigned            _handleBgeD(uint32_t instruction) throws(ProgramInterrupt, HardwareInterrupt);
+            unsigned            _handleBeqD(uint32_t instruction);
+            unsigned            _handleBneD(uint32_t instruction);
+            unsigned            _handleBltD(uint32_t instruction);
+            unsigned            _handleBleD(uint32_t instruction);
+            unsigned            _handleBgtD(uint32_t instruction);
+            unsigned            _handleBgeD(uint32_t instruction);
         };
     }
 }
 
+namespace hadesvm
+{
+    namespace util
+    {
+        //////////
+        //  Formatting and parsing
+        HADESVM_CEREON_PUBLIC QString toString(hadesvm::cereon::ExecutionEngine value);
+
+        template <>
+        HADESVM_CEREON_PUBLIC bool fromString<hadesvm::cereon::ExecutionEngine>(const QString & s, qsizetype & scan, hadesvm::cereon::ExecutionEngine & value);
+    }
+}
+
 //  End of hadesvm-cereon/ProcessorCore.hpp
@@ -25,6 +25,11 @@ ProcessorEditor::ProcessorEditor(Processor * processor)
     _ui->clockUnitComboBox->addItem("MHz", QVariant::fromValue(static_cast<uint64_t>(hadesvm::core::ClockFrequency::Unit::MHz)));
     _ui->clockUnitComboBox->addItem("GHz", QVariant::fromValue(static_cast<uint64_t>(hadesvm::core::ClockFrequency::Unit::GHz)));
     _ui->clockUnitComboBox->setCurrentIndex(2);  //  MB
+
+    //  Fill in the "execution engine" combo box
+    _ui->executionEngineComboBox->addItem("Reference", QVariant::fromValue(static_cast<int>(ExecutionEngine::Reference)));
+    _ui->executionEngineComboBox->addItem("Threaded", QVariant::fromValue(static_cast<int>(ExecutionEngine::Threaded)));
+    _ui->executionEngineComboBox->addItem("Translated", QVariant::fromValue(static_cast<int>(ExecutionEngine::Translated)));
 }
 
 ProcessorEditor::~ProcessorEditor()
@@ -45,6 +50,14 @@ void ProcessorEditor::loadComponentConfiguration()
     _ui->bigEndianRadioButton->setChecked(_processor->byteOrder() == hadesvm::util::ByteOrder::BigEndian);
     _ui->littleEndianRadioButton->setChecked(_processor->byteOrder() == hadesvm::util::ByteOrder::LittleEndian);
     _ui->restartAddressLineEdit->setText(hadesvm::util::toString(_processor->restartAddress(), "%016X"));
+    _ui->executionEngineComboBox->setCurrentIndex(
+        _ui->executionEngineComboBox->findData(QVariant::fromValue(static_cast<int>(_processor->executionEngine()))));
+    _ui->parallelCoresCheckBox->setChecked(_processor->parallelCores());
+    _ui->syncQuantumLineEdit->setText(hadesvm::util::toString(_processor->syncQuantum()));
+    _ui->profilingIntervalLineEdit->setText(hadesvm::util::toString(_processor->profilingInterval()));
+    _ui->profileFileLineEdit->setText(_processor->profileFilePath());
+    _ui->profileSymbolsFileLineEdit->setText(_processor->profileSymbolsFilePath());
+    _ui->traceFileLineEdit->setText(_processor->traceFilePath());
 
     _ui->baseCheckBox->setChecked(features.has(Feature::Base));
     _ui->floatingPointCheckBox->setChecked(features.has(Feature::FloatingPoint));
@@ -62,13 +75,22 @@ bool ProcessorEditor::canSaveComponentConfiguration() const
     uint8_t id = 0;
     uint64_t restartAddress = 0;
     uint64_t clockNumberOfUnits = 0;
+    unsigned syncQuantum = 0;
+    unsigned profilingInterval = 0;
 
     return hadesvm::util::fromString(_ui->idLineEdit->text(), "%X", id) &&
            hadesvm::util::fromString(_ui->restartAddressLineEdit->text(), "%X", restartAddress) &&
            restartAddress % 4 == 0 &&
            hadesvm::util::fromString(_ui->clockNumberOfUnitsLineEdit->text(), clockNumberOfUnits) &&
            clockNumberOfUnits > 0 &&
-           _ui->clockUnitComboBox->currentIndex() != -1;
+           _ui->clockUnitComboBox->currentIndex() != -1 &&
+           hadesvm::util::fromString(_ui->syncQuantumLineEdit->text(), syncQuantum) &&
+           syncQuantum >= Processor::MinSyncQuantum &&
+           syncQuantum <= Processor::MaxSyncQuantum &&
+           hadesvm::util::fromString(_ui->profilingIntervalLineEdit->text(), profilingInterval) &&
+           (profilingInterval == 0 ||
+            (profilingInterval >= Processor::MinProfilingInterval &&
+             profilingInterval <= Processor::MaxProfilingInterval));
 }
 
 void ProcessorEditor::saveComponentConfiguration()
@@ -98,6 +120,34 @@ void ProcessorEditor::saveComponentConfiguration()
     {
         _processor->setRestartAddress(restartAddress);
     }
+
+    if (_ui->executionEngineComboBox->currentIndex() != -1)
+    {
+        _processor->setExecutionEngine(static_cast<ExecutionEngine>(_ui->executionEngineComboBox->currentData().toInt()));
+    }
+
+    _processor->setParallelCores(_ui->parallelCoresCheckBox->isChecked());
+
+    unsigned syncQuantum = 0;
+    if (hadesvm::util::fromString(_ui->syncQuantumLineEdit->text(), syncQuantum) &&
+        syncQuantum >= Processor::MinSyncQuantum &&
+        syncQuantum <= Processor::MaxSyncQuantum)
+    {
+        _processor->setSyncQuantum(syncQuantum);
+    }
+
+    unsigned profilingInterval = 0;
+    if (hadesvm::util::fromString(_ui->profilingIntervalLineEdit->text(), profilingInterval) &&
+        (profilingInterval == 0 ||
+         (profilingInterval >= Processor::MinProfilingInterval &&
+          profilingInterval <= Processor::MaxProfilingInterval)))
+    {
+        _processor->setProfilingInterval(profilingInterval);
+    }
+
+    _processor->setProfileFilePath(_ui->profileFileLineEdit->text());
+    _processor->setProfileSymbolsFilePath(_ui->profileSymbolsFileLineEdit->text());
+    _processor->setTraceFilePath(_ui->traceFileLineEdit->text());
 }
 
 //////////
@@ -178,4 +228,39 @@ void ProcessorEditor::_onLittleEndianRadioButtonClicked()
     emit contentChanged();
 }
 
+void ProcessorEditor::_onExecutionEngineComboBoxCurrentIndexChanged(int)
+{
+    emit contentChanged();
+}
+
+void ProcessorEditor::_onParallelCoresCheckBoxToggled(bool)
+{
+    emit contentChanged();
+}
+
+void ProcessorEditor::_onSyncQuantumLineEditTextChanged(QString)
+{
+    emit contentChanged();
+}
+
+void ProcessorEditor::_onProfilingIntervalLineEditTextChanged(QString)
+{
+    emit contentChanged();
+}
+
+void ProcessorEditor::_onProfileFileLineEditTextChanged(QString)
+{
+    emit contentChanged();
+}
+
+void ProcessorEditor::_onProfileSymbolsFileLineEditTextChanged(QString)
+{
+    emit contentChanged();
+}
+
+void ProcessorEditor::_onTraceFileLineEditTextChanged(QString)
+{
+    emit contentChanged();
+}
+
 //  End of hadesvm-cereon/ProcessorEditor.cpp
@@ -57,6 +57,13 @@ namespace hadesvm
             void                _onClockUnitComboBoxCurrentIndexChanged(int);
             void                _onBigEndianRadioButtonClicked();
             void                _onLittleEndianRadioButtonClicked();
+            void                _onExecutionEngineComboBoxCurrentIndexChanged(int);
+            void                _onParallelCoresCheckBoxToggled(bool);
+            void                _onSyncQuantumLineEditTextChanged(QString);
+            void                _onProfilingIntervalLineEditTextChanged(QString);
+            void                _onProfileFileLineEditTextChanged(QString);
+            void                _onProfileSymbolsFileLineEditTextChanged(QString);
+            void                _onTraceFileLineEditTextChanged(QString);
         };
     }
 }
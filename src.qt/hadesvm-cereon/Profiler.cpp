@@ -0,0 +1,117 @@
+//
+//  hadesvm-cereon/Profiler.cpp
+//
+//  hadesvm::cereon::Profiler class implementation
+//
+//////////
+#include "hadesvm-cereon/API.hpp"
+using namespace hadesvm::cereon;
+
+//////////
+//  Construction/destruction
+Profiler::Profiler()
+    :   _guard(),
+        _numSamples(0),
+        _stacks(),
+        _symbols()
+{
+}
+
+//////////
+//  Operations
+void Profiler::addSample(const ProfileSample & sample)
+{
+    QList<uint64_t> stack;
+    stack.append(sample.kernelMode ? 1 : 0);
+    for (unsigned i = sample.numReturnAddresses; i > 0; i--)
+    {
+        stack.append(sample.returnAddresses[i - 1]);
+    }
+    stack.append(sample.ip);
+
+    QMutexLocker lock(&_guard);
+    _stacks[stack]++;
+    _numSamples++;
+}
+
+uint64_t Profiler::numSamples() const
+{
+    QMutexLocker lock(&_guard);
+    return _numSamples;
+}
+
+void Profiler::clear()
+{
+    QMutexLocker lock(&_guard);
+    _stacks.clear();
+    _numSamples = 0;
+}
+
+bool Profiler::loadSymbols(const QString & fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {   //  OOPS! Can't
+        return false;
+    }
+
+    QMap<uint64_t, QString> symbols;
+    QTextStream stream(&file);
+    while (!stream.atEnd())
+    {
+        QStringList fields = stream.readLine().split(' ', Qt::SkipEmptyParts);
+        uint64_t address = 0;
+        if (fields.size() >= 2 &&
+            hadesvm::util::fromString(fields[0].startsWith("0x", Qt::CaseInsensitive) ? fields[0].mid(2) : fields[0], "%X", address))
+        {
+            symbols[address] = fields[1];
+        }
+    }
+
+    QMutexLocker lock(&_guard);
+    _symbols = symbols;
+    return true;
+}
+
+void Profiler::writeCollapsedStacks(QTextStream & stream) const
+{
+    QMutexLocker lock(&_guard);
+
+    for (auto it = _stacks.cbegin(); it != _stacks.cend(); ++it)
+    {
+        const QList<uint64_t> & stack = it.key();
+        QString line = (stack[0] != 0) ? "kernel" : "user";
+        for (qsizetype i = 1; i < stack.size(); i++)
+        {
+            line += ";" + _frameName(stack[i]);
+        }
+        stream << line << " " << hadesvm::util::toString(it.value()) << "\n";
+    }
+}
+
+bool Profiler::writeCollapsedStacks(const QString & fileName) const
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {   //  OOPS! Can't
+        return false;
+    }
+    QTextStream stream(&file);
+    writeCollapsedStacks(stream);
+    return true;
+}
+
+//////////
+//  Implementation helpers
+QString Profiler::_frameName(uint64_t address) const
+{
+    auto it = _symbols.upperBound(address);
+    if (it == _symbols.cbegin())
+    {   //  No symbol at or below the address
+        return "0x" + hadesvm::util::toString(address, "%016X");
+    }
+    --it;
+    return it.value();
+}
+
+//  End of hadesvm-cereon/Profiler.cpp
@@ -0,0 +1,77 @@
+//
+//  hadesvm-cereon/Profiler.hpp
+//
+//  Sampling profiler for Cereon processor cores
+//
+//////////
+
+namespace hadesvm
+{
+    namespace cereon
+    {
+        //////////
+        //  A sample of where a processor core is executing. The return
+        //  addresses are found by following the chain of frame pointers
+        //  ($fp, r28) from the current one outwards; each frame must keep
+        //  the caller's $fp at [$fp] and the return address at [$fp + 8]
+        struct ProfileSample
+        {
+            static const unsigned   MaxReturnAddresses = 15;
+
+            bool                kernelMode = false;
+            uint64_t            ip = 0;
+            unsigned            numReturnAddresses = 0;
+            uint64_t            returnAddresses[MaxReturnAddresses] = {};   //  innermost first
+        };
+
+        //////////
+        //  Aggregates profile samples by stack and writes them out as
+        //  "collapsed stacks" - the text format read by flame graph tools,
+        //  one line per distinct stack (outermost frame first, frames
+        //  separated by ';') followed by the number of its samples.
+        //  Can be used from any thread.
+        class HADESVM_CEREON_PUBLIC Profiler final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Profiler)
+
+            //////////
+            //  Construction/destruction
+        public:
+            Profiler();
+            ~Profiler() = default;
+
+            //////////
+            //  Operations
+        public:
+            void                addSample(const ProfileSample & sample);
+            uint64_t            numSamples() const;
+            void                clear();
+
+            //  Loads symbols to name frames by from a map file, each line of
+            //  which is a hex address followed by a name; lines that aren't
+            //  are ignored. An address is named by the symbol with the highest
+            //  address that is not above it. Returns false if the file can't
+            //  be read.
+            bool                loadSymbols(const QString & fileName);
+
+            //  Writes the collapsed stacks; frames without a symbol are
+            //  written as hex addresses
+            void                writeCollapsedStacks(QTextStream & stream) const;
+            bool                writeCollapsedStacks(const QString & fileName) const;
+
+            //////////
+            //  Implementation
+        private:
+            mutable QMutex      _guard;
+            uint64_t            _numSamples;
+            //  Stack (mode, then frames outermost first) -> number of samples
+            QMap<QList<uint64_t>, uint64_t> _stacks;
+            QMap<uint64_t, QString> _symbols;
+
+            //  Helpers
+            QString             _frameName(uint64_t address) const;
+        };
+    }
+}
+
+//  End of hadesvm-cereon/Profiler.hpp
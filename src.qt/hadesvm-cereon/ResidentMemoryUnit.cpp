@@ -15,7 +15,9 @@ ResidentMemoryUnit::ResidentMemoryUnit(uint64_t startAddress, const hadesvm::cor
         _startAddress(startAddress),
         _size(size),
         _sizeInBytes(static_cast<size_t>(size.toBytes())),
-        _data(nullptr)
+        _data(nullptr),
+        _restorer(nullptr),
+        _restoreListeners()
 {
     _memoryBlocks.append(this);
     Q_ASSERT(_sizeInBytes == _size.toBytes());  //  Avoid overflow!
@@ -23,6 +25,7 @@ ResidentMemoryUnit::ResidentMemoryUnit(uint64_t startAddress, const hadesvm::cor
 
 ResidentMemoryUnit::~ResidentMemoryUnit() noexcept
 {
+    delete _restorer;   //  waits for the restore to finish writing to "_data"
     delete [] _data;    //  just in case; "delete nullptr" is safe
 }
 
@@ -116,6 +119,7 @@ void ResidentMemoryUnit::deinitialize() noexcept
         return;
     }
 
+    _finishRestoring();
     delete[] _data;
     _data = nullptr;
 
@@ -146,21 +150,63 @@ void ResidentMemoryUnit::reset() noexcept
     //  Nothing here - a soft reset does not wipe dynamic memory
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void ResidentMemoryUnit::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    _finishRestoring();
+    writer << _startAddress;
+    writer.writeMemory(_data, _sizeInBytes);
+}
+
+void ResidentMemoryUnit::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    uint64_t startAddress = 0;
+    reader >> startAddress;
+    if (startAddress != _startAddress)
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " has moved since the snapshot was taken");
+    }
+    //  Decompressing all of RAM would delay the start of the VA - instead,
+    //  RAM is restored in the background, and a page the VA accesses
+    //  before that is restored on the spot
+    Q_ASSERT(_restorer == nullptr);
+    _restorer = reader.readMemoryLazily(_data, _sizeInBytes);   //  may throw; _data is still zeroed by initialize()
+    //  Every memory bus attaches every memory unit, and until the restore is
+    //  done, none of them can map the host memory
+    _restoreListeners = virtualAppliance()->componentsImplementing<MemoryBus>();
+    _restorer->start([this]()
+                     {
+                         for (MemoryBus * memoryBus : _restoreListeners)
+                         {
+                             memoryBus->publishHostData(this);
+                         }
+                     });
+}
+
 //////////
 //  IMemoryBlock
-uint8_t ResidentMemoryUnit::loadByte(size_t offset) throws(MemoryAccessError)
+MemoryAccessError ResidentMemoryUnit::loadByte(size_t offset, uint8_t & value)
 {
 #ifndef QT_NO_DEBUG
     //  In release mode the ProcessorCore and MemoryBus take care of alignment/range issues TODO really ?
     if (offset >= _sizeInBytes)
     {
-        throw MemoryAccessError::InvalidAddress;
+        return MemoryAccessError::InvalidAddress;
     }
 #endif
-    return _data[offset];
+    _ensureRestored(offset);
+    value = _data[offset];
+    return MemoryAccessError::None;
 }
 
-uint16_t ResidentMemoryUnit::loadHalfWord(size_t offset, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError ResidentMemoryUnit::loadHalfWord(size_t offset, ByteOrder byteOrder, uint16_t & value)
 {
     Q_ASSERT(byteOrder == ByteOrder::BigEndian || byteOrder == ByteOrder::LittleEndian);
 
@@ -168,26 +214,28 @@ uint16_t ResidentMemoryUnit::loadHalfWord(size_t offset, ByteOrder byteOrder) th
     //  In release mode the ProcessorCore and MemoryBus take care of alignment/range issues TODO really ?
     if (offset >= _sizeInBytes)
     {
-        throw MemoryAccessError::InvalidAddress;
+        return MemoryAccessError::InvalidAddress;
     }
     if ((offset & 0x01) != 0)
     {
-        throw MemoryAccessError::InvalidAlignment;
+        return MemoryAccessError::InvalidAlignment;
     }
 #endif
-    uint16_t value = *reinterpret_cast<uint16_t*>(_data + offset);
+    _ensureRestored(offset);
+    uint16_t data = *reinterpret_cast<uint16_t*>(_data + offset);
     if (byteOrder != ByteOrder::Native)
     {
 #if defined Q_CC_MSVC
-        value = _byteswap_ushort(value);
+        data = _byteswap_ushort(data);
 #else
-        value = std::byteswap<uint16_t>(value);
+        data = std::byteswap<uint16_t>(data);
 #endif
     }
-    return value;
+    value = data;
+    return MemoryAccessError::None;
 }
 
-uint32_t ResidentMemoryUnit::loadWord(size_t offset, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError ResidentMemoryUnit::loadWord(size_t offset, ByteOrder byteOrder, uint32_t & value)
 {
     Q_ASSERT(byteOrder == ByteOrder::BigEndian || byteOrder == ByteOrder::LittleEndian);
 
@@ -195,26 +243,28 @@ uint32_t ResidentMemoryUnit::loadWord(size_t offset, ByteOrder byteOrder) throws
     //  In release mode the ProcessorCore and MemoryBus take care of alignment/range issues TODO really ?
     if (offset >= _sizeInBytes)
     {
-        throw MemoryAccessError::InvalidAddress;
+        return MemoryAccessError::InvalidAddress;
     }
     if ((offset & 0x03) != 0)
     {
-        throw MemoryAccessError::InvalidAlignment;
+        return MemoryAccessError::InvalidAlignment;
     }
 #endif
-    uint32_t value = *reinterpret_cast<uint32_t*>(_data + offset);
+    _ensureRestored(offset);
+    uint32_t data = *reinterpret_cast<uint32_t*>(_data + offset);
     if (byteOrder != ByteOrder::Native)
     {
 #if defined Q_CC_MSVC
-        value = _byteswap_ulong(value);
+        data = _byteswap_ulong(data);
 #else
-        value = std::byteswap<uint32_t>(value);
+        data = std::byteswap<uint32_t>(data);
 #endif
     }
-    return value;
+    value = data;
+    return MemoryAccessError::None;
 }
 
-uint64_t ResidentMemoryUnit::loadLongWord(size_t offset, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError ResidentMemoryUnit::loadLongWord(size_t offset, ByteOrder byteOrder, uint64_t & value)
 {
     Q_ASSERT(byteOrder == ByteOrder::BigEndian || byteOrder == ByteOrder::LittleEndian);
 
@@ -222,38 +272,42 @@ uint64_t ResidentMemoryUnit::loadLongWord(size_t offset, ByteOrder byteOrder) th
     //  In release mode the ProcessorCore and MemoryBus take care of alignment/range issues TODO really ?
     if (offset >= _sizeInBytes)
     {
-        throw MemoryAccessError::InvalidAddress;
+        return MemoryAccessError::InvalidAddress;
     }
     if ((offset & 0x07) != 0)
     {
-        throw MemoryAccessError::InvalidAlignment;
+        return MemoryAccessError::InvalidAlignment;
     }
 #endif
-    uint64_t value = *reinterpret_cast<uint64_t*>(_data + offset);
+    _ensureRestored(offset);
+    uint64_t data = *reinterpret_cast<uint64_t*>(_data + offset);
     if (byteOrder != ByteOrder::Native)
     {
 #if defined Q_CC_MSVC
-        value = _byteswap_uint64(value);
+        data = _byteswap_uint64(data);
 #else
-        value = std::byteswap<uint64_t>(value);
+        data = std::byteswap<uint64_t>(data);
 #endif
     }
-    return value;
+    value = data;
+    return MemoryAccessError::None;
 }
 
-void ResidentMemoryUnit::storeByte(size_t offset, uint8_t value) throws(MemoryAccessError)
+MemoryAccessError ResidentMemoryUnit::storeByte(size_t offset, uint8_t value)
 {
 #ifndef QT_NO_DEBUG
     //  In release mode the ProcessorCore and MemoryBus take care of alignment/range issues TODO really ?
     if (offset >= _sizeInBytes)
     {
-        throw MemoryAccessError::InvalidAddress;
+        return MemoryAccessError::InvalidAddress;
     }
 #endif
+    _ensureRestored(offset);
     _data[offset] = value;
+    return MemoryAccessError::None;
 }
 
-void ResidentMemoryUnit::storeHalfWord(size_t offset, uint16_t value, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError ResidentMemoryUnit::storeHalfWord(size_t offset, uint16_t value, ByteOrder byteOrder)
 {
     Q_ASSERT(byteOrder == ByteOrder::BigEndian || byteOrder == ByteOrder::LittleEndian);
 
@@ -261,13 +315,14 @@ void ResidentMemoryUnit::storeHalfWord(size_t offset, uint16_t value, ByteOrder
     //  In release mode the ProcessorCore and MemoryBus take care of alignment/range issues TODO really ?
     if (offset >= _sizeInBytes)
     {
-        throw MemoryAccessError::InvalidAddress;
+        return MemoryAccessError::InvalidAddress;
     }
     if ((offset & 0x01) != 0)
     {
-        throw MemoryAccessError::InvalidAlignment;
+        return MemoryAccessError::InvalidAlignment;
     }
 #endif
+    _ensureRestored(offset);
     if (byteOrder != ByteOrder::Native)
     {
 #if defined Q_CC_MSVC
@@ -277,9 +332,10 @@ void ResidentMemoryUnit::storeHalfWord(size_t offset, uint16_t value, ByteOrder
 #endif
     }
     *reinterpret_cast<uint16_t*>(_data + offset) = value;
+    return MemoryAccessError::None;
 }
 
-void ResidentMemoryUnit::storeWord(size_t offset, uint32_t value, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError ResidentMemoryUnit::storeWord(size_t offset, uint32_t value, ByteOrder byteOrder)
 {
     Q_ASSERT(byteOrder == ByteOrder::BigEndian || byteOrder == ByteOrder::LittleEndian);
 
@@ -287,13 +343,14 @@ void ResidentMemoryUnit::storeWord(size_t offset, uint32_t value, ByteOrder byte
     //  In release mode the ProcessorCore and MemoryBus take care of alignment/range issues TODO really ?
     if (offset >= _sizeInBytes)
     {
-        throw MemoryAccessError::InvalidAddress;
+        return MemoryAccessError::InvalidAddress;
     }
     if ((offset & 0x03) != 0)
     {
-        throw MemoryAccessError::InvalidAlignment;
+        return MemoryAccessError::InvalidAlignment;
     }
 #endif
+    _ensureRestored(offset);
     if (byteOrder != ByteOrder::Native)
     {
 #if defined Q_CC_MSVC
@@ -303,9 +360,10 @@ void ResidentMemoryUnit::storeWord(size_t offset, uint32_t value, ByteOrder byte
 #endif
     }
     *reinterpret_cast<uint32_t*>(_data + offset) = value;
+    return MemoryAccessError::None;
 }
 
-void ResidentMemoryUnit::storeLongWord(size_t offset, uint64_t value, ByteOrder byteOrder) throws(MemoryAccessError)
+MemoryAccessError ResidentMemoryUnit::storeLongWord(size_t offset, uint64_t value, ByteOrder byteOrder)
 {
     Q_ASSERT(byteOrder == ByteOrder::BigEndian || byteOrder == ByteOrder::LittleEndian);
 
@@ -313,13 +371,14 @@ void ResidentMemoryUnit::storeLongWord(size_t offset, uint64_t value, ByteOrder
     //  In release mode the ProcessorCore and MemoryBus take care of alignment/range issues TODO really ?
     if (offset >= _sizeInBytes)
     {
-        throw MemoryAccessError::InvalidAddress;
+        return MemoryAccessError::InvalidAddress;
     }
     if ((offset & 0x07) != 0)
     {
-        throw MemoryAccessError::InvalidAlignment;
+        return MemoryAccessError::InvalidAlignment;
     }
 #endif
+    _ensureRestored(offset);
     if (byteOrder != ByteOrder::Native)
     {
 #if defined Q_CC_MSVC
@@ -329,6 +388,7 @@ void ResidentMemoryUnit::storeLongWord(size_t offset, uint64_t value, ByteOrder
 #endif
     }
     *reinterpret_cast<uint64_t*>(_data + offset) = value;
+    return MemoryAccessError::None;
 }
 
 //////////
@@ -350,4 +410,16 @@ void ResidentMemoryUnit::setSize(const hadesvm::core::MemorySize & size)
     _sizeInBytes = static_cast<size_t>(_size.toBytes());
 }
 
+//////////
+//  Implementation helpers
+void ResidentMemoryUnit::_finishRestoring()
+{
+    if (_restorer != nullptr)
+    {
+        _restorer->waitForDone();
+        delete _restorer;
+        _restorer = nullptr;
+    }
+}
+
 //  End of hadesvm-cereon/ResidentMemoryUnit.cpp
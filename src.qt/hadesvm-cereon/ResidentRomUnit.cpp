@@ -90,26 +90,48 @@ void ResidentRomUnit::initialize() throws(hadesvm::core::VirtualApplianceExcepti
     }
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void ResidentRomUnit::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    writer << startAddress() << _contentHash();
+}
+
+void ResidentRomUnit::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    uint64_t savedStartAddress = 0;
+    QByteArray savedContentHash;
+    reader >> savedStartAddress >> savedContentHash;
+    if (savedStartAddress != startAddress() || savedContentHash != _contentHash())
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " content has changed since the snapshot was taken");
+    }
+}
+
 //////////
 //  IMemoryBlock
-void ResidentRomUnit::storeByte(size_t /*offset*/, uint8_t /*value*/) throws(MemoryAccessError)
+MemoryAccessError ResidentRomUnit::storeByte(size_t /*offset*/, uint8_t /*value*/)
 {
-    throw MemoryAccessError::AccessDenied;
+    return MemoryAccessError::AccessDenied;
 }
 
-void ResidentRomUnit::storeHalfWord(size_t /*offset*/, uint16_t /*value*/, ByteOrder /*byteOrder*/) throws(MemoryAccessError)
+MemoryAccessError ResidentRomUnit::storeHalfWord(size_t /*offset*/, uint16_t /*value*/, ByteOrder /*byteOrder*/)
 {
-    throw MemoryAccessError::AccessDenied;
+    return MemoryAccessError::AccessDenied;
 }
 
-void ResidentRomUnit::storeWord(size_t /*offset*/, uint32_t /*value*/, ByteOrder /*byteOrder*/) throws(MemoryAccessError)
+MemoryAccessError ResidentRomUnit::storeWord(size_t /*offset*/, uint32_t /*value*/, ByteOrder /*byteOrder*/)
 {
-    throw MemoryAccessError::AccessDenied;
+    return MemoryAccessError::AccessDenied;
 }
 
-void ResidentRomUnit::storeLongWord(size_t /*offset*/, uint64_t /*value*/, ByteOrder /*byteOrder*/) throws(MemoryAccessError)
+MemoryAccessError ResidentRomUnit::storeLongWord(size_t /*offset*/, uint64_t /*value*/, ByteOrder /*byteOrder*/)
 {
-    throw MemoryAccessError::AccessDenied;
+    return MemoryAccessError::AccessDenied;
 }
 
 //////////
@@ -127,6 +149,15 @@ void ResidentRomUnit::setContentFilePath(const QString & contentFilePath)
     _contentFilePath = contentFilePath;
 }
 
+//////////
+//  Implementation helpers
+QByteArray ResidentRomUnit::_contentHash()
+{
+    return QCryptographicHash::hash(
+                QByteArrayView(ResidentMemoryUnit::hostData(false), static_cast<qsizetype>(size().toBytes())),
+                QCryptographicHash::Sha256);
+}
+
 //////////
 //  ResidentRomUnit::Type
 HADESVM_IMPLEMENT_SINGLETON(ResidentRomUnit::Type)
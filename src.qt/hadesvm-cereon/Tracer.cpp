@@ -0,0 +1,150 @@
+//
+//  hadesvm-cereon/Tracer.cpp
+//
+//  hadesvm::cereon::Tracer class implementation
+//
+//////////
+#include "hadesvm-cereon/API.hpp"
+using namespace hadesvm::cereon;
+
+//////////
+//  TraceEncoder
+TraceEncoder::TraceEncoder(uint8_t coreId, const uint64_t & cc, size_t capacity)
+    :   _coreId(coreId),
+        _cc(cc),
+        _fullChunks(capacity),
+        _chunk(),
+        _lastIp(0),
+        _lastDataAddress(0),
+        _interruptSinceInstruction(false),
+        _chunkLost(false)
+{
+    _beginChunk();
+}
+
+void TraceEncoder::flush()
+{
+    if (_chunk.size != 0)
+    {
+        _chunkLost = !_fullChunks.tryEnqueue(_chunk);
+    }
+    _beginChunk();
+}
+
+void TraceEncoder::_beginChunk()
+{
+    _chunk.coreId = _coreId;
+    _chunk.flags = _chunkLost ? TraceChunk::LossFlag : 0;
+    _chunk.size = 0;
+    _chunk.cc = _cc;
+    _lastIp = 0;
+    _lastDataAddress = 0;
+}
+
+//////////
+//  Construction/destruction
+Tracer::Tracer(const QString & fileName)
+    :   _file(fileName),
+        _encoders(),
+        _writerThread(nullptr)
+{
+}
+
+Tracer::~Tracer()
+{
+    stop();
+    for (TraceEncoder * encoder : _encoders)
+    {
+        delete encoder;
+    }
+}
+
+//////////
+//  Operations
+TraceEncoder * Tracer::createEncoder(uint8_t coreId, const uint64_t & cc)
+{
+    Q_ASSERT(_writerThread == nullptr);
+
+    TraceEncoder * encoder = new TraceEncoder(coreId, cc, ChunksPerCore);
+    _encoders.append(encoder);
+    return encoder;
+}
+
+bool Tracer::start()
+{
+    Q_ASSERT(_writerThread == nullptr);
+
+    if (!_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {   //  OOPS! Can't
+        return false;
+    }
+    uint8_t header[12] = { 'H', 'V', 'M', 'T', 'R', 'A', 'C', 'E' };
+    hadesvm::util::storeUnalignedWithByteOrder<uint32_t>(header + 8, TraceChunk::FormatVersion, ByteOrder::LittleEndian);
+    _file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    _writerThread = new _WriterThread(this);
+    _writerThread->start();
+    return true;
+}
+
+void Tracer::stop()
+{
+    if (_writerThread == nullptr)
+    {   //  Not started
+        return;
+    }
+
+    _writerThread->requestStop();
+    _writerThread->wait(ULONG_MAX);
+    delete _writerThread;
+    _writerThread = nullptr;
+
+    //  The encoders are ours now
+    for (TraceEncoder * encoder : _encoders)
+    {
+        encoder->flush();
+    }
+    _writeFullChunks();
+    _file.close();
+}
+
+//////////
+//  Implementation helpers
+bool Tracer::_writeFullChunks()
+{
+    bool chunksWritten = false;
+    TraceChunk chunk;
+    for (TraceEncoder * encoder : _encoders)
+    {
+        while (encoder->_fullChunks.tryDequeue(chunk))
+        {
+            _writeChunk(chunk);
+            chunksWritten = true;
+        }
+    }
+    return chunksWritten;
+}
+
+void Tracer::_writeChunk(const TraceChunk & chunk)
+{
+    uint8_t header[12] = { chunk.coreId, chunk.flags };
+    hadesvm::util::storeUnalignedWithByteOrder<uint16_t>(header + 2, chunk.size, ByteOrder::LittleEndian);
+    hadesvm::util::storeUnalignedWithByteOrder<uint64_t>(header + 4, chunk.cc, ByteOrder::LittleEndian);
+    _file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    _file.write(reinterpret_cast<const char*>(chunk.records), chunk.size);
+}
+
+//////////
+//  Tracer::_WriterThread
+void Tracer::_WriterThread::run()
+{
+    while (!_stopRequested)
+    {
+        if (!_tracer->_writeFullChunks())
+        {   //  Let the cores fill some chunks
+            msleep(10);
+        }
+    }
+}
+
+//  End of hadesvm-cereon/Tracer.cpp
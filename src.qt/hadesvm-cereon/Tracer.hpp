@@ -0,0 +1,260 @@
+//
+//  hadesvm-cereon/Tracer.hpp
+//
+//  Binary execution traces of Cereon processor cores
+//
+//////////
+
+namespace hadesvm
+{
+    namespace cereon
+    {
+        //////////
+        //  A trace file starts with the 8 bytes "HVMTRACE" followed by the
+        //  format version as a 32-bit little-endian number. The rest of the
+        //  file is a sequence of chunks, each written by a single core:
+        //      uint8   ID of the core
+        //      uint8   TraceChunk::XXXFlag bits
+        //      uint16  number of record bytes that follow (little-endian)
+        //      uint64  $cc of the core when the chunk was started (little-endian)
+        //      ...     records
+        //  Each record starts with a tag byte, bits 0..2 of which are the
+        //  TraceRecordKind. For an Interrupt record, bits 3..7 of the tag are
+        //  the TraceInterrupt and the interrupt status code follows as an
+        //  unsigned varint. For all other records, the tag is followed by
+        //  an address, delta-encoded as a zigzagged varint - unless bit 7 of
+        //  the tag is 0, in which case the zigzagged delta (0..15) is in
+        //  bits 3..6 of the tag. The delta is taken from:
+        //  *   Instruction: the $ip of the previous instruction + 4;
+        //  *   Branch: the $ip of the branch instruction (and the next
+        //      Instruction is then delta-encoded as if it followed the
+        //      instruction before the target);
+        //  *   Load/Store: the address of the previous Load/Store.
+        //  All "previous" addresses are 0 at the start of each chunk, so that
+        //  each chunk can be decoded on its own.
+        //  A varint keeps 7 bits per byte, low-order bits first, with bit 7
+        //  set in all bytes but the last.
+        enum class TraceRecordKind : uint8_t
+        {
+            Instruction = 0,    //  ...about to be executed
+            Branch = 1,         //  ...to the address
+            Load = 2,           //  ...from the logical address
+            Store = 3,          //  ...to the logical address
+            Interrupt = 4       //  ...entered
+        };
+
+        enum class TraceInterrupt : uint8_t
+        {
+            Timer = 0,
+            Io = 1,
+            Svc = 2,
+            Program = 3,
+            External = 4,
+            Hardware = 5
+        };
+
+        struct TraceChunk
+        {
+            static const uint32_t   FormatVersion = 1;
+            static const uint8_t    LossFlag = 0x01;    //  chunks of this core were lost just before this one
+            static const size_t     MaxRecordBytes = 4096 - 16;
+
+            uint8_t             coreId = 0;
+            uint8_t             flags = 0;
+            uint16_t            size = 0;
+            uint64_t            cc = 0;
+            uint8_t             records[MaxRecordBytes];
+        };
+
+        //////////
+        //  Records the trace of a single processor core into chunks, which
+        //  are handed over to the Tracer for writing when full. Must only be
+        //  used by the thread running the core.
+        class HADESVM_CEREON_PUBLIC TraceEncoder final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(TraceEncoder)
+
+            friend class Tracer;
+
+            //////////
+            //  Construction/destruction
+        public:
+            TraceEncoder(uint8_t coreId, const uint64_t & cc, size_t capacity);
+            ~TraceEncoder() = default;
+
+            //////////
+            //  Operations
+        public:
+            void                recordInstruction(uint64_t ip)
+            {
+                _reserve(_MaxRecordSize);
+                _putAddress(TraceRecordKind::Instruction, ip - (_lastIp + 4));
+                _lastIp = ip;
+                _interruptSinceInstruction = false;
+            }
+
+            //  Called when the instruction last recorded has been executed and
+            //  the next one is at "nextIp"; records a Branch unless execution
+            //  fell through or an interrupt has been entered
+            void                recordFlow(uint64_t nextIp)
+            {
+                if (nextIp != _lastIp + 4 && !_interruptSinceInstruction)
+                {
+                    _reserve(_MaxRecordSize);
+                    _putAddress(TraceRecordKind::Branch, nextIp - _lastIp);
+                    _lastIp = nextIp - 4;
+                }
+            }
+
+            void                recordLoad(uint64_t address)
+            {
+                _reserve(_MaxRecordSize);
+                _putAddress(TraceRecordKind::Load, address - _lastDataAddress);
+                _lastDataAddress = address;
+            }
+
+            void                recordStore(uint64_t address)
+            {
+                _reserve(_MaxRecordSize);
+                _putAddress(TraceRecordKind::Store, address - _lastDataAddress);
+                _lastDataAddress = address;
+            }
+
+            void                recordInterrupt(TraceInterrupt interrupt, uint64_t interruptStatusCode)
+            {
+                _reserve(_MaxRecordSize);
+                _chunk.records[_chunk.size++] = static_cast<uint8_t>(static_cast<uint8_t>(TraceRecordKind::Interrupt) |
+                                                                     (static_cast<uint8_t>(interrupt) << 3));
+                _putVarint(interruptStatusCode);
+                _interruptSinceInstruction = true;
+            }
+
+            //  Hands the current chunk over to the Tracer (or drops it if the
+            //  Tracer lags behind) and starts a new one
+            void                flush();
+
+            //////////
+            //  Implementation
+        private:
+            static const size_t _MaxRecordSize = 1 + 10;    //  tag + 64-bit varint
+
+            const uint8_t       _coreId;
+            const uint64_t &    _cc;
+            hadesvm::util::RingBuffer<TraceChunk>   _fullChunks;
+            TraceChunk          _chunk;
+            uint64_t            _lastIp;
+            uint64_t            _lastDataAddress;
+            bool                _interruptSinceInstruction;
+            bool                _chunkLost;
+
+            //  Helpers
+            void                _beginChunk();
+            void                _reserve(size_t bytes)
+            {
+                if (_chunk.size + bytes > TraceChunk::MaxRecordBytes)
+                {
+                    flush();
+                }
+            }
+            void                _putVarint(uint64_t value)
+            {
+                while (value >= 0x80)
+                {
+                    _chunk.records[_chunk.size++] = static_cast<uint8_t>(value | 0x80);
+                    value >>= 7;
+                }
+                _chunk.records[_chunk.size++] = static_cast<uint8_t>(value);
+            }
+            void                _putAddress(TraceRecordKind kind, uint64_t delta)
+            {
+                uint64_t zigzag = (delta << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(delta) >> 63);
+                if (zigzag < 16)
+                {
+                    _chunk.records[_chunk.size++] = static_cast<uint8_t>(static_cast<uint8_t>(kind) | (zigzag << 3));
+                }
+                else
+                {
+                    _chunk.records[_chunk.size++] = static_cast<uint8_t>(static_cast<uint8_t>(kind) | 0x80);
+                    _putVarint(zigzag);
+                }
+            }
+        };
+
+        //////////
+        //  Writes the chunks recorded by TraceEncoders to a trace file
+        //  on a background thread
+        class HADESVM_CEREON_PUBLIC Tracer final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Tracer)
+
+            //////////
+            //  Constants
+        public:
+            //  The number of full chunks of each core that can wait for writing
+            static const size_t ChunksPerCore = 256;
+
+            //////////
+            //  Construction/destruction
+        public:
+            explicit Tracer(const QString & fileName);
+            ~Tracer();
+
+            //////////
+            //  Operations
+        public:
+            //  Creates an encoder for the core with the specified ID and $cc;
+            //  must be called before start()
+            TraceEncoder *      createEncoder(uint8_t coreId, const uint64_t & cc);
+
+            //  Creates the trace file and starts writing to it; returns false
+            //  if the file can't be created
+            bool                start();
+
+            //  Must be called when the encoders are no longer used by the
+            //  cores' threads. Flushes the encoders, writes what's left and
+            //  closes the file
+            void                stop();
+
+            //////////
+            //  Implementation
+        private:
+            QFile               _file;
+            QList<TraceEncoder*>    _encoders;
+
+            class _WriterThread final : public QThread
+            {
+                HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_WriterThread)
+
+                //////////
+                //  Construction/destruction
+            public:
+                explicit _WriterThread(Tracer * tracer)
+                    :   _tracer(tracer), _stopRequested(false) {}
+                virtual ~_WriterThread() = default;
+
+                //////////
+                //  QThread
+            protected:
+                virtual void    run() override;
+
+                //////////
+                //  Operations
+            public:
+                void            requestStop() { _stopRequested = true; }
+
+                //////////
+                //  Implementation
+            private:
+                Tracer *const       _tracer;
+                std::atomic<bool>   _stopRequested;
+            };
+            _WriterThread *     _writerThread;  //  nullptr == not started
+
+            //  Helpers
+            bool                _writeFullChunks(); //  false if there were none
+            void                _writeChunk(const TraceChunk & chunk);
+        };
+    }
+}
+
+//  End of hadesvm-cereon/Tracer.hpp
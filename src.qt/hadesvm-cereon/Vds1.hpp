@@ -12,8 +12,9 @@ namespace hadesvm
         //////////
         //  The Cereon VDS1 video controller
         class HADESVM_CEREON_PUBLIC Vds1Controller : public hadesvm::core::Component,
-                                                     public virtual hadesvm::core::IClockedComponent,
-                                                     public virtual IIoController
+                                                     public virtual hadesvm::core::IScheduledComponent,
+                                                     public virtual IIoController,
+                                                     public virtual hadesvm::core::ISnapshotComponent
 
         {
             HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Vds1Controller)
@@ -87,13 +88,25 @@ namespace hadesvm
         public:
             virtual hadesvm::core::ClockFrequency
                                 clockFrequency() const noexcept override { return _clockFrequency; }
-            virtual void        onClockTick() noexcept override;
+            virtual void        onClockTick() noexcept override {}
+
+            //////////
+            //  hadesvm::core::IScheduledComponent
+        public:
+            virtual void        onWakeUp() noexcept override;
+            virtual void        onEvent() noexcept override {}
 
             //////////
             //  IIoController
         public:
             virtual IoPortList  ioPorts() override;
 
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+        public:
+            virtual void        saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void        restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
             //////////
             //  Operations (configuration)
         public:
@@ -173,6 +186,7 @@ namespace hadesvm
             {
                 HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_Compartment)
 
+                friend class Vds1Controller;
                 friend class _VideoSignal;
 
                 //////////
@@ -157,19 +157,17 @@ void Vds1Controller::setClockFrequency(const hadesvm::core::ClockFrequency & clo
 }
 
 //////////
-//  hadesvm::core::IClockedComponent
-void Vds1Controller::onClockTick() noexcept
+//  hadesvm::core::IScheduledComponent
+void Vds1Controller::onWakeUp() noexcept
 {
     QMutexLocker lock(&_runtimeStateGuard);
 
-    if (_operationalState == _OperationalState::_ExecutingCommand && _executeDelay > 0)
-    {
-        if (--_executeDelay == 0)
-        {   //  Done executing a long command
-            _operationalState = _resultBytes.isEmpty() ?
-                                    _OperationalState::_Ready :
-                                    _OperationalState::_ProvidingResult;
-        }
+    if (_operationalState == _OperationalState::_ExecutingCommand)
+    {   //  Done executing a long command
+        _executeDelay = 0;
+        _operationalState = _resultBytes.isEmpty() ?
+                                _OperationalState::_Ready :
+                                _OperationalState::_ProvidingResult;
     }
 }
 
@@ -180,6 +178,89 @@ IoPortList Vds1Controller::ioPorts()
     return _ioPorts;
 }
 
+//////////
+//  hadesvm::core::ISnapshotComponent
+void Vds1Controller::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_runtimeStateGuard);
+
+    writer << _interruptMask.load()
+           << static_cast<uint32_t>(_allCompartments.size());
+    for (_Compartment * compartment : _allCompartments)
+    {
+        writer << compartment->_videoMode
+               << compartment->_page
+               << compartment->_source
+               << compartment->_destination
+               << compartment->_length;
+        writer.writeBytes(compartment->_videoMemory, sizeof(compartment->_videoMemory));
+    }
+    writer << _currentCompartment->number()
+           << static_cast<uint8_t>(_operationalState.load())
+           << static_cast<uint32_t>(_commandBytes.size());
+    writer.writeBytes(_commandBytes.constData(), static_cast<size_t>(_commandBytes.size()));
+    writer << static_cast<uint32_t>(_resultBytes.size());
+    writer.writeBytes(_resultBytes.constData(), static_cast<size_t>(_resultBytes.size()));
+    writer << _executeDelay.load();
+}
+
+void Vds1Controller::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    QMutexLocker lock(&_runtimeStateGuard);
+
+    uint8_t interruptMask = 0;
+    uint32_t numCompartments = 0;
+    reader >> interruptMask >> numCompartments;
+    if (numCompartments != static_cast<uint32_t>(_allCompartments.size()))
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " has a different number of compartments");
+    }
+    _interruptMask = interruptMask;
+    for (_Compartment * compartment : _allCompartments)
+    {
+        reader >> compartment->_videoMode
+               >> compartment->_page
+               >> compartment->_source
+               >> compartment->_destination
+               >> compartment->_length;
+        reader.readBytes(compartment->_videoMemory, sizeof(compartment->_videoMemory));
+        compartment->_videoSignalNeedsRefreshing = true;
+    }
+
+    uint8_t currentCompartment = 0, operationalState = 0;
+    uint32_t numCommandBytes = 0, numResultBytes = 0;
+    unsigned executeDelay = 0;
+    reader >> currentCompartment
+           >> operationalState
+           >> numCommandBytes;
+    if (currentCompartment >= _allCompartments.size() ||
+        operationalState > static_cast<uint8_t>(_OperationalState::_ProvidingResult) ||
+        numCommandBytes > 65536)
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " state is invalid");
+    }
+    _commandBytes.resize(numCommandBytes);
+    reader.readBytes(_commandBytes.data(), numCommandBytes);
+    reader >> numResultBytes;
+    if (numResultBytes > 65536)
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " state is invalid");
+    }
+    _resultBytes.resize(numResultBytes);
+    reader.readBytes(_resultBytes.data(), numResultBytes);
+    reader >> executeDelay;
+
+    _currentCompartment = _allCompartments[currentCompartment];
+    _operationalState = static_cast<_OperationalState>(operationalState);
+    _executeDelay = executeDelay;
+}
+
 //////////
 //  hadesvm::core::Component (state management)
 Vds1Controller::State Vds1Controller::state() const noexcept
@@ -259,6 +340,13 @@ void Vds1Controller::start() throws(hadesvm::core::VirtualApplianceException)
         return;
     }
 
+    //  A long command being executed ends in virtual time
+    QMutexLocker lock(&_runtimeStateGuard);
+    if (_operationalState == _OperationalState::_ExecutingCommand)
+    {
+        virtualAppliance()->clockScheduler()->scheduleWakeUp(this, _executeDelay);
+    }
+
     _state = State::Running;
 }
 
@@ -271,6 +359,14 @@ void Vds1Controller::stop() noexcept
         return;
     }
 
+    //  Remember how long a long command being executed still has to go
+    QMutexLocker lock(&_runtimeStateGuard);
+    if (_operationalState == _OperationalState::_ExecutingCommand)
+    {
+        _executeDelay = static_cast<unsigned>(
+            qMin(virtualAppliance()->clockScheduler()->cancelWakeUp(this), static_cast<uint64_t>(UINT_MAX)));
+    }
+
     _state = State::Initialized;
 }
 
@@ -537,6 +633,10 @@ void Vds1Controller::_executeCommand()
         default:
             failure();
     }
+    if (_operationalState == _OperationalState::_ExecutingCommand)
+    {   //  A long command - it ends when the delay has elapsed
+        virtualAppliance()->clockScheduler()->scheduleWakeUp(this, _executeDelay);
+    }
 }
 
 void Vds1Controller::_executeResetCommand()
@@ -0,0 +1,373 @@
+//
+//  hadesvm-cereon/X64Emitter.cpp
+//
+//  hadesvm::cereon::X64CodeCache and hadesvm::cereon::X64Emitter class implementation
+//
+//////////
+#include "hadesvm-cereon/X64Emitter.hpp"
+
+#include <cassert>
+
+#if defined(HADESVM_CEREON_X64_HOST)
+    #include <sys/mman.h>
+#endif
+
+using namespace hadesvm::cereon;
+
+//////////
+//  X64CodeCache - Construction/destruction
+X64CodeCache::X64CodeCache(size_t capacity)
+    :   _base(nullptr),
+        _capacity(0),
+        _used(0)
+{
+#if defined(HADESVM_CEREON_X64_HOST)
+    void * region = ::mmap(nullptr, capacity, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region != MAP_FAILED)
+    {
+        _base = static_cast<uint8_t*>(region);
+        _capacity = capacity;
+    }
+#else
+    static_cast<void>(capacity);
+#endif
+}
+
+X64CodeCache::~X64CodeCache() noexcept
+{
+#if defined(HADESVM_CEREON_X64_HOST)
+    if (_base != nullptr)
+    {
+        ::munmap(_base, _capacity);
+    }
+#endif
+}
+
+//////////
+//  X64CodeCache - Operations
+void X64CodeCache::commit(size_t size)
+{
+    assert(size <= bytesAvailable());
+    _used += size;
+}
+
+void X64CodeCache::release(size_t used)
+{
+    assert(used <= _used);
+    _used = used;
+}
+
+bool X64CodeCache::beginWriting()
+{
+#if defined(HADESVM_CEREON_X64_HOST)
+    return _base != nullptr &&
+           ::mprotect(_base, _capacity, PROT_READ | PROT_WRITE) == 0;
+#else
+    return false;
+#endif
+}
+
+bool X64CodeCache::endWriting()
+{
+#if defined(HADESVM_CEREON_X64_HOST)
+    return _base != nullptr &&
+           ::mprotect(_base, _capacity, PROT_READ | PROT_EXEC) == 0;
+#else
+    return false;
+#endif
+}
+
+//////////
+//  X64Emitter - Construction/destruction
+X64Emitter::X64Emitter(uint8_t * buffer, size_t capacity)
+    :   _buffer(buffer),
+        _capacity(capacity),
+        _size(0),
+        _overflowed(false)
+{
+}
+
+//////////
+//  X64Emitter - Operations (data movement)
+void X64Emitter::mov(Register dst, Register src)
+{
+    _emitRex(true, static_cast<unsigned>(src), 0, static_cast<unsigned>(dst));
+    _emitByte(0x89);
+    _emitModRm(static_cast<unsigned>(src), dst);
+}
+
+void X64Emitter::mov(Register dst, const Memory & src)
+{
+    _emitRex(true, static_cast<unsigned>(dst), 0, static_cast<unsigned>(src.base));
+    _emitByte(0x8B);
+    _emitModRm(static_cast<unsigned>(dst), src);
+}
+
+void X64Emitter::mov(const Memory & dst, Register src)
+{
+    _emitRex(true, static_cast<unsigned>(src), 0, static_cast<unsigned>(dst.base));
+    _emitByte(0x89);
+    _emitModRm(static_cast<unsigned>(src), dst);
+}
+
+void X64Emitter::mov(Register dst, uint64_t imm)
+{
+    if (fitsInt32(imm))
+    {   //  mov r/m64, imm32 is 3 bytes shorter
+        _emitRex(true, 0, 0, static_cast<unsigned>(dst));
+        _emitByte(0xC7);
+        _emitModRm(0, dst);
+        _emitInt32(static_cast<int32_t>(imm));
+        return;
+    }
+    _emitRex(true, 0, 0, static_cast<unsigned>(dst));
+    _emitByte(0xB8 + (static_cast<unsigned>(dst) & 0x07));
+    for (unsigned i = 0; i < 8; i++)
+    {
+        _emitByte(static_cast<unsigned>(imm >> (i * 8)) & 0xFF);
+    }
+}
+
+void X64Emitter::mov(const Memory & dst, int32_t imm)
+{
+    _emitRex(true, 0, 0, static_cast<unsigned>(dst.base));
+    _emitByte(0xC7);
+    _emitModRm(0, dst);
+    _emitInt32(imm);
+}
+
+void X64Emitter::mov32(Register dst, Register src)
+{
+    _emitRex(false, static_cast<unsigned>(src), 0, static_cast<unsigned>(dst));
+    _emitByte(0x89);
+    _emitModRm(static_cast<unsigned>(src), dst);
+}
+
+void X64Emitter::lea(Register dst, const Memory & src)
+{
+    _emitRex(true, static_cast<unsigned>(dst), 0, static_cast<unsigned>(src.base));
+    _emitByte(0x8D);
+    _emitModRm(static_cast<unsigned>(dst), src);
+}
+
+void X64Emitter::movzxByte(Register dst, Register src)
+{   //  A REX prefix makes 4..7 stand for spl..dil rather than ah..bh
+    _emitRex(false, static_cast<unsigned>(dst), 0, static_cast<unsigned>(src), static_cast<unsigned>(src) >= 4);
+    _emitByte(0x0F);
+    _emitByte(0xB6);
+    _emitModRm(static_cast<unsigned>(dst), src);
+}
+
+void X64Emitter::setcc(Condition condition, Register dst)
+{
+    _emitRex(false, 0, 0, static_cast<unsigned>(dst), static_cast<unsigned>(dst) >= 4);
+    _emitByte(0x0F);
+    _emitByte(0x90 + static_cast<unsigned>(condition));
+    _emitModRm(0, dst);
+}
+
+void X64Emitter::push(Register src)
+{
+    _emitRex(false, 0, 0, static_cast<unsigned>(src));
+    _emitByte(0x50 + (static_cast<unsigned>(src) & 0x07));
+}
+
+void X64Emitter::pop(Register dst)
+{
+    _emitRex(false, 0, 0, static_cast<unsigned>(dst));
+    _emitByte(0x58 + (static_cast<unsigned>(dst) & 0x07));
+}
+
+//////////
+//  X64Emitter - Operations (arithmetic and logic)
+void X64Emitter::alu(AluOperation operation, Register dst, Register src)
+{   //  op r/m64, r64
+    _emitRex(true, static_cast<unsigned>(src), 0, static_cast<unsigned>(dst));
+    _emitByte(static_cast<unsigned>(operation) * 8 + 0x01);
+    _emitModRm(static_cast<unsigned>(src), dst);
+}
+
+void X64Emitter::alu(AluOperation operation, Register dst, const Memory & src)
+{   //  op r64, r/m64
+    _emitRex(true, static_cast<unsigned>(dst), 0, static_cast<unsigned>(src.base));
+    _emitByte(static_cast<unsigned>(operation) * 8 + 0x03);
+    _emitModRm(static_cast<unsigned>(dst), src);
+}
+
+void X64Emitter::alu(AluOperation operation, Register dst, int32_t imm)
+{
+    _emitRex(true, 0, 0, static_cast<unsigned>(dst));
+    _emitByte(0x81);
+    _emitModRm(static_cast<unsigned>(operation), dst);
+    _emitInt32(imm);
+}
+
+void X64Emitter::alu(AluOperation operation, const Memory & dst, int32_t imm)
+{
+    _emitRex(true, 0, 0, static_cast<unsigned>(dst.base));
+    _emitByte(0x81);
+    _emitModRm(static_cast<unsigned>(operation), dst);
+    _emitInt32(imm);
+}
+
+void X64Emitter::cmpByte(const Memory & op1, uint8_t imm)
+{
+    _emitRex(false, 0, 0, static_cast<unsigned>(op1.base));
+    _emitByte(0x80);
+    _emitModRm(static_cast<unsigned>(AluOperation::Cmp), op1);
+    _emitByte(imm);
+}
+
+void X64Emitter::inc(const Memory & dst)
+{
+    _emitRex(true, 0, 0, static_cast<unsigned>(dst.base));
+    _emitByte(0xFF);
+    _emitModRm(0, dst);
+}
+
+void X64Emitter::shr(Register dst, uint8_t count)
+{
+    _emitRex(true, 0, 0, static_cast<unsigned>(dst));
+    _emitByte(0xC1);
+    _emitModRm(5, dst);
+    _emitByte(count);
+}
+
+void X64Emitter::test32(Register op1, Register op2)
+{
+    _emitRex(false, static_cast<unsigned>(op2), 0, static_cast<unsigned>(op1));
+    _emitByte(0x85);
+    _emitModRm(static_cast<unsigned>(op2), op1);
+}
+
+//////////
+//  X64Emitter - Operations (control flow)
+void X64Emitter::bind(Label & label)
+{
+    assert(label._position == Label::_Unbound);
+    label._position = _size;
+    for (size_t fixup : label._fixups)
+    {
+        _patchRel32(fixup, _size);
+    }
+    label._fixups.clear();
+}
+
+void X64Emitter::jmp(Label & label)
+{
+    _emitByte(0xE9);
+    _emitRel32(label);
+}
+
+void X64Emitter::jmp(const uint8_t * target)
+{
+    _emitByte(0xE9);
+    //  The displacement is relative to the end of the instruction
+    _emitInt32(static_cast<int32_t>(target - (currentAddress() + 4)));
+}
+
+void X64Emitter::jmp(Register target)
+{
+    _emitRex(false, 0, 0, static_cast<unsigned>(target));
+    _emitByte(0xFF);
+    _emitModRm(4, target);
+}
+
+void X64Emitter::jcc(Condition condition, Label & label)
+{
+    _emitByte(0x0F);
+    _emitByte(0x80 + static_cast<unsigned>(condition));
+    _emitRel32(label);
+}
+
+void X64Emitter::call(Register target)
+{
+    _emitRex(false, 0, 0, static_cast<unsigned>(target));
+    _emitByte(0xFF);
+    _emitModRm(2, target);
+}
+
+void X64Emitter::ret()
+{
+    _emitByte(0xC3);
+}
+
+//////////
+//  X64Emitter - Implementation helpers
+void X64Emitter::_emitByte(unsigned value)
+{
+    if (_size == _capacity)
+    {   //  OOPS! Keep the bytes emitted so far, but report the overflow
+        _overflowed = true;
+        return;
+    }
+    _buffer[_size++] = static_cast<uint8_t>(value);
+}
+
+void X64Emitter::_emitInt32(int32_t value)
+{
+    uint32_t bits = static_cast<uint32_t>(value);
+    for (unsigned i = 0; i < 4; i++)
+    {
+        _emitByte((bits >> (i * 8)) & 0xFF);
+    }
+}
+
+void X64Emitter::_emitRex(bool w, unsigned reg, unsigned index, unsigned base, bool forceRex)
+{
+    unsigned rex = (w ? 0x08u : 0x00u) | ((reg & 0x08) >> 1) | ((index & 0x08) >> 2) | ((base & 0x08) >> 3);
+    if (rex != 0 || forceRex)
+    {
+        _emitByte(0x40 | rex);
+    }
+}
+
+void X64Emitter::_emitModRm(unsigned reg, Register rm)
+{
+    _emitByte(0xC0 | ((reg & 0x07) << 3) | (static_cast<unsigned>(rm) & 0x07));
+}
+
+void X64Emitter::_emitModRm(unsigned reg, const Memory & rm)
+{   //  Always mod = 10 (disp32), which also avoids the RIP-relative
+    //  meaning of rm = 101; rm = 100 needs a SIB byte with no index
+    _emitByte(0x80 | ((reg & 0x07) << 3) | (static_cast<unsigned>(rm.base) & 0x07));
+    if ((static_cast<unsigned>(rm.base) & 0x07) == 0x04)
+    {
+        _emitByte(0x24);
+    }
+    _emitInt32(rm.displacement);
+}
+
+void X64Emitter::_emitRel32(Label & label)
+{
+    size_t position = _size;
+    _emitInt32(0);
+    if (_overflowed)
+    {
+        return;
+    }
+    if (label._position != Label::_Unbound)
+    {
+        _patchRel32(position, label._position);
+    }
+    else
+    {
+        label._fixups.push_back(position);
+    }
+}
+
+void X64Emitter::_patchRel32(size_t position, size_t target)
+{
+    if (position + 4 > _size)
+    {   //  The rel32 field itself has not fitted
+        return;
+    }
+    //  The displacement is relative to the end of the rel32 field
+    uint32_t displacement = static_cast<uint32_t>(static_cast<int64_t>(target) - static_cast<int64_t>(position + 4));
+    for (unsigned i = 0; i < 4; i++)
+    {
+        _buffer[position + i] = static_cast<uint8_t>(displacement >> (i * 8));
+    }
+}
+
+//  End of hadesvm-cereon/X64Emitter.cpp
@@ -0,0 +1,211 @@
+//
+//  hadesvm-cereon/X64Emitter.hpp
+//
+//  x86-64 machine code emission for the translating execution engine
+//
+//  Unlike the rest of hadesvm-cereon, this header depends on the standard
+//  library only, so that the emitter can be built and checked without Qt.
+//
+//////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//  Defined if the host can run code emitted by X64Emitter (the System V
+//  calling convention and mmap/mprotect are assumed); on other hosts the
+//  classes below still compile, but X64CodeCache::isSupported() is false
+#if defined(__x86_64__) && defined(__linux__)
+    #define HADESVM_CEREON_X64_HOST
+#endif
+
+namespace hadesvm
+{
+    namespace cereon
+    {
+        //////////
+        //  A region of host memory for emitted code. The region is never
+        //  writable and executable at the same time: it is made writable by
+        //  beginWriting() and executable again by endWriting(). Code is
+        //  allocated from the region bottom up and only released all at once.
+        class X64CodeCache final
+        {
+            //////////
+            //  Construction/destruction/assignment
+        public:
+            explicit X64CodeCache(size_t capacity);
+            ~X64CodeCache() noexcept;
+
+            X64CodeCache(const X64CodeCache &) = delete;
+            X64CodeCache & operator = (const X64CodeCache &) = delete;
+
+            //////////
+            //  Operations
+        public:
+            //  True if the region has been allocated and can hold executable code
+            bool                isSupported() const { return _base != nullptr; }
+
+            //  The free part of the region
+            uint8_t *           allocationPoint() const { return _base + _used; }
+            size_t              bytesAvailable() const { return _capacity - _used; }
+
+            //  Allocates "size" bytes at the allocation point (which the
+            //  caller has just written code into)
+            void                commit(size_t size);
+
+            //  Releases all code above "used" bytes from the region start
+            void                release(size_t used);
+
+            //  Switches the region between writable and executable
+            bool                beginWriting();
+            bool                endWriting();
+
+            //////////
+            //  Implementation
+        private:
+            uint8_t *           _base;      //  nullptr == region is not available
+            size_t              _capacity;  //  ...in bytes
+            size_t              _used;      //  ...in bytes, from _base
+        };
+
+        //////////
+        //  Emits x86-64 instructions into a buffer. Memory operands are always
+        //  [base + disp32]. If the buffer fills up, the emitter stops writing
+        //  and reports overflowed() instead, so that the caller can make room
+        //  and start over.
+        class X64Emitter final
+        {
+            //////////
+            //  Types
+        public:
+            enum class Register : uint8_t
+            {
+                Rax = 0, Rcx = 1, Rdx = 2, Rbx = 3, Rsp = 4, Rbp = 5, Rsi = 6, Rdi = 7,
+                R8 = 8, R9 = 9, R10 = 10, R11 = 11, R12 = 12, R13 = 13, R14 = 14, R15 = 15
+            };
+
+            //  ...with the encoding of the "tttn" field
+            enum class Condition : uint8_t
+            {
+                Overflow = 0x0,
+                Below = 0x2,            //  unsigned <
+                AboveOrEqual = 0x3,     //  unsigned >=
+                Equal = 0x4,
+                NotEqual = 0x5,
+                BelowOrEqual = 0x6,     //  unsigned <=
+                Above = 0x7,            //  unsigned >
+                Less = 0xC,             //  signed <
+                GreaterOrEqual = 0xD,   //  signed >=
+                LessOrEqual = 0xE,      //  signed <=
+                Greater = 0xF           //  signed >
+            };
+
+            //  ...with the /digit of the "op r/m64, imm32" form; the opcodes
+            //  of the "op r64, r/m64" and "op r/m64, r64" forms follow from it
+            enum class AluOperation : uint8_t
+            {
+                Add = 0,
+                Or = 1,
+                And = 4,
+                Sub = 5,
+                Xor = 6,
+                Cmp = 7
+            };
+
+            struct Memory
+            {
+                Register        base;
+                int32_t         displacement;
+            };
+
+            //  A position in the emitted code that jumps can be made to
+            //  before it is known
+            class Label final
+            {
+                friend class X64Emitter;
+
+            public:
+                Label() : _position(_Unbound), _fixups() {}
+
+            private:
+                static const size_t _Unbound = SIZE_MAX;
+                size_t          _position;  //  _Unbound == not bound yet
+                std::vector<size_t> _fixups;    //  positions of rel32 fields that refer to the label
+            };
+
+            //////////
+            //  Construction/destruction/assignment
+        public:
+            X64Emitter(uint8_t * buffer, size_t capacity);
+            ~X64Emitter() noexcept = default;
+
+            X64Emitter(const X64Emitter &) = delete;
+            X64Emitter & operator = (const X64Emitter &) = delete;
+
+            //////////
+            //  Operations
+        public:
+            size_t              size() const { return _size; }
+            bool                overflowed() const { return _overflowed; }
+            const uint8_t *     currentAddress() const { return _buffer + _size; }
+
+            //  Data movement
+            void                mov(Register dst, Register src);
+            void                mov(Register dst, const Memory & src);
+            void                mov(const Memory & dst, Register src);
+            void                mov(Register dst, uint64_t imm);
+            void                mov(const Memory & dst, int32_t imm);   //  sign-extended to 64 bits
+            void                mov32(Register dst, Register src);      //  zero-extends to 64 bits
+            void                lea(Register dst, const Memory & src);
+            void                movzxByte(Register dst, Register src);
+            void                setcc(Condition condition, Register dst);   //  8-bit destination
+            void                push(Register src);
+            void                pop(Register dst);
+
+            //  Arithmetic and logic, all 64-bit
+            void                alu(AluOperation operation, Register dst, Register src);
+            void                alu(AluOperation operation, Register dst, const Memory & src);
+            void                alu(AluOperation operation, Register dst, int32_t imm);
+            void                alu(AluOperation operation, const Memory & dst, int32_t imm);
+            void                cmpByte(const Memory & op1, uint8_t imm);
+            void                inc(const Memory & dst);
+            void                shr(Register dst, uint8_t count);
+            void                test32(Register op1, Register op2);
+
+            //  Control flow
+            void                bind(Label & label);
+            void                jmp(Label & label);
+            void                jmp(const uint8_t * target);    //  ...which must be within +/-2GB
+            void                jmp(Register target);
+            void                jcc(Condition condition, Label & label);
+            void                call(Register target);
+            void                ret();
+
+            //  True if "imm" can be an operand of the imm32 forms above
+            static bool         fitsInt32(uint64_t imm)
+            {
+                return static_cast<int64_t>(imm) >= INT32_MIN && static_cast<int64_t>(imm) <= INT32_MAX;
+            }
+
+            //////////
+            //  Implementation
+        private:
+            uint8_t *           _buffer;
+            size_t              _capacity;
+            size_t              _size;
+            bool                _overflowed;
+
+            //  Helpers
+            void                _emitByte(unsigned value);
+            void                _emitInt32(int32_t value);
+            void                _emitRex(bool w, unsigned reg, unsigned index, unsigned base, bool forceRex = false);
+            void                _emitModRm(unsigned reg, Register rm);
+            void                _emitModRm(unsigned reg, const Memory & rm);
+            void                _emitRel32(Label & label);
+            void                _patchRel32(size_t position, size_t target);
+        };
+    }
+}
+
+//  End of hadesvm-cereon/X64Emitter.hpp
@@ -7,8 +7,10 @@ SOURCES += \
     Alu.cpp \
     Architectures.cpp \
     Cereon1P1B.cpp \
+    Cereon1P1V.cpp \
     Cmos1.cpp \
     Cmos1Editor.cpp \
+    ExecutionEngine.cpp \
     Fdc1Controller.cpp \
     Fdc1ControllerEditor.cpp \
     Fdc1FloppyDrive.cpp \
@@ -27,25 +29,31 @@ SOURCES += \
     Kis1UnitedKingdomKeyboardLayout.cpp \
     MemoryBus.cpp \
     MemoryBusEditor.cpp \
+    PagedMmu.cpp \
     Plugins.cpp \
     Processor.cpp \
     ProcessorCore.Base.cpp \
     ProcessorCore.FloatingPoint.cpp \
+    ProcessorCore.Threaded.cpp \
+    ProcessorCore.Translated.cpp \
     ProcessorCore.cpp \
     ProcessorEditor.cpp \
+    Profiler.cpp \
     ResidentMemoryUnit.cpp \
     ResidentRamUnit.cpp \
     ResidentRamUnitEditor.cpp \
     ResidentRomUnit.cpp \
     ResidentRomUnitEditor.cpp \
     Templates.cpp \
+    Tracer.cpp \
     Vds1Controller.Compartment.cpp \
     Vds1Controller.VideoSignal.cpp \
     Vds1Controller.cpp \
     Vds1ControllerEditor.cpp \
     Vds1Display.cpp \
     Vds1DisplayEditor.cpp \
-    Vds1DisplayWidget.cpp
+    Vds1DisplayWidget.cpp \
+    X64Emitter.cpp
 
 HEADERS += \
     API.hpp \
@@ -69,13 +77,16 @@ HEADERS += \
     Processor.hpp \
     ProcessorCore.hpp \
     ProcessorEditor.hpp \
+    Profiler.hpp \
     ResidentRamUnitEditor.hpp \
     ResidentRomUnitEditor.hpp \
     Templates.hpp \
+    Tracer.hpp \
     Vds1.hpp \
     Vds1ControllerEditor.hpp \
     Vds1DisplayEditor.hpp \
-    Vds1DisplayWidget.hpp
+    Vds1DisplayWidget.hpp \
+    X64Emitter.hpp
 
 LIBS += -L$$DESTDIR -lhadesvm-ieee754 -lhadesvm-core -lhadesvm-util
 
@@ -17,10 +17,13 @@
 
 #include "hadesvm-core/Exceptions.hpp"
 #include "hadesvm-core/Types.hpp"
+#include "hadesvm-core/Snapshot.hpp"
 
 #include "hadesvm-core/ComponentCategory.hpp"
 #include "hadesvm-core/ComponentType.hpp"
 #include "hadesvm-core/Component.hpp"
+#include "hadesvm-core/ClockScheduler.hpp"
+#include "hadesvm-core/ProcessorPacer.hpp"
 #include "hadesvm-core/ComponentEditor.hpp"
 
 #include "hadesvm-core/DisplayWidget.hpp"
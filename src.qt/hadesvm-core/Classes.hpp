@@ -16,9 +16,15 @@ namespace hadesvm
         class HADESVM_CORE_PUBLIC ComponentAdaptor;
         class HADESVM_CORE_PUBLIC ComponentEditor;
 
+        class HADESVM_CORE_PUBLIC SnapshotWriter;
+        class HADESVM_CORE_PUBLIC SnapshotReader;
+        class HADESVM_CORE_PUBLIC LazyMemoryRestorer;
+
         class HADESVM_CORE_PUBLIC DisplayWidget;
         class HADESVM_CORE_PUBLIC StatusBarWidget;
 
+        class HADESVM_CORE_PUBLIC ClockScheduler;
+        class HADESVM_CORE_PUBLIC ProcessorPacer;
         class HADESVM_CORE_PUBLIC VirtualArchitecture;
         class HADESVM_CORE_PUBLIC VirtualApplianceType;
         class HADESVM_CORE_PUBLIC VirtualMachineType;
@@ -0,0 +1,293 @@
+//
+//  hadesvm-core/ClockScheduler.cpp
+//
+//  hadesvm::core::ClockScheduler class implementation
+//
+//////////
+#include "hadesvm-core/API.hpp"
+using namespace hadesvm::core;
+
+namespace
+{
+    const uint64_t NsPerSecond = UINT64_C(1000000000);
+}
+
+//////////
+//  Construction/destruction
+ClockScheduler::ClockScheduler()
+    :   _guard(),
+        _workAvailable(),
+        //  Virtual time
+        _running(false),
+        _startTime(0),
+        _elapsedTimer(),
+        _speedMultiplier(1.0),
+        _unthrottled(false),
+        //  Wake-ups & events
+        _wakeUps(),
+        _scheduledWakeUps(),
+        _nextSequence(0),
+        _postedEvents(),
+        _dispatching(false),
+        _dispatchDone()
+{
+}
+
+//////////
+//  Operations
+uint64_t ClockScheduler::now() const
+{
+    QMutexLocker lock(&_guard);
+
+    return _now();
+}
+
+void ClockScheduler::scheduleWakeUp(IScheduledComponent * component, uint64_t clockTicks)
+{
+    Q_ASSERT(component != nullptr);
+
+    QMutexLocker lock(&_guard);
+
+    uint64_t delay = clockTicksToNs(component->clockFrequency(), clockTicks);
+    uint64_t now = _now();
+    _WakeUp wakeUp { (delay < UINT64_MAX - now) ? now + delay : UINT64_MAX, _nextSequence++, component };
+    _scheduledWakeUps.insert(component, wakeUp);
+    _wakeUps.append(wakeUp);
+    std::push_heap(_wakeUps.begin(), _wakeUps.end(), _isLater);
+    //  Replaced wake-ups can pile up if a component keeps rescheduling
+    //  ahead of time; it's cheaper to drop them all at once now and then
+    if (_wakeUps.size() > 2 * _scheduledWakeUps.size() + 64)
+    {
+        _wakeUps = _scheduledWakeUps.values();
+        std::make_heap(_wakeUps.begin(), _wakeUps.end(), _isLater);
+    }
+    _workAvailable.wakeAll();
+    _dispatchDone.wakeAll();    //  a wake-up may have been replaced
+}
+
+uint64_t ClockScheduler::cancelWakeUp(IScheduledComponent * component)
+{
+    Q_ASSERT(component != nullptr);
+
+    QMutexLocker lock(&_guard);
+
+    auto it = _scheduledWakeUps.find(component);
+    if (it == _scheduledWakeUps.end())
+    {   //  Nothing to cancel
+        return 0;
+    }
+    uint64_t deadline = it->deadline;
+    _scheduledWakeUps.erase(it);    //  ...which makes the heap entry stale
+    _dispatchDone.wakeAll();
+    uint64_t now = _now();
+    return (deadline > now) ? nsToClockTicks(component->clockFrequency(), deadline - now) : 0;
+}
+
+void ClockScheduler::postEvent(IScheduledComponent * component)
+{
+    Q_ASSERT(component != nullptr);
+
+    QMutexLocker lock(&_guard);
+
+    if (!_postedEvents.contains(component))
+    {
+        _postedEvents.append(component);
+        _workAvailable.wakeAll();
+    }
+}
+
+uint64_t ClockScheduler::nextWakeUpTime()
+{
+    QMutexLocker lock(&_guard);
+
+    _discardStaleWakeUps();
+    return _wakeUps.isEmpty() ? UINT64_MAX : _wakeUps.first().deadline;
+}
+
+void ClockScheduler::advanceTo(uint64_t virtualTime)
+{
+    QMutexLocker lock(&_guard);
+
+    if (!_running || !_unthrottled)
+    {   //  Virtual time keeps up with host time by itself
+        return;
+    }
+    if (virtualTime > _startTime)
+    {
+        _startTime = virtualTime;
+        _workAvailable.wakeAll();
+    }
+    //  Wait for the wake-ups due by "virtualTime" to be dispatched
+    for (; ; )
+    {
+        _discardStaleWakeUps();
+        bool wakeUpDue = !_wakeUps.isEmpty() && _wakeUps.first().deadline <= virtualTime;
+        if ((!wakeUpDue && !_dispatching) || !_running || !_unthrottled)
+        {
+            break;
+        }
+        _dispatchDone.wait(&_guard);
+    }
+}
+
+uint64_t ClockScheduler::clockTicksToNs(const ClockFrequency & clockFrequency, uint64_t clockTicks)
+{
+    uint64_t hz = clockFrequency.toHz();
+    if (hz == 0)
+    {   //  A stopped clock never ticks
+        return (clockTicks == 0) ? 0 : UINT64_MAX;
+    }
+    //  Whole seconds and the rest are converted separately to avoid overflow
+    uint64_t seconds = clockTicks / hz;
+    if (seconds >= UINT64_MAX / NsPerSecond)
+    {   //  Too far in the future to matter
+        return UINT64_MAX;
+    }
+    return seconds * NsPerSecond + ((clockTicks % hz) * NsPerSecond + hz - 1) / hz;
+}
+
+uint64_t ClockScheduler::nsToClockTicks(const ClockFrequency & clockFrequency, uint64_t ns)
+{
+    uint64_t hz = clockFrequency.toHz();
+    uint64_t seconds = ns / NsPerSecond;
+    if (hz != 0 && seconds >= UINT64_MAX / hz)
+    {   //  Too far in the future to matter
+        return UINT64_MAX;
+    }
+    return seconds * hz + ((ns % NsPerSecond) * hz + NsPerSecond - 1) / NsPerSecond;
+}
+
+//////////
+//  Implementation helpers
+bool ClockScheduler::_isLater(const _WakeUp & a, const _WakeUp & b)
+{   //  Orders the heap so that the earliest wake-up comes first
+    return (a.deadline != b.deadline) ? (a.deadline > b.deadline) : (a.sequence > b.sequence);
+}
+
+uint64_t ClockScheduler::_now() const
+{
+    if (!_running || _unthrottled)
+    {   //  Virtual time stands still or is advanced by advanceTo()
+        return _startTime;
+    }
+    return _startTime + static_cast<uint64_t>(static_cast<double>(_elapsedTimer.nsecsElapsed()) * _speedMultiplier);
+}
+
+bool ClockScheduler::_isCurrent(const _WakeUp & wakeUp) const
+{
+    auto it = _scheduledWakeUps.constFind(wakeUp.component);
+    return it != _scheduledWakeUps.cend() && it->sequence == wakeUp.sequence;
+}
+
+void ClockScheduler::_discardStaleWakeUps()
+{
+    while (!_wakeUps.isEmpty() && !_isCurrent(_wakeUps.first()))
+    {
+        std::pop_heap(_wakeUps.begin(), _wakeUps.end(), _isLater);
+        _wakeUps.removeLast();
+    }
+}
+
+void ClockScheduler::_setSpeed(double speedMultiplier, bool unthrottled)
+{
+    Q_ASSERT(speedMultiplier > 0);
+
+    QMutexLocker lock(&_guard);
+
+    if (_running)
+    {   //  Virtual time so far was at the old speed
+        _startTime = _now();
+        _elapsedTimer.restart();
+    }
+    _speedMultiplier = speedMultiplier;
+    _unthrottled = unthrottled;
+    //  Deadlines now fall due at different host times, and
+    //  advanceTo() may no longer need to wait
+    _workAvailable.wakeAll();
+    _dispatchDone.wakeAll();
+}
+
+void ClockScheduler::_reset()
+{
+    QMutexLocker lock(&_guard);
+
+    Q_ASSERT(!_running);
+    _startTime = 0;
+    _wakeUps.clear();
+    _scheduledWakeUps.clear();
+    _postedEvents.clear();
+}
+
+void ClockScheduler::_run(const std::atomic<bool> & stopRequested)
+{
+    QMutexLocker lock(&_guard);
+
+    //  Start the clock...
+    Q_ASSERT(!_running);
+    _elapsedTimer.start();
+    _running = true;
+
+    //  ...keep dispatching...
+    while (!stopRequested)
+    {
+        //  Events are handled first - something has happened already
+        if (!_postedEvents.isEmpty())
+        {
+            IScheduledComponent * component = _postedEvents.takeFirst();
+            _dispatching = true;
+            lock.unlock();
+            component->onEvent();
+            lock.relock();
+            _dispatching = false;
+            _dispatchDone.wakeAll();
+            continue;
+        }
+        //  Is the earliest wake-up due ?
+        _discardStaleWakeUps();
+        if (_wakeUps.isEmpty())
+        {   //  Nothing to do until something is scheduled or posted
+            _workAvailable.wait(&_guard);
+            continue;
+        }
+        uint64_t now = _now();
+        const _WakeUp & earliest = _wakeUps.first();
+        if (earliest.deadline > now)
+        {
+            if (_unthrottled)
+            {   //  Sleep until advanceTo() gets there, unless something else comes up
+                _workAvailable.wait(&_guard);
+                continue;
+            }
+            //  Sleep until then (in host time), unless something else comes up
+            double hostNs = static_cast<double>(earliest.deadline - now) / _speedMultiplier;
+            QDeadlineTimer deadline(Qt::PreciseTimer);
+            deadline.setPreciseRemainingTime(0, static_cast<qint64>(qBound(1.0, hostNs, static_cast<double>(NsPerSecond))), Qt::PreciseTimer);
+            _workAvailable.wait(&_guard, deadline);
+            continue;
+        }
+        IScheduledComponent * component = earliest.component;
+        _scheduledWakeUps.remove(component);
+        std::pop_heap(_wakeUps.begin(), _wakeUps.end(), _isLater);
+        _wakeUps.removeLast();
+        _dispatching = true;
+        lock.unlock();
+        component->onWakeUp();
+        lock.relock();
+        _dispatching = false;
+        _dispatchDone.wakeAll();
+    }
+
+    //  ...and stop the clock
+    _startTime = _now();
+    _running = false;
+    _dispatchDone.wakeAll();
+}
+
+void ClockScheduler::_interrupt()
+{
+    QMutexLocker lock(&_guard);
+
+    _workAvailable.wakeAll();
+}
+
+//  End of hadesvm-core/ClockScheduler.cpp
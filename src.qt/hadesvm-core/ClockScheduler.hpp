@@ -0,0 +1,129 @@
+//
+//  hadesvm-core/ClockScheduler.hpp
+//
+//  hadesvm-core VA master clock scheduler
+//
+//////////
+
+namespace hadesvm
+{
+    namespace core
+    {
+        //////////
+        //  The master clock of a VA. Keeps the VA's virtual time and wakes
+        //  up "scheduled components" (see IScheduledComponent) when their
+        //  wake-ups are due or events have been posted to them, on the VA's
+        //  worker thread. Between these, the worker thread sleeps.
+        //  Virtual time is measured in nanoseconds since the VA was started;
+        //  it runs while the VA's worker thread runs and stands still
+        //  otherwise (e.g. while a snapshot is being saved).
+        //  Normally virtual time runs at a fixed multiple of host time (1.0
+        //  being real time). An "unthrottled" clock instead lets the VA run
+        //  as fast as the host allows: virtual time then only advances as the
+        //  processors advance it, and they wait for the wake-ups due by then
+        //  to be dispatched, so that all components stay in step.
+        //  All public methods can be called from any thread.
+        class HADESVM_CORE_PUBLIC ClockScheduler final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ClockScheduler)
+
+            friend class VirtualAppliance;
+
+            //////////
+            //  Construction/destruction
+        private:
+            ClockScheduler();
+        public:
+            ~ClockScheduler() = default;
+
+            //////////
+            //  Operations
+        public:
+            //  The current virtual time, in nanoseconds.
+            uint64_t                now() const;
+
+            //  Asks for the "component"'s onWakeUp() to be called once the
+            //  specified number of its clock ticks have elapsed, replacing
+            //  the wake-up scheduled for the "component" earlier (if any).
+            void                    scheduleWakeUp(IScheduledComponent * component, uint64_t clockTicks);
+
+            //  Cancels the wake-up scheduled for the "component" and returns
+            //  the number of its clock ticks that were still to elapse before
+            //  it (0 if no wake-up was scheduled or it is already due).
+            uint64_t                cancelWakeUp(IScheduledComponent * component);
+
+            //  Asks for the "component"'s onEvent() to be called as soon as
+            //  practicable. Events posted to a component before its onEvent()
+            //  is called are merged into one.
+            void                    postEvent(IScheduledComponent * component);
+
+            //  Converts between clock ticks at the specified clock frequency
+            //  and nanoseconds of virtual time, rounding up
+            static uint64_t         clockTicksToNs(const ClockFrequency & clockFrequency, uint64_t clockTicks);
+            static uint64_t         nsToClockTicks(const ClockFrequency & clockFrequency, uint64_t ns);
+
+            //  The rate of virtual time relative to host time, and whether the
+            //  clock is unthrottled (see above); set up by the VA
+            double                  speedMultiplier() const { return _speedMultiplier; }
+            bool                    isUnthrottled() const { return _unthrottled; }
+
+            //  The virtual time of the earliest scheduled wake-up; UINT64_MAX
+            //  if none
+            uint64_t                nextWakeUpTime();
+
+            //  If the clock is running unthrottled, advances the virtual time
+            //  to at least "virtualTime" and returns once all wake-ups due by
+            //  then have been dispatched. Otherwise has no effect.
+            void                    advanceTo(uint64_t virtualTime);
+
+            //////////
+            //  Implementation
+        private:
+            mutable QMutex          _guard;
+            QWaitCondition          _workAvailable;
+
+            //  Virtual time
+            bool                    _running;
+            uint64_t                _startTime;     //  virtual time when the clock was last (re)started...
+            QElapsedTimer           _elapsedTimer;  //  ...and the host time since then (unless unthrottled)
+            std::atomic<double>     _speedMultiplier;
+            std::atomic<bool>       _unthrottled;
+
+            //  Wake-ups form a binary heap, the earliest one being the first.
+            //  A wake-up that is cancelled or replaced is left in the heap,
+            //  but no longer matches the component's entry in the map.
+            struct _WakeUp
+            {
+                uint64_t            deadline;   //  virtual time
+                uint64_t            sequence;   //  tells the replaced wake-ups apart
+                IScheduledComponent*component;
+            };
+            QList<_WakeUp>          _wakeUps;
+            QHash<IScheduledComponent*, _WakeUp>    _scheduledWakeUps;
+            uint64_t                _nextSequence;
+
+            QList<IScheduledComponent*> _postedEvents;  //  in posting order
+
+            //  Lets advanceTo() wait for the dispatching to catch up
+            bool                    _dispatching;   //  a component is being called
+            QWaitCondition          _dispatchDone;
+
+            //  Helpers (all but _isLater() must be called with _guard locked)
+            static bool             _isLater(const _WakeUp & a, const _WakeUp & b);
+            uint64_t                _now() const;
+            bool                    _isCurrent(const _WakeUp & wakeUp) const;
+            void                    _discardStaleWakeUps();
+
+            //  Used by the VA. A VA's worker thread calls _run(), which
+            //  starts the clock, dispatches wake-ups and events until the
+            //  "stopRequested" becomes true (_interrupt() is then called to
+            //  make it notice at once) and stops the clock.
+            void                    _setSpeed(double speedMultiplier, bool unthrottled);
+            void                    _reset();
+            void                    _run(const std::atomic<bool> & stopRequested);
+            void                    _interrupt();
+        };
+    }
+}
+
+//  End of hadesvm-core/ClockScheduler.hpp
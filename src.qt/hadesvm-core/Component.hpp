@@ -237,6 +237,49 @@ namespace hadesvm
             virtual void            onClockTick() noexcept = 0;
         };
 
+        //////////
+        //  A "scheduled component (or adapter)" is a clocked component that
+        //  only has work to do at specific points in time or when something
+        //  happens. Instead of having its onClockTick() called on every clock
+        //  tick, it asks the VA's ClockScheduler to wake it up after a number
+        //  of its clock ticks, or posts an event to itself (see ClockScheduler).
+        class HADESVM_CORE_PUBLIC IScheduledComponent : public virtual IClockedComponent
+        {
+            //////////
+            //  Operations
+        public:
+            //  Called on the VA's worker thread when the wake-up scheduled
+            //  by ClockScheduler::scheduleWakeUp() is due
+            virtual void            onWakeUp() noexcept = 0;
+
+            //  Called on the VA's worker thread after an event has been
+            //  posted to this component by ClockScheduler::postEvent()
+            virtual void            onEvent() noexcept = 0;
+        };
+
+        //////////
+        //  A "snapshot component (or adapter)" has runtime state that can be
+        //  saved to a VA snapshot and later restored from one, so that a VA
+        //  can continue from exactly where its snapshot was taken.
+        class HADESVM_CORE_PUBLIC ISnapshotComponent : public virtual IComponent
+        {
+            //////////
+            //  Operations
+        public:
+            //  Saves the runtime state of an Initialized component.
+            //  Throws VirtualApplianceException if the component is in a
+            //  state that cannot be saved (e.g. is in the middle of a host I/O).
+            //  Must only be called from the QApplication's main thread
+            virtual void            saveSnapshot(SnapshotWriter & writer) throws(VirtualApplianceException) = 0;
+
+            //  Restores the runtime state of a freshly Initialized component
+            //  from the data written by saveSnapshot().
+            //  Throws VirtualApplianceException if the saved state does not
+            //  fit the component's configuration.
+            //  Must only be called from the QApplication's main thread
+            virtual void            restoreSnapshot(SnapshotReader & reader) throws(VirtualApplianceException) = 0;
+        };
+
         //////////
         //  An "active component (or adapter)" has its own thread of control
         //  (normally created/started by IComponent's "start()" method and
@@ -0,0 +1,147 @@
+//
+//  hadesvm-core/ProcessorPacer.cpp
+//
+//  hadesvm::core::ProcessorPacer class implementation
+//
+//////////
+#include "hadesvm-core/API.hpp"
+using namespace hadesvm::core;
+
+//////////
+//  Construction/destruction
+ProcessorPacer::ProcessorPacer(IClockedComponent * processor, bool recordsClockFrequency, bool advancesVirtualTime)
+    :   _processor(processor),
+        _recordsClockFrequency(recordsClockFrequency),
+        _advancesVirtualTime(advancesVirtualTime),
+        _wakeUpSemaphore()
+{
+    Q_ASSERT(_processor != nullptr);
+}
+
+//////////
+//  Operations
+void ProcessorPacer::pace(const std::atomic<bool> & stopRequested)
+{
+    VirtualAppliance * virtualAppliance = _processor->virtualAppliance();
+    ClockScheduler * clockScheduler = virtualAppliance->clockScheduler();
+    ClockFrequency clockFrequency = _processor->clockFrequency();
+    uint64_t requiredClockFrequencyHz = clockFrequency.toHz();
+    unsigned ticksBetweenDelayAdjustment = static_cast<unsigned>(qMin(qMax(UINT64_C(1), requiredClockFrequencyHz / 10), static_cast<uint64_t>(UINT_MAX)));
+    unsigned delayPerTickNs = 0;
+    uint64_t accumulatedDelayNs = 0;
+
+    uint64_t ticksSinceLastRecord = 0;
+    uint64_t nsSinceLastRecord = 0;
+
+    QElapsedTimer elapsedTimer;
+    while (!stopRequested)
+    {
+        beforeRunningCycles();
+
+        if (_recordsClockFrequency && nsSinceLastRecord >= 1000000000)
+        {
+            virtualAppliance->recordAchievedClockFrequency(
+                _processor,
+                ClockFrequency::hertz(static_cast<uint64_t>(static_cast<double>(ticksSinceLastRecord) * 1e9 / static_cast<double>(nsSinceLastRecord))));
+            ticksSinceLastRecord = 0;
+            nsSinceLastRecord = 0;
+        }
+
+        if (clockScheduler->isUnthrottled())
+        {   //  Run flat out. When advancing virtual time, run only up to
+            //  the next wake-up of a device, which must have been
+            //  dispatched before the processor goes on
+            uint64_t now = clockScheduler->now();
+            uint64_t ticksToRun = ticksBetweenDelayAdjustment;
+            if (_advancesVirtualTime)
+            {
+                uint64_t nextWakeUpTime = clockScheduler->nextWakeUpTime();
+                ticksToRun = (nextWakeUpTime > now) ?
+                    qMax(UINT64_C(1), qMin(ticksToRun, ClockScheduler::nsToClockTicks(clockFrequency, nextWakeUpTime - now))) :
+                    1;
+            }
+            elapsedTimer.restart();
+            unsigned ticksRun = runCycles(static_cast<unsigned>(ticksToRun));
+            if (_advancesVirtualTime)
+            {
+                clockScheduler->advanceTo(now + ClockScheduler::clockTicksToNs(clockFrequency, ticksRun));
+            }
+            ticksSinceLastRecord += ticksRun;
+            nsSinceLastRecord += static_cast<uint64_t>(elapsedTimer.nsecsElapsed());
+            if (ticksRun < ticksToRun)
+            {   //  Stop requested
+                break;
+            }
+            //  Pacing starts over if the VA is throttled again
+            delayPerTickNs = 0;
+            accumulatedDelayNs = 0;
+            continue;
+        }
+
+        //  The pace is the clock frequency times the VA's speed multiplier
+        double requiredNsPerTick = 1000000000.0 / (static_cast<double>(requiredClockFrequencyHz) * clockScheduler->speedMultiplier());
+
+        //  If the processor is idle for long enough, skip the idle clock
+        //  cycles at once and let the host thread sleep meanwhile. Wake-ups
+        //  that arrived before the processor was seen idle are moot by now.
+        _wakeUpSemaphore.tryAcquire(_wakeUpSemaphore.available());
+        uint64_t skippableCycles = qMin(idleCycles(), static_cast<uint64_t>(ticksBetweenDelayAdjustment));
+        uint64_t idleMs = static_cast<uint64_t>(static_cast<double>(skippableCycles) * requiredNsPerTick / 1000000);
+        if (idleMs > 0)
+        {
+            elapsedTimer.restart();
+            _wakeUpSemaphore.tryAcquire(1, static_cast<int>(idleMs));
+            qint64 actualNsElapsed = elapsedTimer.nsecsElapsed();
+            uint64_t cyclesElapsed = static_cast<uint64_t>(static_cast<double>(actualNsElapsed) / requiredNsPerTick);
+            if (cyclesElapsed > 0)
+            {   //  The idle processor only counts its timers down
+                ticksSinceLastRecord += runCycles(static_cast<unsigned>(qMin(cyclesElapsed, skippableCycles)));
+            }
+            nsSinceLastRecord += static_cast<uint64_t>(actualNsElapsed);
+            continue;
+        }
+
+        //  Execute a bunch of instructions...
+        elapsedTimer.restart();
+        unsigned ticksRun = runCycles(ticksBetweenDelayAdjustment);
+        accumulatedDelayNs += static_cast<uint64_t>(delayPerTickNs) * ticksRun;
+        if (ticksRun < ticksBetweenDelayAdjustment)
+        {   //  Stop requested
+            break;
+        }
+        uint64_t accumulatedDelayMs = accumulatedDelayNs / 1000000;
+        accumulatedDelayNs -= 1000000 * accumulatedDelayMs;
+        if (accumulatedDelayMs > 0)
+        {
+            QThread::msleep(static_cast<unsigned long>(accumulatedDelayMs));
+        }
+
+        qint64 idealNsElapsed = static_cast<qint64>(requiredNsPerTick * ticksBetweenDelayAdjustment);
+        qint64 actualNsElapsed = elapsedTimer.nsecsElapsed();
+        ticksSinceLastRecord += ticksRun;
+        nsSinceLastRecord += static_cast<uint64_t>(actualNsElapsed);
+
+        //  Going too fast or too slow - take up half of the difference at
+        //  once, so that a change of speed is followed quickly, but never
+        //  less than 1ns per tick
+        qint64 adjustmentNs = (idealNsElapsed - actualNsElapsed) / (2 * static_cast<qint64>(ticksBetweenDelayAdjustment));
+        if (adjustmentNs == 0 && actualNsElapsed != idealNsElapsed)
+        {
+            adjustmentNs = (actualNsElapsed < idealNsElapsed) ? 1 : -1;
+        }
+        delayPerTickNs = static_cast<unsigned>(qBound(static_cast<qint64>(0),
+                                                      static_cast<qint64>(delayPerTickNs) + adjustmentNs,
+                                                      static_cast<qint64>(UINT_MAX)));
+    }
+}
+
+void ProcessorPacer::wakeUp()
+{
+    if (_wakeUpSemaphore.available() == 0)
+    {   //  A spurious extra wake-up (if we race with
+        //  another thread here) does no harm
+        _wakeUpSemaphore.release();
+    }
+}
+
+//  End of hadesvm-core/ProcessorPacer.cpp
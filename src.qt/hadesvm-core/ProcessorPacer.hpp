@@ -0,0 +1,80 @@
+//
+//  hadesvm-core/ProcessorPacer.hpp
+//
+//  hadesvm-core processor pacing
+//
+//////////
+
+namespace hadesvm
+{
+    namespace core
+    {
+        //////////
+        //  Paces the execution of a processor's clock cycles on the host
+        //  thread that runs them (usually one of the processor's worker
+        //  threads, which derives from both QThread and ProcessorPacer).
+        //  *   Throttled, the clock cycles are run in bunches of 1/10 s of
+        //      the processor's clock frequency times the VA's speed
+        //      multiplier, with delays in between that are adjusted after
+        //      each bunch to keep that pace. Idle clock cycles are skipped
+        //      at once, the thread sleeping meanwhile or until woken up.
+        //  *   Unthrottled, the clock cycles are run flat out. If the pacer
+        //      advances virtual time, it runs no further than the next
+        //      wake-up of a scheduled component, then advances the VA's
+        //      ClockScheduler past what it has run. Otherwise something
+        //      else must advance it (e.g. once all worker threads of a
+        //      processor have reached a common barrier).
+        //  The achieved clock frequency can be recorded once a second.
+        class HADESVM_CORE_PUBLIC ProcessorPacer
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ProcessorPacer)
+
+            //////////
+            //  Construction/destruction
+        public:
+            ProcessorPacer(IClockedComponent * processor, bool recordsClockFrequency, bool advancesVirtualTime);
+            virtual ~ProcessorPacer() = default;
+
+            //////////
+            //  Operations
+        public:
+            //  Runs the processor until "stopRequested" becomes true or
+            //  runCycles() runs fewer clock cycles than asked for.
+            //  Must be called from the host thread that runs the processor.
+            void                    pace(const std::atomic<bool> & stopRequested);
+
+            //  Wakes the pacer up if it sleeps through idle clock cycles.
+            //  Can be called from any thread.
+            void                    wakeUp();
+
+            //////////
+            //  Customisation
+        protected:
+            //  Runs the specified number of clock cycles; returns the number
+            //  of clock cycles actually run, which is less than requested
+            //  only if a stop has been requested
+            virtual unsigned        runCycles(unsigned numCycles) = 0;
+
+            //  The number of clock cycles the processor will stay idle for,
+            //  unless woken up; 0 if it is not idle
+            virtual uint64_t        idleCycles() = 0;
+
+            //  Called before each bunch of clock cycles is run
+            virtual void            beforeRunningCycles() {}
+
+            //////////
+            //  Implementation
+        private:
+            IClockedComponent *const    _processor;
+            const bool                  _recordsClockFrequency;
+            const bool                  _advancesVirtualTime;
+
+            //  When the processor is idle, the pacer skips the idle clock
+            //  cycles, sleeping for the host time they would take or until
+            //  woken up
+            QSemaphore                  _wakeUpSemaphore;
+        };
+    }
+}
+
+//  End of hadesvm-core/ProcessorPacer.hpp
@@ -0,0 +1,389 @@
+//
+//  hadesvm-core/Snapshot.cpp
+//
+//  hadesvm::core::SnapshotWriter, SnapshotReader & LazyMemoryRestorer class implementation
+//
+//////////
+#include "hadesvm-core/API.hpp"
+using namespace hadesvm::core;
+
+namespace
+{
+    bool isZeroPage(const uint8_t * data, size_t size)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            if (data[i] != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t memoryPageSize(size_t size, size_t pageIndex)
+    {
+        size_t pageSize = size - pageIndex * SnapshotWriter::MemoryPageSize;
+        if (pageSize > SnapshotWriter::MemoryPageSize)
+        {
+            pageSize = SnapshotWriter::MemoryPageSize;
+        }
+        return pageSize;
+    }
+
+    //  Memory pages are compressed/decompressed in batches of this many
+    //  pages - enough to keep all host cores busy, few enough not to
+    //  hold much of guest memory twice
+    size_t memoryPageBatchSize()
+    {
+        return static_cast<size_t>(qMax(1, QThread::idealThreadCount())) * 4;
+    }
+}
+
+//////////
+//  SnapshotWriter
+SnapshotWriter::SnapshotWriter(QDataStream & stream)
+    :   _stream(stream)
+{
+}
+
+SnapshotWriter & SnapshotWriter::operator << (bool value)
+{
+    _stream << value;
+    return *this;
+}
+
+SnapshotWriter & SnapshotWriter::operator << (uint8_t value)
+{
+    _stream << static_cast<quint8>(value);
+    return *this;
+}
+
+SnapshotWriter & SnapshotWriter::operator << (uint16_t value)
+{
+    _stream << static_cast<quint16>(value);
+    return *this;
+}
+
+SnapshotWriter & SnapshotWriter::operator << (uint32_t value)
+{
+    _stream << static_cast<quint32>(value);
+    return *this;
+}
+
+SnapshotWriter & SnapshotWriter::operator << (uint64_t value)
+{
+    _stream << static_cast<quint64>(value);
+    return *this;
+}
+
+SnapshotWriter & SnapshotWriter::operator << (const QString & value)
+{
+    _stream << value;
+    return *this;
+}
+
+SnapshotWriter & SnapshotWriter::operator << (const QByteArray & value)
+{
+    _stream << value;
+    return *this;
+}
+
+void SnapshotWriter::writeBytes(const void * data, size_t size)
+{
+    _stream.writeRawData(static_cast<const char*>(data), static_cast<int>(size));
+}
+
+void SnapshotWriter::writeMemory(const uint8_t * data, size_t size)
+{
+    *this << static_cast<uint64_t>(size);
+
+    size_t numPages = (size + MemoryPageSize - 1) / MemoryPageSize;
+    size_t batchSize = memoryPageBatchSize();
+    QList<QByteArray> pages(static_cast<qsizetype>(batchSize));
+    QByteArray * pageData = pages.data();
+    QThreadPool threadPool;
+    for (size_t firstPage = 0; firstPage < numPages; firstPage += batchSize)
+    {
+        size_t numBatchPages = qMin(batchSize, numPages - firstPage);
+        //  Compress a batch of pages in parallel...
+        for (size_t i = 0; i < numBatchPages; i++)
+        {
+            threadPool.start([=]()
+                             {
+                                 size_t offset = (firstPage + i) * MemoryPageSize;
+                                 size_t pageSize = memoryPageSize(size, firstPage + i);
+                                 pageData[i] = isZeroPage(data + offset, pageSize) ?
+                                                    QByteArray() :
+                                                    qCompress(data + offset, static_cast<qsizetype>(pageSize), 1);
+                             });
+        }
+        threadPool.waitForDone();
+        //  ...and write them in order; an empty page is an all-zero page
+        for (size_t i = 0; i < numBatchPages; i++)
+        {
+            *this << pageData[i];
+        }
+    }
+}
+
+//////////
+//  SnapshotReader
+SnapshotReader::SnapshotReader(QDataStream & stream)
+    :   _stream(stream)
+{
+}
+
+SnapshotReader & SnapshotReader::operator >> (bool & value)
+{
+    _stream >> value;
+    return *this;
+}
+
+SnapshotReader & SnapshotReader::operator >> (uint8_t & value)
+{
+    quint8 v = 0;
+    _stream >> v;
+    value = v;
+    return *this;
+}
+
+SnapshotReader & SnapshotReader::operator >> (uint16_t & value)
+{
+    quint16 v = 0;
+    _stream >> v;
+    value = v;
+    return *this;
+}
+
+SnapshotReader & SnapshotReader::operator >> (uint32_t & value)
+{
+    quint32 v = 0;
+    _stream >> v;
+    value = v;
+    return *this;
+}
+
+SnapshotReader & SnapshotReader::operator >> (uint64_t & value)
+{
+    quint64 v = 0;
+    _stream >> v;
+    value = v;
+    return *this;
+}
+
+SnapshotReader & SnapshotReader::operator >> (QString & value)
+{
+    _stream >> value;
+    return *this;
+}
+
+SnapshotReader & SnapshotReader::operator >> (QByteArray & value)
+{
+    _stream >> value;
+    return *this;
+}
+
+void SnapshotReader::readBytes(void * data, size_t size)
+{
+    if (_stream.readRawData(static_cast<char*>(data), static_cast<int>(size)) != static_cast<int>(size))
+    {
+        _stream.setStatus(QDataStream::ReadPastEnd);
+        memset(data, 0, size);
+    }
+}
+
+void SnapshotReader::readMemory(uint8_t * data, size_t size) throws(VirtualApplianceException)
+{
+    uint64_t savedSize = 0;
+    *this >> savedSize;
+    if (!isGood() || savedSize != size)
+    {
+        throw VirtualApplianceException("Snapshot memory block size mismatch");
+    }
+
+    size_t numPages = (size + SnapshotWriter::MemoryPageSize - 1) / SnapshotWriter::MemoryPageSize;
+    size_t batchSize = memoryPageBatchSize();
+    QList<QByteArray> pages(static_cast<qsizetype>(batchSize));
+    const QByteArray * pageData = pages.constData();
+    std::atomic<bool> pagesGood = true;
+    QThreadPool threadPool;
+    for (size_t firstPage = 0; firstPage < numPages; firstPage += batchSize)
+    {
+        size_t numBatchPages = qMin(batchSize, numPages - firstPage);
+        //  Read a batch of pages...
+        for (size_t i = 0; i < numBatchPages; i++)
+        {
+            *this >> pages[static_cast<qsizetype>(i)];
+        }
+        if (!isGood())
+        {
+            throw VirtualApplianceException("Snapshot memory block is truncated");
+        }
+        //  ...and decompress its non-zero pages in parallel
+        for (size_t i = 0; i < numBatchPages; i++)
+        {
+            if (pageData[i].isEmpty())
+            {   //  All zeros - nothing to do
+                continue;
+            }
+            threadPool.start([=, &pagesGood]()
+                             {
+                                 size_t offset = (firstPage + i) * SnapshotWriter::MemoryPageSize;
+                                 size_t pageSize = memoryPageSize(size, firstPage + i);
+                                 QByteArray page = qUncompress(pageData[i]);
+                                 if (static_cast<size_t>(page.size()) != pageSize)
+                                 {
+                                     pagesGood = false;
+                                     return;
+                                 }
+                                 memcpy(data + offset, page.constData(), pageSize);
+                             });
+        }
+        threadPool.waitForDone();
+        if (!pagesGood)
+        {
+            throw VirtualApplianceException("Snapshot memory block is corrupt");
+        }
+    }
+}
+
+LazyMemoryRestorer * SnapshotReader::readMemoryLazily(uint8_t * data, size_t size) throws(VirtualApplianceException)
+{
+    return new LazyMemoryRestorer(data, size, _readMemoryPages(size));
+}
+
+//////////
+//  SnapshotReader - implementation helpers
+QList<QByteArray> SnapshotReader::_readMemoryPages(size_t size) throws(VirtualApplianceException)
+{
+    uint64_t savedSize = 0;
+    *this >> savedSize;
+    if (!isGood() || savedSize != size)
+    {
+        throw VirtualApplianceException("Snapshot memory block size mismatch");
+    }
+
+    size_t numPages = (size + SnapshotWriter::MemoryPageSize - 1) / SnapshotWriter::MemoryPageSize;
+    QList<QByteArray> pages(static_cast<qsizetype>(numPages));
+    for (size_t i = 0; i < numPages; i++)
+    {
+        QByteArray & page = pages[static_cast<qsizetype>(i)];
+        *this >> page;
+        //  qCompress() prefixes the data with its big-endian uncompressed
+        //  size, which is all that can be checked short of decompressing it
+        if (!page.isEmpty() &&
+            (page.size() < 4 ||
+             hadesvm::util::loadUnalignedWithByteOrder<uint32_t>(reinterpret_cast<const uint8_t*>(page.constData()), hadesvm::util::ByteOrder::BigEndian) != memoryPageSize(size, i)))
+        {
+            throw VirtualApplianceException("Snapshot memory block is corrupt");
+        }
+    }
+    if (!isGood())
+    {
+        throw VirtualApplianceException("Snapshot memory block is truncated");
+    }
+    return pages;
+}
+
+//////////
+//  LazyMemoryRestorer
+LazyMemoryRestorer::LazyMemoryRestorer(uint8_t * data, size_t size, const QList<QByteArray> & pages)
+    :   _data(data),
+        _size(size),
+        _pages(pages),
+        _pagesRestored(new std::atomic<bool>[static_cast<size_t>(pages.size())]),
+        _pagesLeft(0),
+        _done(false),
+        _onDone(),
+        _pagesGuard(),
+        _threadPool()
+{
+    Q_ASSERT(_data != nullptr);
+
+    //  All-zero pages are there already
+    size_t pagesLeft = 0;
+    for (qsizetype i = 0; i < _pages.size(); i++)
+    {
+        _pagesRestored[i] = _pages[i].isEmpty();
+        pagesLeft += _pages[i].isEmpty() ? 0 : 1;
+    }
+    _pagesLeft = pagesLeft;
+    _done = (pagesLeft == 0);
+}
+
+LazyMemoryRestorer::~LazyMemoryRestorer()
+{
+    _threadPool.waitForDone();
+    delete [] _pagesRestored;
+}
+
+//////////
+//  Operations
+void LazyMemoryRestorer::start(std::function<void()> onDone)
+{
+    _onDone = onDone;
+    for (qsizetype i = 0; i < _pages.size(); i++)
+    {
+        if (!_pagesRestored[i].load(std::memory_order_acquire))
+        {
+            _threadPool.start([this, i]() { ensureRestored(static_cast<size_t>(i) * SnapshotWriter::MemoryPageSize); });
+        }
+    }
+}
+
+void LazyMemoryRestorer::waitForDone()
+{
+    _threadPool.waitForDone();
+    //  Unless start() was called, there are pages left to restore
+    for (qsizetype i = 0; i < _pages.size(); i++)
+    {
+        ensureRestored(static_cast<size_t>(i) * SnapshotWriter::MemoryPageSize);
+    }
+    Q_ASSERT(isDone());
+}
+
+//////////
+//  Implementation helpers
+void LazyMemoryRestorer::_restorePage(size_t pageIndex)
+{
+    //  Decompress the page outside the lock, so that pages are decompressed
+    //  in parallel - if another thread beats us to it, the work is wasted
+    QByteArray compressedPage;
+    {
+        QMutexLocker lock(&_pagesGuard);
+        if (_pagesRestored[pageIndex].load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        compressedPage = _pages[static_cast<qsizetype>(pageIndex)];
+    }
+    size_t pageSize = memoryPageSize(_size, pageIndex);
+    QByteArray page = qUncompress(compressedPage);
+
+    {
+        QMutexLocker lock(&_pagesGuard);
+        if (_pagesRestored[pageIndex].load(std::memory_order_relaxed))
+        {   //  The page may have been modified since it was restored
+            return;
+        }
+        if (static_cast<size_t>(page.size()) == pageSize)
+        {   //  ...else it's corrupt and stays all zeros
+            memcpy(_data + pageIndex * SnapshotWriter::MemoryPageSize, page.constData(), pageSize);
+        }
+        _pages[static_cast<qsizetype>(pageIndex)] = QByteArray();
+        _pagesRestored[pageIndex].store(true, std::memory_order_release);
+        if (--_pagesLeft != 0)
+        {
+            return;
+        }
+        _done.store(true, std::memory_order_release);
+    }
+    //  Outside the lock, as the callback may take locks of its own
+    if (_onDone)
+    {
+        _onDone();
+    }
+}
+
+//  End of hadesvm-core/Snapshot.cpp
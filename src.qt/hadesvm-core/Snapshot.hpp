@@ -0,0 +1,189 @@
+//
+//  hadesvm-core/Snapshot.hpp
+//
+//  hadesvm-core VA snapshot support
+//
+//////////
+
+namespace hadesvm
+{
+    namespace core
+    {
+        //////////
+        //  Writes the runtime state of a single component into a VA snapshot.
+        //  Values are written in a portable binary form straight to the
+        //  snapshot file and must be read back by a SnapshotReader in the
+        //  same order.
+        class HADESVM_CORE_PUBLIC SnapshotWriter final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(SnapshotWriter)
+
+            friend class VirtualAppliance;
+
+            //////////
+            //  Constants
+        public:
+            //  Memory is written in pages of this many bytes
+            static const size_t MemoryPageSize = 65536;
+
+            //////////
+            //  Construction/destruction
+        private:
+            explicit SnapshotWriter(QDataStream & stream);
+        public:
+            ~SnapshotWriter() = default;
+
+            //////////
+            //  Operators
+        public:
+            SnapshotWriter &    operator << (bool value);
+            SnapshotWriter &    operator << (uint8_t value);
+            SnapshotWriter &    operator << (uint16_t value);
+            SnapshotWriter &    operator << (uint32_t value);
+            SnapshotWriter &    operator << (uint64_t value);
+            SnapshotWriter &    operator << (const QString & value);
+            SnapshotWriter &    operator << (const QByteArray & value);
+
+            //////////
+            //  Operations
+        public:
+            //  Writes the specified number of raw bytes
+            void                writeBytes(const void * data, size_t size);
+
+            //  Writes a block of (guest) memory. The pages of the block are
+            //  compressed in parallel, a batch at a time, so that only a few
+            //  compressed pages are ever held at once; all-zero pages take no
+            //  space at all.
+            void                writeMemory(const uint8_t * data, size_t size);
+
+            //////////
+            //  Implementation
+        private:
+            QDataStream &       _stream;    //  ...of the snapshot file
+        };
+
+        //////////
+        //  Reads the runtime state of a single component from a VA snapshot.
+        //  If the snapshot data turns out to be malformed, reads yield zeros
+        //  and the VirtualAppliance rejects the snapshot once the component
+        //  is done reading.
+        class HADESVM_CORE_PUBLIC SnapshotReader final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(SnapshotReader)
+
+            friend class VirtualAppliance;
+
+            //////////
+            //  Construction/destruction
+        private:
+            explicit SnapshotReader(QDataStream & stream);
+        public:
+            ~SnapshotReader() = default;
+
+            //////////
+            //  Operators
+        public:
+            SnapshotReader &    operator >> (bool & value);
+            SnapshotReader &    operator >> (uint8_t & value);
+            SnapshotReader &    operator >> (uint16_t & value);
+            SnapshotReader &    operator >> (uint32_t & value);
+            SnapshotReader &    operator >> (uint64_t & value);
+            SnapshotReader &    operator >> (QString & value);
+            SnapshotReader &    operator >> (QByteArray & value);
+
+            //////////
+            //  Operations
+        public:
+            //  Reads the specified number of raw bytes
+            void                readBytes(void * data, size_t size);
+
+            //  Reads a block of (guest) memory written by SnapshotWriter::writeMemory().
+            //  The block must be of the same size as written and must be zeroed
+            //  on entry - pages that were all zeros when written are never touched.
+            //  Throws VirtualApplianceException if the block can't be read.
+            void                readMemory(uint8_t * data, size_t size) throws(VirtualApplianceException);
+
+            //  Reads a block of (guest) memory written by SnapshotWriter::writeMemory(),
+            //  but leaves its pages compressed; the returned LazyMemoryRestorer
+            //  (which the caller then owns) decompresses them into "data" later.
+            //  The same rules as for readMemory() apply.
+            //  Throws VirtualApplianceException if the block can't be read.
+            LazyMemoryRestorer *readMemoryLazily(uint8_t * data, size_t size) throws(VirtualApplianceException);
+
+            //  True if all reads so far were good
+            bool                isGood() const { return _stream.status() == QDataStream::Ok; }
+
+            //////////
+            //  Implementation
+        private:
+            QDataStream &       _stream;    //  ...of the snapshot file
+
+            //  Helpers
+            QList<QByteArray>   _readMemoryPages(size_t size) throws(VirtualApplianceException);
+        };
+
+        //////////
+        //  Restores a block of (guest) memory from the compressed pages read
+        //  from a VA snapshot, so that a VA can start running before all of
+        //  its memory is in place. Pages are decompressed in the background
+        //  once start() is called, and on demand by ensureRestored() - which
+        //  whoever accesses the memory must call first until isDone().
+        //  A page that turns out to be corrupt is left all zeros.
+        class HADESVM_CORE_PUBLIC LazyMemoryRestorer final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(LazyMemoryRestorer)
+
+            friend class SnapshotReader;
+
+            //////////
+            //  Construction/destruction
+        private:
+            LazyMemoryRestorer(uint8_t * data, size_t size, const QList<QByteArray> & pages);
+        public:
+            ~LazyMemoryRestorer();  //  waits for the background restore to finish
+
+            //////////
+            //  Operations
+        public:
+            //  Starts restoring all pages in the background; "onDone" (if
+            //  any) is called once the last page is restored, on whatever
+            //  thread has restored it
+            void                start(std::function<void()> onDone = nullptr);
+
+            //  Waits until all pages are restored
+            void                waitForDone();
+
+            //  True if all pages are restored; can be called from any thread
+            bool                isDone() const { return _done.load(std::memory_order_acquire); }
+
+            //  Makes sure the page that keeps the byte at the specified
+            //  offset is restored; can be called from any thread
+            void                ensureRestored(size_t offset)
+            {
+                size_t pageIndex = offset / SnapshotWriter::MemoryPageSize;
+                if (!_pagesRestored[pageIndex].load(std::memory_order_acquire))
+                {
+                    _restorePage(pageIndex);
+                }
+            }
+
+            //////////
+            //  Implementation
+        private:
+            uint8_t *const      _data;
+            const size_t        _size;
+            QList<QByteArray>   _pages;         //  compressed; emptied once restored
+            std::atomic<bool> * _pagesRestored; //  array of _pages.size() elements
+            std::atomic<size_t> _pagesLeft;
+            std::atomic<bool>   _done;
+            std::function<void()>   _onDone;
+            QMutex              _pagesGuard;
+            QThreadPool         _threadPool;
+
+            //  Helpers
+            void                _restorePage(size_t pageIndex);
+        };
+    }
+}
+
+//  End of hadesvm-core/Snapshot.hpp
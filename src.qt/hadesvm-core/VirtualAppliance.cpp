@@ -10,11 +10,18 @@ using namespace hadesvm::core;
 namespace
 {
     const QString VaDirectoryPrefix = "./";
+
+    const char SnapshotSignature[8] = { 'H', 'V', 'M', 'S', 'N', 'A', 'P', '\0' };
+    const quint32 SnapshotFormatVersion = 2;
+    const quint32 SnapshotSectionEndMarker = 0x454E4453;    //  "ENDS"
 }
 
 //////////
 //  Constants
 const QString VirtualAppliance::PreferredExtension = ".hadesvm";
+const QString VirtualAppliance::SnapshotExtension = ".hadesvm-snapshot";
+const double VirtualAppliance::MinSpeedMultiplier = 0.1;
+const double VirtualAppliance::MaxSpeedMultiplier = 100.0;
 
 //////////
 //  Construction/destruction
@@ -29,6 +36,8 @@ VirtualAppliance::VirtualAppliance(const QString & name, const QString & locatio
         _startAutomatically(false),
         _startFullScreen(false),
         _startMinimized(false),
+        _speedMultiplier(1.0),
+        _unthrottled(false),
         //  VA components
         _compatibleComponents(),
         _adaptedComponents(),
@@ -36,6 +45,7 @@ VirtualAppliance::VirtualAppliance(const QString & name, const QString & locatio
         //  Runtime state
         _stopRequested(false),
         _resetRequested(false),
+        _clockScheduler(),
         //  Runtime statistics
         _statisticsGuard(),
         _achievedClockFrequencyByClockedComponent()
@@ -79,6 +89,8 @@ void VirtualAppliance::save() throws(VirtualApplianceException)
     rootElement.setAttribute("StartAutomatically", hadesvm::util::toString(_startAutomatically));
     rootElement.setAttribute("StartFullScreen", hadesvm::util::toString(_startFullScreen));
     rootElement.setAttribute("StartMinimized", hadesvm::util::toString(_startMinimized));
+    rootElement.setAttribute("SpeedMultiplier", hadesvm::util::toString(_speedMultiplier));
+    rootElement.setAttribute("Unthrottled", hadesvm::util::toString(_unthrottled));
     document.appendChild(rootElement);
 
     //  Set up "components" element
@@ -186,6 +198,16 @@ VirtualAppliance * VirtualAppliance::load(const QString & location)
     hadesvm::util::fromString(rootElement.attribute("StartAutomatically"), va->_startAutomatically);
     hadesvm::util::fromString(rootElement.attribute("StartFullScreen"), va->_startFullScreen);
     hadesvm::util::fromString(rootElement.attribute("StartMinimized"), va->_startMinimized);
+    double speedMultiplier = va->_speedMultiplier;
+    if (hadesvm::util::fromString(rootElement.attribute("SpeedMultiplier"), speedMultiplier))
+    {
+        va->setSpeedMultiplier(speedMultiplier);
+    }
+    bool unthrottled = va->_unthrottled;
+    if (hadesvm::util::fromString(rootElement.attribute("Unthrottled"), unthrottled))
+    {
+        va->setUnthrottled(unthrottled);
+    }
 
     //  Process <Components> element
     for (QDomElement componentsElement = rootElement.firstChildElement("Components");
@@ -333,6 +355,47 @@ void VirtualAppliance::setStartMinimized(bool startMinimized)
     }
 }
 
+double VirtualAppliance::speedMultiplier() const
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    return _speedMultiplier;
+}
+
+void VirtualAppliance::setSpeedMultiplier(double speedMultiplier)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (speedMultiplier >= MinSpeedMultiplier && speedMultiplier <= MaxSpeedMultiplier)
+    {
+        _speedMultiplier = speedMultiplier;
+        _clockScheduler._setSpeed(_speedMultiplier, _unthrottled);
+        if (_state == State::Running)
+        {
+            _recordScheduledClockFrequencies();
+        }
+    }
+}
+
+bool VirtualAppliance::unthrottled() const
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    return _unthrottled;
+}
+
+void VirtualAppliance::setUnthrottled(bool unthrottled)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    _unthrottled = unthrottled;
+    _clockScheduler._setSpeed(_speedMultiplier, _unthrottled);
+    if (_state == State::Running)
+    {
+        _recordScheduledClockFrequencies();
+    }
+}
+
 QString VirtualAppliance::toRelativePath(const QString & path)
 {
     QDir baseDir(_directory);
@@ -511,34 +574,7 @@ void VirtualAppliance::start() throws(VirtualApplianceException)
 {
     Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
 
-    if (_state != State::Stopped)
-    {   //  Can't
-        return;
-    }
-
-    try
-    {
-        _stopRequested = false;
-        _resetRequested = false;
-
-        _connectComponents();       //  may throw
-        _initializeComponents();    //  may throw
-        _startComponents();         //  may throw
-
-        _resetStatistics();
-
-        _workerThread = new _WorkerThread(this);
-        _workerThread->start(); //  may choose to stop prematurely!
-
-        _state = State::Running;
-    }
-    catch (...)
-    {
-        _stopComponents();
-        _deinitializeComponents();
-        _disconnectComponents();
-        throw;
-    }
+    _start(QString());
 }
 
 void VirtualAppliance::stop() noexcept
@@ -558,16 +594,7 @@ void VirtualAppliance::stop() noexcept
             failure();
             break;
         case State::Running:
-            _workerThread->requestStop();
-            _workerThread->wait(15 * 1000); //  wait 15 seconds...
-            if (_workerThread->isRunning())
-            {   //  ...then force-kill it as a last resort
-                _workerThread->terminate();
-                _workerThread->wait(ULONG_MAX);
-            }
-            delete _workerThread;
-            _workerThread = nullptr;
-
+            _stopWorkerThread();
             _stopComponents();
             _deinitializeComponents();
             _disconnectComponents();
@@ -608,6 +635,59 @@ void VirtualAppliance::reset()
     QMessageBox::critical(nullptr, "OOPS!", "Not yet implemented");    //  reset() must NOT throw!
 }
 
+//////////
+//  Operations (snapshots)
+void VirtualAppliance::saveSnapshot(const QString & fileName) throws(VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Running)
+    {   //  OOPS! Can't
+        throw VirtualApplianceException("Only a running VA can be snapshotted");
+    }
+
+    //  Pause the VA - all components go back to Initialized state...
+    _stopWorkerThread();
+    _stopComponents();
+
+    //  ...save their runtime state...
+    QString error;
+    try
+    {
+        _writeSnapshot(fileName);
+    }
+    catch (const VirtualApplianceException & ex)
+    {   //  Resume the VA anyway
+        error = ex.message();
+    }
+
+    //  ...and resume the VA
+    try
+    {
+        _startComponents();
+        _workerThread = new _WorkerThread(this);
+        _workerThread->start();
+    }
+    catch (...)
+    {   //  OOPS! The VA is half-stopped - finish stopping it
+        _deinitializeComponents();
+        _disconnectComponents();
+        _state = State::Stopped;
+        throw;
+    }
+    if (!error.isEmpty())
+    {
+        throw VirtualApplianceException(error);
+    }
+}
+
+void VirtualAppliance::startFromSnapshot(const QString & fileName) throws(VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    _start(fileName);
+}
+
 //////////
 //  Operations (runtime state)
 void VirtualAppliance::requestStop()
@@ -909,174 +989,252 @@ void VirtualAppliance::_resetStatistics()
     _achievedClockFrequencyByClockedComponent.clear();
 }
 
-//////////
-//  VirtualAppliance::_FrequencyDivider
-VirtualAppliance::_FrequencyDivider::_FrequencyDivider(unsigned inputTicks, unsigned outputTicks,
-                                                       IClockedComponent * drivenComponent)
-    :   _inputTicks(inputTicks),
-        _outputTicks(outputTicks),
-        _drivenComponent(drivenComponent),
-        //  Worker data for Bresenham's line algorithm
-        _dx(inputTicks - 1),
-        _dy(outputTicks - 1),
-        _2dx(2 * _dx),
-        _2dy(2 * _dy),
-        _d(2 * _dy - _dx),
-        _x(0),
-        _y(0)
-{
-    Q_ASSERT(_inputTicks >= 1 && _inputTicks <= 1000000000);
-    Q_ASSERT(_outputTicks >= 1 && _outputTicks <= 1000000000);
-    Q_ASSERT(_outputTicks <= _inputTicks);
-    Q_ASSERT(_drivenComponent != nullptr);
-}
+void VirtualAppliance::_recordScheduledClockFrequencies()
+{   //  Scheduled components keep to their clock frequencies (times the
+    //  speed multiplier) by design, as virtual time keeps up with host time.
+    //  Unthrottled, they keep up with the processors, which report their own.
+    QMutexLocker lock(&_statisticsGuard);
 
-ClockFrequency VirtualAppliance::_FrequencyDivider::clockFrequency() const noexcept
-{
-    return _drivenComponent->clockFrequency();
+    for (auto sc : componentsImplementing<IScheduledComponent>())
+    {
+        if (_unthrottled)
+        {
+            _achievedClockFrequencyByClockedComponent.remove(sc);
+        }
+        else
+        {
+            _achievedClockFrequencyByClockedComponent[sc] =
+                ClockFrequency::hertz(static_cast<uint64_t>(static_cast<double>(sc->clockFrequency().toHz()) * _speedMultiplier));
+        }
+    }
 }
 
-void VirtualAppliance::_FrequencyDivider::onClockTick() noexcept
+void VirtualAppliance::_start(const QString & snapshotFileName) throws(VirtualApplianceException)
 {
-    _x++;
-    if (_d > 0)
+    if (_state != State::Stopped)
+    {   //  Can't
+        return;
+    }
+
+    try
     {
-        _y++;
-        _drivenComponent->onClockTick();
-        _d -= _2dx;
+        _stopRequested = false;
+        _resetRequested = false;
+        _clockScheduler._reset();   //  virtual time starts over
+
+        _connectComponents();       //  may throw
+        _initializeComponents();    //  may throw
+        if (!snapshotFileName.isEmpty())
+        {
+            _readSnapshot(snapshotFileName);    //  may throw
+        }
+        _startComponents();         //  may throw
+
+        _resetStatistics();
+
+        _workerThread = new _WorkerThread(this);
+        _workerThread->start(); //  may choose to stop prematurely!
+
+        _state = State::Running;
     }
-    _d += _2dy;
-    if (_x >= _dx)
-    {   //  Start over
-        _x = _y = 0;
-        _d = 2 * _dy - _dx;
+    catch (...)
+    {
+        _stopComponents();
+        _deinitializeComponents();
+        _disconnectComponents();
+        throw;
     }
 }
 
-void VirtualAppliance::_FrequencyDivider::reset() noexcept
+void VirtualAppliance::_stopWorkerThread()
 {
-    _d = 2 * _dy - _dx;
-    _x = _y = 0;
+    _workerThread->requestStop();
+    _workerThread->wait(15 * 1000); //  wait 15 seconds...
+    if (_workerThread->isRunning())
+    {   //  ...then force-kill it as a last resort
+        _workerThread->terminate();
+        _workerThread->wait(ULONG_MAX);
+    }
+    delete _workerThread;
+    _workerThread = nullptr;
 }
 
-//////////
-//  VirtualAppliance::_WorkerThread
-VirtualAppliance::_WorkerThread::_WorkerThread(VirtualAppliance * virtualAppliance)
-    :   _virtualAppliance(virtualAppliance),
-        _stopRequested(false),
-        _maxClockFrequency(),   //  0hz
-        _frequencyDividers(),
-        _tickTargets()
+QMap<QString, ISnapshotComponent*> VirtualAppliance::_snapshotComponentsByKey()
+{   //  A component is known by its type and its ordinal among the components
+    //  of the same type, which stays the same as long as VA configuration does
+    QMap<QString, ISnapshotComponent*> result;
+    QMap<QString, int> ordinalsByType;
+    for (ISnapshotComponent * component : componentsImplementing<ISnapshotComponent>())
+    {
+        QString type = component->componentType()->mnemonic();
+        result.insert(type + "#" + QString::number(ordinalsByType[type]++), component);
+    }
+    return result;
+}
+
+void VirtualAppliance::_writeSnapshot(const QString & fileName) throws(VirtualApplianceException)
 {
-    //  Which components/adapters will be "clock ticked" by the VA's
-    //  own _WorkerThread? These are all that implement IClockedComponentAspect
-    //  but do NOT implement IActiveComponentAspect
-    for (auto cc : virtualAppliance->componentsImplementing<IClockedComponent>())
+    QMap<QString, ISnapshotComponent*> components = _snapshotComponentsByKey();
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {   //  OOPS! Can't
+        throw VirtualApplianceException("Cannot create " + fileName);
+    }
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_6_0);
+
+    //  Header...
+    out.writeRawData(SnapshotSignature, static_cast<int>(sizeof(SnapshotSignature)));
+    out << SnapshotFormatVersion
+        << _architecture->mnemonic()
+        << static_cast<quint32>(components.size());
+
+    //  ...then a section per component, streamed straight to the file
+    //  and closed by a marker that tells whether it was read back whole
+    for (auto it = components.cbegin(); it != components.cend(); ++it)
     {
-        if (dynamic_cast<IActiveComponent*>(cc) == nullptr)
+        out << it.key();
+        SnapshotWriter writer(out);
+        it.value()->saveSnapshot(writer);   //  may throw
+        out << SnapshotSectionEndMarker;
+        if (out.status() != QDataStream::Ok)
         {
-            _tickTargets.append(cc);    //  can end up empty!
+            throw VirtualApplianceException("Cannot write " + fileName);
         }
     }
+}
+
+void VirtualAppliance::_readSnapshot(const QString & fileName) throws(VirtualApplianceException)
+{
+    QMap<QString, ISnapshotComponent*> components = _snapshotComponentsByKey();
 
-    for (auto tickTarget : _tickTargets)
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {   //  OOPS! Can't
+        throw VirtualApplianceException("Cannot open " + fileName);
+    }
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_6_0);
+
+    //  Header...
+    char signature[sizeof(SnapshotSignature)];
+    quint32 formatVersion = 0, numSections = 0;
+    QString architecture;
+    in.readRawData(signature, static_cast<int>(sizeof(signature)));
+    in >> formatVersion >> architecture >> numSections;
+    if (in.status() != QDataStream::Ok ||
+        memcmp(signature, SnapshotSignature, sizeof(signature)) != 0 ||
+        formatVersion != SnapshotFormatVersion)
     {
-        _maxClockFrequency = qMax(_maxClockFrequency, tickTarget->clockFrequency());
+        throw VirtualApplianceException(fileName + " is not a VA snapshot");
+    }
+    if (architecture != _architecture->mnemonic() ||
+        numSections != static_cast<quint32>(components.size()))
+    {
+        throw VirtualApplianceException(fileName + " is a snapshot of a different VA");
     }
 
-    //  Those tick targets that must tick at a frequency LOWER than
-    //  maxClockFrequency require _FrequencyDividers
-    for (qsizetype i = 0; i < _tickTargets.count(); i++)
+    //  ...then a section per component
+    for (quint32 i = 0; i < numSections; i++)
     {
-        IClockedComponent * tickTarget = _tickTargets[i];
-        if (tickTarget->clockFrequency() < _maxClockFrequency)
+        QString key;
+        in >> key;
+        if (in.status() != QDataStream::Ok)
+        {
+            throw VirtualApplianceException(fileName + " is truncated");
+        }
+        ISnapshotComponent * component = components.take(key);
+        if (component == nullptr)
         {
-            _FrequencyDivider * frequencyDivider =
-                new _FrequencyDivider(
-                    static_cast<unsigned>(qMax(qMin(_maxClockFrequency.toHz(), 1000000000u), 1u)),
-                    static_cast<unsigned>(qMax(qMin(tickTarget->clockFrequency().toHz(), 1000000000u), 1u)),
-                    tickTarget);
-            _frequencyDividers.append(frequencyDivider);
-            _tickTargets[i] = frequencyDivider;
+            throw VirtualApplianceException(fileName + " is a snapshot of a different VA");
+        }
+        SnapshotReader reader(in);
+        component->restoreSnapshot(reader); //  may throw
+        quint32 sectionEndMarker = 0;
+        in >> sectionEndMarker;
+        if (!reader.isGood() || sectionEndMarker != SnapshotSectionEndMarker)
+        {
+            throw VirtualApplianceException(fileName + " is corrupt");
         }
     }
 }
 
-VirtualAppliance::_WorkerThread::~_WorkerThread()
+//////////
+//  VirtualAppliance::_ClockTicker
+VirtualAppliance::_ClockTicker::_ClockTicker(IClockedComponent * drivenComponent)
+    :   _drivenComponent(drivenComponent),
+        _clockTicksDone(0)
 {
-    for (auto frequencyDivider : _frequencyDividers)
-    {
-        delete frequencyDivider;
-    }
+    Q_ASSERT(_drivenComponent != nullptr);
+
+    //  The clock ticks before now are water under the bridge
+    _clockTicksDone = ClockScheduler::nsToClockTicks(clockFrequency(), virtualAppliance()->clockScheduler()->now());
 }
 
-void VirtualAppliance::_WorkerThread::run()
+void VirtualAppliance::_ClockTicker::onWakeUp() noexcept
 {
-    if (_tickTargets.isEmpty())
-    {   //  Nothing to tick!
-        return;
+    ClockScheduler * clockScheduler = virtualAppliance()->clockScheduler();
+    uint64_t clockTicksDue = ClockScheduler::nsToClockTicks(clockFrequency(), clockScheduler->now());
+
+    //  Catch up, but don't hog the worker thread for more
+    //  than about 1/10 of a second of virtual time at once
+    uint64_t clockTicksToDo = qMin(clockTicksDue - qMin(clockTicksDue, _clockTicksDone),
+                                   clockFrequency().toHz() / 10 + 1);
+    for (uint64_t i = 0; i < clockTicksToDo; i++)
+    {
+        _drivenComponent->onClockTick();
     }
+    _clockTicksDone += clockTicksToDo;
 
-    uint64_t requiredClockFrequencyHz = _maxClockFrequency.toHz();
-    uint64_t requiredNsPerTick = 1000000000 / requiredClockFrequencyHz;
-    unsigned ticksBetweenDelayAdjustment = static_cast<unsigned>(qMin(qMax(1u, requiredClockFrequencyHz / 10), UINT_MAX));
-    unsigned delayPerTickNs = 0;
-    uint64_t accumulatedDelayNs = 0;
+    clockScheduler->scheduleWakeUp(this, (_clockTicksDone < clockTicksDue) ? 0 : 1);
+}
 
-    QElapsedTimer elapsedTimer;
-    while (!_stopRequested)
+//////////
+//  VirtualAppliance::_WorkerThread
+VirtualAppliance::_WorkerThread::_WorkerThread(VirtualAppliance * virtualAppliance)
+    :   _virtualAppliance(virtualAppliance),
+        _stopRequested(false),
+        _clockTickers()
+{
+    //  Which components/adapters will be "clock ticked" by the VA's
+    //  own _WorkerThread? These are all that implement IClockedComponent
+    //  but implement neither IActiveComponent nor IScheduledComponent
+    for (auto cc : virtualAppliance->componentsImplementing<IClockedComponent>())
     {
-        //  Execute a bunch of instructions...
-        elapsedTimer.restart();
-        for (unsigned n = 0; n < ticksBetweenDelayAdjustment; n++)
+        if (dynamic_cast<IActiveComponent*>(cc) == nullptr &&
+            dynamic_cast<IScheduledComponent*>(cc) == nullptr &&
+            cc->clockFrequency().toHz() > 0)
         {
-            for (qsizetype i = 0; i < _tickTargets.count(); i++)
-            {
-                _tickTargets[i]->onClockTick();
-            }
-            accumulatedDelayNs += delayPerTickNs;
-        }
-        uint64_t accumulatedDelayMs = accumulatedDelayNs / 1000000;
-        accumulatedDelayNs -= 1000000 * accumulatedDelayMs;
-        if (accumulatedDelayMs > 0)
-        {
-            msleep(static_cast<unsigned long>(accumulatedDelayMs));
+            _clockTickers.append(new _ClockTicker(cc)); //  can end up empty!
         }
+    }
+    virtualAppliance->_recordScheduledClockFrequencies();
+}
 
-        qint64 idealNsElapsed = requiredNsPerTick * ticksBetweenDelayAdjustment;
-        qint64 actualNsElapsed = elapsedTimer.nsecsElapsed();
+VirtualAppliance::_WorkerThread::~_WorkerThread()
+{
+    for (auto clockTicker : _clockTickers)
+    {
+        _virtualAppliance->_clockScheduler.cancelWakeUp(clockTicker);
+        delete clockTicker;
+    }
+}
 
-        static int n = 0;
-        if (n++ >= 100)
-        {
-            n = 0;
-            //TODO kill off qDebug() << idealNsElapsed << " / " << actualNsElapsed << " / " << delayPerTickNs;
-
-            qint64 actualNsPerTick = actualNsElapsed / ticksBetweenDelayAdjustment;;
-            qint64 actualClockFrequencyHz = 1000000000 / actualNsPerTick;
-            //TODO kill off qDebug() << "VA._WorkerThread Running at " << actualClockFrequencyHz << " Hz, delayPerTickNs = " << delayPerTickNs;
-            //  Record!
-            for (qsizetype i = 0; i < _tickTargets.count(); i++)
-            {
-                _virtualAppliance->recordAchievedClockFrequency(
-                    _tickTargets[i],
-                    ClockFrequency::hertz(_tickTargets[i]->clockFrequency().toHz() * actualClockFrequencyHz / requiredClockFrequencyHz));
-            }
-        }
+void VirtualAppliance::_WorkerThread::run()
+{
+    for (auto clockTicker : _clockTickers)
+    {
+        _virtualAppliance->_clockScheduler.scheduleWakeUp(clockTicker, 1);
+    }
 
-        if (actualNsElapsed < idealNsElapsed)
-        {   //  Going too fast!
-            delayPerTickNs++;
-        }
-        else if (actualNsElapsed > idealNsElapsed && delayPerTickNs > 0)
-        {   //  Going too slow!
-            delayPerTickNs--;
-        }
-        //qDebug() << actualNsElapsed;
-        //  ...and see how long it actually took to execute the binch
+    _virtualAppliance->_clockScheduler._run(_stopRequested);
+}
 
-        //usleep(1);
-    }
+void VirtualAppliance::_WorkerThread::requestStop()
+{
+    _stopRequested = true;
+    _virtualAppliance->_clockScheduler._interrupt();
 }
 
 //  End of hadesvm-core/VirtualAppliance.cpp
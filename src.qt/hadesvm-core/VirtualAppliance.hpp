@@ -19,6 +19,9 @@ namespace hadesvm
             //  Constants
         public:
             static const QString    PreferredExtension; //  starts with '.'
+            static const QString    SnapshotExtension;  //  starts with '.'
+            static const double     MinSpeedMultiplier;
+            static const double     MaxSpeedMultiplier;
 
             //////////
             //  Types
@@ -70,6 +73,16 @@ namespace hadesvm
             bool                    startMinimized() const;
             void                    setStartMinimized(bool startMinimized);
 
+            //  The rate at which the VA's virtual time runs relative to real
+            //  time (1.0 == real time, 10.0 == 10 times faster, etc.), unless
+            //  the VA runs "unthrottled", i.e. as fast as the host allows.
+            //  Both can be changed while the VA is Running.
+            //  Must only be called from the QApplication's main thread
+            double                  speedMultiplier() const;
+            void                    setSpeedMultiplier(double speedMultiplier);
+            bool                    unthrottled() const;
+            void                    setUnthrottled(bool unthrottled);
+
             //  TODO document
             //  Must only be called from the QApplication's main thread
             QString                 toRelativePath(const QString & path);
@@ -165,6 +178,24 @@ namespace hadesvm
             //  VA is not in the Running state.
             void                    reset();
 
+            //////////
+            //  Operations (snapshots)
+        public:
+            //  Saves the runtime state of all components of a Running VA
+            //  (that implement ISnapshotComponent) to the specified snapshot
+            //  file. The VA is paused while the snapshot is taken.
+            //  Throws if the snapshot cannot be taken, in which case the
+            //  VA keeps running if possible.
+            //  Must only be called from the QApplication's main thread
+            void                    saveSnapshot(const QString & fileName) throws(VirtualApplianceException);
+
+            //  Starts a Stopped VA from the runtime state saved in the
+            //  specified snapshot file rather than from power-on state.
+            //  The snapshot must have been taken of a VA with the same
+            //  configuration. Has no effect if the VA is not Stopped.
+            //  Must only be called from the QApplication's main thread
+            void                    startFromSnapshot(const QString & fileName) throws(VirtualApplianceException);
+
             //////////
             //  Operations (runtime state)
         public:
@@ -179,6 +210,10 @@ namespace hadesvm
             void                    requestStop();
             void                    requestReset();
 
+            //  The master clock of this VA, which drives its "scheduled
+            //  components" (see IScheduledComponent).
+            ClockScheduler *        clockScheduler() { return &_clockScheduler; }
+
             //////////
             //  Operations (runtime statistics)
         public:
@@ -200,6 +235,8 @@ namespace hadesvm
             bool                    _startAutomatically;
             bool                    _startFullScreen;
             bool                    _startMinimized;
+            double                  _speedMultiplier;
+            bool                    _unthrottled;
 
             //  VA components
             ComponentList           _compatibleComponents;  //  ...bound to this VM
@@ -209,6 +246,7 @@ namespace hadesvm
             //  Runtime state
             std::atomic<bool>       _stopRequested;
             std::atomic<bool>       _resetRequested;
+            ClockScheduler          _clockScheduler;
 
             //  Runtime statistics
             hadesvm::util::Spinlock _statisticsGuard;
@@ -223,16 +261,26 @@ namespace hadesvm
             void                    _disconnectComponents();
 
             void                    _resetStatistics();
+            void                    _recordScheduledClockFrequencies();
+
+            void                    _start(const QString & snapshotFileName) throws(VirtualApplianceException);
+            void                    _stopWorkerThread();
+
+            //  Snapshot components by their keys in snapshot files
+            QMap<QString, ISnapshotComponent*>  _snapshotComponentsByKey();
+            void                    _writeSnapshot(const QString & fileName) throws(VirtualApplianceException);
+            void                    _readSnapshot(const QString & fileName) throws(VirtualApplianceException);
 
             //  Threads
-            class _FrequencyDivider final : public virtual IClockedComponent
-            {   //  Accepts "input" ticks, performing "output" ticks at a lower frequency
-                HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_FrequencyDivider)
+            class _ClockTicker final : public virtual IScheduledComponent
+            {   //  Calls onClockTick() of a "clocked component" that is not
+                //  "scheduled" at its clock frequency, as virtual time goes by
+                HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_ClockTicker)
 
                 //////////
                 //  Construction/destruction
             public:
-                _FrequencyDivider(unsigned inputTicks, unsigned outputTicks, IClockedComponent * drivenComponent);
+                explicit _ClockTicker(IClockedComponent * drivenComponent);
 
                 //////////
                 //  IComponent (general; largely unused)
@@ -255,29 +303,31 @@ namespace hadesvm
                 virtual void            stop() noexcept override {}
                 virtual void            deinitialize() noexcept override {}
                 virtual void            disconnect() noexcept override {}
-                virtual void            reset() noexcept override;
+                virtual void            reset() noexcept override {}
 
                 //////////
                 //  IClockedComponent
             public:
-                virtual ClockFrequency  clockFrequency() const noexcept override;
-                virtual void            onClockTick() noexcept override;
+                virtual ClockFrequency  clockFrequency() const noexcept override { return _drivenComponent->clockFrequency(); }
+                virtual void            onClockTick() noexcept override { _drivenComponent->onClockTick(); }
+
+                //////////
+                //  IScheduledComponent
+            public:
+                virtual void            onWakeUp() noexcept override;
+                virtual void            onEvent() noexcept override {}
 
                 //////////
                 //  Implementation
             private:
-                const unsigned      _inputTicks;
-                const unsigned      _outputTicks;
                 IClockedComponent *const    _drivenComponent;
-                //  Worker data for Bresenham's line algorithm
-                const unsigned      _dx, _dy;
-                const unsigned      _2dx, _2dy;
-                int                 _d;
-                unsigned            _x, _y;
+                uint64_t            _clockTicksDone;    //  since virtual time 0
             };
 
             class _WorkerThread final : public QThread
-            {   //  Drives all "clocked components" that are not themselves "active components"
+            {   //  Runs the VA's master clock, which drives all "scheduled
+                //  components" and all other "clocked components" that are
+                //  not themselves "active components"
                 HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_WorkerThread)
 
                 //////////
@@ -294,7 +344,7 @@ namespace hadesvm
                 //////////
                 //  Operations
             public:
-                void            requestStop() { _stopRequested = true; }
+                void            requestStop();
 
                 //////////
                 //  Implementation
@@ -302,9 +352,7 @@ namespace hadesvm
                 VirtualAppliance *const _virtualAppliance;
                 std::atomic<bool>   _stopRequested;
 
-                ClockFrequency      _maxClockFrequency;
-                QList<_FrequencyDivider*>   _frequencyDividers;
-                QList<IClockedComponent*>   _tickTargets;
+                QList<_ClockTicker*>    _clockTickers;
             };
             _WorkerThread *     _workerThread = nullptr;
         };
@@ -5,6 +5,7 @@ DEFINES += HADESVM_CORE_LIBRARY
 
 SOURCES += \
     ClockFrequency.cpp \
+    ClockScheduler.cpp \
     Component.cpp \
     ComponentAdaptor.cpp \
     ComponentAdaptorType.cpp \
@@ -15,8 +16,10 @@ SOURCES += \
     Exceptions.cpp \
     MemorySize.cpp \
     Plugins.cpp \
+    ProcessorPacer.cpp \
     RemoteTerminal.cpp \
     RemoteTerminalType.cpp \
+    Snapshot.cpp \
     StandardComponentCategories.cpp \
     StatusBarWidget.cpp \
     TimeInterval.cpp \
@@ -30,6 +33,7 @@ SOURCES += \
 HEADERS += \
     API.hpp \
     Classes.hpp \
+    ClockScheduler.hpp \
     Component.hpp \
     ComponentCategory.hpp \
     ComponentEditor.hpp \
@@ -37,6 +41,8 @@ HEADERS += \
     DisplayWidget.hpp \
     Exceptions.hpp \
     Linkage.hpp \
+    ProcessorPacer.hpp \
+    Snapshot.hpp \
     StatusBarWidget.hpp \
     Types.hpp \
     VirtualAppliance.hpp \
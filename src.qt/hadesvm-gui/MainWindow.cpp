@@ -148,6 +148,7 @@ void MainWindow::_refresh()
         _ui->actionStartVm->setEnabled(
             _currentVirtualAppliance != nullptr &&
             _currentVirtualAppliance->state() == hadesvm::core::VirtualAppliance::State::Stopped);
+        _ui->actionStartVmFromSnapshot->setEnabled(_ui->actionStartVm->isEnabled());
         _ui->actionStopVm->setEnabled(
             _currentVirtualAppliance != nullptr &&
             _currentVirtualAppliance->state() != hadesvm::core::VirtualAppliance::State::Stopped);
@@ -176,6 +177,20 @@ void MainWindow::_refresh()
     }
 }
 
+void MainWindow::_showVirtualApplianceWindow()
+{
+    auto virtualApplianceWindow = new VirtualApplianceWindow(_currentVirtualAppliance);
+    _virtualApplianceWindows.insert(_currentVirtualAppliance, virtualApplianceWindow);
+    if (_currentVirtualAppliance->startMinimized())
+    {
+        virtualApplianceWindow->showMinimized();
+    }
+    else
+    {
+        virtualApplianceWindow->setVisible(true);
+    }
+}
+
 void MainWindow::_saveVirtualAppliance()
 {
     _settings.setValue("MainWindow/VirtualAppliances.Count", _virtualAppliances.count());
@@ -451,16 +466,37 @@ void MainWindow::_onStartVm()
     try
     {
         _currentVirtualAppliance->start();
-        auto virtualApplianceWindow = new VirtualApplianceWindow(_currentVirtualAppliance);
-        _virtualApplianceWindows.insert(_currentVirtualAppliance, virtualApplianceWindow);
-        if (_currentVirtualAppliance->startMinimized())
-        {
-            virtualApplianceWindow->showMinimized();
-        }
-        else
-        {
-            virtualApplianceWindow->setVisible(true);
-        }
+        _showVirtualApplianceWindow();
+    }
+    catch (const hadesvm::core::VirtualApplianceException & ex)
+    {
+        QMessageBox::critical(this, "OOPS!", ex.message());
+    }
+    _refresh();
+}
+
+void MainWindow::_onStartVmFromSnapshot()
+{
+    if (!_virtualAppliances.contains(_currentVirtualAppliance) ||
+        _currentVirtualAppliance->state() != hadesvm::core::VirtualAppliance::State::Stopped)
+    {   //  Nothing to do
+        return;
+    }
+
+    QString fileName = QFileDialog::getOpenFileName(
+        this,
+        "Start VM from snapshot",
+        QFileInfo(_currentVirtualAppliance->location()).absolutePath(),
+        "Snapshot Files (*" + hadesvm::core::VirtualAppliance::SnapshotExtension + ")");
+    if (fileName.isEmpty())
+    {
+        return;
+    }
+
+    try
+    {
+        _currentVirtualAppliance->startFromSnapshot(fileName);
+        _showVirtualApplianceWindow();
     }
     catch (const hadesvm::core::VirtualApplianceException & ex)
     {
@@ -50,6 +50,7 @@ namespace hadesvm
 
             //  Helpers
             void                _refresh();
+            void                _showVirtualApplianceWindow();
             void                _saveVirtualAppliance();
             void                _loadVirtualAppliance();
 
@@ -67,6 +68,7 @@ namespace hadesvm
             void                _onCloseVm();
             void                _onExit();
             void                _onStartVm();
+            void                _onStartVmFromSnapshot();
             void                _onStopVm();
             void                _onSuspendVm();
             void                _onResumeVm();
@@ -126,8 +126,17 @@ void VirtualApplianceWindow::_refresh()
     _ui->actionStopVm->setEnabled(_virtualAppliance->state() == hadesvm::core::VirtualAppliance::State::Running);
     _ui->actionSuspendVm->setEnabled(_virtualAppliance->state() == hadesvm::core::VirtualAppliance::State::Running);
     _ui->actionResetVm->setEnabled(_virtualAppliance->state() == hadesvm::core::VirtualAppliance::State::Running);
+    _ui->actionSaveSnapshot->setEnabled(_virtualAppliance->state() == hadesvm::core::VirtualAppliance::State::Running);
     _ui->actionFullScreen->setEnabled(_virtualAppliance->state() == hadesvm::core::VirtualAppliance::State::Running &&
                                       _displayWidgetsByTabIndex.contains(_ui->tabWidget->currentIndex()));
+    //  Exactly one of the "speed" actions is checked
+    bool unthrottled = _virtualAppliance->unthrottled();
+    double speedMultiplier = _virtualAppliance->speedMultiplier();
+    _ui->actionRealTime->setChecked(!unthrottled && speedMultiplier == 1.0);
+    _ui->actionSpeed2x->setChecked(!unthrottled && speedMultiplier == 2.0);
+    _ui->actionSpeed5x->setChecked(!unthrottled && speedMultiplier == 5.0);
+    _ui->actionSpeed10x->setChecked(!unthrottled && speedMultiplier == 10.0);
+    _ui->actionUnthrottled->setChecked(unthrottled);
 
     //  Statistics on the Home tab
     if (_virtualAppliance->state() == hadesvm::core::VirtualAppliance::State::Running)
@@ -169,6 +178,14 @@ void VirtualApplianceWindow::_refresh()
         {
             vaSpeedText += " at " + vaClockFrequency.displayForm();
         }
+        if (unthrottled)
+        {
+            vaSpeedText += " (unthrottled)";
+        }
+        else if (speedMultiplier != 1.0)
+        {
+            vaSpeedText += " (" + QString::number(speedMultiplier) + "x real time)";
+        }
         _ui->statusbar->showMessage(vaSpeedText);
     }
 
@@ -181,6 +198,24 @@ void VirtualApplianceWindow::_refresh()
     */
 }
 
+void VirtualApplianceWindow::_setSpeed(double speedMultiplier, bool unthrottled)
+{
+    _virtualAppliance->setUnthrottled(unthrottled);
+    if (!unthrottled)
+    {   //  Unthrottling keeps the multiplier for when the VA is throttled again
+        _virtualAppliance->setSpeedMultiplier(speedMultiplier);
+    }
+    try
+    {   //  The speed is part of the VA configuration
+        _virtualAppliance->save();
+    }
+    catch (const hadesvm::core::VirtualApplianceException & ex)
+    {
+        QMessageBox::critical(this, "OOPS!", ex.message());
+    }
+    _refresh();
+}
+
 //////////
 //  QWidget
 void VirtualApplianceWindow::closeEvent(QCloseEvent * event)
@@ -218,6 +253,34 @@ void VirtualApplianceWindow::_onResetVm()
     _refresh();
 }
 
+void VirtualApplianceWindow::_onSaveSnapshot()
+{
+    QString fileName = QFileDialog::getSaveFileName(
+        this,
+        "Save VM snapshot",
+        QFileInfo(_virtualAppliance->location()).absolutePath(),
+        "Snapshot Files (*" + hadesvm::core::VirtualAppliance::SnapshotExtension + ")");
+    if (fileName.isEmpty())
+    {
+        return;
+    }
+    //  Slap extension if there isn't one
+    if (QFileInfo(fileName).completeSuffix().isEmpty())
+    {
+        fileName += hadesvm::core::VirtualAppliance::SnapshotExtension;
+    }
+
+    try
+    {
+        _virtualAppliance->saveSnapshot(fileName);
+    }
+    catch (const hadesvm::core::VirtualApplianceException & ex)
+    {
+        QMessageBox::critical(this, "OOPS!", ex.message());
+    }
+    _refresh();
+}
+
 void VirtualApplianceWindow::_onFullScreen()
 {
     delete _fullScreenWindow;   //  "delete nullptr" is safe
@@ -228,6 +291,31 @@ void VirtualApplianceWindow::_onFullScreen()
     }
 }
 
+void VirtualApplianceWindow::_onRealTime()
+{
+    _setSpeed(1.0, false);
+}
+
+void VirtualApplianceWindow::_onSpeed2x()
+{
+    _setSpeed(2.0, false);
+}
+
+void VirtualApplianceWindow::_onSpeed5x()
+{
+    _setSpeed(5.0, false);
+}
+
+void VirtualApplianceWindow::_onSpeed10x()
+{
+    _setSpeed(10.0, false);
+}
+
+void VirtualApplianceWindow::_onUnthrottled()
+{
+    _setSpeed(_virtualAppliance->speedMultiplier(), true);
+}
+
 void VirtualApplianceWindow::_onRefreshTimerTick()
 {
     if (_autoFullScreen)
@@ -44,6 +44,7 @@ namespace hadesvm
 
             //  Helpers
             void                _refresh();
+            void                _setSpeed(double speedMultiplier, bool unthrottled);
 
             //////////
             //  Controls & resources
@@ -59,7 +60,13 @@ namespace hadesvm
             void                _onStopVm();
             void                _onSuspendVm();
             void                _onResetVm();
+            void                _onSaveSnapshot();
             void                _onFullScreen();
+            void                _onRealTime();
+            void                _onSpeed2x();
+            void                _onSpeed5x();
+            void                _onSpeed10x();
+            void                _onUnthrottled();
 
             void                _onRefreshTimerTick();
             void                _onCustomContextMenuRequested(const QPoint &point);
@@ -0,0 +1,27 @@
+//
+//  hadesvm-ibm3x0/API.hpp
+//
+//  hadesvm-ibm3x0 master header
+//
+//////////
+#pragma once
+
+//////////
+//  Dependencies
+#include "hadesvm-core/API.hpp"
+#include "hadesvm-ibmhfp/API.hpp"
+#include "hadesvm-util/API.hpp"
+
+//////////
+//  hadesvm-ibm3x0 components
+#include "hadesvm-ibm3x0/Linkage.hpp"
+#include "hadesvm-ibm3x0/Classes.hpp"
+
+#include "hadesvm-ibm3x0/Architectures.hpp"
+#include "hadesvm-ibm3x0/Templates.hpp"
+
+#include "hadesvm-ibm3x0/Storage.hpp"
+#include "hadesvm-ibm3x0/ProcessorCore.hpp"
+#include "hadesvm-ibm3x0/Processor.hpp"
+
+//  End of hadesvm-ibm3x0/API.hpp
@@ -0,0 +1,48 @@
+//
+//  hadesvm-ibm3x0/Architectures.cpp
+//
+//  hadesvm::ibm3x0 architectures
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+//////////
+//  Ibm370Architecture
+HADESVM_IMPLEMENT_SINGLETON(Ibm370Architecture)
+Ibm370Architecture::Ibm370Architecture() {}
+Ibm370Architecture::~Ibm370Architecture() {}
+
+QString Ibm370Architecture::mnemonic() const
+{
+    return "Ibm370";
+}
+
+QString Ibm370Architecture::displayName() const
+{
+    return "IBM System/370";
+}
+
+//////////
+//  hadesvm::core::VirtualArchitecture
+void Ibm370Architecture::validateVirtualAppliance(hadesvm::core::VirtualAppliance * virtualAppliance) throws(hadesvm::core::VirtualApplianceException)
+{
+    VirtualArchitecture::validateVirtualAppliance(virtualAppliance);    //  may thow
+
+    //  Only uniprocessors for now - there is no inter-processor signalling
+    if (virtualAppliance->componentsImplementing<Processor>().size() != 1)
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() +
+                                                       " must contain exactly 1 " +
+                                                       Processor::Type::instance()->displayName());
+    }
+
+    if (virtualAppliance->componentsImplementing<MainStorage>().size() != 1)
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() +
+                                                       " must contain exactly 1 " +
+                                                       MainStorage::Type::instance()->displayName());
+    }
+}
+
+//  End of hadesvm-ibm3x0/Architectures.cpp
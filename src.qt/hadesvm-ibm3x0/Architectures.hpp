@@ -0,0 +1,32 @@
+//
+//  hadesvm-ibm3x0/Architectures.hpp
+//
+//  IBM System/3x0-based architectures
+//
+//////////
+
+namespace hadesvm
+{
+    namespace ibm3x0
+    {
+        //////////
+        //  The "IBM System/370" architecture
+        class HADESVM_IBM3X0_PUBLIC Ibm370Architecture final : public hadesvm::core::VirtualArchitecture
+        {
+            HADESVM_DECLARE_SINGLETON(Ibm370Architecture)
+
+            //////////
+            //  hadesvm::util::StockObject
+        public:
+            virtual QString     mnemonic() const override;
+            virtual QString     displayName() const override;
+
+            //////////
+            //  hadesvm::core::VirtualArchitecture
+        public:
+            virtual void        validateVirtualAppliance(hadesvm::core::VirtualAppliance * virtualAppliance) throws(hadesvm::core::VirtualApplianceException) override;
+        };
+    }
+}
+
+//  End of hadesvm-ibm3x0/Architectures.hpp
@@ -0,0 +1,19 @@
+//
+//  hadesvm-ibm3x0/Classes.hpp
+//
+//  hadesvm-ibm3x0 forward declarations and typedefs
+//
+//////////
+
+namespace hadesvm
+{
+    namespace ibm3x0
+    {
+        class HADESVM_IBM3X0_PUBLIC Storage;
+        class HADESVM_IBM3X0_PUBLIC MainStorage;
+        class HADESVM_IBM3X0_PUBLIC ProcessorCore;
+        class HADESVM_IBM3X0_PUBLIC Processor;
+    }
+}
+
+//  End of hadesvm-ibm3x0/Classes.hpp
@@ -0,0 +1,14 @@
+//
+//  hadesvm-ibm3x0/Linkage.hpp
+//
+//  hadesvm-ibm3x0 linkage definitions
+//
+//////////
+
+#if defined(HADESVM_IBM3X0_LIBRARY)
+    #define HADESVM_IBM3X0_PUBLIC   Q_DECL_EXPORT
+#else
+    #define HADESVM_IBM3X0_PUBLIC   Q_DECL_IMPORT
+#endif
+
+//  End of hadesvm-ibm3x0/Linkage.hpp
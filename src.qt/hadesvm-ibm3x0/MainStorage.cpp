@@ -0,0 +1,273 @@
+//
+//  hadesvm-ibm3x0/MainStorage.cpp
+//
+//  hadesvm::ibm3x0::MainStorage class implementation
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+//////////
+//  Constants
+const hadesvm::core::MemorySize MainStorage::DefaultSize = hadesvm::core::MemorySize::megabytes(4);
+const QString    MainStorage::DefaultImageFilePath = "./ipl.bin";
+
+//////////
+//  Construction/destruction
+MainStorage::MainStorage()
+    :   //  Configuration
+        _size(DefaultSize),
+        _imageFilePath(DefaultImageFilePath)
+{
+}
+
+MainStorage::~MainStorage() noexcept
+{
+    delete _storage;    //  just in case; "delete nullptr" is safe
+}
+
+//////////
+//  hadesvm::core::Component
+QString MainStorage::displayName() const
+{
+    return hadesvm::util::toString(_size) + " " + Type::instance()->displayName();
+}
+
+void MainStorage::serialiseConfiguration(QDomElement componentElement) const
+{
+    componentElement.setAttribute("Size", hadesvm::util::toString(_size));
+    componentElement.setAttribute("ImageFilePath", _imageFilePath);
+}
+
+void MainStorage::deserialiseConfiguration(QDomElement componentElement)
+{
+    hadesvm::core::MemorySize size = _size;
+    if (hadesvm::util::fromString(componentElement.attribute("Size"), size) &&
+        _isValidSize(size))
+    {
+        _size = size;
+    }
+
+    _imageFilePath = componentElement.attribute("ImageFilePath");
+}
+
+hadesvm::core::ComponentEditor * MainStorage::createEditor()
+{
+    return nullptr;
+}
+
+MainStorage::Ui * MainStorage::createUi()
+{
+    return nullptr;
+}
+
+//////////
+//  hadesvm::core::Component (state management)
+void MainStorage::connect() throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Constructed)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    //  The processor finds the storage when it is connected
+    //  and initialized, so the storage must exist by then
+    _storage = new Storage(static_cast<uint32_t>(_size.toBytes()));
+
+    _state = State::Connected;
+}
+
+void MainStorage::initialize() throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Connected)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    _loadImage();   //  may throw
+
+    _state = State::Initialized;
+}
+
+void MainStorage::start() throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Initialized)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    _state = State::Running;
+}
+
+void MainStorage::stop() noexcept
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Running)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    _state = State::Initialized;
+}
+
+void MainStorage::deinitialize() noexcept
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Initialized)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    _storage->clear();
+
+    _state = State::Connected;
+}
+
+void MainStorage::disconnect() noexcept
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Connected)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    delete _storage;
+    _storage = nullptr;
+
+    _state = State::Constructed;
+}
+
+void MainStorage::reset() noexcept
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Initialized)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    //  A reset is a new IPL - the image is reloaded
+    try
+    {
+        _loadImage();
+    }
+    catch (...)
+    {   //  OOPS! Suppress - reset() must NOT throw; the storage stays cleared
+    }
+}
+
+//////////
+//  hadesvm::core::ISnapshotComponent
+void MainStorage::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    writer << _storage->size();
+    writer.writeMemory(_storage->data(), _storage->size());
+    writer.writeMemory(_storage->keys(), _storage->numBlocks());
+}
+
+void MainStorage::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    uint32_t size = 0;
+    reader >> size;
+    if (size != _storage->size())
+    {
+        throw hadesvm::core::VirtualApplianceException(displayName() + " has been resized since the snapshot was taken");
+    }
+    reader.readMemory(_storage->data(), _storage->size());  //  may throw
+    reader.readMemory(_storage->keys(), _storage->numBlocks()); //  may throw
+}
+
+//////////
+//  Operations (configuration)
+void MainStorage::setSize(const hadesvm::core::MemorySize & size)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    if (!_isValidSize(size))
+    {   //  OOPS! Not addressable or not made of whole blocks!
+        throw hadesvm::core::VirtualApplianceException("Invalid main storage size " +
+                                                       hadesvm::util::toString(size));
+    }
+    _size = size;
+}
+
+void MainStorage::setImageFilePath(const QString & imageFilePath)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    _imageFilePath = imageFilePath;
+}
+
+//////////
+//  Implementation helpers
+bool MainStorage::_isValidSize(const hadesvm::core::MemorySize & size)
+{
+    uint64_t bytes = size.toBytes();
+    return bytes > 0 && bytes <= Storage::MaxSize && (bytes & Storage::BlockOffsetMask) == 0;
+}
+
+void MainStorage::_loadImage() throws(hadesvm::core::VirtualApplianceException)
+{
+    _storage->clear();
+    if (!_imageFilePath.isEmpty())
+    {
+        QString fileName = virtualAppliance()->toAbsolutePath(_imageFilePath);
+        if (!_storage->load(fileName))
+        {   //  OOPS!
+            throw hadesvm::core::VirtualApplianceException("Could not read " + fileName);
+        }
+    }
+}
+
+//////////
+//  MainStorage::Type
+HADESVM_IMPLEMENT_SINGLETON(MainStorage::Type)
+MainStorage::Type::Type() {}
+MainStorage::Type::~Type() {}
+
+QString MainStorage::Type::mnemonic() const
+{
+    return "Ibm370MainStorage";
+}
+
+QString MainStorage::Type::displayName() const
+{
+    return "IBM System/370 main storage";
+}
+
+hadesvm::core::ComponentCategory * MainStorage::Type::category() const
+{
+    return hadesvm::core::StandardComponentCategories::Memory;
+}
+
+bool MainStorage::Type::isCompatibleWith(hadesvm::core::VirtualArchitecture * architecture) const
+{
+    return architecture == Ibm370Architecture::instance();
+}
+
+bool MainStorage::Type::isCompatibleWith(hadesvm::core::VirtualApplianceType * type) const
+{
+    return type == hadesvm::core::VirtualMachineType::instance();
+}
+
+MainStorage * MainStorage::Type::createComponent()
+{
+    return new MainStorage();
+}
+
+//  End of hadesvm-ibm3x0/MainStorage.cpp
@@ -0,0 +1,56 @@
+//
+//  hadesvm-ibm3x0/Plugins.cpp
+//
+//  hadesvm-ibm3x0 plugins
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+namespace
+{
+    class Plugin : public hadesvm::util::Plugin
+    {
+        HADESVM_DECLARE_SINGLETON(Plugin)
+
+        //////////
+        //  hadesvm::util::Plugin
+    public:
+        virtual QString         displayName() const override;
+        virtual QVersionNumber  version() const override;
+        virtual void            initialise() override;
+    };
+
+    //////////
+    //  Singleton
+    HADESVM_IMPLEMENT_SINGLETON(Plugin)
+    Plugin::Plugin() {}
+    Plugin::~Plugin() {}
+
+    //////////
+    //  hadesvm::util::Plugin
+    QString Plugin::displayName() const
+    {
+        return "IBM System/3x0";
+    }
+
+    QVersionNumber Plugin::version() const
+    {
+        return QVersionNumber(1, 0, 0);
+    }
+
+    void Plugin::initialise()
+    {
+        hadesvm::core::VirtualArchitecture::register(Ibm370Architecture::instance());
+        hadesvm::core::VirtualApplianceTemplate::register(Ibm370UniprocessorTemplate::instance());
+
+        hadesvm::core::ComponentType::register(MainStorage::Type::instance());
+        hadesvm::core::ComponentType::register(Processor::Type::instance());
+    }
+}
+
+HADESVM_BEGIN_PLUGIN_TABLE()
+    HADESVM_EXPORT_PLUGIN(Plugin::instance())
+HADESVM_END_PLUGIN_TABLE()
+
+//  End of hadesvm-ibm3x0/Plugins.cpp
@@ -0,0 +1,320 @@
+//
+//  hadesvm-ibm3x0/Processor.cpp
+//
+//  hadesvm::ibm3x0::Processor class implementation
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+//////////
+//  Constants
+const hadesvm::core::ClockFrequency Processor::DefaultClockFrequency = hadesvm::core::ClockFrequency::megahertz(5);
+const hadesvm::core::ClockFrequency Processor::MinClockFrequency = hadesvm::core::ClockFrequency::kilohertz(100);
+const hadesvm::core::ClockFrequency Processor::MaxClockFrequency = hadesvm::core::ClockFrequency::gigahertz(4);
+
+//////////
+//  Construction/destruction
+Processor::Processor()
+    :   //  Configuration
+        _clockFrequency(DefaultClockFrequency),
+        //  Threads
+        _stopRequested(false)
+{
+}
+
+Processor::~Processor() noexcept
+{
+    delete _core;   //  just in case; "delete nullptr" is safe
+}
+
+//////////
+//  hadesvm::core::Component
+QString Processor::displayName() const
+{
+    return hadesvm::util::toString(_clockFrequency) + " " + Type::instance()->displayName();
+}
+
+void Processor::serialiseConfiguration(QDomElement componentElement) const
+{
+    componentElement.setAttribute("ClockFrequency", hadesvm::util::toString(_clockFrequency));
+}
+
+void Processor::deserialiseConfiguration(QDomElement componentElement)
+{
+    hadesvm::core::ClockFrequency clockFrequency = _clockFrequency;
+    if (hadesvm::util::fromString(componentElement.attribute("ClockFrequency"), clockFrequency) &&
+        clockFrequency >= MinClockFrequency && clockFrequency <= MaxClockFrequency)
+    {
+        _clockFrequency = clockFrequency;
+    }
+}
+
+hadesvm::core::ComponentEditor * Processor::createEditor()
+{
+    return nullptr;
+}
+
+Processor::Ui * Processor::createUi()
+{
+    return nullptr;
+}
+
+//////////
+//  hadesvm::core::Component (state management)
+//  Must only be called from the QApplication's main thread (except state())
+void Processor::connect() throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Constructed)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    QList<MainStorage*> mainStorages = virtualAppliance()->componentsImplementing<MainStorage>();
+    if (mainStorages.size() != 1)
+    {   //  OOPS!
+        throw hadesvm::core::VirtualApplianceException("A System/370 processor requires the presence of a single main storage");
+    }
+    _mainStorage = mainStorages[0];
+
+    //  Done
+    _state = State::Connected;
+}
+
+void Processor::initialize() throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Connected)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    //  All components are connected by now, so the storage exists
+    Q_ASSERT(_mainStorage->storage() != nullptr);
+    _core = new ProcessorCore(_mainStorage->storage(), _clockFrequency);
+    _iplPending = true;
+
+    //  Done
+    _state = State::Initialized;
+}
+
+void Processor::start() throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Initialized)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    //  The main storage has loaded its image by now
+    if (_iplPending)
+    {
+        _iplPending = false;
+        if (!_core->ipl())
+        {
+            throw hadesvm::core::VirtualApplianceException("The IPL PSW is not valid");
+        }
+    }
+
+    _stopRequested = false;
+    _workerThread = new _WorkerThread(this);
+    _workerThread->start();
+
+    //  Done
+    _state = State::Running;
+}
+
+void Processor::stop() noexcept
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Running)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    _stopRequested = true;
+    wakeUp();
+    _workerThread->wait(15 * 1000); //  wait 15 seconds...
+    if (_workerThread->isRunning())
+    {   //  ...then force-kill it as a last resort
+        _workerThread->terminate();
+        _workerThread->wait(ULONG_MAX);
+    }
+    delete _workerThread;
+    _workerThread = nullptr;
+
+    //  Done
+    _state = State::Initialized;
+}
+
+void Processor::deinitialize() noexcept
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Initialized)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    delete _core;
+    _core = nullptr;
+
+    //  Done
+    _state = State::Connected;
+}
+
+void Processor::disconnect() noexcept
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_state != State::Connected)
+    {   //  OOPS! Can't
+        return;
+    }
+
+    _mainStorage = nullptr;
+
+    //  Done
+    _state = State::Constructed;
+}
+
+void Processor::reset() noexcept
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+
+    if (_core != nullptr)
+    {   //  A reset is followed by a new IPL
+        _core->reset();
+        _core->ipl();
+    }
+}
+
+//////////
+//  hadesvm::core::IClockedComponent
+void Processor::onClockTick() noexcept
+{
+    if (_core != nullptr)
+    {
+        _core->runCycles(1);
+    }
+}
+
+//////////
+//  hadesvm::core::ISnapshotComponent
+void Processor::saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    writer << _iplPending;
+    _core->saveSnapshot(writer);
+}
+
+void Processor::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    Q_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
+    Q_ASSERT(_state == State::Initialized);
+
+    reader >> _iplPending;
+    _core->restoreSnapshot(reader); //  may throw
+}
+
+//////////
+//  Operations
+void Processor::wakeUp()
+{
+    if (_workerThread != nullptr)
+    {
+        _workerThread->wakeUp();
+    }
+}
+
+//////////
+//  Operations (configuration)
+void Processor::setClockFrequency(const hadesvm::core::ClockFrequency & clockFrequency)
+{
+    Q_ASSERT(_state == State::Constructed);
+
+    if (clockFrequency < MinClockFrequency || clockFrequency > MaxClockFrequency)
+    {   //  OOPS! Out of range!
+        throw hadesvm::core::VirtualApplianceException("Invalid clock frequency " +
+                                                       hadesvm::util::toString(clockFrequency));
+    }
+    _clockFrequency = clockFrequency;
+}
+
+//////////
+//  Implementation helpers
+unsigned Processor::_runCycles(unsigned numCycles)
+{
+    unsigned cyclesRun = 0;
+    while (cyclesRun < numCycles)
+    {
+        if (_stopRequested)
+        {   //  Don't keep the stop() waiting
+            break;
+        }
+        cyclesRun += _core->runCycles(qMin(numCycles - cyclesRun, _CyclesPerSlice));
+    }
+    return cyclesRun;
+}
+
+//////////
+//  Processor::_WorkerThread
+void Processor::_WorkerThread::run()
+{
+    pace(_processor->_stopRequested);
+}
+
+unsigned Processor::_WorkerThread::runCycles(unsigned numCycles)
+{
+    return _processor->_runCycles(numCycles);
+}
+
+uint64_t Processor::_WorkerThread::idleCycles()
+{   //  The waiting CPU only counts the timers
+    return _processor->_core->idleCycles();
+}
+
+//////////
+//  Processor::Type
+HADESVM_IMPLEMENT_SINGLETON(Processor::Type)
+Processor::Type::Type() {}
+Processor::Type::~Type() {}
+
+QString Processor::Type::mnemonic() const
+{
+    return "Ibm370Processor";
+}
+
+QString Processor::Type::displayName() const
+{
+    return "IBM System/370 processor";
+}
+
+hadesvm::core::ComponentCategory * Processor::Type::category() const
+{
+    return hadesvm::core::StandardComponentCategories::Processors;
+}
+
+bool Processor::Type::isCompatibleWith(hadesvm::core::VirtualArchitecture * architecture) const
+{
+    return architecture == Ibm370Architecture::instance();
+}
+
+bool Processor::Type::isCompatibleWith(hadesvm::core::VirtualApplianceType * type) const
+{
+    return type == hadesvm::core::VirtualMachineType::instance();
+}
+
+Processor * Processor::Type::createComponent()
+{
+    return new Processor();
+}
+
+//  End of hadesvm-ibm3x0/Processor.cpp
@@ -0,0 +1,171 @@
+//
+//  hadesvm-ibm3x0/Processor.hpp
+//
+//  IBM System/370 processor component
+//
+//////////
+
+namespace hadesvm
+{
+    namespace ibm3x0
+    {
+        //////////
+        //  The System/370 processor - a single CPU (see ProcessorCore),
+        //  which runs on a host thread of its own. When the VM starts,
+        //  the CPU completes an initial program load from main storage:
+        //  its image begins with the IPL PSW.
+        class HADESVM_IBM3X0_PUBLIC Processor final : public hadesvm::core::Component,
+                                                      public virtual hadesvm::core::IClockedComponent,
+                                                      public virtual hadesvm::core::IActiveComponent,
+                                                      public virtual hadesvm::core::ISnapshotComponent
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Processor)
+
+            //////////
+            //  Constants
+        public:
+            static const hadesvm::core::ClockFrequency  DefaultClockFrequency;
+            static const hadesvm::core::ClockFrequency  MinClockFrequency;
+            static const hadesvm::core::ClockFrequency  MaxClockFrequency;
+
+            //////////
+            //  Types
+        public:
+            //  The type of a System/370 processor
+            class HADESVM_IBM3X0_PUBLIC Type final : public hadesvm::core::ComponentType
+            {
+                HADESVM_DECLARE_SINGLETON(Type)
+
+                //////////
+                //  hadesvm::util::StockObject
+            public:
+                virtual QString     mnemonic() const override;
+                virtual QString     displayName() const override;
+
+                //////////
+                //  hadesvm::core::ComponentType
+            public:
+                virtual hadesvm::core::ComponentCategory *
+                                    category() const override;
+                virtual bool        isCompatibleWith(hadesvm::core::VirtualArchitecture * architecture) const override;
+                virtual bool        isCompatibleWith(hadesvm::core::VirtualApplianceType * type) const override;
+                virtual Processor * createComponent() override;
+            };
+
+            //////////
+            //  Construction/destruction
+        public:
+            Processor();
+            virtual ~Processor() noexcept;
+
+            //////////
+            //  hadesvm::core::Component
+        public:
+            virtual Type *          componentType() const override { return Type::instance(); }
+            virtual QString         displayName() const override;
+            virtual void            serialiseConfiguration(QDomElement componentElement) const override;
+            virtual void            deserialiseConfiguration(QDomElement componentElement) override;
+            virtual hadesvm::core::ComponentEditor *    createEditor() override;
+            virtual Ui *            createUi() override;
+
+            //////////
+            //  hadesvm::core::Component (state management)
+            //  Must only be called from the QApplication's main thread (except state())
+        public:
+            virtual State           state() const noexcept override { return _state; }
+            virtual void            connect() throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            initialize() throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            start() throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            stop() noexcept override;
+            virtual void            deinitialize() noexcept override;
+            virtual void            disconnect() noexcept override;
+            virtual void            reset() noexcept override;
+
+            //////////
+            //  hadesvm::core::IClockedComponent
+        public:
+            virtual hadesvm::core::ClockFrequency
+                                    clockFrequency() const noexcept override { return _clockFrequency; }
+            virtual void            onClockTick() noexcept override;
+
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+        public:
+            virtual void            saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
+            //////////
+            //  Operations
+        public:
+            //  The CPU; nullptr unless initialized
+            ProcessorCore *         core() const { return _core; }
+
+            //  Wakes the worker thread up if it sleeps because the CPU waits.
+            //  Must be called (from any thread) by whoever makes an
+            //  interruption pending for the CPU.
+            void                    wakeUp();
+
+            //////////
+            //  Operations (configuration)
+        public:
+            void                    setClockFrequency(const hadesvm::core::ClockFrequency & clockFrequency);
+
+            //////////
+            //  Implementation
+        private:
+            State                   _state = State::Constructed;
+
+            //  Configuration
+            hadesvm::core::ClockFrequency   _clockFrequency;
+
+            //  Links to other VM components
+            MainStorage *           _mainStorage = nullptr; //  nullptr == not connected
+
+            //  Runtime state
+            ProcessorCore *         _core = nullptr;    //  created when initialized
+            bool                    _iplPending = false;    //  the image is loaded after initialize()
+
+            //  The number of clock cycles the CPU runs between checks
+            //  for a stop request
+            static const unsigned   _CyclesPerSlice = 4096;
+
+            //  Threads
+            class _WorkerThread final : public QThread,
+                                        public hadesvm::core::ProcessorPacer
+            {
+                HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(_WorkerThread)
+
+                //////////
+                //  Construction/destruction
+            public:
+                explicit _WorkerThread(Processor * processor)
+                    :   ProcessorPacer(processor, true, true),
+                        _processor(processor) {}
+                virtual ~_WorkerThread() = default;
+
+                //////////
+                //  QThread
+            protected:
+                virtual void    run() override;
+
+                //////////
+                //  hadesvm::core::ProcessorPacer
+            protected:
+                virtual unsigned    runCycles(unsigned numCycles) override;
+                virtual uint64_t    idleCycles() override;
+
+                //////////
+                //  Implementation
+            private:
+                Processor *const    _processor;
+            };
+            _WorkerThread *         _workerThread = nullptr;
+            std::atomic<bool>       _stopRequested;
+
+            //  Helpers
+            unsigned                _runCycles(unsigned numCycles);
+        };
+    }
+}
+
+//  End of hadesvm-ibm3x0/Processor.hpp
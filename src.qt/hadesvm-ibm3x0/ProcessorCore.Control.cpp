@@ -0,0 +1,530 @@
+//
+//  hadesvm-ibm3x0/ProcessorCore.Control.cpp
+//
+//  hadesvm::ibm3x0::ProcessorCore class implementation (control instructions)
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+namespace
+{
+    //  The bits of an EC mode system mask that may be nonzero
+    const uint8_t EcSystemMaskBits = 0x47;
+
+    //  The bits of a real address that designate a 2K block
+    const uint32_t BlockAddressMask = UINT32_C(0x00FFF800);
+}
+
+//////////
+//  Instruction handlers (storage keys)
+unsigned ProcessorCore::_handleSSK(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t absoluteAddress = _prefixed(_gr[instruction.r2] & BlockAddressMask);
+    if (absoluteAddress >= _storage->size())
+    {
+        _raiseProgramInterruption(ProgramInterruption::Addressing);
+        return 1;
+    }
+    _storage->key(absoluteAddress) = static_cast<uint8_t>(_gr[instruction.r1] & Storage::KeyMask);
+    //  The TLB may hold translations that the new key no longer permits
+    //  or that would not record the references and changes anew
+    _invalidateTlb();
+    return 4;
+}
+
+unsigned ProcessorCore::_handleISK(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t absoluteAddress = _prefixed(_gr[instruction.r2] & BlockAddressMask);
+    if (absoluteAddress >= _storage->size())
+    {
+        _raiseProgramInterruption(ProgramInterruption::Addressing);
+        return 1;
+    }
+    _gr[instruction.r1] = (_gr[instruction.r1] & UINT32_C(0xFFFFFF00)) |
+                          (_storage->key(absoluteAddress) & Storage::KeyMask);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleRRB(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t absoluteAddress = _prefixed(_effectiveAddress(instruction.b2, instruction.d2) & BlockAddressMask);
+    if (absoluteAddress >= _storage->size())
+    {
+        _raiseProgramInterruption(ProgramInterruption::Addressing);
+        return 1;
+    }
+    uint8_t & key = _storage->key(absoluteAddress);
+    _psw.conditionCode = static_cast<uint8_t>((key >> 1) & 0x03);
+    key = static_cast<uint8_t>(key & ~Storage::ReferenceMask);
+    //  ...so that the next reference goes through _translate() and is recorded
+    _invalidateTlb();
+    return 4;
+}
+
+//////////
+//  Instruction handlers (PSW)
+unsigned ProcessorCore::_handleSVC(const _DecodedInstruction & instruction)
+{
+    _raiseSvcInterruption(instruction.i2);
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSSM(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    if ((_cr[0] & _SsmSuppressionMask) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::SpecialOperation);
+        return 1;
+    }
+    uint8_t systemMask;
+    if (!_load(_effectiveAddress(instruction.b2, instruction.d2), systemMask))
+    {
+        return 2;
+    }
+    if (_psw.ecMode && (systemMask & ~EcSystemMaskBits) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return 2;
+    }
+    _setSystemMask(systemMask);
+    return 3;
+}
+
+unsigned ProcessorCore::_handleLPSW(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    uint64_t value;
+    if (!_checkAlignment(address, 8) || !_load(address, value))
+    {
+        return 2;
+    }
+    _Psw psw;
+    if (!_pswFromDoubleWord(value, psw))
+    {
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return 2;
+    }
+    _setPsw(psw);
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSTNSM(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint8_t systemMask = static_cast<uint8_t>(_psw.systemMask & instruction.i2);
+    if (_store(_effectiveAddress(instruction.b1, instruction.d1), _psw.systemMask))
+    {
+        _setSystemMask(systemMask);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleSTOSM(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint8_t systemMask = static_cast<uint8_t>(_psw.systemMask | instruction.i2);
+    if (_psw.ecMode && (systemMask & ~EcSystemMaskBits) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return 1;
+    }
+    if (_store(_effectiveAddress(instruction.b1, instruction.d1), _psw.systemMask))
+    {
+        _setSystemMask(systemMask);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleSPKA(const _DecodedInstruction & instruction)
+{
+    uint8_t key = static_cast<uint8_t>((_effectiveAddress(instruction.b2, instruction.d2) >> 4) & 0x0F);
+    if (_psw.problemState && (_cr[3] & (UINT32_C(0x80000000) >> key)) == 0)
+    {   //  The PSW key mask doesn't permit this key
+        _raiseProgramInterruption(ProgramInterruption::PrivilegedOperation);
+        return 1;
+    }
+    _psw.key = key;
+    _updateAccessTag();
+    //  The rest of the basic block was fetched under the old key
+    _leaveBasicBlock = true;
+    return 2;
+}
+
+unsigned ProcessorCore::_handleIPK(const _DecodedInstruction & /*instruction*/)
+{
+    if (_psw.problemState && (_cr[0] & _ExtractionAuthorityMask) == 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::PrivilegedOperation);
+        return 1;
+    }
+    _gr[2] = (_gr[2] & UINT32_C(0xFFFFFF0F)) | (static_cast<uint32_t>(_psw.key) << 4);
+    return 2;
+}
+
+//////////
+//  Instruction handlers (features not installed)
+unsigned ProcessorCore::_handleDIAGNOSE(const _DecodedInstruction & /*instruction*/)
+{   //  The diagnose functions are model-dependent; this model has none
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleWRD(const _DecodedInstruction & /*instruction*/)
+{   //  No direct-control feature
+    _raiseProgramInterruption(ProgramInterruption::Operation);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleRDD(const _DecodedInstruction & /*instruction*/)
+{   //  No direct-control feature
+    _raiseProgramInterruption(ProgramInterruption::Operation);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleIO(const _DecodedInstruction & /*instruction*/)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    //  No channels - each addressed channel is not operational
+    _psw.conditionCode = 3;
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSIGP(const _DecodedInstruction & /*instruction*/)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    //  A uniprocessor - no other CPU is operational
+    _psw.conditionCode = 3;
+    return 4;
+}
+
+unsigned ProcessorCore::_handleMC(const _DecodedInstruction & instruction)
+{
+    if ((instruction.i2 & 0xF0) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return 1;
+    }
+    unsigned monitorClass = instruction.i2 & 0x0F;
+    if ((_cr[8] & (UINT32_C(0x00008000) >> monitorClass)) != 0)
+    {
+        _storeRealHalfWord(_MonitorClassLocation, static_cast<uint16_t>(monitorClass));
+        _storeRealWord(_MonitorCodeLocation, _effectiveAddress(instruction.b1, instruction.d1));
+        _raiseProgramInterruption(ProgramInterruption::MonitorEvent);
+    }
+    return 2;
+}
+
+//////////
+//  Instruction handlers (address translation)
+unsigned ProcessorCore::_handleLRA(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t realAddress = 0, entryAddress = 0;
+    switch (_walkTranslationTables(_effectiveAddressRx(instruction), realAddress, entryAddress))
+    {
+        case _DatResult::Translated:
+            _gr[instruction.r1] = realAddress;
+            _psw.conditionCode = 0;
+            break;
+        case _DatResult::SegmentInvalid:
+            _gr[instruction.r1] = entryAddress;
+            _psw.conditionCode = 1;
+            break;
+        case _DatResult::PageInvalid:
+            _gr[instruction.r1] = entryAddress;
+            _psw.conditionCode = 2;
+            break;
+        case _DatResult::SegmentTableLength:
+        case _DatResult::PageTableLength:
+            _gr[instruction.r1] = entryAddress;
+            _psw.conditionCode = 3;
+            break;
+        case _DatResult::TranslationSpecification:
+            _raiseProgramInterruption(ProgramInterruption::TranslationSpecification);
+            break;
+        case _DatResult::Addressing:
+        default:
+            _raiseProgramInterruption(ProgramInterruption::Addressing);
+            break;
+    }
+    return 10;
+}
+
+unsigned ProcessorCore::_handlePTLB(const _DecodedInstruction & /*instruction*/)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    _invalidateTlb();
+    return 4;
+}
+
+//////////
+//  Instruction handlers (control registers)
+unsigned ProcessorCore::_handleSTCTL(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    unsigned r1 = instruction.r1, r3 = instruction.r2;
+    unsigned count = ((r3 - r1) & 0x0F) + 1;
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    _Operand operand;
+    if (!_checkAlignment(address, 4) || !_accessOperand(address, count * 4, _StoreAccess, operand))
+    {
+        return 2;
+    }
+    for (unsigned i = 0; i < count; i++)
+    {
+        uint32_t value = _cr[(r1 + i) & 0x0F];
+        operand[i * 4] = static_cast<uint8_t>(value >> 24);
+        operand[i * 4 + 1] = static_cast<uint8_t>(value >> 16);
+        operand[i * 4 + 2] = static_cast<uint8_t>(value >> 8);
+        operand[i * 4 + 3] = static_cast<uint8_t>(value);
+    }
+    return 2 + count;
+}
+
+unsigned ProcessorCore::_handleLCTL(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    unsigned r1 = instruction.r1, r3 = instruction.r2;
+    unsigned count = ((r3 - r1) & 0x0F) + 1;
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    _Operand operand;
+    if (!_checkAlignment(address, 4) || !_accessOperand(address, count * 4, _LoadAccess, operand))
+    {
+        return 2;
+    }
+    uint32_t oldCr0 = _cr[0], oldCr1 = _cr[1];
+    for (unsigned i = 0; i < count; i++)
+    {
+        _cr[(r1 + i) & 0x0F] = (static_cast<uint32_t>(operand[i * 4]) << 24) |
+                               (static_cast<uint32_t>(operand[i * 4 + 1]) << 16) |
+                               (static_cast<uint32_t>(operand[i * 4 + 2]) << 8) |
+                               static_cast<uint32_t>(operand[i * 4 + 3]);
+    }
+    if ((_cr[0] & ~_LowAddressProtectionMask) != (oldCr0 & ~_LowAddressProtectionMask) || _cr[1] != oldCr1)
+    {   //  Translation may have changed
+        _invalidateTlb();
+    }
+    else if (_cr[0] != oldCr0)
+    {   //  Only low-address protection has changed, which store
+        //  entries already made for logical block 0 must not bypass
+        _invalidateStoreTlbEntries();
+    }
+    //  The external interruption masks may have changed
+    _leaveBasicBlock = true;
+    return 4 + count;
+}
+
+//////////
+//  Instruction handlers (CPU identification)
+unsigned ProcessorCore::_handleSTIDP(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    if (_checkAlignment(address, 8))
+    {
+        _store(address, CpuId);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSTAP(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    if (_checkAlignment(address, 2))
+    {   //  A uniprocessor is CPU 0
+        _store(address, static_cast<uint16_t>(0));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSPX(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    uint32_t value;
+    if (!_checkAlignment(address, 4) || !_load(address, value))
+    {
+        return 2;
+    }
+    uint32_t prefix = value & UINT32_C(0x00FFF000);
+    if (prefix > _storage->size() - 4096)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Addressing);
+        return 2;
+    }
+    _prefix = prefix;
+    //  The TLB maps to absolute addresses
+    _invalidateTlb();
+    return 8;
+}
+
+unsigned ProcessorCore::_handleSTPX(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    if (_checkAlignment(address, 4))
+    {
+        _store(address, _prefix);
+    }
+    return 2;
+}
+
+//////////
+//  Instruction handlers (timers)
+unsigned ProcessorCore::_handleSCK(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    uint64_t value;
+    if (_checkAlignment(address, 8) && _load(address, value))
+    {
+        _synchronizeClocks();
+        _todClock = value;
+        _updateTimerInterruptions();
+        _psw.conditionCode = 0;
+    }
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSTCK(const _DecodedInstruction & instruction)
+{
+    _synchronizeClocks();
+    if (_store(_effectiveAddress(instruction.b2, instruction.d2), _todClock))
+    {
+        _psw.conditionCode = 0;
+    }
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSCKC(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    uint64_t value;
+    if (_checkAlignment(address, 8) && _load(address, value))
+    {
+        _synchronizeClocks();
+        _clockComparator = value;
+        _updateTimerInterruptions();
+        //  ...which may now be pending
+        _leaveBasicBlock = true;
+    }
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSTCKC(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    if (_checkAlignment(address, 8))
+    {
+        _store(address, _clockComparator);
+    }
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSPT(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    uint64_t value;
+    if (_checkAlignment(address, 8) && _load(address, value))
+    {
+        _synchronizeClocks();
+        _cpuTimer = static_cast<int64_t>(value);
+        _updateTimerInterruptions();
+        //  ...which may now be pending
+        _leaveBasicBlock = true;
+    }
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSTPT(const _DecodedInstruction & instruction)
+{
+    if (!_checkSupervisorState())
+    {
+        return 1;
+    }
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    if (_checkAlignment(address, 8))
+    {
+        _synchronizeClocks();
+        _store(address, static_cast<uint64_t>(_cpuTimer));
+    }
+    return 4;
+}
+
+//  End of hadesvm-ibm3x0/ProcessorCore.Control.cpp
@@ -0,0 +1,705 @@
+//
+//  hadesvm-ibm3x0/ProcessorCore.Decimal.cpp
+//
+//  hadesvm::ibm3x0::ProcessorCore class implementation (decimal instructions)
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+namespace
+{
+    //  Magnitudes for decimal multiplication and division, least
+    //  significant digit first
+    const unsigned MaxMagnitudeDigits = 64;
+
+    struct Magnitude
+    {
+        uint8_t     digits[MaxMagnitudeDigits];
+    };
+
+    //  Returns -1, 0 or +1 as a < b, a == b or a > b
+    int compareMagnitudes(const Magnitude & a, const Magnitude & b)
+    {
+        for (unsigned i = MaxMagnitudeDigits; i-- > 0; )
+        {
+            if (a.digits[i] != b.digits[i])
+            {
+                return (a.digits[i] < b.digits[i]) ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    //  a -= b; a must not be less than b
+    void subtractMagnitude(Magnitude & a, const Magnitude & b)
+    {
+        int borrow = 0;
+        for (unsigned i = 0; i < MaxMagnitudeDigits; i++)
+        {
+            int digit = a.digits[i] - b.digits[i] - borrow;
+            borrow = (digit < 0) ? 1 : 0;
+            a.digits[i] = static_cast<uint8_t>(digit + 10 * borrow);
+        }
+    }
+
+    //  a = a * 10 + digit
+    void shiftInDigit(Magnitude & a, uint8_t digit)
+    {
+        memmove(a.digits + 1, a.digits, MaxMagnitudeDigits - 1);
+        a.digits[0] = digit;
+    }
+}
+
+//////////
+//  Implementation helpers (decimal)
+bool ProcessorCore::_loadDecimal(uint32_t address, unsigned length, _Decimal & value)
+{
+    Q_ASSERT(length > 0 && length <= 16);
+
+    _Operand operand;
+    if (!_accessOperand(address, length, _LoadAccess, operand))
+    {
+        return false;
+    }
+    memset(value.digits, 0, sizeof(value.digits));
+    value.numDigits = 2 * length - 1;
+    uint8_t sign = static_cast<uint8_t>(operand[length - 1] & 0x0F);
+    if (sign < 0x0A)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Data);
+        return false;
+    }
+    value.negative = (sign == 0x0B || sign == 0x0D);
+    for (unsigned i = 0; i < value.numDigits; i++)
+    {
+        uint8_t byte = operand[length - 1 - (i + 1) / 2];
+        uint8_t digit = static_cast<uint8_t>(((i % 2) == 0) ? (byte >> 4) : (byte & 0x0F));
+        if (digit > 9)
+        {
+            _raiseProgramInterruption(ProgramInterruption::Data);
+            return false;
+        }
+        value.digits[i] = digit;
+    }
+    return true;
+}
+
+bool ProcessorCore::_storeDecimal(uint32_t address, unsigned length, const _Decimal & value, bool & overflow)
+{
+    Q_ASSERT(length > 0 && length <= 16);
+
+    _Operand operand;
+    if (!_accessOperand(address, length, _StoreAccess, operand))
+    {
+        return false;
+    }
+    unsigned numDigits = 2 * length - 1;
+    overflow = false;
+    for (unsigned i = numDigits; i < value.numDigits; i++)
+    {
+        overflow |= (value.digits[i] != 0);
+    }
+    //  The preferred signs are C (plus) and D (minus)
+    operand[length - 1] = static_cast<uint8_t>((value.digits[0] << 4) | (value.negative ? 0x0D : 0x0C));
+    for (unsigned i = 1; i < numDigits; i += 2)
+    {
+        uint8_t low = (i < value.numDigits) ? value.digits[i] : 0;
+        uint8_t high = (i + 1 < value.numDigits) ? value.digits[i + 1] : 0;
+        operand[length - 1 - (i + 1) / 2] = static_cast<uint8_t>((high << 4) | low);
+    }
+    return true;
+}
+
+bool ProcessorCore::_isZero(const _Decimal & value)
+{
+    for (unsigned i = 0; i < value.numDigits; i++)
+    {
+        if (value.digits[i] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int ProcessorCore::_compareMagnitudes(const _Decimal & a, const _Decimal & b)
+{
+    for (unsigned i = _MaxDecimalDigits + 1; i-- > 0; )
+    {
+        if (a.digits[i] != b.digits[i])
+        {
+            return (a.digits[i] < b.digits[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+void ProcessorCore::_addDecimal(const _Decimal & a, const _Decimal & b, _Decimal & result)
+{
+    unsigned numDigits = qMax(a.numDigits, b.numDigits);
+    memset(result.digits, 0, sizeof(result.digits));
+    if (a.negative == b.negative)
+    {   //  Add magnitudes; there may be a carry digit
+        int carry = 0;
+        for (unsigned i = 0; i < numDigits; i++)
+        {
+            int digit = a.digits[i] + b.digits[i] + carry;
+            carry = (digit > 9) ? 1 : 0;
+            result.digits[i] = static_cast<uint8_t>(digit - 10 * carry);
+        }
+        result.digits[numDigits] = static_cast<uint8_t>(carry);
+        result.numDigits = numDigits + 1;
+        result.negative = a.negative;
+    }
+    else
+    {   //  Subtract the smaller magnitude from the larger
+        const _Decimal & larger = (_compareMagnitudes(a, b) >= 0) ? a : b;
+        const _Decimal & smaller = (&larger == &a) ? b : a;
+        int borrow = 0;
+        for (unsigned i = 0; i < numDigits; i++)
+        {
+            int digit = larger.digits[i] - smaller.digits[i] - borrow;
+            borrow = (digit < 0) ? 1 : 0;
+            result.digits[i] = static_cast<uint8_t>(digit + 10 * borrow);
+        }
+        result.numDigits = numDigits;
+        result.negative = larger.negative;
+    }
+    if (_isZero(result))
+    {   //  A zero sum is positive
+        result.negative = false;
+    }
+}
+
+void ProcessorCore::_setDecimalConditionCode(const _Decimal & result, bool overflow)
+{
+    if (overflow)
+    {
+        _decimalOverflow();
+    }
+    else
+    {
+        _psw.conditionCode = _isZero(result) ? 0 : (result.negative ? 1 : 2);
+    }
+}
+
+unsigned ProcessorCore::_executeDecimalAddition(const _DecodedInstruction & instruction, bool subtract)
+{
+    unsigned length1 = instruction.r1 + 1u, length2 = instruction.r2 + 1u;
+    uint32_t address1 = _effectiveAddress(instruction.b1, instruction.d1);
+    _Decimal op1, op2, result;
+    if (!_loadDecimal(_effectiveAddress(instruction.b2, instruction.d2), length2, op2) ||
+        !_loadDecimal(address1, length1, op1))
+    {
+        return 3;
+    }
+    if (subtract)
+    {
+        op2.negative = !op2.negative;
+    }
+    _addDecimal(op1, op2, result);
+    bool overflow = false;
+    if (_storeDecimal(address1, length1, result, overflow))
+    {
+        _setDecimalConditionCode(result, overflow);
+    }
+    return 3 + (length1 + length2) / 2;
+}
+
+unsigned ProcessorCore::_executeEdit(const _DecodedInstruction & instruction, bool markSignificance)
+{
+    unsigned length = instruction.i2 + 1u;
+    uint32_t patternAddress = _effectiveAddress(instruction.b1, instruction.d1);
+    uint32_t sourceAddress = _effectiveAddress(instruction.b2, instruction.d2);
+    _Operand pattern;
+    if (!_accessOperand(patternAddress, length, _StoreAccess, pattern))
+    {
+        return 3;
+    }
+
+    //  The edited result is built aside, so that an exception on the
+    //  source leaves the pattern unchanged
+    uint8_t result[256];
+    uint8_t fill = pattern[0];
+    bool significance = false, nonzero = false;
+    bool haveRightDigit = false;
+    uint8_t sourceByte = 0;
+    uint32_t markAddress = _gr[1];
+    bool markAddressSet = false;
+    for (unsigned i = 0; i < length; i++)
+    {
+        uint8_t patternByte = pattern[i];
+        if (patternByte == 0x20 || patternByte == 0x21)
+        {   //  Digit selector or significance starter
+            uint8_t digit;
+            if (haveRightDigit)
+            {
+                digit = static_cast<uint8_t>(sourceByte & 0x0F);
+                haveRightDigit = false;
+            }
+            else
+            {
+                if (!_load(sourceAddress, sourceByte))
+                {
+                    return 3;
+                }
+                sourceAddress = (sourceAddress + 1) & AddressMask;
+                digit = static_cast<uint8_t>(sourceByte >> 4);
+                haveRightDigit = true;
+            }
+            if (digit > 9)
+            {
+                _raiseProgramInterruption(ProgramInterruption::Data);
+                return 3;
+            }
+            if (significance || digit != 0)
+            {
+                if (!significance && markSignificance)
+                {
+                    markAddress = (patternAddress + i) & AddressMask;
+                    markAddressSet = true;
+                }
+                result[i] = static_cast<uint8_t>(0xF0 | digit);
+                significance = true;
+            }
+            else
+            {
+                result[i] = fill;
+            }
+            nonzero |= (digit != 0);
+            if (patternByte == 0x21)
+            {
+                significance = true;
+            }
+            //  The right half of a source byte may be its sign
+            if (haveRightDigit && (sourceByte & 0x0F) > 9)
+            {
+                uint8_t sign = static_cast<uint8_t>(sourceByte & 0x0F);
+                haveRightDigit = false;
+                if (sign != 0x0B && sign != 0x0D)
+                {   //  Plus
+                    significance = false;
+                }
+            }
+        }
+        else if (patternByte == 0x22)
+        {   //  Field separator
+            result[i] = fill;
+            significance = false;
+            nonzero = false;
+        }
+        else
+        {   //  Message byte
+            result[i] = significance ? patternByte : fill;
+        }
+    }
+    for (unsigned i = 0; i < length; i++)
+    {
+        pattern[i] = result[i];
+    }
+    if (markAddressSet)
+    {
+        _gr[1] = (_gr[1] & UINT32_C(0xFF000000)) | markAddress;
+    }
+    _psw.conditionCode = !nonzero ? 0 : (significance ? 1 : 2);
+    return 3 + length / 2;
+}
+
+//////////
+//  Instruction handlers
+unsigned ProcessorCore::_handleCVD(const _DecodedInstruction & instruction)
+{
+    int64_t value = static_cast<int32_t>(_gr[instruction.r1]);
+    _Decimal result;
+    memset(result.digits, 0, sizeof(result.digits));
+    result.numDigits = 15;
+    result.negative = (value < 0);
+    uint64_t magnitude = static_cast<uint64_t>(qAbs(value));
+    for (unsigned i = 0; magnitude != 0; i++)
+    {
+        result.digits[i] = static_cast<uint8_t>(magnitude % 10);
+        magnitude /= 10;
+    }
+    bool overflow = false;
+    _storeDecimal(_effectiveAddressRx(instruction), 8, result, overflow);
+    return 8;
+}
+
+unsigned ProcessorCore::_handleCVB(const _DecodedInstruction & instruction)
+{
+    _Decimal value;
+    if (!_loadDecimal(_effectiveAddressRx(instruction), 8, value))
+    {
+        return 8;
+    }
+    int64_t result = 0;
+    for (unsigned i = value.numDigits; i-- > 0; )
+    {
+        result = result * 10 + value.digits[i];
+    }
+    if (value.negative)
+    {
+        result = -result;
+    }
+    _gr[instruction.r1] = static_cast<uint32_t>(result);
+    if (result < INT32_MIN || result > INT32_MAX)
+    {
+        _raiseProgramInterruption(ProgramInterruption::FixedPointDivide);
+    }
+    return 8;
+}
+
+unsigned ProcessorCore::_handleED(const _DecodedInstruction & instruction)
+{
+    return _executeEdit(instruction, false);
+}
+
+unsigned ProcessorCore::_handleEDMK(const _DecodedInstruction & instruction)
+{
+    return _executeEdit(instruction, true);
+}
+
+unsigned ProcessorCore::_handleSRP(const _DecodedInstruction & instruction)
+{
+    unsigned length1 = instruction.r1 + 1u;
+    uint8_t rounding = instruction.r2;
+    uint32_t address1 = _effectiveAddress(instruction.b1, instruction.d1);
+    unsigned shift = _effectiveAddress(instruction.b2, instruction.d2) & 0x3F;
+
+    _Decimal value, result;
+    if (!_loadDecimal(address1, length1, value))
+    {
+        return 3;
+    }
+    if (rounding > 9)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Data);
+        return 3;
+    }
+    memset(result.digits, 0, sizeof(result.digits));
+    result.numDigits = value.numDigits;
+    result.negative = value.negative;
+    bool shiftedOut = false;
+    if (shift < 32)
+    {   //  Left; nonzero digits shifted out are an overflow
+        for (unsigned i = 0; i < value.numDigits; i++)
+        {
+            if (i + shift < value.numDigits)
+            {
+                result.digits[i + shift] = value.digits[i];
+            }
+            else
+            {
+                shiftedOut |= (value.digits[i] != 0);
+            }
+        }
+    }
+    else
+    {   //  Right, with rounding
+        unsigned count = 64 - shift;
+        for (unsigned i = count; i < value.numDigits; i++)
+        {
+            result.digits[i - count] = value.digits[i];
+        }
+        uint8_t lastShiftedOut = (count - 1 < value.numDigits) ? value.digits[count - 1] : 0;
+        if (lastShiftedOut + rounding >= 10)
+        {
+            for (unsigned i = 0; i < result.numDigits; i++)
+            {
+                if (++result.digits[i] < 10)
+                {
+                    break;
+                }
+                result.digits[i] = 0;
+            }
+        }
+    }
+    if (_isZero(result))
+    {
+        result.negative = false;
+    }
+    bool overflow = false;
+    if (_storeDecimal(address1, length1, result, overflow))
+    {
+        _setDecimalConditionCode(result, overflow || shiftedOut);
+    }
+    return 3 + length1 / 2;
+}
+
+unsigned ProcessorCore::_handleMVO(const _DecodedInstruction & instruction)
+{
+    unsigned length1 = instruction.r1 + 1u, length2 = instruction.r2 + 1u;
+    _Operand op1, op2;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), length2, _LoadAccess, op2) ||
+        !_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), length1, _StoreAccess, op1))
+    {
+        return 3;
+    }
+    uint8_t source[16];
+    for (unsigned i = 0; i < length2; i++)
+    {
+        source[i] = op2[i];
+    }
+    //  The rightmost half-byte of the first operand stays; the second
+    //  operand goes to its left
+    unsigned nibble = 0;
+    uint8_t previous = static_cast<uint8_t>(op1[length1 - 1] & 0x0F);
+    for (unsigned i = length1; i-- > 0; )
+    {
+        uint8_t low = previous;
+        uint8_t high = (nibble < length2) ? static_cast<uint8_t>(source[length2 - 1 - nibble] & 0x0F) : 0;
+        previous = (nibble < length2) ? static_cast<uint8_t>(source[length2 - 1 - nibble] >> 4) : 0;
+        op1[i] = static_cast<uint8_t>((high << 4) | low);
+        nibble++;
+    }
+    return 3 + length1 / 2;
+}
+
+unsigned ProcessorCore::_handlePACK(const _DecodedInstruction & instruction)
+{
+    unsigned length1 = instruction.r1 + 1u, length2 = instruction.r2 + 1u;
+    _Operand op1, op2;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), length2, _LoadAccess, op2) ||
+        !_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), length1, _StoreAccess, op1))
+    {
+        return 3;
+    }
+    uint8_t source[16];
+    for (unsigned i = 0; i < length2; i++)
+    {
+        source[i] = op2[i];
+    }
+    //  The rightmost byte has its halves swapped; the numerics of the
+    //  other bytes go two to a byte, right to left
+    uint8_t last = source[length2 - 1];
+    op1[length1 - 1] = static_cast<uint8_t>((last << 4) | (last >> 4));
+    unsigned next = length2 - 1;    //  ...source bytes left to pack
+    for (unsigned i = length1 - 1; i-- > 0; )
+    {
+        uint8_t low = (next > 0) ? static_cast<uint8_t>(source[--next] & 0x0F) : 0;
+        uint8_t high = (next > 0) ? static_cast<uint8_t>(source[--next] & 0x0F) : 0;
+        op1[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+    return 3 + length1 / 2;
+}
+
+unsigned ProcessorCore::_handleUNPK(const _DecodedInstruction & instruction)
+{
+    unsigned length1 = instruction.r1 + 1u, length2 = instruction.r2 + 1u;
+    _Operand op1, op2;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), length2, _LoadAccess, op2) ||
+        !_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), length1, _StoreAccess, op1))
+    {
+        return 3;
+    }
+    uint8_t source[16];
+    for (unsigned i = 0; i < length2; i++)
+    {
+        source[i] = op2[i];
+    }
+    //  The rightmost byte has its halves swapped; every other digit
+    //  gets a zone of F, right to left
+    uint8_t last = source[length2 - 1];
+    op1[length1 - 1] = static_cast<uint8_t>((last << 4) | (last >> 4));
+    unsigned nibble = 0;    //  ...half-bytes of the source to the left of its rightmost byte used
+    for (unsigned i = length1 - 1; i-- > 0; )
+    {
+        unsigned byte = nibble / 2;
+        uint8_t digit = 0;
+        if (byte + 1 < length2)
+        {
+            uint8_t sourceByte = source[length2 - 2 - byte];
+            digit = static_cast<uint8_t>(((nibble % 2) == 0) ? (sourceByte & 0x0F) : (sourceByte >> 4));
+        }
+        op1[i] = static_cast<uint8_t>(0xF0 | digit);
+        nibble++;
+    }
+    return 3 + length1 / 2;
+}
+
+unsigned ProcessorCore::_handleZAP(const _DecodedInstruction & instruction)
+{
+    unsigned length1 = instruction.r1 + 1u, length2 = instruction.r2 + 1u;
+    _Decimal value;
+    if (!_loadDecimal(_effectiveAddress(instruction.b2, instruction.d2), length2, value))
+    {
+        return 3;
+    }
+    if (_isZero(value))
+    {
+        value.negative = false;
+    }
+    bool overflow = false;
+    if (_storeDecimal(_effectiveAddress(instruction.b1, instruction.d1), length1, value, overflow))
+    {
+        _setDecimalConditionCode(value, overflow);
+    }
+    return 3 + (length1 + length2) / 2;
+}
+
+unsigned ProcessorCore::_handleCP(const _DecodedInstruction & instruction)
+{
+    unsigned length1 = instruction.r1 + 1u, length2 = instruction.r2 + 1u;
+    _Decimal op1, op2;
+    if (!_loadDecimal(_effectiveAddress(instruction.b1, instruction.d1), length1, op1) ||
+        !_loadDecimal(_effectiveAddress(instruction.b2, instruction.d2), length2, op2))
+    {
+        return 3;
+    }
+    //  Minus zero equals plus zero
+    bool negative1 = op1.negative && !_isZero(op1);
+    bool negative2 = op2.negative && !_isZero(op2);
+    int result;
+    if (negative1 != negative2)
+    {
+        result = negative1 ? -1 : 1;
+    }
+    else
+    {
+        result = _compareMagnitudes(op1, op2);
+        if (negative1)
+        {
+            result = -result;
+        }
+    }
+    _psw.conditionCode = (result == 0) ? 0 : ((result < 0) ? 1 : 2);
+    return 3 + (length1 + length2) / 2;
+}
+
+unsigned ProcessorCore::_handleAP(const _DecodedInstruction & instruction)
+{
+    return _executeDecimalAddition(instruction, false);
+}
+
+unsigned ProcessorCore::_handleSP(const _DecodedInstruction & instruction)
+{
+    return _executeDecimalAddition(instruction, true);
+}
+
+unsigned ProcessorCore::_handleMP(const _DecodedInstruction & instruction)
+{
+    unsigned length1 = instruction.r1 + 1u, length2 = instruction.r2 + 1u;
+    uint32_t address1 = _effectiveAddress(instruction.b1, instruction.d1);
+    if (length2 > 8 || length2 >= length1)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return 3;
+    }
+    _Decimal op1, op2;
+    if (!_loadDecimal(_effectiveAddress(instruction.b2, instruction.d2), length2, op2) ||
+        !_loadDecimal(address1, length1, op1))
+    {
+        return 3;
+    }
+    //  The multiplicand must have as many leading zero bytes as the
+    //  multiplier is long, which guarantees the product fits
+    for (unsigned i = op1.numDigits - 2 * length2; i < op1.numDigits; i++)
+    {
+        if (op1.digits[i] != 0)
+        {
+            _raiseProgramInterruption(ProgramInterruption::Data);
+            return 3;
+        }
+    }
+    unsigned sums[2 * (_MaxDecimalDigits + 1)] = {};
+    for (unsigned i = 0; i < op1.numDigits; i++)
+    {
+        for (unsigned j = 0; j < op2.numDigits; j++)
+        {
+            sums[i + j] += static_cast<unsigned>(op1.digits[i] * op2.digits[j]);
+        }
+    }
+    _Decimal product;
+    memset(product.digits, 0, sizeof(product.digits));
+    product.numDigits = op1.numDigits;
+    product.negative = (op1.negative != op2.negative);
+    unsigned carry = 0;
+    for (unsigned i = 0; i < product.numDigits; i++)
+    {
+        unsigned digit = sums[i] + carry;
+        product.digits[i] = static_cast<uint8_t>(digit % 10);
+        carry = digit / 10;
+    }
+    bool overflow = false;
+    _storeDecimal(address1, length1, product, overflow);
+    return 3 + 2 * length1 * length2;
+}
+
+unsigned ProcessorCore::_handleDP(const _DecodedInstruction & instruction)
+{
+    unsigned length1 = instruction.r1 + 1u, length2 = instruction.r2 + 1u;
+    uint32_t address1 = _effectiveAddress(instruction.b1, instruction.d1);
+    if (length2 > 8 || length2 >= length1)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return 3;
+    }
+    _Decimal op1, op2;
+    if (!_loadDecimal(_effectiveAddress(instruction.b2, instruction.d2), length2, op2) ||
+        !_loadDecimal(address1, length1, op1))
+    {
+        return 3;
+    }
+    if (_isZero(op2))
+    {
+        _raiseProgramInterruption(ProgramInterruption::DecimalDivide);
+        return 3;
+    }
+
+    //  Long division, a digit at a time
+    Magnitude divisor = {}, remainder = {}, quotient = {};
+    for (unsigned i = 0; i < op2.numDigits; i++)
+    {
+        divisor.digits[i] = op2.digits[i];
+    }
+    for (unsigned i = op1.numDigits; i-- > 0; )
+    {
+        shiftInDigit(remainder, op1.digits[i]);
+        uint8_t digit = 0;
+        while (compareMagnitudes(remainder, divisor) >= 0)
+        {
+            subtractMagnitude(remainder, divisor);
+            digit++;
+        }
+        quotient.digits[i] = digit;
+    }
+
+    //  The quotient must fit into the bytes left of the remainder
+    unsigned quotientLength = length1 - length2;
+    unsigned quotientDigits = 2 * quotientLength - 1;
+    for (unsigned i = quotientDigits; i < MaxMagnitudeDigits; i++)
+    {
+        if (quotient.digits[i] != 0)
+        {
+            _raiseProgramInterruption(ProgramInterruption::DecimalDivide);
+            return 3;
+        }
+    }
+    _Operand operand;
+    if (!_accessOperand(address1, length1, _StoreAccess, operand))
+    {
+        return 3;
+    }
+    _Decimal quotientValue, remainderValue;
+    memset(quotientValue.digits, 0, sizeof(quotientValue.digits));
+    memset(remainderValue.digits, 0, sizeof(remainderValue.digits));
+    quotientValue.numDigits = quotientDigits;
+    quotientValue.negative = (op1.negative != op2.negative);
+    for (unsigned i = 0; i < quotientDigits; i++)
+    {
+        quotientValue.digits[i] = quotient.digits[i];
+    }
+    remainderValue.numDigits = 2 * length2 - 1;
+    remainderValue.negative = op1.negative;
+    for (unsigned i = 0; i < remainderValue.numDigits; i++)
+    {
+        remainderValue.digits[i] = remainder.digits[i];
+    }
+    bool overflow = false;
+    _storeDecimal(address1, quotientLength, quotientValue, overflow);
+    _storeDecimal(address1 + quotientLength, length2, remainderValue, overflow);
+    return 3 + 10 * length1;
+}
+
+//  End of hadesvm-ibm3x0/ProcessorCore.Decimal.cpp
@@ -0,0 +1,813 @@
+//
+//  hadesvm-ibm3x0/ProcessorCore.Engine.cpp
+//
+//  hadesvm::ibm3x0::ProcessorCore class implementation (execution engine)
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+//  The instructions that a threaded basic block executes without going
+//  through a handler pointer - the ones that the commercial and scientific
+//  instruction mixes are made of
+#define HADESVM_IBM3X0_THREADED_HANDLERS(H)                                     \
+    H(LR) H(LTR) H(AR) H(SR) H(CR) H(CLR) H(NR) H(OR) H(XR) H(ALR) H(SLR)       \
+    H(BALR) H(BCTR) H(BCR) H(BASR)                                              \
+    H(LA) H(L) H(ST) H(LH) H(STH) H(IC) H(STC) H(A) H(S) H(C) H(CL) H(AH)       \
+    H(SH) H(CH) H(N) H(O) H(X) H(AL) H(SL) H(M) H(MH) H(D) H(MR) H(DR)          \
+    H(BAL) H(BAS) H(BCT) H(BC) H(BXH) H(BXLE)                                   \
+    H(SRL) H(SLL) H(SRA) H(SLA) H(SRDL) H(SLDL) H(SRDA) H(SLDA) H(STM) H(LM)    \
+    H(TM) H(MVI) H(CLI) H(NI) H(OI) H(XI) H(ICM) H(STCM) H(CLM)                 \
+    H(MVC) H(CLC) H(NC) H(OC) H(XC) H(TR)                                       \
+    H(LDR) H(LER) H(LTDR) H(LTER) H(ADR) H(AER) H(SDR) H(SER) H(CDR) H(CER)     \
+    H(MDR) H(MER) H(DDR) H(DER)                                                 \
+    H(LD) H(LE) H(STD) H(STE) H(AD) H(AE) H(SD) H(SE) H(CD) H(CE) H(MD) H(ME)   \
+    H(DD) H(DE)
+
+//////////
+//  Implementation helpers (execution engine)
+void ProcessorCore::_runInstructions()
+{
+    _BasicBlock * basicBlock = nullptr;
+    const _DecodedInstruction * instruction = nullptr;
+    const _DecodedInstruction * endInstructions = nullptr;
+
+#if defined(Q_CC_GNU)
+    //  Direct-threaded dispatch - each predecoded instruction records the
+    //  address of the code that executes it and every such piece of code
+    //  jumps directly to the next one, without returning to a common loop
+    struct ThreadedHandler
+    {
+        _InstructionHandler handler;
+        const void *        threadedCode;
+    };
+    #define HADESVM_IBM3X0_THREADED_HANDLER(name) { &ProcessorCore::_handle##name, &&execute##name },
+    static const ThreadedHandler ThreadedHandlers[] =
+    {
+        HADESVM_IBM3X0_THREADED_HANDLERS(HADESVM_IBM3X0_THREADED_HANDLER)
+    };
+    #undef HADESVM_IBM3X0_THREADED_HANDLER
+
+    //  The PSW instruction address points past the instruction while it
+    //  executes; the basic block is left after an instruction that has
+    //  changed the PSW (which includes raising an interruption) or
+    //  stored into a 2K block that holds predecoded instructions
+    #define HADESVM_EXECUTE_INSTRUCTION()                                                   \
+        _instructionAddress = _psw.instructionAddress;                                      \
+        _psw.instructionAddress = (_instructionAddress + instruction->length) & AddressMask; \
+        goto *instruction->threadedCode
+    #define HADESVM_DISPATCH_NEXT_INSTRUCTION()                                 \
+        if (++instruction == endInstructions || _leaveBasicBlock)               \
+        {                                                                       \
+            goto leaveBasicBlock;                                               \
+        }                                                                       \
+        HADESVM_EXECUTE_INSTRUCTION()
+
+enterBasicBlock:
+    if (_cyclesLeft <= 0 || _stopped || _psw.wait ||
+        (_externalPending & _enabledExternalInterruptions()) != 0)
+    {   //  Let the caller take over
+        return;
+    }
+    if ((basicBlock = _enterBasicBlock()) == nullptr)
+    {   //  OOPS! The fetch has failed and raised an interruption
+        _cyclesLeft--;
+        goto enterBasicBlock;
+    }
+    _leaveBasicBlock = false;
+    instruction = basicBlock->instructions;
+    endInstructions = instruction + basicBlock->numInstructions;
+    if (instruction->threadedCode == nullptr)
+    {   //  1st execution of this basic block - thread it
+        for (unsigned i = 0; i < basicBlock->numInstructions; i++)
+        {
+            _DecodedInstruction & decodedInstruction = basicBlock->instructions[i];
+            decodedInstruction.threadedCode = &&executeGeneric;
+            for (const ThreadedHandler & threadedHandler : ThreadedHandlers)
+            {
+                if (threadedHandler.handler == decodedInstruction.handler)
+                {
+                    decodedInstruction.threadedCode = threadedHandler.threadedCode;
+                    break;
+                }
+            }
+        }
+    }
+    HADESVM_EXECUTE_INSTRUCTION();
+
+    #define HADESVM_IBM3X0_THREADED_CODE(name)                                  \
+    execute##name:                                                              \
+        _cyclesLeft -= _handle##name(*instruction);                             \
+        HADESVM_DISPATCH_NEXT_INSTRUCTION();
+    HADESVM_IBM3X0_THREADED_HANDLERS(HADESVM_IBM3X0_THREADED_CODE)
+    #undef HADESVM_IBM3X0_THREADED_CODE
+executeGeneric:
+    _cyclesLeft -= (this->*instruction->handler)(*instruction);
+    HADESVM_DISPATCH_NEXT_INSTRUCTION();
+
+leaveBasicBlock:
+    _instructionCount += static_cast<uint64_t>(instruction - basicBlock->instructions);
+    goto enterBasicBlock;
+
+    #undef HADESVM_DISPATCH_NEXT_INSTRUCTION
+    #undef HADESVM_EXECUTE_INSTRUCTION
+#else
+    for (;;)
+    {
+        if (_cyclesLeft <= 0 || _stopped || _psw.wait ||
+            (_externalPending & _enabledExternalInterruptions()) != 0)
+        {   //  Let the caller take over
+            return;
+        }
+        if ((basicBlock = _enterBasicBlock()) == nullptr)
+        {   //  OOPS! The fetch has failed and raised an interruption
+            _cyclesLeft--;
+            continue;
+        }
+        _leaveBasicBlock = false;
+        instruction = basicBlock->instructions;
+        endInstructions = instruction + basicBlock->numInstructions;
+        while (instruction != endInstructions)
+        {
+            _instructionAddress = _psw.instructionAddress;
+            _psw.instructionAddress = (_instructionAddress + instruction->length) & AddressMask;
+            _cyclesLeft -= (this->*instruction->handler)(*instruction);
+            instruction++;
+            if (_leaveBasicBlock)
+            {
+                break;
+            }
+        }
+        _instructionCount += static_cast<uint64_t>(instruction - basicBlock->instructions);
+    }
+#endif
+}
+
+ProcessorCore::_BasicBlock * ProcessorCore::_enterBasicBlock()
+{
+    uint32_t address = _psw.instructionAddress;
+    _instructionAddress = address;  //  ...for an ILC of 0
+    if ((address & 1) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return nullptr;
+    }
+    uint8_t * hostAddress = _hostAddress(address, _LoadAccess);
+    if (hostAddress == nullptr)
+    {
+        return nullptr;
+    }
+    uint32_t absoluteAddress = static_cast<uint32_t>(hostAddress - _storage->data());
+    _BasicBlock * basicBlock = &_basicBlockCache[_basicBlockIndex(absoluteAddress)];
+    if (basicBlock->absoluteAddress == absoluteAddress)
+    {   //  Cache hit
+        return basicBlock;
+    }
+    unsigned length = _instructionLength(*hostAddress);
+    if ((absoluteAddress & Storage::BlockOffsetMask) + length > Storage::BlockSize)
+    {   //  The instruction crosses into the next 2K block
+        _Operand operand;
+        if (!_accessOperand(address, length, _LoadAccess, operand))
+        {
+            return nullptr;
+        }
+        uint8_t bytes[6];
+        for (unsigned i = 0; i < length; i++)
+        {
+            bytes[i] = operand[i];
+        }
+        bool endsBasicBlock = false;
+        _decodeInstruction(bytes, _crossingBasicBlock.instructions[0], endsBasicBlock);
+        _crossingBasicBlock.absoluteAddress = _InvalidAddress;
+        _crossingBasicBlock.numInstructions = 1;
+        return &_crossingBasicBlock;
+    }
+    _decodeBasicBlock(basicBlock, absoluteAddress);
+    return basicBlock;
+}
+
+void ProcessorCore::_decodeBasicBlock(_BasicBlock * basicBlock, uint32_t absoluteAddress)
+{
+    const uint8_t * data = _storage->data();
+    uint32_t blockEnd = (absoluteAddress | Storage::BlockOffsetMask) + 1;
+    uint32_t address = absoluteAddress;
+
+    basicBlock->absoluteAddress = absoluteAddress;
+    basicBlock->numInstructions = 0;
+    bool endsBasicBlock = false;
+    while (!endsBasicBlock && basicBlock->numInstructions < _MaxBasicBlockLength && address < blockEnd)
+    {
+        unsigned length = _instructionLength(data[address]);
+        if (address + length > blockEnd)
+        {   //  Crosses into the next 2K block; will start a basic block of its own
+            break;
+        }
+        _decodeInstruction(data + address, basicBlock->instructions[basicBlock->numInstructions++], endsBasicBlock);
+        address += length;
+    }
+    Q_ASSERT(basicBlock->numInstructions > 0);
+
+    //  Stores into this 2K block must now go through _translate()
+    uint32_t block = absoluteAddress >> Storage::BlockShift;
+    if (_codeBlocks[block] == 0)
+    {
+        _codeBlocks[block] = 1;
+        for (_TlbEntry & entry : _tlb)
+        {
+            if (entry.absoluteAddress == (block << Storage::BlockShift))
+            {
+                entry.storeTag = _InvalidTag;
+            }
+        }
+    }
+}
+
+void ProcessorCore::_decodeInstruction(const uint8_t * bytes, _DecodedInstruction & instruction, bool & endsBasicBlock)
+{
+    uint8_t opcode = bytes[0];
+    const _OpcodeTableEntry & entry = (opcode == 0xB2) ? _B2OpcodeTable[bytes[1]] : _OpcodeTable[opcode];
+
+    instruction.handler = entry.handler;
+    instruction.threadedCode = nullptr;
+    instruction.opcode = opcode;
+    instruction.length = static_cast<uint8_t>(_instructionLength(opcode));
+    instruction.i2 = bytes[1];
+    instruction.r1 = static_cast<uint8_t>(bytes[1] >> 4);
+    instruction.r2 = static_cast<uint8_t>(bytes[1] & 0x0F);
+    instruction.x2 = (instruction.r2 != 0) ? instruction.r2 : 16;
+    instruction.b1 = 16;
+    instruction.b2 = 16;
+    instruction.d1 = 0;
+    instruction.d2 = 0;
+    if (instruction.length >= 4)
+    {
+        uint8_t b = static_cast<uint8_t>(bytes[2] >> 4);
+        uint16_t d = static_cast<uint16_t>(((bytes[2] & 0x0F) << 8) | bytes[3]);
+        if (instruction.length == 6 || (entry.flags & _SiFormat) != 0)
+        {
+            instruction.b1 = (b != 0) ? b : 16;
+            instruction.d1 = d;
+        }
+        else
+        {
+            instruction.b2 = (b != 0) ? b : 16;
+            instruction.d2 = d;
+        }
+    }
+    if (instruction.length == 6)
+    {
+        uint8_t b = static_cast<uint8_t>(bytes[4] >> 4);
+        instruction.b2 = (b != 0) ? b : 16;
+        instruction.d2 = static_cast<uint16_t>(((bytes[4] & 0x0F) << 8) | bytes[5]);
+    }
+    endsBasicBlock = (entry.flags & _EndsBasicBlock) != 0;
+}
+
+void ProcessorCore::_invalidateCode(uint32_t block)
+{
+    _codeBlocks[block] = 0;
+    size_t first = _basicBlockIndex(block << Storage::BlockShift);
+    for (size_t i = first; i < first + Storage::BlockSize / 2; i++)
+    {
+        if ((_basicBlockCache[i].absoluteAddress >> Storage::BlockShift) == block)
+        {
+            _basicBlockCache[i].absoluteAddress = _InvalidAddress;
+        }
+    }
+    //  The basic block being executed may be one of them
+    _leaveBasicBlock = true;
+}
+
+void ProcessorCore::_invalidateAllBasicBlocks()
+{
+    for (size_t i = 0; i < _BasicBlockCacheSize; i++)
+    {
+        _basicBlockCache[i].absoluteAddress = _InvalidAddress;
+    }
+    memset(_codeBlocks, 0, _storage->numBlocks());
+    _leaveBasicBlock = true;
+}
+
+//////////
+//  Opcode tables
+const ProcessorCore::_OpcodeTableEntry ProcessorCore::_OpcodeTable[256] =
+{
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  00
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  01
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  02
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  03
+    { &ProcessorCore::_handleSPM, 0 },                      //  04 SPM
+    { &ProcessorCore::_handleBALR, _EndsBasicBlock },       //  05 BALR
+    { &ProcessorCore::_handleBCTR, _EndsBasicBlock },       //  06 BCTR
+    { &ProcessorCore::_handleBCR, _EndsBasicBlock },        //  07 BCR
+    { &ProcessorCore::_handleSSK, _EndsBasicBlock },        //  08 SSK
+    { &ProcessorCore::_handleISK, 0 },                      //  09 ISK
+    { &ProcessorCore::_handleSVC, _EndsBasicBlock },        //  0A SVC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  0B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  0C
+    { &ProcessorCore::_handleBASR, _EndsBasicBlock },       //  0D BASR
+    { &ProcessorCore::_handleMVCL, _EndsBasicBlock },       //  0E MVCL
+    { &ProcessorCore::_handleCLCL, _EndsBasicBlock },       //  0F CLCL
+    { &ProcessorCore::_handleLPR, 0 },                      //  10 LPR
+    { &ProcessorCore::_handleLNR, 0 },                      //  11 LNR
+    { &ProcessorCore::_handleLTR, 0 },                      //  12 LTR
+    { &ProcessorCore::_handleLCR, 0 },                      //  13 LCR
+    { &ProcessorCore::_handleNR, 0 },                       //  14 NR
+    { &ProcessorCore::_handleCLR, 0 },                      //  15 CLR
+    { &ProcessorCore::_handleOR, 0 },                       //  16 OR
+    { &ProcessorCore::_handleXR, 0 },                       //  17 XR
+    { &ProcessorCore::_handleLR, 0 },                       //  18 LR
+    { &ProcessorCore::_handleCR, 0 },                       //  19 CR
+    { &ProcessorCore::_handleAR, 0 },                       //  1A AR
+    { &ProcessorCore::_handleSR, 0 },                       //  1B SR
+    { &ProcessorCore::_handleMR, 0 },                       //  1C MR
+    { &ProcessorCore::_handleDR, 0 },                       //  1D DR
+    { &ProcessorCore::_handleALR, 0 },                      //  1E ALR
+    { &ProcessorCore::_handleSLR, 0 },                      //  1F SLR
+    { &ProcessorCore::_handleLPDR, 0 },                     //  20 LPDR
+    { &ProcessorCore::_handleLNDR, 0 },                     //  21 LNDR
+    { &ProcessorCore::_handleLTDR, 0 },                     //  22 LTDR
+    { &ProcessorCore::_handleLCDR, 0 },                     //  23 LCDR
+    { &ProcessorCore::_handleHDR, 0 },                      //  24 HDR
+    { &ProcessorCore::_handleLRDR, 0 },                     //  25 LRDR
+    { &ProcessorCore::_handleMXR, 0 },                      //  26 MXR
+    { &ProcessorCore::_handleMXDR, 0 },                     //  27 MXDR
+    { &ProcessorCore::_handleLDR, 0 },                      //  28 LDR
+    { &ProcessorCore::_handleCDR, 0 },                      //  29 CDR
+    { &ProcessorCore::_handleADR, 0 },                      //  2A ADR
+    { &ProcessorCore::_handleSDR, 0 },                      //  2B SDR
+    { &ProcessorCore::_handleMDR, 0 },                      //  2C MDR
+    { &ProcessorCore::_handleDDR, 0 },                      //  2D DDR
+    { &ProcessorCore::_handleAWR, 0 },                      //  2E AWR
+    { &ProcessorCore::_handleSWR, 0 },                      //  2F SWR
+    { &ProcessorCore::_handleLPER, 0 },                     //  30 LPER
+    { &ProcessorCore::_handleLNER, 0 },                     //  31 LNER
+    { &ProcessorCore::_handleLTER, 0 },                     //  32 LTER
+    { &ProcessorCore::_handleLCER, 0 },                     //  33 LCER
+    { &ProcessorCore::_handleHER, 0 },                      //  34 HER
+    { &ProcessorCore::_handleLRER, 0 },                     //  35 LRER
+    { &ProcessorCore::_handleAXR, 0 },                      //  36 AXR
+    { &ProcessorCore::_handleSXR, 0 },                      //  37 SXR
+    { &ProcessorCore::_handleLER, 0 },                      //  38 LER
+    { &ProcessorCore::_handleCER, 0 },                      //  39 CER
+    { &ProcessorCore::_handleAER, 0 },                      //  3A AER
+    { &ProcessorCore::_handleSER, 0 },                      //  3B SER
+    { &ProcessorCore::_handleMER, 0 },                      //  3C MER
+    { &ProcessorCore::_handleDER, 0 },                      //  3D DER
+    { &ProcessorCore::_handleAUR, 0 },                      //  3E AUR
+    { &ProcessorCore::_handleSUR, 0 },                      //  3F SUR
+    { &ProcessorCore::_handleSTH, 0 },                      //  40 STH
+    { &ProcessorCore::_handleLA, 0 },                       //  41 LA
+    { &ProcessorCore::_handleSTC, 0 },                      //  42 STC
+    { &ProcessorCore::_handleIC, 0 },                       //  43 IC
+    { &ProcessorCore::_handleEX, _EndsBasicBlock },         //  44 EX
+    { &ProcessorCore::_handleBAL, _EndsBasicBlock },        //  45 BAL
+    { &ProcessorCore::_handleBCT, _EndsBasicBlock },        //  46 BCT
+    { &ProcessorCore::_handleBC, _EndsBasicBlock },         //  47 BC
+    { &ProcessorCore::_handleLH, 0 },                       //  48 LH
+    { &ProcessorCore::_handleCH, 0 },                       //  49 CH
+    { &ProcessorCore::_handleAH, 0 },                       //  4A AH
+    { &ProcessorCore::_handleSH, 0 },                       //  4B SH
+    { &ProcessorCore::_handleMH, 0 },                       //  4C MH
+    { &ProcessorCore::_handleBAS, _EndsBasicBlock },        //  4D BAS
+    { &ProcessorCore::_handleCVD, 0 },                      //  4E CVD
+    { &ProcessorCore::_handleCVB, 0 },                      //  4F CVB
+    { &ProcessorCore::_handleST, 0 },                       //  50 ST
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  51
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  52
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  53
+    { &ProcessorCore::_handleN, 0 },                        //  54 N
+    { &ProcessorCore::_handleCL, 0 },                       //  55 CL
+    { &ProcessorCore::_handleO, 0 },                        //  56 O
+    { &ProcessorCore::_handleX, 0 },                        //  57 X
+    { &ProcessorCore::_handleL, 0 },                        //  58 L
+    { &ProcessorCore::_handleC, 0 },                        //  59 C
+    { &ProcessorCore::_handleA, 0 },                        //  5A A
+    { &ProcessorCore::_handleS, 0 },                        //  5B S
+    { &ProcessorCore::_handleM, 0 },                        //  5C M
+    { &ProcessorCore::_handleD, 0 },                        //  5D D
+    { &ProcessorCore::_handleAL, 0 },                       //  5E AL
+    { &ProcessorCore::_handleSL, 0 },                       //  5F SL
+    { &ProcessorCore::_handleSTD, 0 },                      //  60 STD
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  61
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  62
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  63
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  64
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  65
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  66
+    { &ProcessorCore::_handleMXD, 0 },                      //  67 MXD
+    { &ProcessorCore::_handleLD, 0 },                       //  68 LD
+    { &ProcessorCore::_handleCD, 0 },                       //  69 CD
+    { &ProcessorCore::_handleAD, 0 },                       //  6A AD
+    { &ProcessorCore::_handleSD, 0 },                       //  6B SD
+    { &ProcessorCore::_handleMD, 0 },                       //  6C MD
+    { &ProcessorCore::_handleDD, 0 },                       //  6D DD
+    { &ProcessorCore::_handleAW, 0 },                       //  6E AW
+    { &ProcessorCore::_handleSW, 0 },                       //  6F SW
+    { &ProcessorCore::_handleSTE, 0 },                      //  70 STE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  71
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  72
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  73
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  74
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  75
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  76
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  77
+    { &ProcessorCore::_handleLE, 0 },                       //  78 LE
+    { &ProcessorCore::_handleCE, 0 },                       //  79 CE
+    { &ProcessorCore::_handleAE, 0 },                       //  7A AE
+    { &ProcessorCore::_handleSE, 0 },                       //  7B SE
+    { &ProcessorCore::_handleME, 0 },                       //  7C ME
+    { &ProcessorCore::_handleDE, 0 },                       //  7D DE
+    { &ProcessorCore::_handleAU, 0 },                       //  7E AU
+    { &ProcessorCore::_handleSU, 0 },                       //  7F SU
+    { &ProcessorCore::_handleSSM, _EndsBasicBlock },        //  80 SSM
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  81
+    { &ProcessorCore::_handleLPSW, _EndsBasicBlock },       //  82 LPSW
+    { &ProcessorCore::_handleDIAGNOSE, _EndsBasicBlock },   //  83 DIAGNOSE
+    { &ProcessorCore::_handleWRD, _SiFormat },              //  84 WRD
+    { &ProcessorCore::_handleRDD, _SiFormat },              //  85 RDD
+    { &ProcessorCore::_handleBXH, _EndsBasicBlock },        //  86 BXH
+    { &ProcessorCore::_handleBXLE, _EndsBasicBlock },       //  87 BXLE
+    { &ProcessorCore::_handleSRL, 0 },                      //  88 SRL
+    { &ProcessorCore::_handleSLL, 0 },                      //  89 SLL
+    { &ProcessorCore::_handleSRA, 0 },                      //  8A SRA
+    { &ProcessorCore::_handleSLA, 0 },                      //  8B SLA
+    { &ProcessorCore::_handleSRDL, 0 },                     //  8C SRDL
+    { &ProcessorCore::_handleSLDL, 0 },                     //  8D SLDL
+    { &ProcessorCore::_handleSRDA, 0 },                     //  8E SRDA
+    { &ProcessorCore::_handleSLDA, 0 },                     //  8F SLDA
+    { &ProcessorCore::_handleSTM, 0 },                      //  90 STM
+    { &ProcessorCore::_handleTM, _SiFormat },               //  91 TM
+    { &ProcessorCore::_handleMVI, _SiFormat },              //  92 MVI
+    { &ProcessorCore::_handleTS, 0 },                       //  93 TS
+    { &ProcessorCore::_handleNI, _SiFormat },               //  94 NI
+    { &ProcessorCore::_handleCLI, _SiFormat },              //  95 CLI
+    { &ProcessorCore::_handleOI, _SiFormat },               //  96 OI
+    { &ProcessorCore::_handleXI, _SiFormat },               //  97 XI
+    { &ProcessorCore::_handleLM, 0 },                       //  98 LM
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  99
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  9A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  9B
+    { &ProcessorCore::_handleIO, 0 },                       //  9C SIO, SIOF
+    { &ProcessorCore::_handleIO, 0 },                       //  9D TIO, CLRIO
+    { &ProcessorCore::_handleIO, 0 },                       //  9E HIO, HDV
+    { &ProcessorCore::_handleIO, 0 },                       //  9F TCH
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A0
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A1
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A2
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A7
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  A9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  AA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  AB
+    { &ProcessorCore::_handleSTNSM, _SiFormat | _EndsBasicBlock },//  AC STNSM
+    { &ProcessorCore::_handleSTOSM, _SiFormat | _EndsBasicBlock },//  AD STOSM
+    { &ProcessorCore::_handleSIGP, 0 },                     //  AE SIGP
+    { &ProcessorCore::_handleMC, _SiFormat | _EndsBasicBlock },//  AF MC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B0
+    { &ProcessorCore::_handleLRA, 0 },                      //  B1 LRA
+    { &ProcessorCore::_handleInvalid, 0 },                  //  B2 (see _B2OpcodeTable)
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B5
+    { &ProcessorCore::_handleSTCTL, 0 },                    //  B6 STCTL
+    { &ProcessorCore::_handleLCTL, _EndsBasicBlock },       //  B7 LCTL
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B9
+    { &ProcessorCore::_handleCS, 0 },                       //  BA CS
+    { &ProcessorCore::_handleCDS, 0 },                      //  BB CDS
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  BC
+    { &ProcessorCore::_handleCLM, 0 },                      //  BD CLM
+    { &ProcessorCore::_handleSTCM, 0 },                     //  BE STCM
+    { &ProcessorCore::_handleICM, 0 },                      //  BF ICM
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C0
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C1
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C2
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C7
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  C9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  CA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  CB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  CC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  CD
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  CE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  CF
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  D0
+    { &ProcessorCore::_handleMVN, 0 },                      //  D1 MVN
+    { &ProcessorCore::_handleMVC, 0 },                      //  D2 MVC
+    { &ProcessorCore::_handleMVZ, 0 },                      //  D3 MVZ
+    { &ProcessorCore::_handleNC, 0 },                       //  D4 NC
+    { &ProcessorCore::_handleCLC, 0 },                      //  D5 CLC
+    { &ProcessorCore::_handleOC, 0 },                       //  D6 OC
+    { &ProcessorCore::_handleXC, 0 },                       //  D7 XC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  D8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  D9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  DA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  DB
+    { &ProcessorCore::_handleTR, 0 },                       //  DC TR
+    { &ProcessorCore::_handleTRT, 0 },                      //  DD TRT
+    { &ProcessorCore::_handleED, 0 },                       //  DE ED
+    { &ProcessorCore::_handleEDMK, 0 },                     //  DF EDMK
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E0
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E1
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E2
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E7
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  E9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  EA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  EB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  EC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  ED
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  EE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  EF
+    { &ProcessorCore::_handleSRP, 0 },                      //  F0 SRP
+    { &ProcessorCore::_handleMVO, 0 },                      //  F1 MVO
+    { &ProcessorCore::_handlePACK, 0 },                     //  F2 PACK
+    { &ProcessorCore::_handleUNPK, 0 },                     //  F3 UNPK
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  F4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  F5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  F6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  F7
+    { &ProcessorCore::_handleZAP, 0 },                      //  F8 ZAP
+    { &ProcessorCore::_handleCP, 0 },                       //  F9 CP
+    { &ProcessorCore::_handleAP, 0 },                       //  FA AP
+    { &ProcessorCore::_handleSP, 0 },                       //  FB SP
+    { &ProcessorCore::_handleMP, 0 },                       //  FC MP
+    { &ProcessorCore::_handleDP, 0 },                       //  FD DP
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  FE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock }     //  FF
+};
+
+const ProcessorCore::_OpcodeTableEntry ProcessorCore::_B2OpcodeTable[256] =
+{
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B200
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B201
+    { &ProcessorCore::_handleSTIDP, 0 },                    //  B202 STIDP
+    { &ProcessorCore::_handleIO, 0 },                       //  B203 STIDC
+    { &ProcessorCore::_handleSCK, 0 },                      //  B204 SCK
+    { &ProcessorCore::_handleSTCK, 0 },                     //  B205 STCK
+    { &ProcessorCore::_handleSCKC, 0 },                     //  B206 SCKC
+    { &ProcessorCore::_handleSTCKC, 0 },                    //  B207 STCKC
+    { &ProcessorCore::_handleSPT, 0 },                      //  B208 SPT
+    { &ProcessorCore::_handleSTPT, 0 },                     //  B209 STPT
+    { &ProcessorCore::_handleSPKA, _EndsBasicBlock },       //  B20A SPKA
+    { &ProcessorCore::_handleIPK, 0 },                      //  B20B IPK
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B20C
+    { &ProcessorCore::_handlePTLB, _EndsBasicBlock },       //  B20D PTLB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B20E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B20F
+    { &ProcessorCore::_handleSPX, _EndsBasicBlock },        //  B210 SPX
+    { &ProcessorCore::_handleSTPX, 0 },                     //  B211 STPX
+    { &ProcessorCore::_handleSTAP, 0 },                     //  B212 STAP
+    { &ProcessorCore::_handleRRB, _EndsBasicBlock },        //  B213 RRB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B214
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B215
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B216
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B217
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B218
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B219
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B21A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B21B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B21C
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B21D
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B21E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B21F
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B220
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B221
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B222
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B223
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B224
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B225
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B226
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B227
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B228
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B229
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B22A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B22B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B22C
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B22D
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B22E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B22F
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B230
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B231
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B232
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B233
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B234
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B235
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B236
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B237
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B238
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B239
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B23A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B23B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B23C
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B23D
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B23E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B23F
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B240
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B241
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B242
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B243
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B244
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B245
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B246
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B247
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B248
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B249
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B24A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B24B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B24C
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B24D
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B24E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B24F
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B250
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B251
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B252
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B253
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B254
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B255
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B256
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B257
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B258
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B259
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B25A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B25B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B25C
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B25D
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B25E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B25F
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B260
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B261
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B262
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B263
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B264
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B265
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B266
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B267
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B268
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B269
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B26A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B26B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B26C
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B26D
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B26E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B26F
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B270
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B271
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B272
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B273
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B274
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B275
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B276
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B277
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B278
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B279
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B27A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B27B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B27C
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B27D
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B27E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B27F
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B280
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B281
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B282
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B283
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B284
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B285
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B286
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B287
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B288
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B289
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B28A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B28B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B28C
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B28D
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B28E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B28F
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B290
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B291
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B292
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B293
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B294
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B295
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B296
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B297
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B298
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B299
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B29A
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B29B
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B29C
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B29D
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B29E
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B29F
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A0
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A1
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A2
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A7
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2A9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2AA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2AB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2AC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2AD
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2AE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2AF
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B0
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B1
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B2
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B7
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2B9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2BA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2BB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2BC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2BD
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2BE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2BF
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C0
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C1
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C2
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C7
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2C9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2CA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2CB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2CC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2CD
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2CE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2CF
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D0
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D1
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D2
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D7
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2D9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2DA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2DB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2DC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2DD
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2DE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2DF
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E0
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E1
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E2
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E7
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2E9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2EA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2EB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2EC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2ED
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2EE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2EF
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F0
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F1
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F2
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F3
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F4
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F5
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F6
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F7
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F8
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2F9
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2FA
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2FB
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2FC
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2FD
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock },    //  B2FE
+    { &ProcessorCore::_handleInvalid, _EndsBasicBlock }     //  B2FF
+};
+
+//  End of hadesvm-ibm3x0/ProcessorCore.Engine.cpp
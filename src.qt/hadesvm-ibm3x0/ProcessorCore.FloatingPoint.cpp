@@ -0,0 +1,689 @@
+//
+//  hadesvm-ibm3x0/ProcessorCore.FloatingPoint.cpp
+//
+//  hadesvm::ibm3x0::ProcessorCore class implementation (floating-point instructions)
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+namespace
+{
+    const uint32_t ShortFractionMask = UINT32_C(0x00FFFFFF);
+    const uint64_t LongFractionMask = UINT64_C(0x00FFFFFFFFFFFFFF);
+    const uint64_t LongSignMask = UINT64_C(0x8000000000000000);
+
+    //  0.5, for halving
+    const uint64_t LongHalf = UINT64_C(0x4080000000000000);
+
+    bool isZero(const hadesvm::ibmhfp::Extended & value)
+    {
+        return (value.high & LongFractionMask) == 0 && (value.low & LongFractionMask) == 0;
+    }
+}
+
+//////////
+//  Implementation helpers (floating point)
+bool ProcessorCore::_checkFloatingPointRegister(unsigned r)
+{
+    if ((r & 0x09) != 0)
+    {   //  Only 0, 2, 4 and 6
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return false;
+    }
+    return true;
+}
+
+bool ProcessorCore::_checkExtendedRegister(unsigned r)
+{
+    if ((r & 0x0B) != 0)
+    {   //  Only 0 and 4
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return false;
+    }
+    return true;
+}
+
+hadesvm::ibmhfp::Extended ProcessorCore::_extendedRegister(unsigned r) const
+{
+    hadesvm::ibmhfp::Extended result;
+    result.high = _fpr[r];
+    result.low = _fpr[r + 2];
+    return result;
+}
+
+void ProcessorCore::_setExtendedRegister(unsigned r, const hadesvm::ibmhfp::Extended & value)
+{
+    _fpr[r] = value.high;
+    _fpr[r + 2] = value.low;
+}
+
+void ProcessorCore::_raiseFloatingPointExceptions(const hadesvm::ibmhfp::Environment & env)
+{
+    if (env.overflow)
+    {
+        _raiseProgramInterruption(ProgramInterruption::ExponentOverflow);
+    }
+    else if (env.underflow && (_psw.programMask & _ExponentUnderflowMask) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::ExponentUnderflow);
+    }
+    else if (env.significance && (_psw.programMask & _SignificanceMask) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Significance);
+    }
+}
+
+void ProcessorCore::_executeShort(unsigned r1, uint32_t op2,
+                                  uint32_t (*operation)(uint32_t, uint32_t, hadesvm::ibmhfp::Environment &),
+                                  bool setConditionCode)
+{
+    hadesvm::ibmhfp::Environment env;
+    uint32_t result = operation(_shortRegister(r1), op2, env);
+    if (env.divide)
+    {   //  The operation is suppressed
+        _raiseProgramInterruption(ProgramInterruption::FloatingPointDivide);
+        return;
+    }
+    if (_maskedUnderflow(env))
+    {   //  A masked-off underflow makes a true zero
+        result = 0;
+    }
+    _setShortRegister(r1, result);
+    if (setConditionCode)
+    {
+        _setFloatingPointConditionCode((result & ShortFractionMask) == 0, (result >> 31) != 0);
+    }
+    _raiseFloatingPointExceptions(env);
+}
+
+void ProcessorCore::_executeLong(unsigned r1, uint64_t op2,
+                                 uint64_t (*operation)(uint64_t, uint64_t, hadesvm::ibmhfp::Environment &),
+                                 bool setConditionCode)
+{
+    hadesvm::ibmhfp::Environment env;
+    uint64_t result = operation(_fpr[r1], op2, env);
+    if (env.divide)
+    {   //  The operation is suppressed
+        _raiseProgramInterruption(ProgramInterruption::FloatingPointDivide);
+        return;
+    }
+    if (_maskedUnderflow(env))
+    {   //  A masked-off underflow makes a true zero
+        result = 0;
+    }
+    _fpr[r1] = result;
+    if (setConditionCode)
+    {
+        _setFloatingPointConditionCode((result & LongFractionMask) == 0, (result & LongSignMask) != 0);
+    }
+    _raiseFloatingPointExceptions(env);
+}
+
+void ProcessorCore::_executeCompareShort(uint32_t op1, uint32_t op2)
+{
+    hadesvm::ibmhfp::Environment env;
+    int result = hadesvm::ibmhfp::compare32(op1, op2, env);
+    _psw.conditionCode = (result == 0) ? 0 : ((result < 0) ? 1 : 2);
+}
+
+void ProcessorCore::_executeCompareLong(uint64_t op1, uint64_t op2)
+{
+    hadesvm::ibmhfp::Environment env;
+    int result = hadesvm::ibmhfp::compare64(op1, op2, env);
+    _psw.conditionCode = (result == 0) ? 0 : ((result < 0) ? 1 : 2);
+}
+
+void ProcessorCore::_executeMultiplyShort(unsigned r1, uint32_t op2)
+{   //  The product of two short operands is exact in long format
+    _executeLong(r1, static_cast<uint64_t>(op2) << 32, hadesvm::ibmhfp::multiply64, false);
+}
+
+void ProcessorCore::_executeMultiplyLongToExtended(unsigned r1, uint64_t op2)
+{
+    hadesvm::ibmhfp::Environment env;
+    hadesvm::ibmhfp::Extended result = hadesvm::ibmhfp::multiply64to128(_fpr[r1], op2, env);
+    if (_maskedUnderflow(env))
+    {
+        result = hadesvm::ibmhfp::Extended();
+    }
+    _setExtendedRegister(r1, result);
+    _raiseFloatingPointExceptions(env);
+}
+
+//////////
+//  Instruction handlers (long)
+unsigned ProcessorCore::_handleLPDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _fpr[instruction.r1] = _fpr[instruction.r2] & ~LongSignMask;
+        _setFloatingPointConditionCode((_fpr[instruction.r1] & LongFractionMask) == 0, false);
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLNDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _fpr[instruction.r1] = _fpr[instruction.r2] | LongSignMask;
+        bool zero = (_fpr[instruction.r1] & LongFractionMask) == 0;
+        _setFloatingPointConditionCode(zero, true);
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLTDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _fpr[instruction.r1] = _fpr[instruction.r2];
+        _setFloatingPointConditionCode((_fpr[instruction.r1] & LongFractionMask) == 0,
+                                       (_fpr[instruction.r1] & LongSignMask) != 0);
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLCDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _fpr[instruction.r1] = _fpr[instruction.r2] ^ LongSignMask;
+        _setFloatingPointConditionCode((_fpr[instruction.r1] & LongFractionMask) == 0,
+                                       (_fpr[instruction.r1] & LongSignMask) != 0);
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleHDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        uint64_t op2 = _fpr[instruction.r2];
+        hadesvm::ibmhfp::Environment env;
+        uint64_t result = hadesvm::ibmhfp::multiply64(op2, LongHalf, env);
+        _fpr[instruction.r1] = _maskedUnderflow(env) ? 0 : result;
+        _raiseFloatingPointExceptions(env);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleLRDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkExtendedRegister(instruction.r2))
+    {
+        hadesvm::ibmhfp::Environment env;
+        _fpr[instruction.r1] = hadesvm::ibmhfp::round128to64(_extendedRegister(instruction.r2), env);
+        _raiseFloatingPointExceptions(env);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleMXR(const _DecodedInstruction & instruction)
+{
+    if (_checkExtendedRegister(instruction.r1) && _checkExtendedRegister(instruction.r2))
+    {
+        hadesvm::ibmhfp::Environment env;
+        hadesvm::ibmhfp::Extended result =
+            hadesvm::ibmhfp::multiply128(_extendedRegister(instruction.r1), _extendedRegister(instruction.r2), env);
+        _setExtendedRegister(instruction.r1, _maskedUnderflow(env) ? hadesvm::ibmhfp::Extended() : result);
+        _raiseFloatingPointExceptions(env);
+    }
+    return 20;
+}
+
+unsigned ProcessorCore::_handleMXDR(const _DecodedInstruction & instruction)
+{
+    if (_checkExtendedRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeMultiplyLongToExtended(instruction.r1, _fpr[instruction.r2]);
+    }
+    return 12;
+}
+
+unsigned ProcessorCore::_handleLDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _fpr[instruction.r1] = _fpr[instruction.r2];
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleCDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeCompareLong(_fpr[instruction.r1], _fpr[instruction.r2]);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleADR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeLong(instruction.r1, _fpr[instruction.r2], hadesvm::ibmhfp::add64, true);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleSDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeLong(instruction.r1, _fpr[instruction.r2], hadesvm::ibmhfp::subtract64, true);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleMDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeLong(instruction.r1, _fpr[instruction.r2], hadesvm::ibmhfp::multiply64, false);
+    }
+    return 8;
+}
+
+unsigned ProcessorCore::_handleDDR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeLong(instruction.r1, _fpr[instruction.r2], hadesvm::ibmhfp::divide64, false);
+    }
+    return 16;
+}
+
+unsigned ProcessorCore::_handleAWR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeLong(instruction.r1, _fpr[instruction.r2], hadesvm::ibmhfp::addUnnormalized64, true);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleSWR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeLong(instruction.r1, _fpr[instruction.r2], hadesvm::ibmhfp::subtractUnnormalized64, true);
+    }
+    return 3;
+}
+
+//////////
+//  Instruction handlers (short)
+unsigned ProcessorCore::_handleLPER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        uint32_t result = _shortRegister(instruction.r2) & UINT32_C(0x7FFFFFFF);
+        _setShortRegister(instruction.r1, result);
+        _setFloatingPointConditionCode((result & ShortFractionMask) == 0, false);
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLNER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        uint32_t result = _shortRegister(instruction.r2) | UINT32_C(0x80000000);
+        _setShortRegister(instruction.r1, result);
+        _setFloatingPointConditionCode((result & ShortFractionMask) == 0, true);
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLTER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        uint32_t result = _shortRegister(instruction.r2);
+        _setShortRegister(instruction.r1, result);
+        _setFloatingPointConditionCode((result & ShortFractionMask) == 0, (result >> 31) != 0);
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLCER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        uint32_t result = _shortRegister(instruction.r2) ^ UINT32_C(0x80000000);
+        _setShortRegister(instruction.r1, result);
+        _setFloatingPointConditionCode((result & ShortFractionMask) == 0, (result >> 31) != 0);
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleHER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        hadesvm::ibmhfp::Environment env;
+        uint32_t result = hadesvm::ibmhfp::multiply32(_shortRegister(instruction.r2),
+                                                      static_cast<uint32_t>(LongHalf >> 32), env);
+        _setShortRegister(instruction.r1, _maskedUnderflow(env) ? 0 : result);
+        _raiseFloatingPointExceptions(env);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleLRER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        hadesvm::ibmhfp::Environment env;
+        _setShortRegister(instruction.r1, hadesvm::ibmhfp::round64to32(_fpr[instruction.r2], env));
+        _raiseFloatingPointExceptions(env);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleAXR(const _DecodedInstruction & instruction)
+{
+    if (_checkExtendedRegister(instruction.r1) && _checkExtendedRegister(instruction.r2))
+    {
+        hadesvm::ibmhfp::Environment env;
+        hadesvm::ibmhfp::Extended result =
+            hadesvm::ibmhfp::add128(_extendedRegister(instruction.r1), _extendedRegister(instruction.r2), env);
+        if (_maskedUnderflow(env))
+        {
+            result = hadesvm::ibmhfp::Extended();
+        }
+        _setExtendedRegister(instruction.r1, result);
+        _setFloatingPointConditionCode(isZero(result), (result.high & LongSignMask) != 0);
+        _raiseFloatingPointExceptions(env);
+    }
+    return 5;
+}
+
+unsigned ProcessorCore::_handleSXR(const _DecodedInstruction & instruction)
+{
+    if (_checkExtendedRegister(instruction.r1) && _checkExtendedRegister(instruction.r2))
+    {
+        hadesvm::ibmhfp::Environment env;
+        hadesvm::ibmhfp::Extended result =
+            hadesvm::ibmhfp::subtract128(_extendedRegister(instruction.r1), _extendedRegister(instruction.r2), env);
+        if (_maskedUnderflow(env))
+        {
+            result = hadesvm::ibmhfp::Extended();
+        }
+        _setExtendedRegister(instruction.r1, result);
+        _setFloatingPointConditionCode(isZero(result), (result.high & LongSignMask) != 0);
+        _raiseFloatingPointExceptions(env);
+    }
+    return 5;
+}
+
+unsigned ProcessorCore::_handleLER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _setShortRegister(instruction.r1, _shortRegister(instruction.r2));
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleCER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeCompareShort(_shortRegister(instruction.r1), _shortRegister(instruction.r2));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleAER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeShort(instruction.r1, _shortRegister(instruction.r2), hadesvm::ibmhfp::add32, true);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeShort(instruction.r1, _shortRegister(instruction.r2), hadesvm::ibmhfp::subtract32, true);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleMER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _fpr[instruction.r1] &= UINT64_C(0xFFFFFFFF00000000);
+        _executeMultiplyShort(instruction.r1, _shortRegister(instruction.r2));
+    }
+    return 5;
+}
+
+unsigned ProcessorCore::_handleDER(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeShort(instruction.r1, _shortRegister(instruction.r2), hadesvm::ibmhfp::divide32, false);
+    }
+    return 8;
+}
+
+unsigned ProcessorCore::_handleAUR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeShort(instruction.r1, _shortRegister(instruction.r2), hadesvm::ibmhfp::addUnnormalized32, true);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSUR(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1) && _checkFloatingPointRegister(instruction.r2))
+    {
+        _executeShort(instruction.r1, _shortRegister(instruction.r2), hadesvm::ibmhfp::subtractUnnormalized32, true);
+    }
+    return 2;
+}
+
+//////////
+//  Instruction handlers (long, RX)
+unsigned ProcessorCore::_handleSTD(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1))
+    {
+        _store(_effectiveAddressRx(instruction), _fpr[instruction.r1]);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleMXD(const _DecodedInstruction & instruction)
+{
+    uint64_t op2;
+    if (_checkExtendedRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeMultiplyLongToExtended(instruction.r1, op2);
+    }
+    return 13;
+}
+
+unsigned ProcessorCore::_handleLD(const _DecodedInstruction & instruction)
+{
+    uint64_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _fpr[instruction.r1] = op2;
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleCD(const _DecodedInstruction & instruction)
+{
+    uint64_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeCompareLong(_fpr[instruction.r1], op2);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleAD(const _DecodedInstruction & instruction)
+{
+    uint64_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeLong(instruction.r1, op2, hadesvm::ibmhfp::add64, true);
+    }
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSD(const _DecodedInstruction & instruction)
+{
+    uint64_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeLong(instruction.r1, op2, hadesvm::ibmhfp::subtract64, true);
+    }
+    return 4;
+}
+
+unsigned ProcessorCore::_handleMD(const _DecodedInstruction & instruction)
+{
+    uint64_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeLong(instruction.r1, op2, hadesvm::ibmhfp::multiply64, false);
+    }
+    return 9;
+}
+
+unsigned ProcessorCore::_handleDD(const _DecodedInstruction & instruction)
+{
+    uint64_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeLong(instruction.r1, op2, hadesvm::ibmhfp::divide64, false);
+    }
+    return 17;
+}
+
+unsigned ProcessorCore::_handleAW(const _DecodedInstruction & instruction)
+{
+    uint64_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeLong(instruction.r1, op2, hadesvm::ibmhfp::addUnnormalized64, true);
+    }
+    return 4;
+}
+
+unsigned ProcessorCore::_handleSW(const _DecodedInstruction & instruction)
+{
+    uint64_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeLong(instruction.r1, op2, hadesvm::ibmhfp::subtractUnnormalized64, true);
+    }
+    return 4;
+}
+
+//////////
+//  Instruction handlers (short, RX)
+unsigned ProcessorCore::_handleSTE(const _DecodedInstruction & instruction)
+{
+    if (_checkFloatingPointRegister(instruction.r1))
+    {
+        _store(_effectiveAddressRx(instruction), _shortRegister(instruction.r1));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleLE(const _DecodedInstruction & instruction)
+{
+    uint32_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _setShortRegister(instruction.r1, op2);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleCE(const _DecodedInstruction & instruction)
+{
+    uint32_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeCompareShort(_shortRegister(instruction.r1), op2);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleAE(const _DecodedInstruction & instruction)
+{
+    uint32_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeShort(instruction.r1, op2, hadesvm::ibmhfp::add32, true);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleSE(const _DecodedInstruction & instruction)
+{
+    uint32_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeShort(instruction.r1, op2, hadesvm::ibmhfp::subtract32, true);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleME(const _DecodedInstruction & instruction)
+{
+    uint32_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _fpr[instruction.r1] &= UINT64_C(0xFFFFFFFF00000000);
+        _executeMultiplyShort(instruction.r1, op2);
+    }
+    return 6;
+}
+
+unsigned ProcessorCore::_handleDE(const _DecodedInstruction & instruction)
+{
+    uint32_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeShort(instruction.r1, op2, hadesvm::ibmhfp::divide32, false);
+    }
+    return 9;
+}
+
+unsigned ProcessorCore::_handleAU(const _DecodedInstruction & instruction)
+{
+    uint32_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeShort(instruction.r1, op2, hadesvm::ibmhfp::addUnnormalized32, true);
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleSU(const _DecodedInstruction & instruction)
+{
+    uint32_t op2;
+    if (_checkFloatingPointRegister(instruction.r1) && _load(_effectiveAddressRx(instruction), op2))
+    {
+        _executeShort(instruction.r1, op2, hadesvm::ibmhfp::subtractUnnormalized32, true);
+    }
+    return 3;
+}
+
+//  End of hadesvm-ibm3x0/ProcessorCore.FloatingPoint.cpp
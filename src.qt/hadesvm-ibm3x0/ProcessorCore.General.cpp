@@ -0,0 +1,1272 @@
+//
+//  hadesvm-ibm3x0/ProcessorCore.General.cpp
+//
+//  hadesvm::ibm3x0::ProcessorCore class implementation (general instructions)
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+//////////
+//  Implementation helpers (instruction execution)
+void ProcessorCore::_fixedPointOverflow()
+{
+    _psw.conditionCode = 3;
+    if ((_psw.programMask & _FixedPointOverflowMask) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::FixedPointOverflow);
+    }
+}
+
+void ProcessorCore::_decimalOverflow()
+{
+    _psw.conditionCode = 3;
+    if ((_psw.programMask & _DecimalOverflowMask) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::DecimalOverflow);
+    }
+}
+
+bool ProcessorCore::_checkEvenRegister(unsigned r)
+{
+    if ((r & 1) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return false;
+    }
+    return true;
+}
+
+int ProcessorCore::_compareOperands(const _Operand & op1, const _Operand & op2, unsigned length)
+{
+    if (op1.second == nullptr && op2.second == nullptr)
+    {
+        int result = memcmp(op1.first, op2.first, length);
+        return (result == 0) ? 0 : ((result < 0) ? -1 : 1);
+    }
+    for (unsigned i = 0; i < length; i++)
+    {
+        if (op1[i] != op2[i])
+        {
+            return (op1[i] < op2[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+void ProcessorCore::_executeAdd(unsigned r1, uint32_t op2)
+{
+    uint32_t op1 = _gr[r1];
+    uint32_t result = op1 + op2;
+    _gr[r1] = result;
+    if (((~(op1 ^ op2) & (op1 ^ result)) >> 31) != 0)
+    {
+        _fixedPointOverflow();
+    }
+    else
+    {
+        _setConditionCode(static_cast<int32_t>(result));
+    }
+}
+
+void ProcessorCore::_executeSubtract(unsigned r1, uint32_t op2)
+{
+    uint32_t op1 = _gr[r1];
+    uint32_t result = op1 - op2;
+    _gr[r1] = result;
+    if ((((op1 ^ op2) & (op1 ^ result)) >> 31) != 0)
+    {
+        _fixedPointOverflow();
+    }
+    else
+    {
+        _setConditionCode(static_cast<int32_t>(result));
+    }
+}
+
+void ProcessorCore::_executeAddLogical(unsigned r1, uint32_t op2, uint32_t carry)
+{
+    uint64_t sum = static_cast<uint64_t>(_gr[r1]) + op2 + carry;
+    _gr[r1] = static_cast<uint32_t>(sum);
+    _psw.conditionCode = static_cast<uint8_t>(((sum >> 31) & 2) | ((_gr[r1] != 0) ? 1 : 0));
+}
+
+void ProcessorCore::_executeCompare(int32_t op1, int32_t op2)
+{
+    _psw.conditionCode = (op1 == op2) ? 0 : ((op1 < op2) ? 1 : 2);
+}
+
+void ProcessorCore::_executeCompareLogical(uint32_t op1, uint32_t op2)
+{
+    _psw.conditionCode = (op1 == op2) ? 0 : ((op1 < op2) ? 1 : 2);
+}
+
+bool ProcessorCore::_executeMultiply(unsigned r1, uint32_t op2)
+{
+    if (!_checkEvenRegister(r1))
+    {
+        return false;
+    }
+    int64_t product = static_cast<int64_t>(static_cast<int32_t>(_gr[r1 + 1])) * static_cast<int32_t>(op2);
+    _gr[r1] = static_cast<uint32_t>(static_cast<uint64_t>(product) >> 32);
+    _gr[r1 + 1] = static_cast<uint32_t>(product);
+    return true;
+}
+
+bool ProcessorCore::_executeDivide(unsigned r1, uint32_t op2)
+{
+    if (!_checkEvenRegister(r1))
+    {
+        return false;
+    }
+    int64_t dividend = static_cast<int64_t>((static_cast<uint64_t>(_gr[r1]) << 32) | _gr[r1 + 1]);
+    int64_t divisor = static_cast<int32_t>(op2);
+    if (divisor == 0 || (dividend == INT64_MIN && divisor == -1))
+    {
+        _raiseProgramInterruption(ProgramInterruption::FixedPointDivide);
+        return false;
+    }
+    int64_t quotient = dividend / divisor;
+    if (quotient < INT32_MIN || quotient > INT32_MAX)
+    {
+        _raiseProgramInterruption(ProgramInterruption::FixedPointDivide);
+        return false;
+    }
+    _gr[r1] = static_cast<uint32_t>(dividend % divisor);
+    _gr[r1 + 1] = static_cast<uint32_t>(quotient);
+    return true;
+}
+
+unsigned ProcessorCore::_executeBranchOnIndex(const _DecodedInstruction & instruction, bool high)
+{
+    unsigned r1 = instruction.r1, r3 = instruction.r2;
+
+    //  The comparand is fetched before R1 is updated, even when R1 is R3 or R3 + 1
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    int32_t comparand = static_cast<int32_t>(_gr[r3 | 1]);
+    _gr[r1] += _gr[r3];
+    int32_t sum = static_cast<int32_t>(_gr[r1]);
+    if (high ? (sum > comparand) : (sum <= comparand))
+    {
+        _branch(address);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_executeLogicalSs(const _DecodedInstruction & instruction, uint8_t (*operation)(uint8_t, uint8_t))
+{
+    unsigned length = instruction.i2 + 1u;
+    _Operand op1, op2;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), length, _LoadAccess, op2) ||
+        !_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), length, _StoreAccess, op1))
+    {
+        return 2;
+    }
+    uint8_t nonzero = 0;
+    for (unsigned i = 0; i < length; i++)
+    {   //  Left to right, a byte at a time, as overlapping operands require
+        uint8_t result = operation(op1[i], op2[i]);
+        op1[i] = result;
+        nonzero |= result;
+    }
+    _psw.conditionCode = (nonzero != 0) ? 1 : 0;
+    return 2 + length / 8;
+}
+
+unsigned ProcessorCore::_executeLogicalSi(const _DecodedInstruction & instruction, uint8_t (*operation)(uint8_t, uint8_t))
+{
+    _Operand op1;
+    if (!_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), 1, _StoreAccess, op1))
+    {
+        return 2;
+    }
+    uint8_t result = operation(op1[0], instruction.i2);
+    op1[0] = result;
+    _psw.conditionCode = (result != 0) ? 1 : 0;
+    return 2;
+}
+
+namespace
+{
+    uint8_t and8(uint8_t a, uint8_t b) { return static_cast<uint8_t>(a & b); }
+    uint8_t or8(uint8_t a, uint8_t b) { return static_cast<uint8_t>(a | b); }
+    uint8_t xor8(uint8_t a, uint8_t b) { return static_cast<uint8_t>(a ^ b); }
+    uint8_t moveNumerics(uint8_t a, uint8_t b) { return static_cast<uint8_t>((a & 0xF0) | (b & 0x0F)); }
+    uint8_t moveZones(uint8_t a, uint8_t b) { return static_cast<uint8_t>((a & 0x0F) | (b & 0xF0)); }
+}
+
+//////////
+//  Instruction handlers (RR)
+unsigned ProcessorCore::_handleInvalid(const _DecodedInstruction & /*instruction*/)
+{
+    _raiseProgramInterruption(ProgramInterruption::Operation);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleSPM(const _DecodedInstruction & instruction)
+{
+    _psw.conditionCode = static_cast<uint8_t>((_gr[instruction.r1] >> 28) & 0x03);
+    _psw.programMask = static_cast<uint8_t>((_gr[instruction.r1] >> 24) & 0x0F);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleBALR(const _DecodedInstruction & instruction)
+{
+    uint32_t address = _gr[instruction.r2];
+    _gr[instruction.r1] = _linkInformation();
+    if (instruction.r2 != 0)
+    {
+        _branch(address);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleBCTR(const _DecodedInstruction & instruction)
+{
+    uint32_t address = _gr[instruction.r2];
+    if (--_gr[instruction.r1] != 0 && instruction.r2 != 0)
+    {
+        _branch(address);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleBCR(const _DecodedInstruction & instruction)
+{
+    if (((instruction.r1 << _psw.conditionCode) & 0x08) != 0 && instruction.r2 != 0)
+    {
+        _branch(_gr[instruction.r2]);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleBASR(const _DecodedInstruction & instruction)
+{
+    uint32_t address = _gr[instruction.r2];
+    _gr[instruction.r1] = _psw.instructionAddress;
+    if (instruction.r2 != 0)
+    {
+        _branch(address);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleMVCL(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1, r2 = instruction.r2;
+    if (!_checkEvenRegister(r1) || !_checkEvenRegister(r2))
+    {
+        return 1;
+    }
+
+    uint32_t length1 = _gr[r1 + 1] & AddressMask, length2 = _gr[r2 + 1] & AddressMask;
+    uint8_t pad = static_cast<uint8_t>(_gr[r2 + 1] >> 24);
+    uint32_t address1 = _gr[r1] & AddressMask, address2 = _gr[r2] & AddressMask;
+
+    //  Destructive overlap makes the operation not take place (CC 3)
+    if (length1 != 0 && length2 != 0 && address1 != address2)
+    {
+        uint32_t overlap = qMin(length1, length2);
+        if (((address1 - address2) & AddressMask) < overlap &&
+            ((address1 - address2) & AddressMask) != 0)
+        {
+            _psw.conditionCode = 3;
+            return 2;
+        }
+    }
+    _psw.conditionCode = (length1 == length2) ? 0 : ((length1 < length2) ? 1 : 2);
+
+    //  The move goes a piece at a time, with the registers updated after
+    //  each piece, so that an access exception leaves them describing the
+    //  part not yet moved
+    unsigned cycles = 2;
+    while (length1 != 0)
+    {
+        unsigned chunk = qMin(length1, Storage::BlockSize - (address1 & Storage::BlockOffsetMask));
+        _Operand op1;
+        if (length2 != 0)
+        {
+            chunk = qMin(chunk, qMin(length2, Storage::BlockSize - (address2 & Storage::BlockOffsetMask)));
+            _Operand op2;
+            if (!_accessOperand(address2, chunk, _LoadAccess, op2) ||
+                !_accessOperand(address1, chunk, _StoreAccess, op1))
+            {
+                return cycles;
+            }
+            memmove(op1.first, op2.first, chunk);
+            address2 = (address2 + chunk) & AddressMask;
+            length2 -= chunk;
+        }
+        else
+        {
+            if (!_accessOperand(address1, chunk, _StoreAccess, op1))
+            {
+                return cycles;
+            }
+            memset(op1.first, pad, chunk);
+        }
+        address1 = (address1 + chunk) & AddressMask;
+        length1 -= chunk;
+        _gr[r1] = address1;
+        _gr[r1 + 1] = length1;
+        _gr[r2] = address2;
+        _gr[r2 + 1] = (static_cast<uint32_t>(pad) << 24) | length2;
+        cycles += 1 + chunk / 16;
+    }
+    return cycles;
+}
+
+unsigned ProcessorCore::_handleCLCL(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1, r2 = instruction.r2;
+    if (!_checkEvenRegister(r1) || !_checkEvenRegister(r2))
+    {
+        return 1;
+    }
+
+    uint32_t length1 = _gr[r1 + 1] & AddressMask, length2 = _gr[r2 + 1] & AddressMask;
+    uint8_t pad = static_cast<uint8_t>(_gr[r2 + 1] >> 24);
+    uint32_t address1 = _gr[r1] & AddressMask, address2 = _gr[r2] & AddressMask;
+
+    unsigned cycles = 2;
+    _psw.conditionCode = 0;
+    while (length1 != 0 || length2 != 0)
+    {
+        uint8_t byte1 = pad, byte2 = pad;
+        if ((length1 != 0 && !_load(address1, byte1)) ||
+            (length2 != 0 && !_load(address2, byte2)))
+        {
+            return cycles;
+        }
+        if (byte1 != byte2)
+        {
+            _psw.conditionCode = (byte1 < byte2) ? 1 : 2;
+            break;
+        }
+        if (length1 != 0)
+        {
+            address1 = (address1 + 1) & AddressMask;
+            length1--;
+        }
+        if (length2 != 0)
+        {
+            address2 = (address2 + 1) & AddressMask;
+            length2--;
+        }
+        cycles++;
+    }
+    //  The registers identify the first unequal byte
+    _gr[r1] = address1;
+    _gr[r1 + 1] = length1;
+    _gr[r2] = address2;
+    _gr[r2 + 1] = (static_cast<uint32_t>(pad) << 24) | length2;
+    return cycles;
+}
+
+unsigned ProcessorCore::_handleLPR(const _DecodedInstruction & instruction)
+{
+    uint32_t value = _gr[instruction.r2];
+    if (value == UINT32_C(0x80000000))
+    {
+        _gr[instruction.r1] = value;
+        _fixedPointOverflow();
+        return 1;
+    }
+    int32_t result = qAbs(static_cast<int32_t>(value));
+    _gr[instruction.r1] = static_cast<uint32_t>(result);
+    _setConditionCode(result);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLNR(const _DecodedInstruction & instruction)
+{
+    int32_t value = static_cast<int32_t>(_gr[instruction.r2]);
+    uint32_t result = (value > 0) ? (0 - static_cast<uint32_t>(value)) : static_cast<uint32_t>(value);
+    _gr[instruction.r1] = result;
+    _setConditionCode(static_cast<int32_t>(result));
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLTR(const _DecodedInstruction & instruction)
+{
+    _gr[instruction.r1] = _gr[instruction.r2];
+    _setConditionCode(static_cast<int32_t>(_gr[instruction.r1]));
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLCR(const _DecodedInstruction & instruction)
+{
+    uint32_t value = _gr[instruction.r2];
+    _gr[instruction.r1] = 0 - value;
+    if (value == UINT32_C(0x80000000))
+    {
+        _fixedPointOverflow();
+    }
+    else
+    {
+        _setConditionCode(static_cast<int32_t>(_gr[instruction.r1]));
+    }
+    return 1;
+}
+
+unsigned ProcessorCore::_handleNR(const _DecodedInstruction & instruction)
+{
+    _gr[instruction.r1] &= _gr[instruction.r2];
+    _psw.conditionCode = (_gr[instruction.r1] != 0) ? 1 : 0;
+    return 1;
+}
+
+unsigned ProcessorCore::_handleCLR(const _DecodedInstruction & instruction)
+{
+    _executeCompareLogical(_gr[instruction.r1], _gr[instruction.r2]);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleOR(const _DecodedInstruction & instruction)
+{
+    _gr[instruction.r1] |= _gr[instruction.r2];
+    _psw.conditionCode = (_gr[instruction.r1] != 0) ? 1 : 0;
+    return 1;
+}
+
+unsigned ProcessorCore::_handleXR(const _DecodedInstruction & instruction)
+{
+    _gr[instruction.r1] ^= _gr[instruction.r2];
+    _psw.conditionCode = (_gr[instruction.r1] != 0) ? 1 : 0;
+    return 1;
+}
+
+unsigned ProcessorCore::_handleLR(const _DecodedInstruction & instruction)
+{
+    _gr[instruction.r1] = _gr[instruction.r2];
+    return 1;
+}
+
+unsigned ProcessorCore::_handleCR(const _DecodedInstruction & instruction)
+{
+    _executeCompare(static_cast<int32_t>(_gr[instruction.r1]), static_cast<int32_t>(_gr[instruction.r2]));
+    return 1;
+}
+
+unsigned ProcessorCore::_handleAR(const _DecodedInstruction & instruction)
+{
+    _executeAdd(instruction.r1, _gr[instruction.r2]);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleSR(const _DecodedInstruction & instruction)
+{
+    _executeSubtract(instruction.r1, _gr[instruction.r2]);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleMR(const _DecodedInstruction & instruction)
+{
+    _executeMultiply(instruction.r1, _gr[instruction.r2]);
+    return 4;
+}
+
+unsigned ProcessorCore::_handleDR(const _DecodedInstruction & instruction)
+{
+    _executeDivide(instruction.r1, _gr[instruction.r2]);
+    return 10;
+}
+
+unsigned ProcessorCore::_handleALR(const _DecodedInstruction & instruction)
+{
+    _executeAddLogical(instruction.r1, _gr[instruction.r2], 0);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleSLR(const _DecodedInstruction & instruction)
+{
+    _executeAddLogical(instruction.r1, ~_gr[instruction.r2], 1);
+    return 1;
+}
+
+//////////
+//  Instruction handlers (RX)
+unsigned ProcessorCore::_handleSTH(const _DecodedInstruction & instruction)
+{
+    _store(_effectiveAddressRx(instruction), static_cast<uint16_t>(_gr[instruction.r1]));
+    return 2;
+}
+
+unsigned ProcessorCore::_handleLA(const _DecodedInstruction & instruction)
+{
+    _gr[instruction.r1] = _effectiveAddressRx(instruction);
+    return 1;
+}
+
+unsigned ProcessorCore::_handleSTC(const _DecodedInstruction & instruction)
+{
+    _store(_effectiveAddressRx(instruction), static_cast<uint8_t>(_gr[instruction.r1]));
+    return 2;
+}
+
+unsigned ProcessorCore::_handleIC(const _DecodedInstruction & instruction)
+{
+    uint8_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _gr[instruction.r1] = (_gr[instruction.r1] & UINT32_C(0xFFFFFF00)) | value;
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleEX(const _DecodedInstruction & instruction)
+{
+    uint32_t address = _effectiveAddressRx(instruction);
+    if (!_checkAlignment(address, 2))
+    {
+        return 2;
+    }
+    //  Fetch the subject instruction...
+    _Operand operand;
+    if (!_accessOperand(address, 2, _LoadAccess, operand))
+    {
+        return 2;
+    }
+    unsigned length = _instructionLength(operand[0]);
+    if (length > 2 && !_accessOperand(address, length, _LoadAccess, operand))
+    {
+        return 2;
+    }
+    uint8_t bytes[6];
+    for (unsigned i = 0; i < length; i++)
+    {
+        bytes[i] = operand[i];
+    }
+    if (bytes[0] == 0x44)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Execute);
+        return 2;
+    }
+    //  ...modify it...
+    if (instruction.r1 != 0)
+    {
+        bytes[1] = static_cast<uint8_t>(bytes[1] | _gr[instruction.r1]);
+    }
+    //  ...and execute it as if it were at the place of EX
+    _DecodedInstruction subject;
+    bool endsBasicBlock = false;
+    _decodeInstruction(bytes, subject, endsBasicBlock);
+    return 2 + (this->*subject.handler)(subject);
+}
+
+unsigned ProcessorCore::_handleBAL(const _DecodedInstruction & instruction)
+{
+    uint32_t address = _effectiveAddressRx(instruction);
+    _gr[instruction.r1] = _linkInformation();
+    _branch(address);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleBCT(const _DecodedInstruction & instruction)
+{
+    uint32_t address = _effectiveAddressRx(instruction);
+    if (--_gr[instruction.r1] != 0)
+    {
+        _branch(address);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleBC(const _DecodedInstruction & instruction)
+{
+    if (((instruction.r1 << _psw.conditionCode) & 0x08) != 0)
+    {
+        _branch(_effectiveAddressRx(instruction));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleLH(const _DecodedInstruction & instruction)
+{
+    uint16_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _gr[instruction.r1] = static_cast<uint32_t>(static_cast<int32_t>(static_cast<int16_t>(value)));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleCH(const _DecodedInstruction & instruction)
+{
+    uint16_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeCompare(static_cast<int32_t>(_gr[instruction.r1]), static_cast<int16_t>(value));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleAH(const _DecodedInstruction & instruction)
+{
+    uint16_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeAdd(instruction.r1, static_cast<uint32_t>(static_cast<int32_t>(static_cast<int16_t>(value))));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSH(const _DecodedInstruction & instruction)
+{
+    uint16_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeSubtract(instruction.r1, static_cast<uint32_t>(static_cast<int32_t>(static_cast<int16_t>(value))));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleMH(const _DecodedInstruction & instruction)
+{
+    uint16_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {   //  The product's rightmost 32 bits; no overflow
+        _gr[instruction.r1] = _gr[instruction.r1] * static_cast<uint32_t>(static_cast<int32_t>(static_cast<int16_t>(value)));
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleBAS(const _DecodedInstruction & instruction)
+{
+    uint32_t address = _effectiveAddressRx(instruction);
+    _gr[instruction.r1] = _psw.instructionAddress;
+    _branch(address);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleST(const _DecodedInstruction & instruction)
+{
+    _store(_effectiveAddressRx(instruction), _gr[instruction.r1]);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleN(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _gr[instruction.r1] &= value;
+        _psw.conditionCode = (_gr[instruction.r1] != 0) ? 1 : 0;
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleCL(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeCompareLogical(_gr[instruction.r1], value);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleO(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _gr[instruction.r1] |= value;
+        _psw.conditionCode = (_gr[instruction.r1] != 0) ? 1 : 0;
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleX(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _gr[instruction.r1] ^= value;
+        _psw.conditionCode = (_gr[instruction.r1] != 0) ? 1 : 0;
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleL(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _gr[instruction.r1] = value;
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleC(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeCompare(static_cast<int32_t>(_gr[instruction.r1]), static_cast<int32_t>(value));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleA(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeAdd(instruction.r1, value);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleS(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeSubtract(instruction.r1, value);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleM(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeMultiply(instruction.r1, value);
+    }
+    return 5;
+}
+
+unsigned ProcessorCore::_handleD(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeDivide(instruction.r1, value);
+    }
+    return 11;
+}
+
+unsigned ProcessorCore::_handleAL(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeAddLogical(instruction.r1, value, 0);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSL(const _DecodedInstruction & instruction)
+{
+    uint32_t value;
+    if (_load(_effectiveAddressRx(instruction), value))
+    {
+        _executeAddLogical(instruction.r1, ~value, 1);
+    }
+    return 2;
+}
+
+//////////
+//  Instruction handlers (RS, SI and S)
+unsigned ProcessorCore::_handleBXH(const _DecodedInstruction & instruction)
+{
+    return _executeBranchOnIndex(instruction, true);
+}
+
+unsigned ProcessorCore::_handleBXLE(const _DecodedInstruction & instruction)
+{
+    return _executeBranchOnIndex(instruction, false);
+}
+
+unsigned ProcessorCore::_handleSRL(const _DecodedInstruction & instruction)
+{
+    unsigned shift = _effectiveAddress(instruction.b2, instruction.d2) & 0x3F;
+    _gr[instruction.r1] = (shift > 31) ? 0 : (_gr[instruction.r1] >> shift);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSLL(const _DecodedInstruction & instruction)
+{
+    unsigned shift = _effectiveAddress(instruction.b2, instruction.d2) & 0x3F;
+    _gr[instruction.r1] = (shift > 31) ? 0 : (_gr[instruction.r1] << shift);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSRA(const _DecodedInstruction & instruction)
+{
+    unsigned shift = qMin(_effectiveAddress(instruction.b2, instruction.d2) & 0x3F, 31u);
+    int32_t result = static_cast<int32_t>(_gr[instruction.r1]) >> shift;
+    _gr[instruction.r1] = static_cast<uint32_t>(result);
+    _setConditionCode(result);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSLA(const _DecodedInstruction & instruction)
+{
+    //  The 31-bit numeric part is shifted; a bit unlike the sign bit
+    //  shifted out of it is an overflow
+    unsigned shift = qMin(_effectiveAddress(instruction.b2, instruction.d2) & 0x3F, 32u);
+    uint32_t value = _gr[instruction.r1];
+    uint32_t sign = value & UINT32_C(0x80000000);
+    int64_t shifted = static_cast<int64_t>(static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(value))) << shift);
+    uint32_t result = sign | (static_cast<uint32_t>(shifted) & UINT32_C(0x7FFFFFFF));
+    _gr[instruction.r1] = result;
+    if ((shifted >> 31) != ((sign != 0) ? -1 : 0))
+    {
+        _fixedPointOverflow();
+    }
+    else
+    {
+        _setConditionCode(static_cast<int32_t>(result));
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSRDL(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1;
+    if (!_checkEvenRegister(r1))
+    {
+        return 1;
+    }
+    unsigned shift = _effectiveAddress(instruction.b2, instruction.d2) & 0x3F;
+    uint64_t value = ((static_cast<uint64_t>(_gr[r1]) << 32) | _gr[r1 + 1]) >> shift;
+    _gr[r1] = static_cast<uint32_t>(value >> 32);
+    _gr[r1 + 1] = static_cast<uint32_t>(value);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSLDL(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1;
+    if (!_checkEvenRegister(r1))
+    {
+        return 1;
+    }
+    unsigned shift = _effectiveAddress(instruction.b2, instruction.d2) & 0x3F;
+    uint64_t value = ((static_cast<uint64_t>(_gr[r1]) << 32) | _gr[r1 + 1]) << shift;
+    _gr[r1] = static_cast<uint32_t>(value >> 32);
+    _gr[r1 + 1] = static_cast<uint32_t>(value);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSRDA(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1;
+    if (!_checkEvenRegister(r1))
+    {
+        return 1;
+    }
+    unsigned shift = _effectiveAddress(instruction.b2, instruction.d2) & 0x3F;
+    int64_t value = static_cast<int64_t>((static_cast<uint64_t>(_gr[r1]) << 32) | _gr[r1 + 1]) >> shift;
+    _gr[r1] = static_cast<uint32_t>(static_cast<uint64_t>(value) >> 32);
+    _gr[r1 + 1] = static_cast<uint32_t>(value);
+    _psw.conditionCode = (value == 0) ? 0 : ((value < 0) ? 1 : 2);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSLDA(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1;
+    if (!_checkEvenRegister(r1))
+    {
+        return 1;
+    }
+    //  The 63-bit numeric part is shifted; a bit unlike the sign bit
+    //  shifted out of it is an overflow
+    unsigned shift = _effectiveAddress(instruction.b2, instruction.d2) & 0x3F;
+    uint64_t value = (static_cast<uint64_t>(_gr[r1]) << 32) | _gr[r1 + 1];
+    uint64_t sign = value & UINT64_C(0x8000000000000000);
+    bool overflow = false;
+    if (shift != 0)
+    {
+        uint64_t shiftedOut = (value << 1) >> (64 - shift);
+        uint64_t expected = (sign != 0) ? ((UINT64_C(1) << shift) - 1) : 0;
+        overflow = (shiftedOut != expected);
+    }
+    uint64_t result = sign | ((value << shift) & UINT64_C(0x7FFFFFFFFFFFFFFF));
+    _gr[r1] = static_cast<uint32_t>(result >> 32);
+    _gr[r1 + 1] = static_cast<uint32_t>(result);
+    if (overflow)
+    {
+        _fixedPointOverflow();
+    }
+    else
+    {
+        int64_t signedResult = static_cast<int64_t>(result);
+        _psw.conditionCode = (signedResult == 0) ? 0 : ((signedResult < 0) ? 1 : 2);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSTM(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1, r3 = instruction.r2;
+    unsigned count = ((r3 - r1) & 0x0F) + 1;
+    _Operand operand;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), count * 4, _StoreAccess, operand))
+    {
+        return 2;
+    }
+    for (unsigned i = 0; i < count; i++)
+    {
+        uint32_t value = _gr[(r1 + i) & 0x0F];
+        operand[i * 4] = static_cast<uint8_t>(value >> 24);
+        operand[i * 4 + 1] = static_cast<uint8_t>(value >> 16);
+        operand[i * 4 + 2] = static_cast<uint8_t>(value >> 8);
+        operand[i * 4 + 3] = static_cast<uint8_t>(value);
+    }
+    return 1 + count / 2;
+}
+
+unsigned ProcessorCore::_handleTM(const _DecodedInstruction & instruction)
+{
+    uint8_t value;
+    if (_load(_effectiveAddress(instruction.b1, instruction.d1), value))
+    {
+        uint8_t selected = static_cast<uint8_t>(value & instruction.i2);
+        _psw.conditionCode = (selected == 0) ? 0 : ((selected == instruction.i2) ? 3 : 1);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleMVI(const _DecodedInstruction & instruction)
+{
+    _store(_effectiveAddress(instruction.b1, instruction.d1), instruction.i2);
+    return 2;
+}
+
+unsigned ProcessorCore::_handleTS(const _DecodedInstruction & instruction)
+{
+    _Operand operand;
+    if (_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), 1, _StoreAccess, operand))
+    {
+        _psw.conditionCode = static_cast<uint8_t>(operand[0] >> 7);
+        operand[0] = 0xFF;
+    }
+    return 3;
+}
+
+unsigned ProcessorCore::_handleNI(const _DecodedInstruction & instruction)
+{
+    return _executeLogicalSi(instruction, and8);
+}
+
+unsigned ProcessorCore::_handleCLI(const _DecodedInstruction & instruction)
+{
+    uint8_t value;
+    if (_load(_effectiveAddress(instruction.b1, instruction.d1), value))
+    {
+        _executeCompareLogical(value, instruction.i2);
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleOI(const _DecodedInstruction & instruction)
+{
+    return _executeLogicalSi(instruction, or8);
+}
+
+unsigned ProcessorCore::_handleXI(const _DecodedInstruction & instruction)
+{
+    return _executeLogicalSi(instruction, xor8);
+}
+
+unsigned ProcessorCore::_handleLM(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1, r3 = instruction.r2;
+    unsigned count = ((r3 - r1) & 0x0F) + 1;
+    _Operand operand;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), count * 4, _LoadAccess, operand))
+    {   //  No register has been changed
+        return 2;
+    }
+    for (unsigned i = 0; i < count; i++)
+    {
+        _gr[(r1 + i) & 0x0F] = (static_cast<uint32_t>(operand[i * 4]) << 24) |
+                               (static_cast<uint32_t>(operand[i * 4 + 1]) << 16) |
+                               (static_cast<uint32_t>(operand[i * 4 + 2]) << 8) |
+                               operand[i * 4 + 3];
+    }
+    return 1 + count / 2;
+}
+
+unsigned ProcessorCore::_handleCS(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1, r3 = instruction.r2;
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    _Operand operand;
+    if (!_checkAlignment(address, 4) || !_accessOperand(address, 4, _StoreAccess, operand))
+    {
+        return 2;
+    }
+    uint32_t value = hadesvm::util::loadUnalignedWithByteOrder<uint32_t>(operand.first, hadesvm::util::ByteOrder::BigEndian);
+    if (value == _gr[r1])
+    {
+        hadesvm::util::storeUnalignedWithByteOrder<uint32_t>(operand.first, _gr[r3], hadesvm::util::ByteOrder::BigEndian);
+        _psw.conditionCode = 0;
+    }
+    else
+    {
+        _gr[r1] = value;
+        _psw.conditionCode = 1;
+    }
+    return 4;
+}
+
+unsigned ProcessorCore::_handleCDS(const _DecodedInstruction & instruction)
+{
+    unsigned r1 = instruction.r1, r3 = instruction.r2;
+    uint32_t address = _effectiveAddress(instruction.b2, instruction.d2);
+    _Operand operand;
+    if (!_checkEvenRegister(r1) || !_checkEvenRegister(r3) ||
+        !_checkAlignment(address, 8) || !_accessOperand(address, 8, _StoreAccess, operand))
+    {
+        return 2;
+    }
+    uint64_t value = hadesvm::util::loadUnalignedWithByteOrder<uint64_t>(operand.first, hadesvm::util::ByteOrder::BigEndian);
+    uint64_t comparand = (static_cast<uint64_t>(_gr[r1]) << 32) | _gr[r1 + 1];
+    if (value == comparand)
+    {
+        uint64_t replacement = (static_cast<uint64_t>(_gr[r3]) << 32) | _gr[r3 + 1];
+        hadesvm::util::storeUnalignedWithByteOrder<uint64_t>(operand.first, replacement, hadesvm::util::ByteOrder::BigEndian);
+        _psw.conditionCode = 0;
+    }
+    else
+    {
+        _gr[r1] = static_cast<uint32_t>(value >> 32);
+        _gr[r1 + 1] = static_cast<uint32_t>(value);
+        _psw.conditionCode = 1;
+    }
+    return 5;
+}
+
+unsigned ProcessorCore::_handleCLM(const _DecodedInstruction & instruction)
+{
+    unsigned mask = instruction.r2;
+    unsigned count = static_cast<unsigned>(qPopulationCount(static_cast<quint8>(mask)));
+    _psw.conditionCode = 0;
+    if (count == 0)
+    {
+        return 2;
+    }
+    _Operand operand;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), count, _LoadAccess, operand))
+    {
+        return 2;
+    }
+    uint32_t value = _gr[instruction.r1];
+    for (unsigned i = 0, byte = 0; i < 4; i++)
+    {
+        if ((mask & (0x08 >> i)) != 0)
+        {
+            uint8_t registerByte = static_cast<uint8_t>(value >> (24 - 8 * i));
+            uint8_t storageByte = operand[byte++];
+            if (registerByte != storageByte)
+            {
+                _psw.conditionCode = (registerByte < storageByte) ? 1 : 2;
+                break;
+            }
+        }
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleSTCM(const _DecodedInstruction & instruction)
+{
+    unsigned mask = instruction.r2;
+    unsigned count = static_cast<unsigned>(qPopulationCount(static_cast<quint8>(mask)));
+    if (count == 0)
+    {
+        return 2;
+    }
+    _Operand operand;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), count, _StoreAccess, operand))
+    {
+        return 2;
+    }
+    uint32_t value = _gr[instruction.r1];
+    for (unsigned i = 0, byte = 0; i < 4; i++)
+    {
+        if ((mask & (0x08 >> i)) != 0)
+        {
+            operand[byte++] = static_cast<uint8_t>(value >> (24 - 8 * i));
+        }
+    }
+    return 2;
+}
+
+unsigned ProcessorCore::_handleICM(const _DecodedInstruction & instruction)
+{
+    unsigned mask = instruction.r2;
+    unsigned count = static_cast<unsigned>(qPopulationCount(static_cast<quint8>(mask)));
+    if (count == 0)
+    {
+        _psw.conditionCode = 0;
+        return 2;
+    }
+    _Operand operand;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), count, _LoadAccess, operand))
+    {
+        return 2;
+    }
+    uint32_t value = _gr[instruction.r1];
+    uint8_t inserted = 0;
+    for (unsigned i = 0, byte = 0; i < 4; i++)
+    {
+        if ((mask & (0x08 >> i)) != 0)
+        {
+            uint8_t storageByte = operand[byte++];
+            inserted |= storageByte;
+            value = (value & ~(UINT32_C(0xFF000000) >> (8 * i))) | (static_cast<uint32_t>(storageByte) << (24 - 8 * i));
+        }
+    }
+    _gr[instruction.r1] = value;
+    _psw.conditionCode = (inserted == 0) ? 0 : (((operand[0] & 0x80) != 0) ? 1 : 2);
+    return 2;
+}
+
+//////////
+//  Instruction handlers (SS)
+unsigned ProcessorCore::_handleMVN(const _DecodedInstruction & instruction)
+{
+    unsigned length = instruction.i2 + 1u;
+    _Operand op1, op2;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), length, _LoadAccess, op2) ||
+        !_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), length, _StoreAccess, op1))
+    {
+        return 2;
+    }
+    for (unsigned i = 0; i < length; i++)
+    {
+        op1[i] = moveNumerics(op1[i], op2[i]);
+    }
+    return 2 + length / 8;
+}
+
+unsigned ProcessorCore::_handleMVC(const _DecodedInstruction & instruction)
+{
+    unsigned length = instruction.i2 + 1u;
+    _Operand op1, op2;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), length, _LoadAccess, op2) ||
+        !_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), length, _StoreAccess, op1))
+    {
+        return 2;
+    }
+    if (op1.second == nullptr && op2.second == nullptr &&
+        (op1.first <= op2.first || op1.first >= op2.first + length))
+    {   //  Moving left to right a byte at a time is the same as moving the lot
+        memmove(op1.first, op2.first, length);
+    }
+    else
+    {   //  A byte at a time, so that an overlap propagates the bytes moved
+        for (unsigned i = 0; i < length; i++)
+        {
+            op1[i] = op2[i];
+        }
+    }
+    return 2 + length / 16;
+}
+
+unsigned ProcessorCore::_handleMVZ(const _DecodedInstruction & instruction)
+{
+    unsigned length = instruction.i2 + 1u;
+    _Operand op1, op2;
+    if (!_accessOperand(_effectiveAddress(instruction.b2, instruction.d2), length, _LoadAccess, op2) ||
+        !_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), length, _StoreAccess, op1))
+    {
+        return 2;
+    }
+    for (unsigned i = 0; i < length; i++)
+    {
+        op1[i] = moveZones(op1[i], op2[i]);
+    }
+    return 2 + length / 8;
+}
+
+unsigned ProcessorCore::_handleNC(const _DecodedInstruction & instruction)
+{
+    return _executeLogicalSs(instruction, and8);
+}
+
+unsigned ProcessorCore::_handleCLC(const _DecodedInstruction & instruction)
+{
+    unsigned length = instruction.i2 + 1u;
+    _Operand op1, op2;
+    if (_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), length, _LoadAccess, op1) &&
+        _accessOperand(_effectiveAddress(instruction.b2, instruction.d2), length, _LoadAccess, op2))
+    {
+        int result = _compareOperands(op1, op2, length);
+        _psw.conditionCode = (result == 0) ? 0 : ((result < 0) ? 1 : 2);
+    }
+    return 2 + length / 16;
+}
+
+unsigned ProcessorCore::_handleOC(const _DecodedInstruction & instruction)
+{
+    return _executeLogicalSs(instruction, or8);
+}
+
+unsigned ProcessorCore::_handleXC(const _DecodedInstruction & instruction)
+{
+    return _executeLogicalSs(instruction, xor8);
+}
+
+unsigned ProcessorCore::_handleTR(const _DecodedInstruction & instruction)
+{
+    unsigned length = instruction.i2 + 1u;
+    uint32_t tableAddress = _effectiveAddress(instruction.b2, instruction.d2);
+    _Operand op1;
+    if (!_accessOperand(_effectiveAddress(instruction.b1, instruction.d1), length, _StoreAccess, op1))
+    {
+        return 2;
+    }
+    //  Only the table bytes used are accessed; all of them are, before
+    //  the first operand is changed
+    uint8_t translated[256];
+    for (unsigned i = 0; i < length; i++)
+    {
+        if (!_load(tableAddress + op1[i], translated[i]))
+        {
+            return 2;
+        }
+    }
+    for (unsigned i = 0; i < length; i++)
+    {
+        op1[i] = translated[i];
+    }
+    return 2 + length / 4;
+}
+
+unsigned ProcessorCore::_handleTRT(const _DecodedInstruction & instruction)
+{
+    unsigned length = instruction.i2 + 1u;
+    uint32_t address = _effectiveAddress(instruction.b1, instruction.d1);
+    uint32_t tableAddress = _effectiveAddress(instruction.b2, instruction.d2);
+    _Operand op1;
+    if (!_accessOperand(address, length, _LoadAccess, op1))
+    {
+        return 2;
+    }
+    for (unsigned i = 0; i < length; i++)
+    {
+        uint8_t function;
+        if (!_load(tableAddress + op1[i], function))
+        {
+            return 2;
+        }
+        if (function != 0)
+        {
+            _gr[1] = (_gr[1] & UINT32_C(0xFF000000)) | ((address + i) & AddressMask);
+            _gr[2] = (_gr[2] & UINT32_C(0xFFFFFF00)) | function;
+            _psw.conditionCode = (i + 1 == length) ? 2 : 1;
+            return 2 + i / 4;
+        }
+    }
+    _psw.conditionCode = 0;
+    return 2 + length / 4;
+}
+
+//  End of hadesvm-ibm3x0/ProcessorCore.General.cpp
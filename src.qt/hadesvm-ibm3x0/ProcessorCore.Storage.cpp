@@ -0,0 +1,284 @@
+//
+//  hadesvm-ibm3x0/ProcessorCore.Storage.cpp
+//
+//  hadesvm::ibm3x0::ProcessorCore class implementation (storage access)
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+//////////
+//  Implementation helpers (address translation)
+uint8_t * ProcessorCore::_translate(uint32_t address, unsigned access)
+{
+    Q_ASSERT((address & ~AddressMask) == 0);
+
+    //  Logical -> real -> absolute
+    uint32_t realAddress = address;
+    if (_datActive && !_translateDat(address, realAddress))
+    {
+        return nullptr;
+    }
+    uint32_t absoluteAddress = _prefixed(realAddress);
+    if (absoluteAddress >= _storage->size())
+    {
+        _raiseProgramInterruption(ProgramInterruption::Addressing);
+        return nullptr;
+    }
+
+    //  Protection
+    uint8_t & key = _storage->key(absoluteAddress);
+    if (_psw.key != 0 && (key >> 4) != _psw.key &&
+        (access == _StoreAccess || (key & Storage::FetchProtectionMask) != 0))
+    {
+        _raiseProgramInterruption(ProgramInterruption::Protection);
+        return nullptr;
+    }
+    bool lowAddressProtection = (_cr[0] & _LowAddressProtectionMask) != 0;
+    if (access == _StoreAccess && lowAddressProtection && address < 512)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Protection);
+        return nullptr;
+    }
+
+    //  Record the reference (and the change)
+    uint32_t block = absoluteAddress >> Storage::BlockShift;
+    if (access == _StoreAccess)
+    {
+        key |= Storage::ReferenceMask | Storage::ChangeMask;
+        if (_codeBlocks[block] != 0)
+        {
+            _invalidateCode(block);
+        }
+    }
+    else
+    {
+        key |= Storage::ReferenceMask;
+    }
+
+    //  Cache the translation; a store entry implies a load entry, as
+    //  anything that can be stored into can be loaded from
+    _TlbEntry & entry = _tlb[(address >> Storage::BlockShift) & (_TlbSize - 1)];
+    uint32_t tag = _tagOf(address, _accessTag);
+    if (entry.loadTag != tag)
+    {
+        entry.storeTag = _InvalidTag;
+    }
+    entry.loadTag = tag;
+    if (access == _StoreAccess && !(lowAddressProtection && (address >> Storage::BlockShift) == 0))
+    {
+        entry.storeTag = tag;
+    }
+    entry.absoluteAddress = absoluteAddress & ~Storage::BlockOffsetMask;
+    entry.hostData = _storage->data() + entry.absoluteAddress;
+    return entry.hostData + (absoluteAddress & Storage::BlockOffsetMask);
+}
+
+bool ProcessorCore::_accessOperand(uint32_t address, unsigned length, unsigned access, _Operand & operand)
+{
+    Q_ASSERT(length > 0 && length <= Storage::BlockSize);
+
+    //  Both 2K blocks are accessed before anything is stored into either,
+    //  so that an access exception leaves storage unchanged
+    address &= AddressMask;
+    operand.first = _hostAddress(address, access);
+    if (operand.first == nullptr)
+    {
+        return false;
+    }
+    uint32_t offset = address & Storage::BlockOffsetMask;
+    if (offset + length <= Storage::BlockSize)
+    {
+        operand.firstLength = length;
+        operand.second = nullptr;
+        return true;
+    }
+    operand.firstLength = Storage::BlockSize - offset;
+    operand.second = _hostAddress((address + operand.firstLength) & AddressMask, access);
+    return operand.second != nullptr;
+}
+
+void ProcessorCore::_invalidateTlb()
+{
+    for (_TlbEntry & entry : _tlb)
+    {
+        entry.loadTag = _InvalidTag;
+        entry.storeTag = _InvalidTag;
+        entry.hostData = nullptr;
+        entry.absoluteAddress = 0;
+    }
+}
+
+void ProcessorCore::_invalidateStoreTlbEntries()
+{
+    for (_TlbEntry & entry : _tlb)
+    {
+        entry.storeTag = _InvalidTag;
+    }
+}
+
+ProcessorCore::_DatResult ProcessorCore::_walkTranslationTables(uint32_t address, uint32_t & realAddress, uint32_t & entryAddress)
+{
+    //  The page size (2K or 4K) and segment size (64K or 1M) come from CR0
+    unsigned pageShift, segmentShift;
+    switch (_cr[0] & _PageSizeMask)
+    {
+        case UINT32_C(0x00400000):
+            pageShift = 11;
+            break;
+        case UINT32_C(0x00800000):
+            pageShift = 12;
+            break;
+        default:
+            return _DatResult::TranslationSpecification;
+    }
+    switch (_cr[0] & _SegmentSizeMask)
+    {
+        case UINT32_C(0x00000000):
+            segmentShift = 16;
+            break;
+        case UINT32_C(0x00100000):
+            segmentShift = 20;
+            break;
+        default:
+            return _DatResult::TranslationSpecification;
+    }
+    uint32_t segmentIndex = address >> segmentShift;
+    uint32_t pageIndex = (address >> pageShift) & ((UINT32_C(1) << (segmentShift - pageShift)) - 1);
+
+    //  Segment table entry; the segment table length is in units of 16 entries
+    entryAddress = ((_cr[1] & UINT32_C(0x00FFFFC0)) + segmentIndex * 4) & AddressMask;
+    if ((segmentIndex >> 4) > (_cr[1] >> 24))
+    {
+        return _DatResult::SegmentTableLength;
+    }
+    uint32_t absoluteAddress = _prefixed(entryAddress);
+    if (absoluteAddress > _storage->size() - 4)
+    {
+        return _DatResult::Addressing;
+    }
+    uint32_t segmentTableEntry =
+        hadesvm::util::loadUnalignedWithByteOrder<uint32_t>(_storage->data() + absoluteAddress, hadesvm::util::ByteOrder::BigEndian);
+    if ((segmentTableEntry & UINT32_C(0x00000001)) != 0)
+    {
+        return _DatResult::SegmentInvalid;
+    }
+
+    //  Page table entry; the page table length is in units of 16 entries
+    entryAddress = ((segmentTableEntry & UINT32_C(0x00FFFFF8)) + pageIndex * 2) & AddressMask;
+    if ((pageIndex >> 4) > (segmentTableEntry >> 28))
+    {
+        return _DatResult::PageTableLength;
+    }
+    absoluteAddress = _prefixed(entryAddress);
+    if (absoluteAddress > _storage->size() - 2)
+    {
+        return _DatResult::Addressing;
+    }
+    uint16_t pageTableEntry =
+        hadesvm::util::loadUnalignedWithByteOrder<uint16_t>(_storage->data() + absoluteAddress, hadesvm::util::ByteOrder::BigEndian);
+    if (pageShift == 12)
+    {
+        if ((pageTableEntry & 0x0006) != 0)
+        {
+            return _DatResult::TranslationSpecification;
+        }
+        if ((pageTableEntry & 0x0008) != 0)
+        {
+            return _DatResult::PageInvalid;
+        }
+        realAddress = (static_cast<uint32_t>(pageTableEntry & 0xFFF0) << 8) | (address & UINT32_C(0x00000FFF));
+    }
+    else
+    {
+        if ((pageTableEntry & 0x0002) != 0)
+        {
+            return _DatResult::TranslationSpecification;
+        }
+        if ((pageTableEntry & 0x0004) != 0)
+        {
+            return _DatResult::PageInvalid;
+        }
+        realAddress = (static_cast<uint32_t>(pageTableEntry & 0xFFF8) << 8) | (address & UINT32_C(0x000007FF));
+    }
+    return _DatResult::Translated;
+}
+
+bool ProcessorCore::_translateDat(uint32_t address, uint32_t & realAddress)
+{
+    uint32_t entryAddress = 0;
+    ProgramInterruption interruption;
+    switch (_walkTranslationTables(address, realAddress, entryAddress))
+    {
+        case _DatResult::Translated:
+            return true;
+        case _DatResult::SegmentTableLength:
+        case _DatResult::SegmentInvalid:
+            interruption = ProgramInterruption::SegmentTranslation;
+            break;
+        case _DatResult::PageTableLength:
+        case _DatResult::PageInvalid:
+            interruption = ProgramInterruption::PageTranslation;
+            break;
+        case _DatResult::TranslationSpecification:
+            _raiseProgramInterruption(ProgramInterruption::TranslationSpecification);
+            return false;
+        case _DatResult::Addressing:
+        default:
+            _raiseProgramInterruption(ProgramInterruption::Addressing);
+            return false;
+    }
+    //  The OS needs to know which address to page in
+    _storeRealWord(_TranslationExceptionAddressLocation, address);
+    _raiseProgramInterruption(interruption);
+    return false;
+}
+
+//////////
+//  Implementation helpers (storage access)
+bool ProcessorCore::_checkAlignment(uint32_t address, uint32_t size)
+{
+    if ((address & (size - 1)) != 0)
+    {
+        _raiseProgramInterruption(ProgramInterruption::Specification);
+        return false;
+    }
+    return true;
+}
+
+uint8_t * ProcessorCore::_realStorage(uint32_t realAddress)
+{
+    uint32_t absoluteAddress = _prefixed(realAddress);
+    Q_ASSERT(absoluteAddress < _storage->size());
+    return _storage->data() + absoluteAddress;
+}
+
+uint32_t ProcessorCore::_loadRealWord(uint32_t realAddress)
+{
+    return hadesvm::util::loadUnalignedWithByteOrder<uint32_t>(_realStorage(realAddress), hadesvm::util::ByteOrder::BigEndian);
+}
+
+void ProcessorCore::_storeRealWord(uint32_t realAddress, uint32_t value)
+{
+    hadesvm::util::storeUnalignedWithByteOrder<uint32_t>(_realStorage(realAddress), value, hadesvm::util::ByteOrder::BigEndian);
+    _noteAbsoluteStore(_prefixed(realAddress));
+}
+
+void ProcessorCore::_storeRealHalfWord(uint32_t realAddress, uint16_t value)
+{
+    hadesvm::util::storeUnalignedWithByteOrder<uint16_t>(_realStorage(realAddress), value, hadesvm::util::ByteOrder::BigEndian);
+    _noteAbsoluteStore(_prefixed(realAddress));
+}
+
+uint64_t ProcessorCore::_loadRealDoubleWord(uint32_t realAddress)
+{
+    return hadesvm::util::loadUnalignedWithByteOrder<uint64_t>(_realStorage(realAddress), hadesvm::util::ByteOrder::BigEndian);
+}
+
+void ProcessorCore::_storeRealDoubleWord(uint32_t realAddress, uint64_t value)
+{
+    hadesvm::util::storeUnalignedWithByteOrder<uint64_t>(_realStorage(realAddress), value, hadesvm::util::ByteOrder::BigEndian);
+    _noteAbsoluteStore(_prefixed(realAddress));
+}
+
+//  End of hadesvm-ibm3x0/ProcessorCore.Storage.cpp
@@ -0,0 +1,487 @@
+//
+//  hadesvm-ibm3x0/ProcessorCore.cpp
+//
+//  hadesvm::ibm3x0::ProcessorCore class implementation
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+namespace
+{
+    //  TOD clock units in a second; bit 51 of the TOD clock is a microsecond
+    const uint64_t TodUnitsPerSecond = UINT64_C(4096000000);
+
+    //  Seconds from the TOD clock epoch (1900-01-01) to the Unix one
+    const uint64_t TodEpochOffset = UINT64_C(2208988800);
+}
+
+//////////
+//  Construction/destruction
+ProcessorCore::ProcessorCore(Storage * storage, const hadesvm::core::ClockFrequency & clockFrequency)
+    :   _storage(storage),
+        _clockFrequencyHz(qMax(clockFrequency.toHz(), UINT64_C(1))),
+        _gr(),
+        _fpr(),
+        _cr(),
+        _prefix(0),
+        _psw(),
+        _stopped(true),
+        _datActive(false),
+        _accessTag(0),
+        _instructionAddress(0),
+        _todClock(0),
+        _todClockRemainder(0),
+        _clockComparator(0),
+        _cpuTimer(0),
+        _intervalTimerRemainder(0),
+        _externalPending(0),
+        _sliceEnd(0),
+        _cyclesLeft(0),
+        _clockCycles(0),
+        _instructionCount(0),
+        _tlb(),
+        _basicBlockCache(new _BasicBlock[_BasicBlockCacheSize]),
+        _crossingBasicBlock(),
+        _codeBlocks(new uint8_t[storage->numBlocks()]),
+        _leaveBasicBlock(false)
+{
+    Q_ASSERT(_storage != nullptr);
+
+    reset();
+}
+
+ProcessorCore::~ProcessorCore() noexcept
+{
+    delete [] _basicBlockCache;
+    delete [] _codeBlocks;
+}
+
+//////////
+//  Operations
+void ProcessorCore::reset()
+{
+    //  Registers
+    for (size_t i = 0; i < sizeof(_gr) / sizeof(_gr[0]); i++)
+    {
+        _gr[i] = 0;
+    }
+    for (size_t i = 0; i < sizeof(_fpr) / sizeof(_fpr[0]); i++)
+    {
+        _fpr[i] = 0;
+    }
+    for (size_t i = 0; i < sizeof(_cr) / sizeof(_cr[0]); i++)
+    {
+        _cr[i] = 0;
+    }
+    _cr[0] = UINT32_C(0x000000E0);
+    _cr[2] = UINT32_C(0xFFFFFFFF);
+    _cr[14] = UINT32_C(0xC2000000);
+    _cr[15] = UINT32_C(0x00000200);
+    _prefix = 0;
+
+    //  State
+    _psw = _Psw();
+    _stopped = true;
+    _updateAccessTag();
+    _instructionAddress = 0;
+
+    //  Timers. The TOD clock starts with the host time; time after that
+    //  is virtual
+    _todClock = (static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch()) + TodEpochOffset * 1000) * 1000 * 4096;
+    _todClockRemainder = 0;
+    _clockComparator = UINT64_MAX;
+    _cpuTimer = INT64_MAX;
+    _intervalTimerRemainder = 0;
+    _externalPending = 0;
+    _cyclesLeft = 0;
+    _clockCycles = _sliceEnd;
+
+    //  Nothing cached before the reset is any good
+    _invalidateTlb();
+    _invalidateAllBasicBlocks();
+}
+
+bool ProcessorCore::ipl()
+{
+    _Psw psw;
+    uint64_t iplPsw = hadesvm::util::loadUnalignedWithByteOrder<uint64_t>(_storage->data(), hadesvm::util::ByteOrder::BigEndian);
+    if (!_pswFromDoubleWord(iplPsw, psw))
+    {   //  OOPS! The CPU can't start
+        _stopped = true;
+        return false;
+    }
+    _setPsw(psw);
+    _stopped = false;
+    return true;
+}
+
+bool ProcessorCore::setPsw(uint64_t psw)
+{
+    _Psw unpackedPsw;
+    if (!_pswFromDoubleWord(psw, unpackedPsw))
+    {
+        return false;
+    }
+    _setPsw(unpackedPsw);
+    _stopped = false;
+    return true;
+}
+
+void ProcessorCore::saveSnapshot(hadesvm::core::SnapshotWriter & writer) const
+{
+    for (int i = 0; i < 16; i++)
+    {
+        writer << _gr[i] << _cr[i];
+    }
+    for (int i = 0; i < 8; i += 2)
+    {
+        writer << _fpr[i];
+    }
+    writer << _prefix
+           << _pswToDoubleWord(0, 0)
+           << _stopped
+           << _todClock
+           << _todClockRemainder
+           << _clockComparator
+           << static_cast<uint64_t>(_cpuTimer)
+           << _intervalTimerRemainder
+           << _externalPending
+           << static_cast<uint64_t>(_cyclesLeft);
+}
+
+void ProcessorCore::restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        reader >> _gr[i] >> _cr[i];
+    }
+    for (int i = 0; i < 8; i += 2)
+    {
+        reader >> _fpr[i];
+    }
+    uint64_t psw = 0, cpuTimer = 0, cyclesLeft = 0;
+    reader >> _prefix
+           >> psw
+           >> _stopped
+           >> _todClock
+           >> _todClockRemainder
+           >> _clockComparator
+           >> cpuTimer
+           >> _intervalTimerRemainder
+           >> _externalPending
+           >> cyclesLeft;
+    _Psw unpackedPsw;
+    if (!_pswFromDoubleWord(psw, unpackedPsw) ||
+        (_prefix & ~UINT32_C(0x00FFF000)) != 0 || _prefix > _storage->size() - 4096)
+    {
+        throw hadesvm::core::VirtualApplianceException("Invalid processor state in snapshot");
+    }
+    _setPsw(unpackedPsw);
+    _cpuTimer = static_cast<int64_t>(cpuTimer);
+    _cyclesLeft = static_cast<int64_t>(cyclesLeft);
+    _clockCycles = _currentCycles();
+
+    //  Nothing cached before the restore is any good
+    _invalidateTlb();
+    _invalidateAllBasicBlocks();
+}
+
+unsigned ProcessorCore::runCycles(unsigned numCycles)
+{
+    _sliceEnd += numCycles;
+    _cyclesLeft += numCycles;
+
+    while (_cyclesLeft > 0)
+    {
+        if (_stopped)
+        {   //  Time passes all the same
+            _cyclesLeft = 0;
+            break;
+        }
+        if ((_externalPending & _enabledExternalInterruptions()) != 0)
+        {
+            _takeExternalInterruption();
+            _cyclesLeft--;
+            continue;
+        }
+        if (_psw.wait)
+        {   //  Nothing to do until the timers are brought up to date
+            _cyclesLeft = 0;
+            break;
+        }
+        _runInstructions();
+    }
+    _synchronizeClocks();
+    return numCycles;
+}
+
+uint64_t ProcessorCore::idleCycles() const
+{
+    if (_stopped)
+    {
+        return UINT64_MAX;
+    }
+    if (!_psw.wait)
+    {
+        return 0;
+    }
+    uint32_t enabled = _enabledExternalInterruptions();
+    if ((_externalPending & enabled) != 0)
+    {
+        return 0;
+    }
+    //  The timers are synchronized, so none of the enabled ones is pending
+    uint64_t todUnits = UINT64_MAX;
+    if ((enabled & _ClockComparatorPending) != 0)
+    {
+        todUnits = qMin(todUnits, _clockComparator - _todClock + 1);
+    }
+    if ((enabled & _CpuTimerPending) != 0)
+    {
+        todUnits = qMin(todUnits, static_cast<uint64_t>(_cpuTimer) + 1);
+    }
+    if ((enabled & _IntervalTimerPending) != 0)
+    {
+        int32_t intervalTimer =
+            static_cast<int32_t>(hadesvm::util::loadUnalignedWithByteOrder<uint32_t>(
+                                    _storage->data() + _prefixed(_IntervalTimerLocation),
+                                    hadesvm::util::ByteOrder::BigEndian));
+        if (intervalTimer >= 0)
+        {
+            todUnits = qMin(todUnits, ((static_cast<uint64_t>(intervalTimer) + 1) * 160000 - _intervalTimerRemainder) / 3);
+        }
+    }
+    return (todUnits == UINT64_MAX) ? UINT64_MAX : _todUnitsToCycles(todUnits);
+}
+
+//////////
+//  Implementation helpers (PSW)
+uint64_t ProcessorCore::_pswToDoubleWord(uint16_t interruptionCode, unsigned ilc) const
+{
+    uint64_t result = (static_cast<uint64_t>(_psw.systemMask) << 56) |
+                      (static_cast<uint64_t>(_psw.key) << 52) |
+                      (_psw.ecMode ? (UINT64_C(1) << 51) : 0) |
+                      (_psw.machineCheckMask ? (UINT64_C(1) << 50) : 0) |
+                      (_psw.wait ? (UINT64_C(1) << 49) : 0) |
+                      (_psw.problemState ? (UINT64_C(1) << 48) : 0) |
+                      _psw.instructionAddress;
+    if (_psw.ecMode)
+    {
+        result |= (static_cast<uint64_t>(_psw.conditionCode) << 44) |
+                  (static_cast<uint64_t>(_psw.programMask) << 40);
+    }
+    else
+    {
+        result |= (static_cast<uint64_t>(interruptionCode) << 32) |
+                  (static_cast<uint64_t>(ilc) << 30) |
+                  (static_cast<uint64_t>(_psw.conditionCode) << 28) |
+                  (static_cast<uint64_t>(_psw.programMask) << 24);
+    }
+    return result;
+}
+
+bool ProcessorCore::_pswFromDoubleWord(uint64_t value, _Psw & psw)
+{
+    psw.systemMask = static_cast<uint8_t>(value >> 56);
+    psw.key = static_cast<uint8_t>((value >> 52) & 0x0F);
+    psw.ecMode = ((value >> 51) & 1) != 0;
+    psw.machineCheckMask = ((value >> 50) & 1) != 0;
+    psw.wait = ((value >> 49) & 1) != 0;
+    psw.problemState = ((value >> 48) & 1) != 0;
+    psw.instructionAddress = static_cast<uint32_t>(value) & AddressMask;
+    if (psw.ecMode)
+    {   //  Bits 0, 2-4, 16-17 and 24-39 must be zero
+        if ((value & UINT64_C(0xB8003F00FF000000)) != 0)
+        {
+            return false;
+        }
+        psw.conditionCode = static_cast<uint8_t>((value >> 44) & 0x03);
+        psw.programMask = static_cast<uint8_t>((value >> 40) & 0x0F);
+    }
+    else
+    {
+        psw.conditionCode = static_cast<uint8_t>((value >> 28) & 0x03);
+        psw.programMask = static_cast<uint8_t>((value >> 24) & 0x0F);
+    }
+    return true;
+}
+
+void ProcessorCore::_setPsw(const _Psw & psw)
+{
+    _psw = psw;
+    _updateAccessTag();
+    _leaveBasicBlock = true;
+}
+
+void ProcessorCore::_setSystemMask(uint8_t systemMask)
+{
+    _psw.systemMask = systemMask;
+    _updateAccessTag();
+    _leaveBasicBlock = true;
+}
+
+void ProcessorCore::_updateAccessTag()
+{
+    _datActive = _psw.ecMode && (_psw.systemMask & _EcTranslationMask) != 0;
+    _accessTag = (static_cast<uint32_t>(_psw.key) << 13) | (_datActive ? (UINT32_C(1) << 17) : 0);
+}
+
+//////////
+//  Implementation helpers (interruptions)
+void ProcessorCore::_swapPsw(uint32_t oldPswLocation, uint32_t newPswLocation, uint16_t interruptionCode, unsigned ilc)
+{
+    _storeRealDoubleWord(oldPswLocation, _pswToDoubleWord(interruptionCode, ilc));
+    _Psw psw;
+    if (_pswFromDoubleWord(_loadRealDoubleWord(newPswLocation), psw))
+    {
+        _setPsw(psw);
+    }
+    else
+    {   //  OOPS! An invalid new PSW would only cause another interruption
+        //  to the same new PSW, forever; stop the CPU instead
+        _stopped = true;
+        _leaveBasicBlock = true;
+    }
+}
+
+void ProcessorCore::_raiseProgramInterruption(ProgramInterruption interruption)
+{
+    unsigned ilc = _ilc();
+    if (interruption == ProgramInterruption::SegmentTranslation ||
+        interruption == ProgramInterruption::PageTranslation)
+    {   //  The instruction is nullified, so that it can be re-executed
+        //  once the page is in
+        _psw.instructionAddress = _instructionAddress;
+    }
+    uint16_t code = static_cast<uint16_t>(interruption);
+    if (_psw.ecMode)
+    {
+        _storeRealWord(_ProgramInterruptionCodeLocation, (static_cast<uint32_t>(ilc) << 17) | code);
+    }
+    _swapPsw(_ProgramOldPswLocation, _ProgramNewPswLocation, code, ilc);
+}
+
+void ProcessorCore::_raiseSvcInterruption(uint8_t number)
+{
+    unsigned ilc = _ilc();
+    if (_psw.ecMode)
+    {
+        _storeRealWord(_SvcInterruptionCodeLocation, (static_cast<uint32_t>(ilc) << 17) | number);
+    }
+    _swapPsw(_SvcOldPswLocation, _SvcNewPswLocation, number, ilc);
+}
+
+bool ProcessorCore::_takeExternalInterruption()
+{
+    uint32_t pending = _externalPending & _enabledExternalInterruptions();
+    uint16_t code;
+    if ((pending & _ClockComparatorPending) != 0)
+    {   //  Stays pending until the clock comparator is set anew
+        code = 0x1004;
+    }
+    else if ((pending & _CpuTimerPending) != 0)
+    {   //  Stays pending until the CPU timer is set anew
+        code = 0x1005;
+    }
+    else if ((pending & _IntervalTimerPending) != 0)
+    {
+        _externalPending &= ~_IntervalTimerPending;
+        code = 0x0080;
+    }
+    else
+    {
+        return false;
+    }
+    if (_psw.ecMode)
+    {
+        _storeRealHalfWord(_ExternalInterruptionCodeLocation, code);
+    }
+    _swapPsw(_ExternalOldPswLocation, _ExternalNewPswLocation, code, 0);
+    return true;
+}
+
+bool ProcessorCore::_checkSupervisorState()
+{
+    if (_psw.problemState)
+    {
+        _raiseProgramInterruption(ProgramInterruption::PrivilegedOperation);
+        return false;
+    }
+    return true;
+}
+
+//////////
+//  Implementation helpers (timers)
+void ProcessorCore::_synchronizeClocks()
+{
+    uint64_t now = _currentCycles();
+    uint64_t cycles = now - _clockCycles;
+    if (cycles == 0)
+    {
+        return;
+    }
+    _clockCycles = now;
+
+    //  todUnits = cycles * TodUnitsPerSecond / _clockFrequencyHz, exactly
+    //  over time (the remainder is carried over to the next call)
+    uint64_t low = 0;
+    uint64_t high = hadesvm::util::Math::multiply64x64(cycles, TodUnitsPerSecond, low);
+    low += _todClockRemainder;
+    if (low < _todClockRemainder)
+    {
+        high++;
+    }
+    if (high >= _clockFrequencyHz)
+    {   //  Centuries of virtual time - can't happen
+        high %= _clockFrequencyHz;
+    }
+    uint64_t todUnits = hadesvm::util::Math::divide128by64(high, low, _clockFrequencyHz, _todClockRemainder);
+
+    _todClock += todUnits;
+    _cpuTimer -= static_cast<int64_t>(todUnits);
+
+    //  The interval timer counts down the word in real storage
+    _intervalTimerRemainder += todUnits * 3;
+    uint64_t intervals = _intervalTimerRemainder / 160000;
+    _intervalTimerRemainder %= 160000;
+    if (intervals != 0)
+    {
+        int32_t oldValue = static_cast<int32_t>(_loadRealWord(_IntervalTimerLocation));
+        int32_t newValue = static_cast<int32_t>(static_cast<uint32_t>(oldValue) - static_cast<uint32_t>(intervals));
+        _storeRealWord(_IntervalTimerLocation, static_cast<uint32_t>(newValue));
+        if (oldValue >= 0 && (newValue < 0 || intervals > UINT32_C(0x7FFFFFFF)))
+        {
+            _externalPending |= _IntervalTimerPending;
+        }
+    }
+    _updateTimerInterruptions();
+}
+
+void ProcessorCore::_updateTimerInterruptions()
+{
+    _externalPending &= ~(_ClockComparatorPending | _CpuTimerPending);
+    if (_todClock > _clockComparator)
+    {
+        _externalPending |= _ClockComparatorPending;
+    }
+    if (_cpuTimer < 0)
+    {
+        _externalPending |= _CpuTimerPending;
+    }
+}
+
+uint64_t ProcessorCore::_todUnitsToCycles(uint64_t todUnits) const
+{   //  Rounded up, so that the timer has fired by then
+    uint64_t low = 0;
+    uint64_t high = hadesvm::util::Math::multiply64x64(todUnits, _clockFrequencyHz, low);
+    if (high >= TodUnitsPerSecond)
+    {
+        return UINT64_MAX;
+    }
+    uint64_t remainder = 0;
+    uint64_t cycles = hadesvm::util::Math::divide128by64(high, low, TodUnitsPerSecond, remainder);
+    return (remainder != 0 && cycles != UINT64_MAX) ? (cycles + 1) : cycles;
+}
+
+//  End of hadesvm-ibm3x0/ProcessorCore.cpp
@@ -0,0 +1,809 @@
+//
+//  hadesvm-ibm3x0/ProcessorCore.hpp
+//
+//  IBM System/370 central processing unit
+//
+//////////
+
+namespace hadesvm
+{
+    namespace ibm3x0
+    {
+        //////////
+        //  Program interruption codes
+        enum class ProgramInterruption : uint16_t
+        {
+            Operation               = 0x0001,
+            PrivilegedOperation     = 0x0002,
+            Execute                 = 0x0003,
+            Protection              = 0x0004,
+            Addressing              = 0x0005,
+            Specification           = 0x0006,
+            Data                    = 0x0007,
+            FixedPointOverflow      = 0x0008,
+            FixedPointDivide        = 0x0009,
+            DecimalOverflow         = 0x000A,
+            DecimalDivide           = 0x000B,
+            ExponentOverflow        = 0x000C,
+            ExponentUnderflow       = 0x000D,
+            Significance            = 0x000E,
+            FloatingPointDivide     = 0x000F,
+            SegmentTranslation      = 0x0010,
+            PageTranslation         = 0x0011,
+            TranslationSpecification= 0x0012,
+            SpecialOperation        = 0x0013,
+            MonitorEvent            = 0x0040
+        };
+
+        //////////
+        //  The System/370 CPU: the universal instruction set with the
+        //  floating-point, extended-precision floating-point and decimal
+        //  features, storage keys, dynamic address translation, the TOD
+        //  clock, clock comparator, CPU timer and interval timer. There is
+        //  no channel subsystem yet, so I/O instructions find no channels.
+        //
+        //  Instructions are predecoded into basic blocks, each of which is a
+        //  straight run of instructions within one 2K block of storage that
+        //  ends with the first instruction that branches or changes the CPU
+        //  state. Basic blocks are cached by absolute address; storing into
+        //  a 2K block drops the basic blocks decoded from it.
+        //
+        //  Time is virtual: it advances by the clock cycles the instructions
+        //  take, so that the timers see the same instruction stream at the
+        //  same point regardless of the host speed.
+        class HADESVM_IBM3X0_PUBLIC ProcessorCore final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(ProcessorCore)
+
+            friend class Processor;
+
+            //////////
+            //  Constants
+        public:
+            static const uint32_t   AddressMask = UINT32_C(0x00FFFFFF);
+
+            //  The CPU identification stored by STIDP
+            static const uint64_t   CpuId = UINT64_C(0x0000000131580000);
+
+            //////////
+            //  Construction/destruction
+        public:
+            ProcessorCore(Storage * storage, const hadesvm::core::ClockFrequency & clockFrequency);
+            ~ProcessorCore() noexcept;
+
+            //////////
+            //  Operations
+        public:
+            //  Performs an initial CPU reset, leaving the CPU stopped
+            void                reset();
+
+            //  Completes an initial program load: the PSW is loaded from
+            //  absolute location 0 and the CPU starts running. Returns false
+            //  (and the CPU stays stopped) if that PSW is not valid.
+            bool                ipl();
+
+            //  Saves/restores the state of this CPU to/from a VA snapshot;
+            //  only to be used while the CPU is not running
+            void                saveSnapshot(hadesvm::core::SnapshotWriter & writer) const;
+            void                restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException);
+
+            //  Runs this CPU for the specified number of clock cycles; an
+            //  instruction that takes the CPU past them borrows the excess
+            //  from the next call. Returns the number of clock cycles run,
+            //  which is always "numCycles".
+            unsigned            runCycles(unsigned numCycles);
+
+            //  If this CPU is in the wait state, returns the number of clock
+            //  cycles before a timer can end it (UINT64_MAX if none can);
+            //  if the CPU is running, returns 0.
+            uint64_t            idleCycles() const;
+
+            //  The state of this CPU
+            bool                isStopped() const { return _stopped; }
+            bool                isWaiting() const { return !_stopped && _psw.wait; }
+            uint64_t            instructionCount() const { return _instructionCount; }
+
+            //  The registers of this CPU, for the tools; the PSW is in
+            //  the format it is stored in by interruptions
+            uint64_t            psw() const { return _pswToDoubleWord(0, 0); }
+            bool                setPsw(uint64_t psw);
+            uint32_t            generalRegister(unsigned r) const { Q_ASSERT(r < 16); return _gr[r]; }
+            void                setGeneralRegister(unsigned r, uint32_t value) { Q_ASSERT(r < 16); _gr[r] = value; }
+            uint64_t            floatingPointRegister(unsigned r) const { Q_ASSERT(r < 8 && (r & 1) == 0); return _fpr[r]; }
+            uint32_t            controlRegister(unsigned r) const { Q_ASSERT(r < 16); return _cr[r]; }
+
+            //////////
+            //  Implementation
+        private:
+            Storage *const      _storage;
+            const uint64_t      _clockFrequencyHz;
+
+            //  Registers. General register 16 doesn't exist - it is a zero
+            //  that the decoder substitutes for a base or index register 0,
+            //  so that address arithmetic needs no tests.
+            uint32_t            _gr[17];
+            uint64_t            _fpr[8];    //  only 0, 2, 4 and 6 are used
+            uint32_t            _cr[16];
+            uint32_t            _prefix;
+
+            //  Control register 0 bits
+            static const uint32_t   _SsmSuppressionMask = UINT32_C(0x40000000);
+            static const uint32_t   _LowAddressProtectionMask = UINT32_C(0x10000000);
+            static const uint32_t   _ExtractionAuthorityMask = UINT32_C(0x08000000);
+            static const uint32_t   _PageSizeMask = UINT32_C(0x00C00000);
+            static const uint32_t   _SegmentSizeMask = UINT32_C(0x00180000);
+
+            //  The PSW, unpacked
+            struct _Psw
+            {
+                uint8_t         systemMask;
+                uint8_t         key;
+                bool            ecMode;
+                bool            machineCheckMask;
+                bool            wait;
+                bool            problemState;
+                uint8_t         conditionCode;
+                uint8_t         programMask;
+                uint32_t        instructionAddress;
+            };
+
+            static const uint8_t    _ExternalMask = 0x01;
+            static const uint8_t    _EcIoMask = 0x02;
+            static const uint8_t    _EcTranslationMask = 0x04;
+            static const uint8_t    _EcPerMask = 0x40;
+
+            static const uint8_t    _FixedPointOverflowMask = 0x08;
+            static const uint8_t    _DecimalOverflowMask = 0x04;
+            static const uint8_t    _ExponentUnderflowMask = 0x02;
+            static const uint8_t    _SignificanceMask = 0x01;
+
+            _Psw                _psw;
+            bool                _stopped;
+            bool                _datActive;     //  replicates the EC mode T bit for faster access
+            uint32_t            _accessTag;     //  replicates the PSW key and T bit in the form TLB tags use
+
+            //  The address of the instruction being executed; the PSW
+            //  instruction address already points to the next one
+            uint32_t            _instructionAddress;
+
+            //  Timers. The TOD clock, clock comparator and CPU timer count
+            //  in units of 2**-12 microseconds (bit 51 is a microsecond).
+            //  The interval timer is the word at real location 80, of which
+            //  bit 31 counts down 76800 times a second.
+            uint64_t            _todClock;
+            uint64_t            _todClockRemainder;     //  ...of TOD clock units, in 1/_clockFrequencyHz
+            uint64_t            _clockComparator;
+            int64_t             _cpuTimer;
+            uint64_t            _intervalTimerRemainder;    //  ...of interval timer units, in thirds of TOD clock units
+
+            static const uint32_t   _IntervalTimerLocation = 80;
+
+            //  Pending external interruptions, as the CR0 bits that mask them;
+            //  the clock comparator and CPU timer conditions stay pending for
+            //  as long as they persist
+            static const uint32_t   _ClockComparatorPending = UINT32_C(0x00000800);
+            static const uint32_t   _CpuTimerPending = UINT32_C(0x00000400);
+            static const uint32_t   _IntervalTimerPending = UINT32_C(0x00000080);
+            uint32_t            _externalPending;
+
+            //  Virtual time: the clock cycle count at which the current
+            //  runCycles() call ends, the cycles left until then (negative
+            //  when the last instruction overran) and the cycle count up to
+            //  which the timers have been brought
+            uint64_t            _sliceEnd;
+            int64_t             _cyclesLeft;
+            uint64_t            _clockCycles;
+            uint64_t            _instructionCount;
+
+            //  Fixed storage locations (real addresses)
+            static const uint32_t   _RestartNewPswLocation = 0x0000;
+            static const uint32_t   _RestartOldPswLocation = 0x0008;
+            static const uint32_t   _ExternalOldPswLocation = 0x0018;
+            static const uint32_t   _SvcOldPswLocation = 0x0020;
+            static const uint32_t   _ProgramOldPswLocation = 0x0028;
+            static const uint32_t   _MachineCheckOldPswLocation = 0x0030;
+            static const uint32_t   _IoOldPswLocation = 0x0038;
+            static const uint32_t   _ExternalNewPswLocation = 0x0058;
+            static const uint32_t   _SvcNewPswLocation = 0x0060;
+            static const uint32_t   _ProgramNewPswLocation = 0x0068;
+            static const uint32_t   _MachineCheckNewPswLocation = 0x0070;
+            static const uint32_t   _IoNewPswLocation = 0x0078;
+            static const uint32_t   _ExternalInterruptionCodeLocation = 0x0086;
+            static const uint32_t   _SvcInterruptionCodeLocation = 0x0088;
+            static const uint32_t   _ProgramInterruptionCodeLocation = 0x008C;
+            static const uint32_t   _TranslationExceptionAddressLocation = 0x0090;
+            static const uint32_t   _MonitorClassLocation = 0x0094;
+            static const uint32_t   _MonitorCodeLocation = 0x009C;
+
+            //  Translations of logical addresses, 2K blocks at a time, are
+            //  cached in a direct-mapped TLB. An entry made for a load also
+            //  serves instruction fetches; one made for a store also serves
+            //  loads. Tags combine the logical block number with _accessTag,
+            //  so that a change of the PSW key or the T bit needs no flush;
+            //  everything else that affects translation or protection does.
+            //  Stores never go through an entry for a 2K block that holds
+            //  predecoded instructions, nor through the entry for logical
+            //  block 0 while low-address protection is on, as that covers
+            //  the protected addresses 0..511 as well as the ones above.
+            //  A change of low-address protection alone drops all store entries.
+            struct _TlbEntry
+            {
+                uint32_t        loadTag;
+                uint32_t        storeTag;
+                uint8_t *       hostData;           //  ...of the 2K block
+                uint32_t        absoluteAddress;    //  ...of the 2K block
+            };
+
+            static const size_t     _TlbSize = 256;     //  must be a power of 2
+            static const uint32_t   _InvalidTag = UINT32_C(0xFFFFFFFF);
+            _TlbEntry           _tlb[_TlbSize];
+
+            static const unsigned   _LoadAccess = 0;    //  ...and instruction fetch
+            static const unsigned   _StoreAccess = 1;
+
+            //  A storage operand of up to 2K bytes, in the host memory of
+            //  (at most) two 2K blocks
+            struct _Operand
+            {
+                uint8_t *       first;
+                unsigned        firstLength;
+                uint8_t *       second;     //  nullptr == the operand is all in the first block
+
+                uint8_t &       operator [] (unsigned index) const
+                {
+                    return (index < firstLength) ? first[index] : second[index - firstLength];
+                }
+            };
+
+            //  Helpers (address translation). Unless stated otherwise, these
+            //  return true (or host memory) on success; on failure they raise
+            //  the proper program interruption and return false (or nullptr)
+            static uint32_t     _tagOf(uint32_t address, uint32_t accessTag)
+            {
+                return (address >> Storage::BlockShift) | accessTag;
+            }
+            uint32_t            _prefixed(uint32_t realAddress) const
+            {
+                uint32_t page = realAddress & UINT32_C(0x00FFF000);
+                if (page == 0)
+                {
+                    return realAddress | _prefix;
+                }
+                else if (page == _prefix)
+                {
+                    return realAddress & UINT32_C(0x00000FFF);
+                }
+                return realAddress;
+            }
+            uint8_t *           _hostAddress(uint32_t address, unsigned access)
+            {
+                Q_ASSERT((address & ~AddressMask) == 0);
+                const _TlbEntry & entry = _tlb[(address >> Storage::BlockShift) & (_TlbSize - 1)];
+                if (((access == _StoreAccess) ? entry.storeTag : entry.loadTag) == _tagOf(address, _accessTag))
+                {
+                    return entry.hostData + (address & Storage::BlockOffsetMask);
+                }
+                return _translate(address, access);
+            }
+            uint8_t *           _translate(uint32_t address, unsigned access);
+            bool                _accessOperand(uint32_t address, unsigned length, unsigned access, _Operand & operand);
+            void                _invalidateTlb();
+            void                _invalidateStoreTlbEntries();
+
+            //  Dynamic address translation of a logical address to a real
+            //  one; "entryAddress" receives the real address of the last
+            //  table entry used
+            enum class _DatResult
+            {
+                Translated,
+                SegmentTableLength,
+                SegmentInvalid,
+                PageTableLength,
+                PageInvalid,
+                TranslationSpecification,
+                Addressing
+            };
+            _DatResult          _walkTranslationTables(uint32_t address, uint32_t & realAddress, uint32_t & entryAddress);
+            bool                _translateDat(uint32_t address, uint32_t & realAddress);
+
+            //  Helpers (storage access)
+            template <class T>
+            bool                _load(uint32_t address, T & value)
+            {
+                address &= AddressMask;
+                const _TlbEntry & entry = _tlb[(address >> Storage::BlockShift) & (_TlbSize - 1)];
+                uint32_t offset = address & Storage::BlockOffsetMask;
+                if (entry.loadTag == _tagOf(address, _accessTag) && offset <= Storage::BlockSize - sizeof(T))
+                {
+                    if constexpr (sizeof(T) == 1)
+                    {   //  Bytes have no byte order
+                        value = entry.hostData[offset];
+                    }
+                    else
+                    {
+                        value = hadesvm::util::loadUnalignedWithByteOrder<T>(entry.hostData + offset, hadesvm::util::ByteOrder::BigEndian);
+                    }
+                    return true;
+                }
+                return _loadSlow(address, value);
+            }
+
+            template <class T>
+            bool                _store(uint32_t address, T value)
+            {
+                address &= AddressMask;
+                const _TlbEntry & entry = _tlb[(address >> Storage::BlockShift) & (_TlbSize - 1)];
+                uint32_t offset = address & Storage::BlockOffsetMask;
+                if (entry.storeTag == _tagOf(address, _accessTag) && offset <= Storage::BlockSize - sizeof(T))
+                {
+                    if constexpr (sizeof(T) == 1)
+                    {   //  Bytes have no byte order
+                        entry.hostData[offset] = value;
+                    }
+                    else
+                    {
+                        hadesvm::util::storeUnalignedWithByteOrder<T>(entry.hostData + offset, value, hadesvm::util::ByteOrder::BigEndian);
+                    }
+                    return true;
+                }
+                return _storeSlow(address, value);
+            }
+
+            template <class T>
+            bool                _loadSlow(uint32_t address, T & value)
+            {
+                _Operand operand;
+                if (!_accessOperand(address, sizeof(T), _LoadAccess, operand))
+                {
+                    return false;
+                }
+                T result = 0;
+                for (unsigned i = 0; i < sizeof(T); i++)
+                {
+                    result = static_cast<T>((static_cast<uint64_t>(result) << 8) | operand[i]);
+                }
+                value = result;
+                return true;
+            }
+
+            template <class T>
+            bool                _storeSlow(uint32_t address, T value)
+            {
+                _Operand operand;
+                if (!_accessOperand(address, sizeof(T), _StoreAccess, operand))
+                {
+                    return false;
+                }
+                for (unsigned i = sizeof(T); i-- > 0; )
+                {
+                    operand[i] = static_cast<uint8_t>(value);
+                    value = static_cast<T>(static_cast<uint64_t>(value) >> 8);
+                }
+                return true;
+            }
+
+            //  Requires the natural alignment of a "size"-byte operand;
+            //  raises a specification exception and returns false otherwise
+            bool                _checkAlignment(uint32_t address, uint32_t size);
+
+            //  Real storage of the fixed locations, which must be within
+            //  storage (with prefixing, the first 4K always are)
+            uint8_t *           _realStorage(uint32_t realAddress);
+            uint32_t            _loadRealWord(uint32_t realAddress);
+            void                _storeRealWord(uint32_t realAddress, uint32_t value);
+            void                _storeRealHalfWord(uint32_t realAddress, uint16_t value);
+            uint64_t            _loadRealDoubleWord(uint32_t realAddress);
+            void                _storeRealDoubleWord(uint32_t realAddress, uint64_t value);
+
+            //  Helpers (PSW)
+            uint64_t            _pswToDoubleWord(uint16_t interruptionCode, unsigned ilc) const;
+            static bool         _pswFromDoubleWord(uint64_t value, _Psw & psw);
+            void                _setPsw(const _Psw & psw);
+            void                _setSystemMask(uint8_t systemMask);
+            void                _updateAccessTag();
+
+            //  Helpers (interruptions)
+            unsigned            _ilc() const
+            {
+                return ((_psw.instructionAddress - _instructionAddress) & AddressMask) >> 1;
+            }
+            void                _swapPsw(uint32_t oldPswLocation, uint32_t newPswLocation, uint16_t interruptionCode, unsigned ilc);
+            void                _raiseProgramInterruption(ProgramInterruption interruption);
+            void                _raiseSvcInterruption(uint8_t number);
+            bool                _takeExternalInterruption();
+            uint32_t            _enabledExternalInterruptions() const
+            {
+                return ((_psw.systemMask & _ExternalMask) != 0) ? _cr[0] : 0;
+            }
+            //  Raises a privileged operation exception and returns
+            //  false if the CPU is in the problem state
+            bool                _checkSupervisorState();
+
+            //  Helpers (timers)
+            uint64_t            _currentCycles() const
+            {
+                return _sliceEnd - static_cast<uint64_t>(_cyclesLeft);
+            }
+            void                _synchronizeClocks();
+            void                _updateTimerInterruptions();
+            uint64_t            _todUnitsToCycles(uint64_t todUnits) const;
+
+            //  Predecoded instructions. Each handler returns the number of
+            //  clock cycles taken by instruction execution. An interruption
+            //  caused by the instruction is raised by the handler itself (or
+            //  by the storage access helpers it uses), which then returns
+            //  without completing it.
+            struct _DecodedInstruction;
+            typedef unsigned (ProcessorCore::*_InstructionHandler)(const _DecodedInstruction & instruction);
+
+            struct _DecodedInstruction
+            {
+                _InstructionHandler handler;    //  ...with all sub-opcode dispatch resolved
+                const void *    threadedCode;   //  nullptr == not yet threaded (see _runInstructions())
+                uint8_t         opcode;
+                uint8_t         length;     //  ...in bytes
+                uint8_t         i2;         //  2nd byte: I2 (SI), L (SS), I (SVC)...
+                uint8_t         r1;         //  ...or M1 (RX), L1 (SS)...
+                uint8_t         r2;         //  ...or R3 (RS), L2 or I3 (SS)...
+                uint8_t         x2;         //  X2 (RX); 16 for 0
+                uint8_t         b1;         //  B1 (SI, SS); 16 for 0
+                uint8_t         b2;         //  B2 (RX, RS, S, SS); 16 for 0
+                uint16_t        d1;
+                uint16_t        d2;
+            };
+
+            //  Instruction formats and properties, per opcode
+            static const uint8_t    _SiFormat = 0x01;           //  ...as opposed to RS or S among opcodes 80..BF
+            static const uint8_t    _EndsBasicBlock = 0x02;
+
+            struct _OpcodeTableEntry
+            {
+                _InstructionHandler handler;
+                uint8_t         flags;
+            };
+
+            static const _OpcodeTableEntry  _OpcodeTable[256];
+            static const _OpcodeTableEntry  _B2OpcodeTable[256];
+
+            static void         _decodeInstruction(const uint8_t * bytes, _DecodedInstruction & instruction, bool & endsBasicBlock);
+            static unsigned     _instructionLength(uint8_t opcode)
+            {
+                static const uint8_t lengths[4] = { 2, 4, 4, 6 };
+                return lengths[opcode >> 6];
+            }
+
+            //  Basic blocks are cached by absolute address of their first
+            //  instruction; entries of a 2K block's basic blocks occupy
+            //  a contiguous range of the cache, so that dropping them when
+            //  the 2K block is stored into needs not scan the whole cache.
+            //  An instruction that crosses into another 2K block is decoded
+            //  afresh into a basic block of its own whenever it is executed.
+            static const unsigned   _MaxBasicBlockLength = 32;
+            static const size_t     _BasicBlockCacheSize = 2048;    //  must be a power of 2, at least 1024
+            static const uint32_t   _InvalidAddress = UINT32_C(0xFFFFFFFF);
+
+            struct _BasicBlock
+            {
+                uint32_t        absoluteAddress;    //  ...of the 1st instruction; _InvalidAddress == this cache entry is free
+                unsigned        numInstructions;
+                _DecodedInstruction instructions[_MaxBasicBlockLength];
+            };
+
+            _BasicBlock *       _basicBlockCache;   //  array of _BasicBlockCacheSize elements
+            _BasicBlock         _crossingBasicBlock;
+            uint8_t *           _codeBlocks;    //  per 2K block of storage, nonzero == basic blocks were decoded from it
+
+            //  Set when the rest of the current basic block must not be
+            //  executed: an interruption has occurred, or the basic block
+            //  has been dropped
+            bool                _leaveBasicBlock;
+
+            //  Helpers (execution engine)
+            static size_t       _basicBlockIndex(uint32_t absoluteAddress)
+            {
+                return (absoluteAddress >> 1) & (_BasicBlockCacheSize - 1);
+            }
+            //  Runs instructions, a basic block at a time, until the cycles
+            //  of the current runCycles() call are used up, the CPU waits or
+            //  stops, or an enabled external interruption becomes pending
+            void                _runInstructions();
+            //  Returns the basic block that starts at the PSW instruction
+            //  address, or nullptr if the fetch has raised an interruption
+            _BasicBlock *       _enterBasicBlock();
+            void                _decodeBasicBlock(_BasicBlock * basicBlock, uint32_t absoluteAddress);
+            void                _invalidateCode(uint32_t block);
+            void                _invalidateAllBasicBlocks();
+            //  Must be called after storing into absolute storage other
+            //  than via the TLB
+            void                _noteAbsoluteStore(uint32_t absoluteAddress)
+            {
+                if (_codeBlocks[absoluteAddress >> Storage::BlockShift] != 0)
+                {
+                    _invalidateCode(absoluteAddress >> Storage::BlockShift);
+                }
+            }
+
+            //  Helpers (instruction execution)
+            uint32_t            _effectiveAddress(unsigned b, unsigned d) const
+            {
+                return (_gr[b] + d) & AddressMask;
+            }
+            uint32_t            _effectiveAddressRx(const _DecodedInstruction & instruction) const
+            {
+                return (_gr[instruction.x2] + _gr[instruction.b2] + instruction.d2) & AddressMask;
+            }
+            void                _setConditionCode(int32_t result)
+            {
+                _psw.conditionCode = (result == 0) ? 0 : ((result < 0) ? 1 : 2);
+            }
+            //  Sets CC 3 and, if not masked off, raises the exception
+            void                _fixedPointOverflow();
+            void                _decimalOverflow();
+            void                _branch(uint32_t address)
+            {
+                _psw.instructionAddress = address & AddressMask;
+            }
+            uint32_t            _linkInformation() const
+            {
+                return (static_cast<uint32_t>(_ilc()) << 30) |
+                       (static_cast<uint32_t>(_psw.conditionCode) << 28) |
+                       (static_cast<uint32_t>(_psw.programMask) << 24) |
+                       _psw.instructionAddress;
+            }
+            bool                _checkEvenRegister(unsigned r);
+            int                 _compareOperands(const _Operand & op1, const _Operand & op2, unsigned length);
+            void                _executeAdd(unsigned r1, uint32_t op2);
+            void                _executeSubtract(unsigned r1, uint32_t op2);
+            void                _executeAddLogical(unsigned r1, uint32_t op2, uint32_t carry);
+            void                _executeCompare(int32_t op1, int32_t op2);
+            void                _executeCompareLogical(uint32_t op1, uint32_t op2);
+            //  These return false if an exception has been raised
+            bool                _executeMultiply(unsigned r1, uint32_t op2);
+            bool                _executeDivide(unsigned r1, uint32_t op2);
+            unsigned            _executeBranchOnIndex(const _DecodedInstruction & instruction, bool high);
+            unsigned            _executeLogicalSs(const _DecodedInstruction & instruction, uint8_t (*operation)(uint8_t, uint8_t));
+            unsigned            _executeLogicalSi(const _DecodedInstruction & instruction, uint8_t (*operation)(uint8_t, uint8_t));
+
+            //  Helpers (decimal)
+            static const unsigned   _MaxDecimalDigits = 31;
+
+            struct _Decimal
+            {
+                uint8_t         digits[_MaxDecimalDigits + 1];  //  least significant digit first
+                unsigned        numDigits;  //  ...that may be nonzero
+                bool            negative;
+            };
+
+            bool                _loadDecimal(uint32_t address, unsigned length, _Decimal & value);
+            bool                _storeDecimal(uint32_t address, unsigned length, const _Decimal & value, bool & overflow);
+            static bool         _isZero(const _Decimal & value);
+            static int          _compareMagnitudes(const _Decimal & a, const _Decimal & b);
+            static void         _addDecimal(const _Decimal & a, const _Decimal & b, _Decimal & result);
+            void                _setDecimalConditionCode(const _Decimal & result, bool overflow);
+            unsigned            _executeDecimalAddition(const _DecodedInstruction & instruction, bool subtract);
+            unsigned            _executeEdit(const _DecodedInstruction & instruction, bool markSignificance);
+
+            //  Helpers (floating point)
+            bool                _checkFloatingPointRegister(unsigned r);
+            bool                _checkExtendedRegister(unsigned r);
+            uint32_t            _shortRegister(unsigned r) const { return static_cast<uint32_t>(_fpr[r] >> 32); }
+            void                _setShortRegister(unsigned r, uint32_t value)
+            {
+                _fpr[r] = (static_cast<uint64_t>(value) << 32) | (_fpr[r] & UINT64_C(0x00000000FFFFFFFF));
+            }
+            hadesvm::ibmhfp::Extended   _extendedRegister(unsigned r) const;
+            void                _setExtendedRegister(unsigned r, const hadesvm::ibmhfp::Extended & value);
+            void                _setFloatingPointConditionCode(bool zero, bool negative)
+            {
+                _psw.conditionCode = zero ? 0 : (negative ? 1 : 2);
+            }
+            //  A masked-off exponent underflow makes the result a true zero;
+            //  the exceptions that do interrupt are raised after the result
+            //  has been stored, as the operations complete
+            bool                _maskedUnderflow(const hadesvm::ibmhfp::Environment & env) const
+            {
+                return env.underflow && (_psw.programMask & _ExponentUnderflowMask) == 0;
+            }
+            void                _raiseFloatingPointExceptions(const hadesvm::ibmhfp::Environment & env);
+            void                _executeShort(unsigned r1, uint32_t op2,
+                                              uint32_t (*operation)(uint32_t, uint32_t, hadesvm::ibmhfp::Environment &),
+                                              bool setConditionCode);
+            void                _executeLong(unsigned r1, uint64_t op2,
+                                             uint64_t (*operation)(uint64_t, uint64_t, hadesvm::ibmhfp::Environment &),
+                                             bool setConditionCode);
+            void                _executeCompareShort(uint32_t op1, uint32_t op2);
+            void                _executeCompareLong(uint64_t op1, uint64_t op2);
+            void                _executeMultiplyShort(unsigned r1, uint32_t op2);
+            void                _executeMultiplyLongToExtended(unsigned r1, uint64_t op2);
+
+            //  Instruction handlers - general
+            unsigned            _handleInvalid(const _DecodedInstruction & instruction);
+            unsigned            _handleSPM(const _DecodedInstruction & instruction);
+            unsigned            _handleBALR(const _DecodedInstruction & instruction);
+            unsigned            _handleBCTR(const _DecodedInstruction & instruction);
+            unsigned            _handleBCR(const _DecodedInstruction & instruction);
+            unsigned            _handleBASR(const _DecodedInstruction & instruction);
+            unsigned            _handleMVCL(const _DecodedInstruction & instruction);
+            unsigned            _handleCLCL(const _DecodedInstruction & instruction);
+            unsigned            _handleLPR(const _DecodedInstruction & instruction);
+            unsigned            _handleLNR(const _DecodedInstruction & instruction);
+            unsigned            _handleLTR(const _DecodedInstruction & instruction);
+            unsigned            _handleLCR(const _DecodedInstruction & instruction);
+            unsigned            _handleNR(const _DecodedInstruction & instruction);
+            unsigned            _handleCLR(const _DecodedInstruction & instruction);
+            unsigned            _handleOR(const _DecodedInstruction & instruction);
+            unsigned            _handleXR(const _DecodedInstruction & instruction);
+            unsigned            _handleLR(const _DecodedInstruction & instruction);
+            unsigned            _handleCR(const _DecodedInstruction & instruction);
+            unsigned            _handleAR(const _DecodedInstruction & instruction);
+            unsigned            _handleSR(const _DecodedInstruction & instruction);
+            unsigned            _handleMR(const _DecodedInstruction & instruction);
+            unsigned            _handleDR(const _DecodedInstruction & instruction);
+            unsigned            _handleALR(const _DecodedInstruction & instruction);
+            unsigned            _handleSLR(const _DecodedInstruction & instruction);
+            unsigned            _handleSTH(const _DecodedInstruction & instruction);
+            unsigned            _handleLA(const _DecodedInstruction & instruction);
+            unsigned            _handleSTC(const _DecodedInstruction & instruction);
+            unsigned            _handleIC(const _DecodedInstruction & instruction);
+            unsigned            _handleEX(const _DecodedInstruction & instruction);
+            unsigned            _handleBAL(const _DecodedInstruction & instruction);
+            unsigned            _handleBCT(const _DecodedInstruction & instruction);
+            unsigned            _handleBC(const _DecodedInstruction & instruction);
+            unsigned            _handleLH(const _DecodedInstruction & instruction);
+            unsigned            _handleCH(const _DecodedInstruction & instruction);
+            unsigned            _handleAH(const _DecodedInstruction & instruction);
+            unsigned            _handleSH(const _DecodedInstruction & instruction);
+            unsigned            _handleMH(const _DecodedInstruction & instruction);
+            unsigned            _handleBAS(const _DecodedInstruction & instruction);
+            unsigned            _handleST(const _DecodedInstruction & instruction);
+            unsigned            _handleN(const _DecodedInstruction & instruction);
+            unsigned            _handleCL(const _DecodedInstruction & instruction);
+            unsigned            _handleO(const _DecodedInstruction & instruction);
+            unsigned            _handleX(const _DecodedInstruction & instruction);
+            unsigned            _handleL(const _DecodedInstruction & instruction);
+            unsigned            _handleC(const _DecodedInstruction & instruction);
+            unsigned            _handleA(const _DecodedInstruction & instruction);
+            unsigned            _handleS(const _DecodedInstruction & instruction);
+            unsigned            _handleM(const _DecodedInstruction & instruction);
+            unsigned            _handleD(const _DecodedInstruction & instruction);
+            unsigned            _handleAL(const _DecodedInstruction & instruction);
+            unsigned            _handleSL(const _DecodedInstruction & instruction);
+            unsigned            _handleBXH(const _DecodedInstruction & instruction);
+            unsigned            _handleBXLE(const _DecodedInstruction & instruction);
+            unsigned            _handleSRL(const _DecodedInstruction & instruction);
+            unsigned            _handleSLL(const _DecodedInstruction & instruction);
+            unsigned            _handleSRA(const _DecodedInstruction & instruction);
+            unsigned            _handleSLA(const _DecodedInstruction & instruction);
+            unsigned            _handleSRDL(const _DecodedInstruction & instruction);
+            unsigned            _handleSLDL(const _DecodedInstruction & instruction);
+            unsigned            _handleSRDA(const _DecodedInstruction & instruction);
+            unsigned            _handleSLDA(const _DecodedInstruction & instruction);
+            unsigned            _handleSTM(const _DecodedInstruction & instruction);
+            unsigned            _handleTM(const _DecodedInstruction & instruction);
+            unsigned            _handleMVI(const _DecodedInstruction & instruction);
+            unsigned            _handleTS(const _DecodedInstruction & instruction);
+            unsigned            _handleNI(const _DecodedInstruction & instruction);
+            unsigned            _handleCLI(const _DecodedInstruction & instruction);
+            unsigned            _handleOI(const _DecodedInstruction & instruction);
+            unsigned            _handleXI(const _DecodedInstruction & instruction);
+            unsigned            _handleLM(const _DecodedInstruction & instruction);
+            unsigned            _handleCS(const _DecodedInstruction & instruction);
+            unsigned            _handleCDS(const _DecodedInstruction & instruction);
+            unsigned            _handleCLM(const _DecodedInstruction & instruction);
+            unsigned            _handleSTCM(const _DecodedInstruction & instruction);
+            unsigned            _handleICM(const _DecodedInstruction & instruction);
+            unsigned            _handleMVN(const _DecodedInstruction & instruction);
+            unsigned            _handleMVC(const _DecodedInstruction & instruction);
+            unsigned            _handleMVZ(const _DecodedInstruction & instruction);
+            unsigned            _handleNC(const _DecodedInstruction & instruction);
+            unsigned            _handleCLC(const _DecodedInstruction & instruction);
+            unsigned            _handleOC(const _DecodedInstruction & instruction);
+            unsigned            _handleXC(const _DecodedInstruction & instruction);
+            unsigned            _handleTR(const _DecodedInstruction & instruction);
+            unsigned            _handleTRT(const _DecodedInstruction & instruction);
+
+            //  Instruction handlers - decimal
+            unsigned            _handleCVD(const _DecodedInstruction & instruction);
+            unsigned            _handleCVB(const _DecodedInstruction & instruction);
+            unsigned            _handleED(const _DecodedInstruction & instruction);
+            unsigned            _handleEDMK(const _DecodedInstruction & instruction);
+            unsigned            _handleSRP(const _DecodedInstruction & instruction);
+            unsigned            _handleMVO(const _DecodedInstruction & instruction);
+            unsigned            _handlePACK(const _DecodedInstruction & instruction);
+            unsigned            _handleUNPK(const _DecodedInstruction & instruction);
+            unsigned            _handleZAP(const _DecodedInstruction & instruction);
+            unsigned            _handleCP(const _DecodedInstruction & instruction);
+            unsigned            _handleAP(const _DecodedInstruction & instruction);
+            unsigned            _handleSP(const _DecodedInstruction & instruction);
+            unsigned            _handleMP(const _DecodedInstruction & instruction);
+            unsigned            _handleDP(const _DecodedInstruction & instruction);
+
+            //  Instruction handlers - floating point
+            unsigned            _handleLPDR(const _DecodedInstruction & instruction);
+            unsigned            _handleLNDR(const _DecodedInstruction & instruction);
+            unsigned            _handleLTDR(const _DecodedInstruction & instruction);
+            unsigned            _handleLCDR(const _DecodedInstruction & instruction);
+            unsigned            _handleHDR(const _DecodedInstruction & instruction);
+            unsigned            _handleLRDR(const _DecodedInstruction & instruction);
+            unsigned            _handleMXR(const _DecodedInstruction & instruction);
+            unsigned            _handleMXDR(const _DecodedInstruction & instruction);
+            unsigned            _handleLDR(const _DecodedInstruction & instruction);
+            unsigned            _handleCDR(const _DecodedInstruction & instruction);
+            unsigned            _handleADR(const _DecodedInstruction & instruction);
+            unsigned            _handleSDR(const _DecodedInstruction & instruction);
+            unsigned            _handleMDR(const _DecodedInstruction & instruction);
+            unsigned            _handleDDR(const _DecodedInstruction & instruction);
+            unsigned            _handleAWR(const _DecodedInstruction & instruction);
+            unsigned            _handleSWR(const _DecodedInstruction & instruction);
+            unsigned            _handleLPER(const _DecodedInstruction & instruction);
+            unsigned            _handleLNER(const _DecodedInstruction & instruction);
+            unsigned            _handleLTER(const _DecodedInstruction & instruction);
+            unsigned            _handleLCER(const _DecodedInstruction & instruction);
+            unsigned            _handleHER(const _DecodedInstruction & instruction);
+            unsigned            _handleLRER(const _DecodedInstruction & instruction);
+            unsigned            _handleAXR(const _DecodedInstruction & instruction);
+            unsigned            _handleSXR(const _DecodedInstruction & instruction);
+            unsigned            _handleLER(const _DecodedInstruction & instruction);
+            unsigned            _handleCER(const _DecodedInstruction & instruction);
+            unsigned            _handleAER(const _DecodedInstruction & instruction);
+            unsigned            _handleSER(const _DecodedInstruction & instruction);
+            unsigned            _handleMER(const _DecodedInstruction & instruction);
+            unsigned            _handleDER(const _DecodedInstruction & instruction);
+            unsigned            _handleAUR(const _DecodedInstruction & instruction);
+            unsigned            _handleSUR(const _DecodedInstruction & instruction);
+            unsigned            _handleSTD(const _DecodedInstruction & instruction);
+            unsigned            _handleMXD(const _DecodedInstruction & instruction);
+            unsigned            _handleLD(const _DecodedInstruction & instruction);
+            unsigned            _handleCD(const _DecodedInstruction & instruction);
+            unsigned            _handleAD(const _DecodedInstruction & instruction);
+            unsigned            _handleSD(const _DecodedInstruction & instruction);
+            unsigned            _handleMD(const _DecodedInstruction & instruction);
+            unsigned            _handleDD(const _DecodedInstruction & instruction);
+            unsigned            _handleAW(const _DecodedInstruction & instruction);
+            unsigned            _handleSW(const _DecodedInstruction & instruction);
+            unsigned            _handleSTE(const _DecodedInstruction & instruction);
+            unsigned            _handleLE(const _DecodedInstruction & instruction);
+            unsigned            _handleCE(const _DecodedInstruction & instruction);
+            unsigned            _handleAE(const _DecodedInstruction & instruction);
+            unsigned            _handleSE(const _DecodedInstruction & instruction);
+            unsigned            _handleME(const _DecodedInstruction & instruction);
+            unsigned            _handleDE(const _DecodedInstruction & instruction);
+            unsigned            _handleAU(const _DecodedInstruction & instruction);
+            unsigned            _handleSU(const _DecodedInstruction & instruction);
+
+            //  Instruction handlers - control
+            unsigned            _handleSSK(const _DecodedInstruction & instruction);
+            unsigned            _handleISK(const _DecodedInstruction & instruction);
+            unsigned            _handleSVC(const _DecodedInstruction & instruction);
+            unsigned            _handleSSM(const _DecodedInstruction & instruction);
+            unsigned            _handleLPSW(const _DecodedInstruction & instruction);
+            unsigned            _handleDIAGNOSE(const _DecodedInstruction & instruction);
+            unsigned            _handleWRD(const _DecodedInstruction & instruction);
+            unsigned            _handleRDD(const _DecodedInstruction & instruction);
+            unsigned            _handleIO(const _DecodedInstruction & instruction);
+            unsigned            _handleSTNSM(const _DecodedInstruction & instruction);
+            unsigned            _handleSTOSM(const _DecodedInstruction & instruction);
+            unsigned            _handleSIGP(const _DecodedInstruction & instruction);
+            unsigned            _handleMC(const _DecodedInstruction & instruction);
+            unsigned            _handleLRA(const _DecodedInstruction & instruction);
+            unsigned            _handleSTCTL(const _DecodedInstruction & instruction);
+            unsigned            _handleLCTL(const _DecodedInstruction & instruction);
+            unsigned            _handleSTIDP(const _DecodedInstruction & instruction);
+            unsigned            _handleSCK(const _DecodedInstruction & instruction);
+            unsigned            _handleSTCK(const _DecodedInstruction & instruction);
+            unsigned            _handleSCKC(const _DecodedInstruction & instruction);
+            unsigned            _handleSTCKC(const _DecodedInstruction & instruction);
+            unsigned            _handleSPT(const _DecodedInstruction & instruction);
+            unsigned            _handleSTPT(const _DecodedInstruction & instruction);
+            unsigned            _handleSPKA(const _DecodedInstruction & instruction);
+            unsigned            _handleIPK(const _DecodedInstruction & instruction);
+            unsigned            _handlePTLB(const _DecodedInstruction & instruction);
+            unsigned            _handleSPX(const _DecodedInstruction & instruction);
+            unsigned            _handleSTPX(const _DecodedInstruction & instruction);
+            unsigned            _handleSTAP(const _DecodedInstruction & instruction);
+            unsigned            _handleRRB(const _DecodedInstruction & instruction);
+        };
+    }
+}
+
+//  End of hadesvm-ibm3x0/ProcessorCore.hpp
@@ -0,0 +1,47 @@
+//
+//  hadesvm-ibm3x0/Storage.cpp
+//
+//  hadesvm::ibm3x0::Storage class implementation
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+//////////
+//  Construction/destruction
+Storage::Storage(uint32_t size)
+    :   _size(size),
+        _data(new uint8_t[size]),
+        _keys(new uint8_t[size >> BlockShift])
+{
+    Q_ASSERT(size > 0 && size <= MaxSize && (size & BlockOffsetMask) == 0);
+
+    clear();
+}
+
+Storage::~Storage() noexcept
+{
+    delete [] _data;
+    delete [] _keys;
+}
+
+//////////
+//  Operations
+void Storage::clear()
+{
+    memset(_data, 0, _size);
+    memset(_keys, 0, _size >> BlockShift);
+}
+
+bool Storage::load(const QString & fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {   //  OOPS!
+        return false;
+    }
+    qint64 bytesRead = file.read(reinterpret_cast<char*>(_data), _size);
+    return bytesRead >= 0;
+}
+
+//  End of hadesvm-ibm3x0/Storage.cpp
@@ -0,0 +1,185 @@
+//
+//  hadesvm-ibm3x0/Storage.hpp
+//
+//  IBM System/370 main storage
+//
+//////////
+
+namespace hadesvm
+{
+    namespace ibm3x0
+    {
+        //////////
+        //  The content of main storage: the bytes, addressed by absolute
+        //  addresses, and a storage key for each 2K block of them.
+        //  Storage is big-endian; multi-byte values are accessed with
+        //  hadesvm::util::loadUnalignedWithByteOrder() and friends.
+        class HADESVM_IBM3X0_PUBLIC Storage final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Storage)
+
+            //////////
+            //  Constants
+        public:
+            //  Storage keys protect (and record references to) 2K blocks
+            static const unsigned   BlockShift = 11;
+            static const uint32_t   BlockSize = UINT32_C(1) << BlockShift;
+            static const uint32_t   BlockOffsetMask = BlockSize - 1;
+
+            //  24-bit addressing limits storage to 16M
+            static const uint32_t   MaxSize = UINT32_C(0x01000000);
+
+            //  The bits of a storage key
+            static const uint8_t    AccessControlMask = 0xF0;
+            static const uint8_t    FetchProtectionMask = 0x08;
+            static const uint8_t    ReferenceMask = 0x04;
+            static const uint8_t    ChangeMask = 0x02;
+            static const uint8_t    KeyMask = 0xFE;
+
+            //////////
+            //  Construction/destruction
+        public:
+            //  The "size" must be a nonzero multiple of BlockSize not above MaxSize
+            explicit Storage(uint32_t size);
+            ~Storage() noexcept;
+
+            //////////
+            //  Operations
+        public:
+            uint32_t            size() const { return _size; }
+            uint8_t *           data() { return _data; }
+            const uint8_t *     data() const { return _data; }
+
+            //  The storage key of the block that contains the specified
+            //  absolute address, which must be below size()
+            uint8_t &           key(uint32_t address) { return _keys[address >> BlockShift]; }
+            uint8_t             key(uint32_t address) const { return _keys[address >> BlockShift]; }
+            uint8_t *           keys() { return _keys; }
+            const uint8_t *     keys() const { return _keys; }
+            uint32_t            numBlocks() const { return _size >> BlockShift; }
+
+            //  Zeroes all bytes and storage keys
+            void                clear();
+
+            //  Loads storage with the content of the specified file,
+            //  starting at absolute address 0; content that doesn't fit
+            //  into storage is ignored. Returns false if the file can't be read.
+            bool                load(const QString & fileName);
+
+            //////////
+            //  Implementation
+        private:
+            const uint32_t      _size;
+            uint8_t *const      _data;  //  array of _size bytes
+            uint8_t *const      _keys;  //  array of _size >> BlockShift storage keys
+        };
+
+        //////////
+        //  The main storage component; an image file, if any, is loaded
+        //  at absolute address 0 when the VM starts, so that it begins
+        //  with the IPL PSW (see Processor)
+        class HADESVM_IBM3X0_PUBLIC MainStorage final : public hadesvm::core::Component,
+                                                        public virtual hadesvm::core::ISnapshotComponent
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(MainStorage)
+
+            //////////
+            //  Constants
+        public:
+            static const hadesvm::core::MemorySize  DefaultSize;
+            static const QString    DefaultImageFilePath;
+
+            //////////
+            //  Types
+        public:
+            //  The type of main storage
+            class HADESVM_IBM3X0_PUBLIC Type final : public hadesvm::core::ComponentType
+            {
+                HADESVM_DECLARE_SINGLETON(Type)
+
+                //////////
+                //  hadesvm::util::StockObject
+            public:
+                virtual QString     mnemonic() const override;
+                virtual QString     displayName() const override;
+
+                //////////
+                //  hadesvm::core::ComponentType
+            public:
+                virtual hadesvm::core::ComponentCategory *
+                                    category() const override;
+                virtual bool        isCompatibleWith(hadesvm::core::VirtualArchitecture * architecture) const override;
+                virtual bool        isCompatibleWith(hadesvm::core::VirtualApplianceType * type) const override;
+                virtual MainStorage *
+                                    createComponent() override;
+            };
+
+            //////////
+            //  Construction/destruction
+        public:
+            MainStorage();
+            virtual ~MainStorage() noexcept;
+
+            //////////
+            //  hadesvm::core::Component
+        public:
+            virtual Type *          componentType() const override { return Type::instance(); }
+            virtual QString         displayName() const override;
+            virtual void            serialiseConfiguration(QDomElement componentElement) const override;
+            virtual void            deserialiseConfiguration(QDomElement componentElement) override;
+            virtual hadesvm::core::ComponentEditor *    createEditor() override;
+            virtual Ui *            createUi() override;
+
+            //////////
+            //  hadesvm::core::Component (state management)
+            //  Must only be called from the QApplication's main thread (except state())
+        public:
+            virtual State           state() const noexcept override { return _state; }
+            virtual void            connect() throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            initialize() throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            start() throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            stop() noexcept override;
+            virtual void            deinitialize() noexcept override;
+            virtual void            disconnect() noexcept override;
+            virtual void            reset() noexcept override;
+
+            //////////
+            //  hadesvm::core::ISnapshotComponent
+        public:
+            virtual void            saveSnapshot(hadesvm::core::SnapshotWriter & writer) throws(hadesvm::core::VirtualApplianceException) override;
+            virtual void            restoreSnapshot(hadesvm::core::SnapshotReader & reader) throws(hadesvm::core::VirtualApplianceException) override;
+
+            //////////
+            //  Operations
+        public:
+            //  The content of main storage; nullptr unless connected
+            Storage *               storage() const { return _storage; }
+
+            //////////
+            //  Operations (configuration)
+        public:
+            hadesvm::core::MemorySize   size() const { return _size; }
+            void                    setSize(const hadesvm::core::MemorySize & size);
+            QString                 imageFilePath() const { return _imageFilePath; }
+            void                    setImageFilePath(const QString & imageFilePath);
+
+            //////////
+            //  Implementation
+        private:
+            State                   _state = State::Constructed;
+
+            //  Configuration
+            hadesvm::core::MemorySize   _size;
+            QString                 _imageFilePath; //  if relative, uses VM location dir as root; empty == none
+
+            //  Runtime state
+            Storage *               _storage = nullptr; //  created when connected
+
+            //  Helpers
+            static bool             _isValidSize(const hadesvm::core::MemorySize & size);
+            void                    _loadImage() throws(hadesvm::core::VirtualApplianceException);
+        };
+    }
+}
+
+//  End of hadesvm-ibm3x0/Storage.hpp
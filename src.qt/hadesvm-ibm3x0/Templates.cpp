@@ -0,0 +1,40 @@
+//
+//  hadesvm-ibm3x0/Templates.cpp
+//
+//  hadesvm::ibm3x0 VA templates
+//
+//////////
+#include "hadesvm-ibm3x0/API.hpp"
+using namespace hadesvm::ibm3x0;
+
+//////////
+//  Singleton
+HADESVM_IMPLEMENT_SINGLETON(Ibm370UniprocessorTemplate)
+Ibm370UniprocessorTemplate::Ibm370UniprocessorTemplate() {}
+Ibm370UniprocessorTemplate::~Ibm370UniprocessorTemplate() {}
+
+//////////
+//  hadesvm::util::StockObject
+QString Ibm370UniprocessorTemplate::mnemonic() const
+{
+    return "Ibm370Uniprocessor";
+}
+
+QString Ibm370UniprocessorTemplate::displayName() const
+{
+    return "IBM System/370 uniprocessor";
+}
+
+//////////
+//  hadesvm::core::VirtualApplianceTemplate
+hadesvm::core::VirtualApplianceType * Ibm370UniprocessorTemplate::virtualApplianceType() const
+{
+    return hadesvm::core::VirtualMachineType::instance();
+}
+
+Ibm370Architecture * Ibm370UniprocessorTemplate::virtualArchitecture() const
+{
+    return Ibm370Architecture::instance();
+}
+
+//  End of hadesvm-ibm3x0/Templates.cpp
@@ -0,0 +1,33 @@
+//
+//  hadesvm-ibm3x0/Templates.hpp
+//
+//  IBM System/3x0-based VA templates
+//
+//////////
+
+namespace hadesvm
+{
+    namespace ibm3x0
+    {
+        //////////
+        //  The "IBM System/370 Uniprocessor" VM template
+        class HADESVM_IBM3X0_PUBLIC Ibm370UniprocessorTemplate final : public hadesvm::core::VirtualApplianceTemplate
+        {
+            HADESVM_DECLARE_SINGLETON(Ibm370UniprocessorTemplate)
+
+            //////////
+            //  hadesvm::util::StockObject
+        public:
+            virtual QString     mnemonic() const override;
+            virtual QString     displayName() const override;
+
+            //////////
+            //  hadesvm::core::VirtualApplianceTemplate
+        public:
+            virtual hadesvm::core::VirtualApplianceType *   virtualApplianceType() const override;
+            virtual Ibm370Architecture *                    virtualArchitecture() const override;
+        };
+    }
+}
+
+//  End of hadesvm-ibm3x0/Templates.hpp
@@ -4,8 +4,28 @@ TEMPLATE = lib
 DEFINES += HADESVM_IBM3X0_LIBRARY
 
 SOURCES += \
-    hadesvmibm3x0.cpp
+    Architectures.cpp \
+    MainStorage.cpp \
+    Plugins.cpp \
+    Processor.cpp \
+    ProcessorCore.Control.cpp \
+    ProcessorCore.Decimal.cpp \
+    ProcessorCore.Engine.cpp \
+    ProcessorCore.FloatingPoint.cpp \
+    ProcessorCore.General.cpp \
+    ProcessorCore.Storage.cpp \
+    ProcessorCore.cpp \
+    Storage.cpp \
+    Templates.cpp
 
 HEADERS += \
-    hadesvm-ibm3x0_global.h \
-    hadesvmibm3x0.h
+    API.hpp \
+    Architectures.hpp \
+    Classes.hpp \
+    Linkage.hpp \
+    Processor.hpp \
+    ProcessorCore.hpp \
+    Storage.hpp \
+    Templates.hpp
+
+LIBS += -L$$DESTDIR -lhadesvm-ibmhfp -lhadesvm-core -lhadesvm-util
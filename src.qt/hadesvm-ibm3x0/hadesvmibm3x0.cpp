@@ -1,3 +0,0 @@
-#include "hadesvmibm3x0.h"
-
-Hadesvmibm3x0::Hadesvmibm3x0() {}
@@ -1,12 +0,0 @@
-#ifndef HADESVMIBM3X0_H
-#define HADESVMIBM3X0_H
-
-#include "hadesvm-ibm3x0_global.h"
-
-class HADESVM_IBM3X0_EXPORT Hadesvmibm3x0
-{
-public:
-    Hadesvmibm3x0();
-};
-
-#endif // HADESVMIBM3X0_H
@@ -5,268 +5,645 @@
 //
 //////////
 #include "hadesvm-ibmhfp/API.hpp"
+#include "hadesvm-ibmhfp/UInt128.hxx"
 using namespace hadesvm::ibmhfp;
 
-//////////
-//  Helpers
-static uint64_t _constructValue(int sign, int exponent, uint64_t mantissa, Environment & env)
+namespace
 {
-    if (mantissa == 0)
+    //////////
+    //  HFP formats. A fraction is kept right-aligned in an integer wide
+    //  enough for it, an extra (guard) digit and a carry digit.
+    struct ShortFormat
     {
-        return 0;
+        using Fraction = uint64_t;
+        static const int Digits = 6;
+    };
+
+    struct LongFormat
+    {
+        using Fraction = uint64_t;
+        static const int Digits = 14;
+    };
+
+    struct ExtendedFormat
+    {
+        using Fraction = UInt128;
+        static const int Digits = 28;
+    };
+
+    //  An unpacked HFP value:
+    //  value == +/- (fraction / 16**Digits) * 16**(characteristic - 64)
+    template <class Format>
+    struct Value
+    {
+        int                         sign;
+        int                         characteristic;
+        typename Format::Fraction   fraction;
+    };
+
+    int countLeadingZeroBits(uint64_t fraction)
+    {
+        return static_cast<int>(qCountLeadingZeroBits(fraction));
     }
-    while ((mantissa & 0xFF00000000000000) != 0)
+
+    int countLeadingZeroBits(const UInt128 & fraction)
     {
-        mantissa >>= 4;
-        exponent++;
+        return fraction.countLeadingZeroBits();
     }
-    while ((mantissa & 0x00F0000000000000) == 0)
+
+    //////////
+    //  Packing & unpacking
+    Value<ShortFormat> unpack32(uint32_t a)
     {
-        mantissa <<= 4;
-        exponent--;
+        return Value<ShortFormat> { static_cast<int>(a >> 31),
+                                    static_cast<int>((a >> 24) & 0x7F),
+                                    a & 0x00FFFFFF };
     }
 
-    //  Form the result
-    if (exponent < -64 - 14)
-    {   //  Underflow
-        env.underflow = true;
+    uint32_t pack32(const Value<ShortFormat> & a)
+    {
+        return (static_cast<uint32_t>(a.sign) << 31) |
+               (static_cast<uint32_t>(a.characteristic) << 24) |
+               static_cast<uint32_t>(a.fraction);
     }
-    if (exponent > 63 - 14)
-    {   //  Positive infinity
-        env.overflow = true;
+
+    Value<LongFormat> unpack64(uint64_t a)
+    {
+        return Value<LongFormat> { static_cast<int>(a >> 63),
+                                   static_cast<int>((a >> 56) & 0x7F),
+                                   a & UINT64_C(0x00FFFFFFFFFFFFFF) };
+    }
+
+    uint64_t pack64(const Value<LongFormat> & a)
+    {
+        return (static_cast<uint64_t>(a.sign) << 63) |
+               (static_cast<uint64_t>(a.characteristic) << 56) |
+               a.fraction;
+    }
+
+    Value<ExtendedFormat> unpack128(const Extended & a)
+    {   //  The sign and characteristic of the low-order part are ignored
+        return Value<ExtendedFormat> { static_cast<int>(a.high >> 63),
+                                       static_cast<int>((a.high >> 56) & 0x7F),
+                                       UInt128((a.high & UINT64_C(0x00FFFFFFFFFFFFFF)) >> 8,
+                                               (a.high << 56) | (a.low & UINT64_C(0x00FFFFFFFFFFFFFF))) };
+    }
+
+    Extended pack128(const Value<ExtendedFormat> & a)
+    {
+        Extended result;
+        if (a.fraction == UInt128())
+        {   //  A true zero
+            return result;
+        }
+        result.high = (static_cast<uint64_t>(a.sign) << 63) |
+                      (static_cast<uint64_t>(a.characteristic) << 56) |
+                      (a.fraction >> 56).low;
+        result.low = (static_cast<uint64_t>(a.sign) << 63) |
+                     (static_cast<uint64_t>((a.characteristic - 14) & 0x7F) << 56) |
+                     (a.fraction.low & UINT64_C(0x00FFFFFFFFFFFFFF));
+        return result;
+    }
+
+    //////////
+    //  Helpers
+    template <class Format>
+    Value<Format> trueZero()
+    {
+        return Value<Format> { 0, 0, typename Format::Fraction() };
+    }
+
+    //  Shifts a nonzero fraction left until its leftmost digit is nonzero
+    template <class Format>
+    void prenormalize(Value<Format> & a)
+    {
+        int zeroDigits = (countLeadingZeroBits(a.fraction) -
+                          (static_cast<int>(sizeof(typename Format::Fraction)) * 8 - 4 * Format::Digits)) / 4;
+        a.fraction = a.fraction << (4 * zeroDigits);
+        a.characteristic -= zeroDigits;
+    }
+
+    //  Normalizes and truncates an intermediate result fraction of
+    //  Digits + 1 digits (the rightmost one being the guard digit),
+    //  recognizing exponent overflow and underflow; as the hardware does
+    //  when the interruption is taken, the characteristic wraps around.
+    template <class Format>
+    Value<Format> build(Environment & env, int sign, int characteristic, typename Format::Fraction fraction)
+    {
+        if (fraction == typename Format::Fraction())
+        {
+            return trueZero<Format>();
+        }
+        int zeroDigits = (countLeadingZeroBits(fraction) -
+                          (static_cast<int>(sizeof(typename Format::Fraction)) * 8 - 4 * (Format::Digits + 1))) / 4;
+        fraction = (fraction << (4 * zeroDigits)) >> 4;
+        characteristic -= zeroDigits;
+
+        if (characteristic > 127)
+        {
+            env.overflow = true;
+        }
+        else if (characteristic < 0)
+        {
+            env.underflow = true;
+        }
+        return Value<Format> { sign, characteristic & 0x7F, fraction };
+    }
+
+    //////////
+    //  Kernels
+    //  Forms the intermediate sum the way the hardware does: the fraction
+    //  with the smaller characteristic is shifted right, keeping one guard
+    //  digit, and the fractions are then added or subtracted exactly. The
+    //  result has Digits + 1 digits and, for a sum, maybe a carry digit.
+    template <class Format>
+    void intermediateSum(const Value<Format> & a, const Value<Format> & b,
+                         int & sign, int & characteristic, typename Format::Fraction & fraction)
+    {
+        using Fraction = typename Format::Fraction;
+
+        characteristic = qMax(a.characteristic, b.characteristic);
+        int aShift = characteristic - a.characteristic, bShift = characteristic - b.characteristic;
+        Fraction aFraction = (aShift > Format::Digits) ? Fraction() : ((a.fraction << 4) >> (4 * aShift));
+        Fraction bFraction = (bShift > Format::Digits) ? Fraction() : ((b.fraction << 4) >> (4 * bShift));
+        if (a.sign == b.sign)
+        {   //  Adding values of the same sign
+            sign = a.sign;
+            fraction = aFraction + bFraction;
+        }
+        else if (aFraction >= bFraction)
+        {   //  Keep sign of A
+            sign = a.sign;
+            fraction = aFraction - bFraction;
+        }
+        else
+        {   //  Reverse sign of A
+            sign = b.sign;
+            fraction = bFraction - aFraction;
+        }
+    }
+
+    template <class Format>
+    Value<Format> add(Environment & env, const Value<Format> & a, const Value<Format> & b)
+    {
+        using Fraction = typename Format::Fraction;
+
+        int sign, characteristic;
+        Fraction fraction;
+        intermediateSum(a, b, sign, characteristic, fraction);
+        if (fraction == Fraction())
+        {   //  A zero result fraction is a significance exception
+            env.significance = true;
+            return trueZero<Format>();
+        }
+        if ((fraction >> (4 * (Format::Digits + 1))) != Fraction())
+        {   //  Carry out of the leftmost digit
+            fraction = fraction >> 4;
+            characteristic++;
+        }
+        return build<Format>(env, sign, characteristic, fraction);
+    }
+
+    //  As add(), but the intermediate sum is truncated to Digits digits
+    //  without normalization, and so can't underflow
+    template <class Format>
+    Value<Format> addUnnormalized(Environment & env, const Value<Format> & a, const Value<Format> & b)
+    {
+        using Fraction = typename Format::Fraction;
+
+        int sign, characteristic;
+        Fraction fraction;
+        intermediateSum(a, b, sign, characteristic, fraction);
+        if ((fraction >> (4 * (Format::Digits + 1))) != Fraction())
+        {   //  Carry out of the leftmost digit
+            fraction = fraction >> 4;
+            if (++characteristic > 127)
+            {
+                env.overflow = true;
+                characteristic &= 0x7F;
+            }
+        }
+        fraction = fraction >> 4;
+        if (fraction == Fraction())
+        {
+            env.significance = true;
+            return trueZero<Format>();
+        }
+        return Value<Format> { sign, characteristic, fraction };
+    }
+
+    template <class Format>
+    Value<Format> negate(Value<Format> a)
+    {
+        a.sign ^= 1;
+        return a;
+    }
+
+    template <class Format>
+    int compare(const Value<Format> & a, const Value<Format> & b)
+    {   //  Compared as by subtraction, but no exceptions are recognized
+        using Fraction = typename Format::Fraction;
+
+        int sign, characteristic;
+        Fraction fraction;
+        intermediateSum(a, negate(b), sign, characteristic, fraction);
+        if (fraction == Fraction())
+        {
+            return 0;
+        }
+        return (sign != 0) ? -1 : 1;
+    }
+
+    //  The products have at most one leading zero digit, which is why one
+    //  digit beyond the result's ones is enough to normalize them exactly
+    Value<ShortFormat> multiply(Environment & env, Value<ShortFormat> a, Value<ShortFormat> b)
+    {
+        if (a.fraction == 0 || b.fraction == 0)
+        {
+            return trueZero<ShortFormat>();
+        }
+        prenormalize(a);
+        prenormalize(b);
+        //  a 12-digit product; keep 7 digits
+        uint64_t product = a.fraction * b.fraction;
+        return build<ShortFormat>(env, a.sign ^ b.sign, a.characteristic + b.characteristic - 64, product >> 20);
+    }
+
+    Value<LongFormat> multiply(Environment & env, Value<LongFormat> a, Value<LongFormat> b)
+    {
+        if (a.fraction == 0 || b.fraction == 0)
+        {
+            return trueZero<LongFormat>();
+        }
+        prenormalize(a);
+        prenormalize(b);
+        //  A 28-digit product, aligned to the left of 32 digits; keep 15
+        uint64_t productLow = 0;
+        uint64_t productHigh = hadesvm::util::Math::multiply64x64(a.fraction << 8, b.fraction << 8, productLow);
+        return build<LongFormat>(env, a.sign ^ b.sign, a.characteristic + b.characteristic - 64, productHigh >> 4);
+    }
+
+    Value<ExtendedFormat> multiply(Environment & env, Value<ExtendedFormat> a, Value<ExtendedFormat> b)
+    {
+        if (a.fraction == UInt128() || b.fraction == UInt128())
+        {
+            return trueZero<ExtendedFormat>();
+        }
+        prenormalize(a);
+        prenormalize(b);
+        //  A 56-digit product, aligned to the left of 64 digits; keep 29
+        UInt128 productHigh, productLow;
+        UInt128::multiply(a.fraction << 16, b.fraction << 16, productHigh, productLow);
+        return build<ExtendedFormat>(env, a.sign ^ b.sign, a.characteristic + b.characteristic - 64, productHigh >> 12);
+    }
+
+    //  Divides the 192-bit "remainder:next" by a normalized (leftmost
+    //  bit set) 128-bit divisor greater than "remainder", returning the
+    //  64-bit quotient and leaving the new remainder in "remainder".
+    //  This is Knuth's algorithm D for a two-digit divisor.
+    uint64_t divideStep(UInt128 & remainder, uint64_t next, const UInt128 & divisor)
+    {
+        using hadesvm::util::Math;
+
+        //  Estimate the quotient from the divisor's high-order half; the
+        //  estimate is refined to be at most 1 too large
+        uint64_t estimate, estimateRemainder = 0;
+        bool estimateRemainderOverflows = false;
+        if (remainder.high == divisor.high)
+        {
+            estimate = UINT64_MAX;
+            estimateRemainder = remainder.low + divisor.high;
+            estimateRemainderOverflows = (estimateRemainder < remainder.low);
+        }
+        else
+        {
+            estimate = Math::divide128by64(remainder.high, remainder.low, divisor.high, estimateRemainder);
+        }
+        while (!estimateRemainderOverflows)
+        {
+            uint64_t productLow = 0;
+            uint64_t productHigh = Math::multiply64x64(estimate, divisor.low, productLow);
+            if (!(UInt128(estimateRemainder, next) < UInt128(productHigh, productLow)))
+            {
+                break;
+            }
+            estimate--;
+            estimateRemainder += divisor.high;
+            estimateRemainderOverflows = (estimateRemainder < divisor.high);
+        }
+        //  Subtract estimate * divisor from "remainder:next"...
+        uint64_t lowProductLow = 0, highProductLow = 0;
+        uint64_t lowProductHigh = Math::multiply64x64(estimate, divisor.low, lowProductLow);
+        uint64_t highProductHigh = Math::multiply64x64(estimate, divisor.high, highProductLow);
+        UInt128 product = UInt128(highProductHigh, highProductLow) + UInt128(lowProductHigh);
+        UInt128 newRemainder = UInt128(remainder.low, next) - UInt128(product.low, lowProductLow);
+        uint64_t borrow = (UInt128(remainder.low, next) < UInt128(product.low, lowProductLow)) ? 1 : 0;
+        if (remainder.high < product.high || remainder.high - product.high < borrow)
+        {   //  ...and add it back if the estimate was 1 too large
+            estimate--;
+            newRemainder = newRemainder + divisor;
+        }
+        remainder = newRemainder;
+        return estimate;
+    }
+
+    //  The quotients of prenormalized fractions are truncated to exactly
+    //  Digits digits, the leftmost of which is nonzero
+    Value<ShortFormat> divide(Environment & env, Value<ShortFormat> a, Value<ShortFormat> b)
+    {
+        if (b.fraction == 0)
+        {
+            env.divide = true;
+            return trueZero<ShortFormat>();
+        }
+        if (a.fraction == 0)
+        {
+            return trueZero<ShortFormat>();
+        }
+        prenormalize(a);
+        prenormalize(b);
+        int characteristic = a.characteristic - b.characteristic + 64;
+        uint64_t quotient;
+        if (a.fraction < b.fraction)
+        {
+            quotient = (a.fraction << 24) / b.fraction;
+        }
+        else
+        {
+            quotient = (a.fraction << 20) / b.fraction;
+            characteristic++;
+        }
+        return build<ShortFormat>(env, a.sign ^ b.sign, characteristic, quotient << 4);
+    }
+
+    Value<LongFormat> divide(Environment & env, Value<LongFormat> a, Value<LongFormat> b)
+    {
+        if (b.fraction == 0)
+        {
+            env.divide = true;
+            return trueZero<LongFormat>();
+        }
+        if (a.fraction == 0)
+        {
+            return trueZero<LongFormat>();
+        }
+        prenormalize(a);
+        prenormalize(b);
+        int characteristic = a.characteristic - b.characteristic + 64;
+        //  Left-aligned 16-digit fractions; a 16-digit quotient, keep 14
+        uint64_t dividend = a.fraction << 8, divisor = b.fraction << 8, remainder = 0, quotient;
+        if (dividend < divisor)
+        {
+            quotient = hadesvm::util::Math::divide128by64(dividend, 0, divisor, remainder);
+        }
+        else
+        {
+            quotient = hadesvm::util::Math::divide128by64(dividend >> 4, dividend << 60, divisor, remainder);
+            characteristic++;
+        }
+        return build<LongFormat>(env, a.sign ^ b.sign, characteristic, (quotient >> 8) << 4);
+    }
+
+    Value<ExtendedFormat> divide(Environment & env, Value<ExtendedFormat> a, Value<ExtendedFormat> b)
+    {
+        if (b.fraction == UInt128())
+        {
+            env.divide = true;
+            return trueZero<ExtendedFormat>();
+        }
+        if (a.fraction == UInt128())
+        {
+            return trueZero<ExtendedFormat>();
+        }
+        prenormalize(a);
+        prenormalize(b);
+        int characteristic = a.characteristic - b.characteristic + 64;
+        //  A 28-digit quotient of fractions less than 1, or a 27-digit one
+        //  (after the leftmost digit) of fractions 1 or greater; computed
+        //  as two 64-bit quotient digits of a normalized 128-bit divisor
+        int quotientBits = 4 * ExtendedFormat::Digits;
+        if (a.fraction >= b.fraction)
+        {
+            quotientBits -= 4;
+            characteristic++;
+        }
+        int divisorShift = b.fraction.countLeadingZeroBits();
+        UInt128 divisor = b.fraction << divisorShift;
+        int dividendShift = quotientBits + divisorShift;
+        UInt128 remainder = (dividendShift >= 128) ? (a.fraction << (dividendShift - 128)) : (a.fraction >> (128 - dividendShift));
+        UInt128 dividendLow = (dividendShift >= 128) ? UInt128() : (a.fraction << dividendShift);
+        uint64_t quotientHigh = divideStep(remainder, dividendLow.high, divisor);
+        uint64_t quotientLow = divideStep(remainder, dividendLow.low, divisor);
+        UInt128 quotient(quotientHigh, quotientLow);
+        return build<ExtendedFormat>(env, a.sign ^ b.sign, characteristic, quotient << 4);
+    }
+
+    //  Converts an integer fraction "fraction * 2**exponent" to double,
+    //  rounding to nearest just once
+    double toDouble(int sign, uint64_t fraction, int exponent)
+    {
+        double result = ldexp(static_cast<double>(fraction), exponent);
+        return (sign != 0) ? -result : result;
+    }
+
+    //////////
+    //  Batches
+    template <class T, class Operation>
+    void applyToBatch(std::span<const T> a, std::span<const T> b, std::span<T> result, Operation operation)
+    {
+        Q_ASSERT(a.size() == result.size() && b.size() == result.size());
+        for (size_t i = 0; i < result.size(); i++)
+        {
+            result[i] = operation(a[i], b[i]);
+        }
+    }
+
+    template <class T>
+    void compareBatch(std::span<const T> a, std::span<const T> b, std::span<int> result, int (*operation)(T, T))
+    {
+        Q_ASSERT(a.size() == result.size() && b.size() == result.size());
+        for (size_t i = 0; i < result.size(); i++)
+        {
+            result[i] = operation(a[i], b[i]);
+        }
     }
-    return (static_cast<uint64_t>(sign) << 63) |
-           (static_cast<uint64_t>((exponent + 64 + 14) & 0x7F) << 56) |
-           mantissa;
 }
 
 //////////
-//  Implementation (32 bits)
+//  API (32 bits)
 uint32_t hadesvm::ibmhfp::add32(uint32_t a, uint32_t b, Environment & env)
 {
-    return static_cast<uint32_t>(add64(static_cast<uint64_t>(a) << 32, static_cast<uint64_t>(b) << 32, env) >> 32);
+    return pack32(add(env, unpack32(a), unpack32(b)));
 }
 
 uint32_t hadesvm::ibmhfp::subtract32(uint32_t a, uint32_t b, Environment & env)
 {
-    return static_cast<uint32_t>(subtract64(static_cast<uint64_t>(a) << 32, static_cast<uint64_t>(b) << 32, env) >> 32);
+    return pack32(add(env, unpack32(a), negate(unpack32(b))));
+}
+
+uint32_t hadesvm::ibmhfp::addUnnormalized32(uint32_t a, uint32_t b, Environment & env)
+{
+    return pack32(addUnnormalized(env, unpack32(a), unpack32(b)));
+}
+
+uint32_t hadesvm::ibmhfp::subtractUnnormalized32(uint32_t a, uint32_t b, Environment & env)
+{
+    return pack32(addUnnormalized(env, unpack32(a), negate(unpack32(b))));
 }
 
 uint32_t hadesvm::ibmhfp::multiply32(uint32_t a, uint32_t b, Environment & env)
 {
-    return static_cast<uint32_t>(multiply64(static_cast<uint64_t>(a) << 32, static_cast<uint64_t>(b) << 32, env) >> 32);
+    return pack32(multiply(env, unpack32(a), unpack32(b)));
 }
 
 uint32_t hadesvm::ibmhfp::divide32(uint32_t a, uint32_t b, Environment & env)
 {
-    return static_cast<uint32_t>(divide64(static_cast<uint64_t>(a) << 32, static_cast<uint64_t>(b) << 32, env) >> 32);
+    return pack32(divide(env, unpack32(a), unpack32(b)));
 }
 
-int hadesvm::ibmhfp::compare32(uint32_t a, uint32_t b, Environment & env)
+int hadesvm::ibmhfp::compare32(uint32_t a, uint32_t b, Environment & /*env*/)
 {
-    return compare64(static_cast<uint64_t>(a) << 32, static_cast<uint64_t>(b) << 32, env);
+    return compare(unpack32(a), unpack32(b));
 }
 
 //////////
 //  API (64 bits)
 uint64_t hadesvm::ibmhfp::add64(uint64_t a, uint64_t b, Environment & env)
 {
-    int aSign = static_cast<int>((a >> 63) & 0x01);
-    int bSign = static_cast<int>((b >> 63) & 0x01);
-    int cSign;
-    int aExponent = static_cast<int>((a >> 56) & 0x7F) - 64 - 14;
-    int bExponent = static_cast<int>((b >> 56) & 0x7F) - 64 - 14;
-    int cExponent;
-    uint64_t aMantissa = (a & 0x00FFFFFFFFFFFFFF);
-    uint64_t bMantissa = (b & 0x00FFFFFFFFFFFFFF);
-    uint64_t cMantissa;
-    //  a == +/- aMantissa * 16**aExponent
-    //  b == +/- bMantissa * 16**bExponent
-    //  c == +/- cMantissa * 16**cExponent
-
-    //  Handle zeros
-    if (aMantissa == 0)
-    {
-        cSign = bSign;
-        cExponent = bExponent;
-        cMantissa = bMantissa;
-    }
-    else if (bMantissa == 0)
-    {
-        cSign = aSign;
-        cExponent = aExponent;
-        cMantissa = aMantissa;
-    }
-    else
-    {   //  General case - equalize exponents
-        while (aExponent > bExponent)
-        {
-            bMantissa >>= 4;
-            bExponent++;
-        }
-        while (aExponent < bExponent)
-        {
-            aMantissa >>= 4;
-            aExponent++;
-        }
-        cExponent = aExponent;
-        //  ...and calculate result
-        if (aSign == bSign)
-        {   //  Adding values of the same sign
-            cSign = aSign;
-            cExponent = aExponent;
-            cMantissa = aMantissa + bMantissa;
-        }
-        else if (aMantissa >= bMantissa)
-        {   //  Keep sign of A
-            cSign = aSign;
-            cMantissa = aMantissa - bMantissa;
-        }
-        else
-        {   //  Reverse sign of A
-            cSign = aSign ^ 1;
-            cMantissa = bMantissa - aMantissa;
-        }
-    }
-
-    //  Create & return result
-    return _constructValue(cSign, cExponent, cMantissa, env);
+    return pack64(add(env, unpack64(a), unpack64(b)));
 }
 
 uint64_t hadesvm::ibmhfp::subtract64(uint64_t a, uint64_t b, Environment & env)
 {
-    return add64(a, b ^ 0x8000000000000000, env);
+    return pack64(add(env, unpack64(a), negate(unpack64(b))));
 }
 
-uint64_t hadesvm::ibmhfp::multiply64(uint64_t a, uint64_t b, Environment & env)
+uint64_t hadesvm::ibmhfp::addUnnormalized64(uint64_t a, uint64_t b, Environment & env)
 {
-    int aSign = static_cast<int>((a >> 63) & 0x01);
-    int bSign = static_cast<int>((b >> 63) & 0x01);
-    int cSign;
-    int aExponent = static_cast<int>((a >> 56) & 0x7F) - 64 - 14;
-    int bExponent = static_cast<int>((b >> 56) & 0x7F) - 64 - 14;
-    int cExponent;
-    uint64_t aMantissa = (a & 0x00FFFFFFFFFFFFFF);
-    uint64_t bMantissa = (b & 0x00FFFFFFFFFFFFFF);
-    uint64_t cMantissa;
-    //  a == +/- aMantissa * 16**aExponent
-    //  b == +/- bMantissa * 16**bExponent
-    //  c == +/- cMantissa * 16**cExponent
-
-    //  Handle zeros
-    if (aMantissa == 0 || bMantissa == 0)
-    {
-        return 0;
-    }
+    return pack64(addUnnormalized(env, unpack64(a), unpack64(b)));
+}
 
-    //  Multiply mantissas
-    cMantissa = 0;
-    for (int i = 0; i < 14; i++)
-    {
-        cMantissa += aMantissa * ((bMantissa >> 52) & 0x0F);
-        aMantissa >>= 4;
-        bMantissa <<= 4;
-    }
-    cSign = aSign ^ bSign;
-    cExponent = aExponent + bExponent + 13;
+uint64_t hadesvm::ibmhfp::subtractUnnormalized64(uint64_t a, uint64_t b, Environment & env)
+{
+    return pack64(addUnnormalized(env, unpack64(a), negate(unpack64(b))));
+}
 
-    //  Create & return result
-    return _constructValue(cSign, cExponent, cMantissa, env);
+uint64_t hadesvm::ibmhfp::multiply64(uint64_t a, uint64_t b, Environment & env)
+{
+    return pack64(multiply(env, unpack64(a), unpack64(b)));
 }
 
 uint64_t hadesvm::ibmhfp::divide64(uint64_t a, uint64_t b, Environment & env)
 {
-    int aSign = static_cast<int>((a >> 63) & 0x01);
-    int bSign = static_cast<int>((b >> 63) & 0x01);
-    int cSign;
-    int aExponent = static_cast<int>((a >> 56) & 0x7F) - 64 - 14;
-    int bExponent = static_cast<int>((b >> 56) & 0x7F) - 64 - 14;
-    int cExponent;
-    uint64_t aMantissa = (a & 0x00FFFFFFFFFFFFFF);
-    uint64_t bMantissa = (b & 0x00FFFFFFFFFFFFFF);
-    uint64_t cMantissa, digit;
-    //  a == +/- aMantissa * 16**aExponent
-    //  b == +/- bMantissa * 16**bExponent
-    //  c == +/- cMantissa * 16**cExponent
-
-    //  Handle zeros
-    if (aMantissa == 0)
-    {
-        return 0;
-    }
-    if (bMantissa == 0)
-    {
-        env.divide = true;
-        return 0;
-    }
+    return pack64(divide(env, unpack64(a), unpack64(b)));
+}
 
-    //  Divide mantissas
-    cMantissa = 0;
-    for (int i = 0; i < 14; i++)
-    {
-        digit = aMantissa / bMantissa;
-        cMantissa = (cMantissa << 4) | digit;
-        aMantissa -= bMantissa * digit;
-        aMantissa = (aMantissa << 4) & 0x0FFFFFFFFFFFFFFF;
-    }
-    cSign = aSign ^ bSign;
-    cExponent = aExponent - bExponent - 13;
+int hadesvm::ibmhfp::compare64(uint64_t a, uint64_t b, Environment & /*env*/)
+{
+    return compare(unpack64(a), unpack64(b));
+}
+
+//////////
+//  API (128 bits)
+Extended hadesvm::ibmhfp::add128(const Extended & a, const Extended & b, Environment & env)
+{
+    return pack128(add(env, unpack128(a), unpack128(b)));
+}
+
+Extended hadesvm::ibmhfp::subtract128(const Extended & a, const Extended & b, Environment & env)
+{
+    return pack128(add(env, unpack128(a), negate(unpack128(b))));
+}
 
-    //  Create & return result
-    return _constructValue(cSign, cExponent, cMantissa, env);
+Extended hadesvm::ibmhfp::multiply128(const Extended & a, const Extended & b, Environment & env)
+{
+    return pack128(multiply(env, unpack128(a), unpack128(b)));
+}
+
+Extended hadesvm::ibmhfp::divide128(const Extended & a, const Extended & b, Environment & env)
+{
+    return pack128(divide(env, unpack128(a), unpack128(b)));
 }
 
-int hadesvm::ibmhfp::compare64(uint64_t a, uint64_t b, Environment & env)
+int hadesvm::ibmhfp::compare128(const Extended & a, const Extended & b, Environment & /*env*/)
 {
-    uint64_t diff = subtract64(a, b, env);
-    if (diff == 0)
+    return compare(unpack128(a), unpack128(b));
+}
+
+Extended hadesvm::ibmhfp::extend64(uint64_t a)
+{
+    Value<LongFormat> value = unpack64(a);
+    Extended result;
+    result.high = a;
+    if (value.fraction != 0)
     {
-        return 0;
+        result.low = (static_cast<uint64_t>(value.sign) << 63) |
+                     (static_cast<uint64_t>((value.characteristic - 14) & 0x7F) << 56);
     }
-    else if ((diff & 0x8000000000000000) != 0)
+    return result;
+}
+
+Extended hadesvm::ibmhfp::multiply64to128(uint64_t a, uint64_t b, Environment & env)
+{
+    Value<LongFormat> x = unpack64(a), y = unpack64(b);
+    if (x.fraction == 0 || y.fraction == 0)
     {
-        return -1;
+        return Extended();
     }
-    else
-    {
-        return 1;
+    prenormalize(x);
+    prenormalize(y);
+    //  The 28-digit product is exact
+    uint64_t productLow = 0;
+    uint64_t productHigh = hadesvm::util::Math::multiply64x64(x.fraction, y.fraction, productLow);
+    return pack128(build<ExtendedFormat>(env, x.sign ^ y.sign, x.characteristic + y.characteristic - 64,
+                                         UInt128(productHigh, productLow) << 4));
+}
+
+uint64_t hadesvm::ibmhfp::round128to64(const Extended & a, Environment & env)
+{   //  The result is not normalized
+    Value<ExtendedFormat> value = unpack128(a);
+    UInt128 fraction = value.fraction + UInt128(UINT64_C(1) << 55);
+    if ((fraction >> (4 * ExtendedFormat::Digits)) != UInt128())
+    {   //  Carry out of the leftmost digit
+        fraction = fraction >> 4;
+        if (++value.characteristic > 127)
+        {
+            env.overflow = true;
+            value.characteristic &= 0x7F;
+        }
+    }
+    return pack64(Value<LongFormat> { value.sign, value.characteristic, (fraction >> 56).low });
+}
+
+uint32_t hadesvm::ibmhfp::round64to32(uint64_t a, Environment & env)
+{   //  The result is not normalized
+    Value<LongFormat> value = unpack64(a);
+    uint64_t fraction = value.fraction + (UINT64_C(1) << 31);
+    if ((fraction >> (4 * LongFormat::Digits)) != 0)
+    {   //  Carry out of the leftmost digit
+        fraction = fraction >> 4;
+        if (++value.characteristic > 127)
+        {
+            env.overflow = true;
+            value.characteristic &= 0x7F;
+        }
     }
+    return pack32(Value<ShortFormat> { value.sign, value.characteristic, fraction >> 32 });
 }
 
 uint64_t hadesvm::ibmhfp::fromInt64(int a)
 {
-    int cSign;
-    int cExponent;
-    uint64_t cMantissa;
-
     //  0 is a special case
     if (a == 0)
     {
         return 0;
     }
-    if (a > 0)
-    {   //  Positive
-        cSign = 0;
-        cMantissa = static_cast<unsigned>(a);
-    }
-    else
-    {   //  Negative
-        cSign = 1;
-        cMantissa = static_cast<unsigned>(-a);
-    }
-    cExponent = 0;
-
-    //  Normalize result
-    while ((cMantissa & 0x00F0000000000000) == 0)
-    {
-        cMantissa <<= 4;
-        cExponent--;
-    }
-
-    //  Form the result
-    return (static_cast<uint64_t>(cSign) << 63) |
-           (static_cast<uint64_t>((cExponent + 64 + 14) & 0x7F) << 56) |
-           cMantissa;
+    //  The magnitude of an "int" fits into 8 digits; normalize it
+    Value<LongFormat> value { (a < 0) ? 1 : 0,
+                              64 + LongFormat::Digits,
+                              (a < 0) ? (UINT64_C(0) - static_cast<uint64_t>(static_cast<int64_t>(a))) : static_cast<uint64_t>(a) };
+    prenormalize(value);
+    return pack64(value);
 }
 
 uint32_t hadesvm::ibmhfp::fromInt32(int a)
@@ -276,23 +653,110 @@ uint32_t hadesvm::ibmhfp::fromInt32(int a)
 
 double hadesvm::ibmhfp::toDouble32(uint32_t a)
 {
-    return toDouble64(static_cast<uint64_t>(a) << 32);
+    Value<ShortFormat> value = unpack32(a);
+    return toDouble(value.sign, value.fraction, 4 * (value.characteristic - 64 - ShortFormat::Digits));
 }
 
 double hadesvm::ibmhfp::toDouble64(uint64_t a)
 {
-    int aSign = static_cast<int>((a >> 63) & 0x01);
-    int aExponent = static_cast<int>((a >> 56) & 0x7F) - 64 - 14;
-    uint64_t aMantissa = (a & 0x00FFFFFFFFFFFFFF);
-    //  a == +/- aMantissa * 16**aExponent
-    double result;
+    Value<LongFormat> value = unpack64(a);
+    return toDouble(value.sign, value.fraction, 4 * (value.characteristic - 64 - LongFormat::Digits));
+}
+
+double hadesvm::ibmhfp::toDouble128(const Extended & a)
+{
+    Value<ExtendedFormat> value = unpack128(a);
+    if (value.fraction == UInt128())
+    {
+        return (value.sign != 0) ? -0.0 : 0.0;
+    }
+    //  Keep the leftmost 64 bits, with the rest folded into a sticky bit
+    int shift = value.fraction.countLeadingZeroBits();
+    UInt128 aligned = value.fraction << shift;
+    return toDouble(value.sign,
+                    aligned.high | ((aligned.low != 0) ? 1 : 0),
+                    4 * (value.characteristic - 64 - ExtendedFormat::Digits) + 64 - shift);
+}
+
+//////////
+//  Batch API
+void hadesvm::ibmhfp::add32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<uint32_t> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](uint32_t x, uint32_t y) { return pack32(add(env, unpack32(x), unpack32(y))); });
+}
+
+void hadesvm::ibmhfp::subtract32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<uint32_t> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](uint32_t x, uint32_t y) { return pack32(add(env, unpack32(x), negate(unpack32(y)))); });
+}
+
+void hadesvm::ibmhfp::multiply32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<uint32_t> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](uint32_t x, uint32_t y) { return pack32(multiply(env, unpack32(x), unpack32(y))); });
+}
+
+void hadesvm::ibmhfp::divide32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<uint32_t> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](uint32_t x, uint32_t y) { return pack32(divide(env, unpack32(x), unpack32(y))); });
+}
+
+void hadesvm::ibmhfp::compare32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<int> result, Environment & /*env*/)
+{
+    compareBatch<uint32_t>(a, b, result, [](uint32_t x, uint32_t y) { return compare(unpack32(x), unpack32(y)); });
+}
+
+void hadesvm::ibmhfp::add64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<uint64_t> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](uint64_t x, uint64_t y) { return pack64(add(env, unpack64(x), unpack64(y))); });
+}
+
+void hadesvm::ibmhfp::subtract64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<uint64_t> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](uint64_t x, uint64_t y) { return pack64(add(env, unpack64(x), negate(unpack64(y)))); });
+}
+
+void hadesvm::ibmhfp::multiply64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<uint64_t> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](uint64_t x, uint64_t y) { return pack64(multiply(env, unpack64(x), unpack64(y))); });
+}
+
+void hadesvm::ibmhfp::divide64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<uint64_t> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](uint64_t x, uint64_t y) { return pack64(divide(env, unpack64(x), unpack64(y))); });
+}
+
+void hadesvm::ibmhfp::compare64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<int> result, Environment & /*env*/)
+{
+    compareBatch<uint64_t>(a, b, result, [](uint64_t x, uint64_t y) { return compare(unpack64(x), unpack64(y)); });
+}
+
+void hadesvm::ibmhfp::add128(std::span<const Extended> a, std::span<const Extended> b, std::span<Extended> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](const Extended & x, const Extended & y) { return pack128(add(env, unpack128(x), unpack128(y))); });
+}
 
-    result = static_cast<double>(aMantissa);
-    for (; aExponent > 0; aExponent--)
-        result *= 16;
-    for (; aExponent < 0; aExponent++)
-        result /= 16;
-    return aSign ? -result : result;
+void hadesvm::ibmhfp::subtract128(std::span<const Extended> a, std::span<const Extended> b, std::span<Extended> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](const Extended & x, const Extended & y) { return pack128(add(env, unpack128(x), negate(unpack128(y)))); });
+}
+
+void hadesvm::ibmhfp::multiply128(std::span<const Extended> a, std::span<const Extended> b, std::span<Extended> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](const Extended & x, const Extended & y) { return pack128(multiply(env, unpack128(x), unpack128(y))); });
+}
+
+void hadesvm::ibmhfp::divide128(std::span<const Extended> a, std::span<const Extended> b, std::span<Extended> result, Environment & env)
+{
+    applyToBatch(a, b, result, [&](const Extended & x, const Extended & y) { return pack128(divide(env, unpack128(x), unpack128(y))); });
+}
+
+void hadesvm::ibmhfp::compare128(std::span<const Extended> a, std::span<const Extended> b, std::span<int> result, Environment & /*env*/)
+{
+    Q_ASSERT(a.size() == result.size() && b.size() == result.size());
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        result[i] = compare(unpack128(a[i]), unpack128(b[i]));
+    }
 }
 
-//  End of hadesvm-ibmhfp/uint32_tHfp.cpp
+//  End of hadesvm-ibmhfp/Hfp.cpp
@@ -20,8 +20,23 @@ namespace hadesvm
             bool        divide = false;
         };
 
+        //  An extended (128-bit) HFP value: the high-order part holds the
+        //  sign, the characteristic and the leftmost 14 fraction digits; the
+        //  low-order part holds the rightmost 14 fraction digits, along with
+        //  the sign and a characteristic 14 less than the high-order one.
+        struct HADESVM_IBMHFP_PUBLIC Extended
+        {
+            uint64_t    high = 0;
+            uint64_t    low = 0;
+        };
+
         //////////
         //  API
+        //  All operations produce the exact result the way the hardware
+        //  does: multiplication and division prenormalize their operands,
+        //  addition and subtraction keep one guard digit, and every result
+        //  is normalized and truncated. Exceptions are flagged in "env",
+        //  whose flags are only ever set, never cleared.
         HADESVM_IBMHFP_PUBLIC uint32_t  add32(uint32_t a, uint32_t b, Environment & env);
         HADESVM_IBMHFP_PUBLIC uint32_t  subtract32(uint32_t a, uint32_t b, Environment & env);
         HADESVM_IBMHFP_PUBLIC uint32_t  multiply32(uint32_t a, uint32_t b, Environment & env);
@@ -34,10 +49,59 @@ namespace hadesvm
         HADESVM_IBMHFP_PUBLIC uint64_t  divide64(uint64_t a, uint64_t b, Environment & env);
         HADESVM_IBMHFP_PUBLIC int       compare64(uint64_t a, uint64_t b, Environment & env);
 
+        HADESVM_IBMHFP_PUBLIC Extended  add128(const Extended & a, const Extended & b, Environment & env);
+        HADESVM_IBMHFP_PUBLIC Extended  subtract128(const Extended & a, const Extended & b, Environment & env);
+        HADESVM_IBMHFP_PUBLIC Extended  multiply128(const Extended & a, const Extended & b, Environment & env);
+        HADESVM_IBMHFP_PUBLIC Extended  divide128(const Extended & a, const Extended & b, Environment & env);
+        HADESVM_IBMHFP_PUBLIC int       compare128(const Extended & a, const Extended & b, Environment & env);
+
+        //  Add and subtract without normalizing the result: the intermediate
+        //  sum is truncated to the format's digits (a zero result is still
+        //  a true zero), as the unnormalized add and subtract instructions do.
+        HADESVM_IBMHFP_PUBLIC uint32_t  addUnnormalized32(uint32_t a, uint32_t b, Environment & env);
+        HADESVM_IBMHFP_PUBLIC uint32_t  subtractUnnormalized32(uint32_t a, uint32_t b, Environment & env);
+        HADESVM_IBMHFP_PUBLIC uint64_t  addUnnormalized64(uint64_t a, uint64_t b, Environment & env);
+        HADESVM_IBMHFP_PUBLIC uint64_t  subtractUnnormalized64(uint64_t a, uint64_t b, Environment & env);
+
+        //  Lengthens a long value to extended format; always exact.
+        HADESVM_IBMHFP_PUBLIC Extended  extend64(uint64_t a);
+        //  Multiplies two long values into an extended value; always exact
+        //  unless the characteristic overflows or underflows.
+        HADESVM_IBMHFP_PUBLIC Extended  multiply64to128(uint64_t a, uint64_t b, Environment & env);
+        //  Rounds an extended value to long format by adding 1 to the
+        //  leftmost of the 14 discarded digits' bits and truncating.
+        HADESVM_IBMHFP_PUBLIC uint64_t  round128to64(const Extended & a, Environment & env);
+        //  Rounds a long value to short format the same way.
+        HADESVM_IBMHFP_PUBLIC uint32_t  round64to32(uint64_t a, Environment & env);
+
         HADESVM_IBMHFP_PUBLIC uint32_t  fromInt32(int a);
         HADESVM_IBMHFP_PUBLIC uint64_t  fromInt64(int a);
         HADESVM_IBMHFP_PUBLIC double    toDouble32(uint32_t a);
         HADESVM_IBMHFP_PUBLIC double    toDouble64(uint64_t a);
+        HADESVM_IBMHFP_PUBLIC double    toDouble128(const Extended & a);
+
+        //////////
+        //  Batch API - applies an operation to whole spans of values,
+        //  accumulating the exceptions of all elements in "env". All spans
+        //  passed to an operation must be of the same size; the result span
+        //  may be the same as (but must not partially overlap) an operand.
+        HADESVM_IBMHFP_PUBLIC void      add32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<uint32_t> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      subtract32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<uint32_t> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      multiply32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<uint32_t> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      divide32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<uint32_t> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      compare32(std::span<const uint32_t> a, std::span<const uint32_t> b, std::span<int> result, Environment & env);
+
+        HADESVM_IBMHFP_PUBLIC void      add64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<uint64_t> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      subtract64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<uint64_t> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      multiply64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<uint64_t> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      divide64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<uint64_t> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      compare64(std::span<const uint64_t> a, std::span<const uint64_t> b, std::span<int> result, Environment & env);
+
+        HADESVM_IBMHFP_PUBLIC void      add128(std::span<const Extended> a, std::span<const Extended> b, std::span<Extended> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      subtract128(std::span<const Extended> a, std::span<const Extended> b, std::span<Extended> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      multiply128(std::span<const Extended> a, std::span<const Extended> b, std::span<Extended> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      divide128(std::span<const Extended> a, std::span<const Extended> b, std::span<Extended> result, Environment & env);
+        HADESVM_IBMHFP_PUBLIC void      compare128(std::span<const Extended> a, std::span<const Extended> b, std::span<int> result, Environment & env);
     }
 }
 
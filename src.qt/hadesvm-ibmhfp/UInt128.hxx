@@ -0,0 +1,106 @@
+//
+//  hadesvm-ibmhfp/UInt128.hxx
+//
+//  128-bit unsigned integers for extended HFP fractions
+//
+//////////
+
+namespace hadesvm
+{
+    namespace ibmhfp
+    {
+        //////////
+        //  A 128-bit unsigned integer with just the operations the
+        //  extended HFP kernels need
+        struct UInt128
+        {
+            //////////
+            //  Construction
+            UInt128() : high(0), low(0) {}
+            UInt128(uint64_t lowParam) : high(0), low(lowParam) {}
+            UInt128(uint64_t highParam, uint64_t lowParam) : high(highParam), low(lowParam) {}
+
+            //////////
+            //  Properties
+            uint64_t        high;
+            uint64_t        low;
+
+            //////////
+            //  Operators
+            bool            operator == (const UInt128 & op2) const { return high == op2.high && low == op2.low; }
+            bool            operator != (const UInt128 & op2) const { return high != op2.high || low != op2.low; }
+            bool            operator <  (const UInt128 & op2) const { return high < op2.high || (high == op2.high && low < op2.low); }
+            bool            operator >= (const UInt128 & op2) const { return !(*this < op2); }
+
+            UInt128         operator + (const UInt128 & op2) const
+            {
+                uint64_t sumLow = low + op2.low;
+                return UInt128(high + op2.high + ((sumLow < low) ? 1 : 0), sumLow);
+            }
+
+            UInt128         operator - (const UInt128 & op2) const
+            {
+                return UInt128(high - op2.high - ((low < op2.low) ? 1 : 0), low - op2.low);
+            }
+
+            UInt128         operator | (const UInt128 & op2) const { return UInt128(high | op2.high, low | op2.low); }
+
+            //  Shifts by 0 to 127 bits
+            UInt128         operator << (int count) const
+            {
+                if (count == 0)
+                {
+                    return *this;
+                }
+                else if (count < 64)
+                {
+                    return UInt128((high << count) | (low >> (64 - count)), low << count);
+                }
+                return UInt128(low << (count - 64), 0);
+            }
+
+            UInt128         operator >> (int count) const
+            {
+                if (count == 0)
+                {
+                    return *this;
+                }
+                else if (count < 64)
+                {
+                    return UInt128(high >> count, (low >> count) | (high << (64 - count)));
+                }
+                return UInt128(0, high >> (count - 64));
+            }
+
+            //////////
+            //  Operations
+            //  The number of leading zero bits; 128 for a zero.
+            int             countLeadingZeroBits() const
+            {
+                return (high != 0) ?
+                            static_cast<int>(qCountLeadingZeroBits(high)) :
+                            64 + static_cast<int>(qCountLeadingZeroBits(low));
+            }
+
+            //  Multiplies two 128-bit values, storing the upper and the
+            //  lower 128 bits of the 256-bit product into "productHigh"
+            //  and "productLow".
+            static void     multiply(const UInt128 & x, const UInt128 & y, UInt128 & productHigh, UInt128 & productLow)
+            {
+                using hadesvm::util::Math;
+                uint64_t lowLowLow, lowHighLow, highLowLow, highHighLow;
+                uint64_t lowLowHigh = Math::multiply64x64(x.low, y.low, lowLowLow);
+                uint64_t lowHighHigh = Math::multiply64x64(x.low, y.high, lowHighLow);
+                uint64_t highLowHigh = Math::multiply64x64(x.high, y.low, highLowLow);
+                uint64_t highHighHigh = Math::multiply64x64(x.high, y.high, highHighLow);
+                //  Add up the 64-bit columns, carrying into the next one
+                UInt128 middle = UInt128(lowLowHigh) + UInt128(lowHighLow) + UInt128(highLowLow);
+                productLow = UInt128(middle.low, lowLowLow);
+                productHigh = UInt128(highHighHigh, highHighLow) +
+                              UInt128(lowHighHigh) + UInt128(highLowHigh) + UInt128(middle.high);
+            }
+        };
+    }
+}
+
+//  End of hadesvm-ibmhfp/UInt128.hxx
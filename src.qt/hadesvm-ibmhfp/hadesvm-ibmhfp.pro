@@ -13,4 +13,5 @@ HEADERS += \
     Hfp.hpp \
     Linkage.hpp \
     Real32.hpp \
-    Real64.hpp
+    Real64.hpp \
+    UInt128.hxx
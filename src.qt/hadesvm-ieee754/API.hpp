@@ -18,5 +18,6 @@
 #include "hadesvm-ieee754/Real21.hpp"
 #include "hadesvm-ieee754/Real32.hpp"
 #include "hadesvm-ieee754/Real64.hpp"
+#include "hadesvm-ieee754/Batch.hpp"
 
 //  End of hadesvm-ieee754/API.hpp
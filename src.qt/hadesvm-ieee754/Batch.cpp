@@ -0,0 +1,685 @@
+//
+//  hadesvm-ieee754/Batch.cpp
+//
+//  hadesvm::ieee754::Batch class implementation
+//
+//////////
+#include "hadesvm-ieee754/API.hpp"
+using namespace hadesvm::ieee754;
+
+//  The AVX2 kernels are compiled for AVX2+FMA regardless of the target
+//  architecture level the rest of the library is compiled for, and are
+//  only called after checking that the host CPU supports them
+#if defined(Q_PROCESSOR_X86_64) && defined(Q_CC_GNU)
+    #define HADESVM_IEEE754_BATCH_AVX2
+    #define HADESVM_IEEE754_AVX2_FUNCTION   __attribute__((target("avx2,fma")))
+#endif
+
+namespace
+{
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+    bool hasAvx2()
+    {
+        static const bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        return avx2;
+    }
+
+    //////////
+    //  AVX2 lane helpers. The kernels use the same error-free
+    //  transformations as HostFpu, with FMA computing the exact errors
+    //  of products and quotients. A lane mask has all bits of a lane set
+    //  for "true" and all clear for "false".
+
+    //  Products and quotients are only done in lanes where the operands
+    //  and the result fall into the same exponent range HostFpu uses for
+    //  them, so that the lanes HostFpu would leave to FpValue stay there
+    const int64_t MinSafeExponent64 = 2 * 53 + 8;
+    const int64_t MaxSafeExponent64 = 2046 - 27 - 8;
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m256i exponentOf64(__m256i bits)
+    {
+        return _mm256_and_si256(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(0x07FF));
+    }
+
+    //  True in lanes holding nonzero normalized finite values
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m256i isNormalized64(__m256i bits)
+    {
+        __m256i exponent = exponentOf64(bits);
+        __m256i special = _mm256_or_si256(_mm256_cmpeq_epi64(exponent, _mm256_setzero_si256()),
+                                          _mm256_cmpeq_epi64(exponent, _mm256_set1_epi64x(0x07FF)));
+        return _mm256_andnot_si256(special, _mm256_set1_epi64x(-1));
+    }
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m256i isSafeForProducts64(__m256i bits)
+    {
+        __m256i exponent = exponentOf64(bits);
+        __m256i unsafe = _mm256_or_si256(_mm256_cmpgt_epi64(_mm256_set1_epi64x(MinSafeExponent64), exponent),
+                                         _mm256_cmpgt_epi64(exponent, _mm256_set1_epi64x(MaxSafeExponent64)));
+        return _mm256_andnot_si256(unsafe, _mm256_set1_epi64x(-1));
+    }
+
+    //  True in lanes where the exponents of "x" and "y" differ by more
+    //  than "guardBits"
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m256i isFarApart64(__m256i x, __m256i y, int64_t guardBits)
+    {
+        __m256i xExponent = exponentOf64(x), yExponent = exponentOf64(y);
+        __m256i limit = _mm256_set1_epi64x(guardBits);
+        return _mm256_or_si256(_mm256_cmpgt_epi64(_mm256_sub_epi64(xExponent, yExponent), limit),
+                               _mm256_cmpgt_epi64(_mm256_sub_epi64(yExponent, xExponent), limit));
+    }
+
+    //  Truncates the rounded-to-nearest "hostResult" given its "error",
+    //  whose sign is that of the rounding error and which is nonzero
+    //  if the result is inexact. Lanes whose result isn't normalized
+    //  before or after truncation are removed from "valid".
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m256i complete64(__m256d hostResult, __m256d error, __m256i & valid, __m256i & inexact)
+    {
+        __m256i resultBits = _mm256_castpd_si256(hostResult);
+        inexact = _mm256_castpd_si256(_mm256_cmp_pd(error, _mm256_setzero_pd(), _CMP_NEQ_OQ));
+        //  Rounded away from zero - step one ulp towards zero instead
+        __m256i awayFromZero = _mm256_and_si256(
+            inexact,
+            _mm256_cmpgt_epi64(_mm256_setzero_si256(),
+                               _mm256_xor_si256(resultBits, _mm256_castpd_si256(error))));
+        __m256i truncatedBits = _mm256_add_epi64(resultBits, awayFromZero);
+        valid = _mm256_and_si256(valid, _mm256_and_si256(isNormalized64(resultBits), isNormalized64(truncatedBits)));
+        return truncatedBits;
+    }
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m128i exponentOf32(__m128i bits)
+    {
+        return _mm_and_si128(_mm_srli_epi32(bits, 23), _mm_set1_epi32(0x00FF));
+    }
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m128i isNormalized32(__m128i bits)
+    {
+        __m128i exponent = exponentOf32(bits);
+        __m128i special = _mm_or_si128(_mm_cmpeq_epi32(exponent, _mm_setzero_si128()),
+                                       _mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x00FF)));
+        return _mm_andnot_si128(special, _mm_set1_epi32(-1));
+    }
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m128i isFarApart32(__m128i x, __m128i y, int guardBits)
+    {
+        __m128i xExponent = exponentOf32(x), yExponent = exponentOf32(y);
+        return _mm_cmpgt_epi32(_mm_abs_epi32(_mm_sub_epi32(xExponent, yExponent)), _mm_set1_epi32(guardBits));
+    }
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m128i complete32(__m128 hostResult, __m128 error, __m128i & valid, __m128i & inexact)
+    {
+        __m128i resultBits = _mm_castps_si128(hostResult);
+        inexact = _mm_castps_si128(_mm_cmp_ps(error, _mm_setzero_ps(), _CMP_NEQ_OQ));
+        //  Rounded away from zero - step one ulp towards zero instead
+        __m128i awayFromZero = _mm_and_si128(
+            inexact,
+            _mm_cmpgt_epi32(_mm_setzero_si128(),
+                            _mm_xor_si128(resultBits, _mm_castps_si128(error))));
+        __m128i truncatedBits = _mm_add_epi32(resultBits, awayFromZero);
+        valid = _mm_and_si128(valid, _mm_and_si128(isNormalized32(resultBits), isNormalized32(truncatedBits)));
+        return truncatedBits;
+    }
+
+    //  -1.0f, 0.0f or +1.0f for a negative, zero or positive double; the
+    //  errors of float operations computed in double precision may be too
+    //  small to survive a plain conversion to float
+    HADESVM_IEEE754_AVX2_FUNCTION
+    __m128 signOf(__m256d value)
+    {
+        __m256d unit = _mm256_or_pd(_mm256_set1_pd(1.0), _mm256_and_pd(value, _mm256_set1_pd(-0.0)));
+        __m256d nonZero = _mm256_cmp_pd(value, _mm256_setzero_pd(), _CMP_NEQ_OQ);
+        return _mm256_cvtpd_ps(_mm256_and_pd(unit, nonZero));
+    }
+
+    //  Each lane kernel processes 4 elements, returning the bit mask of
+    //  lanes whose results are valid and storing the bit mask of those
+    //  which are inexact into "inexact"
+    HADESVM_IEEE754_AVX2_FUNCTION
+    int addLanes64(const uint64_t * x, const uint64_t * y, bool subtract, uint64_t * result, int & inexact)
+    {
+        __m256i xBits = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x));
+        __m256i yBits = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y));
+        if (subtract)
+        {
+            yBits = _mm256_xor_si256(yBits, _mm256_set1_epi64x(INT64_MIN));
+        }
+        __m256d xValue = _mm256_castsi256_pd(xBits), yValue = _mm256_castsi256_pd(yBits);
+        //  Knuth's TwoSum
+        __m256d sum = _mm256_add_pd(xValue, yValue);
+        __m256d yVirtual = _mm256_sub_pd(sum, xValue);
+        __m256d xVirtual = _mm256_sub_pd(sum, yVirtual);
+        __m256d error = _mm256_add_pd(_mm256_sub_pd(xValue, xVirtual), _mm256_sub_pd(yValue, yVirtual));
+
+        __m256i valid = _mm256_and_si256(isNormalized64(xBits), isNormalized64(yBits));
+        __m256i inexactLanes;
+        __m256i resultBits = complete64(sum, error, valid, inexactLanes);
+        //  Inexact differences of magnitudes of operands too far apart
+        //  are truncated differently by FpValue
+        __m256i differentSigns = _mm256_cmpgt_epi64(_mm256_setzero_si256(), _mm256_xor_si256(xBits, yBits));
+        valid = _mm256_andnot_si256(
+            _mm256_and_si256(inexactLanes, _mm256_and_si256(differentSigns, isFarApart64(xBits, yBits, 64 - 53))),
+            valid);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result), resultBits);
+        inexact = _mm256_movemask_pd(_mm256_castsi256_pd(inexactLanes));
+        return _mm256_movemask_pd(_mm256_castsi256_pd(valid));
+    }
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    int multiplyLanes64(const uint64_t * x, const uint64_t * y, bool divide, uint64_t * result, int & inexact)
+    {
+        __m256i xBits = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x));
+        __m256i yBits = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y));
+        __m256d xValue = _mm256_castsi256_pd(xBits), yValue = _mm256_castsi256_pd(yBits);
+        __m256d hostResult, error;
+        if (divide)
+        {   //  "x - quotient * y" is exact; the quotient is too large if
+            //  it has the sign opposite to that of "y"
+            hostResult = _mm256_div_pd(xValue, yValue);
+            error = _mm256_xor_pd(_mm256_fnmadd_pd(hostResult, yValue, xValue),
+                                  _mm256_and_pd(yValue, _mm256_set1_pd(-0.0)));
+        }
+        else
+        {
+            hostResult = _mm256_mul_pd(xValue, yValue);
+            error = _mm256_fmsub_pd(xValue, yValue, hostResult);
+        }
+
+        __m256i valid = _mm256_and_si256(
+            _mm256_and_si256(isSafeForProducts64(xBits), isSafeForProducts64(yBits)),
+            isSafeForProducts64(_mm256_castpd_si256(hostResult)));
+        __m256i inexactLanes;
+        __m256i resultBits = complete64(hostResult, error, valid, inexactLanes);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result), resultBits);
+        inexact = _mm256_movemask_pd(_mm256_castsi256_pd(inexactLanes));
+        return _mm256_movemask_pd(_mm256_castsi256_pd(valid));
+    }
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    int addLanes32(const uint32_t * x, const uint32_t * y, bool subtract, uint32_t * result, int & inexact)
+    {
+        __m128i xBits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x));
+        __m128i yBits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(y));
+        if (subtract)
+        {
+            yBits = _mm_xor_si128(yBits, _mm_set1_epi32(INT32_MIN));
+        }
+        __m128 xValue = _mm_castsi128_ps(xBits), yValue = _mm_castsi128_ps(yBits);
+        //  Knuth's TwoSum
+        __m128 sum = _mm_add_ps(xValue, yValue);
+        __m128 yVirtual = _mm_sub_ps(sum, xValue);
+        __m128 xVirtual = _mm_sub_ps(sum, yVirtual);
+        __m128 error = _mm_add_ps(_mm_sub_ps(xValue, xVirtual), _mm_sub_ps(yValue, yVirtual));
+
+        __m128i valid = _mm_and_si128(isNormalized32(xBits), isNormalized32(yBits));
+        __m128i inexactLanes;
+        __m128i resultBits = complete32(sum, error, valid, inexactLanes);
+        __m128i differentSigns = _mm_cmpgt_epi32(_mm_setzero_si128(), _mm_xor_si128(xBits, yBits));
+        valid = _mm_andnot_si128(
+            _mm_and_si128(inexactLanes, _mm_and_si128(differentSigns, isFarApart32(xBits, yBits, 64 - 24))),
+            valid);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result), resultBits);
+        inexact = _mm_movemask_ps(_mm_castsi128_ps(inexactLanes));
+        return _mm_movemask_ps(_mm_castsi128_ps(valid));
+    }
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    int multiplyLanes32(const uint32_t * x, const uint32_t * y, bool divide, uint32_t * result, int & inexact)
+    {
+        __m128i xBits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x));
+        __m128i yBits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(y));
+        __m128 xValue = _mm_castsi128_ps(xBits), yValue = _mm_castsi128_ps(yBits);
+        __m128 hostResult, error;
+        if (divide)
+        {   //  A float quotient times a float divisor is exact as a double
+            hostResult = _mm_div_ps(xValue, yValue);
+            __m256d product = _mm256_mul_pd(_mm256_cvtps_pd(hostResult), _mm256_cvtps_pd(yValue));
+            error = _mm_xor_ps(signOf(_mm256_sub_pd(_mm256_cvtps_pd(xValue), product)),
+                               _mm_and_ps(yValue, _mm_set1_ps(-0.0f)));
+        }
+        else
+        {   //  A product of floats is exact as a double
+            __m256d exact = _mm256_mul_pd(_mm256_cvtps_pd(xValue), _mm256_cvtps_pd(yValue));
+            hostResult = _mm256_cvtpd_ps(exact);
+            error = signOf(_mm256_sub_pd(exact, _mm256_cvtps_pd(hostResult)));
+        }
+
+        __m128i valid = _mm_and_si128(isNormalized32(xBits), isNormalized32(yBits));
+        __m128i inexactLanes;
+        __m128i resultBits = complete32(hostResult, error, valid, inexactLanes);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result), resultBits);
+        inexact = _mm_movemask_ps(_mm_castsi128_ps(inexactLanes));
+        return _mm_movemask_ps(_mm_castsi128_ps(valid));
+    }
+
+    //  Widening a normalized float is always exact
+    HADESVM_IEEE754_AVX2_FUNCTION
+    int widenLanes(const uint32_t * x, uint64_t * result, int & inexact)
+    {
+        __m128i xBits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x));
+        _mm256_storeu_pd(reinterpret_cast<double *>(result), _mm256_cvtps_pd(_mm_castsi128_ps(xBits)));
+        inexact = 0;
+        return _mm_movemask_ps(_mm_castsi128_ps(isNormalized32(xBits)));
+    }
+
+    HADESVM_IEEE754_AVX2_FUNCTION
+    int narrowLanes(const uint64_t * x, uint32_t * result, int & inexact)
+    {
+        __m256i xBits = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x));
+        __m256d xValue = _mm256_castsi256_pd(xBits);
+        __m128 narrowed = _mm256_cvtpd_ps(xValue);
+        __m128 error = signOf(_mm256_sub_pd(xValue, _mm256_cvtps_pd(narrowed)));
+
+        __m128i valid = _mm_set1_epi32(-1);
+        __m128i inexactLanes;
+        __m128i resultBits = complete32(narrowed, error, valid, inexactLanes);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result), resultBits);
+        inexact = _mm_movemask_ps(_mm_castsi128_ps(inexactLanes));
+        return _mm_movemask_ps(_mm_castsi128_ps(valid)) &
+               _mm256_movemask_pd(_mm256_castsi256_pd(isNormalized64(xBits)));
+    }
+#endif
+
+    //////////
+    //  Kernels. Each has a "scalar" path and, where SIMD is available,
+    //  a "lanes" path for 4 elements at a time.
+    struct Add32
+    {
+        using Operand = uint32_t;
+        using Result = uint32_t;
+
+        static uint32_t scalar(Environment & environment, uint32_t x, uint32_t y)
+        {
+            return Real32::fromBitPattern(x).add(Real32::fromBitPattern(y), environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint32_t * x, const uint32_t * y, uint32_t * result, int & inexact)
+        {
+            return addLanes32(x, y, false, result, inexact);
+        }
+#endif
+    };
+
+    struct Subtract32
+    {
+        using Operand = uint32_t;
+        using Result = uint32_t;
+
+        static uint32_t scalar(Environment & environment, uint32_t x, uint32_t y)
+        {
+            return Real32::fromBitPattern(x).subtract(Real32::fromBitPattern(y), environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint32_t * x, const uint32_t * y, uint32_t * result, int & inexact)
+        {
+            return addLanes32(x, y, true, result, inexact);
+        }
+#endif
+    };
+
+    struct Multiply32
+    {
+        using Operand = uint32_t;
+        using Result = uint32_t;
+
+        static uint32_t scalar(Environment & environment, uint32_t x, uint32_t y)
+        {
+            return Real32::fromBitPattern(x).multiply(Real32::fromBitPattern(y), environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint32_t * x, const uint32_t * y, uint32_t * result, int & inexact)
+        {
+            return multiplyLanes32(x, y, false, result, inexact);
+        }
+#endif
+    };
+
+    struct Divide32
+    {
+        using Operand = uint32_t;
+        using Result = uint32_t;
+
+        static uint32_t scalar(Environment & environment, uint32_t x, uint32_t y)
+        {
+            return Real32::fromBitPattern(x).divide(Real32::fromBitPattern(y), environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint32_t * x, const uint32_t * y, uint32_t * result, int & inexact)
+        {
+            return multiplyLanes32(x, y, true, result, inexact);
+        }
+#endif
+    };
+
+    struct Add64
+    {
+        using Operand = uint64_t;
+        using Result = uint64_t;
+
+        static uint64_t scalar(Environment & environment, uint64_t x, uint64_t y)
+        {
+            return Real64::fromBitPattern(x).add(Real64::fromBitPattern(y), environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint64_t * x, const uint64_t * y, uint64_t * result, int & inexact)
+        {
+            return addLanes64(x, y, false, result, inexact);
+        }
+#endif
+    };
+
+    struct Subtract64
+    {
+        using Operand = uint64_t;
+        using Result = uint64_t;
+
+        static uint64_t scalar(Environment & environment, uint64_t x, uint64_t y)
+        {
+            return Real64::fromBitPattern(x).subtract(Real64::fromBitPattern(y), environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint64_t * x, const uint64_t * y, uint64_t * result, int & inexact)
+        {
+            return addLanes64(x, y, true, result, inexact);
+        }
+#endif
+    };
+
+    struct Multiply64
+    {
+        using Operand = uint64_t;
+        using Result = uint64_t;
+
+        static uint64_t scalar(Environment & environment, uint64_t x, uint64_t y)
+        {
+            return Real64::fromBitPattern(x).multiply(Real64::fromBitPattern(y), environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint64_t * x, const uint64_t * y, uint64_t * result, int & inexact)
+        {
+            return multiplyLanes64(x, y, false, result, inexact);
+        }
+#endif
+    };
+
+    struct Divide64
+    {
+        using Operand = uint64_t;
+        using Result = uint64_t;
+
+        static uint64_t scalar(Environment & environment, uint64_t x, uint64_t y)
+        {
+            return Real64::fromBitPattern(x).divide(Real64::fromBitPattern(y), environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint64_t * x, const uint64_t * y, uint64_t * result, int & inexact)
+        {
+            return multiplyLanes64(x, y, true, result, inexact);
+        }
+#endif
+    };
+
+    struct Widen
+    {
+        using Operand = uint32_t;
+        using Result = uint64_t;
+
+        static uint64_t scalar(Environment & environment, uint32_t x)
+        {
+            return Real32::fromBitPattern(x).toReal64(environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint32_t * x, uint64_t * result, int & inexact)
+        {
+            return widenLanes(x, result, inexact);
+        }
+#endif
+    };
+
+    struct Narrow
+    {
+        using Operand = uint64_t;
+        using Result = uint32_t;
+
+        static uint32_t scalar(Environment & environment, uint64_t x)
+        {
+            return Real64::fromBitPattern(x).toReal32(environment).bitPattern;
+        }
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        HADESVM_IEEE754_AVX2_FUNCTION
+        static int lanes(const uint64_t * x, uint32_t * result, int & inexact)
+        {
+            return narrowLanes(x, result, inexact);
+        }
+#endif
+    };
+
+    //////////
+    //  Drivers. The results of each group of lanes are only stored once
+    //  the elements the lanes leave to the scalar path have been redone,
+    //  so that their operands are still there even if the result span is
+    //  the same as an operand span.
+    const size_t Lanes = 4;
+
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+    template <class Kernel>
+    HADESVM_IEEE754_AVX2_FUNCTION
+    size_t runLanes(std::span<const typename Kernel::Operand> x, std::span<const typename Kernel::Operand> y,
+                    std::span<typename Kernel::Result> result, Environment & environment)
+    {
+        size_t count = result.size() & ~(Lanes - 1);
+        bool inexact = false;
+        for (size_t i = 0; i < count; i += Lanes)
+        {
+            typename Kernel::Result results[Lanes];
+            int inexactLanes = 0;
+            int validLanes = Kernel::lanes(&x[i], &y[i], results, inexactLanes);
+            inexact |= (inexactLanes & validLanes) != 0;
+            for (size_t lane = 0; validLanes != (1 << Lanes) - 1 && lane < Lanes; lane++)
+            {
+                if ((validLanes & (1 << lane)) == 0)
+                {
+                    results[lane] = Kernel::scalar(environment, x[i + lane], y[i + lane]);
+                }
+            }
+            memcpy(&result[i], results, sizeof(results));
+        }
+        if (inexact)
+        {
+            environment.exception |= Exception::Inexact;
+        }
+        return count;
+    }
+
+    template <class Kernel>
+    HADESVM_IEEE754_AVX2_FUNCTION
+    size_t runLanes(std::span<const typename Kernel::Operand> x,
+                    std::span<typename Kernel::Result> result, Environment & environment)
+    {
+        size_t count = result.size() & ~(Lanes - 1);
+        bool inexact = false;
+        for (size_t i = 0; i < count; i += Lanes)
+        {
+            typename Kernel::Result results[Lanes];
+            int inexactLanes = 0;
+            int validLanes = Kernel::lanes(&x[i], results, inexactLanes);
+            inexact |= (inexactLanes & validLanes) != 0;
+            for (size_t lane = 0; validLanes != (1 << Lanes) - 1 && lane < Lanes; lane++)
+            {
+                if ((validLanes & (1 << lane)) == 0)
+                {
+                    results[lane] = Kernel::scalar(environment, x[i + lane]);
+                }
+            }
+            memcpy(&result[i], results, sizeof(results));
+        }
+        if (inexact)
+        {
+            environment.exception |= Exception::Inexact;
+        }
+        return count;
+    }
+#endif
+
+    template <class Kernel>
+    void run(std::span<const typename Kernel::Operand> x, std::span<const typename Kernel::Operand> y,
+             std::span<typename Kernel::Result> result, Environment & environment)
+    {
+        Q_ASSERT(x.size() == result.size() && y.size() == result.size());
+
+        size_t done = 0;
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        if (hasAvx2())
+        {
+            done = runLanes<Kernel>(x, y, result, environment);
+        }
+#endif
+        for (size_t i = done; i < result.size(); i++)
+        {
+            result[i] = Kernel::scalar(environment, x[i], y[i]);
+        }
+    }
+
+    template <class Kernel>
+    void run(std::span<const typename Kernel::Operand> x,
+             std::span<typename Kernel::Result> result, Environment & environment)
+    {
+        Q_ASSERT(x.size() == result.size());
+
+        size_t done = 0;
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+        if (hasAvx2())
+        {
+            done = runLanes<Kernel>(x, result, environment);
+        }
+#endif
+        for (size_t i = done; i < result.size(); i++)
+        {
+            result[i] = Kernel::scalar(environment, x[i]);
+        }
+    }
+}
+
+//////////
+//  Operations (Real32)
+void Batch::add32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                  std::span<uint32_t> result, Environment & environment)
+{
+    run<Add32>(x, y, result, environment);
+}
+
+void Batch::subtract32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                       std::span<uint32_t> result, Environment & environment)
+{
+    run<Subtract32>(x, y, result, environment);
+}
+
+void Batch::multiply32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                       std::span<uint32_t> result, Environment & environment)
+{
+    run<Multiply32>(x, y, result, environment);
+}
+
+void Batch::divide32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                     std::span<uint32_t> result, Environment & environment)
+{
+    run<Divide32>(x, y, result, environment);
+}
+
+void Batch::compare32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                      std::span<int> result, Environment & environment)
+{   //  FpValue compares by subtracting and keeps the flags the subtraction
+    //  raises, so there's nothing for lanes to gain - do it the scalar way
+    Q_ASSERT(x.size() == result.size() && y.size() == result.size());
+
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        result[i] = Real32::fromBitPattern(x[i]).compare(Real32::fromBitPattern(y[i]), environment);
+    }
+}
+
+void Batch::toReal64(std::span<const uint32_t> x,
+                     std::span<uint64_t> result, Environment & environment)
+{
+    run<Widen>(x, result, environment);
+}
+
+//////////
+//  Operations (Real64)
+void Batch::add64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                  std::span<uint64_t> result, Environment & environment)
+{
+    run<Add64>(x, y, result, environment);
+}
+
+void Batch::subtract64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                       std::span<uint64_t> result, Environment & environment)
+{
+    run<Subtract64>(x, y, result, environment);
+}
+
+void Batch::multiply64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                       std::span<uint64_t> result, Environment & environment)
+{
+    run<Multiply64>(x, y, result, environment);
+}
+
+void Batch::divide64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                     std::span<uint64_t> result, Environment & environment)
+{
+    run<Divide64>(x, y, result, environment);
+}
+
+void Batch::compare64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                      std::span<int> result, Environment & environment)
+{   //  FpValue compares by subtracting and keeps the flags the subtraction
+    //  raises, so there's nothing for lanes to gain - do it the scalar way
+    Q_ASSERT(x.size() == result.size() && y.size() == result.size());
+
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        result[i] = Real64::fromBitPattern(x[i]).compare(Real64::fromBitPattern(y[i]), environment);
+    }
+}
+
+void Batch::toReal32(std::span<const uint64_t> x,
+                     std::span<uint32_t> result, Environment & environment)
+{
+    run<Narrow>(x, result, environment);
+}
+
+//////////
+//  Properties
+const char * Batch::simdName()
+{
+#if defined(HADESVM_IEEE754_BATCH_AVX2)
+    if (hasAvx2())
+    {
+        return "AVX2+FMA";
+    }
+#endif
+    return "none";
+}
+
+//  End of hadesvm-ieee754/Batch.cpp
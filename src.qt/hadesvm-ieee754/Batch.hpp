@@ -0,0 +1,71 @@
+//
+//  hadesvm-ieee754/Batch.hpp
+//
+//  Batch operations on real values
+//
+//////////
+
+namespace hadesvm
+{
+    namespace ieee754
+    {
+        //////////
+        //  Applies an operation to whole spans of bit patterns.
+        //  Every batch operation produces the same results as the
+        //  corresponding Real32/Real64 operation applied to each element
+        //  in turn with the same environment; the environment thus ends
+        //  up with the union of exception flags raised by all elements.
+        //  All spans passed to an operation must be of the same size; the
+        //  result span may be the same as (but must not partially overlap)
+        //  an operand span.
+        //  Where the host allows, the elements are processed by SIMD code
+        //  selected at run time, with the elements the SIMD code can't do
+        //  bit-exactly (special values, extreme magnitudes, etc.) handed
+        //  over to the scalar path.
+        class HADESVM_IEEE754_PUBLIC Batch final
+        {
+            HADESVM_UTILITY_CLASS(Batch)
+
+            //////////
+            //  Operations (Real32)
+        public:
+            static void         add32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                                      std::span<uint32_t> result, Environment & environment = Environment::Default);
+            static void         subtract32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                                           std::span<uint32_t> result, Environment & environment = Environment::Default);
+            static void         multiply32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                                           std::span<uint32_t> result, Environment & environment = Environment::Default);
+            static void         divide32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                                         std::span<uint32_t> result, Environment & environment = Environment::Default);
+            static void         compare32(std::span<const uint32_t> x, std::span<const uint32_t> y,
+                                          std::span<int> result, Environment & environment = Environment::Default);
+            static void         toReal64(std::span<const uint32_t> x,
+                                         std::span<uint64_t> result, Environment & environment = Environment::Default);
+
+            //////////
+            //  Operations (Real64)
+        public:
+            static void         add64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                                      std::span<uint64_t> result, Environment & environment = Environment::Default);
+            static void         subtract64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                                           std::span<uint64_t> result, Environment & environment = Environment::Default);
+            static void         multiply64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                                           std::span<uint64_t> result, Environment & environment = Environment::Default);
+            static void         divide64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                                         std::span<uint64_t> result, Environment & environment = Environment::Default);
+            static void         compare64(std::span<const uint64_t> x, std::span<const uint64_t> y,
+                                          std::span<int> result, Environment & environment = Environment::Default);
+            static void         toReal32(std::span<const uint64_t> x,
+                                         std::span<uint32_t> result, Environment & environment = Environment::Default);
+
+            //////////
+            //  Properties
+        public:
+            //  The name of the SIMD instruction set used by batch operations
+            //  on this host, or "none" if they are all done by the scalar path.
+            static const char * simdName();
+        };
+    }
+}
+
+//  End of hadesvm-ieee754/Batch.hpp
@@ -40,11 +40,9 @@ FpValue::FpValue(bool isSignalingNanParam, bool isQuietNanParam, bool isInfinity
         }
         else
         {   //  Normalize the mantissa
-            while ((mantissa & UINT64_C(0x8000000000000000)) == 0)
-            {
-                mantissa <<= 1;
-                exponent--;
-            }
+            int shiftCount = static_cast<int>(qCountLeadingZeroBits(mantissa));
+            mantissa <<= shiftCount;
+            exponent = static_cast<int16_t>(exponent - shiftCount);
         }
     }
 }
@@ -624,10 +622,6 @@ FpValue FpValue::subtract(Environment & environment, const FpValue & x, const Fp
 
 FpValue FpValue::multiply(Environment & environment, const FpValue & x, const FpValue & y)
 {
-    uint64_t partialProducts[4];
-    int16_t resultExponent;
-    int i;
-
     if (x.isSignalingNan)
     {   //  Operand #1 is a signaling NaN
         environment.exception |= Exception::Operand;
@@ -692,30 +686,27 @@ FpValue FpValue::multiply(Environment & environment, const FpValue & x, const Fp
     }
     else
     {   //  Both operands are finite and not zero
-        partialProducts[0] = 0;
-        partialProducts[1] = (x.mantissa >> 32) * (y.mantissa >> 32);
-        partialProducts[2] = (x.mantissa & UINT64_C(0x00000000FFFFFFFF)) * (y.mantissa >> 32) +
-                             (y.mantissa & UINT64_C(0x00000000FFFFFFFF)) * (x.mantissa >> 32);
-        partialProducts[3] = (x.mantissa & UINT64_C(0x00000000FFFFFFFF)) * (y.mantissa & UINT64_C(0x00000000FFFFFFFF));
-        for (i = 3; i > 0; i--)
-        {
-            if ((partialProducts[i] & UINT64_C(0xFFFFFFFF00000000)) != 0)
-            {
-                partialProducts[i - 1] += (partialProducts[i] >> 32);
-                partialProducts[i] &= UINT64_C(0x00000000FFFFFFFF);
-            }
+        //  The 128-bit product of normalized mantissas has one of its 2
+        //  topmost bits set
+        uint64_t productLow = 0;
+        uint64_t productHigh = hadesvm::util::Math::multiply64x64(x.mantissa, y.mantissa, productLow);
+        int16_t resultExponent = static_cast<int16_t>(x.exponent + y.exponent);
+        if ((productHigh & UINT64_C(0x8000000000000000)) == 0)
+        {   //  Normalize here, so that the topmost bit of "productLow" is not lost
+            productHigh = (productHigh << 1) | (productLow >> 63);
+            productLow <<= 1;
+            resultExponent--;
+        }
+        if (productLow != 0)
+        {   //  Some "1" bits of the product do not fit into the mantissa
+            environment.exception |= Exception::Inexact;
         }
-        resultExponent = static_cast<int16_t>(x.exponent + y.exponent);
-        return FpValue(false, false, false, static_cast<uint8_t>((x.signBit == y.signBit) ? 0 : 1), resultExponent, (partialProducts[0] << 32) | partialProducts[1]);
+        return FpValue(false, false, false, static_cast<uint8_t>((x.signBit == y.signBit) ? 0 : 1), resultExponent, productHigh);
     }
 }
 
 FpValue FpValue::divide(Environment & environment, const FpValue & x, const FpValue & y)
 {
-    uint64_t dividend, divisor, resultMantissa;
-    int16_t resultExponent;
-    int i, bit;
-
     if (x.isSignalingNan)
     {   //  Operand #1 is a signaling NaN
         environment.exception |= Exception::Operand;
@@ -772,28 +763,22 @@ FpValue FpValue::divide(Environment & environment, const FpValue & x, const FpVa
     }
     else
     {   //  Both operands are finite and not zero
-        dividend = x.mantissa;
-        divisor = y.mantissa;
-        resultMantissa = 0;
-        for (i = 0; i < 64; i++)
-        {
-            bit = 0;
-            if (dividend >= divisor)
-            {
-                dividend -= divisor;
-                bit = 1;
-            }
-            resultMantissa = (resultMantissa << 1) | bit;
-            if (i == 0)
-            {
-                divisor >>= 1;
-            }
-            else
-            {
-                dividend <<= 1;
-            }
+        //  Divide the mantissas as a 128-bit dividend by a 64-bit divisor,
+        //  scaling the dividend so that the quotient has its topmost bit set
+        uint64_t dividendHigh = x.mantissa, dividendLow = 0;
+        int16_t resultExponent = static_cast<int16_t>(x.exponent - y.exponent);
+        if (x.mantissa >= y.mantissa)
+        {   //  The quotient of mantissas is in [1 .. 2)
+            dividendLow = dividendHigh << 63;
+            dividendHigh >>= 1;
+            resultExponent++;
+        }
+        uint64_t remainder = 0;
+        uint64_t resultMantissa = hadesvm::util::Math::divide128by64(dividendHigh, dividendLow, y.mantissa, remainder);
+        if (remainder != 0)
+        {   //  The quotient does not fit into the mantissa
+            environment.exception |= Exception::Inexact;
         }
-        resultExponent = static_cast<int16_t>(x.exponent - y.exponent + 1);
         return FpValue(false, false, false, static_cast<uint8_t>((x.signBit == y.signBit) ? 0 : 1), resultExponent, resultMantissa);
     }
 }
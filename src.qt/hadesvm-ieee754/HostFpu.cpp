@@ -0,0 +1,353 @@
+//
+//  hadesvm-ieee754/HostFpu.cpp
+//
+//  hadesvm::ieee754::HostFpu class implementation
+//
+//////////
+#include "hadesvm-ieee754/API.hpp"
+#include "hadesvm-ieee754/HostFpu.hxx"
+using namespace hadesvm::ieee754;
+
+#if defined(HADESVM_IEEE754_HOST_FPU)
+
+namespace
+{
+    //////////
+    //  IEEE-754 formats known to the host FPU
+    struct Binary64
+    {
+        using Host = double;
+        using Bits = uint64_t;
+        static const int ExponentShift = 52;
+        static const Bits ExponentMask = 0x07FF;
+        static const Bits SignMask = UINT64_C(0x8000000000000000);
+        static const Bits GuardBits = 64 - 53;  //  in an FpValue mantissa
+    };
+
+    struct Binary32
+    {
+        using Host = float;
+        using Bits = uint32_t;
+        static const int ExponentShift = 23;
+        static const Bits ExponentMask = 0x00FF;
+        static const Bits SignMask = 0x80000000;
+        static const Bits GuardBits = 64 - 24;  //  in an FpValue mantissa
+    };
+
+    //  Dekker's products of doubles are only error-free if none of their
+    //  partial products overflows or underflows; values with biased
+    //  exponents outside of this range are left to FpValue
+    const uint64_t MinSafeExponent64 = 2 * 53 + 8;
+    const uint64_t MaxSafeExponent64 = 2046 - 27 - 8;
+
+    template <class Format>
+    typename Format::Bits exponentOf(typename Format::Bits bitPattern)
+    {
+        return (bitPattern >> Format::ExponentShift) & Format::ExponentMask;
+    }
+
+    //  True if the value is a nonzero normalized finite value
+    template <class Format>
+    bool isNormalized(typename Format::Bits bitPattern)
+    {
+        typename Format::Bits exponent = exponentOf<Format>(bitPattern);
+        return exponent != 0 && exponent != Format::ExponentMask;
+    }
+
+    bool isSafeForProducts(uint64_t bitPattern)
+    {
+        uint64_t exponent = exponentOf<Binary64>(bitPattern);
+        return exponent >= MinSafeExponent64 && exponent <= MaxSafeExponent64;
+    }
+
+    template <class Host, class Bits>
+    Host toHost(Bits bitPattern)
+    {
+        Host value;
+        memcpy(&value, &bitPattern, sizeof(value));
+        return value;
+    }
+
+    template <class Bits, class Host>
+    Bits fromHost(Host value)
+    {
+        Bits bitPattern;
+        memcpy(&bitPattern, &value, sizeof(bitPattern));
+        return bitPattern;
+    }
+
+    //  Returns -1, 0 or +1 for a negative, zero or positive value
+    template <class Host>
+    int signOf(Host value)
+    {
+        return (value < 0) ? -1 : ((value > 0) ? 1 : 0);
+    }
+
+    //////////
+    //  Error-free transformations. Each computes the rounded-to-nearest
+    //  result of an operation and the sign of the rounding error "exact
+    //  result - rounded result". Every product is a statement of its own,
+    //  so that the compiler has no chance to contract it into an FMA.
+
+    //  Knuth's TwoSum - exact unless the sum overflows
+    template <class Host>
+    Host add(Host x, Host y, int & errorSign)
+    {
+        Host sum = x + y;
+        Host yVirtual = sum - x;
+        Host xVirtual = sum - yVirtual;
+        Host yRoundoff = y - yVirtual;
+        Host xRoundoff = x - xVirtual;
+        errorSign = signOf(xRoundoff + yRoundoff);
+        return sum;
+    }
+
+    //  Veltkamp's split of a double into two 26-bit halves
+    void split(double x, double & high, double & low)
+    {
+        double scaled = 134217729.0 * x;    //  2**27 + 1
+        high = scaled - (scaled - x);
+        low = x - high;
+    }
+
+    //  Dekker's TwoProduct; "high" + "low" is the exact product
+    void multiplyExactly(double x, double y, double & high, double & low)
+    {
+        double xHigh, xLow, yHigh, yLow;
+        split(x, xHigh, xLow);
+        split(y, yHigh, yLow);
+        high = x * y;
+        double highHigh = xHigh * yHigh;
+        double highLow = xHigh * yLow;
+        double lowHigh = xLow * yHigh;
+        double lowLow = xLow * yLow;
+        low = (((highHigh - high) + highLow) + lowHigh) + lowLow;
+    }
+
+    double multiply(double x, double y, int & errorSign)
+    {
+        double high, low;
+        multiplyExactly(x, y, high, low);
+        errorSign = signOf(low);
+        return high;
+    }
+
+    double divide(double x, double y, int & errorSign)
+    {   //  The quotient is too large if "x - quotient * y" has the sign
+        //  opposite to that of "y"; "x - high" is exact (Sterbenz)
+        double quotient = x / y;
+        double high, low;
+        multiplyExactly(quotient, y, high, low);
+        double difference = x - high;
+        errorSign = signOf(difference - low) * signOf(y);
+        return quotient;
+    }
+
+    //  A product of floats is exact as a double...
+    float multiply(float x, float y, int & errorSign)
+    {
+        double exact = static_cast<double>(x) * static_cast<double>(y);
+        float product = static_cast<float>(exact);
+        errorSign = signOf(exact - static_cast<double>(product));
+        return product;
+    }
+
+    //  ...and so is the product of a float quotient by a float divisor
+    float divide(float x, float y, int & errorSign)
+    {
+        float quotient = x / y;
+        double product = static_cast<double>(quotient) * static_cast<double>(y);
+        errorSign = signOf(static_cast<double>(x) - product) * signOf(y);
+        return quotient;
+    }
+
+    //////////
+    //  Completes an operation performed on the host FPU. The host FPU has
+    //  rounded the result to nearest, but the FpValue-based path truncates.
+    //  The "inexactAllowed" tells whether an inexact result of the operation
+    //  is truncated by the FpValue-based path exactly the IEEE-754 way.
+    template <class Format>
+    bool complete(Environment & environment,
+                  typename Format::Host hostResult, int errorSign,
+                  bool inexactAllowed, typename Format::Bits & result)
+    {
+        using Bits = typename Format::Bits;
+
+        Bits resultBits = fromHost<Bits>(hostResult);
+        if (!isNormalized<Format>(resultBits))
+        {   //  Let FpValue take care of overflows, underflows, etc.
+            return false;
+        }
+        if (errorSign != 0)
+        {   //  The result is inexact...
+            if (!inexactAllowed)
+            {   //  ...and FpValue may disagree with IEEE-754
+                return false;
+            }
+            if (errorSign != signOf(hostResult))
+            {   //  Rounded away from zero - step one ulp towards zero instead
+                resultBits--;
+                if (!isNormalized<Format>(resultBits))
+                {   //  Let FpValue take care of this
+                    return false;
+                }
+            }
+            environment.exception |= Exception::Inexact;
+        }
+        result = resultBits;
+        return true;
+    }
+
+    //  FpValue truncates sums of magnitudes, products and quotients exactly.
+    //  A difference of magnitudes is truncated exactly as long as aligning
+    //  the operands' exponents doesn't shift any bits out of FpValue's 64-bit
+    //  mantissa; otherwise it is only reproduced exactly when it is exact.
+    template <class Format>
+    bool truncatesExactly(typename Format::Bits x, typename Format::Bits y, bool subtract)
+    {
+        bool addsMagnitudes = (((x ^ y) & Format::SignMask) == 0) != subtract;
+        typename Format::Bits xExponent = exponentOf<Format>(x), yExponent = exponentOf<Format>(y);
+        return addsMagnitudes ||
+               ((xExponent > yExponent) ? (xExponent - yExponent) : (yExponent - xExponent)) <= Format::GuardBits;
+    }
+}
+
+//////////
+//  Operations
+bool HostFpu::add64(Environment & environment, uint64_t x, uint64_t y, uint64_t & result)
+{
+    if (!isNormalized<Binary64>(x) || !isNormalized<Binary64>(y))
+    {   //  Zeros, denormals, infinities and NaNs are left to FpValue
+        return false;
+    }
+    int errorSign = 0;
+    double sum = add(toHost<double>(x), toHost<double>(y), errorSign);
+    return complete<Binary64>(environment, sum, errorSign, truncatesExactly<Binary64>(x, y, false), result);
+}
+
+bool HostFpu::subtract64(Environment & environment, uint64_t x, uint64_t y, uint64_t & result)
+{
+    if (!isNormalized<Binary64>(x) || !isNormalized<Binary64>(y))
+    {   //  Zeros, denormals, infinities and NaNs are left to FpValue
+        return false;
+    }
+    int errorSign = 0;
+    double difference = add(toHost<double>(x), -toHost<double>(y), errorSign);
+    return complete<Binary64>(environment, difference, errorSign, truncatesExactly<Binary64>(x, y, true), result);
+}
+
+bool HostFpu::multiply64(Environment & environment, uint64_t x, uint64_t y, uint64_t & result)
+{
+    if (!isSafeForProducts(x) || !isSafeForProducts(y))
+    {   //  Special values and extreme magnitudes are left to FpValue
+        return false;
+    }
+    int errorSign = 0;
+    double product = multiply(toHost<double>(x), toHost<double>(y), errorSign);
+    return isSafeForProducts(fromHost<uint64_t>(product)) &&
+           complete<Binary64>(environment, product, errorSign, true, result);
+}
+
+bool HostFpu::divide64(Environment & environment, uint64_t x, uint64_t y, uint64_t & result)
+{
+    if (!isSafeForProducts(x) || !isSafeForProducts(y))
+    {   //  Special values and extreme magnitudes are left to FpValue
+        return false;
+    }
+    int errorSign = 0;
+    double quotient = divide(toHost<double>(x), toHost<double>(y), errorSign);
+    return isSafeForProducts(fromHost<uint64_t>(quotient)) &&
+           complete<Binary64>(environment, quotient, errorSign, true, result);
+}
+
+bool HostFpu::add32(Environment & environment, uint32_t x, uint32_t y, uint32_t & result)
+{
+    if (!isNormalized<Binary32>(x) || !isNormalized<Binary32>(y))
+    {   //  Zeros, denormals, infinities and NaNs are left to FpValue
+        return false;
+    }
+    int errorSign = 0;
+    float sum = add(toHost<float>(x), toHost<float>(y), errorSign);
+    return complete<Binary32>(environment, sum, errorSign, truncatesExactly<Binary32>(x, y, false), result);
+}
+
+bool HostFpu::subtract32(Environment & environment, uint32_t x, uint32_t y, uint32_t & result)
+{
+    if (!isNormalized<Binary32>(x) || !isNormalized<Binary32>(y))
+    {   //  Zeros, denormals, infinities and NaNs are left to FpValue
+        return false;
+    }
+    int errorSign = 0;
+    float difference = add(toHost<float>(x), -toHost<float>(y), errorSign);
+    return complete<Binary32>(environment, difference, errorSign, truncatesExactly<Binary32>(x, y, true), result);
+}
+
+bool HostFpu::multiply32(Environment & environment, uint32_t x, uint32_t y, uint32_t & result)
+{
+    if (!isNormalized<Binary32>(x) || !isNormalized<Binary32>(y))
+    {   //  Zeros, denormals, infinities and NaNs are left to FpValue
+        return false;
+    }
+    int errorSign = 0;
+    float product = multiply(toHost<float>(x), toHost<float>(y), errorSign);
+    return complete<Binary32>(environment, product, errorSign, true, result);
+}
+
+bool HostFpu::divide32(Environment & environment, uint32_t x, uint32_t y, uint32_t & result)
+{
+    if (!isNormalized<Binary32>(x) || !isNormalized<Binary32>(y))
+    {   //  Zeros, denormals, infinities and NaNs are left to FpValue
+        return false;
+    }
+    int errorSign = 0;
+    float quotient = divide(toHost<float>(x), toHost<float>(y), errorSign);
+    return complete<Binary32>(environment, quotient, errorSign, true, result);
+}
+
+#else   //  HADESVM_IEEE754_HOST_FPU
+
+//////////
+//  Operations - no usable host FPU, always use the FpValue-based path
+bool HostFpu::add64(Environment & /*environment*/, uint64_t /*x*/, uint64_t /*y*/, uint64_t & /*result*/)
+{
+    return false;
+}
+
+bool HostFpu::subtract64(Environment & /*environment*/, uint64_t /*x*/, uint64_t /*y*/, uint64_t & /*result*/)
+{
+    return false;
+}
+
+bool HostFpu::multiply64(Environment & /*environment*/, uint64_t /*x*/, uint64_t /*y*/, uint64_t & /*result*/)
+{
+    return false;
+}
+
+bool HostFpu::divide64(Environment & /*environment*/, uint64_t /*x*/, uint64_t /*y*/, uint64_t & /*result*/)
+{
+    return false;
+}
+
+bool HostFpu::add32(Environment & /*environment*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t & /*result*/)
+{
+    return false;
+}
+
+bool HostFpu::subtract32(Environment & /*environment*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t & /*result*/)
+{
+    return false;
+}
+
+bool HostFpu::multiply32(Environment & /*environment*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t & /*result*/)
+{
+    return false;
+}
+
+bool HostFpu::divide32(Environment & /*environment*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t & /*result*/)
+{
+    return false;
+}
+
+#endif  //  HADESVM_IEEE754_HOST_FPU
+
+//  End of hadesvm-ieee754/HostFpu.cpp
@@ -0,0 +1,58 @@
+//
+//  hadesvm-ieee754/HostFpu.hxx
+//
+//  A host FPU fast path for ieee754 arithmetic
+//
+//////////
+
+//  The host FPU can only be used if its float/double arithmetic is genuine
+//  IEEE-754 binary32/binary64 arithmetic with no excess precision
+#if defined(Q_PROCESSOR_X86_64) || defined(Q_PROCESSOR_ARM_64)
+    #define HADESVM_IEEE754_HOST_FPU
+#endif
+
+namespace hadesvm
+{
+    namespace ieee754
+    {
+        //////////
+        //  Performs the basic arithmetic on the host FPU.
+        //  Every operation either produces exactly the same result (and the
+        //  same exception flags) as the FpValue-based path would, returning
+        //  true, or does nothing and returns false, in which case the caller
+        //  must fall back to the FpValue-based path. The latter happens when:
+        //  *   an operand is a zero, a denormal, an infinity or a NaN, or
+        //  *   the result would overflow, underflow or be denormalized, or
+        //  *   an operand or the result of a 64-bit product or quotient is
+        //      so large or so small that its error can't be computed exactly, or
+        //  *   the result is an inexact difference of magnitudes of operands
+        //      so far apart that the FpValue-based path loses bits of the
+        //      smaller one before subtracting, thus not truncating the exact
+        //      difference.
+        //  As the FpValue-based path always truncates, regardless of the
+        //  environment's rounding mode, so does the host FPU path. The host
+        //  FPU is left in its default "to nearest" rounding mode, as changing
+        //  modes costs more than the operation itself; the truncated result
+        //  and its exactness are derived from the error-free transformations
+        //  of the rounded-to-nearest result instead.
+        class HostFpu final
+        {
+            HADESVM_UTILITY_CLASS(HostFpu)
+
+            //////////
+            //  Operations
+        public:
+            static bool         add64(Environment & environment, uint64_t x, uint64_t y, uint64_t & result);
+            static bool         subtract64(Environment & environment, uint64_t x, uint64_t y, uint64_t & result);
+            static bool         multiply64(Environment & environment, uint64_t x, uint64_t y, uint64_t & result);
+            static bool         divide64(Environment & environment, uint64_t x, uint64_t y, uint64_t & result);
+
+            static bool         add32(Environment & environment, uint32_t x, uint32_t y, uint32_t & result);
+            static bool         subtract32(Environment & environment, uint32_t x, uint32_t y, uint32_t & result);
+            static bool         multiply32(Environment & environment, uint32_t x, uint32_t y, uint32_t & result);
+            static bool         divide32(Environment & environment, uint32_t x, uint32_t y, uint32_t & result);
+        };
+    }
+}
+
+//  End of hadesvm-ieee754/HostFpu.hxx
@@ -6,6 +6,7 @@
 //////////
 #include "hadesvm-ieee754/API.hpp"
 #include "hadesvm-ieee754/FpValue.hxx"
+#include "hadesvm-ieee754/HostFpu.hxx"
 using namespace hadesvm::ieee754;
 
 //////////
@@ -256,6 +257,11 @@ Real64 Real32::toReal64(Environment & environment) const
 
 Real32 Real32::add(const Real32 & op2, Environment & environment) const
 {
+    uint32_t hostResult = 0;
+    if (HostFpu::add32(environment, this->bitPattern, op2.bitPattern, hostResult))
+    {   //  The host FPU has done it
+        return Real32(hostResult, true);
+    }
     bool xDenormalized = false, yDenormalized = false;
     FpValue xValue = FpValue::parse32(xDenormalized, this->bitPattern);
     FpValue yValue = FpValue::parse32(yDenormalized, op2.bitPattern);
@@ -265,6 +271,11 @@ Real32 Real32::add(const Real32 & op2, Environment & environment) const
 
 Real32 Real32::subtract(const Real32 & op2, Environment & environment) const
 {
+    uint32_t hostResult = 0;
+    if (HostFpu::subtract32(environment, this->bitPattern, op2.bitPattern, hostResult))
+    {   //  The host FPU has done it
+        return Real32(hostResult, true);
+    }
     bool xDenormalized = false, yDenormalized = false;
     FpValue xValue = FpValue::parse32(xDenormalized, this->bitPattern);
     FpValue yValue = FpValue::parse32(yDenormalized, op2.bitPattern);
@@ -274,6 +285,11 @@ Real32 Real32::subtract(const Real32 & op2, Environment & environment) const
 
 Real32 Real32::multiply(const Real32 & op2, Environment & environment) const
 {
+    uint32_t hostResult = 0;
+    if (HostFpu::multiply32(environment, this->bitPattern, op2.bitPattern, hostResult))
+    {   //  The host FPU has done it
+        return Real32(hostResult, true);
+    }
     bool xDenormalized = false, yDenormalized = false;
     FpValue xValue = FpValue::parse32(xDenormalized, this->bitPattern);
     FpValue yValue = FpValue::parse32(yDenormalized, op2.bitPattern);
@@ -283,6 +299,11 @@ Real32 Real32::multiply(const Real32 & op2, Environment & environment) const
 
 Real32 Real32::divide(const Real32 & op2, Environment & environment) const
 {
+    uint32_t hostResult = 0;
+    if (HostFpu::divide32(environment, this->bitPattern, op2.bitPattern, hostResult))
+    {   //  The host FPU has done it
+        return Real32(hostResult, true);
+    }
     bool xDenormalized = false, yDenormalized = false;
     FpValue xValue = FpValue::parse32(xDenormalized, this->bitPattern);
     FpValue yValue = FpValue::parse32(yDenormalized, op2.bitPattern);
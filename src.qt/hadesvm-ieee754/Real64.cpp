@@ -6,8 +6,101 @@
 //////////
 #include "hadesvm-ieee754/API.hpp"
 #include "hadesvm-ieee754/FpValue.hxx"
+#include "hadesvm-ieee754/HostFpu.hxx"
 using namespace hadesvm::ieee754;
 
+namespace
+{
+    //  If the value is exactly representable as a normalized Real32, stores
+    //  the Real32 bit pattern into "narrowed" and returns true
+    bool narrowExactly(uint64_t bitPattern, uint32_t & narrowed)
+    {
+        uint64_t exponent = (bitPattern >> 52) & 0x07FF;
+        if (exponent < 1023 - 126 || exponent > 1023 + 127 ||
+            (bitPattern & UINT64_C(0x000000001FFFFFFF)) != 0)
+        {   //  Out of range, a special value or too many mantissa bits
+            return false;
+        }
+        narrowed = static_cast<uint32_t>((bitPattern >> 32) & 0x80000000) |
+                   static_cast<uint32_t>((exponent - 1023 + 127) << 23) |
+                   static_cast<uint32_t>((bitPattern >> 29) & 0x007FFFFF);
+        return true;
+    }
+
+    //  Widens a normalized Real32 bit pattern
+    uint64_t widen(uint32_t bitPattern)
+    {
+        uint64_t exponent = (bitPattern >> 23) & 0x00FF;
+        return (static_cast<uint64_t>(bitPattern & 0x80000000) << 32) |
+               ((exponent - 127 + 1023) << 52) |
+               (static_cast<uint64_t>(bitPattern & 0x007FFFFF) << 29);
+    }
+
+    //  The FpValue mantissa bits that a Real32 can't hold
+    const uint64_t Real32DroppedBits = UINT64_C(0x000000FFFFFFFFFF);
+
+    //  If the value is in the normalized range of Real32, parses it straight
+    //  from its 64-bit encoding into the same FpValue that narrowing it to
+    //  Real32 and parsing that would produce, raising the same exceptions,
+    //  and returns true
+    bool parseAsReal32(Environment & environment, uint64_t bitPattern, FpValue & value)
+    {
+        uint64_t exponent = (bitPattern >> 52) & 0x07FF;
+        if (exponent < 1023 - 126 || exponent > 1023 + 127)
+        {   //  Out of range or a special value
+            return false;
+        }
+        bool denormalized = false;
+        value = FpValue::parse64(denormalized, bitPattern);
+        if ((value.mantissa & Real32DroppedBits) != 0)
+        {
+            environment.exception |= Exception::Inexact;
+            value.mantissa &= ~Real32DroppedBits;
+        }
+        return true;
+    }
+
+    //  If the result of an operation on Real32 values is a zero or is in
+    //  the normalized range of Real32, truncates it to Real32 and stores
+    //  its 64-bit encoding into "result", raising the same exceptions as
+    //  building a Real32 and widening it would, and returns true
+    bool buildAsReal32(Environment & environment, FpValue value, uint64_t & result)
+    {
+        if (value.isSignalingNan || value.isQuietNan || value.isInfinity ||
+            (value.mantissa != 0 && (value.exponent > 128 || value.exponent < -125)))
+        {   //  Special, overflowing or denormalized
+            return false;
+        }
+        if ((value.mantissa & Real32DroppedBits) != 0)
+        {
+            environment.exception |= Exception::Inexact;
+            value.mantissa &= ~Real32DroppedBits;
+        }
+        result = value.build64(environment);
+        return true;
+    }
+
+    //  Performs a Real32 operation on operands and a result kept in their
+    //  64-bit encodings without building the Real32 encodings in between.
+    //  If an operand or the result is outside the normalized range of
+    //  Real32, does nothing and returns false.
+    template <class Operation>
+    bool operateAsReal32(Environment & environment, uint64_t x, uint64_t y, Operation operation, uint64_t & result)
+    {   //  Exceptions are only raised once the result is known to be good
+        Environment operationEnvironment;
+        operationEnvironment.roundingMode = environment.roundingMode;
+        FpValue xValue, yValue;
+        if (!parseAsReal32(operationEnvironment, x, xValue) ||
+            !parseAsReal32(operationEnvironment, y, yValue) ||
+            !buildAsReal32(operationEnvironment, operation(operationEnvironment, xValue, yValue), result))
+        {
+            return false;
+        }
+        environment.exception |= operationEnvironment.exception;
+        return true;
+    }
+}
+
 //////////
 //  Construction/destruction/assignment
 Real64::Real64(uint64_t bitPatternParam, bool /*dummy*/)
@@ -256,6 +349,11 @@ Real32 Real64::toReal32(Environment & environment) const
 
 Real64 Real64::add(const Real64 & op2, Environment & environment) const
 {
+    uint64_t hostResult = 0;
+    if (HostFpu::add64(environment, this->bitPattern, op2.bitPattern, hostResult))
+    {   //  The host FPU has done it
+        return Real64(hostResult, true);
+    }
     bool xDenormalized = false, yDenormalized = false;
     FpValue xValue = FpValue::parse64(xDenormalized, this->bitPattern);
     FpValue yValue = FpValue::parse64(yDenormalized, op2.bitPattern);
@@ -265,6 +363,11 @@ Real64 Real64::add(const Real64 & op2, Environment & environment) const
 
 Real64 Real64::subtract(const Real64 & op2, Environment & environment) const
 {
+    uint64_t hostResult = 0;
+    if (HostFpu::subtract64(environment, this->bitPattern, op2.bitPattern, hostResult))
+    {   //  The host FPU has done it
+        return Real64(hostResult, true);
+    }
     bool xDenormalized = false, yDenormalized = false;
     FpValue xValue = FpValue::parse64(xDenormalized, this->bitPattern);
     FpValue yValue = FpValue::parse64(yDenormalized, op2.bitPattern);
@@ -274,6 +377,11 @@ Real64 Real64::subtract(const Real64 & op2, Environment & environment) const
 
 Real64 Real64::multiply(const Real64 & op2, Environment & environment) const
 {
+    uint64_t hostResult = 0;
+    if (HostFpu::multiply64(environment, this->bitPattern, op2.bitPattern, hostResult))
+    {   //  The host FPU has done it
+        return Real64(hostResult, true);
+    }
     bool xDenormalized = false, yDenormalized = false;
     FpValue xValue = FpValue::parse64(xDenormalized, this->bitPattern);
     FpValue yValue = FpValue::parse64(yDenormalized, op2.bitPattern);
@@ -283,6 +391,11 @@ Real64 Real64::multiply(const Real64 & op2, Environment & environment) const
 
 Real64 Real64::divide(const Real64 & op2, Environment & environment) const
 {
+    uint64_t hostResult = 0;
+    if (HostFpu::divide64(environment, this->bitPattern, op2.bitPattern, hostResult))
+    {   //  The host FPU has done it
+        return Real64(hostResult, true);
+    }
     bool xDenormalized = false, yDenormalized = false;
     FpValue xValue = FpValue::parse64(xDenormalized, this->bitPattern);
     FpValue yValue = FpValue::parse64(yDenormalized, op2.bitPattern);
@@ -364,4 +477,68 @@ Real64 Real64::sqrt(Environment & environment) const
     return Real64(xValue.build64(environment), true);
 }
 
+Real64 Real64::addAsReal32(const Real64 & op2, Environment & environment) const
+{
+    uint32_t x = 0, y = 0, hostResult = 0;
+    if (narrowExactly(this->bitPattern, x) && narrowExactly(op2.bitPattern, y) &&
+        HostFpu::add32(environment, x, y, hostResult))
+    {   //  Neither conversion could have raised an exception
+        return Real64(widen(hostResult), true);
+    }
+    uint64_t result = 0;
+    if (operateAsReal32(environment, this->bitPattern, op2.bitPattern, FpValue::add, result))
+    {
+        return Real64(result, true);
+    }
+    return toReal32(environment).add(op2.toReal32(environment), environment).toReal64(environment);
+}
+
+Real64 Real64::subtractAsReal32(const Real64 & op2, Environment & environment) const
+{
+    uint32_t x = 0, y = 0, hostResult = 0;
+    if (narrowExactly(this->bitPattern, x) && narrowExactly(op2.bitPattern, y) &&
+        HostFpu::subtract32(environment, x, y, hostResult))
+    {   //  Neither conversion could have raised an exception
+        return Real64(widen(hostResult), true);
+    }
+    uint64_t result = 0;
+    if (operateAsReal32(environment, this->bitPattern, op2.bitPattern, FpValue::subtract, result))
+    {
+        return Real64(result, true);
+    }
+    return toReal32(environment).subtract(op2.toReal32(environment), environment).toReal64(environment);
+}
+
+Real64 Real64::multiplyAsReal32(const Real64 & op2, Environment & environment) const
+{
+    uint32_t x = 0, y = 0, hostResult = 0;
+    if (narrowExactly(this->bitPattern, x) && narrowExactly(op2.bitPattern, y) &&
+        HostFpu::multiply32(environment, x, y, hostResult))
+    {   //  Neither conversion could have raised an exception
+        return Real64(widen(hostResult), true);
+    }
+    uint64_t result = 0;
+    if (operateAsReal32(environment, this->bitPattern, op2.bitPattern, FpValue::multiply, result))
+    {
+        return Real64(result, true);
+    }
+    return toReal32(environment).multiply(op2.toReal32(environment), environment).toReal64(environment);
+}
+
+Real64 Real64::divideAsReal32(const Real64 & op2, Environment & environment) const
+{
+    uint32_t x = 0, y = 0, hostResult = 0;
+    if (narrowExactly(this->bitPattern, x) && narrowExactly(op2.bitPattern, y) &&
+        HostFpu::divide32(environment, x, y, hostResult))
+    {   //  Neither conversion could have raised an exception
+        return Real64(widen(hostResult), true);
+    }
+    uint64_t result = 0;
+    if (operateAsReal32(environment, this->bitPattern, op2.bitPattern, FpValue::divide, result))
+    {
+        return Real64(result, true);
+    }
+    return toReal32(environment).divide(op2.toReal32(environment), environment).toReal64(environment);
+}
+
 //  End of hadesvm-ieee754/Real64.cpp
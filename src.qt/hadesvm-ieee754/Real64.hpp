@@ -66,6 +66,15 @@ namespace hadesvm
 
             Real64              sqrt(Environment & environment = Environment::Default) const;
 
+            //  Single-precision arithmetic on values kept in 64-bit form. Each
+            //  is the same as narrowing both operands to Real32, performing the
+            //  Real32 operation and widening the result back to Real64, except
+            //  that no conversions are performed when operands are exact Real32s.
+            Real64              addAsReal32(const Real64 & op2, Environment & environment = Environment::Default) const;
+            Real64              subtractAsReal32(const Real64 & op2, Environment & environment = Environment::Default) const;
+            Real64              multiplyAsReal32(const Real64 & op2, Environment & environment = Environment::Default) const;
+            Real64              divideAsReal32(const Real64 & op2, Environment & environment = Environment::Default) const;
+
             //////////
             //  Operators
         public:
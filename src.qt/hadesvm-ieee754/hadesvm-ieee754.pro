@@ -4,17 +4,21 @@ TEMPLATE = lib
 DEFINES += HADESVM_IEEE754_LIBRARY
 
 SOURCES += \
+    Batch.cpp \
     Environment.cpp \
     FpValue.cpp \
+    HostFpu.cpp \
     Real21.cpp \
     Real32.cpp \
     Real64.cpp
 
 HEADERS += \
     API.hpp \
+    Batch.hpp \
     Classes.hpp \
     Environment.hpp \
     FpValue.hxx \
+    HostFpu.hxx \
     Linkage.hpp \
     Real21.hpp \
     Real32.hpp \
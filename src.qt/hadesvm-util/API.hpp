@@ -40,14 +40,25 @@
 #endif
 
 #include <math.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <span>
 
 #include <QtCore/qglobal.h>
+#if defined(Q_PROCESSOR_X86_64)
+    #include <immintrin.h>
+#endif
 
 #include <QApplication>
 #include <QAction>
 #include <QBackingStore>
 #include <QCloseEvent>
 #include <QColor>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDeadlineTimer>
 #include <QDialog>
 #include <QDir>
 #include <QDomDocument>
@@ -55,12 +66,14 @@
 #include <QElapsedTimer>
 #include <QException>
 #include <QFileDialog>
+#include <QHash>
 #include <QHostInfo>
 #include <QIcon>
 #include <QLabel>
 #include <QLibrary>
 #include <QList>
 #include <QMainWindow>
+#include <QMap>
 #include <QMenu>
 #include <QMenuBar>
 #include <QMessageBox>
@@ -77,12 +90,14 @@
 #include <QTextEdit>
 #include <QTextStream>
 #include <QThread>
+#include <QThreadPool>
 #include <QTimer>
 #include <QTreeWidget>
 #include <QTreeWidgetItem>
 #include <QUuid>
 #include <QVariant>
 #include <QVersionNumber>
+#include <QWaitCondition>
 #include <QWidget>
 
 #if defined(Q_CC_GNU)
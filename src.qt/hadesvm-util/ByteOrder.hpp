@@ -27,6 +27,120 @@ namespace hadesvm
 
         template <>
         HADESVM_UTIL_PUBLIC bool fromString<ByteOrder>(const QString & s, qsizetype & scan, ByteOrder & value);
+
+        //////////
+        //  Byte swapping
+        inline uint16_t swapBytes(uint16_t x)
+        {
+#if defined Q_CC_MSVC
+            return _byteswap_ushort(x);
+#else
+            return std::byteswap<uint16_t>(x);
+#endif
+        }
+
+        inline uint32_t swapBytes(uint32_t x)
+        {
+#if defined Q_CC_MSVC
+            return _byteswap_ulong(x);
+#else
+            return std::byteswap<uint32_t>(x);
+#endif
+        }
+
+        inline uint64_t swapBytes(uint64_t x)
+        {
+#if defined Q_CC_MSVC
+            return _byteswap_uint64(x);
+#else
+            return std::byteswap<uint64_t>(x);
+#endif
+        }
+
+        //  Loads/stores a naturally aligned 16/32/64-bit value that is
+        //  kept in host memory in the specified byte order
+        template <class T>
+        inline T loadWithByteOrder(const uint8_t * data, ByteOrder byteOrder)
+        {
+            T value = *reinterpret_cast<const T*>(data);
+            return (byteOrder == ByteOrder::Native) ? value : swapBytes(value);
+        }
+
+        template <class T>
+        inline void storeWithByteOrder(uint8_t * data, T value, ByteOrder byteOrder)
+        {
+            *reinterpret_cast<T*>(data) = (byteOrder == ByteOrder::Native) ? value : swapBytes(value);
+        }
+
+        //  Same as above, but the value need not be naturally aligned
+        template <class T>
+        inline T loadUnalignedWithByteOrder(const uint8_t * data, ByteOrder byteOrder)
+        {
+            T value = 0;
+            memcpy(&value, data, sizeof(T));
+            return (byteOrder == ByteOrder::Native) ? value : swapBytes(value);
+        }
+
+        template <class T>
+        inline void storeUnalignedWithByteOrder(uint8_t * data, T value, ByteOrder byteOrder)
+        {
+            if (byteOrder != ByteOrder::Native)
+            {
+                value = swapBytes(value);
+            }
+            memcpy(data, &value, sizeof(T));
+        }
+
+        //  Atomically replaces a naturally aligned 16/32/64-bit value kept in
+        //  host memory in the specified byte order, returning the old value
+        template <class T>
+        inline T exchangeWithByteOrder(uint8_t * data, T value, ByteOrder byteOrder)
+        {
+            std::atomic_ref<T> target(*reinterpret_cast<T*>(data));
+            if (byteOrder == ByteOrder::Native)
+            {
+                return target.exchange(value);
+            }
+            return swapBytes(target.exchange(swapBytes(value)));
+        }
+
+        //  Bulk versions of the naturally aligned loads/stores, for "count"
+        //  consecutive values; the swapping loop is simple enough for the
+        //  compiler to vectorize
+        template <class T>
+        inline void swapBytes(T * values, size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                values[i] = swapBytes(values[i]);
+            }
+        }
+
+        template <class T>
+        inline void loadWithByteOrder(T * values, const uint8_t * data, size_t count, ByteOrder byteOrder)
+        {
+            memcpy(values, data, count * sizeof(T));
+            if (byteOrder != ByteOrder::Native)
+            {
+                swapBytes(values, count);
+            }
+        }
+
+        template <class T>
+        inline void storeWithByteOrder(uint8_t * data, const T * values, size_t count, ByteOrder byteOrder)
+        {
+            if (byteOrder != ByteOrder::Native)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    reinterpret_cast<T*>(data)[i] = swapBytes(values[i]);
+                }
+            }
+            else
+            {
+                memcpy(data, values, count * sizeof(T));
+            }
+        }
     }
 }
 
@@ -214,6 +214,65 @@ bool hadesvm::util::fromString<unsigned long long>(const QString & s, qsizetype
     return parseUnsigned(s, scan, 10, value);
 }
 
+template <>
+bool hadesvm::util::fromString<double>(const QString & s, qsizetype & scan, double & value)
+{   //  [+|-]digits[.digits][e|E[+|-]digits], at least one mantissa digit
+    qsizetype prescan = scan;
+    qsizetype numDigits = 0;
+
+    //  Handle sign
+    if (prescan < s.length() && (s[prescan] == '+' || s[prescan] == '-'))
+    {
+        prescan++;
+    }
+    //  Handle mantissa
+    while (prescan < s.length() && s[prescan].isDigit())
+    {
+        prescan++;
+        numDigits++;
+    }
+    if (prescan < s.length() && s[prescan] == '.')
+    {
+        prescan++;
+        while (prescan < s.length() && s[prescan].isDigit())
+        {
+            prescan++;
+            numDigits++;
+        }
+    }
+    if (numDigits == 0)
+    {   //  OOPS! No digits!
+        return false;
+    }
+    //  Handle exponent (only if well-formed)
+    if (prescan < s.length() && (s[prescan] == 'e' || s[prescan] == 'E'))
+    {
+        qsizetype exponentScan = prescan + 1;
+        if (exponentScan < s.length() && (s[exponentScan] == '+' || s[exponentScan] == '-'))
+        {
+            exponentScan++;
+        }
+        if (exponentScan < s.length() && s[exponentScan].isDigit())
+        {
+            while (exponentScan < s.length() && s[exponentScan].isDigit())
+            {
+                exponentScan++;
+            }
+            prescan = exponentScan;
+        }
+    }
+    //  Convert
+    bool ok = false;
+    double temp = s.mid(scan, prescan - scan).toDouble(&ok);
+    if (ok)
+    {
+        value = temp;
+        scan = prescan;
+        return true;
+    }
+    return false;
+}
+
 //////////
 //  fromString() specializations for C++ types (formatted parsing)
 template <>
@@ -39,6 +39,63 @@ namespace hadesvm
             //  Checks if a floating-point value is a negative infinity.
             static bool                 isNegativeInfinite(float x);
             static bool                 isNegativeInfinite(double x);
+
+            //////////
+            //  Operations (128-bit integer)
+        public:
+            //  Multiplies two 64-bit unsigned values, returning the upper
+            //  64 bits of the 128-bit product and storing the lower 64 bits
+            //  into "low".
+            static uint64_t             multiply64x64(uint64_t x, uint64_t y, uint64_t & low)
+            {
+#if defined(__SIZEOF_INT128__)
+                unsigned __int128 product = static_cast<unsigned __int128>(x) * y;
+                low = static_cast<uint64_t>(product);
+                return static_cast<uint64_t>(product >> 64);
+#else
+                uint64_t xLow = x & 0xFFFFFFFF, xHigh = x >> 32;
+                uint64_t yLow = y & 0xFFFFFFFF, yHigh = y >> 32;
+                uint64_t lowLow = xLow * yLow;
+                uint64_t highLow = xHigh * yLow;
+                uint64_t lowHigh = xLow * yHigh;
+                uint64_t highHigh = xHigh * yHigh;
+                //  This can't overflow: 3 * (2**32 - 1) + (2**32 - 1)**2 < 2**64
+                uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+                low = (middle << 32) | (lowLow & 0xFFFFFFFF);
+                return highHigh + (highLow >> 32) + (middle >> 32);
+#endif
+            }
+
+            //  Divides the 128-bit unsigned value "high:low" by a 64-bit
+            //  unsigned "divisor", returning the 64-bit quotient and storing
+            //  the remainder into "remainder". The "high" must be less than
+            //  the "divisor" so that the quotient fits into 64 bits.
+            static uint64_t             divide128by64(uint64_t high, uint64_t low, uint64_t divisor, uint64_t & remainder)
+            {
+                Q_ASSERT(high < divisor);
+#if defined(__SIZEOF_INT128__)
+                unsigned __int128 dividend = (static_cast<unsigned __int128>(high) << 64) | low;
+                remainder = static_cast<uint64_t>(dividend % divisor);
+                return static_cast<uint64_t>(dividend / divisor);
+#else
+                uint64_t quotient = 0;
+                for (int i = 0; i < 64; i++)
+                {   //  Shift the next dividend bit into the 65-bit partial remainder...
+                    bool carry = (high >> 63) != 0;
+                    high = (high << 1) | (low >> 63);
+                    low <<= 1;
+                    quotient <<= 1;
+                    //  ...and subtract the divisor if it fits
+                    if (carry || high >= divisor)
+                    {
+                        high -= divisor;
+                        quotient |= 1;
+                    }
+                }
+                remainder = high;
+                return quotient;
+#endif
+            }
         };
     }
 }
@@ -0,0 +1,59 @@
+//
+//  hadesvm-util/Sync.cpp
+//
+//  Thread synchronization
+//
+//////////
+#include "hadesvm-util/API.hpp"
+using namespace hadesvm::util;
+
+//////////
+//  Barrier
+Barrier::Barrier(size_t numThreads)
+    :   _guard(),
+        _allArrived(),
+        _numThreads(numThreads),
+        _numArrived(0),
+        _generation(0)
+{
+}
+
+void Barrier::arriveAndWait()
+{
+    arriveAndWait([] {});
+}
+
+void Barrier::arriveAndWait(const std::function<void()> & completion)
+{
+    QMutexLocker lock(&_guard);
+
+    uint64_t generation = _generation;
+    if (++_numArrived >= _numThreads)
+    {   //  The last one to arrive lets everybody go
+        completion();
+        _numArrived = 0;
+        _generation++;
+        _allArrived.wakeAll();
+        return;
+    }
+    while (generation == _generation)
+    {
+        _allArrived.wait(&_guard);
+    }
+}
+
+void Barrier::arriveAndDrop()
+{
+    QMutexLocker lock(&_guard);
+
+    Q_ASSERT(_numThreads > 0);
+    _numThreads--;
+    if (_numArrived >= _numThreads)
+    {   //  The others were only waiting for this one
+        _numArrived = 0;
+        _generation++;
+        _allArrived.wakeAll();
+    }
+}
+
+//  End of hadesvm-util/Sync.cpp
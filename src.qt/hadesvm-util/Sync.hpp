@@ -97,6 +97,114 @@ namespace hadesvm
             Value       _value = Value::Unlocked;
         };
 
+        //////////
+        //  A reusable rendezvous point for a fixed set of threads
+        class HADESVM_UTIL_PUBLIC Barrier final
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(Barrier)
+
+            //////////
+            //  Construction/destruction
+        public:
+            explicit Barrier(size_t numThreads);
+            ~Barrier() = default;
+
+            //////////
+            //  Operations
+        public:
+            //  Idle-waits until all participating threads have arrived,
+            //  then lets them all go on; the barrier can then be reused.
+            void        arriveAndWait();
+
+            //  As above, but the last thread to arrive calls "completion"
+            //  before letting the others go on
+            void        arriveAndWait(const std::function<void()> & completion);
+
+            //  Arrives without waiting and removes the calling thread from
+            //  the set of participating threads, for good.
+            void        arriveAndDrop();
+
+            //////////
+            //  Implementation
+        private:
+            QMutex          _guard;
+            QWaitCondition  _allArrived;
+            size_t          _numThreads;    //  participating
+            size_t          _numArrived;    //  in the current generation
+            uint64_t        _generation;    //  bumped when all have arrived
+        };
+
+        //////////
+        //  A bounded lock-free queue for exactly one producer thread and
+        //  exactly one consumer thread; the producer never waits - if the
+        //  queue is full, the value is dropped
+        template <class T>
+        class RingBuffer
+        {
+            HADESVM_CANNOT_ASSIGN_OR_COPY_CONSTRUCT(RingBuffer)
+
+            //////////
+            //  Construction/destruction
+        public:
+            explicit RingBuffer(size_t capacity)
+                :   _capacity(capacity + 1), _data(new T[capacity + 1]),
+                    _head(0), _tail(0), _numDropped(0) {}
+            ~RingBuffer() { delete [] _data; }
+
+            //////////
+            //  Operations
+        public:
+            //  Called by the producer thread only. Adds the specified value
+            //  to the end of the queue and returns true; if the queue is full,
+            //  drops the value and returns false.
+            bool        tryEnqueue(const T & value);
+
+            //  Called by the consumer thread only. Stores the value at the head
+            //  of the queue, removing it from the queue and returning true; if
+            //  the queue is empty, returns false without storing anything.
+            bool        tryDequeue(T & value);
+
+            //  The number of values dropped so far because the queue was full
+            uint64_t    numDropped() const { return _numDropped.load(std::memory_order_relaxed); }
+
+            //////////
+            //  Implementation
+        private:
+            const size_t        _capacity;  //  one slot is always free
+            T *const            _data;
+            std::atomic<size_t> _head;      //  next to dequeue; written by consumer
+            std::atomic<size_t> _tail;      //  next to enqueue; written by producer
+            std::atomic<uint64_t>   _numDropped;
+        };
+
+        template <class T>
+        bool RingBuffer<T>::tryEnqueue(const T & value)
+        {
+            size_t tail = _tail.load(std::memory_order_relaxed);
+            size_t nextTail = (tail + 1) % _capacity;
+            if (nextTail == _head.load(std::memory_order_acquire))
+            {   //  Full
+                _numDropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            _data[tail] = value;
+            _tail.store(nextTail, std::memory_order_release);
+            return true;
+        }
+
+        template <class T>
+        bool RingBuffer<T>::tryDequeue(T & value)
+        {
+            size_t head = _head.load(std::memory_order_relaxed);
+            if (head == _tail.load(std::memory_order_acquire))
+            {   //  Empty
+                return false;
+            }
+            value = _data[head];
+            _head.store((head + 1) % _capacity, std::memory_order_release);
+            return true;
+        }
+
         //////////
         //  A thread-0safe queue that allows multiple producers and multiple consumers
         template <class T>
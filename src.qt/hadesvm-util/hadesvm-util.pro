@@ -9,6 +9,7 @@ SOURCES += \
     FromString.cpp \
     Math.cpp \
     PluginManager.cpp \
+    Sync.cpp \
     ToString.cpp
 
 HEADERS += \
@@ -1,6 +1,9 @@
 TEMPLATE = subdirs
 
 SUBDIRS += \
+    cereon-bench \
+    cereon-profile \
+    cereon-trace \
     hadesvm-cereon \
     hadesvm-core \
     hadesvm-gui \
@@ -9,6 +12,11 @@ SUBDIRS += \
     hadesvm-ieee754 \
     hadesvm-kernel \
     hadesvm-util \
+    ibm370-bench \
+    ibmhfp-bench \
+    ibmhfp-verify \
+    ieee754-bench \
+    ieee754-verify \
     vfd-utils
 
 hadesvm-gui.depends = hadesvm-ibm3x0 hadesvm-cereon hadesvm-kernel hadesvm-core hadesvm-util
@@ -18,3 +26,10 @@ hadesvm-cereon.depends = hadesvm-core hadesvm-ieee754 hadesvm-util
 hadesvm-core.depends = hadesvm-util
 hadesvm-ieee754.depends = hadesvm-util
 hadesvm-ibmhfp.depends = hadesvm-util
+cereon-bench.depends = hadesvm-cereon hadesvm-ieee754 hadesvm-core hadesvm-util
+cereon-profile.depends = hadesvm-cereon hadesvm-ieee754 hadesvm-core hadesvm-util
+ieee754-bench.depends = hadesvm-ieee754 hadesvm-util
+ieee754-verify.depends = hadesvm-ieee754 hadesvm-util
+ibmhfp-bench.depends = hadesvm-ibmhfp hadesvm-util
+ibmhfp-verify.depends = hadesvm-ibmhfp hadesvm-util
+ibm370-bench.depends = hadesvm-ibm3x0 hadesvm-ibmhfp hadesvm-core hadesvm-util
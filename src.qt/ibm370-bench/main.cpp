@@ -0,0 +1,362 @@
+//
+//  main.cpp - measures the instruction rate of the hadesvm-ibm3x0 CPU
+//      running a loop whose instructions follow the proportions of the
+//      Gibson mix: loads and stores, indexing, branches, fixed-point and
+//      floating-point arithmetic, shifts, logical operations and storage
+//      to storage instructions.
+//      With "lap", checks instead that low-address protection holds for
+//      stores that hit the TLB: stores to addresses 512 and up in the same
+//      2K block are still allowed, and turning protection on or off with
+//      LCTL takes effect on the next store.
+//  Usage: ibm370-bench [<thousands of loop iterations>]
+//         ibm370-bench lap
+//
+//////////
+#include "main.hpp"
+
+//////////
+//  A minimal assembler, just enough for the benchmark program
+namespace
+{
+    class Assembler final
+    {
+    public:
+        Assembler(uint8_t * storage, uint32_t origin) : _storage(storage), _here(origin) {}
+
+        uint32_t    here() const { return _here; }
+
+        void        rr(uint8_t opcode, unsigned r1, unsigned r2)
+        {
+            _emit(opcode);
+            _emit(static_cast<uint8_t>((r1 << 4) | r2));
+        }
+        void        rx(uint8_t opcode, unsigned r1, unsigned x2, unsigned b2, unsigned d2)
+        {
+            _emit(opcode);
+            _emit(static_cast<uint8_t>((r1 << 4) | x2));
+            _emitAddress(b2, d2);
+        }
+        void        rs(uint8_t opcode, unsigned r1, unsigned r3, unsigned b2, unsigned d2)
+        {
+            rx(opcode, r1, r3, b2, d2);
+        }
+        void        si(uint8_t opcode, uint8_t i2, unsigned b1, unsigned d1)
+        {
+            _emit(opcode);
+            _emit(i2);
+            _emitAddress(b1, d1);
+        }
+        void        ss(uint8_t opcode, unsigned length, unsigned b1, unsigned d1, unsigned b2, unsigned d2)
+        {
+            _emit(opcode);
+            _emit(static_cast<uint8_t>(length - 1));
+            _emitAddress(b1, d1);
+            _emitAddress(b2, d2);
+        }
+
+    private:
+        uint8_t *const  _storage;
+        uint32_t        _here;
+
+        void        _emit(uint8_t byte) { _storage[_here++] = byte; }
+        void        _emitAddress(unsigned b, unsigned d)
+        {
+            _emit(static_cast<uint8_t>((b << 4) | (d >> 8)));
+            _emit(static_cast<uint8_t>(d));
+        }
+    };
+
+    //  Opcodes
+    const uint8_t BCR = 0x07, LR = 0x18, CR = 0x19, AR = 0x1A, SR = 0x1B, SDR = 0x2B, MER = 0x3C;
+    const uint8_t STH = 0x40, LA = 0x41, BCT = 0x46, BC = 0x47, LH = 0x48, ST = 0x50, N = 0x54, O = 0x56;
+    const uint8_t L = 0x58, C = 0x59, A = 0x5A, S = 0x5B, M = 0x5C, D = 0x5D;
+    const uint8_t STD = 0x60, LD = 0x68, AD = 0x6A, MD = 0x6C, DD = 0x6D, LE = 0x78, AE = 0x7A;
+    const uint8_t LPSW = 0x82, SRL = 0x88, SLL = 0x89, SRA = 0x8A, MVI = 0x92, CLI = 0x95;
+    const uint8_t STCTL = 0xB6, LCTL = 0xB7, MVC = 0xD2, CLC = 0xD5;
+
+    //  Storage layout
+    const uint32_t DataAddress = 0x0800;    //  ...in R13
+    const uint32_t CodeAddress = 0x1000;    //  ...in R12
+    const unsigned OpA = 0x00, OpB = 0x04, Result = 0x08, Mask = 0x0C, OpX = 0x10, OpY = 0x14;
+    const unsigned Table = 0x20;            //  16 words
+    const unsigned FpA = 0x60, FpB = 0x68, FpResult = 0x70, FpShort = 0x78;
+    const unsigned String1 = 0x80, String2 = 0x90, DonePsw = 0xA0;
+
+    const uint64_t IplPsw = UINT64_C(0x0000000000000000) | CodeAddress;
+    const uint32_t ProgramOldPswLocation = 0x28, ProgramNewPswLocation = 0x68;
+    const uint64_t WaitPsw = UINT64_C(0x0002000000000000);  //  disabled wait
+
+    void store32(uint8_t * storage, uint32_t address, uint32_t value)
+    {
+        hadesvm::util::storeUnalignedWithByteOrder<uint32_t>(storage + address, value, hadesvm::util::ByteOrder::BigEndian);
+    }
+
+    void store64(uint8_t * storage, uint32_t address, uint64_t value)
+    {
+        hadesvm::util::storeUnalignedWithByteOrder<uint64_t>(storage + address, value, hadesvm::util::ByteOrder::BigEndian);
+    }
+
+    //  Builds the program; returns the number of instructions per iteration
+    unsigned assembleProgram(uint8_t * storage)
+    {
+        //  Any interruption ends the run with a disabled wait
+        store64(storage, 0x00, IplPsw);
+        for (uint32_t newPsw = 0x58; newPsw <= 0x78; newPsw += 8)
+        {
+            store64(storage, newPsw, WaitPsw | 0x0BAD);
+        }
+
+        //  Data
+        store32(storage, DataAddress + OpA, 12345);
+        store32(storage, DataAddress + OpB, 678);
+        store32(storage, DataAddress + Mask, 0x0000003C);
+        store32(storage, DataAddress + OpX, 1000);
+        store32(storage, DataAddress + OpY, 7);
+        for (unsigned i = 0; i < 16; i++)
+        {
+            store32(storage, DataAddress + Table + i * 4, i * 1000);
+        }
+        store64(storage, DataAddress + FpA, UINT64_C(0x4118000000000000));      //  1.5
+        store64(storage, DataAddress + FpB, UINT64_C(0x4124000000000000));      //  2.25
+        store32(storage, DataAddress + FpShort, UINT32_C(0x41300000));          //  3.0
+        for (unsigned i = 0; i < 16; i++)
+        {
+            storage[DataAddress + String1 + i] = static_cast<uint8_t>(0xC1 + i);
+        }
+        store64(storage, DataAddress + DonePsw, WaitPsw);
+
+        //  The loop; R11 counts the iterations down
+        Assembler a(storage, CodeAddress);
+        uint32_t loop = a.here();
+        unsigned n = 0;
+        a.rx(L, 2, 0, 13, OpA);                          n++;    //  load
+        a.rx(A, 2, 0, 13, OpB);                          n++;    //  fixed add
+        a.rx(ST, 2, 0, 13, Result);                      n++;    //  store
+        a.rx(LA, 5, 5, 0, 4);                            n++;    //  indexing
+        a.rx(N, 5, 0, 13, Mask);                         n++;    //  logical
+        a.rx(L, 6, 5, 13, Table);                        n++;    //  indexed load
+        a.rx(C, 6, 0, 13, OpA);                          n++;    //  compare
+        a.rx(BC, 8, 0, 12, a.here() + 4 - CodeAddress);  n++;    //  branch
+        a.rr(LR, 7, 6);                                  n++;
+        a.rr(AR, 7, 2);                                  n++;
+        a.rx(ST, 7, 5, 13, Table);                       n++;    //  indexed store
+        a.rx(LH, 8, 0, 13, OpB + 2);                     n++;
+        a.rx(STH, 8, 0, 13, Result + 2);                 n++;
+        a.rs(SLL, 8, 0, 0, 2);                           n++;    //  shifts
+        a.rs(SRA, 8, 0, 0, 1);                           n++;
+        a.rx(LD, 0, 0, 13, FpA);                         n++;    //  floating point
+        a.rx(AD, 0, 0, 13, FpB);                         n++;
+        a.rx(MD, 0, 0, 13, FpB);                         n++;
+        a.rx(STD, 0, 0, 13, FpResult);                   n++;
+        a.rx(BC, 15, 0, 12, a.here() + 4 - CodeAddress); n++;    //  taken branch
+        a.rx(LE, 2, 0, 13, FpShort);                     n++;
+        a.rx(AE, 2, 0, 13, FpShort);                     n++;
+        a.rx(LD, 4, 0, 13, FpB);                         n++;
+        a.rr(SDR, 4, 0);                                 n++;
+        a.rx(DD, 4, 0, 13, FpA);                         n++;
+        a.rr(MER, 2, 2);                                 n++;
+        a.rx(L, 3, 0, 13, OpX);                          n++;    //  fixed multiply
+        a.rx(M, 2, 0, 13, OpY);                          n++;
+        a.rx(L, 9, 0, 13, OpX);                          n++;    //  fixed divide
+        a.rr(SR, 8, 8);                                  n++;
+        a.rx(D, 8, 0, 13, OpY);                          n++;
+        a.rx(LA, 10, 0, 10, 1);                          n++;
+        a.rr(CR, 10, 11);                                n++;
+        a.rx(BC, 2, 0, 12, a.here() + 4 - CodeAddress);  n++;
+        a.ss(MVC, 16, 13, String2, 13, String1);         n++;    //  storage to storage
+        a.ss(CLC, 16, 13, String1, 13, String2);         n++;
+        a.rx(BC, 7, 0, 12, a.here() + 4 - CodeAddress);  n++;
+        a.si(MVI, 0x40, 13, Result);                     n++;
+        a.si(CLI, 0x40, 13, Result);                     n++;
+        a.rx(BC, 7, 0, 12, a.here() + 4 - CodeAddress);  n++;
+        a.rx(L, 2, 5, 13, Table + 4);                    n++;
+        a.rx(S, 2, 0, 13, OpA);                          n++;    //  fixed subtract
+        a.rx(ST, 2, 0, 13, Result);                      n++;
+        a.rr(LR, 3, 2);                                  n++;
+        a.rs(SRL, 3, 0, 0, 3);                           n++;
+        a.rx(L, 14, 0, 13, OpB);                         n++;
+        a.rx(ST, 14, 0, 13, OpB);                        n++;
+        a.rx(LA, 7, 5, 13, Table);                       n++;
+        a.rx(L, 6, 0, 7, 0);                             n++;
+        a.rr(BCR, 0, 0);                                 n++;    //  no-op
+        a.rx(BCT, 11, 0, 12, loop - CodeAddress);        n++;
+        a.rx(LPSW, 0, 0, 13, DonePsw);
+        return n;
+    }
+
+    //////////
+    //  The low-address protection check. Each store to 0x600 makes (or,
+    //  while protection is on, must not make) a TLB store entry for the
+    //  2K block that also holds the protected addresses 0..511. The program
+    //  interruption handler counts interruptions and records their codes;
+    //  the 1st and the 2nd one continue the check, which ends with LAP off
+    //  again and a store to 0x100 that must succeed.
+    const unsigned Cr0Off = 0x00, Cr0On = 0x04, LapBit = 0x08, Count = 0x0C, Codes = 0x10;   //  ...2 halfwords after the count
+    const unsigned FailPsw = 0x18;
+    const uint32_t ProbeAddress = 0x0600, ProtectedAddress = 0x0100, SecondProtectedAddress = 0x0104;
+    const uint32_t HandlerAddress = CodeAddress + 0x0400;
+    const uint32_t FailAddress = 0x0FA1;
+
+    void assembleLapCheck(uint8_t * storage)
+    {
+        store64(storage, 0x00, IplPsw);
+        for (uint32_t newPsw = 0x58; newPsw <= 0x78; newPsw += 8)
+        {
+            store64(storage, newPsw, WaitPsw | 0x0BAD);
+        }
+        store64(storage, ProgramNewPswLocation, UINT64_C(0x0000000000000000) | HandlerAddress);
+
+        store32(storage, DataAddress + LapBit, UINT32_C(0x10000000));
+        store64(storage, DataAddress + DonePsw, WaitPsw);
+        store64(storage, DataAddress + FailPsw, WaitPsw | FailAddress);
+
+        //  Phase 1: a store entry made with LAP off must not outlive LCTL
+        Assembler a(storage, CodeAddress);
+        a.rs(STCTL, 0, 0, 13, Cr0Off);
+        a.rx(L, 1, 0, 13, Cr0Off);
+        a.rx(O, 1, 0, 13, LapBit);
+        a.rx(ST, 1, 0, 13, Cr0On);
+        a.rx(ST, 1, 0, 0, ProbeAddress);
+        a.rs(LCTL, 0, 0, 13, Cr0On);
+        a.rx(ST, 1, 0, 0, ProtectedAddress);
+        a.rx(LPSW, 0, 0, 13, FailPsw);
+
+        //  Phase 2: with LAP on, a store above 511 must not make an entry
+        //  that a later store below 512 goes through
+        uint32_t phase2 = a.here();
+        a.rx(ST, 1, 0, 0, ProbeAddress);
+        a.rx(ST, 1, 0, 0, SecondProtectedAddress);
+        a.rx(LPSW, 0, 0, 13, FailPsw);
+
+        //  Phase 3: with LAP off again, the store must go through
+        uint32_t phase3 = a.here();
+        a.rs(LCTL, 0, 0, 13, Cr0Off);
+        a.rx(ST, 1, 0, 0, ProtectedAddress);
+        a.rx(LPSW, 0, 0, 13, DonePsw);
+
+        Assembler h(storage, HandlerAddress);
+        h.rx(L, 3, 0, 13, Count);
+        h.rx(LA, 3, 0, 3, 1);
+        h.rx(ST, 3, 0, 13, Count);
+        h.rr(LR, 4, 3);
+        h.rs(SLL, 4, 0, 0, 1);
+        h.rx(LH, 2, 0, 0, ProgramOldPswLocation + 2);  //  BC mode interruption code
+        h.rx(STH, 2, 4, 13, Codes - 2);
+        h.rx(LA, 4, 0, 0, 1);
+        h.rr(CR, 3, 4);
+        h.rx(BC, 8, 0, 12, phase2 - CodeAddress);
+        h.rx(LA, 4, 0, 0, 2);
+        h.rr(CR, 3, 4);
+        h.rx(BC, 8, 0, 12, phase3 - CodeAddress);
+        h.rx(LPSW, 0, 0, 13, FailPsw);
+    }
+
+    int checkLowAddressProtection()
+    {
+        hadesvm::ibm3x0::Storage storage(UINT32_C(1) << 20);
+        assembleLapCheck(storage.data());
+        hadesvm::ibm3x0::ProcessorCore core(&storage, hadesvm::core::ClockFrequency::gigahertz(1));
+        if (!core.ipl())
+        {
+            fprintf(stderr, "ibm370-bench: invalid IPL PSW\n");
+            return 1;
+        }
+        core.setGeneralRegister(12, CodeAddress);
+        core.setGeneralRegister(13, DataAddress);
+        for (unsigned i = 0; i < 100 && !core.isWaiting() && !core.isStopped(); i++)
+        {
+            core.runCycles(1000);
+        }
+
+        const uint8_t * data = storage.data();
+        auto load32 = [data](uint32_t address)
+                      {
+                          return hadesvm::util::loadUnalignedWithByteOrder<uint32_t>(data + address, hadesvm::util::ByteOrder::BigEndian);
+                      };
+        auto load16 = [data](uint32_t address)
+                      {
+                          return hadesvm::util::loadUnalignedWithByteOrder<uint16_t>(data + address, hadesvm::util::ByteOrder::BigEndian);
+                      };
+        uint32_t cr0On = load32(DataAddress + Cr0On);
+        uint32_t waitAddress = static_cast<uint32_t>(core.psw() & hadesvm::ibm3x0::ProcessorCore::AddressMask);
+        bool passed = (waitAddress == 0 &&
+                       load32(DataAddress + Count) == 2 &&
+                       load16(DataAddress + Codes) == 4 && load16(DataAddress + Codes + 2) == 4 &&
+                       load32(ProtectedAddress) == cr0On &&
+                       load32(SecondProtectedAddress) == 0);
+        printf("Low-address protection: %u protection interruption(s) (expected 2), "
+               "store below 512 with LAP on %s, with LAP off %s, ended at 0x%X: %s\n",
+               load32(DataAddress + Count),
+               (load32(SecondProtectedAddress) == 0) ? "suppressed" : "went through",
+               (load32(ProtectedAddress) == cr0On) ? "went through" : "suppressed",
+               waitAddress,
+               passed ? "passed" : "FAILED");
+        return passed ? 0 : 1;
+    }
+}
+
+//////////
+//  Entry point
+int main(int argc, char ** argv)
+{
+    if (argc == 2 && strcmp(argv[1], "lap") == 0)
+    {
+        return checkLowAddressProtection();
+    }
+
+    uint64_t iterations = UINT64_C(1000) * 1000;
+    if (argc > 2 || (argc == 2 && (iterations = strtoull(argv[1], nullptr, 10) * 1000) == 0) ||
+        iterations > UINT32_MAX)
+    {
+        fprintf(stderr, "Usage: ibm370-bench [<thousands of loop iterations>]\n"
+                        "       ibm370-bench lap\n");
+        return 1;
+    }
+
+    //  The CPU runs at 1GHz of virtual time, so that the timers (which no
+    //  interruption is enabled for) see a plausible clock
+    hadesvm::ibm3x0::Storage storage(UINT32_C(1) << 20);
+    unsigned instructionsPerIteration = assembleProgram(storage.data());
+    hadesvm::ibm3x0::ProcessorCore core(&storage, hadesvm::core::ClockFrequency::gigahertz(1));
+    if (!core.ipl())
+    {
+        fprintf(stderr, "ibm370-bench: invalid IPL PSW\n");
+        return 1;
+    }
+    core.setGeneralRegister(11, static_cast<uint32_t>(iterations));
+    core.setGeneralRegister(12, CodeAddress);
+    core.setGeneralRegister(13, DataAddress);
+
+    QElapsedTimer timer;
+    timer.start();
+    uint64_t cycles = 0;
+    while (!core.isWaiting() && !core.isStopped())
+    {
+        cycles += core.runCycles(1000000);
+    }
+    qint64 elapsedNs = qMax(timer.nsecsElapsed(), Q_INT64_C(1));
+
+    //  The loop ends with a disabled wait at address 0; an
+    //  interruption ends it with one at 0x0BAD
+    if ((core.psw() & hadesvm::ibm3x0::ProcessorCore::AddressMask) != 0)
+    {
+        fprintf(stderr, "ibm370-bench: the program has been interrupted, PSW %016llx, program old PSW %016llx\n",
+                static_cast<unsigned long long>(core.psw()),
+                static_cast<unsigned long long>(hadesvm::util::loadUnalignedWithByteOrder<uint64_t>(
+                    storage.data() + 0x28, hadesvm::util::ByteOrder::BigEndian)));
+        return 1;
+    }
+    uint64_t instructions = core.instructionCount();
+    printf("Gibson mix loop:     %llu iterations of %u instructions\n",
+           static_cast<unsigned long long>(iterations), instructionsPerIteration);
+    printf("Instructions:        %llu\n", static_cast<unsigned long long>(instructions));
+    printf("Clock cycles:        %llu (%.2f per instruction)\n",
+           static_cast<unsigned long long>(cycles),
+           static_cast<double>(cycles) / static_cast<double>(qMax(instructions, UINT64_C(1))));
+    printf("Host time:           %.3f s\n", static_cast<double>(elapsedNs) / 1e9);
+    printf("Rate:                %.2f MIPS\n",
+           static_cast<double>(instructions) * 1000.0 / static_cast<double>(elapsedNs));
+    return 0;
+}
+
+//  End of main.cpp
@@ -0,0 +1,17 @@
+//
+//  main.hpp - The master header
+//
+//////////
+
+//////////
+//  HADES VM
+#include "hadesvm-util/API.hpp"
+#include "hadesvm-core/API.hpp"
+#include "hadesvm-ibm3x0/API.hpp"
+
+//////////
+//  CRT
+#include <stdio.h>
+#include <string.h>
+
+//  End of main.hpp
@@ -0,0 +1,200 @@
+//
+//  main.cpp - measures the throughput of hadesvm-ibmhfp arithmetic:
+//      *   the long fraction kernels (hadesvm::util::Math::multiply64x64
+//          and divide128by64) against the digit-by-digit multiplication
+//          and division they have replaced;
+//      *   short, long and extended arithmetic, one value at a time and
+//          through the batch API.
+//  Usage: ibmhfp-bench [<millions of operations per measurement>]
+//
+//////////
+#include "main.hpp"
+
+//////////
+//  Operands
+static const size_t OperandCount = 4096;    //  must be a power of 2
+
+static uint32_t shortX[OperandCount];
+static uint32_t shortY[OperandCount];
+static uint32_t shortResults[OperandCount];
+static uint64_t longX[OperandCount];
+static uint64_t longY[OperandCount];
+static uint64_t longResults[OperandCount];
+static hadesvm::ibmhfp::Extended extendedX[OperandCount];
+static hadesvm::ibmhfp::Extended extendedY[OperandCount];
+static hadesvm::ibmhfp::Extended extendedResults[OperandCount];
+
+static uint64_t randomState = UINT64_C(0x9E3779B97F4A7C15);
+
+static uint64_t nextRandom()
+{   //  xorshift64*
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    return randomState * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+//  A random normalized long value of either sign with a small exponent,
+//  so that no result of the measured operations overflows or underflows
+static uint64_t randomLong()
+{
+    return (nextRandom() & UINT64_C(0x800FFFFFFFFFFFFF)) |
+           UINT64_C(0x0010000000000000) |
+           ((64 - 8 + nextRandom() % 16) << 56);
+}
+
+static hadesvm::ibmhfp::Extended randomExtended()
+{
+    hadesvm::ibmhfp::Extended result;
+    result.high = randomLong();
+    result.low = (result.high & UINT64_C(0x8000000000000000)) |
+                 ((((result.high >> 56) - 14) & 0x7F) << 56) |
+                 (nextRandom() & UINT64_C(0x00FFFFFFFFFFFFFF));
+    return result;
+}
+
+static void generateOperands()
+{
+    for (size_t i = 0; i < OperandCount; i++)
+    {
+        longX[i] = randomLong();
+        longY[i] = randomLong();
+        shortX[i] = static_cast<uint32_t>(randomLong() >> 32);
+        shortY[i] = static_cast<uint32_t>(randomLong() >> 32);
+        extendedX[i] = randomExtended();
+        extendedY[i] = randomExtended();
+    }
+}
+
+//////////
+//  The long fraction kernels replaced by hadesvm::util::Math ones,
+//  kept as they were for comparison
+static uint64_t legacyMultiply(uint64_t aMantissa, uint64_t bMantissa)
+{
+    uint64_t cMantissa = 0;
+    for (int i = 0; i < 14; i++)
+    {
+        cMantissa += aMantissa * ((bMantissa >> 52) & 0x0F);
+        aMantissa >>= 4;
+        bMantissa <<= 4;
+    }
+    return cMantissa;
+}
+
+static uint64_t legacyDivide(uint64_t aMantissa, uint64_t bMantissa)
+{
+    uint64_t cMantissa = 0, digit;
+    for (int i = 0; i < 14; i++)
+    {
+        digit = aMantissa / bMantissa;
+        cMantissa = (cMantissa << 4) | digit;
+        aMantissa -= bMantissa * digit;
+        aMantissa = (aMantissa << 4) & 0x0FFFFFFFFFFFFFFF;
+    }
+    return cMantissa;
+}
+
+//////////
+//  Measurement
+static void report(const char * name, uint64_t operations, qint64 elapsedNs, uint64_t sink)
+{
+    //  Print the "sink" so that the compiler can't throw the work away
+    printf("%-24s %10.2f Mops/s    [%016llx]\n",
+           name,
+           static_cast<double>(operations) * 1000.0 / static_cast<double>(qMax(elapsedNs, Q_INT64_C(1))),
+           static_cast<unsigned long long>(sink));
+}
+
+template <class Operation>
+static void measure(const char * name, uint64_t operations, Operation operation)
+{
+    uint64_t sink = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        sink ^= operation(static_cast<size_t>(i) & (OperandCount - 1));
+    }
+    report(name, operations, timer.nsecsElapsed(), sink);
+}
+
+//  Runs a batch operation over all operands until at least "operations"
+//  elements have been processed
+template <class Operation>
+static void measureBatch(const char * name, uint64_t operations, Operation operation)
+{
+    uint64_t sink = 0, done = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for (; done < operations; done += OperandCount)
+    {
+        sink += operation();
+    }
+    report(name, done, timer.nsecsElapsed(), sink);
+}
+
+//////////
+//  Entry point
+int main(int argc, char ** argv)
+{
+    uint64_t operations = UINT64_C(10) * 1000 * 1000;
+    if (argc > 2 || (argc == 2 && (operations = strtoull(argv[1], nullptr, 10) * 1000 * 1000) == 0))
+    {
+        fprintf(stderr, "Usage: ibmhfp-bench [<millions of operations per measurement>]\n");
+        return 1;
+    }
+    generateOperands();
+
+    using namespace hadesvm::ibmhfp;
+    const uint64_t fractionMask = UINT64_C(0x00FFFFFFFFFFFFFF);
+    Environment env;
+
+    printf("Long fraction kernels:\n");
+    measure("  multiply (legacy)", operations,
+            [](size_t i) { return legacyMultiply(longX[i] & fractionMask, longY[i] & fractionMask); });
+    measure("  multiply (128-bit)", operations,
+            [&](size_t i)
+            {
+                uint64_t low = 0;
+                return hadesvm::util::Math::multiply64x64((longX[i] & fractionMask) << 8, (longY[i] & fractionMask) << 8, low);
+            });
+    measure("  divide (legacy)", operations,
+            [&](size_t i) { return legacyDivide(longX[i] & fractionMask, longY[i] & fractionMask); });
+    measure("  divide (128-bit)", operations,
+            [&](size_t i)
+            {
+                uint64_t dividend = (longX[i] & fractionMask) << 4, remainder = 0;
+                return hadesvm::util::Math::divide128by64(dividend >> 4, dividend << 60, (longY[i] & fractionMask) << 8, remainder);
+            });
+
+    printf("Short:\n");
+    measure("  add", operations, [&](size_t i) { return add32(shortX[i], shortY[i], env); });
+    measure("  subtract", operations, [&](size_t i) { return subtract32(shortX[i], shortY[i], env); });
+    measure("  multiply", operations, [&](size_t i) { return multiply32(shortX[i], shortY[i], env); });
+    measure("  divide", operations, [&](size_t i) { return divide32(shortX[i], shortY[i], env); });
+    measureBatch("  add (batch)", operations, [&]() { add32(shortX, shortY, shortResults, env); return shortResults[0]; });
+    measureBatch("  multiply (batch)", operations, [&]() { multiply32(shortX, shortY, shortResults, env); return shortResults[0]; });
+    measureBatch("  divide (batch)", operations, [&]() { divide32(shortX, shortY, shortResults, env); return shortResults[0]; });
+
+    printf("Long:\n");
+    measure("  add", operations, [&](size_t i) { return add64(longX[i], longY[i], env); });
+    measure("  subtract", operations, [&](size_t i) { return subtract64(longX[i], longY[i], env); });
+    measure("  multiply", operations, [&](size_t i) { return multiply64(longX[i], longY[i], env); });
+    measure("  divide", operations, [&](size_t i) { return divide64(longX[i], longY[i], env); });
+    measureBatch("  add (batch)", operations, [&]() { add64(longX, longY, longResults, env); return longResults[0]; });
+    measureBatch("  multiply (batch)", operations, [&]() { multiply64(longX, longY, longResults, env); return longResults[0]; });
+    measureBatch("  divide (batch)", operations, [&]() { divide64(longX, longY, longResults, env); return longResults[0]; });
+
+    printf("Extended:\n");
+    measure("  add", operations, [&](size_t i) { return add128(extendedX[i], extendedY[i], env).low; });
+    measure("  subtract", operations, [&](size_t i) { return subtract128(extendedX[i], extendedY[i], env).low; });
+    measure("  multiply", operations, [&](size_t i) { return multiply128(extendedX[i], extendedY[i], env).low; });
+    measure("  divide", operations, [&](size_t i) { return divide128(extendedX[i], extendedY[i], env).low; });
+    measure("  multiply (long)", operations, [&](size_t i) { return multiply64to128(longX[i], longY[i], env).low; });
+    measure("  round to long", operations, [&](size_t i) { return round128to64(extendedX[i], env); });
+    measureBatch("  add (batch)", operations, [&]() { add128(extendedX, extendedY, extendedResults, env); return extendedResults[0].low; });
+    measureBatch("  multiply (batch)", operations, [&]() { multiply128(extendedX, extendedY, extendedResults, env); return extendedResults[0].low; });
+    return 0;
+}
+
+//  End of main.cpp
@@ -0,0 +1,15 @@
+//
+//  main.hpp - The master header
+//
+//////////
+
+//////////
+//  HADES VM
+#include "hadesvm-util/API.hpp"
+#include "hadesvm-ibmhfp/API.hpp"
+
+//////////
+//  CRT
+#include <stdio.h>
+
+//  End of main.hpp
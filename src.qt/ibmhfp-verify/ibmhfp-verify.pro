@@ -0,0 +1,14 @@
+include(../hadesvm.pri)
+win32-msvc {
+    QMAKE_CXXFLAGS += /wd5045 /wd4996
+}
+
+CONFIG += cmdline
+
+SOURCES += \
+        main.cpp
+
+HEADERS += \
+    main.hpp
+
+LIBS += -L$$DESTDIR -lhadesvm-ibmhfp -lhadesvm-util
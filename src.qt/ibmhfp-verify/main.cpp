@@ -0,0 +1,924 @@
+//
+//  main.cpp - checks hadesvm-ibmhfp arithmetic against a reference model
+//  that works on arbitrarily long integers. The model takes every operand
+//  at its exact value, forms the exact sum (with the operand of the smaller
+//  characteristic truncated to one guard digit first, as the architecture
+//  requires), product or quotient, and only then normalizes and truncates
+//  it to the result format; it shares no code with the library and uses
+//  no fixed-width fraction arithmetic, so it catches lost carries, wrong
+//  digit alignment and off-by-one truncation in the library's kernels.
+//  Operands are generated the way TestFloat does it: extreme and nearby
+//  characteristics, true and dirty zeros, unnormalized fractions and
+//  fractions made of runs of ones are mixed with plain random ones. Every
+//  scalar operation is checked, results and exceptions alike, and so is
+//  every batch operation.
+//  Usage: ibmhfp-verify [<thousands of operands per operation>]
+//
+//////////
+#include "main.hpp"
+
+//////////
+//  An unsigned integer of any length, just enough for the reference model
+namespace
+{
+    class Natural final
+    {
+    public:
+        Natural() : _limbs() {}
+        explicit Natural(uint64_t value)
+            :   _limbs()
+        {
+            for (; value != 0; value >>= 32)
+            {
+                _limbs.append(static_cast<uint32_t>(value));
+            }
+        }
+
+        bool        isZero() const { return _limbs.isEmpty(); }
+
+        int         bitLength() const
+        {
+            return _limbs.isEmpty() ?
+                        0 :
+                        32 * static_cast<int>(_limbs.size()) - static_cast<int>(qCountLeadingZeroBits(_limbs.last()));
+        }
+
+        //  The number of hexadecimal digits, without leading zeros
+        int         digitLength() const { return (bitLength() + 3) / 4; }
+
+        //  The rightmost 64 bits
+        uint64_t    low64() const
+        {
+            uint64_t result = 0;
+            for (qsizetype i = qMin(_limbs.size(), qsizetype(2)) - 1; i >= 0; i--)
+            {
+                result = (result << 32) | _limbs[i];
+            }
+            return result;
+        }
+
+        int         compare(const Natural & op2) const
+        {
+            if (_limbs.size() != op2._limbs.size())
+            {
+                return (_limbs.size() < op2._limbs.size()) ? -1 : 1;
+            }
+            for (qsizetype i = _limbs.size() - 1; i >= 0; i--)
+            {
+                if (_limbs[i] != op2._limbs[i])
+                {
+                    return (_limbs[i] < op2._limbs[i]) ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+        Natural     operator + (const Natural & op2) const
+        {
+            Natural result;
+            uint64_t carry = 0;
+            for (qsizetype i = 0; i < qMax(_limbs.size(), op2._limbs.size()); i++)
+            {
+                carry += static_cast<uint64_t>(_limb(i)) + op2._limb(i);
+                result._limbs.append(static_cast<uint32_t>(carry));
+                carry >>= 32;
+            }
+            if (carry != 0)
+            {
+                result._limbs.append(static_cast<uint32_t>(carry));
+            }
+            return result;
+        }
+
+        //  "op2" must not be greater than this value
+        Natural     operator - (const Natural & op2) const
+        {
+            Q_ASSERT(compare(op2) >= 0);
+            Natural result(*this);
+            result._subtract(op2);
+            return result;
+        }
+
+        Natural     operator * (const Natural & op2) const
+        {
+            Natural result;
+            result._limbs.fill(0, _limbs.size() + op2._limbs.size());
+            for (qsizetype i = 0; i < _limbs.size(); i++)
+            {
+                uint64_t carry = 0;
+                for (qsizetype j = 0; j < op2._limbs.size(); j++)
+                {
+                    carry += static_cast<uint64_t>(_limbs[i]) * op2._limbs[j] + result._limbs[i + j];
+                    result._limbs[i + j] = static_cast<uint32_t>(carry);
+                    carry >>= 32;
+                }
+                result._limbs[i + op2._limbs.size()] = static_cast<uint32_t>(carry);
+            }
+            result._trim();
+            return result;
+        }
+
+        Natural     operator << (int count) const
+        {
+            if (isZero())
+            {
+                return *this;
+            }
+            Natural result;
+            result._limbs.fill(0, count / 32);
+            uint32_t carry = 0;
+            for (uint32_t limb : _limbs)
+            {
+                result._limbs.append((count % 32 == 0) ? limb : ((limb << (count % 32)) | carry));
+                carry = (count % 32 == 0) ? 0 : (limb >> (32 - count % 32));
+            }
+            result._limbs.append(carry);
+            result._trim();
+            return result;
+        }
+
+        Natural     operator >> (int count) const
+        {
+            Natural result;
+            for (qsizetype i = count / 32; i < _limbs.size(); i++)
+            {
+                uint64_t pair = (static_cast<uint64_t>(_limb(i + 1)) << 32) | _limbs[i];
+                result._limbs.append(static_cast<uint32_t>(pair >> (count % 32)));
+            }
+            result._trim();
+            return result;
+        }
+
+        //  The quotient, truncated; "divisor" must not be zero
+        Natural     operator / (const Natural & divisor) const
+        {   //  One bit at a time, working on the remainder in place
+            Q_ASSERT(!divisor.isZero());
+            Natural quotient, remainder;
+            quotient._limbs.fill(0, _limbs.size());
+            for (int bit = bitLength() - 1; bit >= 0; bit--)
+            {
+                remainder._shiftLeftOneBit(((_limbs[bit / 32] >> (bit % 32)) & 1) != 0);
+                if (remainder.compare(divisor) >= 0)
+                {
+                    remainder._subtract(divisor);
+                    quotient._limbs[bit / 32] |= UINT32_C(1) << (bit % 32);
+                }
+            }
+            quotient._trim();
+            return quotient;
+        }
+
+    private:
+        QList<uint32_t> _limbs;     //  least significant first, no leading zero limbs
+
+        uint32_t    _limb(qsizetype index) const { return (index < _limbs.size()) ? _limbs[index] : 0; }
+
+        void        _trim()
+        {
+            while (!_limbs.isEmpty() && _limbs.last() == 0)
+            {
+                _limbs.removeLast();
+            }
+        }
+
+        void        _subtract(const Natural & op2)
+        {
+            int64_t borrow = 0;
+            for (qsizetype i = 0; i < _limbs.size(); i++)
+            {
+                int64_t difference = static_cast<int64_t>(_limbs[i]) - op2._limb(i) - borrow;
+                borrow = (difference < 0) ? 1 : 0;
+                _limbs[i] = static_cast<uint32_t>(difference + (borrow << 32));
+            }
+            _trim();
+        }
+
+        void        _shiftLeftOneBit(bool newBit)
+        {
+            uint32_t carry = newBit ? 1 : 0;
+            for (uint32_t & limb : _limbs)
+            {
+                uint32_t nextCarry = limb >> 31;
+                limb = (limb << 1) | carry;
+                carry = nextCarry;
+            }
+            if (carry != 0)
+            {
+                _limbs.append(carry);
+            }
+        }
+    };
+}
+
+//////////
+//  The reference model. A value of a format with "digits" fraction digits
+//  is sign * fraction * 16**(characteristic - 64 - digits).
+namespace
+{
+    using hadesvm::ibmhfp::Environment;
+    using hadesvm::ibmhfp::Extended;
+
+    const int ShortDigits = 6, LongDigits = 14, ExtendedDigits = 28;
+    const uint64_t FractionMask56 = UINT64_C(0x00FFFFFFFFFFFFFF);
+
+    struct Value
+    {
+        int         sign;
+        int         characteristic;
+        Natural     fraction;
+    };
+
+    Value trueZero()
+    {
+        return Value { 0, 0, Natural() };
+    }
+
+    Value negated(Value a)
+    {
+        a.sign ^= 1;
+        return a;
+    }
+
+    int scaleOf(const Value & a, int digits)
+    {
+        return a.characteristic - 64 - digits;
+    }
+
+    Value fromShort(uint32_t a)
+    {
+        return Value { static_cast<int>(a >> 31), static_cast<int>((a >> 24) & 0x7F), Natural(a & 0x00FFFFFF) };
+    }
+
+    Value fromLong(uint64_t a)
+    {
+        return Value { static_cast<int>(a >> 63), static_cast<int>((a >> 56) & 0x7F), Natural(a & FractionMask56) };
+    }
+
+    Value fromExtended(const Extended & a)
+    {   //  The low-order part only contributes its fraction digits
+        return Value { static_cast<int>(a.high >> 63),
+                       static_cast<int>((a.high >> 56) & 0x7F),
+                       (Natural(a.high & FractionMask56) << 56) + Natural(a.low & FractionMask56) };
+    }
+
+    uint32_t toShort(const Value & a)
+    {
+        return (static_cast<uint32_t>(a.sign) << 31) |
+               (static_cast<uint32_t>(a.characteristic) << 24) |
+               static_cast<uint32_t>(a.fraction.low64());
+    }
+
+    uint64_t toLong(const Value & a)
+    {
+        return (static_cast<uint64_t>(a.sign) << 63) |
+               (static_cast<uint64_t>(a.characteristic) << 56) |
+               a.fraction.low64();
+    }
+
+    Extended toExtended(const Value & a)
+    {
+        Extended result;
+        if (!a.fraction.isZero())
+        {
+            result.high = (static_cast<uint64_t>(a.sign) << 63) |
+                          (static_cast<uint64_t>(a.characteristic) << 56) |
+                          (a.fraction >> 56).low64();
+            result.low = (static_cast<uint64_t>(a.sign) << 63) |
+                         (static_cast<uint64_t>((a.characteristic - 14) & 0x7F) << 56) |
+                         (a.fraction.low64() & FractionMask56);
+        }
+        return result;
+    }
+
+    //  The value "sign * magnitude * 16**scale", normalized and truncated
+    //  to "digits" digits
+    Value normalized(Environment & env, int digits, int sign, const Natural & magnitude, int scale)
+    {
+        if (magnitude.isZero())
+        {
+            return trueZero();
+        }
+        int length = magnitude.digitLength();
+        Natural fraction = (length > digits) ? (magnitude >> (4 * (length - digits))) : (magnitude << (4 * (digits - length)));
+        int characteristic = length + scale + 64;
+        if (characteristic > 127)
+        {
+            env.overflow = true;
+        }
+        else if (characteristic < 0)
+        {
+            env.underflow = true;
+        }
+        return Value { sign, characteristic & 0x7F, fraction };
+    }
+
+    //  The intermediate sum of "a" and "b": both fractions are extended by
+    //  a guard digit and the one with the smaller characteristic is shifted
+    //  right, digits shifted out of the guard digit being lost. The sum is
+    //  "sign * magnitude * 16**(characteristic - 64 - digits - 1)".
+    struct IntermediateSum
+    {
+        int         sign;
+        int         characteristic;
+        Natural     magnitude;
+    };
+
+    IntermediateSum intermediateSum(const Value & a, const Value & b)
+    {
+        int characteristic = qMax(a.characteristic, b.characteristic);
+        Natural x = (a.fraction << 4) >> (4 * (characteristic - a.characteristic));
+        Natural y = (b.fraction << 4) >> (4 * (characteristic - b.characteristic));
+        if (a.sign == b.sign)
+        {
+            return IntermediateSum { a.sign, characteristic, x + y };
+        }
+        return (x.compare(y) >= 0) ?
+                    IntermediateSum { a.sign, characteristic, x - y } :
+                    IntermediateSum { b.sign, characteristic, y - x };
+    }
+
+    Value add(Environment & env, int digits, const Value & a, const Value & b)
+    {
+        IntermediateSum sum = intermediateSum(a, b);
+        if (sum.magnitude.isZero())
+        {
+            env.significance = true;
+            return trueZero();
+        }
+        return normalized(env, digits, sum.sign, sum.magnitude, sum.characteristic - 64 - digits - 1);
+    }
+
+    Value addUnnormalized(Environment & env, int digits, const Value & a, const Value & b)
+    {
+        IntermediateSum sum = intermediateSum(a, b);
+        int carry = (sum.magnitude.digitLength() > digits + 1) ? 1 : 0;
+        int characteristic = sum.characteristic + carry;
+        if (characteristic > 127)
+        {
+            env.overflow = true;
+        }
+        Natural fraction = sum.magnitude >> (4 * (1 + carry));
+        if (fraction.isZero())
+        {
+            env.significance = true;
+            return trueZero();
+        }
+        return Value { sum.sign, characteristic & 0x7F, fraction };
+    }
+
+    int compare(const Value & a, const Value & b)
+    {
+        IntermediateSum difference = intermediateSum(a, negated(b));
+        if (difference.magnitude.isZero())
+        {
+            return 0;
+        }
+        return (difference.sign != 0) ? -1 : 1;
+    }
+
+    Value multiply(Environment & env, int operandDigits, int resultDigits, const Value & a, const Value & b)
+    {
+        if (a.fraction.isZero() || b.fraction.isZero())
+        {
+            return trueZero();
+        }
+        return normalized(env, resultDigits, a.sign ^ b.sign, a.fraction * b.fraction,
+                          scaleOf(a, operandDigits) + scaleOf(b, operandDigits));
+    }
+
+    Value divide(Environment & env, int digits, const Value & a, const Value & b)
+    {
+        if (b.fraction.isZero())
+        {
+            env.divide = true;
+            return trueZero();
+        }
+        if (a.fraction.isZero())
+        {
+            return trueZero();
+        }
+        //  Even the quotient of the smallest fraction by the largest one
+        //  has more than "digits" digits when scaled by 16**(2*digits+2)
+        int extraDigits = 2 * digits + 2;
+        return normalized(env, digits, a.sign ^ b.sign, (a.fraction << (4 * extraDigits)) / b.fraction,
+                          scaleOf(a, digits) - scaleOf(b, digits) - extraDigits);
+    }
+
+    //  Rounds to a format with fewer digits: 1 is added to the leftmost bit
+    //  of the digits to be dropped, which are then dropped; no normalization
+    Value rounded(Environment & env, int digits, int resultDigits, const Value & a)
+    {
+        int droppedBits = 4 * (digits - resultDigits);
+        Natural fraction = a.fraction + (Natural(1) << (droppedBits - 1));
+        int characteristic = a.characteristic;
+        if (fraction.digitLength() > digits)
+        {
+            fraction = fraction >> 4;
+            if (++characteristic > 127)
+            {
+                env.overflow = true;
+            }
+        }
+        return Value { a.sign, characteristic & 0x7F, fraction >> droppedBits };
+    }
+
+    Value fromInt(int digits, int a)
+    {
+        Environment env;
+        int64_t wide = a;
+        return normalized(env, digits, (a < 0) ? 1 : 0, Natural(static_cast<uint64_t>((wide < 0) ? -wide : wide)), 0);
+    }
+
+    //  The exact value is formed in long double if it can hold a long
+    //  fraction, and then rounded to double just once
+    bool canConvertToDouble()
+    {
+        return LDBL_MANT_DIG >= 4 * LongDigits;
+    }
+
+    double toDouble(int digits, const Value & a)
+    {
+        long double magnitude = ldexpl(static_cast<long double>(a.fraction.low64()), 4 * scaleOf(a, digits));
+        return static_cast<double>((a.sign != 0) ? -magnitude : magnitude);
+    }
+}
+
+//////////
+//  Operand generation
+static uint64_t randomState = UINT64_C(0x9E3779B97F4A7C15);
+
+static uint64_t nextRandom()
+{   //  xorshift64*
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    return randomState * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+static uint64_t randomFraction(int digits)
+{
+    const int bits = 4 * digits;
+    const uint64_t mask = (UINT64_C(1) << bits) - 1;
+    switch (nextRandom() % 10)
+    {
+        case 0:     //  a zero fraction
+            return 0;
+        case 1:     //  all ones
+            return mask;
+        case 2:     //  a single one
+            return UINT64_C(1) << (nextRandom() % static_cast<uint64_t>(bits));
+        case 3:     //  a run of ones at the bottom
+            return mask >> (nextRandom() % static_cast<uint64_t>(bits));
+        case 4:     //  a run of ones at the top
+            return (mask << (nextRandom() % static_cast<uint64_t>(bits))) & mask;
+        case 5:     //  unnormalized
+            return (nextRandom() & mask) >> (4 * (nextRandom() % static_cast<uint64_t>(digits)));
+        default:
+            return nextRandom() & mask;
+    }
+}
+
+static int randomCharacteristic()
+{
+    switch (nextRandom() % 8)
+    {
+        case 0:     //  the smallest
+            return static_cast<int>(nextRandom() % 3);
+        case 1:     //  the largest
+            return 127 - static_cast<int>(nextRandom() % 3);
+        case 2:     //  around 1
+            return 63 + static_cast<int>(nextRandom() % 3);
+        default:
+            return static_cast<int>(nextRandom() % 128);
+    }
+}
+
+//  Half of the time, a characteristic within "spread" of "centre"
+static int randomCharacteristicNear(int centre, int spread)
+{
+    if ((nextRandom() & 1) != 0)
+    {
+        return randomCharacteristic();
+    }
+    return qBound(0, centre + static_cast<int>(nextRandom() % static_cast<uint64_t>(2 * spread + 1)) - spread, 127);
+}
+
+static uint32_t makeShort(int characteristic)
+{
+    return (static_cast<uint32_t>(nextRandom() & 1) << 31) |
+           (static_cast<uint32_t>(characteristic) << 24) |
+           static_cast<uint32_t>(randomFraction(ShortDigits));
+}
+
+static uint64_t makeLong(int characteristic)
+{
+    return ((nextRandom() & 1) << 63) |
+           (static_cast<uint64_t>(characteristic) << 56) |
+           randomFraction(LongDigits);
+}
+
+static Extended makeExtended(int characteristic)
+{
+    Extended result;
+    result.high = makeLong(characteristic);
+    //  The sign and characteristic of the low-order part are ignored, so
+    //  they are sometimes set to garbage
+    uint64_t lowSignAndCharacteristic = ((nextRandom() & 3) == 0) ?
+        (nextRandom() & ~FractionMask56) :
+        ((result.high & UINT64_C(0x8000000000000000)) | ((((result.high >> 56) - 14) & 0x7F) << 56));
+    result.low = lowSignAndCharacteristic | randomFraction(LongDigits);
+    return result;
+}
+
+static int randomInt()
+{
+    switch (nextRandom() % 6)
+    {
+        case 0:
+            return 0;
+        case 1:
+            return INT_MIN;
+        case 2:
+            return INT_MAX;
+        default:
+            return static_cast<int>(static_cast<int64_t>(nextRandom()) >> (32 + nextRandom() % 32));
+    }
+}
+
+struct Operands
+{
+    Operands() : x32(), y32(), x64(), y64(), x128(), y128(), ints() {}
+
+    QList<uint32_t> x32, y32;
+    QList<uint64_t> x64, y64;
+    QList<Extended> x128, y128;
+    QList<int>      ints;
+};
+
+static void generateOperands(Operands & operands, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        int characteristic = randomCharacteristic();
+        operands.x32.append(makeShort(characteristic));
+        operands.y32.append(makeShort(randomCharacteristicNear(characteristic, ShortDigits + 2)));
+        characteristic = randomCharacteristic();
+        operands.x64.append(makeLong(characteristic));
+        operands.y64.append(makeLong(randomCharacteristicNear(characteristic, LongDigits + 2)));
+        characteristic = randomCharacteristic();
+        operands.x128.append(makeExtended(characteristic));
+        operands.y128.append(makeExtended(randomCharacteristicNear(characteristic, ExtendedDigits + 2)));
+        operands.ints.append(randomInt());
+    }
+}
+
+//////////
+//  Checking
+static const size_t ChunkSize = 4096;   //  elements of a batch sharing an environment
+
+static bool sameResult(uint32_t a, uint32_t b) { return a == b; }
+static bool sameResult(uint64_t a, uint64_t b) { return a == b; }
+static bool sameResult(int a, int b) { return a == b; }
+static bool sameResult(double a, double b) { return memcmp(&a, &b, sizeof(double)) == 0; }
+static bool sameResult(const Extended & a, const Extended & b) { return a.high == b.high && a.low == b.low; }
+
+static void printResult(uint32_t a) { printf("%08x", a); }
+static void printResult(uint64_t a) { printf("%016llx", static_cast<unsigned long long>(a)); }
+static void printResult(int a) { printf("%d", a); }
+static void printResult(double a) { printf("%a", a); }
+static void printResult(const Extended & a)
+{
+    printf("%016llx:%016llx", static_cast<unsigned long long>(a.high), static_cast<unsigned long long>(a.low));
+}
+
+static bool sameExceptions(const Environment & a, const Environment & b)
+{
+    return a.overflow == b.overflow && a.underflow == b.underflow &&
+           a.significance == b.significance && a.divide == b.divide;
+}
+
+static void printExceptions(const Environment & env)
+{
+    printf("%c%c%c%c",
+           env.overflow ? 'O' : '-',
+           env.underflow ? 'U' : '-',
+           env.significance ? 'S' : '-',
+           env.divide ? 'D' : '-');
+}
+
+static void reportCheck(const char * name, size_t count, size_t mismatches)
+{
+    printf("%-32s %10zu    %s\n", name, count, (mismatches == 0) ? "ok" : "MISMATCH");
+}
+
+//  Runs "operation(index, env)" and "reference(index, env)" for "count"
+//  operands, each with an environment of its own, and compares the results
+//  and the exceptions. Returns true if they all agree.
+template <class Operation, class Reference, class Describe>
+static bool check(const char * name, size_t count, Operation operation, Reference reference, Describe describe)
+{
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        Environment env, referenceEnv;
+        auto result = operation(i, env);
+        auto referenceResult = reference(i, referenceEnv);
+        if ((!sameResult(result, referenceResult) || !sameExceptions(env, referenceEnv)) && mismatches++ < 5)
+        {
+            printf("    %s: ", name);
+            describe(i);
+            printf(" -> ");
+            printResult(result);
+            printf(" ");
+            printExceptions(env);
+            printf(", expected ");
+            printResult(referenceResult);
+            printf(" ");
+            printExceptions(referenceEnv);
+            printf("\n");
+        }
+    }
+    reportCheck(name, count, mismatches);
+    return mismatches == 0;
+}
+
+//  Runs "batch(start, size, result, env)" chunk by chunk and compares the
+//  results with "reference(index, env)" for each element and the exceptions
+//  with those of the reference for all elements of the chunk
+template <class Result, class Batch, class Reference>
+static bool checkBatch(const char * name, size_t count, Batch batch, Reference reference)
+{
+    size_t mismatches = 0;
+    QList<Result> results(static_cast<qsizetype>(count));
+    for (size_t start = 0; start < count; start += ChunkSize)
+    {
+        size_t size = qMin(ChunkSize, count - start);
+        Environment env, referenceEnv;
+        batch(start, size, std::span<Result>(results.data() + start, size), env);
+        for (size_t i = start; i < start + size; i++)
+        {
+            Result referenceResult = reference(i, referenceEnv);
+            if (!sameResult(results[static_cast<qsizetype>(i)], referenceResult) && mismatches++ < 5)
+            {
+                printf("    %s: element %zu -> ", name, i);
+                printResult(results[static_cast<qsizetype>(i)]);
+                printf(", expected ");
+                printResult(referenceResult);
+                printf("\n");
+            }
+        }
+        if (!sameExceptions(env, referenceEnv) && mismatches++ < 5)
+        {
+            printf("    %s: chunk at %zu -> ", name, start);
+            printExceptions(env);
+            printf(", expected ");
+            printExceptions(referenceEnv);
+            printf("\n");
+        }
+    }
+    reportCheck(name, count, mismatches);
+    return mismatches == 0;
+}
+
+static bool checkAll(const Operands & operands, size_t count)
+{
+    namespace hfp = hadesvm::ibmhfp;
+
+    auto x32 = [&](size_t i) { return operands.x32[static_cast<qsizetype>(i)]; };
+    auto y32 = [&](size_t i) { return operands.y32[static_cast<qsizetype>(i)]; };
+    auto x64 = [&](size_t i) { return operands.x64[static_cast<qsizetype>(i)]; };
+    auto y64 = [&](size_t i) { return operands.y64[static_cast<qsizetype>(i)]; };
+    auto x128 = [&](size_t i) { return operands.x128[static_cast<qsizetype>(i)]; };
+    auto y128 = [&](size_t i) { return operands.y128[static_cast<qsizetype>(i)]; };
+    auto describe32 = [&](size_t i) { printf("%08x, %08x", x32(i), y32(i)); };
+    auto describe64 = [&](size_t i)
+                      {
+                          printf("%016llx, %016llx",
+                                 static_cast<unsigned long long>(x64(i)), static_cast<unsigned long long>(y64(i)));
+                      };
+    auto describe128 = [&](size_t i)
+                       {
+                           printResult(x128(i));
+                           printf(", ");
+                           printResult(y128(i));
+                       };
+    auto span32 = [](const QList<uint32_t> & list, size_t start, size_t size)
+                  { return std::span<const uint32_t>(list.constData() + start, size); };
+    auto span64 = [](const QList<uint64_t> & list, size_t start, size_t size)
+                  { return std::span<const uint64_t>(list.constData() + start, size); };
+    auto span128 = [](const QList<Extended> & list, size_t start, size_t size)
+                   { return std::span<const Extended>(list.constData() + start, size); };
+
+    //  The reference operations, by format
+    auto add32 = [&](size_t i, Environment & env)
+                 { return toShort(add(env, ShortDigits, fromShort(x32(i)), fromShort(y32(i)))); };
+    auto subtract32 = [&](size_t i, Environment & env)
+                      { return toShort(add(env, ShortDigits, fromShort(x32(i)), negated(fromShort(y32(i))))); };
+    auto multiply32 = [&](size_t i, Environment & env)
+                      { return toShort(multiply(env, ShortDigits, ShortDigits, fromShort(x32(i)), fromShort(y32(i)))); };
+    auto divide32 = [&](size_t i, Environment & env)
+                    { return toShort(divide(env, ShortDigits, fromShort(x32(i)), fromShort(y32(i)))); };
+    auto compare32 = [&](size_t i, Environment &) { return compare(fromShort(x32(i)), fromShort(y32(i))); };
+    auto add64 = [&](size_t i, Environment & env)
+                 { return toLong(add(env, LongDigits, fromLong(x64(i)), fromLong(y64(i)))); };
+    auto subtract64 = [&](size_t i, Environment & env)
+                      { return toLong(add(env, LongDigits, fromLong(x64(i)), negated(fromLong(y64(i))))); };
+    auto multiply64 = [&](size_t i, Environment & env)
+                      { return toLong(multiply(env, LongDigits, LongDigits, fromLong(x64(i)), fromLong(y64(i)))); };
+    auto divide64 = [&](size_t i, Environment & env)
+                    { return toLong(divide(env, LongDigits, fromLong(x64(i)), fromLong(y64(i)))); };
+    auto compare64 = [&](size_t i, Environment &) { return compare(fromLong(x64(i)), fromLong(y64(i))); };
+    auto add128 = [&](size_t i, Environment & env)
+                  { return toExtended(add(env, ExtendedDigits, fromExtended(x128(i)), fromExtended(y128(i)))); };
+    auto subtract128 = [&](size_t i, Environment & env)
+                       { return toExtended(add(env, ExtendedDigits, fromExtended(x128(i)), negated(fromExtended(y128(i))))); };
+    auto multiply128 = [&](size_t i, Environment & env)
+                       {
+                           return toExtended(multiply(env, ExtendedDigits, ExtendedDigits,
+                                                      fromExtended(x128(i)), fromExtended(y128(i))));
+                       };
+    auto divide128 = [&](size_t i, Environment & env)
+                     { return toExtended(divide(env, ExtendedDigits, fromExtended(x128(i)), fromExtended(y128(i)))); };
+    auto compare128 = [&](size_t i, Environment &) { return compare(fromExtended(x128(i)), fromExtended(y128(i))); };
+
+    bool passed = true;
+    printf("Short:\n");
+    passed &= check("  add", count, [&](size_t i, Environment & env) { return hfp::add32(x32(i), y32(i), env); },
+                    add32, describe32);
+    passed &= check("  subtract", count, [&](size_t i, Environment & env) { return hfp::subtract32(x32(i), y32(i), env); },
+                    subtract32, describe32);
+    passed &= check("  add unnormalized", count,
+                    [&](size_t i, Environment & env) { return hfp::addUnnormalized32(x32(i), y32(i), env); },
+                    [&](size_t i, Environment & env)
+                    { return toShort(addUnnormalized(env, ShortDigits, fromShort(x32(i)), fromShort(y32(i)))); },
+                    describe32);
+    passed &= check("  subtract unnormalized", count,
+                    [&](size_t i, Environment & env) { return hfp::subtractUnnormalized32(x32(i), y32(i), env); },
+                    [&](size_t i, Environment & env)
+                    { return toShort(addUnnormalized(env, ShortDigits, fromShort(x32(i)), negated(fromShort(y32(i))))); },
+                    describe32);
+    passed &= check("  multiply", count, [&](size_t i, Environment & env) { return hfp::multiply32(x32(i), y32(i), env); },
+                    multiply32, describe32);
+    passed &= check("  divide", count, [&](size_t i, Environment & env) { return hfp::divide32(x32(i), y32(i), env); },
+                    divide32, describe32);
+    passed &= check("  compare", count, [&](size_t i, Environment & env) { return hfp::compare32(x32(i), y32(i), env); },
+                    compare32, describe32);
+    passed &= check("  round from long", count, [&](size_t i, Environment & env) { return hfp::round64to32(x64(i), env); },
+                    [&](size_t i, Environment & env) { return toShort(rounded(env, LongDigits, ShortDigits, fromLong(x64(i)))); },
+                    [&](size_t i) { printResult(x64(i)); });
+    passed &= check("  from int", count,
+                    [&](size_t i, Environment &) { return hfp::fromInt32(operands.ints[static_cast<qsizetype>(i)]); },
+                    [&](size_t i, Environment &) { return toShort(fromInt(ShortDigits, operands.ints[static_cast<qsizetype>(i)])); },
+                    [&](size_t i) { printResult(operands.ints[static_cast<qsizetype>(i)]); });
+    if (canConvertToDouble())
+    {
+        passed &= check("  to double", count, [&](size_t i, Environment &) { return hfp::toDouble32(x32(i)); },
+                        [&](size_t i, Environment &) { return toDouble(ShortDigits, fromShort(x32(i))); },
+                        [&](size_t i) { printResult(x32(i)); });
+    }
+    passed &= checkBatch<uint32_t>("  add (batch)", count,
+        [&](size_t start, size_t size, std::span<uint32_t> result, Environment & env)
+        { hfp::add32(span32(operands.x32, start, size), span32(operands.y32, start, size), result, env); },
+        add32);
+    passed &= checkBatch<uint32_t>("  subtract (batch)", count,
+        [&](size_t start, size_t size, std::span<uint32_t> result, Environment & env)
+        { hfp::subtract32(span32(operands.x32, start, size), span32(operands.y32, start, size), result, env); },
+        subtract32);
+    passed &= checkBatch<uint32_t>("  multiply (batch)", count,
+        [&](size_t start, size_t size, std::span<uint32_t> result, Environment & env)
+        { hfp::multiply32(span32(operands.x32, start, size), span32(operands.y32, start, size), result, env); },
+        multiply32);
+    passed &= checkBatch<uint32_t>("  divide (batch)", count,
+        [&](size_t start, size_t size, std::span<uint32_t> result, Environment & env)
+        { hfp::divide32(span32(operands.x32, start, size), span32(operands.y32, start, size), result, env); },
+        divide32);
+    passed &= checkBatch<int>("  compare (batch)", count,
+        [&](size_t start, size_t size, std::span<int> result, Environment & env)
+        { hfp::compare32(span32(operands.x32, start, size), span32(operands.y32, start, size), result, env); },
+        compare32);
+
+    printf("Long:\n");
+    passed &= check("  add", count, [&](size_t i, Environment & env) { return hfp::add64(x64(i), y64(i), env); },
+                    add64, describe64);
+    passed &= check("  subtract", count, [&](size_t i, Environment & env) { return hfp::subtract64(x64(i), y64(i), env); },
+                    subtract64, describe64);
+    passed &= check("  add unnormalized", count,
+                    [&](size_t i, Environment & env) { return hfp::addUnnormalized64(x64(i), y64(i), env); },
+                    [&](size_t i, Environment & env)
+                    { return toLong(addUnnormalized(env, LongDigits, fromLong(x64(i)), fromLong(y64(i)))); },
+                    describe64);
+    passed &= check("  subtract unnormalized", count,
+                    [&](size_t i, Environment & env) { return hfp::subtractUnnormalized64(x64(i), y64(i), env); },
+                    [&](size_t i, Environment & env)
+                    { return toLong(addUnnormalized(env, LongDigits, fromLong(x64(i)), negated(fromLong(y64(i))))); },
+                    describe64);
+    passed &= check("  multiply", count, [&](size_t i, Environment & env) { return hfp::multiply64(x64(i), y64(i), env); },
+                    multiply64, describe64);
+    passed &= check("  divide", count, [&](size_t i, Environment & env) { return hfp::divide64(x64(i), y64(i), env); },
+                    divide64, describe64);
+    passed &= check("  compare", count, [&](size_t i, Environment & env) { return hfp::compare64(x64(i), y64(i), env); },
+                    compare64, describe64);
+    passed &= check("  round from extended", count,
+                    [&](size_t i, Environment & env) { return hfp::round128to64(x128(i), env); },
+                    [&](size_t i, Environment & env)
+                    { return toLong(rounded(env, ExtendedDigits, LongDigits, fromExtended(x128(i)))); },
+                    [&](size_t i) { printResult(x128(i)); });
+    passed &= check("  from int", count,
+                    [&](size_t i, Environment &) { return hfp::fromInt64(operands.ints[static_cast<qsizetype>(i)]); },
+                    [&](size_t i, Environment &) { return toLong(fromInt(LongDigits, operands.ints[static_cast<qsizetype>(i)])); },
+                    [&](size_t i) { printResult(operands.ints[static_cast<qsizetype>(i)]); });
+    if (canConvertToDouble())
+    {
+        passed &= check("  to double", count, [&](size_t i, Environment &) { return hfp::toDouble64(x64(i)); },
+                        [&](size_t i, Environment &) { return toDouble(LongDigits, fromLong(x64(i))); },
+                        [&](size_t i) { printResult(x64(i)); });
+    }
+    passed &= checkBatch<uint64_t>("  add (batch)", count,
+        [&](size_t start, size_t size, std::span<uint64_t> result, Environment & env)
+        { hfp::add64(span64(operands.x64, start, size), span64(operands.y64, start, size), result, env); },
+        add64);
+    passed &= checkBatch<uint64_t>("  subtract (batch)", count,
+        [&](size_t start, size_t size, std::span<uint64_t> result, Environment & env)
+        { hfp::subtract64(span64(operands.x64, start, size), span64(operands.y64, start, size), result, env); },
+        subtract64);
+    passed &= checkBatch<uint64_t>("  multiply (batch)", count,
+        [&](size_t start, size_t size, std::span<uint64_t> result, Environment & env)
+        { hfp::multiply64(span64(operands.x64, start, size), span64(operands.y64, start, size), result, env); },
+        multiply64);
+    passed &= checkBatch<uint64_t>("  divide (batch)", count,
+        [&](size_t start, size_t size, std::span<uint64_t> result, Environment & env)
+        { hfp::divide64(span64(operands.x64, start, size), span64(operands.y64, start, size), result, env); },
+        divide64);
+    passed &= checkBatch<int>("  compare (batch)", count,
+        [&](size_t start, size_t size, std::span<int> result, Environment & env)
+        { hfp::compare64(span64(operands.x64, start, size), span64(operands.y64, start, size), result, env); },
+        compare64);
+
+    printf("Extended:\n");
+    passed &= check("  add", count, [&](size_t i, Environment & env) { return hfp::add128(x128(i), y128(i), env); },
+                    add128, describe128);
+    passed &= check("  subtract", count, [&](size_t i, Environment & env) { return hfp::subtract128(x128(i), y128(i), env); },
+                    subtract128, describe128);
+    passed &= check("  multiply", count, [&](size_t i, Environment & env) { return hfp::multiply128(x128(i), y128(i), env); },
+                    multiply128, describe128);
+    passed &= check("  divide", count, [&](size_t i, Environment & env) { return hfp::divide128(x128(i), y128(i), env); },
+                    divide128, describe128);
+    passed &= check("  compare", count, [&](size_t i, Environment & env) { return hfp::compare128(x128(i), y128(i), env); },
+                    compare128, describe128);
+    passed &= check("  multiply long", count,
+                    [&](size_t i, Environment & env) { return hfp::multiply64to128(x64(i), y64(i), env); },
+                    [&](size_t i, Environment & env)
+                    { return toExtended(multiply(env, LongDigits, ExtendedDigits, fromLong(x64(i)), fromLong(y64(i)))); },
+                    describe64);
+    passed &= check("  extend long", count,
+                    [&](size_t i, Environment &) { return hfp::extend64(x64(i)); },
+                    [&](size_t i, Environment &)
+                    {   //  The high-order part is the long value as it is, even a dirty zero
+                        Extended result = toExtended(fromExtended(Extended { x64(i), 0 }));
+                        result.high = x64(i);
+                        return result;
+                    },
+                    [&](size_t i) { printResult(x64(i)); });
+    passed &= checkBatch<Extended>("  add (batch)", count,
+        [&](size_t start, size_t size, std::span<Extended> result, Environment & env)
+        { hfp::add128(span128(operands.x128, start, size), span128(operands.y128, start, size), result, env); },
+        add128);
+    passed &= checkBatch<Extended>("  subtract (batch)", count,
+        [&](size_t start, size_t size, std::span<Extended> result, Environment & env)
+        { hfp::subtract128(span128(operands.x128, start, size), span128(operands.y128, start, size), result, env); },
+        subtract128);
+    passed &= checkBatch<Extended>("  multiply (batch)", count,
+        [&](size_t start, size_t size, std::span<Extended> result, Environment & env)
+        { hfp::multiply128(span128(operands.x128, start, size), span128(operands.y128, start, size), result, env); },
+        multiply128);
+    passed &= checkBatch<Extended>("  divide (batch)", count,
+        [&](size_t start, size_t size, std::span<Extended> result, Environment & env)
+        { hfp::divide128(span128(operands.x128, start, size), span128(operands.y128, start, size), result, env); },
+        divide128);
+    passed &= checkBatch<int>("  compare (batch)", count,
+        [&](size_t start, size_t size, std::span<int> result, Environment & env)
+        { hfp::compare128(span128(operands.x128, start, size), span128(operands.y128, start, size), result, env); },
+        compare128);
+    return passed;
+}
+
+//////////
+//  Entry point
+int main(int argc, char ** argv)
+{
+    size_t count = 100 * 1000;
+    if (argc > 2 || (argc == 2 && (count = static_cast<size_t>(strtoull(argv[1], nullptr, 10)) * 1000) == 0))
+    {
+        fprintf(stderr, "Usage: ibmhfp-verify [<thousands of operands per operation>]\n");
+        return 1;
+    }
+    printf("%zu operands per operation%s\n", count,
+           canConvertToDouble() ? "" : "; conversions to double are not checked, as long double is too narrow");
+
+    Operands operands;
+    generateOperands(operands, count);
+    printf("%-32s %10s\n", "operation", "operands");
+    return checkAll(operands, count) ? 0 : 1;
+}
+
+//  End of main.cpp
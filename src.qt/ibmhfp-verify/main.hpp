@@ -0,0 +1,16 @@
+//
+//  main.hpp - The master header
+//
+//////////
+
+//////////
+//  HADES VM
+#include "hadesvm-util/API.hpp"
+#include "hadesvm-ibmhfp/API.hpp"
+
+//////////
+//  CRT
+#include <float.h>
+#include <stdio.h>
+
+//  End of main.hpp
@@ -0,0 +1,217 @@
+//
+//  main.cpp - measures the throughput of hadesvm-ieee754 arithmetic:
+//      *   the 128-bit mantissa kernels (hadesvm::util::Math::multiply64x64
+//          and divide128by64) against the partial-product multiplication
+//          and bit-by-bit division they have replaced;
+//      *   Real21 arithmetic, which always takes the soft-float path;
+//      *   Real32 and Real64 arithmetic, which mostly takes the host FPU path;
+//      *   single-precision arithmetic on Real32 values kept in 64-bit form,
+//          and on 64-bit values with more mantissa bits than a Real32 holds.
+//  Usage: ieee754-bench [<millions of operations per measurement>]
+//
+//////////
+#include "main.hpp"
+
+//////////
+//  Operands
+static const size_t OperandCount = 4096;    //  must be a power of 2
+
+static uint64_t mantissasX[OperandCount];
+static uint64_t mantissasY[OperandCount];
+static hadesvm::ieee754::Real21 reals21X[OperandCount];
+static hadesvm::ieee754::Real21 reals21Y[OperandCount];
+static hadesvm::ieee754::Real32 reals32X[OperandCount];
+static hadesvm::ieee754::Real32 reals32Y[OperandCount];
+static hadesvm::ieee754::Real64 reals64X[OperandCount];
+static hadesvm::ieee754::Real64 reals64Y[OperandCount];
+static hadesvm::ieee754::Real64 widened32X[OperandCount];
+static hadesvm::ieee754::Real64 widened32Y[OperandCount];
+
+static uint64_t randomState = UINT64_C(0x9E3779B97F4A7C15);
+
+static uint64_t nextRandom()
+{   //  xorshift64*
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    return randomState * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+//  Random normalized values of either sign with small exponents, so
+//  that no result of the measured operations overflows or underflows
+static void generateOperands()
+{
+    for (size_t i = 0; i < OperandCount; i++)
+    {
+        mantissasX[i] = nextRandom() | UINT64_C(0x8000000000000000);
+        mantissasY[i] = nextRandom() | UINT64_C(0x8000000000000000);
+        reals21X[i] = hadesvm::ieee754::Real21::fromBitPattern(
+            static_cast<uint32_t>((nextRandom() & 0x00103FFF) | ((31 - 4 + nextRandom() % 8) << 14)));
+        reals21Y[i] = hadesvm::ieee754::Real21::fromBitPattern(
+            static_cast<uint32_t>((nextRandom() & 0x00103FFF) | ((31 - 4 + nextRandom() % 8) << 14)));
+        reals32X[i] = hadesvm::ieee754::Real32::fromBitPattern(
+            static_cast<uint32_t>((nextRandom() & 0x807FFFFF) | ((127 - 16 + nextRandom() % 32) << 23)));
+        reals32Y[i] = hadesvm::ieee754::Real32::fromBitPattern(
+            static_cast<uint32_t>((nextRandom() & 0x807FFFFF) | ((127 - 16 + nextRandom() % 32) << 23)));
+        reals64X[i] = hadesvm::ieee754::Real64::fromBitPattern(
+            (nextRandom() & UINT64_C(0x800FFFFFFFFFFFFF)) | ((1023 - 16 + nextRandom() % 32) << 52));
+        reals64Y[i] = hadesvm::ieee754::Real64::fromBitPattern(
+            (nextRandom() & UINT64_C(0x800FFFFFFFFFFFFF)) | ((1023 - 16 + nextRandom() % 32) << 52));
+        widened32X[i] = reals32X[i].toReal64();
+        widened32Y[i] = reals32Y[i].toReal64();
+    }
+}
+
+//////////
+//  The mantissa kernels replaced by hadesvm::util::Math ones, kept as
+//  they were for comparison
+static uint64_t legacyMultiply(uint64_t x, uint64_t y)
+{
+    uint64_t partialProducts[4];
+    partialProducts[0] = 0;
+    partialProducts[1] = (x >> 32) * (y >> 32);
+    partialProducts[2] = (x & UINT64_C(0x00000000FFFFFFFF)) * (y >> 32) +
+                         (y & UINT64_C(0x00000000FFFFFFFF)) * (x >> 32);
+    partialProducts[3] = (x & UINT64_C(0x00000000FFFFFFFF)) * (y & UINT64_C(0x00000000FFFFFFFF));
+    for (int i = 3; i > 0; i--)
+    {
+        if ((partialProducts[i] & UINT64_C(0xFFFFFFFF00000000)) != 0)
+        {
+            partialProducts[i - 1] += (partialProducts[i] >> 32);
+            partialProducts[i] &= UINT64_C(0x00000000FFFFFFFF);
+        }
+    }
+    return (partialProducts[0] << 32) | partialProducts[1];
+}
+
+static uint64_t legacyDivide(uint64_t dividend, uint64_t divisor)
+{
+    uint64_t resultMantissa = 0;
+    for (int i = 0; i < 64; i++)
+    {
+        uint64_t bit = 0;
+        if (dividend >= divisor)
+        {
+            dividend -= divisor;
+            bit = 1;
+        }
+        resultMantissa = (resultMantissa << 1) | bit;
+        if (i == 0)
+        {
+            divisor >>= 1;
+        }
+        else
+        {
+            dividend <<= 1;
+        }
+    }
+    return resultMantissa;
+}
+
+//////////
+//  Measurement
+template <class Operation>
+static void measure(const char * name, uint64_t operations, Operation operation)
+{
+    uint64_t sink = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        sink ^= operation(static_cast<size_t>(i) & (OperandCount - 1));
+    }
+    qint64 elapsedNs = qMax(timer.nsecsElapsed(), Q_INT64_C(1));
+    //  Print the "sink" so that the compiler can't throw the work away
+    printf("%-24s %10.2f Mops/s    [%016llx]\n",
+           name,
+           static_cast<double>(operations) * 1000.0 / static_cast<double>(elapsedNs),
+           static_cast<unsigned long long>(sink));
+}
+
+//////////
+//  Entry point
+int main(int argc, char ** argv)
+{
+    uint64_t operations = UINT64_C(10) * 1000 * 1000;
+    if (argc > 2 || (argc == 2 && (operations = strtoull(argv[1], nullptr, 10) * 1000 * 1000) == 0))
+    {
+        fprintf(stderr, "Usage: ieee754-bench [<millions of operations per measurement>]\n");
+        return 1;
+    }
+    generateOperands();
+
+    printf("Mantissa kernels:\n");
+    measure("  multiply (legacy)", operations,
+            [](size_t i) { return legacyMultiply(mantissasX[i], mantissasY[i]); });
+    measure("  multiply (128-bit)", operations,
+            [](size_t i)
+            {
+                uint64_t low = 0;
+                return hadesvm::util::Math::multiply64x64(mantissasX[i], mantissasY[i], low) ^ low;
+            });
+    measure("  divide (legacy)", operations,
+            [](size_t i) { return legacyDivide(mantissasX[i], mantissasY[i]); });
+    measure("  divide (128-bit)", operations,
+            [](size_t i)
+            {
+                uint64_t remainder = 0;
+                return hadesvm::util::Math::divide128by64(mantissasX[i] >> 1, 0, mantissasY[i], remainder) ^ remainder;
+            });
+
+    hadesvm::ieee754::Environment environment;
+    printf("Real21 (soft-float):\n");
+    measure("  add", operations,
+            [&](size_t i) { return reals21X[i].add(reals21Y[i], environment).bitPattern; });
+    measure("  subtract", operations,
+            [&](size_t i) { return reals21X[i].subtract(reals21Y[i], environment).bitPattern; });
+    measure("  multiply", operations,
+            [&](size_t i) { return reals21X[i].multiply(reals21Y[i], environment).bitPattern; });
+    measure("  divide", operations,
+            [&](size_t i) { return reals21X[i].divide(reals21Y[i], environment).bitPattern; });
+
+    printf("Real32:\n");
+    measure("  add", operations,
+            [&](size_t i) { return reals32X[i].add(reals32Y[i], environment).bitPattern; });
+    measure("  subtract", operations,
+            [&](size_t i) { return reals32X[i].subtract(reals32Y[i], environment).bitPattern; });
+    measure("  multiply", operations,
+            [&](size_t i) { return reals32X[i].multiply(reals32Y[i], environment).bitPattern; });
+    measure("  divide", operations,
+            [&](size_t i) { return reals32X[i].divide(reals32Y[i], environment).bitPattern; });
+
+    printf("Real64:\n");
+    measure("  add", operations,
+            [&](size_t i) { return reals64X[i].add(reals64Y[i], environment).bitPattern; });
+    measure("  subtract", operations,
+            [&](size_t i) { return reals64X[i].subtract(reals64Y[i], environment).bitPattern; });
+    measure("  multiply", operations,
+            [&](size_t i) { return reals64X[i].multiply(reals64Y[i], environment).bitPattern; });
+    measure("  divide", operations,
+            [&](size_t i) { return reals64X[i].divide(reals64Y[i], environment).bitPattern; });
+
+    printf("Real32 in 64-bit form:\n");
+    measure("  add (round trips)", operations,
+            [&](size_t i) { return widened32X[i].toReal32(environment).add(widened32Y[i].toReal32(environment), environment).toReal64(environment).bitPattern; });
+    measure("  add", operations,
+            [&](size_t i) { return widened32X[i].addAsReal32(widened32Y[i], environment).bitPattern; });
+    measure("  subtract", operations,
+            [&](size_t i) { return widened32X[i].subtractAsReal32(widened32Y[i], environment).bitPattern; });
+    measure("  multiply", operations,
+            [&](size_t i) { return widened32X[i].multiplyAsReal32(widened32Y[i], environment).bitPattern; });
+    measure("  divide", operations,
+            [&](size_t i) { return widened32X[i].divideAsReal32(widened32Y[i], environment).bitPattern; });
+    //  Operands with more mantissa bits than a Real32 holds, which the
+    //  host FPU path leaves to soft-float
+    printf("Real32 in 64-bit form, wide operands:\n");
+    measure("  add (round trips)", operations,
+            [&](size_t i) { return reals64X[i].toReal32(environment).add(reals64Y[i].toReal32(environment), environment).toReal64(environment).bitPattern; });
+    measure("  add", operations,
+            [&](size_t i) { return reals64X[i].addAsReal32(reals64Y[i], environment).bitPattern; });
+    measure("  multiply (round trips)", operations,
+            [&](size_t i) { return reals64X[i].toReal32(environment).multiply(reals64Y[i].toReal32(environment), environment).toReal64(environment).bitPattern; });
+    measure("  multiply", operations,
+            [&](size_t i) { return reals64X[i].multiplyAsReal32(reals64Y[i], environment).bitPattern; });
+    return 0;
+}
+
+//  End of main.cpp
@@ -0,0 +1,15 @@
+//
+//  main.hpp - The master header
+//
+//////////
+
+//////////
+//  HADES VM
+#include "hadesvm-util/API.hpp"
+#include "hadesvm-ieee754/API.hpp"
+
+//////////
+//  CRT
+#include <stdio.h>
+
+//  End of main.hpp
@@ -0,0 +1,880 @@
+//
+//  main.cpp - checks that hadesvm::ieee754::Batch operations are
+//  bit-exact against the scalar Real32/Real64 operations they batch
+//  (results and exception flags alike) and measures the throughput of
+//  both. Operands are generated the way TestFloat does it: special
+//  exponents (zeros, denormals, infinities, NaNs, the extremes of the
+//  normalized range) and mantissas made of runs of ones and zeros are
+//  mixed with plain random ones, and second operands are often given
+//  exponents close to the first ones to exercise cancellation. Exception
+//  flags are compared for every 4096-element chunk, and then again for
+//  every group of elements a SIMD kernel does at once.
+//  Real21/Real32/Real64 multiplication and division are also checked
+//  against a reference model that forms exact products and quotients of
+//  normalized operands as integers of any length, and Real32 operations
+//  on 64-bit encodings against narrowing, operating and widening.
+//  Usage: ieee754-verify [<thousands of operands per operation>]
+//
+//////////
+#include "main.hpp"
+
+//////////
+//  Operand generation
+static uint64_t randomState = UINT64_C(0x2545F4914F6CDD1D);
+
+static uint64_t nextRandom()
+{   //  xorshift64*
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    return randomState * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+struct Binary21
+{
+    using Bits = uint32_t;
+    static const int MantissaBits = 14;
+    static const int SignShift = 20;
+    static const Bits ExponentMax = 0x003F;
+};
+
+struct Binary32
+{
+    using Bits = uint32_t;
+    static const int MantissaBits = 23;
+    static const int SignShift = 31;
+    static const Bits ExponentMax = 0x00FF;
+};
+
+struct Binary64
+{
+    using Bits = uint64_t;
+    static const int MantissaBits = 52;
+    static const int SignShift = 63;
+    static const Bits ExponentMax = 0x07FF;
+};
+
+template <class Format>
+static typename Format::Bits randomMantissa()
+{
+    using Bits = typename Format::Bits;
+    const Bits mask = (Bits(1) << Format::MantissaBits) - 1;
+    switch (nextRandom() % 6)
+    {
+        case 0:     //  a power of 2
+            return 0;
+        case 1:     //  all ones
+            return mask;
+        case 2:     //  a single one
+            return Bits(1) << (nextRandom() % Format::MantissaBits);
+        case 3:     //  a run of ones at the bottom
+            return mask >> (nextRandom() % Format::MantissaBits);
+        case 4:     //  a run of ones at the top
+            return (mask << (nextRandom() % Format::MantissaBits)) & mask;
+        default:
+            return static_cast<Bits>(nextRandom()) & mask;
+    }
+}
+
+template <class Format>
+static typename Format::Bits randomExponent()
+{
+    using Bits = typename Format::Bits;
+    switch (nextRandom() % 8)
+    {
+        case 0:     //  a zero or a denormal
+            return 0;
+        case 1:     //  an infinity or a NaN
+            return Format::ExponentMax;
+        case 2:     //  the smallest normalized
+            return static_cast<Bits>(1 + nextRandom() % 2);
+        case 3:     //  the largest normalized
+            return static_cast<Bits>(Format::ExponentMax - 1 - nextRandom() % 2);
+        default:
+            return static_cast<Bits>(1 + nextRandom() % (Format::ExponentMax - 1));
+    }
+}
+
+template <class Format>
+static typename Format::Bits makeValue(typename Format::Bits exponent)
+{
+    using Bits = typename Format::Bits;
+    Bits sign = static_cast<Bits>(nextRandom() & 1) << Format::SignShift;
+    return sign | (exponent << Format::MantissaBits) | randomMantissa<Format>();
+}
+
+//  A "typical" value is a normalized one of a moderate magnitude, the
+//  kind real programs mostly work with
+template <class Format>
+static typename Format::Bits randomValue(bool typical)
+{
+    using Bits = typename Format::Bits;
+    if (typical)
+    {
+        return (static_cast<Bits>(nextRandom()) & ~(Format::ExponentMax << Format::MantissaBits)) |
+               (static_cast<Bits>(Format::ExponentMax / 2 - 16 + nextRandom() % 32) << Format::MantissaBits);
+    }
+    return makeValue<Format>(randomExponent<Format>());
+}
+
+//  Half of the time, a value whose exponent is within "spread" of "centre"
+template <class Format>
+static typename Format::Bits randomValueNear(bool typical, typename Format::Bits centre, int spread)
+{
+    using Bits = typename Format::Bits;
+    if ((nextRandom() & 1) != 0)
+    {
+        return randomValue<Format>(typical);
+    }
+    int64_t exponent = static_cast<int64_t>(centre) +
+                       static_cast<int64_t>(nextRandom() % static_cast<uint64_t>(2 * spread + 1)) - spread;
+    exponent = qBound(int64_t(0), exponent, static_cast<int64_t>(Format::ExponentMax));
+    return makeValue<Format>(static_cast<Bits>(exponent));
+}
+
+struct Operands
+{
+    Operands() : x32(), y32(), x64(), y64(), narrowed() {}
+
+    QList<uint32_t> x32, y32;
+    QList<uint64_t> x64, y64;
+    QList<uint64_t> narrowed;   //  values around the binary32 range
+};
+
+template <class Format>
+static void generateOperands(bool typical, QList<typename Format::Bits> & x, QList<typename Format::Bits> & y, size_t count)
+{
+    x.resize(static_cast<qsizetype>(count));
+    y.resize(static_cast<qsizetype>(count));
+    for (size_t i = 0; i < count; i++)
+    {
+        x[static_cast<qsizetype>(i)] = randomValue<Format>(typical);
+        y[static_cast<qsizetype>(i)] = randomValueNear<Format>(
+            typical,
+            (x[static_cast<qsizetype>(i)] >> Format::MantissaBits) & Format::ExponentMax,
+            typical ? 16 : 2 * (Format::MantissaBits + 1));
+    }
+}
+
+static void generateOperands(bool typical, Operands & operands, size_t count)
+{
+    generateOperands<Binary32>(typical, operands.x32, operands.y32, count);
+    generateOperands<Binary64>(typical, operands.x64, operands.y64, count);
+    operands.narrowed.resize(static_cast<qsizetype>(count));
+    for (size_t i = 0; i < count; i++)
+    {
+        operands.narrowed[static_cast<qsizetype>(i)] = typical ?
+            randomValue<Binary64>(true) :
+            randomValueNear<Binary64>(false, 1023, 140);
+    }
+}
+
+//////////
+//  Checking
+static const size_t ChunkSize = 4096;   //  elements sharing an environment
+static const size_t GroupSize = 4;      //  elements a SIMD kernel does at once
+
+static double megaOpsPerSecond(size_t count, qint64 elapsedNs)
+{
+    return static_cast<double>(count) * 1000.0 / static_cast<double>(qMax(elapsedNs, Q_INT64_C(1)));
+}
+
+//  Runs "batchOperation(start, size, result, environment)" and
+//  "scalarOperation(index, environment)" over "count" elements, chunk by
+//  chunk, and compares their results and the exception flags raised by
+//  each chunk. As flags raised by one element of a chunk can hide wrong
+//  flags of another one, the flags are then compared once more for each
+//  group of elements done at once by a SIMD kernel, in a run that isn't
+//  timed. Returns true if they all agree.
+template <class Result, class BatchOperation, class ScalarOperation, class Describe>
+static bool check(const char * name, size_t count,
+                  BatchOperation batchOperation, ScalarOperation scalarOperation, Describe describe)
+{
+    size_t chunkCount = (count + ChunkSize - 1) / ChunkSize;
+    QList<Result> batchResults(static_cast<qsizetype>(count)), scalarResults(static_cast<qsizetype>(count));
+    QList<hadesvm::ieee754::Exception> batchExceptions(static_cast<qsizetype>(chunkCount)),
+                                       scalarExceptions(static_cast<qsizetype>(chunkCount));
+
+    QElapsedTimer timer;
+    timer.start();
+    for (size_t chunk = 0; chunk < chunkCount; chunk++)
+    {
+        size_t start = chunk * ChunkSize;
+        size_t size = qMin(ChunkSize, count - start);
+        hadesvm::ieee754::Environment environment;
+        batchOperation(start, size, std::span<Result>(batchResults.data() + start, size), environment);
+        batchExceptions[static_cast<qsizetype>(chunk)] = environment.exception;
+    }
+    qint64 batchNs = timer.nsecsElapsed();
+
+    timer.restart();
+    for (size_t chunk = 0; chunk < chunkCount; chunk++)
+    {
+        size_t start = chunk * ChunkSize;
+        size_t size = qMin(ChunkSize, count - start);
+        hadesvm::ieee754::Environment environment;
+        for (size_t i = start; i < start + size; i++)
+        {
+            scalarResults[static_cast<qsizetype>(i)] = scalarOperation(i, environment);
+        }
+        scalarExceptions[static_cast<qsizetype>(chunk)] = environment.exception;
+    }
+    qint64 scalarNs = timer.nsecsElapsed();
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        Result batchResult = batchResults[static_cast<qsizetype>(i)];
+        Result scalarResult = scalarResults[static_cast<qsizetype>(i)];
+        if (batchResult != scalarResult && mismatches++ < 5)
+        {
+            printf("    %s: ", name);
+            describe(i);
+            printf(" -> scalar %llx, batch %llx\n",
+                   static_cast<unsigned long long>(scalarResult),
+                   static_cast<unsigned long long>(batchResult));
+        }
+    }
+    for (size_t chunk = 0; chunk < chunkCount; chunk++)
+    {
+        hadesvm::ieee754::Exception batchException = batchExceptions[static_cast<qsizetype>(chunk)];
+        hadesvm::ieee754::Exception scalarException = scalarExceptions[static_cast<qsizetype>(chunk)];
+        if (batchException != scalarException && mismatches++ < 5)
+        {
+            printf("    %s: chunk %zu -> scalar flags %02x, batch flags %02x\n",
+                   name, chunk, static_cast<int>(scalarException), static_cast<int>(batchException));
+        }
+    }
+    for (size_t start = 0; start < count; start += GroupSize)
+    {
+        size_t size = qMin(GroupSize, count - start);
+        Result results[GroupSize];
+        hadesvm::ieee754::Environment batchEnvironment, scalarEnvironment;
+        batchOperation(start, size, std::span<Result>(results, size), batchEnvironment);
+        for (size_t i = start; i < start + size; i++)
+        {
+            scalarOperation(i, scalarEnvironment);
+        }
+        if (batchEnvironment.exception != scalarEnvironment.exception && mismatches++ < 5)
+        {
+            printf("    %s: elements %zu..%zu -> scalar flags %02x, batch flags %02x\n",
+                   name, start, start + size - 1,
+                   static_cast<int>(scalarEnvironment.exception), static_cast<int>(batchEnvironment.exception));
+        }
+    }
+
+    printf("%-16s %14.2f %14.2f    %s\n",
+           name, megaOpsPerSecond(count, scalarNs), megaOpsPerSecond(count, batchNs),
+           (mismatches == 0) ? "ok" : "MISMATCH");
+    return mismatches == 0;
+}
+
+template <class Bits>
+static void describeOperands(Bits x, Bits y)
+{
+    printf("%llx, %llx", static_cast<unsigned long long>(x), static_cast<unsigned long long>(y));
+}
+
+//  Checks all batch operations on the operand set, printing a line per
+//  operation; returns true if they all agree with the scalar path
+static bool checkAll(const Operands & operands, size_t count)
+{
+    using hadesvm::ieee754::Batch;
+    using hadesvm::ieee754::Environment;
+    using hadesvm::ieee754::Real32;
+    using hadesvm::ieee754::Real64;
+
+    const QList<uint32_t> & x32 = operands.x32;
+    const QList<uint32_t> & y32 = operands.y32;
+    const QList<uint64_t> & x64 = operands.x64;
+    const QList<uint64_t> & y64 = operands.y64;
+    const QList<uint64_t> & narrowed = operands.narrowed;
+
+    auto span32 = [](const QList<uint32_t> & list, size_t start, size_t size)
+                  { return std::span<const uint32_t>(list.constData() + start, size); };
+    auto span64 = [](const QList<uint64_t> & list, size_t start, size_t size)
+                  { return std::span<const uint64_t>(list.constData() + start, size); };
+    auto describe32 = [&](size_t i) { describeOperands(x32[static_cast<qsizetype>(i)], y32[static_cast<qsizetype>(i)]); };
+    auto describe64 = [&](size_t i) { describeOperands(x64[static_cast<qsizetype>(i)], y64[static_cast<qsizetype>(i)]); };
+    auto x32At = [&](size_t i) { return Real32::fromBitPattern(x32[static_cast<qsizetype>(i)]); };
+    auto y32At = [&](size_t i) { return Real32::fromBitPattern(y32[static_cast<qsizetype>(i)]); };
+    auto x64At = [&](size_t i) { return Real64::fromBitPattern(x64[static_cast<qsizetype>(i)]); };
+    auto y64At = [&](size_t i) { return Real64::fromBitPattern(y64[static_cast<qsizetype>(i)]); };
+
+    printf("%-16s %14s %14s\n", "operation", "scalar Mops/s", "batch Mops/s");
+    bool passed = true;
+
+    passed &= check<uint32_t>("Real32 add", count,
+        [&](size_t start, size_t size, std::span<uint32_t> result, Environment & environment)
+        { Batch::add32(span32(x32, start, size), span32(y32, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x32At(i).add(y32At(i), environment).bitPattern; },
+        describe32);
+    passed &= check<uint32_t>("Real32 subtract", count,
+        [&](size_t start, size_t size, std::span<uint32_t> result, Environment & environment)
+        { Batch::subtract32(span32(x32, start, size), span32(y32, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x32At(i).subtract(y32At(i), environment).bitPattern; },
+        describe32);
+    passed &= check<uint32_t>("Real32 multiply", count,
+        [&](size_t start, size_t size, std::span<uint32_t> result, Environment & environment)
+        { Batch::multiply32(span32(x32, start, size), span32(y32, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x32At(i).multiply(y32At(i), environment).bitPattern; },
+        describe32);
+    passed &= check<uint32_t>("Real32 divide", count,
+        [&](size_t start, size_t size, std::span<uint32_t> result, Environment & environment)
+        { Batch::divide32(span32(x32, start, size), span32(y32, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x32At(i).divide(y32At(i), environment).bitPattern; },
+        describe32);
+    passed &= check<int>("Real32 compare", count,
+        [&](size_t start, size_t size, std::span<int> result, Environment & environment)
+        { Batch::compare32(span32(x32, start, size), span32(y32, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x32At(i).compare(y32At(i), environment); },
+        describe32);
+    passed &= check<uint64_t>("Real32 toReal64", count,
+        [&](size_t start, size_t size, std::span<uint64_t> result, Environment & environment)
+        { Batch::toReal64(span32(x32, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x32At(i).toReal64(environment).bitPattern; },
+        [&](size_t i) { printf("%llx", static_cast<unsigned long long>(x32[static_cast<qsizetype>(i)])); });
+
+    passed &= check<uint64_t>("Real64 add", count,
+        [&](size_t start, size_t size, std::span<uint64_t> result, Environment & environment)
+        { Batch::add64(span64(x64, start, size), span64(y64, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x64At(i).add(y64At(i), environment).bitPattern; },
+        describe64);
+    passed &= check<uint64_t>("Real64 subtract", count,
+        [&](size_t start, size_t size, std::span<uint64_t> result, Environment & environment)
+        { Batch::subtract64(span64(x64, start, size), span64(y64, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x64At(i).subtract(y64At(i), environment).bitPattern; },
+        describe64);
+    passed &= check<uint64_t>("Real64 multiply", count,
+        [&](size_t start, size_t size, std::span<uint64_t> result, Environment & environment)
+        { Batch::multiply64(span64(x64, start, size), span64(y64, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x64At(i).multiply(y64At(i), environment).bitPattern; },
+        describe64);
+    passed &= check<uint64_t>("Real64 divide", count,
+        [&](size_t start, size_t size, std::span<uint64_t> result, Environment & environment)
+        { Batch::divide64(span64(x64, start, size), span64(y64, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x64At(i).divide(y64At(i), environment).bitPattern; },
+        describe64);
+    passed &= check<int>("Real64 compare", count,
+        [&](size_t start, size_t size, std::span<int> result, Environment & environment)
+        { Batch::compare64(span64(x64, start, size), span64(y64, start, size), result, environment); },
+        [&](size_t i, Environment & environment) { return x64At(i).compare(y64At(i), environment); },
+        describe64);
+    passed &= check<uint32_t>("Real64 toReal32", count,
+        [&](size_t start, size_t size, std::span<uint32_t> result, Environment & environment)
+        { Batch::toReal32(span64(narrowed, start, size), result, environment); },
+        [&](size_t i, Environment & environment)
+        { return Real64::fromBitPattern(narrowed[static_cast<qsizetype>(i)]).toReal32(environment).bitPattern; },
+        [&](size_t i) { printf("%llx", static_cast<unsigned long long>(narrowed[static_cast<qsizetype>(i)])); });
+
+    return passed;
+}
+
+//////////
+//  The reference model. It works on the integer significands of normalized
+//  operands as integers of any length, forms the exact product or quotient
+//  and only then truncates it to the result format, the way FpValue always
+//  does regardless of the rounding mode. It shares no code with the library
+//  and uses no fixed-width significand arithmetic. Results in the
+//  denormalized range are not checked, as FpValue does not handle them the
+//  IEEE-754 way: they are counted as skipped.
+namespace
+{
+    //  An unsigned integer of any length, just enough for the reference model
+    class Natural final
+    {
+    public:
+        Natural() : _limbs() {}
+        explicit Natural(uint64_t value)
+            :   _limbs()
+        {
+            for (; value != 0; value >>= 32)
+            {
+                _limbs.append(static_cast<uint32_t>(value));
+            }
+        }
+
+        bool        isZero() const { return _limbs.isEmpty(); }
+
+        int         bitLength() const
+        {
+            return _limbs.isEmpty() ?
+                        0 :
+                        32 * static_cast<int>(_limbs.size()) - static_cast<int>(qCountLeadingZeroBits(_limbs.last()));
+        }
+
+        //  The rightmost 64 bits
+        uint64_t    low64() const
+        {
+            uint64_t result = 0;
+            for (qsizetype i = qMin(_limbs.size(), qsizetype(2)) - 1; i >= 0; i--)
+            {
+                result = (result << 32) | _limbs[i];
+            }
+            return result;
+        }
+
+        int         compare(const Natural & op2) const
+        {
+            if (_limbs.size() != op2._limbs.size())
+            {
+                return (_limbs.size() < op2._limbs.size()) ? -1 : 1;
+            }
+            for (qsizetype i = _limbs.size() - 1; i >= 0; i--)
+            {
+                if (_limbs[i] != op2._limbs[i])
+                {
+                    return (_limbs[i] < op2._limbs[i]) ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+        Natural     operator * (const Natural & op2) const
+        {
+            Natural result;
+            result._limbs.fill(0, _limbs.size() + op2._limbs.size());
+            for (qsizetype i = 0; i < _limbs.size(); i++)
+            {
+                uint64_t carry = 0;
+                for (qsizetype j = 0; j < op2._limbs.size(); j++)
+                {
+                    carry += static_cast<uint64_t>(_limbs[i]) * op2._limbs[j] + result._limbs[i + j];
+                    result._limbs[i + j] = static_cast<uint32_t>(carry);
+                    carry >>= 32;
+                }
+                result._limbs[i + op2._limbs.size()] = static_cast<uint32_t>(carry);
+            }
+            result._trim();
+            return result;
+        }
+
+        Natural     operator << (int count) const
+        {
+            if (isZero())
+            {
+                return *this;
+            }
+            Natural result;
+            result._limbs.fill(0, count / 32);
+            uint32_t carry = 0;
+            for (uint32_t limb : _limbs)
+            {
+                result._limbs.append((count % 32 == 0) ? limb : ((limb << (count % 32)) | carry));
+                carry = (count % 32 == 0) ? 0 : (limb >> (32 - count % 32));
+            }
+            result._limbs.append(carry);
+            result._trim();
+            return result;
+        }
+
+        Natural     operator >> (int count) const
+        {
+            Natural result;
+            for (qsizetype i = count / 32; i < _limbs.size(); i++)
+            {
+                uint64_t pair = (static_cast<uint64_t>(_limb(i + 1)) << 32) | _limbs[i];
+                result._limbs.append(static_cast<uint32_t>(pair >> (count % 32)));
+            }
+            result._trim();
+            return result;
+        }
+
+        //  The quotient, truncated; "divisor" must not be zero
+        Natural     operator / (const Natural & divisor) const
+        {   //  One bit at a time, working on the remainder in place
+            Q_ASSERT(!divisor.isZero());
+            Natural quotient, remainder;
+            quotient._limbs.fill(0, _limbs.size());
+            for (int bit = bitLength() - 1; bit >= 0; bit--)
+            {
+                remainder._shiftLeftOneBit(((_limbs[bit / 32] >> (bit % 32)) & 1) != 0);
+                if (remainder.compare(divisor) >= 0)
+                {
+                    remainder._subtract(divisor);
+                    quotient._limbs[bit / 32] |= UINT32_C(1) << (bit % 32);
+                }
+            }
+            quotient._trim();
+            return quotient;
+        }
+
+    private:
+        QList<uint32_t> _limbs;     //  least significant first, no leading zero limbs
+
+        uint32_t    _limb(qsizetype index) const { return (index < _limbs.size()) ? _limbs[index] : 0; }
+
+        void        _trim()
+        {
+            while (!_limbs.isEmpty() && _limbs.last() == 0)
+            {
+                _limbs.removeLast();
+            }
+        }
+
+        void        _subtract(const Natural & op2)
+        {
+            int64_t borrow = 0;
+            for (qsizetype i = 0; i < _limbs.size(); i++)
+            {
+                int64_t difference = static_cast<int64_t>(_limbs[i]) - op2._limb(i) - borrow;
+                borrow = (difference < 0) ? 1 : 0;
+                _limbs[i] = static_cast<uint32_t>(difference + (borrow << 32));
+            }
+            _trim();
+        }
+
+        void        _shiftLeftOneBit(bool newBit)
+        {
+            uint32_t carry = newBit ? 1 : 0;
+            for (uint32_t & limb : _limbs)
+            {
+                uint32_t nextCarry = limb >> 31;
+                limb = (limb << 1) | carry;
+                carry = nextCarry;
+            }
+            if (carry != 0)
+            {
+                _limbs.append(carry);
+            }
+        }
+    };
+}
+
+template <class Format>
+static int biasOf()
+{
+    return static_cast<int>(Format::ExponentMax / 2);
+}
+
+//  The value of a normalized operand is "significand * 2**exponentOf()"
+template <class Format>
+static Natural significandOf(typename Format::Bits x)
+{
+    return Natural((static_cast<uint64_t>(x) & ((UINT64_C(1) << Format::MantissaBits) - 1)) |
+                   (UINT64_C(1) << Format::MantissaBits));
+}
+
+template <class Format>
+static int exponentOf(typename Format::Bits x)
+{
+    return static_cast<int>((x >> Format::MantissaBits) & Format::ExponentMax) - biasOf<Format>() - Format::MantissaBits;
+}
+
+template <class Format>
+static int signOf(typename Format::Bits x)
+{
+    return static_cast<int>((x >> Format::SignShift) & 1);
+}
+
+//  Truncates the exact result "significand * 2**exponent", which must have
+//  more significant bits than "Format" holds, to "Format"; "inexact" tells
+//  whether the exact result has already lost bits. Returns false if the
+//  result is in the denormalized range.
+template <class Format>
+static bool truncate(int sign, const Natural & significand, int exponent, bool inexact,
+                     typename Format::Bits & result, hadesvm::ieee754::Exception & exception)
+{
+    using Bits = typename Format::Bits;
+    using hadesvm::ieee754::Exception;
+
+    Bits signBit = static_cast<Bits>(sign) << Format::SignShift;
+    int length = significand.bitLength();
+    int leadingExponent = length - 1 + exponent;
+    if (leadingExponent > biasOf<Format>())
+    {   //  An infinity
+        result = signBit | static_cast<Bits>(Format::ExponentMax << Format::MantissaBits);
+        exception = Exception::Overflow;
+        return true;
+    }
+    if (leadingExponent < 1 - biasOf<Format>())
+    {
+        return false;
+    }
+    int droppedBits = length - (Format::MantissaBits + 1);
+    Q_ASSERT(droppedBits > 0);
+    Natural kept = significand >> droppedBits;
+    inexact |= (kept << droppedBits).compare(significand) != 0;
+    result = signBit |
+             (static_cast<Bits>(leadingExponent + biasOf<Format>()) << Format::MantissaBits) |
+             (static_cast<Bits>(kept.low64()) & ((Bits(1) << Format::MantissaBits) - 1));
+    exception = inexact ? Exception::Inexact : Exception::None;
+    return true;
+}
+
+template <class Format>
+static bool multiplyReference(typename Format::Bits x, typename Format::Bits y,
+                              typename Format::Bits & result, hadesvm::ieee754::Exception & exception)
+{
+    return truncate<Format>(signOf<Format>(x) ^ signOf<Format>(y),
+                            significandOf<Format>(x) * significandOf<Format>(y),
+                            exponentOf<Format>(x) + exponentOf<Format>(y),
+                            false, result, exception);
+}
+
+template <class Format>
+static bool divideReference(typename Format::Bits x, typename Format::Bits y,
+                            typename Format::Bits & result, hadesvm::ieee754::Exception & exception)
+{   //  Scaled this way, the quotient of significands has more bits than
+    //  "Format" holds
+    const int scale = Format::MantissaBits + 2;
+    Natural dividend = significandOf<Format>(x) << scale;
+    Natural divisor = significandOf<Format>(y);
+    Natural quotient = dividend / divisor;
+    return truncate<Format>(signOf<Format>(x) ^ signOf<Format>(y),
+                            quotient,
+                            exponentOf<Format>(x) - exponentOf<Format>(y) - scale,
+                            (quotient * divisor).compare(dividend) != 0, result, exception);
+}
+
+template <class Format>
+static typename Format::Bits randomNormalizedExponent()
+{
+    using Bits = typename Format::Bits;
+    switch (nextRandom() % 4)
+    {
+        case 0:     //  the smallest
+            return static_cast<Bits>(1 + nextRandom() % 2);
+        case 1:     //  the largest
+            return static_cast<Bits>(Format::ExponentMax - 1 - nextRandom() % 2);
+        default:
+            return static_cast<Bits>(1 + nextRandom() % (Format::ExponentMax - 1));
+    }
+}
+
+//  Normalized operands, with second operands often chosen so that the
+//  product or the quotient is close to 1, far from overflows and underflows
+template <class Format>
+static void generateNormalizedOperands(QList<typename Format::Bits> & x, QList<typename Format::Bits> & y, size_t count)
+{
+    using Bits = typename Format::Bits;
+    x.resize(static_cast<qsizetype>(count));
+    y.resize(static_cast<qsizetype>(count));
+    for (size_t i = 0; i < count; i++)
+    {
+        Bits xExponent = randomNormalizedExponent<Format>();
+        int yExponent;
+        switch (nextRandom() % 3)
+        {
+            case 0:     //  a product close to 1
+                yExponent = 2 * biasOf<Format>() - static_cast<int>(xExponent) + static_cast<int>(nextRandom() % 7) - 3;
+                break;
+            case 1:     //  a quotient close to 1
+                yExponent = static_cast<int>(xExponent) + static_cast<int>(nextRandom() % 7) - 3;
+                break;
+            default:
+                yExponent = static_cast<int>(randomNormalizedExponent<Format>());
+                break;
+        }
+        x[static_cast<qsizetype>(i)] = makeValue<Format>(xExponent);
+        y[static_cast<qsizetype>(i)] = makeValue<Format>(
+            static_cast<Bits>(qBound(1, yExponent, static_cast<int>(Format::ExponentMax) - 1)));
+    }
+}
+
+//  Runs "operation(x, y, environment)" on every pair of operands and
+//  compares its results and exception flags with those of
+//  "reference(x, y, result, exception)". On an overflow, the inexact flag
+//  may or may not be raised. Returns true if they all agree.
+template <class Format, class Operation, class Reference>
+static bool checkAgainstReference(const char * name,
+                                  const QList<typename Format::Bits> & x, const QList<typename Format::Bits> & y,
+                                  Operation operation, Reference reference)
+{
+    using Bits = typename Format::Bits;
+    using hadesvm::ieee754::Environment;
+    using hadesvm::ieee754::Exception;
+
+    size_t mismatches = 0, skipped = 0;
+    for (qsizetype i = 0; i < x.size(); i++)
+    {
+        Bits expected;
+        Exception expectedException;
+        if (!reference(x[i], y[i], expected, expectedException))
+        {
+            skipped++;
+            continue;
+        }
+        Environment environment;
+        Bits actual = operation(x[i], y[i], environment);
+        Exception actualException = environment.exception;
+        if (expectedException == Exception::Overflow)
+        {
+            actualException &= static_cast<Exception>(static_cast<int>(Exception::All) & ~static_cast<int>(Exception::Inexact));
+        }
+        if ((actual != expected || actualException != expectedException) && mismatches++ < 5)
+        {
+            printf("    %s: ", name);
+            describeOperands(x[i], y[i]);
+            printf(" -> %llx flags %02x, expected %llx flags %02x\n",
+                   static_cast<unsigned long long>(actual), static_cast<int>(actualException),
+                   static_cast<unsigned long long>(expected), static_cast<int>(expectedException));
+        }
+    }
+    printf("%-16s %14zu %14zu    %s\n",
+           name, static_cast<size_t>(x.size()) - skipped, skipped, (mismatches == 0) ? "ok" : "MISMATCH");
+    return mismatches == 0;
+}
+
+//  Checks multiplication and division of all formats against the reference
+//  model, printing a line per operation; returns true if they all agree
+static bool checkReference(size_t count)
+{
+    using hadesvm::ieee754::Environment;
+    using hadesvm::ieee754::Real21;
+    using hadesvm::ieee754::Real32;
+    using hadesvm::ieee754::Real64;
+
+    QList<uint32_t> x21, y21, x32, y32;
+    QList<uint64_t> x64, y64;
+    generateNormalizedOperands<Binary21>(x21, y21, count);
+    generateNormalizedOperands<Binary32>(x32, y32, count);
+    generateNormalizedOperands<Binary64>(x64, y64, count);
+
+    printf("%-16s %14s %14s\n", "operation", "checked", "skipped");
+    bool passed = true;
+    passed &= checkAgainstReference<Binary21>("Real21 multiply", x21, y21,
+        [](uint32_t x, uint32_t y, Environment & environment)
+        { return Real21::fromBitPattern(x).multiply(Real21::fromBitPattern(y), environment).bitPattern; },
+        multiplyReference<Binary21>);
+    passed &= checkAgainstReference<Binary21>("Real21 divide", x21, y21,
+        [](uint32_t x, uint32_t y, Environment & environment)
+        { return Real21::fromBitPattern(x).divide(Real21::fromBitPattern(y), environment).bitPattern; },
+        divideReference<Binary21>);
+    passed &= checkAgainstReference<Binary32>("Real32 multiply", x32, y32,
+        [](uint32_t x, uint32_t y, Environment & environment)
+        { return Real32::fromBitPattern(x).multiply(Real32::fromBitPattern(y), environment).bitPattern; },
+        multiplyReference<Binary32>);
+    passed &= checkAgainstReference<Binary32>("Real32 divide", x32, y32,
+        [](uint32_t x, uint32_t y, Environment & environment)
+        { return Real32::fromBitPattern(x).divide(Real32::fromBitPattern(y), environment).bitPattern; },
+        divideReference<Binary32>);
+    passed &= checkAgainstReference<Binary64>("Real64 multiply", x64, y64,
+        [](uint64_t x, uint64_t y, Environment & environment)
+        { return Real64::fromBitPattern(x).multiply(Real64::fromBitPattern(y), environment).bitPattern; },
+        multiplyReference<Binary64>);
+    passed &= checkAgainstReference<Binary64>("Real64 divide", x64, y64,
+        [](uint64_t x, uint64_t y, Environment & environment)
+        { return Real64::fromBitPattern(x).divide(Real64::fromBitPattern(y), environment).bitPattern; },
+        divideReference<Binary64>);
+    return passed;
+}
+
+//////////
+//  Real32 operations on 64-bit encodings. Each must produce exactly the
+//  result and the exceptions of narrowing the operands to Real32, doing
+//  the operation and widening the result.
+static uint64_t randomWidenedReal32()
+{   //  Mostly values a Real32 can hold exactly, the way a register holds them
+    uint64_t value = randomValueNear<Binary64>(false, 1023, 140);
+    return ((nextRandom() % 4) == 0) ? value : (value & ~UINT64_C(0x000000001FFFFFFF));
+}
+
+//  Compares "operation(x, y, environment)" with "expected(x, y, environment)"
+//  for every pair of operands; returns true if they all agree
+template <class Operation, class Expected>
+static bool checkAsReal32(const char * name, const QList<uint64_t> & x, const QList<uint64_t> & y,
+                          Operation operation, Expected expected)
+{
+    using hadesvm::ieee754::Environment;
+
+    size_t mismatches = 0;
+    for (qsizetype i = 0; i < x.size(); i++)
+    {
+        Environment environment, expectedEnvironment;
+        uint64_t result = operation(x[i], y[i], environment);
+        uint64_t expectedResult = expected(x[i], y[i], expectedEnvironment);
+        if ((result != expectedResult || environment.exception != expectedEnvironment.exception) && mismatches++ < 5)
+        {
+            printf("    %s: ", name);
+            describeOperands(x[i], y[i]);
+            printf(" -> %llx flags %02x, expected %llx flags %02x\n",
+                   static_cast<unsigned long long>(result), static_cast<int>(environment.exception),
+                   static_cast<unsigned long long>(expectedResult), static_cast<int>(expectedEnvironment.exception));
+        }
+    }
+    printf("%-16s %14zu    %s\n", name, static_cast<size_t>(x.size()), (mismatches == 0) ? "ok" : "MISMATCH");
+    return mismatches == 0;
+}
+
+static bool checkAsReal32(size_t count)
+{
+    using hadesvm::ieee754::Environment;
+    using hadesvm::ieee754::Real64;
+
+    QList<uint64_t> x(static_cast<qsizetype>(count)), y(static_cast<qsizetype>(count));
+    for (size_t i = 0; i < count; i++)
+    {
+        x[static_cast<qsizetype>(i)] = randomWidenedReal32();
+        y[static_cast<qsizetype>(i)] = randomWidenedReal32();
+    }
+
+    printf("%-16s %14s\n", "operation", "checked");
+    bool passed = true;
+    passed &= checkAsReal32("addAsReal32", x, y,
+        [](uint64_t a, uint64_t b, Environment & environment)
+        { return Real64::fromBitPattern(a).addAsReal32(Real64::fromBitPattern(b), environment).bitPattern; },
+        [](uint64_t a, uint64_t b, Environment & environment)
+        {
+            return Real64::fromBitPattern(a).toReal32(environment)
+                        .add(Real64::fromBitPattern(b).toReal32(environment), environment)
+                        .toReal64(environment).bitPattern;
+        });
+    passed &= checkAsReal32("subtractAsReal32", x, y,
+        [](uint64_t a, uint64_t b, Environment & environment)
+        { return Real64::fromBitPattern(a).subtractAsReal32(Real64::fromBitPattern(b), environment).bitPattern; },
+        [](uint64_t a, uint64_t b, Environment & environment)
+        {
+            return Real64::fromBitPattern(a).toReal32(environment)
+                        .subtract(Real64::fromBitPattern(b).toReal32(environment), environment)
+                        .toReal64(environment).bitPattern;
+        });
+    passed &= checkAsReal32("multiplyAsReal32", x, y,
+        [](uint64_t a, uint64_t b, Environment & environment)
+        { return Real64::fromBitPattern(a).multiplyAsReal32(Real64::fromBitPattern(b), environment).bitPattern; },
+        [](uint64_t a, uint64_t b, Environment & environment)
+        {
+            return Real64::fromBitPattern(a).toReal32(environment)
+                        .multiply(Real64::fromBitPattern(b).toReal32(environment), environment)
+                        .toReal64(environment).bitPattern;
+        });
+    passed &= checkAsReal32("divideAsReal32", x, y,
+        [](uint64_t a, uint64_t b, Environment & environment)
+        { return Real64::fromBitPattern(a).divideAsReal32(Real64::fromBitPattern(b), environment).bitPattern; },
+        [](uint64_t a, uint64_t b, Environment & environment)
+        {
+            return Real64::fromBitPattern(a).toReal32(environment)
+                        .divide(Real64::fromBitPattern(b).toReal32(environment), environment)
+                        .toReal64(environment).bitPattern;
+        });
+    return passed;
+}
+
+//////////
+//  Entry point
+int main(int argc, char ** argv)
+{
+    size_t count = 1000 * 1000;
+    if (argc > 2 || (argc == 2 && (count = static_cast<size_t>(strtoull(argv[1], nullptr, 10)) * 1000) == 0))
+    {
+        fprintf(stderr, "Usage: ieee754-verify [<thousands of operands per operation>]\n");
+        return 1;
+    }
+    printf("SIMD: %s, %zu operands per operation\n", hadesvm::ieee754::Batch::simdName(), count);
+
+    Operands operands;
+    bool passed = true;
+    printf("TestFloat-style operands:\n");
+    generateOperands(false, operands, count);
+    passed &= checkAll(operands, count);
+    printf("Typical operands:\n");
+    generateOperands(true, operands, count);
+    passed &= checkAll(operands, count);
+    printf("Against the reference model:\n");
+    passed &= checkReference(count);
+    printf("Real32 operations on 64-bit encodings:\n");
+    passed &= checkAsReal32(count);
+    return passed ? 0 : 1;
+}
+
+//  End of main.cpp